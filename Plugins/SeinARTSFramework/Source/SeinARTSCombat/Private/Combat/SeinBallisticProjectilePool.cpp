@@ -0,0 +1,452 @@
+/**
+ * SeinARTS Framework - Copyright (c) 2026 Phenom Studios, Inc.
+ *
+ * @file         SeinBallisticProjectilePool.cpp
+ * @author       RJ Macklem
+ * @created      17 Oct 2026
+ * @latest       17 Oct 2026
+ * @brief        Ballistic pool spawn, parallel flight step, compaction, payload
+ *               interning and canonical capture/restore.
+ */
+
+#include "Combat/SeinBallisticProjectilePool.h"
+#include "Core/SeinEntityPool.h"
+#include "Core/SeinParallel.h"
+#include "Serialization/SeinBallisticProjectileCanonicalState.h"
+#include "Serialization/SeinCanonicalInitialStateDigest.h"
+#include "Simulation/SeinWorldSubsystem.h"
+#include "Types/Entity.h"
+
+namespace
+{
+	bool PayloadsEqual(const FSeinDamagePayload& A, const FSeinDamagePayload& B)
+	{
+		return A.BaseDamage == B.BaseDamage
+			&& A.DamageTypeTag == B.DamageTypeTag
+			&& A.AreaRadius == B.AreaRadius
+			&& A.FormulaClass == B.FormulaClass;
+	}
+
+	/** Lookup only; never captured or digested. */
+	uint32 HashPayload(const FSeinDamagePayload& Payload)
+	{
+		uint32 Hash = GetTypeHash(Payload.BaseDamage.Value);
+		Hash = HashCombineFast(Hash, GetTypeHash(Payload.DamageTypeTag));
+		Hash = HashCombineFast(Hash, GetTypeHash(Payload.AreaRadius.Value));
+		return HashCombineFast(Hash, GetTypeHash(Payload.FormulaClass));
+	}
+
+	bool WriteVector(FSeinCanonicalDigestWriter& Writer, const FFixedVector& Value)
+	{
+		return Writer.WriteInt64(Value.X.Value)
+			&& Writer.WriteInt64(Value.Y.Value)
+			&& Writer.WriteInt64(Value.Z.Value);
+	}
+
+	bool WriteHandle(FSeinCanonicalDigestWriter& Writer, FSeinEntityHandle Handle)
+	{
+		return Writer.WriteInt32(Handle.Index)
+			&& Writer.WriteInt32(Handle.Generation);
+	}
+}
+
+int32 FSeinBallisticProjectilePool::InternPayload(const FSeinDamagePayload& Payload)
+{
+	const uint32 Hash = HashPayload(Payload);
+	for (auto It = PayloadSlotsByHash.CreateConstKeyIterator(Hash); It; ++It)
+	{
+		if (PayloadsEqual(Payloads[It.Value()], Payload))
+		{
+			return It.Value();
+		}
+	}
+
+	// Lowest free slot first, so slot numbering is a pure function of the
+	// spawn and landing order.
+	int32 Slot = INDEX_NONE;
+	if (FreePayloadSlots.Num() > 0)
+	{
+		FreePayloadSlots.HeapPop(Slot, EAllowShrinking::No);
+		Payloads[Slot] = Payload;
+	}
+	else
+	{
+		if (Payloads.Num() >= MaxPayloads)
+		{
+			return INDEX_NONE;
+		}
+		Slot = Payloads.Add(Payload);
+		PayloadRefCounts.Add(0);
+	}
+	PayloadSlotsByHash.Add(Hash, Slot);
+	return Slot;
+}
+
+void FSeinBallisticProjectilePool::ReleasePayload(int32 PayloadIndex)
+{
+	if (--PayloadRefCounts[PayloadIndex] > 0)
+	{
+		return;
+	}
+	PayloadSlotsByHash.RemoveSingle(HashPayload(Payloads[PayloadIndex]), PayloadIndex);
+	Payloads[PayloadIndex] = FSeinDamagePayload();
+	if (PayloadIndex != Payloads.Num() - 1)
+	{
+		FreePayloadSlots.HeapPush(PayloadIndex);
+		return;
+	}
+
+	// Never end the table in a free slot: trim, then forget trimmed slots.
+	while (Payloads.Num() > 0 && PayloadRefCounts.Last() == 0)
+	{
+		Payloads.Pop(EAllowShrinking::No);
+		PayloadRefCounts.Pop(EAllowShrinking::No);
+	}
+	const int32 Live = Payloads.Num();
+	FreePayloadSlots.RemoveAll([Live](int32 Slot) { return Slot >= Live; });
+	FreePayloadSlots.Heapify();
+}
+
+void FSeinBallisticProjectilePool::RebuildPayloadIndex()
+{
+	PayloadRefCounts.Init(0, Payloads.Num());
+	for (const int32 PayloadIndex : PayloadIndices)
+	{
+		++PayloadRefCounts[PayloadIndex];
+	}
+	FreePayloadSlots.Reset();
+	PayloadSlotsByHash.Reset();
+	for (int32 Slot = 0; Slot < Payloads.Num(); ++Slot)
+	{
+		if (PayloadRefCounts[Slot] == 0)
+		{
+			// Ascending, so already a valid min-heap.
+			FreePayloadSlots.Add(Slot);
+		}
+		else
+		{
+			PayloadSlotsByHash.Add(HashPayload(Payloads[Slot]), Slot);
+		}
+	}
+}
+
+bool FSeinBallisticProjectilePool::Spawn(const FSeinBallisticProjectileSpawn& Spawn)
+{
+	SEIN_CHECK_NOT_PARALLEL();
+	if (Ids.Num() >= MaxProjectiles)
+	{
+		return false;
+	}
+	const int32 PayloadIndex = InternPayload(Spawn.Payload);
+	if (PayloadIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	Ids.Add(NextProjectileId++);
+	Instigators.Add(Spawn.Instigator);
+	Targets.Add(Spawn.Target);
+	Positions.Add(Spawn.Origin);
+	PreviousPositions.Add(Spawn.Origin);
+	Destinations.Add(Spawn.TargetPoint);
+	Speeds.Add(Spawn.Speed > FFixedPoint::Zero
+		? Spawn.Speed
+		: FFixedPoint::FromInt(DefaultSpeed));
+	Lifetimes.Add(FFixedPoint::FromInt(DefaultLifetimeSeconds));
+	PayloadIndices.Add(PayloadIndex);
+	++PayloadRefCounts[PayloadIndex];
+	Outcomes.Add(ESeinBallisticProjectileOutcome::InFlight);
+	++MutationRevision;
+	return true;
+}
+
+void FSeinBallisticProjectilePool::Step(
+	FFixedPoint DeltaTime,
+	const USeinWorldSubsystem& World)
+{
+	const int32 Count = Ids.Num();
+	if (Count == 0)
+	{
+		return;
+	}
+	const FSeinEntityPool& EntityPool = World.GetEntityPool();
+
+	SeinParallelFor(Count, [&](int32 Index)
+	{
+		PreviousPositions[Index] = Positions[Index];
+
+		// Refresh homing while the target lives.
+		const FSeinEntity* TargetEntity = Targets[Index].IsValid()
+			? EntityPool.Get(Targets[Index])
+			: nullptr;
+		if (TargetEntity && TargetEntity->IsAlive())
+		{
+			Destinations[Index] = TargetEntity->Transform.GetLocation();
+		}
+		else
+		{
+			Targets[Index] = FSeinEntityHandle();
+		}
+
+		Lifetimes[Index] = Lifetimes[Index] - DeltaTime;
+
+		const FFixedVector Position = Positions[Index];
+		const FFixedVector Destination = Destinations[Index];
+		const FFixedPoint StepLength = Speeds[Index] * DeltaTime;
+		if (FFixedVector::IsDistanceWithin(Position, Destination, StepLength))
+		{
+			Positions[Index] = Destination;
+			Outcomes[Index] = ESeinBallisticProjectileOutcome::Arrived;
+			return;
+		}
+		if (Lifetimes[Index] <= FFixedPoint::Zero)
+		{
+			Outcomes[Index] = ESeinBallisticProjectileOutcome::Expired;
+			return;
+		}
+		Positions[Index] = Position
+			+ FFixedVector::GetSafeNormalDifference(Position, Destination) * StepLength;
+		Outcomes[Index] = ESeinBallisticProjectileOutcome::InFlight;
+	});
+	++MutationRevision;
+}
+
+void FSeinBallisticProjectilePool::RemoveFinished()
+{
+	SEIN_CHECK_NOT_PARALLEL();
+	const int32 Count = Ids.Num();
+	int32 Write = 0;
+	for (int32 Read = 0; Read < Count; ++Read)
+	{
+		if (Outcomes[Read] != ESeinBallisticProjectileOutcome::InFlight)
+		{
+			ReleasePayload(PayloadIndices[Read]);
+			continue;
+		}
+		if (Write != Read)
+		{
+			Ids[Write] = Ids[Read];
+			Instigators[Write] = Instigators[Read];
+			Targets[Write] = Targets[Read];
+			Positions[Write] = Positions[Read];
+			PreviousPositions[Write] = PreviousPositions[Read];
+			Destinations[Write] = Destinations[Read];
+			Speeds[Write] = Speeds[Read];
+			Lifetimes[Write] = Lifetimes[Read];
+			PayloadIndices[Write] = PayloadIndices[Read];
+			Outcomes[Write] = Outcomes[Read];
+		}
+		++Write;
+	}
+	if (Write == Count)
+	{
+		return;
+	}
+	if (Write == 0)
+	{
+		RemoveAll();
+	}
+	else
+	{
+		Ids.SetNum(Write, EAllowShrinking::No);
+		Instigators.SetNum(Write, EAllowShrinking::No);
+		Targets.SetNum(Write, EAllowShrinking::No);
+		Positions.SetNum(Write, EAllowShrinking::No);
+		PreviousPositions.SetNum(Write, EAllowShrinking::No);
+		Destinations.SetNum(Write, EAllowShrinking::No);
+		Speeds.SetNum(Write, EAllowShrinking::No);
+		Lifetimes.SetNum(Write, EAllowShrinking::No);
+		PayloadIndices.SetNum(Write, EAllowShrinking::No);
+		Outcomes.SetNum(Write, EAllowShrinking::No);
+	}
+	++MutationRevision;
+}
+
+void FSeinBallisticProjectilePool::RemoveAll()
+{
+	// Keep the allocations — a weapon that just emptied the pool is about to
+	// fill it again.
+	Ids.Reset();
+	Instigators.Reset();
+	Targets.Reset();
+	Positions.Reset();
+	PreviousPositions.Reset();
+	Destinations.Reset();
+	Speeds.Reset();
+	Lifetimes.Reset();
+	PayloadIndices.Reset();
+	Outcomes.Reset();
+	Payloads.Reset();
+	PayloadRefCounts.Reset();
+	FreePayloadSlots.Reset();
+	PayloadSlotsByHash.Reset();
+}
+
+void FSeinBallisticProjectilePool::Reset()
+{
+	RemoveAll();
+	NextProjectileId = 1;
+	++MutationRevision;
+}
+
+void FSeinBallisticProjectilePool::Capture(
+	FSeinBallisticProjectileCanonicalState& OutState) const
+{
+	OutState.NextProjectileId = NextProjectileId;
+	OutState.Payloads = Payloads;
+	OutState.Projectiles.Reset(Ids.Num());
+	for (int32 Index = 0; Index < Ids.Num(); ++Index)
+	{
+		FSeinBallisticProjectileRecord& Record = OutState.Projectiles.AddDefaulted_GetRef();
+		Record.Id = Ids[Index];
+		Record.Instigator = Instigators[Index];
+		Record.Target = Targets[Index];
+		Record.Position = Positions[Index];
+		Record.Destination = Destinations[Index];
+		Record.Speed = Speeds[Index];
+		Record.LifetimeRemaining = Lifetimes[Index];
+		Record.PayloadIndex = PayloadIndices[Index];
+	}
+}
+
+bool FSeinBallisticProjectilePool::Validate(
+	const FSeinBallisticProjectileCanonicalState& State,
+	FString& OutError)
+{
+	if (State.Projectiles.Num() > MaxProjectiles
+		|| State.Payloads.Num() > MaxPayloads)
+	{
+		OutError = TEXT("Ballistic projectile state exceeds the pool bounds.");
+		return false;
+	}
+	TArray<int32> RefCounts;
+	RefCounts.Init(0, State.Payloads.Num());
+	uint32 PreviousId = 0;
+	for (const FSeinBallisticProjectileRecord& Record : State.Projectiles)
+	{
+		if (Record.Id <= PreviousId
+			|| Record.Id >= State.NextProjectileId
+			|| !State.Payloads.IsValidIndex(Record.PayloadIndex)
+			|| Record.Speed <= FFixedPoint::Zero
+			|| Record.LifetimeRemaining <= FFixedPoint::Zero)
+		{
+			OutError = FString::Printf(
+				TEXT("Ballistic projectile record %u is out of order or malformed."),
+				Record.Id);
+			return false;
+		}
+		PreviousId = Record.Id;
+		++RefCounts[Record.PayloadIndex];
+	}
+
+	// The shape the pool itself maintains: free slots hold the default
+	// payload, the table never ends in one, and live payloads are distinct.
+	if (RefCounts.Num() > 0 && RefCounts.Last() == 0)
+	{
+		OutError = TEXT("Ballistic projectile payload table ends in an unreferenced slot.");
+		return false;
+	}
+	const FSeinDamagePayload FreeSlot;
+	TMultiMap<uint32, int32> LiveByHash;
+	for (int32 Slot = 0; Slot < State.Payloads.Num(); ++Slot)
+	{
+		const FSeinDamagePayload& Payload = State.Payloads[Slot];
+		if (RefCounts[Slot] == 0)
+		{
+			if (!PayloadsEqual(Payload, FreeSlot))
+			{
+				OutError = FString::Printf(
+					TEXT("Ballistic projectile payload slot %d is unreferenced but not cleared."),
+					Slot);
+				return false;
+			}
+			continue;
+		}
+		const uint32 Hash = HashPayload(Payload);
+		for (auto It = LiveByHash.CreateConstKeyIterator(Hash); It; ++It)
+		{
+			if (PayloadsEqual(State.Payloads[It.Value()], Payload))
+			{
+				OutError = FString::Printf(
+					TEXT("Ballistic projectile payload slots %d and %d are duplicates."),
+					It.Value(), Slot);
+				return false;
+			}
+		}
+		LiveByHash.Add(Hash, Slot);
+	}
+	return true;
+}
+
+void FSeinBallisticProjectilePool::Restore(
+	const FSeinBallisticProjectileCanonicalState& State)
+{
+	RemoveAll();
+	NextProjectileId = State.NextProjectileId;
+	Payloads = State.Payloads;
+	const int32 Count = State.Projectiles.Num();
+	Ids.Reserve(Count);
+	Instigators.Reserve(Count);
+	Targets.Reserve(Count);
+	Positions.Reserve(Count);
+	PreviousPositions.Reserve(Count);
+	Destinations.Reserve(Count);
+	Speeds.Reserve(Count);
+	Lifetimes.Reserve(Count);
+	PayloadIndices.Reserve(Count);
+	Outcomes.Reserve(Count);
+	for (const FSeinBallisticProjectileRecord& Record : State.Projectiles)
+	{
+		Ids.Add(Record.Id);
+		Instigators.Add(Record.Instigator);
+		Targets.Add(Record.Target);
+		Positions.Add(Record.Position);
+		// No history survives a restore; presentation starts at rest.
+		PreviousPositions.Add(Record.Position);
+		Destinations.Add(Record.Destination);
+		Speeds.Add(Record.Speed);
+		Lifetimes.Add(Record.LifetimeRemaining);
+		PayloadIndices.Add(Record.PayloadIndex);
+		Outcomes.Add(ESeinBallisticProjectileOutcome::InFlight);
+	}
+	RebuildPayloadIndex();
+	++MutationRevision;
+}
+
+bool FSeinBallisticProjectilePool::WriteDigest(FSeinCanonicalDigestWriter& Writer) const
+{
+	if (!Writer.WriteUInt32(NextProjectileId)
+		|| !Writer.WriteInt32(Payloads.Num()))
+	{
+		return false;
+	}
+	for (const FSeinDamagePayload& Payload : Payloads)
+	{
+		if (!Writer.WriteInt64(Payload.BaseDamage.Value)
+			|| !Writer.WriteName(Payload.DamageTypeTag.GetTagName())
+			|| !Writer.WriteInt64(Payload.AreaRadius.Value)
+			|| !Writer.WriteString(Payload.FormulaClass.ToString()))
+		{
+			return false;
+		}
+	}
+	if (!Writer.WriteInt32(Ids.Num()))
+	{
+		return false;
+	}
+	for (int32 Index = 0; Index < Ids.Num(); ++Index)
+	{
+		if (!Writer.WriteUInt32(Ids[Index])
+			|| !WriteHandle(Writer, Instigators[Index])
+			|| !WriteHandle(Writer, Targets[Index])
+			|| !WriteVector(Writer, Positions[Index])
+			|| !WriteVector(Writer, Destinations[Index])
+			|| !Writer.WriteInt64(Speeds[Index].Value)
+			|| !Writer.WriteInt64(Lifetimes[Index].Value)
+			|| !Writer.WriteInt32(PayloadIndices[Index]))
+		{
+			return false;
+		}
+	}
+	return true;
+}
@@ -10,6 +10,7 @@
 #include "Combat/SeinCombatMath.h"
 #include "Combat/SeinDamageFormula.h"
 #include "Components/SeinVitalsComponent.h"
+#include "Core/SeinEntitySpatialIndex.h"
 #include "Events/SeinVisualEvent.h"
 #include "Simulation/SeinWorldSubsystem.h"
 #include "Tags/SeinCombatGameplayTags.h"
@@ -142,27 +143,30 @@ int32 FSeinCombatDamage::ResolveImpact(
 		FFixedPoint Distance;
 	};
 	TArray<FSplashVictim> SplashVictims;
-	World.GetEntityPool().ForEachEntity(
-		[&](FSeinEntityHandle Handle, const FSeinEntity& Entity)
+	TArray<FSeinEntityHandle> Candidates;
+	World.GetEntitySpatialIndex().GatherCandidatesInRadius(
+		ImpactPoint, Payload.AreaRadius, Candidates);
+	const FSeinEntityPool& Pool = World.GetEntityPool();
+	for (const FSeinEntityHandle Handle : Candidates)
+	{
+		if (Handle == DirectTarget)
 		{
-			if (Handle == DirectTarget)
-			{
-				return; // Always evaluated at distance zero below.
-			}
-			if (!World.GetComponent<FSeinVitalsComponent>(Handle))
-			{
-				return;
-			}
-			const FFixedVector Location = Entity.Transform.GetLocation();
-			if (!FFixedVector::IsPlanarDistanceWithin(
-					Location, ImpactPoint, Payload.AreaRadius))
-			{
-				return;
-			}
-			SplashVictims.Add({Handle,
-				SeinCombatInternal::PlanarDistanceSaturated(
-					Location, ImpactPoint)});
-		});
+			continue; // Always evaluated at distance zero below.
+		}
+		if (!World.GetComponent<FSeinVitalsComponent>(Handle))
+		{
+			continue;
+		}
+		const FFixedVector Location = Pool.Get(Handle)->Transform.GetLocation();
+		if (!FFixedVector::IsPlanarDistanceWithin(
+				Location, ImpactPoint, Payload.AreaRadius))
+		{
+			continue;
+		}
+		SplashVictims.Add({Handle,
+			SeinCombatInternal::PlanarDistanceSaturated(
+				Location, ImpactPoint)});
+	}
 
 	if (World.IsEntityAlive(DirectTarget)
 		&& ApplyDamage(World, DirectTarget, Instigator, Payload)
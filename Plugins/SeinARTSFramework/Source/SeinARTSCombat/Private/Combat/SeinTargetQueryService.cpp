@@ -1,15 +1,17 @@
 /**
  * SeinARTS Framework - Copyright (c) 2026 Phenom Studios, Inc.
  * @file    SeinTargetQueryService.cpp
- * @brief   Deterministic acquisition sweep + scorer policy evaluation.
+ * @brief   Deterministic indexed acquisition + scorer policy evaluation.
  */
 
 #include "Combat/SeinTargetQueryService.h"
 #include "Combat/SeinCombatMath.h"
 #include "Combat/SeinTargetScorer.h"
+#include "Combat/SeinTargetSpatialIndex.h"
 #include "Components/SeinVitalsComponent.h"
 #include "Math/MathLib.h"
 #include "Simulation/SeinWorldSubsystem.h"
+#include "System/SeinCombatSubsystem.h"
 #include "Types/Entity.h"
 
 namespace
@@ -26,125 +28,229 @@ namespace
 		}
 		return GetDefault<USeinTargetScorer>();
 	}
-}
 
-void FSeinTargetQueryService::FindTargets(
-	const USeinWorldSubsystem& World,
-	const FSeinTargetQuery& Query,
-	TArray<FSeinTargetCandidate>& OutCandidates)
-{
-	OutCandidates.Reset();
-	if (Query.Range <= FFixedPoint::Zero || Query.MaxResults <= 0)
+	/** Per-query invariants, resolved once before the sweep. */
+	struct FPreparedTargetQuery
 	{
-		return;
-	}
+		FFixedVector Origin;
+		FFixedVector PlanarForward;
+		FFixedPoint CosHalfAngle;
+		FSeinPlayerID ObserverPlayer;
+		const USeinTargetScorer* Scorer = nullptr;
+		bool bActive = false;
+		bool bArcGated = false;
+		bool bConsultLineOfSight = false;
+		/** Exactly the built-in scorer: its defaults are pure reads, so the
+		 *  policy is called natively (no ProcessEvent thunk per candidate). */
+		bool bNativeScorer = false;
+		/** RequiredTargetTags compiled once; each candidate is a masked AND. */
+		FSeinTagBitMask RequiredTags;
+	};
 
-	FFixedVector Origin = Query.Origin;
-	FFixedVector InstigatorForward = FFixedVector::ForwardVector;
-	if (Query.Instigator.IsValid())
+	FPreparedTargetQuery PrepareQuery(
+		const USeinWorldSubsystem& World,
+		const FSeinTargetQuery& Query)
 	{
-		const FSeinEntity* InstigatorEntity =
-			World.GetEntity(Query.Instigator);
-		if (InstigatorEntity)
+		FPreparedTargetQuery Prepared;
+		if (Query.Range <= FFixedPoint::Zero || Query.MaxResults <= 0)
 		{
-			if (Origin.IsZero())
+			return Prepared;
+		}
+		Prepared.bActive = true;
+
+		Prepared.Origin = Query.Origin;
+		FFixedVector InstigatorForward = FFixedVector::ForwardVector;
+		if (Query.Instigator.IsValid())
+		{
+			const FSeinEntity* InstigatorEntity =
+				World.GetEntity(Query.Instigator);
+			if (InstigatorEntity)
 			{
-				Origin = InstigatorEntity->Transform.GetLocation();
+				if (Prepared.Origin.IsZero())
+				{
+					Prepared.Origin = InstigatorEntity->Transform.GetLocation();
+				}
+				InstigatorForward =
+					InstigatorEntity->Transform.GetRotation().GetForwardVector();
 			}
-			InstigatorForward =
-				InstigatorEntity->Transform.GetRotation().GetForwardVector();
 		}
-	}
 
-	// Arc gate precompute: dot(forward, delta) >= |delta| * cos(halfAngle)
-	// avoids normalizing per-candidate. 180°+ disables the gate.
-	const bool bArcGated =
-		Query.ArcHalfAngleDegrees < FFixedPoint::FromInt(180)
-		&& Query.ArcHalfAngleDegrees >= FFixedPoint::Zero;
-	const FFixedPoint CosHalfAngle = bArcGated
-		? SeinMath::Cos(Query.ArcHalfAngleDegrees
-			* FFixedPoint::Pi / FFixedPoint::FromInt(180))
-		: FFixedPoint::Zero;
-	FFixedVector PlanarForward = InstigatorForward;
-	PlanarForward.Z = FFixedPoint::Zero;
+		// Arc gate precompute: dot(forward, delta) >= |delta| * cos(halfAngle)
+		// avoids normalizing per-candidate. 180°+ disables the gate.
+		Prepared.bArcGated =
+			Query.ArcHalfAngleDegrees < FFixedPoint::FromInt(180)
+			&& Query.ArcHalfAngleDegrees >= FFixedPoint::Zero;
+		Prepared.CosHalfAngle = Prepared.bArcGated
+			? SeinMath::Cos(Query.ArcHalfAngleDegrees
+				* FFixedPoint::Pi / FFixedPoint::FromInt(180))
+			: FFixedPoint::Zero;
+		Prepared.PlanarForward = InstigatorForward;
+		Prepared.PlanarForward.Z = FFixedPoint::Zero;
+
+		Prepared.ObserverPlayer = Query.Instigator.IsValid()
+			? World.GetEntityOwner(Query.Instigator)
+			: FSeinPlayerID();
+		Prepared.Scorer = ResolveScorer(Query);
+		Prepared.bNativeScorer =
+			Prepared.Scorer->GetClass() == USeinTargetScorer::StaticClass();
+		Prepared.bConsultLineOfSight = Query.bRequireLineOfSight
+			&& World.LineOfSightResolver.IsBound();
+		Prepared.RequiredTags = World.CompileTagMask(Query.RequiredTargetTags);
+		return Prepared;
+	}
 
-	const FSeinPlayerID ObserverPlayer = Query.Instigator.IsValid()
-		? World.GetEntityOwner(Query.Instigator)
-		: FSeinPlayerID();
-	const USeinTargetScorer* Scorer = ResolveScorer(Query);
+	/** The combat subsystem's index, refreshed on the serial spine at the
+	 *  end of PreTick; null when the world hosts no combat substrate. */
+	const FSeinTargetSpatialIndex* FindTargetIndex(
+		const USeinWorldSubsystem& World)
+	{
+		const UWorld* GameWorld = World.GetWorld();
+		const USeinCombatSubsystem* Combat = GameWorld
+			? GameWorld->GetSubsystem<USeinCombatSubsystem>()
+			: nullptr;
+		return Combat ? &Combat->GetTargetIndex() : nullptr;
+	}
 
-	World.GetEntityPool().ForEachEntity(
-		[&](FSeinEntityHandle Handle, const FSeinEntity& Entity)
+	/** Mechanical gates (alive, health, planar range, arc, tags) over the
+	 *  index's canonical-order candidates. Pure reads of the world; calls
+	 *  Visit(Candidate) with Distance filled in, in ascending slot order. */
+	template <typename VisitorType>
+	void SweepCandidates(
+		const USeinWorldSubsystem& World,
+		const FSeinTargetSpatialIndex& Index,
+		const FSeinTargetQuery& Query,
+		const FPreparedTargetQuery& Prepared,
+		TArray<FSeinEntityHandle>& Scratch,
+		VisitorType&& Visit)
+	{
+		Scratch.Reset();
+		Index.QueryCandidates(
+			Prepared.Origin, Query.Range, Scratch, Query.Instigator);
+		for (const FSeinEntityHandle Handle : Scratch)
 		{
-			if (Handle == Query.Instigator)
+			const FSeinEntity* Entity = World.GetEntity(Handle);
+			if (!Entity)
 			{
-				return;
+				continue;
 			}
 			const FSeinVitalsComponent* Vitals =
 				World.GetComponent<FSeinVitalsComponent>(Handle);
 			if (!Vitals || Vitals->Health <= FFixedPoint::Zero)
 			{
-				return;
+				continue;
 			}
-			const FFixedVector Location = Entity.Transform.GetLocation();
+			const FFixedVector Location = Entity->Transform.GetLocation();
 			if (!FFixedVector::IsPlanarDistanceWithin(
-					Location, Origin, Query.Range))
+					Location, Prepared.Origin, Query.Range))
 			{
-				return;
+				continue;
 			}
 			const FFixedPoint Distance =
 				SeinCombatInternal::PlanarDistanceSaturated(
-					Location, Origin);
-			if (bArcGated)
+					Location, Prepared.Origin);
+			if (Prepared.bArcGated)
 			{
-				FFixedVector PlanarDelta = Location - Origin;
+				FFixedVector PlanarDelta = Location - Prepared.Origin;
 				PlanarDelta.Z = FFixedPoint::Zero;
 				const FFixedPoint Dot =
-					PlanarForward.X * PlanarDelta.X
-					+ PlanarForward.Y * PlanarDelta.Y;
-				if (Dot < Distance * CosHalfAngle)
+					Prepared.PlanarForward.X * PlanarDelta.X
+					+ Prepared.PlanarForward.Y * PlanarDelta.Y;
+				if (Dot < Distance * Prepared.CosHalfAngle)
 				{
-					return;
+					continue;
 				}
 			}
-			if (!Query.RequiredTargetTags.IsEmpty())
+			if (!World.EntityMatchesAllTags(Handle, Prepared.RequiredTags))
 			{
-				for (const FGameplayTag& Tag : Query.RequiredTargetTags)
-				{
-					if (!World.HasTag(Handle, Tag))
-					{
-						return;
-					}
-				}
-			}
-			if (Query.bRequireLineOfSight
-				&& World.LineOfSightResolver.IsBound()
-				&& !World.LineOfSightResolver.Execute(
-					ObserverPlayer, Location))
-			{
-				return;
-			}
-			if (!Scorer->IsValidTarget(&World, Query, Handle))
-			{
-				return;
+				continue;
 			}
 
 			FSeinTargetCandidate Candidate;
 			Candidate.Target = Handle;
 			Candidate.Distance = Distance;
-			Candidate.Score = Scorer->ScoreTarget(&World, Query, Candidate);
-			OutCandidates.Add(Candidate);
-		});
+			Visit(Candidate);
+		}
+	}
 
-	// Best score first; exact ties keep canonical (ascending-slot) order —
-	// the sweep produced canonical order and the sort is stable.
-	OutCandidates.StableSort(
-		[](const FSeinTargetCandidate& A, const FSeinTargetCandidate& B)
+	/** Bounded best-K insert. Candidates arrive in canonical order, so
+	 *  inserting after every equal score reproduces the former stable sort
+	 *  (best score first, ties in canonical order) without sorting all N. */
+	void OfferTopK(
+		TArray<FSeinTargetCandidate>& Best,
+		const FSeinTargetCandidate& Candidate,
+		int32 MaxResults)
+	{
+		if (Best.Num() >= MaxResults
+			&& Candidate.Score <= Best.Last().Score)
 		{
-			return A.Score > B.Score;
-		});
-	if (OutCandidates.Num() > Query.MaxResults)
+			return;
+		}
+		int32 InsertAt = Best.Num();
+		while (InsertAt > 0 && Best[InsertAt - 1].Score < Candidate.Score)
+		{
+			--InsertAt;
+		}
+		Best.Insert(Candidate, InsertAt);
+		if (Best.Num() > MaxResults)
+		{
+			Best.Pop(EAllowShrinking::No);
+		}
+	}
+
+	/** Policy half: fog LoS, scorer validity, score, top-K. Native-scorer
+	 *  queries bypass the BlueprintNativeEvent thunk. */
+	void ApplyPolicy(
+		const USeinWorldSubsystem& World,
+		const FSeinTargetQuery& Query,
+		const FPreparedTargetQuery& Prepared,
+		FSeinTargetCandidate Candidate,
+		TArray<FSeinTargetCandidate>& Best)
 	{
-		OutCandidates.SetNum(Query.MaxResults);
+		if (Prepared.bConsultLineOfSight)
+		{
+			const FSeinEntity* Entity = World.GetEntity(Candidate.Target);
+			if (!Entity || !World.LineOfSightResolver.Execute(
+					Prepared.ObserverPlayer, Entity->Transform.GetLocation()))
+			{
+				return;
+			}
+		}
+		const USeinTargetScorer* Scorer = Prepared.Scorer;
+		const bool bValid = Prepared.bNativeScorer
+			? Scorer->IsValidTarget_Implementation(&World, Query, Candidate.Target)
+			: Scorer->IsValidTarget(&World, Query, Candidate.Target);
+		if (!bValid)
+		{
+			return;
+		}
+		Candidate.Score = Prepared.bNativeScorer
+			? Scorer->ScoreTarget_Implementation(&World, Query, Candidate)
+			: Scorer->ScoreTarget(&World, Query, Candidate);
+		OfferTopK(Best, Candidate, Query.MaxResults);
 	}
 }
+
+void FSeinTargetQueryService::FindTargets(
+	const USeinWorldSubsystem& World,
+	const FSeinTargetQuery& Query,
+	TArray<FSeinTargetCandidate>& OutCandidates)
+{
+	OutCandidates.Reset();
+	const FPreparedTargetQuery Prepared = PrepareQuery(World, Query);
+	if (!Prepared.bActive)
+	{
+		return;
+	}
+
+	const FSeinTargetSpatialIndex* Index = FindTargetIndex(World);
+	if (!Index)
+	{
+		return;
+	}
+	TArray<FSeinEntityHandle> Scratch;
+	SweepCandidates(World, *Index, Query, Prepared, Scratch,
+		[&](const FSeinTargetCandidate& Candidate)
+		{
+			ApplyPolicy(World, Query, Prepared, Candidate, OutCandidates);
+		});
+}
@@ -0,0 +1,108 @@
+/**
+ * SeinARTS Framework - Copyright (c) 2026 Phenom Studios, Inc.
+ *
+ * @file         SeinTargetSpatialIndex.cpp
+ * @author       RJ Macklem
+ * @created      17 Oct 2026
+ * @latest       17 Oct 2026
+ * @brief        Revision-keyed rebuild + bucket query for the acquisition
+ *               index.
+ */
+
+#include "Combat/SeinTargetSpatialIndex.h"
+#include "Components/SeinVitalsComponent.h"
+#include "Core/SeinParallel.h"
+#include "Simulation/ComponentStorage.h"
+#include "Simulation/SeinWorldSubsystem.h"
+#include "Types/Entity.h"
+
+namespace
+{
+	// 10 m cells: typical weapon ranges (15–40 m) fan out over a handful of
+	// cells while a crowded cell still holds only a few dozen entries.
+	const FFixedPoint TargetIndexCellSize = FFixedPoint::FromInt(1000);
+}
+
+void FSeinTargetSpatialIndex::Refresh(const USeinWorldSubsystem& World)
+{
+	SEIN_CHECK_NOT_PARALLEL();
+
+	const FSeinEntityPool& Pool = World.GetEntityPool();
+	const ISeinComponentStorage* Storage =
+		World.GetComponentStorageRaw(FSeinVitalsComponent::StaticStruct());
+	const uint64 StorageTopology = Storage ? Storage->GetTopologyRevision() : 0;
+	if (bValid
+		&& VitalsStorage == Storage
+		&& VitalsTopologyRevision == StorageTopology
+		&& PoolTopologyRevision == Pool.GetTopologyRevision()
+		&& PoolMutationRevision == Pool.GetLatestMutationRevision())
+	{
+		return;
+	}
+
+	// Positions live on the pool slot, so any pool mutation revision move may
+	// have relocated a candidate; vitals membership changes move the storage
+	// topology. Health is not indexed — the query reads it live.
+	BuildScratch.Reset();
+	IndexedHandles.Reset();
+	if (Storage)
+	{
+		Storage->ForEachLiveComponent(
+			[&](FSeinEntityHandle Handle, const void* /*RawComponent*/)
+			{
+				const FSeinEntity* Entity = World.GetEntity(Handle);
+				if (!Entity)
+				{
+					return;
+				}
+				FSeinCollisionSpatialHash::FDynamicColliderInput& Input =
+					BuildScratch.AddDefaulted_GetRef();
+				Input.Handle = Handle;
+				Input.Pos = Entity->Transform.GetLocation();
+				Input.BoundingRadius = FFixedPoint::Zero;
+				IndexedHandles.Add(Handle);
+			});
+	}
+	if (Hash.GetCellSize() != TargetIndexCellSize)
+	{
+		Hash.Initialize(TargetIndexCellSize, FFixedVector::ZeroVector);
+	}
+	Hash.BuildDynamic(BuildScratch);
+
+	VitalsStorage = Storage;
+	VitalsTopologyRevision = StorageTopology;
+	PoolTopologyRevision = Pool.GetTopologyRevision();
+	PoolMutationRevision = Pool.GetLatestMutationRevision();
+	bValid = true;
+}
+
+void FSeinTargetSpatialIndex::QueryCandidates(
+	const FFixedVector& Origin,
+	FFixedPoint Range,
+	TArray<FSeinEntityHandle>& Out,
+	FSeinEntityHandle Exclude) const
+{
+	if (Range <= FFixedPoint::Zero || IndexedHandles.Num() == 0)
+	{
+		return;
+	}
+
+	// A range spanning more cells than there are indexed entities would
+	// probe mostly empty runs; walking the slot-ordered list is cheaper and
+	// yields the identical (ascending-slot) candidate sequence.
+	const int64 CellSpan =
+		2 * static_cast<int64>((Range / TargetIndexCellSize).ToInt()) + 2;
+	if (CellSpan * CellSpan > IndexedHandles.Num())
+	{
+		Out.Reserve(Out.Num() + IndexedHandles.Num());
+		for (const FSeinEntityHandle& Handle : IndexedHandles)
+		{
+			if (Handle != Exclude)
+			{
+				Out.Add(Handle);
+			}
+		}
+		return;
+	}
+	Hash.QueryRadius(Origin, Range, Out, Exclude);
+}
@@ -0,0 +1,71 @@
+/**
+ * SeinARTS Framework - Copyright (c) 2026 Phenom Studios, Inc.
+ *
+ * @file         SeinTargetSpatialIndex.h
+ * @author       RJ Macklem
+ * @created      17 Oct 2026
+ * @latest       17 Oct 2026
+ * @brief        Derived point index over vitals-bearing entities — the
+ *               candidate broadphase for FSeinTargetQueryService.
+ *
+ *          Reuses FSeinCollisionSpatialHash's dynamic sort grid with a zero
+ *          bounding radius (each entity stamps only its centre cell), so a
+ *          query is a bucket fan-out over the range AABB that returns handles
+ *          in ascending slot order — the same canonical order the old
+ *          full-pool sweep visited. The query service still runs every exact
+ *          gate (alive, health, planar range, arc, tags) against live state;
+ *          the index only bounds WHICH entities are looked at.
+ *
+ *          Not canonical state: never serialized, never digested.
+ *          FSeinTargetIndexSystem refreshes it at the end of each PreTick;
+ *          the refresh rebuilds only when the entity pool's topology/mutation
+ *          revisions or the vitals storage's topology revision moved, and the
+ *          index is invalidated outright after an authoritative restore
+ *          (process-local revisions restart there). Queries only read it.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Collision/SeinCollisionSpatialHash.h"
+#include "Core/SeinEntityHandle.h"
+#include "Types/FixedPoint.h"
+#include "Types/Vector.h"
+
+class ISeinComponentStorage;
+class USeinWorldSubsystem;
+
+class FSeinTargetSpatialIndex
+{
+public:
+	/** Bring the index up to date with the world. Serial only — the rebuild
+	 *  writes shared scratch. Cheap no-op when no revision moved. */
+	void Refresh(const USeinWorldSubsystem& World);
+
+	/** Drop the revision key so the next Refresh rebuilds unconditionally. */
+	void Invalidate() { bValid = false; }
+
+	/** Append the indexed handles whose centre cell lies within the
+	 *  Origin ± Range AABB, ascending by slot, excluding `Exclude`. A
+	 *  superset of the planar-range hits; the caller runs the exact gate.
+	 *  Read-only — safe inside SeinParallelFor once Refresh has run. */
+	void QueryCandidates(
+		const FFixedVector& Origin,
+		FFixedPoint Range,
+		TArray<FSeinEntityHandle>& Out,
+		FSeinEntityHandle Exclude) const;
+
+	int32 NumIndexed() const { return IndexedHandles.Num(); }
+
+private:
+	FSeinCollisionSpatialHash Hash;
+	TArray<FSeinCollisionSpatialHash::FDynamicColliderInput> BuildScratch;
+	/** Indexed handles in ascending slot order (wide-range fallback). */
+	TArray<FSeinEntityHandle> IndexedHandles;
+
+	const ISeinComponentStorage* VitalsStorage = nullptr;
+	uint64 PoolTopologyRevision = 0;
+	uint64 PoolMutationRevision = 0;
+	uint64 VitalsTopologyRevision = 0;
+	bool bValid = false;
+};
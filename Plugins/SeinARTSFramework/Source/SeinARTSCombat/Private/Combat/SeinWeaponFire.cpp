@@ -6,25 +6,54 @@
  */
 
 #include "Combat/SeinWeaponFire.h"
+#include "Combat/SeinBallisticProjectilePool.h"
 #include "Combat/SeinCombatDamage.h"
 #include "Combat/SeinCombatMath.h"
+#include "Combat/SeinWeaponArchetype.h"
 #include "Components/SeinProjectileComponent.h"
 #include "Components/SeinVitalsComponent.h"
 #include "Components/SeinWeaponComponent.h"
 #include "Math/MathLib.h"
+#include "Engine/World.h"
 #include "Simulation/SeinWorldSubsystem.h"
+#include "System/SeinCombatSubsystem.h"
 #include "Types/Entity.h"
 
+DEFINE_LOG_CATEGORY_STATIC(LogSeinWeaponFire, Log, All);
+
 namespace
 {
-	bool IsSlotReady(const FSeinWeaponSlot& Slot)
+	bool IsSlotReady(const FSeinWeaponSlot& Slot, const FSeinWeaponProfile& Profile)
 	{
 		return Slot.CooldownRemaining <= FFixedPoint::Zero
 			&& Slot.ReloadRemaining <= FFixedPoint::Zero
-			&& (Slot.MagazineSize <= 0 || Slot.MagazineRemaining > 0);
+			&& (Profile.MagazineSize <= 0 || Slot.MagazineRemaining > 0);
+	}
+
+	/** The world's ballistic pool, or null when no combat subsystem hosts one
+	 *  (Ballistic slots then fall back to projectile entities). */
+	FSeinBallisticProjectilePool* FindBallisticPool(const USeinWorldSubsystem& World)
+	{
+		UWorld* GameWorld = World.GetWorld();
+		USeinCombatSubsystem* Combat = GameWorld
+			? GameWorld->GetSubsystem<USeinCombatSubsystem>()
+			: nullptr;
+		return Combat ? &Combat->GetBallisticProjectilesMutable() : nullptr;
 	}
 }
 
+const FSeinWeaponProfile* FSeinWeaponFire::ResolveProfile(
+	const USeinWorldSubsystem& World,
+	const FSeinWeaponSlot& Slot)
+{
+	UWorld* GameWorld = World.GetWorld();
+	const USeinCombatSubsystem* Combat = GameWorld
+		? GameWorld->GetSubsystem<USeinCombatSubsystem>()
+		: nullptr;
+	// Without a combat host nothing preloaded archetypes, so nothing fires.
+	return Combat ? Combat->ResolveWeaponProfile(Slot) : nullptr;
+}
+
 bool FSeinWeaponFire::IsWeaponReady(
 	const USeinWorldSubsystem& World,
 	FSeinEntityHandle Shooter,
@@ -32,9 +61,13 @@ bool FSeinWeaponFire::IsWeaponReady(
 {
 	const FSeinWeaponComponent* Weapons =
 		World.GetComponent<FSeinWeaponComponent>(Shooter);
-	return Weapons
-		&& Weapons->Weapons.IsValidIndex(WeaponIndex)
-		&& IsSlotReady(Weapons->Weapons[WeaponIndex]);
+	if (!Weapons || !Weapons->Weapons.IsValidIndex(WeaponIndex))
+	{
+		return false;
+	}
+	const FSeinWeaponSlot& Slot = Weapons->Weapons[WeaponIndex];
+	const FSeinWeaponProfile* Profile = ResolveProfile(World, Slot);
+	return Profile && IsSlotReady(Slot, *Profile);
 }
 
 ESeinWeaponFireResult FSeinWeaponFire::TryFireWeaponAt(
@@ -53,10 +86,16 @@ ESeinWeaponFireResult FSeinWeaponFire::TryFireWeaponAt(
 	{
 		return ESeinWeaponFireResult::InvalidWeaponIndex;
 	}
-	// Legality reads the authored slot by value — storage may reallocate
-	// when the projectile spawn below adds components.
+	// Legality reads the slot by value — storage may reallocate when the
+	// projectile spawn below adds components. The profile lives in the
+	// resident archetype, outside component storage, so a pointer is stable.
 	const FSeinWeaponSlot Slot = Weapons->Weapons[WeaponIndex];
-	if (!IsSlotReady(Slot))
+	const FSeinWeaponProfile* Profile = ResolveProfile(World, Slot);
+	if (!Profile)
+	{
+		return ESeinWeaponFireResult::ArchetypeNotResident;
+	}
+	if (!IsSlotReady(Slot, *Profile))
 	{
 		return ESeinWeaponFireResult::NotReady;
 	}
@@ -77,11 +116,11 @@ ESeinWeaponFireResult FSeinWeaponFire::TryFireWeaponAt(
 	const FFixedVector TargetLocation =
 		TargetEntity->Transform.GetLocation();
 	if (!FFixedVector::IsPlanarDistanceWithin(
-			ShooterLocation, TargetLocation, Slot.Range))
+			ShooterLocation, TargetLocation, Profile->Range))
 	{
 		return ESeinWeaponFireResult::OutOfRange;
 	}
-	if (Slot.ArcHalfAngleDegrees < FFixedPoint::FromInt(180))
+	if (Profile->ArcHalfAngleDegrees < FFixedPoint::FromInt(180))
 	{
 		FFixedVector PlanarForward =
 			ShooterEntity->Transform.GetRotation().GetForwardVector();
@@ -92,7 +131,7 @@ ESeinWeaponFireResult FSeinWeaponFire::TryFireWeaponAt(
 			SeinCombatInternal::PlanarDistanceSaturated(
 				TargetLocation, ShooterLocation);
 		const FFixedPoint CosHalfAngle = SeinMath::Cos(
-			Slot.ArcHalfAngleDegrees
+			Profile->ArcHalfAngleDegrees
 			* FFixedPoint::Pi / FFixedPoint::FromInt(180));
 		const FFixedPoint Dot =
 			PlanarForward.X * PlanarDelta.X
@@ -102,7 +141,7 @@ ESeinWeaponFireResult FSeinWeaponFire::TryFireWeaponAt(
 			return ESeinWeaponFireResult::OutsideArc;
 		}
 	}
-	if (Slot.bRequireLineOfSight
+	if (Profile->bRequireLineOfSight
 		&& World.LineOfSightResolver.IsBound()
 		&& !World.LineOfSightResolver.Execute(
 			World.GetEntityOwner(Shooter), TargetLocation))
@@ -111,18 +150,40 @@ ESeinWeaponFireResult FSeinWeaponFire::TryFireWeaponAt(
 	}
 
 	// ── Delivery ──
-	if (Slot.Delivery == ESeinWeaponDelivery::Instant)
+	FSeinBallisticProjectilePool* BallisticPool =
+		Profile->Delivery == ESeinWeaponDelivery::Ballistic
+			? FindBallisticPool(World)
+			: nullptr;
+	bool bDelivered = false;
+	if (Profile->Delivery == ESeinWeaponDelivery::Instant)
 	{
 		FSeinCombatDamage::ResolveImpact(
-			World, TargetLocation, Target, Shooter, Slot.Payload);
+			World, TargetLocation, Target, Shooter, Profile->Payload);
+		bDelivered = true;
+	}
+	else if (BallisticPool)
+	{
+		FSeinBallisticProjectileSpawn Round;
+		Round.Instigator = Shooter;
+		Round.Target = Target;
+		Round.Origin = ShooterLocation;
+		Round.TargetPoint = TargetLocation;
+		Round.Speed = Profile->ProjectileSpeed;
+		Round.Payload = Profile->Payload;
+		bDelivered = BallisticPool->Spawn(Round);
+		// A full pool must not swallow the round: it flies as an entity
+		// instead, which the pool state (canonical) decides for every peer.
+		UE_CLOG(!bDelivered, LogSeinWeaponFire, Warning,
+			TEXT("Ballistic pool full (%d rounds); entity %d fires a projectile entity instead."),
+			BallisticPool->Num(), Shooter.Index);
 	}
-	else
+	if (!bDelivered)
 	{
 		// Spawn the projectile entity at the shooter, facing the target.
 		FFixedTransform SpawnTransform(ShooterLocation);
-		UClass* ProjectileClass = Slot.ProjectileClass.IsNull()
+		UClass* ProjectileClass = Profile->ProjectileClass.IsNull()
 			? nullptr
-			: Slot.ProjectileClass.LoadSynchronous();
+			: SeinLoadSimulationClass(Profile->ProjectileClass);
 		const FSeinEntityHandle Projectile = ProjectileClass
 			? World.SpawnEntity(ProjectileClass, SpawnTransform,
 				World.GetEntityOwner(Shooter))
@@ -134,10 +195,10 @@ ESeinWeaponFireResult FSeinWeaponFire::TryFireWeaponAt(
 			Flight.Instigator = Shooter;
 			Flight.Target = Target;
 			Flight.LastKnownTargetPoint = TargetLocation;
-			Flight.Speed = Slot.ProjectileSpeed > FFixedPoint::Zero
-				? Slot.ProjectileSpeed
+			Flight.Speed = Profile->ProjectileSpeed > FFixedPoint::Zero
+				? Profile->ProjectileSpeed
 				: FFixedPoint::FromInt(2000);
-			Flight.Payload = Slot.Payload;
+			Flight.Payload = Profile->Payload;
 			World.AddComponent(Projectile, Flight);
 		}
 	}
@@ -150,13 +211,13 @@ ESeinWeaponFireResult FSeinWeaponFire::TryFireWeaponAt(
 	{
 		FSeinWeaponSlot& MutableSlot =
 			MutableWeapons->Weapons[WeaponIndex];
-		MutableSlot.CooldownRemaining = MutableSlot.CooldownSeconds;
-		if (MutableSlot.MagazineSize > 0)
+		MutableSlot.CooldownRemaining = Profile->CooldownSeconds;
+		if (Profile->MagazineSize > 0)
 		{
 			--MutableSlot.MagazineRemaining;
 			if (MutableSlot.MagazineRemaining <= 0)
 			{
-				MutableSlot.ReloadRemaining = MutableSlot.ReloadSeconds;
+				MutableSlot.ReloadRemaining = Profile->ReloadSeconds;
 			}
 		}
 	}
@@ -0,0 +1,86 @@
+/**
+ * SeinARTS Framework - Copyright (c) 2026 Phenom Studios, Inc.
+ *
+ * @file         SeinBallisticProjectileRenderComponent.cpp
+ * @author       RJ Macklem
+ * @created      17 Oct 2026
+ * @latest       17 Oct 2026
+ * @brief        Draws the combat subsystem's in-flight ballistic rounds as
+ *               instances each frame.
+ */
+
+#include "Components/ActorComponents/SeinBallisticProjectileRenderComponent.h"
+#include "Combat/SeinBallisticProjectilePool.h"
+#include "Engine/World.h"
+#include "Simulation/SeinWorldSubsystem.h"
+#include "System/SeinCombatSubsystem.h"
+
+USeinBallisticProjectileRenderComponent::USeinBallisticProjectileRenderComponent()
+{
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.TickGroup = TG_PostUpdateWork;
+	SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	SetCanEverAffectNavigation(false);
+	SetUsingAbsoluteLocation(true);
+	SetUsingAbsoluteRotation(true);
+	SetUsingAbsoluteScale(true);
+}
+
+void USeinBallisticProjectileRenderComponent::TickComponent(
+	float DeltaTime,
+	ELevelTick TickType,
+	FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	UWorld* World = GetWorld();
+	const USeinCombatSubsystem* Combat = World
+		? World->GetSubsystem<USeinCombatSubsystem>()
+		: nullptr;
+	const USeinWorldSubsystem* Sim = World
+		? World->GetSubsystem<USeinWorldSubsystem>()
+		: nullptr;
+	if (!Combat || !Sim)
+	{
+		if (GetInstanceCount() > 0)
+		{
+			ClearInstances();
+		}
+		return;
+	}
+
+	const FSeinBallisticProjectilePool& Pool = Combat->GetBallisticProjectiles();
+	const TConstArrayView<FFixedVector> Current = Pool.GetPositions();
+	const TConstArrayView<FFixedVector> Previous = Pool.GetPreviousPositions();
+	const float Alpha = Sim->GetInterpolationAlpha();
+
+	InstanceTransforms.Reset(Current.Num());
+	for (int32 Index = 0; Index < Current.Num(); ++Index)
+	{
+		const FVector From = Previous[Index].ToVector();
+		const FVector To = Current[Index].ToVector();
+		const FVector Heading = To - From;
+		const FQuat Rotation = Heading.IsNearlyZero()
+			? FQuat::Identity
+			: Heading.ToOrientationQuat();
+		InstanceTransforms.Emplace(Rotation, FMath::Lerp(From, To, Alpha), InstanceScale);
+	}
+
+	// Steady fire keeps the count stable tick to tick; only a change in the
+	// number of rounds pays for rebuilding the instance buffer.
+	if (InstanceTransforms.Num() == GetInstanceCount())
+	{
+		if (!InstanceTransforms.IsEmpty())
+		{
+			BatchUpdateInstancesTransforms(0, InstanceTransforms, true, true);
+		}
+	}
+	else
+	{
+		ClearInstances();
+		if (!InstanceTransforms.IsEmpty())
+		{
+			AddInstances(InstanceTransforms, false, true);
+		}
+	}
+}
@@ -0,0 +1,77 @@
+/**
+ * SeinARTS Framework - Copyright (c) 2026 Phenom Studios, Inc.
+ *
+ * @file         SeinWeaponComponent.cpp
+ * @author       RJ Macklem
+ * @created      17 Oct 2026
+ * @latest       17 Oct 2026
+ * @brief        Detects weapon slots saved with legacy inline profiles and
+ *               reports them on load.
+ */
+
+#include "Components/SeinWeaponComponent.h"
+
+#include "Serialization/Archive.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogSeinWeaponSlot, Log, All);
+
+#if WITH_EDITORONLY_DATA
+FSeinWeaponProfile FSeinWeaponSlot::GetLegacyProfile() const
+{
+	FSeinWeaponProfile Profile;
+	Profile.Range = Range_DEPRECATED;
+	Profile.ArcHalfAngleDegrees = ArcHalfAngleDegrees_DEPRECATED;
+	Profile.CooldownSeconds = CooldownSeconds_DEPRECATED;
+	Profile.MagazineSize = MagazineSize_DEPRECATED;
+	Profile.ReloadSeconds = ReloadSeconds_DEPRECATED;
+	Profile.bRequireLineOfSight = bRequireLineOfSight_DEPRECATED;
+	Profile.Delivery = Delivery_DEPRECATED;
+	Profile.ProjectileSpeed = ProjectileSpeed_DEPRECATED;
+	Profile.ProjectileClass = ProjectileClass_DEPRECATED;
+	Profile.Payload = Payload_DEPRECATED;
+	return Profile;
+}
+
+bool FSeinWeaponSlot::HasLegacyInlineProfile() const
+{
+	// Tagged serialization never wrote default-valued fields, so "differs
+	// from the default profile" is exactly "old data carried a value here".
+	const FSeinWeaponProfile Legacy = GetLegacyProfile();
+	const FSeinWeaponProfile Default;
+	return !FSeinWeaponProfile::StaticStruct()->CompareScriptStruct(
+		&Legacy, &Default, PPF_None);
+}
+#endif
+
+void FSeinWeaponSlot::PostSerialize(const FArchive& Ar)
+{
+#if WITH_EDITORONLY_DATA
+	if (!Ar.IsLoading() || !Ar.IsPersistent() || Ar.IsTransacting())
+	{
+		return;
+	}
+	if (!HasLegacyInlineProfile())
+	{
+		return;
+	}
+	if (!Archetype.IsNull())
+	{
+		// Already migrated; the inline values are stale and drop on next save.
+		return;
+	}
+
+	const FSeinWeaponProfile Legacy = GetLegacyProfile();
+	FString LegacyText;
+	FSeinWeaponProfile::StaticStruct()->ExportText(
+		LegacyText,
+		&Legacy,
+		nullptr,
+		nullptr,
+		PPF_None,
+		nullptr);
+	UE_LOG(LogSeinWeaponSlot, Error,
+		TEXT("%s: weapon slot was saved with inline authored fields and has no Archetype. Create a USeinWeaponArchetype with %s, assign it to the slot and resave; until then this slot never fires."),
+		Ar.GetArchiveName().IsEmpty() ? TEXT("<unknown>") : *Ar.GetArchiveName(),
+		*LegacyText);
+#endif
+}
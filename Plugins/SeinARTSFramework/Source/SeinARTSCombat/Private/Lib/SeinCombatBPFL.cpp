@@ -10,6 +10,7 @@
 #include "Engine/Engine.h"
 #include "Engine/World.h"
 #include "Simulation/SeinWorldSubsystem.h"
+#include "System/SeinCombatSubsystem.h"
 
 namespace
 {
@@ -61,3 +62,16 @@ bool USeinCombatBPFL::SeinIsWeaponReady(
 	return Sim
 		&& FSeinWeaponFire::IsWeaponReady(*Sim, EntityHandle, WeaponIndex);
 }
+
+int32 USeinCombatBPFL::SeinGetBallisticProjectileCount(
+	const UObject* WorldContextObject)
+{
+	const UWorld* World = GEngine
+		? GEngine->GetWorldFromContextObject(
+			WorldContextObject, EGetWorldErrorMode::ReturnNull)
+		: nullptr;
+	const USeinCombatSubsystem* Combat = World
+		? World->GetSubsystem<USeinCombatSubsystem>()
+		: nullptr;
+	return Combat ? Combat->GetBallisticProjectiles().Num() : 0;
+}
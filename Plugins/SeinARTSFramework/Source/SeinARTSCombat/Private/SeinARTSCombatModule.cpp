@@ -2,18 +2,95 @@
  * SeinARTS Framework - Copyright (c) 2026 Phenom Studios, Inc.
  * @file    SeinARTSCombatModule.cpp
  * @brief   Combat module lifecycle. Components, systems, and policy classes
- *          register through the ordinary reflection/subsystem paths; nothing
- *          here mutates global registries that would need paired teardown.
+ *          register through the ordinary reflection/subsystem paths; the
+ *          global registrations are the ballistic projectile pool's canonical-
+ *          state contributor and the weapon-archetype content contributor,
+ *          paired with teardown below.
  */
 
 #include "SeinARTSCombatModule.h"
+#include "Combat/SeinWeaponArchetype.h"
+#include "Serialization/SeinCombatCanonicalStateProvider.h"
+#include "Simulation/SeinWorldSubsystem.h"
+#include "UObject/UObjectIterator.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogSeinARTSCombatModule, Log, All);
+
+namespace
+{
+	FSeinSimulationContentDiscoveryRoot MakePackageDiscoveryRoot(
+		const UClass* RootClass)
+	{
+		check(RootClass);
+
+		FSeinSimulationContentDiscoveryRoot Root;
+		Root.RootClassPath = RootClass->GetPathName();
+		Root.StableRecordKindId =
+			FSeinSimulationContentManifestCodec::GetCurrentRecordKindId();
+		Root.RecordRevision =
+			FSeinSimulationContentManifestCodec::CurrentRecordRevision;
+		return Root;
+	}
+}
 
 void FSeinARTSCombatModule::StartupModule()
 {
+	SimulationContentRegistrationHandle.Reset();
+	CanonicalStateRegistrationHandle.Reset();
+
+	FString CanonicalStateError;
+	CanonicalStateRegistrationHandle =
+		SeinRegisterCombatCanonicalStateProvider(CanonicalStateError);
+	if (!CanonicalStateRegistrationHandle.IsValid())
+	{
+		UE_LOG(LogSeinARTSCombatModule, Error,
+			TEXT("Combat canonical-state provider failed to register: %s"),
+			*CanonicalStateError);
+	}
+
+	// Weapon slots hold only an archetype reference; the profile behind it is
+	// simulation input, so its package must be in every peer's manifest.
+	FSeinSimulationContentContributorDescriptor ContentDescriptor;
+	ContentDescriptor.StableContributorId = TEXT("seinarts.combat");
+	ContentDescriptor.ContributorRevision = 1;
+	ContentDescriptor.DiscoveryRoots = {
+		MakePackageDiscoveryRoot(USeinWeaponArchetype::StaticClass()),
+	};
+
+	FString ContentRegistrationError;
+	SimulationContentRegistrationHandle =
+		FSeinSimulationContentRegistry::RegisterContributor(
+			ContentDescriptor,
+			&ContentRegistrationError);
+	if (!SimulationContentRegistrationHandle.IsValid())
+	{
+		UE_LOG(LogSeinARTSCombatModule, Error,
+			TEXT("Simulation-content contributor '%s' failed to register: %s"),
+			*ContentDescriptor.StableContributorId,
+			*ContentRegistrationError);
+	}
+}
+
+void FSeinARTSCombatModule::PreUnloadCallback()
+{
+	check(IsInGameThread());
+	for (TObjectIterator<USeinWorldSubsystem> It; It; ++It)
+	{
+		if (!It->HasAnyFlags(RF_ClassDefaultObject))
+		{
+			It->TerminateAndReleaseForModuleUnload(
+				TEXT("SeinARTSCombat"),
+				TEXT("combat systems and the ballistic projectile pool are unloading"));
+		}
+	}
+	SimulationContentRegistrationHandle.Reset();
+	CanonicalStateRegistrationHandle.Reset();
 }
 
 void FSeinARTSCombatModule::ShutdownModule()
 {
+	SimulationContentRegistrationHandle.Reset();
+	CanonicalStateRegistrationHandle.Reset();
 }
 
 IMPLEMENT_MODULE(FSeinARTSCombatModule, SeinARTSCombat)
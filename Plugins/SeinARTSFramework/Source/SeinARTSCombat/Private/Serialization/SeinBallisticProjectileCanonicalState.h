@@ -0,0 +1,66 @@
+/**
+ * SeinARTS Framework - Copyright (c) 2026 Phenom Studios, Inc.
+ *
+ * @file         SeinBallisticProjectileCanonicalState.h
+ * @author       RJ Macklem
+ * @created      17 Oct 2026
+ * @latest       17 Oct 2026
+ * @brief        Exact authoritative state of the ballistic projectile pool.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Combat/SeinCombatTypes.h"
+#include "Core/SeinEntityHandle.h"
+#include "Types/FixedPoint.h"
+#include "Types/Vector.h"
+#include "SeinBallisticProjectileCanonicalState.generated.h"
+
+/** One in-flight round, in pool row order. */
+USTRUCT(meta = (SeinDeterministic))
+struct FSeinBallisticProjectileRecord
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	uint32 Id = 0;
+
+	UPROPERTY()
+	FSeinEntityHandle Instigator;
+
+	UPROPERTY()
+	FSeinEntityHandle Target;
+
+	UPROPERTY()
+	FFixedVector Position = FFixedVector::ZeroVector;
+
+	UPROPERTY()
+	FFixedVector Destination = FFixedVector::ZeroVector;
+
+	UPROPERTY()
+	FFixedPoint Speed;
+
+	UPROPERTY()
+	FFixedPoint LifetimeRemaining;
+
+	/** Index into FSeinBallisticProjectileCanonicalState::Payloads. */
+	UPROPERTY()
+	int32 PayloadIndex = 0;
+};
+
+/** Canonical state owned by USeinCombatSubsystem's ballistic pool. */
+USTRUCT(meta = (SeinDeterministic))
+struct FSeinBallisticProjectileCanonicalState
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	uint32 NextProjectileId = 1;
+
+	UPROPERTY()
+	TArray<FSeinDamagePayload> Payloads;
+
+	UPROPERTY()
+	TArray<FSeinBallisticProjectileRecord> Projectiles;
+};
@@ -0,0 +1,199 @@
+/**
+ * SeinARTS Framework - Copyright (c) 2026 Phenom Studios, Inc.
+ *
+ * @file         SeinCombatCanonicalStateProvider.cpp
+ * @author       RJ Macklem
+ * @created      17 Oct 2026
+ * @latest       17 Oct 2026
+ * @brief        Authoritative canonical-state contributor for the ballistic
+ *               projectile pool. Projectile-delivery rounds are entities and
+ *               ride the Core entity/component capture; Ballistic rounds exist
+ *               only in USeinCombatSubsystem's pool, so this contributor is
+ *               what makes them snapshot, restore and hash like everything
+ *               else. Claimed by the ballistic-flight system.
+ */
+
+#include "Serialization/SeinCombatCanonicalStateProvider.h"
+#include "Engine/World.h"
+
+#include "Combat/SeinBallisticProjectilePool.h"
+#include "Serialization/SeinBallisticProjectileCanonicalState.h"
+#include "Serialization/SeinCanonicalInitialStateDigest.h"
+#include "Simulation/SeinWorldSubsystem.h"
+#include "StructUtils/InstancedStruct.h"
+#include "System/SeinCombatSubsystem.h"
+
+namespace
+{
+	const FName OwnerModuleId(TEXT("SeinARTSCombat"));
+
+	/** Per-row upper bound used for the routine root's projected size. */
+	constexpr uint64 ProjectedRecordBytes =
+		sizeof(uint32) + 2 * sizeof(FSeinEntityHandle)
+		+ 2 * sizeof(FFixedVector) + 2 * sizeof(FFixedPoint) + sizeof(int32);
+
+	USeinCombatSubsystem* ResolveSubsystem(const USeinWorldSubsystem& World)
+	{
+		UWorld* UnrealWorld = World.GetWorld();
+		return UnrealWorld
+			? UnrealWorld->GetSubsystem<USeinCombatSubsystem>()
+			: nullptr;
+	}
+
+	struct FBallisticRestoreStage final
+		: ISeinCanonicalStateRestoreStage
+	{
+		FSeinBallisticProjectileCanonicalState State;
+		TWeakObjectPtr<USeinCombatSubsystem> Subsystem;
+
+		virtual bool VerifyExternalLeases(
+			FString& OutError) const override
+		{
+			if (!Subsystem.IsValid())
+			{
+				OutError =
+					TEXT("Combat subsystem was torn down before the ballistic projectile restore committed.");
+				return false;
+			}
+			return true;
+		}
+	};
+}
+
+struct FSeinCombatCanonicalStateProvider
+{
+	static bool Capture(
+		const FSeinCanonicalStateCaptureContext& Context,
+		FInstancedStruct& OutState,
+		FString& OutError)
+	{
+		OutState.Reset();
+		const USeinCombatSubsystem* Subsystem =
+			ResolveSubsystem(Context.World);
+		if (!Subsystem)
+		{
+			OutError =
+				TEXT("Ballistic projectile capture could not resolve the combat subsystem.");
+			return false;
+		}
+		FSeinBallisticProjectileCanonicalState State;
+		Subsystem->GetBallisticProjectiles().Capture(State);
+		OutState = FInstancedStruct::Make(MoveTemp(State));
+		return true;
+	}
+
+	static bool CaptureRoutineRoot(
+		const FSeinCanonicalStateCaptureContext& Context,
+		bool /*bForceFullRebuild*/,
+		FSeinCanonicalStateRoutineRootRecord& OutRecord,
+		FString& OutError)
+	{
+		OutRecord = {};
+		const USeinCombatSubsystem* Subsystem =
+			ResolveSubsystem(Context.World);
+		if (!Subsystem)
+		{
+			OutError =
+				TEXT("Ballistic projectile routine root could not resolve the combat subsystem.");
+			return false;
+		}
+
+		// Every in-flight row moves every tick, so there is no unchanged
+		// subset worth caching; one linear pass over the columns is the
+		// O(changes) projection.
+		const FSeinBallisticProjectilePool& Pool =
+			Subsystem->GetBallisticProjectiles();
+		FSeinCanonicalDigestWriter Writer(
+			TEXT("SeinARTS.Combat.Ballistic.RoutineRoot"), 1);
+		if (!Pool.WriteDigest(Writer))
+		{
+			OutError = Writer.GetError();
+			return false;
+		}
+		if (!Writer.Finalize(OutRecord.LeafDigest, OutError))
+		{
+			return false;
+		}
+		OutRecord.MutationRevision = Pool.GetMutationRevision();
+		OutRecord.ProjectedPayloadBytes =
+			static_cast<uint64>(Pool.Num()) * ProjectedRecordBytes;
+		return true;
+	}
+
+	static bool StageRestore(
+		const FSeinCanonicalStateStageContext& Context,
+		const FInstancedStruct& State,
+		TUniquePtr<ISeinCanonicalStateRestoreStage>& OutStage,
+		FString& OutError)
+	{
+		OutStage.Reset();
+		const FSeinBallisticProjectileCanonicalState* Payload =
+			State.GetPtr<FSeinBallisticProjectileCanonicalState>();
+		if (!Payload || !Context.Services)
+		{
+			OutError =
+				TEXT("Ballistic projectile restore received a malformed payload or no world services.");
+			return false;
+		}
+		if (!FSeinBallisticProjectilePool::Validate(*Payload, OutError))
+		{
+			return false;
+		}
+		USeinCombatSubsystem* Subsystem =
+			ResolveSubsystem(*Context.Services);
+		if (!Subsystem)
+		{
+			OutError =
+				TEXT("Ballistic projectile restore could not resolve the combat subsystem.");
+			return false;
+		}
+
+		TUniquePtr<FBallisticRestoreStage> Stage =
+			MakeUnique<FBallisticRestoreStage>();
+		Stage->State = *Payload;
+		Stage->Subsystem = Subsystem;
+		OutStage = MoveTemp(Stage);
+		return true;
+	}
+
+	static void CommitRestore(
+		FSeinCanonicalStateCommitContext& Context,
+		TUniquePtr<ISeinCanonicalStateRestoreStage>&& OpaqueStage)
+	{
+		FBallisticRestoreStage* Stage =
+			static_cast<FBallisticRestoreStage*>(OpaqueStage.Get());
+		check(Stage);
+		USeinCombatSubsystem* Subsystem = Stage->Subsystem.Get();
+		check(Subsystem && Subsystem == ResolveSubsystem(Context.World));
+		Subsystem->GetBallisticProjectilesMutable().Restore(Stage->State);
+	}
+};
+
+FSeinCanonicalStateRegistrationHandle
+SeinRegisterCombatCanonicalStateProvider(FString& OutError)
+{
+	FSeinCanonicalStateDescriptor Descriptor;
+	Descriptor.Key.StableDomainId = TEXT("seinarts.combat");
+	Descriptor.Key.StableContributorId = TEXT("ballistic-projectiles");
+	Descriptor.SchemaVersion = 1;
+	Descriptor.ImplementationRevision = 2;
+	Descriptor.Role = ESeinCanonicalStateRole::Authoritative;
+	Descriptor.PayloadStruct =
+		FSeinBallisticProjectileCanonicalState::StaticStruct();
+	Descriptor.Limits.MaxRecursionDepth = 16;
+	Descriptor.Limits.MaxEncodedBytes = 16 * 1024 * 1024;
+	Descriptor.Limits.MaxAggregateElements = 1024 * 1024;
+
+	FSeinCanonicalStateContributorOps Ops;
+	Ops.Capture = &FSeinCombatCanonicalStateProvider::Capture;
+	Ops.CaptureRoutineRoot =
+		&FSeinCombatCanonicalStateProvider::CaptureRoutineRoot;
+	Ops.StageRestore = &FSeinCombatCanonicalStateProvider::StageRestore;
+	Ops.CommitRestore = &FSeinCombatCanonicalStateProvider::CommitRestore;
+
+	return FSeinCanonicalStateRegistry::Register(
+		OwnerModuleId,
+		Descriptor,
+		MoveTemp(Ops),
+		&OutError);
+}
@@ -0,0 +1,16 @@
+/**
+ * SeinARTS Framework - Copyright (c) 2026 Phenom Studios, Inc.
+ *
+ * @file         SeinCombatCanonicalStateProvider.h
+ * @author       RJ Macklem
+ * @created      17 Oct 2026
+ * @latest       17 Oct 2026
+ * @brief        Module-owned registration for the ballistic projectile pool.
+ */
+
+#pragma once
+
+#include "Serialization/SeinCanonicalStateRegistry.h"
+
+FSeinCanonicalStateRegistrationHandle
+SeinRegisterCombatCanonicalStateProvider(FString& OutError);
@@ -0,0 +1,77 @@
+/**
+ * SeinARTS Framework - Copyright (c) 2026 Phenom Studios, Inc.
+ *
+ * @file         SeinBallisticProjectileSystem.h
+ * @author       RJ Macklem
+ * @created      17 Oct 2026
+ * @latest       17 Oct 2026
+ * @brief        Ballistic-delivery flight: parallel step of the combat module's
+ *               projectile pool, then serial impact resolution in row order.
+ *               Runs right after entity projectile flight so both delivery
+ *               modes see the same settled target positions.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Combat/SeinBallisticProjectilePool.h"
+#include "Combat/SeinCombatDamage.h"
+#include "Core/SeinSystemPriority.h"
+#include "Core/SeinTickPhase.h"
+#include "Simulation/SeinWorldSubsystem.h"
+
+/**
+ * System: Ballistic Flight
+ * Phase: AbilityExecution | Priority: 21 (after ProjectileFlight)
+ */
+class FSeinBallisticProjectileSystem final : public ISeinSystem
+{
+public:
+	explicit FSeinBallisticProjectileSystem(FSeinBallisticProjectilePool& InPool)
+		: Pool(InPool)
+	{
+	}
+
+	virtual void Tick(FFixedPoint DeltaTime, USeinWorldSubsystem& World) override
+	{
+		if (Pool.IsEmpty())
+		{
+			return;
+		}
+
+		// Parallel compute: every row flies against the pre-step entity pool.
+		const int32 Stepped = Pool.Num();
+		Pool.Step(DeltaTime, World);
+
+		// Serial apply: impacts in row (spawn) order. Resolution may kill
+		// entities or fire further ballistic rounds; appended rows have not
+		// flown yet and are left InFlight. Copy what the impact needs first.
+		for (int32 Index = 0; Index < Stepped; ++Index)
+		{
+			if (Pool.GetOutcome(Index) != ESeinBallisticProjectileOutcome::Arrived)
+			{
+				continue;
+			}
+			const FSeinEntityHandle Target = Pool.GetTarget(Index);
+			const FSeinEntityHandle Instigator = Pool.GetInstigator(Index);
+			const FFixedVector Destination = Pool.GetDestination(Index);
+			const FSeinDamagePayload Payload = Pool.GetPayload(Index);
+			FSeinCombatDamage::ResolveImpact(
+				World, Destination, Target, Instigator, Payload);
+		}
+		Pool.RemoveFinished();
+	}
+
+	virtual FSeinSystemDescriptor DescribeSystem() const override
+	{
+		return FSeinSystemDescriptor::WithCanonicalState(
+			FName(TEXT("seinarts.combat.ballistic_flight")),
+			1u,
+			ESeinTickPhase::AbilityExecution,
+			SeinSystemPriority::BallisticFlight,
+			{FName(TEXT("seinarts.combat/ballistic-projectiles"))});
+	}
+
+private:
+	FSeinBallisticProjectilePool& Pool;
+};
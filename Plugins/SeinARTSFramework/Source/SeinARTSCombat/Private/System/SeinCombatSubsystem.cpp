@@ -1,17 +1,192 @@
 /**
  * SeinARTS Framework - Copyright (c) 2026 Phenom Studios, Inc.
  * @file    SeinCombatSubsystem.cpp
- * @brief   Hosts the weapon-cycle and projectile-flight systems.
+ * @brief   Hosts the weapon-cycle, vitals-reap, target-index,
+ *          projectile-flight and ballistic-flight systems, the acquisition
+ *          index, the ballistic pool and the weapon-archetype table.
  */
 
 #include "System/SeinCombatSubsystem.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Combat/SeinWeaponArchetype.h"
+#include "Components/SeinWeaponComponent.h"
+#include "Serialization/SeinSimulationContentManifest.h"
+#include "System/SeinBallisticProjectileSystem.h"
 #include "System/SeinProjectileSystem.h"
+#include "System/SeinTargetIndexSystem.h"
+#include "System/SeinVitalsReapSystem.h"
 #include "System/SeinWeaponCycleSystem.h"
+#include "Simulation/ComponentStorage.h"
+#include "Simulation/SeinWorldSubsystem.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogSeinCombatSubsystem, Log, All);
+
+void USeinCombatSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+	if (UWorld* World = GetWorld())
+	{
+		if (USeinWorldSubsystem* Sim = World->GetSubsystem<USeinWorldSubsystem>())
+		{
+			Sim->OnMatchBootstrapClosed.AddUObject(
+				this,
+				&USeinCombatSubsystem::HandleMatchBootstrapClosed);
+			Sim->OnAuthoritativeStateRestored.AddUObject(
+				this,
+				&USeinCombatSubsystem::HandleAuthoritativeStateRestored);
+		}
+	}
+}
+
+void USeinCombatSubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		if (USeinWorldSubsystem* Sim = World->GetSubsystem<USeinWorldSubsystem>())
+		{
+			Sim->OnMatchBootstrapClosed.RemoveAll(this);
+			Sim->OnAuthoritativeStateRestored.RemoveAll(this);
+		}
+	}
+	BallisticProjectiles.Reset();
+	ResidentWeaponArchetypes.Reset();
+	Super::Deinitialize();
+}
+
+const FSeinWeaponProfile* USeinCombatSubsystem::ResolveWeaponProfile(
+	const FSeinWeaponSlot& Slot) const
+{
+	const FSoftObjectPath& Path = Slot.Archetype.ToSoftObjectPath();
+	if (Path.IsNull())
+	{
+		return nullptr;
+	}
+	const TObjectPtr<USeinWeaponArchetype>* Resident =
+		ResidentWeaponArchetypes.Find(Path);
+	return Resident && *Resident ? &(*Resident)->Profile : nullptr;
+}
+
+void USeinCombatSubsystem::PreloadWeaponArchetypes(
+	const USeinWorldSubsystem& Sim)
+{
+	check(IsInGameThread());
+
+	TSet<FSoftObjectPath> Paths;
+
+	// Every archetype package the session's content contract pins, so a unit
+	// spawned mid-match never needs a load the sim tick cannot perform.
+	TSet<FName> ManifestPackages;
+	for (const FSeinSimulationContentRecord& Record :
+		Sim.GetSimulationContentProfile().Records)
+	{
+		if (Record.StableRecordKindId
+			== FSeinSimulationContentManifestCodec::GetCurrentRecordKindId())
+		{
+			ManifestPackages.Add(FName(*Record.CanonicalRecordId));
+		}
+	}
+	if (!ManifestPackages.IsEmpty())
+	{
+		IAssetRegistry& AR = FModuleManager::LoadModuleChecked<
+			FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+		TArray<FAssetData> Assets;
+		AR.GetAssetsByClass(
+			USeinWeaponArchetype::StaticClass()->GetClassPathName(),
+			Assets,
+			/*bSearchSubClasses=*/ true);
+		for (const FAssetData& Asset : Assets)
+		{
+			if (ManifestPackages.Contains(Asset.PackageName))
+			{
+				Paths.Add(Asset.GetSoftObjectPath());
+			}
+		}
+	}
+
+	// Plus whatever materialized or restored slots name directly.
+	if (const ISeinComponentStorage* Storage =
+		Sim.GetComponentStorageRaw(FSeinWeaponComponent::StaticStruct()))
+	{
+		Storage->ForEachLiveComponent(
+			[&Paths](FSeinEntityHandle, const void* Raw)
+			{
+				for (const FSeinWeaponSlot& Slot :
+					static_cast<const FSeinWeaponComponent*>(Raw)->Weapons)
+				{
+					if (!Slot.Archetype.IsNull())
+					{
+						Paths.Add(Slot.Archetype.ToSoftObjectPath());
+					}
+				}
+			});
+	}
+
+	for (const FSoftObjectPath& Path : Paths)
+	{
+		if (ResidentWeaponArchetypes.Contains(Path))
+		{
+			continue;
+		}
+		USeinWeaponArchetype* Archetype =
+			TSoftObjectPtr<USeinWeaponArchetype>(Path).LoadSynchronous();
+		if (!Archetype)
+		{
+			UE_LOG(LogSeinCombatSubsystem, Error,
+				TEXT("Weapon archetype %s did not load; slots referencing it will not fire."),
+				*Path.ToString());
+			continue;
+		}
+		ResidentWeaponArchetypes.Add(Path, Archetype);
+	}
+}
 
 void USeinCombatSubsystem::CreateSystems(
 	USeinWorldSubsystem& /*Sim*/,
 	TArray<TUniquePtr<ISeinSystem>>& OutSystems)
 {
-	OutSystems.Add(MakeUnique<FSeinWeaponCycleSystem>());
+	TUniquePtr<FSeinWeaponCycleSystem> WeaponCycle =
+		MakeUnique<FSeinWeaponCycleSystem>();
+	FSeinWeaponCycleSystem& WeaponCycleRef = *WeaponCycle;
+	OutSystems.Add(MoveTemp(WeaponCycle));
+	OutSystems.Add(MakeUnique<FSeinVitalsReapSystem>(WeaponCycleRef));
+	OutSystems.Add(MakeUnique<FSeinTargetIndexSystem>(TargetIndex));
 	OutSystems.Add(MakeUnique<FSeinProjectileSystem>());
+	OutSystems.Add(MakeUnique<FSeinBallisticProjectileSystem>(BallisticProjectiles));
+}
+
+void USeinCombatSubsystem::HandleMatchBootstrapClosed(bool bAuthorized)
+{
+	if (!bAuthorized)
+	{
+		return;
+	}
+	if (const UWorld* World = GetWorld())
+	{
+		if (const USeinWorldSubsystem* Sim =
+			World->GetSubsystem<USeinWorldSubsystem>())
+		{
+			PreloadWeaponArchetypes(*Sim);
+			// Queries issued before the first tick read the authored world.
+			TargetIndex.Refresh(*Sim);
+		}
+	}
+}
+
+void USeinCombatSubsystem::HandleAuthoritativeStateRestored()
+{
+	// Pool/storage revisions are process-local and restart with the restored
+	// state, so equal numbers no longer prove an unchanged world.
+	TargetIndex.Invalidate();
+	// A restored world may name archetypes the bootstrap never saw, and
+	// queries before the next tick must see the restored positions.
+	if (const UWorld* World = GetWorld())
+	{
+		if (const USeinWorldSubsystem* Sim =
+			World->GetSubsystem<USeinWorldSubsystem>())
+		{
+			PreloadWeaponArchetypes(*Sim);
+			TargetIndex.Refresh(*Sim);
+		}
+	}
 }
@@ -2,25 +2,77 @@
  * SeinARTS Framework - Copyright (c) 2026 Phenom Studios, Inc.
  * @file    SeinCombatSubsystem.h
  * @brief   World subsystem hosting the combat clockwork systems on the sim
- *          loop via the managed USeinSystemHostSubsystem base.
+ *          loop via the managed USeinSystemHostSubsystem base, plus the
+ *          derived acquisition index the target query service draws from and
+ *          the authoritative ballistic projectile pool, and the resident
+ *          weapon-archetype table weapon slots resolve their profiles from.
  */
 
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Combat/SeinBallisticProjectilePool.h"
+#include "Combat/SeinTargetSpatialIndex.h"
 #include "Simulation/SeinSystemHostSubsystem.h"
+#include "UObject/SoftObjectPath.h"
 #include "SeinCombatSubsystem.generated.h"
 
 class ISeinSystem;
+class USeinWeaponArchetype;
 class USeinWorldSubsystem;
+struct FSeinWeaponProfile;
+struct FSeinWeaponSlot;
 
 UCLASS()
 class SEINARTSCOMBAT_API USeinCombatSubsystem : public USeinSystemHostSubsystem
 {
 	GENERATED_BODY()
 
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/** The vitals-bearing candidate index. FSeinTargetIndexSystem refreshes
+	 *  it once per tick at the end of PreTick (and the bootstrap and restore
+	 *  handlers do so off-tick); readers never rebuild it, so parallel sim
+	 *  work may query it. */
+	const FSeinTargetSpatialIndex& GetTargetIndex() const { return TargetIndex; }
+
+	/** In-flight Ballistic-delivery rounds (presentation reads positions). */
+	const FSeinBallisticProjectilePool& GetBallisticProjectiles() const
+	{
+		return BallisticProjectiles;
+	}
+
+	/** Serial sim spine only: weapon fire and canonical-state restore. */
+	FSeinBallisticProjectilePool& GetBallisticProjectilesMutable()
+	{
+		return BallisticProjectiles;
+	}
+
+	/** The profile `Slot` references, or null when the slot has no archetype
+	 *  or its archetype was not made resident before the match started.
+	 *  Read-only — never loads — so parallel sim work may call it. */
+	const FSeinWeaponProfile* ResolveWeaponProfile(const FSeinWeaponSlot& Slot) const;
+
+	/** Load every weapon archetype the match can reference: each one in a
+	 *  simulation-content manifest package, plus each one a live slot names.
+	 *  Game thread only; runs when bootstrap authorizes and after restores. */
+	void PreloadWeaponArchetypes(const USeinWorldSubsystem& Sim);
+
 protected:
 	virtual void CreateSystems(
 		USeinWorldSubsystem& Sim,
 		TArray<TUniquePtr<ISeinSystem>>& OutSystems) override;
+
+private:
+	void HandleMatchBootstrapClosed(bool bAuthorized);
+	void HandleAuthoritativeStateRestored();
+
+	FSeinTargetSpatialIndex TargetIndex;
+	FSeinBallisticProjectilePool BallisticProjectiles;
+
+	/** Filled on the game thread before the first tick; the sim only reads it. */
+	UPROPERTY(Transient)
+	TMap<FSoftObjectPath, TObjectPtr<USeinWeaponArchetype>> ResidentWeaponArchetypes;
 };
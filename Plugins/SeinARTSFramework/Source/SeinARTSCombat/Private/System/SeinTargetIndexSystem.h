@@ -0,0 +1,54 @@
+/**
+ * SeinARTS Framework - Copyright (c) 2026 Phenom Studios, Inc.
+ *
+ * @file         SeinTargetIndexSystem.h
+ * @author       RJ Macklem
+ * @created      17 Oct 2026
+ * @latest       17 Oct 2026
+ * @brief        Brings the combat subsystem's acquisition index up to date
+ *               once per tick, at the end of PreTick, so every target query
+ *               that tick only reads it.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Combat/SeinTargetSpatialIndex.h"
+#include "Core/SeinSystemPriority.h"
+#include "Core/SeinTickPhase.h"
+#include "Simulation/SeinWorldSubsystem.h"
+
+/**
+ * System: Target Index
+ * Phase: PreTick | Priority: 13 (after VitalsReap)
+ *
+ * Left undeclared on purpose: Refresh is a serial-spine seam (the rebuild
+ * writes shared scratch), so this system runs as a barrier. Ticking after the
+ * reap keeps this tick's deaths out; entities spawned or moved later in the
+ * tick are indexed at the next PreTick.
+ */
+class FSeinTargetIndexSystem final : public ISeinSystem
+{
+public:
+	explicit FSeinTargetIndexSystem(FSeinTargetSpatialIndex& InIndex)
+		: Index(InIndex)
+	{
+	}
+
+	virtual void Tick(FFixedPoint /*DeltaTime*/, USeinWorldSubsystem& World) override
+	{
+		Index.Refresh(World);
+	}
+
+	virtual FSeinSystemDescriptor DescribeSystem() const override
+	{
+		return FSeinSystemDescriptor::Stateless(
+			FName(TEXT("seinarts.combat.target_index")),
+			1u,
+			ESeinTickPhase::PreTick,
+			SeinSystemPriority::TargetIndex);
+	}
+
+private:
+	FSeinTargetSpatialIndex& Index;
+};
@@ -0,0 +1,62 @@
+/**
+ * SeinARTS Framework - Copyright (c) 2026 Phenom Studios, Inc.
+ *
+ * @file         SeinVitalsReapSystem.h
+ * @author       RJ Macklem
+ * @created      17 Oct 2026
+ * @latest       17 Oct 2026
+ * @brief        Serial half of the weapon cycle: turns the zero-health
+ *               entities it found into deaths (visual event + deferred
+ *               destroy).
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/SeinSystemPriority.h"
+#include "Core/SeinTickPhase.h"
+#include "Events/SeinVisualEvent.h"
+#include "Simulation/SeinWorldSubsystem.h"
+#include "System/SeinWeaponCycleSystem.h"
+
+/**
+ * System: Vitals Reap
+ * Phase: PreTick | Priority: 12 (right after WeaponCycle)
+ *
+ * Left undeclared on purpose: EnqueueVisualEvent and DestroyEntity are
+ * serial-spine seams, so this system runs as a barrier after the wave that
+ * ticked the weapon cycle. Handles come in the cycle's storage order, which
+ * is the order the combined system used to kill them in.
+ */
+class FSeinVitalsReapSystem final : public ISeinSystem
+{
+public:
+	explicit FSeinVitalsReapSystem(FSeinWeaponCycleSystem& InWeaponCycle)
+		: WeaponCycle(InWeaponCycle)
+	{
+	}
+
+	virtual void Tick(FFixedPoint /*DeltaTime*/, USeinWorldSubsystem& World) override
+	{
+		TArray<FSeinEntityHandle>& Depleted = WeaponCycle.GetDepletedVitals();
+		for (const FSeinEntityHandle& Handle : Depleted)
+		{
+			World.EnqueueVisualEvent(FSeinVisualEvent::MakeDeathEvent(
+				Handle, FSeinEntityHandle()));
+			World.DestroyEntity(Handle);
+		}
+		Depleted.Reset();
+	}
+
+	virtual FSeinSystemDescriptor DescribeSystem() const override
+	{
+		return FSeinSystemDescriptor::Stateless(
+			FName(TEXT("seinarts.combat.vitals_reap")),
+			1u,
+			ESeinTickPhase::PreTick,
+			SeinSystemPriority::VitalsReap);
+	}
+
+private:
+	FSeinWeaponCycleSystem& WeaponCycle;
+};
@@ -3,17 +3,21 @@
  * @file    SeinWeaponCycleSystem.h
  * @brief   PreTick clockwork: weapon cooldown/reload timers, magazine
  *          seeding/refill, and vitals regeneration. Pure mechanism — never
- *          decides to fire, never picks targets.
+ *          decides to fire, never picks targets. Zero-health deaths are
+ *          handed to FSeinVitalsReapSystem, which ticks right after on the
+ *          serial spine, so this system writes only its two component types
+ *          and can share a tick wave.
  */
 
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Combat/SeinWeaponArchetype.h"
+#include "Combat/SeinWeaponFire.h"
 #include "Components/SeinVitalsComponent.h"
 #include "Components/SeinWeaponComponent.h"
 #include "Core/SeinSystemPriority.h"
 #include "Core/SeinTickPhase.h"
-#include "Events/SeinVisualEvent.h"
 #include "Simulation/ComponentStorage.h"
 #include "Simulation/SeinWorldSubsystem.h"
 
@@ -26,6 +30,8 @@ class FSeinWeaponCycleSystem final : public ISeinSystem
 public:
 	virtual void Tick(FFixedPoint DeltaTime, USeinWorldSubsystem& World) override
 	{
+		DepletedVitals.Reset();
+
 		// Gather-then-mutate, and gather ONLY handles that will actually
 		// change: a mutable fetch touches the slot's mutation revision, so an
 		// unconditional per-entity fetch would mark every armed/vitals entity
@@ -66,7 +72,9 @@ public:
 			{
 				for (FSeinWeaponSlot& Slot : Weapons->Weapons)
 				{
-					Slot.MagazineRemaining = Slot.MagazineSize;
+					const FSeinWeaponProfile* Profile =
+						FSeinWeaponFire::ResolveProfile(World, Slot);
+					Slot.MagazineRemaining = Profile ? Profile->MagazineSize : 0;
 				}
 				Weapons->bRuntimeSeeded = true;
 			}
@@ -87,7 +95,10 @@ public:
 					if (Slot.ReloadRemaining <= FFixedPoint::Zero)
 					{
 						Slot.ReloadRemaining = FFixedPoint::Zero;
-						Slot.MagazineRemaining = Slot.MagazineSize;
+						const FSeinWeaponProfile* Profile =
+							FSeinWeaponFire::ResolveProfile(World, Slot);
+						Slot.MagazineRemaining =
+							Profile ? Profile->MagazineSize : 0;
 					}
 				}
 			}
@@ -137,12 +148,10 @@ public:
 			// whole-struct write that zeroed health (bypassing the damage
 			// path) still gets a real death, never a silent re-seed revive.
 			// This also retires misauthored MaxHealth <= 0 entities instead
-			// of re-gathering them forever.
+			// of re-gathering them forever. The reap system performs it.
 			if (Vitals->Health <= FFixedPoint::Zero)
 			{
-				World.EnqueueVisualEvent(FSeinVisualEvent::MakeDeathEvent(
-					Handle, FSeinEntityHandle()));
-				World.DestroyEntity(Handle);
+				DepletedVitals.Add(Handle);
 				continue;
 			}
 			if (Vitals->RegenPerSecond > FFixedPoint::Zero
@@ -162,8 +171,19 @@ public:
 	{
 		return FSeinSystemDescriptor::Stateless(
 			FName(TEXT("seinarts.combat.weapon_cycle")),
-			1u,
+			2u,
 			ESeinTickPhase::PreTick,
-			SeinSystemPriority::WeaponCycle);
+			SeinSystemPriority::WeaponCycle)
+			.WithAccess(FSeinSystemAccess::Declared()
+				.WritesComponent(FSeinWeaponComponent::StaticStruct())
+				.WritesComponent(FSeinVitalsComponent::StaticStruct())
+				.ReadsShared(ESeinSystemSharedState::EntityTransforms));
 	}
+
+	/** Seeded entities found at zero health this tick, in storage order.
+	 *  Filled by Tick and drained by FSeinVitalsReapSystem the same tick. */
+	TArray<FSeinEntityHandle>& GetDepletedVitals() { return DepletedVitals; }
+
+private:
+	TArray<FSeinEntityHandle> DepletedVitals;
 };
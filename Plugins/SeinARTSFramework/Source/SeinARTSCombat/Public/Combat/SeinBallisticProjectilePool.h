@@ -0,0 +1,168 @@
+/**
+ * SeinARTS Framework - Copyright (c) 2026 Phenom Studios, Inc.
+ *
+ * @file         SeinBallisticProjectilePool.h
+ * @author       RJ Macklem
+ * @created      17 Oct 2026
+ * @latest       17 Oct 2026
+ * @brief        Deterministic structure-of-arrays pool for Ballistic-delivery
+ *               rounds — the lightweight alternative to projectile entities.
+ *
+ *          A Projectile-delivery round is a full pooled entity: a slot, a
+ *          component, a snapshot record and (when authored) an actor. That is
+ *          the right price for a shell that can be shot down and the wrong one
+ *          for a machine gun that fires forty rounds a second. Ballistic rounds
+ *          live here instead, as one row across parallel columns, with no
+ *          entity, no component storage and no actor.
+ *
+ *          FLIGHT matches FSeinProjectileSystem exactly — home on the live
+ *          target, otherwise fly to its last known point; arrive when within
+ *          one tick's travel; expire without impact when the lifetime runs
+ *          out — but is split into parallel compute and serial apply. Step()
+ *          advances every row in a SeinParallelFor whose bodies read only the
+ *          entity pool and write only their own row; the owning system then
+ *          resolves arrivals serially in row order and compacts.
+ *
+ *          ORDER. Rows are kept in spawn order (stable compaction), and every
+ *          round carries a monotonic id, so impact order — and therefore damage
+ *          order — is canonical.
+ *
+ *          PAYLOADS are interned into reference-counted slots. A slot is freed
+ *          when its last round lands and reused lowest-index first, so a long
+ *          match of varied payloads never exhausts the table.
+ *
+ *          CANONICAL STATE is the row set plus the interned payload table and
+ *          the next id, captured by the combat module's Authoritative
+ *          "seinarts.combat/ballistic-projectiles" contributor. The previous-
+ *          position column exists for presentation interpolation only and is
+ *          never captured or digested.
+ *
+ *          Pure C++; a member of USeinCombatSubsystem.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Combat/SeinCombatTypes.h"
+#include "Core/SeinEntityHandle.h"
+#include "Types/FixedPoint.h"
+#include "Types/Vector.h"
+
+class FSeinCanonicalDigestWriter;
+class USeinWorldSubsystem;
+struct FSeinBallisticProjectileCanonicalState;
+
+/** One round entering the pool. */
+struct FSeinBallisticProjectileSpawn
+{
+	/** Entity credited with the eventual damage. */
+	FSeinEntityHandle Instigator;
+	/** Homing target; an invalid handle flies straight to TargetPoint. */
+	FSeinEntityHandle Target;
+	FFixedVector Origin = FFixedVector::ZeroVector;
+	FFixedVector TargetPoint = FFixedVector::ZeroVector;
+	/** Flight speed (world units / second). Non-positive uses the default. */
+	FFixedPoint Speed = FFixedPoint::Zero;
+	FSeinDamagePayload Payload;
+};
+
+/** Per-row result of the most recent Step. */
+enum class ESeinBallisticProjectileOutcome : uint8
+{
+	InFlight,
+	/** Reached its destination; the owning system resolves the impact. */
+	Arrived,
+	/** Lifetime ran out first; removed without an impact. */
+	Expired,
+};
+
+class SEINARTSCOMBAT_API FSeinBallisticProjectilePool
+{
+public:
+	/** Hard row bound; Spawn refuses beyond it rather than growing unbounded. */
+	static constexpr int32 MaxProjectiles = 64 * 1024;
+	/** Distinct payloads in flight at once (payloads are interned). */
+	static constexpr int32 MaxPayloads = 4 * 1024;
+	/** Flight speed when the spawn names none, matching projectile entities. */
+	static constexpr int32 DefaultSpeed = 2000;
+	/** Lifetime fail-safe in seconds, matching projectile entities. */
+	static constexpr int32 DefaultLifetimeSeconds = 10;
+
+	/** Append one round. False when the pool (or payload table) is full. */
+	bool Spawn(const FSeinBallisticProjectileSpawn& Spawn);
+
+	/**
+	 * Advance every row by DeltaTime and record its outcome. Parallel-safe
+	 * by construction: bodies read World's entity pool and write only their
+	 * own row. Homing therefore sees target positions as of the start of the
+	 * step. Arrived rows are left at their destination for the caller.
+	 */
+	void Step(FFixedPoint DeltaTime, const USeinWorldSubsystem& World);
+
+	/** Drop every Arrived/Expired row, preserving the order of the rest. */
+	void RemoveFinished();
+
+	/** Empty the pool (world teardown). */
+	void Reset();
+
+	int32 Num() const { return Ids.Num(); }
+	bool IsEmpty() const { return Ids.IsEmpty(); }
+
+	ESeinBallisticProjectileOutcome GetOutcome(int32 Index) const { return Outcomes[Index]; }
+	FSeinEntityHandle GetInstigator(int32 Index) const { return Instigators[Index]; }
+	FSeinEntityHandle GetTarget(int32 Index) const { return Targets[Index]; }
+	const FFixedVector& GetDestination(int32 Index) const { return Destinations[Index]; }
+	const FSeinDamagePayload& GetPayload(int32 Index) const { return Payloads[PayloadIndices[Index]]; }
+
+	/** Presentation views: this tick's and last tick's positions, row-aligned.
+	 *  Never read these from the simulation. */
+	TConstArrayView<FFixedVector> GetPositions() const { return Positions; }
+	TConstArrayView<FFixedVector> GetPreviousPositions() const { return PreviousPositions; }
+
+	/** Bumped by every mutation; lets digest caches skip a quiescent pool. */
+	uint64 GetMutationRevision() const { return MutationRevision; }
+
+	void Capture(FSeinBallisticProjectileCanonicalState& OutState) const;
+	/** Reject a payload that Restore could not adopt verbatim. */
+	static bool Validate(
+		const FSeinBallisticProjectileCanonicalState& State,
+		FString& OutError);
+	/** Adopt a validated state. Infallible. */
+	void Restore(const FSeinBallisticProjectileCanonicalState& State);
+	/** Fold the canonical columns into Writer in row order. */
+	bool WriteDigest(FSeinCanonicalDigestWriter& Writer) const;
+
+private:
+	int32 InternPayload(const FSeinDamagePayload& Payload);
+	void ReleasePayload(int32 PayloadIndex);
+	/** Rebuild refcounts, the free heap and the lookup from the rows. */
+	void RebuildPayloadIndex();
+	void RemoveAll();
+
+	// Canonical columns, one row per round in spawn order.
+	TArray<uint32> Ids;
+	TArray<FSeinEntityHandle> Instigators;
+	TArray<FSeinEntityHandle> Targets;
+	TArray<FFixedVector> Positions;
+	TArray<FFixedVector> Destinations;
+	TArray<FFixedPoint> Speeds;
+	TArray<FFixedPoint> Lifetimes;
+	TArray<int32> PayloadIndices;
+
+	// Presentation-only and per-step transient columns.
+	TArray<FFixedVector> PreviousPositions;
+	TArray<ESeinBallisticProjectileOutcome> Outcomes;
+
+	/** Interned payloads; a freed slot holds the default payload and the
+	 *  table never ends in one. Cleared whenever the pool drains. */
+	TArray<FSeinDamagePayload> Payloads;
+
+	// Derived from the rows; rebuilt on restore, never captured.
+	TArray<int32> PayloadRefCounts;
+	/** Free slots below Payloads.Num(), as a min-heap. */
+	TArray<int32> FreePayloadSlots;
+	/** Payload hash -> live slot. */
+	TMultiMap<uint32, int32> PayloadSlotsByHash;
+	uint32 NextProjectileId = 1;
+	uint64 MutationRevision = 0;
+};
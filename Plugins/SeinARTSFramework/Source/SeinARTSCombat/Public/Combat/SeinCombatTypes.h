@@ -40,6 +40,14 @@ enum class ESeinWeaponDelivery : uint8
 	 *  snapshot/replay for free and can themselves be targeted
 	 *  (interception). */
 	Projectile,
+
+	/** Fire enters the combat module's lightweight ballistic pool: no
+	 *  entity, no components, no actor. Flight and impact match Projectile,
+	 *  but rounds cannot be targeted or intercepted and render through one
+	 *  instanced visual stream. For high-volume weapons (MGs, artillery)
+	 *  whose rounds only matter where they land. A round the full pool
+	 *  refuses flies as a Projectile entity instead. */
+	Ballistic,
 };
 
 /**
@@ -6,12 +6,13 @@
  * @created      16 Aug 2026
  * @brief        Deterministic on-demand target acquisition.
  *
- *          A pure query: sweep alive vitals-bearing entities in canonical
- *          order, gate mechanically (range, arc, tags, fog LoS through the
- *          bound resolver), ask the scorer policy for validity + score, and
- *          return the best candidates. No retained state, no always-on
- *          engagement loop — abilities and effects call this when THEY decide
- *          to look for trouble.
+ *          A pure query: draw alive vitals-bearing entities in canonical
+ *          order from a derived spatial index (refreshed once per tick at
+ *          the end of PreTick; queries only read it), gate mechanically (range, arc, tags, fog LoS
+ *          through the bound resolver), ask the scorer policy for validity +
+ *          score, and keep the best candidates with a bounded top-K insert.
+ *          No canonical state, no always-on engagement loop — abilities and
+ *          effects call this when THEY decide to look for trouble.
  *
  * @disclaimer   This code was generated in whole or in part with the assistance
  *               of an AI language model.
@@ -28,7 +29,10 @@ class SEINARTSCOMBAT_API FSeinTargetQueryService
 {
 public:
 	/** Run one acquisition query. Results are best-scored first, exact ties
-	 *  broken by canonical entity order, bounded by Query.MaxResults. */
+	 *  broken by canonical entity order, bounded by Query.MaxResults.
+	 *  Candidates come from the index as of this tick's PreTick refresh
+	 *  (entities spawned or moved later this tick join at the next one); the
+	 *  range, arc and tag gates read live state. */
 	static void FindTargets(
 		const USeinWorldSubsystem& World,
 		const FSeinTargetQuery& Query,
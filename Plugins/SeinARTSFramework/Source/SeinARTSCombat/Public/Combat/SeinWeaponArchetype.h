@@ -0,0 +1,102 @@
+/**
+ * SeinARTS Framework - Copyright (c) 2026 Phenom Studios, Inc.
+ *
+ * @file         SeinWeaponArchetype.h
+ * @author       RJ Macklem
+ * @created      17 Oct 2026
+ * @latest       17 Oct 2026
+ * @brief        Shared, immutable weapon definition. Every slot that fires the
+ *               same gun references one archetype asset instead of carrying its
+ *               own copy of range, cadence, delivery and payload.
+ *
+ *          Per-entity weapon state is then just the archetype reference plus
+ *          the three cycling timers, so a hundred riflemen snapshot and digest
+ *          a hundred soft paths rather than a hundred payloads. Archetype
+ *          packages are covered by the combat module's simulation-content
+ *          contributor, so every peer's manifest — and therefore the session's
+ *          content contract — pins the exact profile each path resolves to.
+ *
+ *          Archetypes are content, never state: nothing at runtime writes a
+ *          profile. A game that wants a buffed weapon authors a second asset
+ *          and swaps the slot's reference.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Actor/SeinActor.h"
+#include "Combat/SeinCombatTypes.h"
+#include "Engine/DataAsset.h"
+#include "Types/FixedPoint.h"
+#include "UObject/SoftObjectPtr.h"
+#include "SeinWeaponArchetype.generated.h"
+
+/** The authored constants of one weapon: gates, cadence, delivery, payload. */
+USTRUCT(BlueprintType, meta = (SeinDeterministic))
+struct SEINARTSCOMBAT_API FSeinWeaponProfile
+{
+	GENERATED_BODY()
+
+	/** Maximum planar firing range (world units). */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SeinARTS|Combat")
+	FFixedPoint Range = FFixedPoint::FromInt(1000);
+
+	/** Firing-arc half-angle around the entity's facing, in degrees.
+	 *  180 (default) = fires in any direction. Turret slewing is authored
+	 *  with child transforms + the Turn Child Toward node; this gate only
+	 *  decides whether fire is currently legal. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SeinARTS|Combat",
+		meta = (ClampMin = "0", ClampMax = "180"))
+	FFixedPoint ArcHalfAngleDegrees = FFixedPoint::FromInt(180);
+
+	/** Seconds between shots. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SeinARTS|Combat")
+	FFixedPoint CooldownSeconds = FFixedPoint::One;
+
+	/** Shots before a reload. Zero (default) = no magazine, cooldown only. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SeinARTS|Combat",
+		meta = (ClampMin = "0"))
+	int32 MagazineSize = 0;
+
+	/** Reload duration once the magazine empties. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SeinARTS|Combat")
+	FFixedPoint ReloadSeconds = FFixedPoint::Zero;
+
+	/** Gate fire through the fog line-of-sight resolver when bound. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SeinARTS|Combat")
+	bool bRequireLineOfSight = true;
+
+	/** How fire reaches the target (see ESeinWeaponDelivery). */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SeinARTS|Combat")
+	ESeinWeaponDelivery Delivery = ESeinWeaponDelivery::Instant;
+
+	/** Projectile and Ballistic delivery: flight speed (world units / second). */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SeinARTS|Combat")
+	FFixedPoint ProjectileSpeed = FFixedPoint::FromInt(2000);
+
+	/** Projectile delivery only: optional unit Blueprint for the projectile
+	 *  entity (visuals/extra components). Empty spawns an abstract sim-only
+	 *  projectile — correct but invisible; games set this for tracers/shells
+	 *  they want rendered. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SeinARTS|Combat")
+	TSoftClassPtr<ASeinActor> ProjectileClass;
+
+	/** What a hit delivers. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SeinARTS|Combat")
+	FSeinDamagePayload Payload;
+};
+
+/**
+ * Data asset wrapping one FSeinWeaponProfile.
+ * Designers create one per distinct weapon and point weapon slots at it.
+ */
+UCLASS(BlueprintType)
+class SEINARTSCOMBAT_API USeinWeaponArchetype : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "SeinARTS|Combat",
+		meta = (ShowOnlyInnerProperties))
+	FSeinWeaponProfile Profile;
+};
@@ -23,6 +23,8 @@
 #include "Core/SeinEntityHandle.h"
 
 class USeinWorldSubsystem;
+struct FSeinWeaponProfile;
+struct FSeinWeaponSlot;
 
 /** Why a fire attempt was refused (Fired = success). */
 enum class ESeinWeaponFireResult : uint8
@@ -30,6 +32,9 @@ enum class ESeinWeaponFireResult : uint8
 	Fired,
 	InvalidShooter,
 	InvalidWeaponIndex,
+	/** The slot has no archetype, or its archetype was not made resident
+	 *  when the match started (see USeinCombatSubsystem). */
+	ArchetypeNotResident,
 	NotReady,
 	InvalidTarget,
 	OutOfRange,
@@ -54,6 +59,13 @@ public:
 		FSeinEntityHandle Shooter,
 		int32 WeaponIndex);
 
+	/** The shared profile a slot's archetype resolves to in this world, or
+	 *  null when it has none or it is not resident. Read-only; the one lookup
+	 *  fire and cycling both use. */
+	static const FSeinWeaponProfile* ResolveProfile(
+		const USeinWorldSubsystem& World,
+		const FSeinWeaponSlot& Slot);
+
 private:
 	FSeinWeaponFire() = delete;
 };
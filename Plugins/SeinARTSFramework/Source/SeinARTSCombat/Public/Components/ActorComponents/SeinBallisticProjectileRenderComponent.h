@@ -0,0 +1,46 @@
+/**
+ * SeinARTS Framework - Copyright (c) 2026 Phenom Studios, Inc.
+ *
+ * @file         SeinBallisticProjectileRenderComponent.h
+ * @author       RJ Macklem
+ * @created      17 Oct 2026
+ * @latest       17 Oct 2026
+ * @brief        Render-side instanced stream for Ballistic-delivery rounds.
+ *               Pure UE-native component — reads the combat subsystem's
+ *               ballistic pool, never writes it.
+ *
+ *          Ballistic rounds have no entity and no actor, so nothing renders
+ *          them per round. Drop one of these on any always-present actor
+ *          (game state, a level manager) and assign a tracer/shell mesh: each
+ *          frame it draws every in-flight round as one instance, lerped
+ *          between the previous and current sim positions with the world
+ *          subsystem's interpolation alpha and oriented along its flight.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "SeinBallisticProjectileRenderComponent.generated.h"
+
+UCLASS(ClassGroup = (SeinARTS),
+	meta = (BlueprintSpawnableComponent, DisplayName = "SeinARTS Ballistic Projectile Renderer"))
+class SEINARTSCOMBAT_API USeinBallisticProjectileRenderComponent : public UInstancedStaticMeshComponent
+{
+	GENERATED_BODY()
+
+public:
+	USeinBallisticProjectileRenderComponent();
+
+	virtual void TickComponent(
+		float DeltaTime,
+		ELevelTick TickType,
+		FActorComponentTickFunction* ThisTickFunction) override;
+
+	/** Uniform scale applied to every round instance. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SeinARTS|Combat")
+	FVector InstanceScale = FVector::OneVector;
+
+private:
+	TArray<FTransform> InstanceTransforms;
+};
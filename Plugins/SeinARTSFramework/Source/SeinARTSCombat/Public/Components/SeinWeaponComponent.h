@@ -8,8 +8,10 @@
  *
  *          A weapon slot is clockwork: range/arc gates, a cooldown, an
  *          optional magazine with a reload, and a delivery kind with its
- *          damage payload. WHO fires and AT WHAT is never decided here —
- *          abilities (the starter Attack/auto-acquire content or a game's
+ *          damage payload — all held once in a shared USeinWeaponArchetype
+ *          the slot references, so per-entity state is only the reference
+ *          and the cycling timers. WHO fires and AT WHAT is never decided
+ *          here — abilities (the starter Attack/auto-acquire content or a game's
  *          own) call Fire Weapon through the restricted combat library, and
  *          the weapon-cycle system only advances timers. Pure data component;
  *          runtime fields are BlueprintReadOnly canonical state.
@@ -21,14 +23,13 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Actor/SeinActor.h"
-#include "Combat/SeinCombatTypes.h"
+#include "Combat/SeinWeaponArchetype.h"
 #include "Components/SeinComponent.h"
 #include "Types/FixedPoint.h"
 #include "UObject/SoftObjectPtr.h"
 #include "SeinWeaponComponent.generated.h"
 
-/** One authored weapon plus its deterministic cycling state. */
+/** One weapon reference plus its deterministic cycling state. */
 USTRUCT(BlueprintType, meta = (SeinDeterministic))
 struct SEINARTSCOMBAT_API FSeinWeaponSlot
 {
@@ -36,66 +37,82 @@ struct SEINARTSCOMBAT_API FSeinWeaponSlot
 
 	// ─── Authored ───
 
-	/** Maximum planar firing range (world units). */
+	/** The shared weapon definition (range, cadence, delivery, payload).
+	 *  A slot with no resolvable archetype never fires. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SeinARTS|Combat")
-	FFixedPoint Range = FFixedPoint::FromInt(1000);
+	TSoftObjectPtr<USeinWeaponArchetype> Archetype;
 
-	/** Firing-arc half-angle around the entity's facing, in degrees.
-	 *  180 (default) = fires in any direction. Turret slewing is authored
-	 *  with child transforms + the Turn Child Toward node; this gate only
-	 *  decides whether fire is currently legal. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SeinARTS|Combat",
-		meta = (ClampMin = "0", ClampMax = "180"))
-	FFixedPoint ArcHalfAngleDegrees = FFixedPoint::FromInt(180);
+	// ─── Runtime (canonical cycling state; never author) ───
 
-	/** Seconds between shots. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SeinARTS|Combat")
-	FFixedPoint CooldownSeconds = FFixedPoint::One;
+	UPROPERTY(BlueprintReadOnly, Category = "SeinARTS|Combat")
+	FFixedPoint CooldownRemaining = FFixedPoint::Zero;
 
-	/** Shots before a reload. Zero (default) = no magazine, cooldown only. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SeinARTS|Combat",
-		meta = (ClampMin = "0"))
-	int32 MagazineSize = 0;
+	UPROPERTY(BlueprintReadOnly, Category = "SeinARTS|Combat")
+	FFixedPoint ReloadRemaining = FFixedPoint::Zero;
 
-	/** Reload duration once the magazine empties. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SeinARTS|Combat")
-	FFixedPoint ReloadSeconds = FFixedPoint::Zero;
+	/** Shots left in the magazine. Seeded to the archetype's MagazineSize on
+	 *  first tick. Meaningless while the archetype has no magazine. */
+	UPROPERTY(BlueprintReadOnly, Category = "SeinARTS|Combat")
+	int32 MagazineRemaining = 0;
 
-	/** Gate fire through the fog line-of-sight resolver when bound. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SeinARTS|Combat")
-	bool bRequireLineOfSight = true;
+#if WITH_EDITORONLY_DATA
+	// ─── Legacy (pre-archetype inline authoring; load-only) ───
+	//
+	// Slots saved before weapon archetypes carried these inline. They are
+	// loaded so PostSerialize can tell a migrated slot from one that silently
+	// lost its weapon, never saved, and skipped by the canonical codec.
 
-	/** How fire reaches the target (see ESeinWeaponDelivery). */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SeinARTS|Combat")
-	ESeinWeaponDelivery Delivery = ESeinWeaponDelivery::Instant;
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Author a USeinWeaponArchetype and reference it from Archetype."))
+	FFixedPoint Range_DEPRECATED = FFixedPoint::FromInt(1000);
 
-	/** Projectile delivery only: flight speed (world units / second). */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SeinARTS|Combat")
-	FFixedPoint ProjectileSpeed = FFixedPoint::FromInt(2000);
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Author a USeinWeaponArchetype and reference it from Archetype."))
+	FFixedPoint ArcHalfAngleDegrees_DEPRECATED = FFixedPoint::FromInt(180);
 
-	/** Projectile delivery only: optional unit Blueprint for the projectile
-	 *  entity (visuals/extra components). Empty spawns an abstract sim-only
-	 *  projectile — correct but invisible; games set this for tracers/shells
-	 *  they want rendered. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SeinARTS|Combat")
-	TSoftClassPtr<ASeinActor> ProjectileClass;
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Author a USeinWeaponArchetype and reference it from Archetype."))
+	FFixedPoint CooldownSeconds_DEPRECATED = FFixedPoint::One;
 
-	/** What a hit delivers. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SeinARTS|Combat")
-	FSeinDamagePayload Payload;
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Author a USeinWeaponArchetype and reference it from Archetype."))
+	int32 MagazineSize_DEPRECATED = 0;
 
-	// ─── Runtime (canonical cycling state; never author) ───
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Author a USeinWeaponArchetype and reference it from Archetype."))
+	FFixedPoint ReloadSeconds_DEPRECATED = FFixedPoint::Zero;
 
-	UPROPERTY(BlueprintReadOnly, Category = "SeinARTS|Combat")
-	FFixedPoint CooldownRemaining = FFixedPoint::Zero;
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Author a USeinWeaponArchetype and reference it from Archetype."))
+	bool bRequireLineOfSight_DEPRECATED = true;
 
-	UPROPERTY(BlueprintReadOnly, Category = "SeinARTS|Combat")
-	FFixedPoint ReloadRemaining = FFixedPoint::Zero;
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Author a USeinWeaponArchetype and reference it from Archetype."))
+	ESeinWeaponDelivery Delivery_DEPRECATED = ESeinWeaponDelivery::Instant;
 
-	/** Shots left in the magazine. Seeded to MagazineSize on first tick when
-	 *  a magazine is authored. Meaningless while MagazineSize is zero. */
-	UPROPERTY(BlueprintReadOnly, Category = "SeinARTS|Combat")
-	int32 MagazineRemaining = 0;
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Author a USeinWeaponArchetype and reference it from Archetype."))
+	FFixedPoint ProjectileSpeed_DEPRECATED = FFixedPoint::FromInt(2000);
+
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Author a USeinWeaponArchetype and reference it from Archetype."))
+	TSoftClassPtr<ASeinActor> ProjectileClass_DEPRECATED;
+
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Author a USeinWeaponArchetype and reference it from Archetype."))
+	FSeinDamagePayload Payload_DEPRECATED;
+
+	/** The legacy fields above as a profile, for migration tooling. */
+	FSeinWeaponProfile GetLegacyProfile() const;
+	/** Some legacy field was loaded with a non-default value. */
+	bool HasLegacyInlineProfile() const;
+#endif
+
+	/**
+	 * Legacy inline slots cannot be migrated in place: the archetype must be
+	 * a manifest-pinned asset every peer resolves identically. A slot that
+	 * loads non-default inline values without an archetype reference logs an
+	 * error naming the values to move, so cooks and content loads fail loudly
+	 * instead of shipping a weapon that never fires.
+	 */
+	void PostSerialize(const FArchive& Ar);
+};
+
+template<>
+struct TStructOpsTypeTraits<FSeinWeaponSlot>
+	: public TStructOpsTypeTraitsBase2<FSeinWeaponSlot>
+{
+	enum { WithPostSerialize = true };
 };
 
 USTRUCT(BlueprintType, meta = (SeinDeterministic, DisplayName = "Weapon Component"))
@@ -114,9 +131,7 @@ struct SEINARTSCOMBAT_API FSeinWeaponComponent : public FSeinComponent
 
 FORCEINLINE uint32 GetTypeHash(const FSeinWeaponSlot& Slot)
 {
-	uint32 Hash = GetTypeHash(Slot.Range);
-	Hash = HashCombine(Hash, GetTypeHash(Slot.CooldownSeconds));
-	Hash = HashCombine(Hash, GetTypeHash(Slot.MagazineSize));
+	uint32 Hash = GetTypeHash(Slot.Archetype.ToSoftObjectPath());
 	Hash = HashCombine(Hash, GetTypeHash(Slot.CooldownRemaining));
 	Hash = HashCombine(Hash, GetTypeHash(Slot.ReloadRemaining));
 	Hash = HashCombine(Hash, GetTypeHash(Slot.MagazineRemaining));
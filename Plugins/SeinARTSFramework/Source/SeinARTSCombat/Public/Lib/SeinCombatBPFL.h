@@ -46,4 +46,11 @@ public:
 		const UObject* WorldContextObject,
 		FSeinEntityHandle EntityHandle,
 		int32 WeaponIndex);
+
+	/** Ballistic-delivery rounds currently in flight (they are not
+	 *  entities, so entity queries never see them). */
+	UFUNCTION(BlueprintPure, Category = "SeinARTS|Combat",
+		meta = (WorldContext = "WorldContextObject", DisplayName = "Get Ballistic Projectile Count"))
+	static int32 SeinGetBallisticProjectileCount(
+		const UObject* WorldContextObject);
 };
@@ -8,8 +8,8 @@
  *
  *          The combat module owns the genre-free combat MECHANISMS: vitals and
  *          deterministic damage resolution, weapon cycling timers, the target
- *          query service, and instant/projectile delivery. Everything that
- *          defines a game's combat FEEL — damage formulas, target scoring,
+ *          query service, and instant/projectile/ballistic delivery. Everything
+ *          that defines a game's combat FEEL — damage formulas, target scoring,
  *          engagement stances, suppression, morale, shields — is a pluggable
  *          policy class, an ability, or an effect authored by the consuming
  *          game. The module never decides which kind of RTS is being made.
@@ -22,10 +22,20 @@
 
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
+#include "Serialization/SeinCanonicalStateRegistry.h"
+#include "Serialization/SeinSimulationContentRegistry.h"
 
 class SEINARTSCOMBAT_API FSeinARTSCombatModule : public IModuleInterface
 {
 public:
 	virtual void StartupModule() override;
+	virtual void PreUnloadCallback() override;
 	virtual void ShutdownModule() override;
+
+private:
+	/** The ballistic projectile pool's authoritative contributor. */
+	FSeinCanonicalStateRegistrationHandle CanonicalStateRegistrationHandle;
+
+	/** Puts weapon-archetype packages under the simulation-content manifest. */
+	FSeinSimulationContentRegistrationHandle SimulationContentRegistrationHandle;
 };
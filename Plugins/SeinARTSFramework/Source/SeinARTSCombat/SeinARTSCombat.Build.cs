@@ -12,5 +12,7 @@ public SeinARTSCombat(ReadOnlyTargetRules Target) : base(Target)
             "SeinARTSCore",
             "SeinARTSCoreEntity"
         });
+
+        PrivateDependencyModuleNames.Add("AssetRegistry");
     }
 }
@@ -7,8 +7,8 @@
  * @author:		RJ Macklem
  * @brief:		Deterministic fixed-point math library for lockstep
  * 				simulation. Provides the SeinMath namespace containing
- * 				square root (Newton-Raphson), absolute value, min/max/clamp,
- * 				floor/ceil/round, modulo, linear and Hermite interpolation,
+ * 				exact square root (table-seeded multiply-only Newton),
+ * 				absolute value, min/max/clamp, floor/ceil/round, modulo, linear and Hermite interpolation,
  * 				integer power, natural exp (Pade approximant), natural/base-2/
  * 				base-10 logarithm, and trigonometric functions (sin, cos, tan,
  * 				asin, acos, atan, atan2) driven by a 1024-entry quarter-circle
@@ -21,43 +21,105 @@
 #include "CoreMinimal.h"
 #include "Types/FixedPoint.h"
 
+namespace SeinMathInternal
+{
+	// Reciprocal-square-root seeds for Sqrt: entry i - 64 holds 1/sqrt(u) in
+	// Q15 at the midpoint of the bucket u in [i/256, (i+1)/256), i in [64, 255].
+	static constexpr int32 SQRT_SEED_TABLE_SIZE = 192;
+	extern SEINARTSCORE_API const uint16 SQRT_SEED_TABLE[SQRT_SEED_TABLE_SIZE];
+
+	// Full 64x64 -> 128-bit unsigned product. Returns the high half.
+	FORCEINLINE uint64 MulHigh64(uint64 A, uint64 B, uint64& OutLow)
+	{
+		#if defined(__GNUC__) || defined(__clang__)
+			const unsigned __int128 Product = static_cast<unsigned __int128>(A) * B;
+			OutLow = static_cast<uint64>(Product);
+			return static_cast<uint64>(Product >> 64);
+		#elif defined(_MSC_VER)
+			uint64 High;
+			OutLow = _umul128(A, B, &High);
+			return High;
+		#else
+			#error "Platform does not support 128-bit multiplication"
+		#endif
+	}
+
+	// (A * B) >> Shift for Shift in [1, 63], keeping the low 64 bits.
+	FORCEINLINE uint64 MulShiftRight64(uint64 A, uint64 B, int32 Shift)
+	{
+		uint64 Low;
+		const uint64 High = MulHigh64(A, B, Low);
+		return (High << (64 - Shift)) | (Low >> Shift);
+	}
+
+	// floor(sqrt(Raw * 2^32)) for Raw > 0: the raw bits of the exact 32.32 root.
+	FORCEINLINE uint64 SqrtRaw(uint64 Raw)
+	{
+		// Normalize by an even shift so the top two bits hold the leading one;
+		// the root then only needs a shift back by half of it.
+		const int32 Shift = static_cast<int32>(FPlatformMath::CountLeadingZeros64(Raw)) & ~1;
+		const uint64 Normalized = Raw << Shift;
+
+		// Reciprocal square root of u = Normalized / 2^64 in Q62, refined by three
+		// multiply-only Newton steps R' = R * (3 - u * R^2) / 2 (8 -> ~60 bits).
+		// Every step lands at or below the true value, so nothing overflows.
+		uint64 Reciprocal =
+			static_cast<uint64>(SQRT_SEED_TABLE[(Normalized >> 56) - 64]) << 47;
+		for (int32 Step = 0; Step < 3; ++Step)
+		{
+			const uint64 Squared = MulShiftRight64(Reciprocal, Reciprocal, 63);
+			uint64 Unused;
+			const uint64 Scaled = MulHigh64(Normalized, Squared, Unused);
+			Reciprocal = MulShiftRight64(Reciprocal, (3ULL << 61) - Scaled, 62);
+		}
+
+		// sqrt(u) = u / sqrt(u); the estimate is within far less than one result
+		// unit, so one exact integer check in each direction lands the floor.
+		uint64 Root = MulShiftRight64(Normalized, Reciprocal, 62) >> (16 + Shift / 2);
+		const uint64 TargetHigh = Raw >> 32;
+		const uint64 TargetLow = Raw << 32;
+		const auto SquareFits = [TargetHigh, TargetLow](uint64 Candidate)
+		{
+			uint64 Low;
+			const uint64 High = MulHigh64(Candidate, Candidate, Low);
+			return High < TargetHigh || (High == TargetHigh && Low <= TargetLow);
+		};
+		if (!SquareFits(Root))
+		{
+			--Root;
+		}
+		else if (SquareFits(Root + 1))
+		{
+			++Root;
+		}
+		return Root;
+	}
+}
+
 namespace SeinMath
 {
-	// Square root using Newton-Raphson approximation (faster than bit-by-bit)
+	// Square root, exact: the largest 32.32 value whose square does not exceed X.
+	// CLZ normalization, a table seed and multiply-only Newton steps keep it
+	// division-free; the result is bit-identical on every platform.
 	FORCEINLINE FFixedPoint Sqrt(FFixedPoint X)
 	{
 		check(X >= 0 && "Sqrt of negative number");
 		if (X <= 0) return FFixedPoint::Zero;
-		if (X == FFixedPoint::One) return FFixedPoint::One;
+		return FFixedPoint(static_cast<int64>(
+			SeinMathInternal::SqrtRaw(static_cast<uint64>(X.Value))));
+	}
 
-		// Initial guess using bit manipulation (find highest bit of the raw 32.32
-		// value, then take 2^(HighBit/2) as a starting point near sqrt(X)).
-		int64 Val = static_cast<int64>(X);
-		int32 HighBit = 63;
-		while (HighBit >= 0 && ((Val >> HighBit) & 1) == 0)
-		{
-			HighBit--;
-		}
-		FFixedPoint Guess(1LL << ((HighBit + 32) / 2));
-
-		// Newton-Raphson: x_new = (x + N/x) / 2.
-		// Route the divide through FFixedPoint::operator/, which uses the
-		// deterministic 128-bit divide. The previous implementation used
-		// `(Val << 32) / Guess` in raw int64 — that overflows for any X >= 0.5
-		// (Val << 32 needs 96+ bits for distance-squared values), producing
-		// garbage Quotient and a useless converged "guess" that's nowhere near
-		// sqrt(X). For values in the 25..1e9 range (typical squared distances
-		// in cm world units) the function returned values 100x to 10000x off.
-		// Bit-shift halving still works on the FFixedPoint raw int64 because
-		// halving the raw representation halves the represented value.
-		for (int32 i = 0; i < 4; ++i)
+	// Batched Sqrt over equally sized arrays. Same results as calling Sqrt on
+	// each element.
+	FORCEINLINE void SqrtN(TConstArrayView<FFixedPoint> Values, TArrayView<FFixedPoint> OutRoots)
+	{
+		check(Values.Num() == OutRoots.Num());
+		const FFixedPoint* Source = Values.GetData();
+		FFixedPoint* Dest = OutRoots.GetData();
+		for (int32 Index = 0; Index < Values.Num(); ++Index)
 		{
-			if (static_cast<int64>(Guess) == 0) break;
-			const FFixedPoint Quotient = X / Guess;
-			Guess = FFixedPoint((static_cast<int64>(Guess) + static_cast<int64>(Quotient)) >> 1);
+			Dest[Index] = Sqrt(Source[Index]);
 		}
-
-		return Guess;
 	}
 	
 	// Inverse square root (1/sqrt(x)) - useful for fast normalization
@@ -569,7 +631,6 @@ namespace SeinMath
 			return X >= 0 ? FFixedPoint::HalfPi : -FFixedPoint::HalfPi;
 		}
 		
-		// Use optimized sqrt (Newton-Raphson, much faster than bit-by-bit)
 		FFixedPoint SqrtOneMinusX2 = Sqrt(OneMinusX2);
 		return Atan2(X, SqrtOneMinusX2);
 	}
@@ -627,3 +627,23 @@ struct TStructOpsTypeTraits<FFixedVector>
 		WithZeroConstructor = true,
 	};
 };
+
+namespace SeinMath
+{
+	/** Batched FFixedVector::Size over equally sized arrays. In-range squares go
+	 *  straight to the exact integer root; vectors whose square saturates take
+	 *  the scaled Size() path, so every result matches Size() bit-for-bit. */
+	FORCEINLINE void LengthN(TConstArrayView<FFixedVector> Vectors, TArrayView<FFixedPoint> OutLengths)
+	{
+		check(Vectors.Num() == OutLengths.Num());
+		const FFixedVector* Source = Vectors.GetData();
+		FFixedPoint* Dest = OutLengths.GetData();
+		for (int32 Index = 0; Index < Vectors.Num(); ++Index)
+		{
+			const FFixedPoint SizeSq = Source[Index].SizeSquaredSaturated();
+			Dest[Index] = SizeSq != FFixedPoint::MaxValue
+				? Sqrt(SizeSq)
+				: Source[Index].Size();
+		}
+	}
+}
@@ -587,6 +587,7 @@ void USeinAbility::StartCooldownInternal()
 
 		if (USeinAbility* MateInstance = MateAC->FindAbilityByTag(*WorldSubsystem, AbilityTag))
 		{
+			MateInstance->MarkDeterministicStateDirty();
 			MateInstance->CooldownRemaining = Cooldown;
 			MateInstance->bCooldownStarted = true;
 		}
@@ -472,6 +472,19 @@ void USeinEntityComponent::OnSimFrame(int32 TicksProcessed)
 		CurrentSimTransform.Rotation.Z.ToFloat(), CurrentSimTransform.Rotation.W.ToFloat());
 }
 
+bool USeinEntityComponent::GetInterpolationSegment(FVector& OutFrom, FVector& OutTo) const
+{
+	if (!bSyncTransform || !bHasSimSnapshot)
+	{
+		return false;
+	}
+	OutTo = CurrentSimTransform.Location.ToVector();
+	OutFrom = bInterpolateTransform
+		? PreviousSimTransform.Location.ToVector()
+		: OutTo;
+	return true;
+}
+
 void USeinEntityComponent::HandleVisualEvent(const FSeinVisualEvent& Event)
 {
 	// Broadcast to subscribed render-side ACs FIRST so they observe the same
@@ -267,7 +267,7 @@ FSeinFormationLayout USeinDefaultCommandBrokerResolver::ResolveFormationLayout_I
 	const USeinFormation* Formation = nullptr;
 	if (!Target.FormationClass.IsNull())
 	{
-		if (UClass* OverrideClass = Target.FormationClass.LoadSynchronous())
+		if (UClass* OverrideClass = SeinLoadSimulationClass(Target.FormationClass))
 		{
 			if (!OverrideClass->HasAnyClassFlags(CLASS_Abstract))
 			{
@@ -662,7 +662,7 @@ const USeinFormation* USeinDefaultCommandBrokerResolver::ResolveFormation(FGamep
 		return nullptr; // neither resolves → caller uses the blob ResolvePositions fallback
 	}
 
-	UClass* FormationClass = ClassPtr.LoadSynchronous();
+	UClass* FormationClass = SeinLoadSimulationClass(ClassPtr);
 	if (!FormationClass || FormationClass->HasAnyClassFlags(CLASS_Abstract))
 	{
 		return nullptr;
@@ -0,0 +1,423 @@
+/**
+ * SeinARTS Framework - Copyright (c) 2026 Phenom Studios, Inc.
+ *
+ * @file         SeinCollisionResolverColored.cpp
+ * @author       RJ Macklem
+ * @created      17 Oct 2026
+ * @latest       17 Oct 2026
+ * @brief        Contact-graph build, greedy coloring and the per-class parallel
+ *               Gauss-Seidel passes.
+ *
+ * The graph-colored Gauss-Seidel separation strategy. Shares the entire
+ * collision floor (shape build, channel/collider/mass helpers, the hard-barrier
+ * CanOccupy gate, the overlap-event diff) with the other resolvers through the
+ * USeinCollisionResolver base; only the contact graph, its coloring, and the
+ * per-class relaxation schedule live here.
+ *
+ * DETERMINISM. Per tick:
+ *   1. movers are gathered in ascending slot order (serial);
+ *   2. PARALLEL: each mover queries the PreTick broadphase and keeps its
+ *      Blocking candidates in a private list (read-only, disjoint writes);
+ *   3. SERIAL: the lists are flattened, the movable-movable edges symmetrized,
+ *      and movers colored greedily in ascending order.
+ * Per pass, per color class in ascending color order:
+ *   4. PARALLEL: each member reads its own and its candidates' CURRENT
+ *      transforms — none of which any other member writes — and accumulates
+ *      its barrier-gated share of each overlap into NewPos[i];
+ *   5. SERIAL: the class is applied before the next class starts.
+ * Step 4 is a pure function of state frozen for the duration of the class, so
+ * the result is independent of thread count (Sein.Sim.Parallel 0-vs-1).
+ */
+
+#include "Collision/SeinCollisionResolverColored.h"
+#include "Serialization/SeinCanonicalInitialStateDigest.h"
+#include "Simulation/SeinWorldSubsystem.h"
+#include "Collision/SeinCollisionSpatialHash.h"
+#include "Components/SeinExtentsHelpers.h"
+#include "Settings/PluginSettings.h"
+#include "Core/SeinParallel.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+void USeinCollisionResolverColored::Resolve(USeinWorldSubsystem& World)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(Sein_Collision_Colored_Resolve);
+	TMap<FName, ESeinCollisionResponse> ChannelDefaults;
+	BuildChannelDefaults(ChannelDefaults);
+	if (ChannelDefaults.Num() == 0) return; // no enabled channels → nothing to resolve
+
+	// Mass-ratio cutoff — the SAME setting and read the other resolvers use.
+	const USeinARTSCoreSettings* MassSettings = GetDefault<USeinARTSCoreSettings>();
+	const int32 RawCutoff = MassSettings ? MassSettings->CollisionMassRatioCutoff : 8;
+	const FFixedPoint MassRatioCutoff = FFixedPoint::FromInt(RawCutoff > 1 ? RawCutoff : 1);
+
+	// Provider callback thread-safety is not part of the registry contract, so
+	// a live authoritative-destination provider keeps CanOccupy on the game
+	// thread — exactly the Jacobi resolver's rule.
+	const bool bForceSerial = World.HasAuthoritativeDestinationProviders();
+
+	if (BuildContactGraph(World, ChannelDefaults))
+	{
+		const int32 Passes = (NumPasses > 0) ? NumPasses : 1;
+		for (int32 Pass = 0; Pass < Passes; ++Pass)
+		{
+			// An unchanged pass is an exact fixed point; later passes would
+			// recompute the same contacts against the same transforms.
+			if (!ColoredPass(World, MassRatioCutoff, bForceSerial))
+			{
+				break;
+			}
+		}
+	}
+
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(Sein_Collision_OverlapEvents);
+		DetectOverlapsAndEmit(World, ChannelDefaults);
+	}
+}
+
+bool USeinCollisionResolverColored::BuildContactGraph(
+	USeinWorldSubsystem& World,
+	const TMap<FName, ESeinCollisionResponse>& ChannelDefaults)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(Sein_Collision_ContactGraph);
+	Movers.Reset();
+	ContactOffsets.Reset();
+	Contacts.Reset();
+	ColorOffsets.Reset();
+	ColorMembers.Reset();
+
+	const FSeinEntityPool& Pool = World.GetEntityPool();
+	const FSeinCollisionSpatialHash& Hash = World.GetCollisionSpatialHash();
+	const FFixedPoint CellSize = Hash.GetCellSize();
+	const ISeinComponentStorage* ExtentsStorage =
+		World.GetComponentStorageRaw(
+			FSeinExtentsComponent::StaticStruct());
+	if (!ExtentsStorage) return false;
+
+	// 1) Movers in ascending slot order — the same collider test as the other
+	//    resolvers. Extents pointers stay valid for the whole Resolve: nothing
+	//    here adds components or destroys entities.
+	int32 MaxSlot = 0;
+	Pool.ForEachEntity([&](
+		FSeinEntityHandle SelfHandle,
+		const FSeinEntity& /*SelfEntity*/)
+	{
+		const FSeinExtentsComponent* SelfExt =
+			static_cast<const FSeinExtentsComponent*>(ExtentsStorage->GetComponentRaw(SelfHandle));
+		if (!IsCollider(SelfExt)) return;
+		if (SelfExt->Mobility != ESeinCollisionMobility::Movable) return;
+
+		const FFixedPoint SelfRadius = SeinExtentsHelpers::GetColliderBoundingRadius(*SelfExt);
+		if (SelfRadius <= FFixedPoint::Zero) return;
+
+		Movers.Add(FMover{ SelfHandle, SelfExt, SelfRadius, ResolveColliderMass(*SelfExt) });
+		MaxSlot = FMath::Max(MaxSlot, SelfHandle.Index);
+	});
+	const int32 NumMovers = Movers.Num();
+	if (NumMovers == 0) return false;
+
+	// 2) Broadphase candidates per mover, Blocking pairs only. Channel
+	//    responses cannot change mid-tick, so the filter runs once per tick
+	//    instead of once per pass.
+	TArray<TArray<FContact>> PerMover;
+	PerMover.SetNum(NumMovers);
+	SeinParallelFor(NumMovers, [&](int32 i)
+	{
+		const FMover& Self = Movers[i];
+		const FSeinEntity* SelfEntity = Pool.Get(Self.Handle);
+		if (!SelfEntity) return;
+
+		TArray<FSeinEntityHandle> Neighbors;
+		Hash.QueryRadius(SelfEntity->Transform.GetLocation(), Self.Radius + CellSize, Neighbors, Self.Handle);
+		for (const FSeinEntityHandle& OtherHandle : Neighbors)
+		{
+			const FSeinExtentsComponent* OtherExt =
+				static_cast<const FSeinExtentsComponent*>(ExtentsStorage->GetComponentRaw(OtherHandle));
+			if (!IsCollider(OtherExt)) continue;
+			if (ResolvePairFor(*Self.Ext, *OtherExt, ChannelDefaults) != ESeinCollisionResponse::Block) continue;
+			PerMover[i].Add(FContact{ OtherHandle, OtherExt, INDEX_NONE });
+		}
+	});
+
+	// 3) Flatten to CSR, resolving movable candidates to mover indices.
+	TArray<int32> MoverIndexBySlot;
+	MoverIndexBySlot.Init(INDEX_NONE, MaxSlot + 1);
+	for (int32 i = 0; i < NumMovers; ++i)
+	{
+		MoverIndexBySlot[Movers[i].Handle.Index] = i;
+	}
+
+	TArray<int32> Degree;
+	Degree.Init(0, NumMovers);
+	ContactOffsets.SetNumUninitialized(NumMovers + 1);
+	for (int32 i = 0; i < NumMovers; ++i)
+	{
+		ContactOffsets[i] = Contacts.Num();
+		for (FContact& Contact : PerMover[i])
+		{
+			const int32 Slot = Contact.Handle.Index;
+			const int32 Other = MoverIndexBySlot.IsValidIndex(Slot) ? MoverIndexBySlot[Slot] : INDEX_NONE;
+			if (Other != INDEX_NONE && Movers[Other].Handle == Contact.Handle)
+			{
+				Contact.MoverIndex = Other;
+				++Degree[i];
+				++Degree[Other];
+			}
+			Contacts.Add(Contact);
+		}
+	}
+	ContactOffsets[NumMovers] = Contacts.Num();
+
+	// Symmetric conflict adjacency: a mover must not share a color with any
+	// mover it reads OR any mover that reads it, and candidate lists are not
+	// guaranteed symmetric (radii differ).
+	TArray<int32> ConflictOffsets;
+	ConflictOffsets.SetNumUninitialized(NumMovers + 1);
+	ConflictOffsets[0] = 0;
+	for (int32 i = 0; i < NumMovers; ++i)
+	{
+		ConflictOffsets[i + 1] = ConflictOffsets[i] + Degree[i];
+	}
+	TArray<int32> Conflicts;
+	Conflicts.SetNumUninitialized(ConflictOffsets[NumMovers]);
+	TArray<int32> Fill(ConflictOffsets.GetData(), NumMovers);
+	for (int32 i = 0; i < NumMovers; ++i)
+	{
+		for (int32 C = ContactOffsets[i]; C < ContactOffsets[i + 1]; ++C)
+		{
+			const int32 Other = Contacts[C].MoverIndex;
+			if (Other == INDEX_NONE) continue;
+			Conflicts[Fill[i]++] = Other;
+			Conflicts[Fill[Other]++] = i;
+		}
+	}
+
+	// Greedy coloring in ascending handle order: lowest color not held by an
+	// already-colored neighbour. UsedStamp[c] == i marks color c taken for i.
+	TArray<int32> Color;
+	Color.Init(INDEX_NONE, NumMovers);
+	TArray<int32> UsedStamp;
+	TArray<int32> ColorCounts;
+	for (int32 i = 0; i < NumMovers; ++i)
+	{
+		for (int32 C = ConflictOffsets[i]; C < ConflictOffsets[i + 1]; ++C)
+		{
+			const int32 NeighborColor = Color[Conflicts[C]];
+			if (NeighborColor != INDEX_NONE)
+			{
+				UsedStamp[NeighborColor] = i;
+			}
+		}
+		int32 Chosen = 0;
+		while (Chosen < UsedStamp.Num() && UsedStamp[Chosen] == i)
+		{
+			++Chosen;
+		}
+		if (Chosen == UsedStamp.Num())
+		{
+			UsedStamp.Add(INDEX_NONE);
+			ColorCounts.Add(0);
+		}
+		Color[i] = Chosen;
+		++ColorCounts[Chosen];
+	}
+
+	// Counting sort into per-class member lists; ascending i within a class.
+	const int32 NumColors = ColorCounts.Num();
+	ColorOffsets.SetNumUninitialized(NumColors + 1);
+	ColorOffsets[0] = 0;
+	for (int32 C = 0; C < NumColors; ++C)
+	{
+		ColorOffsets[C + 1] = ColorOffsets[C] + ColorCounts[C];
+	}
+	ColorMembers.SetNumUninitialized(NumMovers);
+	TArray<int32> ColorFill(ColorOffsets.GetData(), NumColors);
+	for (int32 i = 0; i < NumMovers; ++i)
+	{
+		ColorMembers[ColorFill[Color[i]]++] = i;
+	}
+	return true;
+}
+
+bool USeinCollisionResolverColored::ColoredPass(
+	USeinWorldSubsystem& World,
+	FFixedPoint MassRatioCutoff,
+	bool bForceSerial)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(Sein_Collision_ColoredPass);
+	const FSeinEntityPool& Pool = World.GetEntityPool();
+	NewPos.SetNumUninitialized(Movers.Num());
+
+	bool bAnyChanged = false;
+	for (int32 ColorIndex = 0; ColorIndex + 1 < ColorOffsets.Num(); ++ColorIndex)
+	{
+		const int32 Begin = ColorOffsets[ColorIndex];
+		const int32 Count = ColorOffsets[ColorIndex + 1] - Begin;
+
+		// Class compute. Members are pairwise non-adjacent, so every transform
+		// read here — self, a neighbour of another color, or an immovable — is
+		// one no concurrent body writes.
+		SeinParallelFor(Count, [&](int32 k)
+		{
+			const int32 i = ColorMembers[Begin + k];
+			const FMover& Self = Movers[i];
+			const FSeinEntity* SelfEntity = Pool.Get(Self.Handle);
+			if (!SelfEntity)
+			{
+				NewPos[i] = FFixedVector::ZeroVector;
+				return;
+			}
+
+			FFixedTransform SelfXf = SelfEntity->Transform;
+			const FFixedVector SelfPos0 = SelfXf.GetLocation();
+			FFixedVector Running = SelfPos0;
+
+			// Shapes are built lazily from the running position and rebuilt
+			// only after an accepted push — the default's in-pass visibility of
+			// self's own moves.
+			TArray<FCollisionShape2D> SelfShapes;
+			bool bSelfShapesDirty = true;
+			for (int32 C = ContactOffsets[i]; C < ContactOffsets[i + 1]; ++C)
+			{
+				const FContact& Contact = Contacts[C];
+				const FSeinEntity* OtherEntity = Pool.Get(Contact.Handle);
+				if (!OtherEntity) continue;
+
+				if (bSelfShapesDirty)
+				{
+					SelfXf.SetLocation(Running);
+					BuildShapes2D(*Self.Ext, SelfXf, SelfShapes);
+					bSelfShapesDirty = false;
+				}
+
+				FFixedVector Normal;
+				FFixedPoint  Depth;
+				if (!ComputeDeepestContact(SelfShapes, *Contact.Ext, OtherEntity->Transform, Normal, Depth)) continue;
+				if (Depth <= FFixedPoint::Zero) continue;
+
+				// Self's share only (the other side resolves in its own color).
+				// Immovable other = infinite mass; else cutoff, then mass split.
+				FFixedPoint SelfShare;
+				if (Contact.Ext->Mobility != ESeinCollisionMobility::Movable)
+				{
+					SelfShare = FFixedPoint::One;
+				}
+				else
+				{
+					const FFixedPoint MassOther = ResolveColliderMass(*Contact.Ext);
+					if (Self.Mass >= MassOther * MassRatioCutoff)
+					{
+						SelfShare = FFixedPoint::Zero;
+					}
+					else if (MassOther >= Self.Mass * MassRatioCutoff)
+					{
+						SelfShare = FFixedPoint::One;
+					}
+					else
+					{
+						const FFixedPoint MassSum = Self.Mass + MassOther;
+						SelfShare = (MassSum > FFixedPoint::Epsilon) ? (MassOther / MassSum) : FFixedPoint::Half;
+					}
+				}
+				if (SelfShare <= FFixedPoint::Zero) continue;
+
+				// Per-push barrier gate; preserve the start-of-pass Z.
+				const FFixedVector Push = -Normal * (Depth * SelfShare);
+				if (Push == FFixedVector::ZeroVector) continue;
+				FFixedVector Candidate = Running + Push;
+				Candidate.Z = SelfPos0.Z;
+				if (CanOccupy(
+					World,
+					Self.Handle,
+					Candidate,
+					Self.Radius,
+					bForceSerial))
+				{
+					Running = Candidate;
+					bSelfShapesDirty = true;
+				}
+			}
+
+			NewPos[i] = Running;
+		}, bForceSerial);
+
+		// Class apply — visible to every later class this pass.
+		for (int32 k = 0; k < Count; ++k)
+		{
+			const int32 i = ColorMembers[Begin + k];
+			const FSeinEntity* CurrentEntity = World.GetEntity(Movers[i].Handle);
+			if (!CurrentEntity
+				|| CurrentEntity->Transform.GetLocation() == NewPos[i])
+			{
+				continue;
+			}
+			FSeinEntity* SelfEntity = World.GetEntityMutable(Movers[i].Handle);
+			if (!SelfEntity) continue;
+			SelfEntity->Transform.SetLocation(NewPos[i]);
+			bAnyChanged = true;
+		}
+	}
+	return bAnyChanged;
+}
+
+namespace
+{
+	const UClass* FindNearestNativeCollisionClass(const UClass* Class)
+	{
+		while (Class && !Class->HasAnyClassFlags(CLASS_Native))
+		{
+			Class = Class->GetSuperClass();
+		}
+		return Class;
+	}
+}
+
+bool USeinCollisionResolverColored::ComputeStateCoverageClaim(
+	FSeinCollisionResolverStateCoverageClaim& OutClaim,
+	FString& OutError) const
+{
+	OutClaim = {};
+	OutError.Reset();
+	const UClass* NativeClass =
+		FindNearestNativeCollisionClass(GetClass());
+	if (NativeClass != USeinCollisionResolverColored::StaticClass())
+	{
+		OutError = FString::Printf(
+			TEXT("Native collision-resolver subclass '%s' must explicitly claim exact mutable-state coverage."),
+			*GetClass()->GetPathName());
+		return false;
+	}
+	OutClaim.StableImplementationId =
+		TEXT("seinarts.collision.resolver.colored");
+	OutClaim.BehaviorRevision = 1;
+	OutClaim.CoverageRevision = 1;
+	OutClaim.StateCoverage =
+		ESeinCollisionResolverStateCoverage::Stateless;
+	return true;
+}
+
+bool USeinCollisionResolverColored::ComputeResolutionConfigDigest(
+	FGuid& OutDigest,
+	FString& OutError) const
+{
+	OutDigest.Invalidate();
+	OutError.Reset();
+	const UClass* NativeClass =
+		FindNearestNativeCollisionClass(GetClass());
+	if (NativeClass != USeinCollisionResolverColored::StaticClass())
+	{
+		OutError = FString::Printf(
+			TEXT("Native collision-resolver subclass '%s' must override ComputeResolutionConfigDigest to cover its own resolution tuning."),
+			*GetClass()->GetPathName());
+		return false;
+	}
+	FSeinCanonicalDigestWriter Writer(
+		TEXT("SeinARTS.Collision.Colored.ResolutionConfig"), 1);
+	if (!Writer.WriteString(GetClass()->GetPathName())
+		|| !Writer.WriteInt32(NumPasses))
+	{
+		OutError = Writer.GetError();
+		return false;
+	}
+	return Writer.Finalize(OutDigest, OutError);
+}
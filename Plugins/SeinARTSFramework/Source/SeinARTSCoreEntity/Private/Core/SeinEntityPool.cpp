@@ -10,9 +10,16 @@
  */
 
 #include "Core/SeinEntityPool.h"
+#include <atomic>
 
 namespace
 {
+	uint64 AllocateRevisionEpoch()
+	{
+		static std::atomic<uint64> NextEpoch{1};
+		return NextEpoch.fetch_add(1, std::memory_order_relaxed);
+	}
+
 	bool TryAdvanceGeneration(int32& Generation)
 	{
 		// Wrapping would make a very old handle valid again. Exhausted slots are
@@ -150,7 +157,8 @@ namespace
 }
 
 FSeinEntityPool::FSeinEntityPool()
-	: ActiveCount(0)
+	: RevisionEpoch(AllocateRevisionEpoch())
+	, ActiveCount(0)
 	, Capacity(0)
 {
 }
@@ -448,6 +456,7 @@ void FSeinEntityPool::Reset()
 	FreeList.Empty();
 	ActiveCount = 0;
 	Capacity = 0;
+	RevisionEpoch = AllocateRevisionEpoch();
 	BumpTopologyRevision();
 }
 
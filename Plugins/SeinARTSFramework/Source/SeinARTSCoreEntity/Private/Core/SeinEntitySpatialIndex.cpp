@@ -0,0 +1,249 @@
+/**
+ * SeinARTS Framework - Copyright (c) 2026 Phenom Studios, Inc.
+ *
+ * @file         SeinEntitySpatialIndex.cpp
+ * @author       RJ Macklem
+ * @created      17 Oct 2026
+ * @latest       17 Oct 2026
+ * @brief        Incremental slot rebinning and cell gathers for the entity
+ *               spatial index.
+ */
+
+#include "Core/SeinEntitySpatialIndex.h"
+#include "Core/SeinEntityPool.h"
+#include "Algo/Sort.h"
+#include "Misc/ScopeLock.h"
+
+FSeinEntitySpatialIndex::FSeinEntitySpatialIndex()
+	: CellSize(FFixedPoint::FromInt(DefaultCellSizeCm))
+{
+}
+
+void FSeinEntitySpatialIndex::Reset()
+{
+	Cells.Reset();
+	SlotRevisions.Reset();
+	SlotCellKeys.Reset();
+	SlotCellPositions.Reset();
+	IndexedCount = 0;
+	LastSyncRebinCount = 0;
+	SyncedEpoch.store(0, std::memory_order_release);
+	SyncedMutationRevision.store(0, std::memory_order_release);
+	SyncedSlotCount.store(0, std::memory_order_release);
+}
+
+bool FSeinEntitySpatialIndex::IsSyncedWith(const FSeinEntityPool& Pool) const
+{
+	return SyncedEpoch.load(std::memory_order_acquire) == Pool.GetRevisionEpoch()
+		&& SyncedMutationRevision.load(std::memory_order_acquire)
+			== Pool.GetLatestMutationRevision()
+		&& SyncedSlotCount.load(std::memory_order_acquire)
+			== Pool.GetCapacity() + 1;
+}
+
+void FSeinEntitySpatialIndex::EnsureSyncedWith(const FSeinEntityPool& Pool)
+{
+	if (IsSyncedWith(Pool))
+	{
+		return;
+	}
+	FScopeLock Lock(&SyncLock);
+	if (!IsSyncedWith(Pool))
+	{
+		Sync(Pool);
+	}
+}
+
+void FSeinEntitySpatialIndex::Sync(const FSeinEntityPool& Pool)
+{
+	const uint64 Epoch = Pool.GetRevisionEpoch();
+	const int32 NumSlots = Pool.GetCapacity() + 1;
+	if (Epoch != SyncedEpoch.load(std::memory_order_relaxed)
+		|| NumSlots < SlotRevisions.Num())
+	{
+		Reset();
+	}
+
+	// Grown slots start unbinned at revision zero, exactly like the pool's
+	// zeroed growth, so only slots the pool has touched are visited below.
+	const int32 OldNumSlots = SlotRevisions.Num();
+	if (NumSlots > OldNumSlots)
+	{
+		SlotRevisions.SetNumZeroed(NumSlots);
+		SlotCellKeys.SetNumZeroed(NumSlots);
+		SlotCellPositions.SetNumUninitialized(NumSlots);
+		for (int32 SlotIndex = OldNumSlots; SlotIndex < NumSlots; ++SlotIndex)
+		{
+			SlotCellPositions[SlotIndex] = INDEX_NONE;
+		}
+	}
+
+	// Revisions are unique per touch, so an equal revision means the slot's
+	// position, liveness and generation are exactly what was binned.
+	LastSyncRebinCount = 0;
+	for (int32 SlotIndex = 1; SlotIndex < NumSlots; ++SlotIndex)
+	{
+		const uint64 Revision = Pool.GetSlotMutationRevision(SlotIndex);
+		if (Revision == SlotRevisions[SlotIndex])
+		{
+			continue;
+		}
+		SlotRevisions[SlotIndex] = Revision;
+		RebinSlot(SlotIndex, Pool);
+		++LastSyncRebinCount;
+	}
+
+	SyncedSlotCount.store(NumSlots, std::memory_order_release);
+	SyncedMutationRevision.store(
+		Pool.GetLatestMutationRevision(), std::memory_order_release);
+	SyncedEpoch.store(Epoch, std::memory_order_release);
+}
+
+void FSeinEntitySpatialIndex::RebinSlot(int32 SlotIndex, const FSeinEntityPool& Pool)
+{
+	const int32 Generation = Pool.GetSlotGeneration(SlotIndex);
+	const FSeinEntity* Entity = Pool.Get(FSeinEntityHandle(SlotIndex, Generation));
+	if (!Entity)
+	{
+		RemoveSlot(SlotIndex);
+		return;
+	}
+
+	const FFixedVector Location = Entity->Transform.GetLocation();
+	const int64 Key = MakeKey(ToCell(Location.X), ToCell(Location.Y));
+	if (SlotCellPositions[SlotIndex] != INDEX_NONE && SlotCellKeys[SlotIndex] == Key)
+	{
+		Cells[Key][SlotCellPositions[SlotIndex]].Generation = Generation;
+		return;
+	}
+
+	RemoveSlot(SlotIndex);
+	TArray<FCellMember>& Members = Cells.FindOrAdd(Key);
+	SlotCellKeys[SlotIndex] = Key;
+	SlotCellPositions[SlotIndex] = Members.Add({SlotIndex, Generation});
+	++IndexedCount;
+}
+
+void FSeinEntitySpatialIndex::RemoveSlot(int32 SlotIndex)
+{
+	const int32 Position = SlotCellPositions[SlotIndex];
+	if (Position == INDEX_NONE)
+	{
+		return;
+	}
+	const int64 Key = SlotCellKeys[SlotIndex];
+	TArray<FCellMember>& Members = Cells.FindChecked(Key);
+	Members.RemoveAtSwap(Position, EAllowShrinking::No);
+	if (Members.IsValidIndex(Position))
+	{
+		SlotCellPositions[Members[Position].SlotIndex] = Position;
+	}
+	if (Members.IsEmpty())
+	{
+		Cells.Remove(Key);
+	}
+	SlotCellPositions[SlotIndex] = INDEX_NONE;
+	--IndexedCount;
+}
+
+int64 FSeinEntitySpatialIndex::ToCell(FFixedPoint Coord) const
+{
+	const int64 Raw = Coord.Value;
+	const int64 Cell = CellSize.Value;
+	// Floor division on raw bits: C++ truncates toward zero, so step negative
+	// remainders down one cell.
+	const int64 Quotient = Raw / Cell;
+	return (Raw % Cell != 0 && Raw < 0) ? Quotient - 1 : Quotient;
+}
+
+void FSeinEntitySpatialIndex::GatherCandidatesInRadius(
+	const FFixedVector& Center,
+	FFixedPoint Radius,
+	TArray<FSeinEntityHandle>& Out) const
+{
+	// Span whole cells from the centre cell instead of converting Center ±
+	// Radius, so extreme radii cannot overflow the fixed-point add.
+	const int64 RadiusRaw = Radius.Value == MIN_int64
+		? MAX_int64
+		: (Radius.Value < 0 ? -Radius.Value : Radius.Value);
+	const int64 Span = RadiusRaw / CellSize.Value + 1;
+	const int64 CellX = ToCell(Center.X);
+	const int64 CellY = ToCell(Center.Y);
+	GatherCells(CellX - Span, CellY - Span, CellX + Span, CellY + Span, Out);
+}
+
+void FSeinEntitySpatialIndex::GatherCandidatesInBox(
+	const FFixedVector& Min,
+	const FFixedVector& Max,
+	TArray<FSeinEntityHandle>& Out) const
+{
+	if (Min.X > Max.X || Min.Y > Max.Y)
+	{
+		return;
+	}
+	GatherCells(ToCell(Min.X), ToCell(Min.Y), ToCell(Max.X), ToCell(Max.Y), Out);
+}
+
+void FSeinEntitySpatialIndex::GatherCells(
+	int64 MinCellX, int64 MinCellY,
+	int64 MaxCellX, int64 MaxCellY,
+	TArray<FSeinEntityHandle>& Out) const
+{
+	if (Cells.IsEmpty())
+	{
+		return;
+	}
+	const int32 FirstOut = Out.Num();
+
+	// Visit whichever set is smaller: the rectangle's cells, or the occupied
+	// cells filtered by the rectangle. Huge radii degrade to a full sweep.
+	const uint64 RangeX = static_cast<uint64>(MaxCellX - MinCellX) + 1;
+	const uint64 RangeY = static_cast<uint64>(MaxCellY - MinCellY) + 1;
+	const uint64 OccupiedCells = static_cast<uint64>(Cells.Num());
+	if (RangeX <= OccupiedCells && RangeY <= OccupiedCells
+		&& RangeX * RangeY <= OccupiedCells)
+	{
+		for (int64 X = MinCellX; X <= MaxCellX; ++X)
+		{
+			for (int64 Y = MinCellY; Y <= MaxCellY; ++Y)
+			{
+				if (const TArray<FCellMember>* Members = Cells.Find(MakeKey(X, Y)))
+				{
+					for (const FCellMember& Member : *Members)
+					{
+						Out.Add(FSeinEntityHandle(Member.SlotIndex, Member.Generation));
+					}
+				}
+			}
+		}
+	}
+	else
+	{
+		for (const TPair<int64, TArray<FCellMember>>& Cell : Cells)
+		{
+			const uint64 Bits = BitCast<uint64>(Cell.Key);
+			const int64 X = static_cast<int32>(static_cast<uint32>(Bits >> 32));
+			const int64 Y = static_cast<int32>(static_cast<uint32>(Bits));
+			if (X < MinCellX || X > MaxCellX || Y < MinCellY || Y > MaxCellY)
+			{
+				continue;
+			}
+			for (const FCellMember& Member : Cell.Value)
+			{
+				Out.Add(FSeinEntityHandle(Member.SlotIndex, Member.Generation));
+			}
+		}
+	}
+
+	// Bucket and map iteration order are not canonical; slot order is.
+	// Each live slot sits in exactly one cell, so no duplicates arise.
+	if (Out.Num() - FirstOut > 1)
+	{
+		Algo::Sort(
+			MakeArrayView(Out.GetData() + FirstOut, Out.Num() - FirstOut),
+			[](const FSeinEntityHandle& A, const FSeinEntityHandle& B)
+			{
+				return A.Index < B.Index;
+			});
+	}
+}
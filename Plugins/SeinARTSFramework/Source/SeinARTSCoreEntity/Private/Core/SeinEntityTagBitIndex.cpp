@@ -0,0 +1,211 @@
+/**
+ * SeinARTS Framework - Copyright (c) 2026 Phenom Studios, Inc.
+ *
+ * @file         SeinEntityTagBitIndex.cpp
+ * @author       RJ Macklem
+ * @created      17 Oct 2026
+ * @latest       17 Oct 2026
+ * @brief        Tag bit assignment, per-entity row maintenance and masked tag
+ *               matching.
+ */
+
+#include "Core/SeinEntityTagBitIndex.h"
+
+namespace
+{
+	void SetBit(uint64* Words, int32 Bit)
+	{
+		Words[Bit >> 6] |= uint64(1) << (Bit & 63);
+	}
+}
+
+void FSeinEntityTagBitIndex::Reset()
+{
+	BitByTag.Reset();
+	TagByBit.Reset();
+	Rows.Reset();
+	RowGenerations.Reset();
+	WordsPerRow = 1;
+}
+
+int32 FSeinEntityTagBitIndex::AssignBit(const FGameplayTag& Tag)
+{
+	if (const int32* Existing = BitByTag.Find(Tag))
+	{
+		return *Existing;
+	}
+	const int32 Bit = TagByBit.Add(Tag);
+	BitByTag.Add(Tag, Bit);
+	if (Bit >= WordsPerRow * 64)
+	{
+		Widen(WordsPerRow * 2);
+	}
+	return Bit;
+}
+
+void FSeinEntityTagBitIndex::Widen(int32 NewWordsPerRow)
+{
+	// Rare (the tag vocabulary is small and fixed per game); restride every
+	// row so the flat layout stays one contiguous block.
+	const int32 NumRows = RowGenerations.Num();
+	TArray<uint64> Widened;
+	Widened.SetNumZeroed(NumRows * NewWordsPerRow);
+	for (int32 Row = 0; Row < NumRows; ++Row)
+	{
+		FMemory::Memcpy(
+			Widened.GetData() + Row * NewWordsPerRow,
+			Rows.GetData() + Row * WordsPerRow,
+			WordsPerRow * sizeof(uint64));
+	}
+	Rows = MoveTemp(Widened);
+	WordsPerRow = NewWordsPerRow;
+}
+
+void FSeinEntityTagBitIndex::SetEntityTags(
+	FSeinEntityHandle Handle,
+	const FGameplayTagContainer& PresentTags)
+{
+	if (Handle.Index < 0)
+	{
+		return;
+	}
+	if (PresentTags.IsEmpty())
+	{
+		ClearEntity(Handle);
+		return;
+	}
+
+	// Assign first so any widening happens before the row pointer is taken.
+	// GetGameplayTagParents returns the explicit tags plus every parent.
+	const FGameplayTagContainer Closure = PresentTags.GetGameplayTagParents();
+	TArray<int32, TInlineAllocator<16>> Bits;
+	for (const FGameplayTag& Tag : Closure)
+	{
+		Bits.Add(AssignBit(Tag));
+	}
+
+	if (Handle.Index >= RowGenerations.Num())
+	{
+		const int32 OldRows = RowGenerations.Num();
+		const int32 NumRows = Handle.Index + 1;
+		RowGenerations.SetNum(NumRows);
+		for (int32 Row = OldRows; Row < NumRows; ++Row)
+		{
+			RowGenerations[Row] = INDEX_NONE;
+		}
+		Rows.SetNumZeroed(NumRows * WordsPerRow);
+	}
+	RowGenerations[Handle.Index] = Handle.Generation;
+	uint64* Row = Rows.GetData() + Handle.Index * WordsPerRow;
+	FMemory::Memzero(Row, WordsPerRow * sizeof(uint64));
+	for (const int32 Bit : Bits)
+	{
+		SetBit(Row, Bit);
+	}
+}
+
+void FSeinEntityTagBitIndex::ClearEntity(FSeinEntityHandle Handle)
+{
+	if (!RowGenerations.IsValidIndex(Handle.Index)
+		|| RowGenerations[Handle.Index] != Handle.Generation)
+	{
+		return;
+	}
+	RowGenerations[Handle.Index] = INDEX_NONE;
+	FMemory::Memzero(
+		Rows.GetData() + Handle.Index * WordsPerRow,
+		WordsPerRow * sizeof(uint64));
+}
+
+FSeinTagBitMask FSeinEntityTagBitIndex::Compile(const FGameplayTagContainer& Tags) const
+{
+	FSeinTagBitMask Mask;
+	Mask.NumTags = Tags.Num();
+	for (const FGameplayTag& Tag : Tags)
+	{
+		const int32* Bit = BitByTag.Find(Tag);
+		if (!Bit)
+		{
+			Mask.bHasUnknownTag = true;
+			continue;
+		}
+		const int32 Word = *Bit >> 6;
+		if (Word >= Mask.Words.Num())
+		{
+			Mask.Words.SetNumZeroed(Word + 1);
+		}
+		SetBit(Mask.Words.GetData(), *Bit);
+	}
+	return Mask;
+}
+
+FSeinTagBitMask FSeinEntityTagBitIndex::Compile(const FGameplayTag& Tag) const
+{
+	FSeinTagBitMask Mask;
+	if (!Tag.IsValid())
+	{
+		return Mask;
+	}
+	Mask.NumTags = 1;
+	const int32* Bit = BitByTag.Find(Tag);
+	if (!Bit)
+	{
+		Mask.bHasUnknownTag = true;
+		return Mask;
+	}
+	Mask.Words.SetNumZeroed((*Bit >> 6) + 1);
+	SetBit(Mask.Words.GetData(), *Bit);
+	return Mask;
+}
+
+const uint64* FSeinEntityTagBitIndex::FindRow(FSeinEntityHandle Handle) const
+{
+	return RowGenerations.IsValidIndex(Handle.Index)
+			&& RowGenerations[Handle.Index] == Handle.Generation
+		? Rows.GetData() + Handle.Index * WordsPerRow
+		: nullptr;
+}
+
+bool FSeinEntityTagBitIndex::MatchesAll(
+	FSeinEntityHandle Handle,
+	const FSeinTagBitMask& Mask) const
+{
+	if (Mask.IsEmpty())
+	{
+		return true;
+	}
+	if (Mask.bHasUnknownTag)
+	{
+		return false;
+	}
+	const uint64* Row = FindRow(Handle);
+	if (!Row)
+	{
+		return false;
+	}
+	// A mask compiled before a widen is shorter than the row, never longer:
+	// its bits were all assigned when it was built.
+	uint64 Missing = 0;
+	for (int32 Word = 0; Word < Mask.Words.Num(); ++Word)
+	{
+		Missing |= Mask.Words[Word] & ~Row[Word];
+	}
+	return Missing == 0;
+}
+
+bool FSeinEntityTagBitIndex::MatchesAny(
+	FSeinEntityHandle Handle,
+	const FSeinTagBitMask& Mask) const
+{
+	const uint64* Row = FindRow(Handle);
+	if (!Row)
+	{
+		return false;
+	}
+	uint64 Hit = 0;
+	for (int32 Word = 0; Word < Mask.Words.Num(); ++Word)
+	{
+		Hit |= Mask.Words[Word] & Row[Word];
+	}
+	return Hit != 0;
+}
@@ -30,6 +30,16 @@ namespace
 		TEXT("(thread-dispatch overhead exceeds the win below a few dozen entities). Default 64."),
 		ECVF_Default);
 
+	int32 GSeinSimParallelSystems = 1;
+	FAutoConsoleVariableRef CVarSeinSimParallelSystems(
+		TEXT("Sein.Sim.ParallelSystems"),
+		GSeinSimParallelSystems,
+		TEXT("Run non-conflicting simulation systems of one tick phase concurrently.\n")
+		TEXT("  1 (default) = each compiled wave of declared, disjoint systems runs as parallel tasks.\n")
+		TEXT("  0           = every system ticks alone in canonical phase/priority/ID order.\n")
+		TEXT("Also requires Sein.Sim.Parallel. Both schedules are designed to be BIT-IDENTICAL."),
+		ECVF_Default);
+
 	int32 GSeinSimAsyncPathfinding = 1;
 	FAutoConsoleVariableRef CVarSeinSimAsyncPathfinding(
 		TEXT("Sein.Sim.AsyncPathfinding"),
@@ -55,6 +65,11 @@ int32 SeinSimParallelMinBatch()
 	return GSeinSimParallelMinBatch;
 }
 
+bool SeinSimParallelSystemsEnabled()
+{
+	return GSeinSimParallel != 0 && GSeinSimParallelSystems != 0;
+}
+
 bool SeinSimAsyncPathfindingEnabled()
 {
 	return GSeinSimAsyncPathfinding != 0;
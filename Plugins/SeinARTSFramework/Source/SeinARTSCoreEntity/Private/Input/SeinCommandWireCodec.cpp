@@ -12,7 +12,7 @@ using namespace UE::Sein::CanonicalWirePrivate;
 namespace
 {
 	constexpr uint32 CommandMagic = 0x53434D44u; // SCMD
-	constexpr uint16 CommandWireVersion = 3;
+	constexpr uint16 CommandWireVersion = 4;
 	constexpr int32 MaxIdentifierBytes = 1024;
 
 	bool WriteVector(FWireWriter& Writer, const FFixedVector& Vector)
@@ -25,6 +25,105 @@ namespace
 		return Reader.I64(Vector.X.Value) && Reader.I64(Vector.Y.Value) && Reader.I64(Vector.Z.Value);
 	}
 
+	/** Entity lists travel as varint deltas over the handle index, followed
+	 *  by a varint generation. A strictly ascending list (the shape a box
+	 *  selection produces) encodes gaps; any other order keeps its sequence
+	 *  and encodes zigzag deltas, since ActiveFocusIndex and formation slots
+	 *  are positional. */
+	constexpr uint8 EntityListAscending = 0;
+	constexpr uint8 EntityListOrdered = 1;
+	constexpr uint64 MinEntityListEntryBytes = 2;
+
+	bool IsCanonicalEntity(int64 Index, int64 Generation)
+	{
+		return (Index == 0 && Generation == 0)
+			|| (Index > 0 && Index <= MAX_int32
+				&& Generation > 0 && Generation <= MAX_int32);
+	}
+
+	bool IsStrictlyAscending(TConstArrayView<FSeinEntityHandle> Entities)
+	{
+		int64 Previous = -1;
+		for (const FSeinEntityHandle& Entity : Entities)
+		{
+			if (Entity.Index <= Previous) return false;
+			Previous = Entity.Index;
+		}
+		return true;
+	}
+
+	bool WriteEntityList(
+		FWireWriter& Writer,
+		TConstArrayView<FSeinEntityHandle> Entities)
+	{
+		const bool bAscending = IsStrictlyAscending(Entities);
+		if (!Writer.U32(static_cast<uint32>(Entities.Num()))
+			|| !Writer.U8(bAscending ? EntityListAscending : EntityListOrdered))
+		{
+			return false;
+		}
+		int64 Previous = bAscending ? -1 : 0;
+		for (const FSeinEntityHandle& Entity : Entities)
+		{
+			if (!IsCanonicalEntity(Entity.Index, Entity.Generation))
+			{
+				return Writer.Fail(
+					TEXT("non-canonical entity handle on wire encode"));
+			}
+			const int64 Delta = Entity.Index - Previous;
+			const uint32 Encoded = bAscending
+				? static_cast<uint32>(Delta - 1)
+				: static_cast<uint32>(Delta >= 0 ? Delta * 2 : -Delta * 2 - 1);
+			if (!Writer.VarU32(Encoded)
+				|| !Writer.VarU32(static_cast<uint32>(Entity.Generation)))
+			{
+				return false;
+			}
+			Previous = Entity.Index;
+		}
+		return true;
+	}
+
+	bool ReadEntityList(
+		FWireReader& Reader,
+		TArray<FSeinEntityHandle>& OutEntities)
+	{
+		uint8 Mode = 0;
+		if (!Reader.U8(Mode) || Mode > EntityListOrdered)
+		{
+			return Reader.Fail(TEXT("invalid opaque command entity-list mode"));
+		}
+		int64 Previous = Mode == EntityListAscending ? -1 : 0;
+		for (FSeinEntityHandle& Entity : OutEntities)
+		{
+			uint32 Encoded = 0;
+			uint32 Generation = 0;
+			if (!Reader.VarU32(Encoded) || !Reader.VarU32(Generation))
+			{
+				return false;
+			}
+			const int64 Index = Mode == EntityListAscending
+				? Previous + 1 + static_cast<int64>(Encoded)
+				: Previous + ((Encoded & 1u)
+					? -static_cast<int64>(Encoded >> 1) - 1
+					: static_cast<int64>(Encoded >> 1));
+			if (!IsCanonicalEntity(Index, Generation))
+			{
+				return Reader.Fail(
+					TEXT("non-canonical entity handle on wire decode"));
+			}
+			Entity = FSeinEntityHandle(
+				static_cast<int32>(Index), static_cast<int32>(Generation));
+			Previous = Index;
+		}
+		if (Mode == EntityListOrdered && IsStrictlyAscending(OutEntities))
+		{
+			return Reader.Fail(
+				TEXT("ascending entity list uses the ordered wire form"));
+		}
+		return true;
+	}
+
 	int32 PayloadWireByteLimit(const FSeinCommandSchemaDescriptor& Schema)
 	{
 		const int64 FramingAllowance =
@@ -164,19 +263,11 @@ bool FSeinCommandWireCodec::EncodeWithCost(
 	}
 	if (!Writer.I64(Command.AuxA.Value)
 		|| !Writer.I64(Command.AuxB.Value)
-		|| !Writer.U32(static_cast<uint32>(Command.EntityList.Num())))
+		|| !WriteEntityList(Writer, Command.EntityList))
 	{
 		OutBytes.Reset();
 		return false;
 	}
-	for (const FSeinEntityHandle& Entity : Command.EntityList)
-	{
-		if (!WriteEntity(Writer, Entity))
-		{
-			OutBytes.Reset();
-			return false;
-		}
-	}
 	if (!Writer.I32(Command.ActiveFocusIndex)
 		|| !Writer.U8(Schema.PayloadStruct ? 1 : 0)
 		|| !Writer.U32(static_cast<uint32>(PayloadBytes.Num()))
@@ -319,7 +410,8 @@ bool FSeinCommandWireCodec::DecodeWithCost(
 		|| !Reader.I64(Candidate.AuxB.Value)
 		|| !Reader.U32(EntityCount)
 		|| EntityCount > static_cast<uint32>(FMath::Max(0, Schema.MaxEntityListEntries))
-		|| static_cast<uint64>(EntityCount) * 8u > static_cast<uint64>(Reader.Remaining())
+		|| static_cast<uint64>(EntityCount) * MinEntityListEntryBytes
+			> static_cast<uint64>(Reader.Remaining())
 		|| !ChargeAllocation(static_cast<uint64>(EntityCount) * sizeof(FSeinEntityHandle)))
 	{
 		if (OutError.IsEmpty())
@@ -327,10 +419,7 @@ bool FSeinCommandWireCodec::DecodeWithCost(
 		return false;
 	}
 	Candidate.EntityList.SetNum(static_cast<int32>(EntityCount));
-	for (FSeinEntityHandle& Entity : Candidate.EntityList)
-	{
-		if (!ReadEntity(Reader, Entity)) return false;
-	}
+	if (!ReadEntityList(Reader, Candidate.EntityList)) return false;
 
 	uint8 bHasPayload = 0;
 	uint32 PayloadBytes = 0;
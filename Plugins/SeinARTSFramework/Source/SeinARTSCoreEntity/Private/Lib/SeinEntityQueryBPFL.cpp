@@ -8,6 +8,7 @@
 #include "Engine/World.h"
 #include "Simulation/SeinWorldSubsystem.h"
 #include "Core/SeinEntityPool.h"
+#include "Core/SeinEntitySpatialIndex.h"
 
 USeinWorldSubsystem* USeinEntityQueryBPFL::GetWorldSubsystem(const UObject* WorldContextObject)
 {
@@ -25,8 +26,14 @@ TArray<FSeinEntityHandle> USeinEntityQueryBPFL::SeinGetEntitiesInRange(const UOb
 	const FFixedPoint RadiusSq = Radius * Radius;
 	const FSeinEntityPool& Pool = Subsystem->GetEntityPool();
 
-	Pool.ForEachEntity([&](FSeinEntityHandle Handle, const FSeinEntity& Entity)
+	// Cell candidates arrive in slot order, so filtering them by the exact
+	// test reproduces a full ForEachEntity sweep's result and order.
+	TArray<FSeinEntityHandle> Candidates;
+	Subsystem->GetEntitySpatialIndex().GatherCandidatesInRadius(Origin, Radius, Candidates);
+	const FSeinTagBitMask FilterMask = Subsystem->CompileTagMask(FilterTags);
+	for (const FSeinEntityHandle Handle : Candidates)
 	{
+		const FSeinEntity& Entity = *Pool.Get(Handle);
 		FFixedVector Delta = Entity.Transform.GetLocation() - Origin;
 		FFixedPoint DistSq = FFixedVector::DotProduct(Delta, Delta);
 		if (DistSq <= RadiusSq)
@@ -37,13 +44,13 @@ TArray<FSeinEntityHandle> USeinEntityQueryBPFL::SeinGetEntitiesInRange(const UOb
 			}
 			else
 			{
-				if (Subsystem->HasAnyTag(Handle, FilterTags))
+				if (Subsystem->EntityMatchesAnyTag(Handle, FilterMask))
 				{
 					Result.Add(Handle);
 				}
 			}
 		}
-	});
+	}
 
 	return Result;
 }
@@ -58,8 +65,13 @@ FSeinEntityHandle USeinEntityQueryBPFL::SeinGetNearestEntity(const UObject* Worl
 	FSeinEntityHandle NearestHandle = FSeinEntityHandle::Invalid();
 	FFixedPoint NearestDistSq = RadiusSq + FFixedPoint::One;
 
-	Pool.ForEachEntity([&](FSeinEntityHandle Handle, const FSeinEntity& Entity)
+	// Slot-ordered candidates keep the sweep's first-wins tie-break.
+	TArray<FSeinEntityHandle> Candidates;
+	Subsystem->GetEntitySpatialIndex().GatherCandidatesInRadius(Origin, Radius, Candidates);
+	const FSeinTagBitMask FilterMask = Subsystem->CompileTagMask(FilterTags);
+	for (const FSeinEntityHandle Handle : Candidates)
 	{
+		const FSeinEntity& Entity = *Pool.Get(Handle);
 		FFixedVector Delta = Entity.Transform.GetLocation() - Origin;
 		FFixedPoint DistSq = FFixedVector::DotProduct(Delta, Delta);
 		if (DistSq <= RadiusSq && DistSq < NearestDistSq)
@@ -71,14 +83,14 @@ FSeinEntityHandle USeinEntityQueryBPFL::SeinGetNearestEntity(const UObject* Worl
 			}
 			else
 			{
-				if (Subsystem->HasAnyTag(Handle, FilterTags))
+				if (Subsystem->EntityMatchesAnyTag(Handle, FilterMask))
 				{
 					NearestHandle = Handle;
 					NearestDistSq = DistSq;
 				}
 			}
 		}
-	});
+	}
 
 	return NearestHandle;
 }
@@ -91,9 +103,12 @@ TArray<FSeinEntityHandle> USeinEntityQueryBPFL::SeinGetEntitiesInBox(const UObje
 
 	const FSeinEntityPool& Pool = Subsystem->GetEntityPool();
 
-	Pool.ForEachEntity([&](FSeinEntityHandle Handle, const FSeinEntity& Entity)
+	TArray<FSeinEntityHandle> Candidates;
+	Subsystem->GetEntitySpatialIndex().GatherCandidatesInBox(Min, Max, Candidates);
+	const FSeinTagBitMask FilterMask = Subsystem->CompileTagMask(FilterTags);
+	for (const FSeinEntityHandle Handle : Candidates)
 	{
-		FFixedVector Loc = Entity.Transform.GetLocation();
+		FFixedVector Loc = Pool.Get(Handle)->Transform.GetLocation();
 		if (Loc.X >= Min.X && Loc.X <= Max.X &&
 			Loc.Y >= Min.Y && Loc.Y <= Max.Y &&
 			Loc.Z >= Min.Z && Loc.Z <= Max.Z)
@@ -104,13 +119,13 @@ TArray<FSeinEntityHandle> USeinEntityQueryBPFL::SeinGetEntitiesInBox(const UObje
 			}
 			else
 			{
-				if (Subsystem->HasAnyTag(Handle, FilterTags))
+				if (Subsystem->EntityMatchesAnyTag(Handle, FilterMask))
 				{
 					Result.Add(Handle);
 				}
 			}
 		}
-	});
+	}
 
 	return Result;
 }
@@ -212,6 +212,7 @@ bool USeinResourceBPFL::SeinDeduct(const UObject* WorldContextObject, FSeinPlaye
 			Current = Current - Entry.Value;
 		}
 	}
+	Subsystem->MarkPlayerStatePresentationDirty(PlayerID);
 	return true;
 }
 
@@ -246,6 +247,7 @@ void USeinResourceBPFL::SeinRefund(const UObject* WorldContextObject, FSeinPlaye
 			SeinResourceInternal::AddWithCap(*State, Entry.Key, Entry.Value);
 		}
 	}
+	Subsystem->MarkPlayerStatePresentationDirty(PlayerID);
 }
 
 bool USeinResourceBPFL::SeinTryReverseDeduction(
@@ -301,6 +303,7 @@ bool USeinResourceBPFL::SeinTryReverseDeduction(
 			? Current - Entry.Value
 			: Current + Entry.Value;
 	}
+	Subsystem->MarkPlayerStatePresentationDirty(PlayerID);
 	return true;
 }
 
@@ -323,6 +326,7 @@ void USeinResourceBPFL::SeinGrantIncome(const UObject* WorldContextObject, FSein
 	{
 		SeinResourceInternal::AddWithCap(*State, Entry.Key, Entry.Value);
 	}
+	Subsystem->MarkPlayerStatePresentationDirty(PlayerID);
 }
 
 bool USeinResourceBPFL::SeinTransfer(const UObject* WorldContextObject, FSeinPlayerID FromPlayer, FSeinPlayerID ToPlayer, const FSeinResourceCost& Amount)
@@ -360,5 +364,7 @@ bool USeinResourceBPFL::SeinTransfer(const UObject* WorldContextObject, FSeinPla
 
 		SeinResourceInternal::AddWithCap(*ToState, Entry.Key, Entry.Value);
 	}
+	Subsystem->MarkPlayerStatePresentationDirty(FromPlayer);
+	Subsystem->MarkPlayerStatePresentationDirty(ToPlayer);
 	return true;
 }
@@ -36,6 +36,7 @@
 #include "Simulation/SeinWorldSubsystem.h"
 #include "Serialization/SeinCanonicalStateCodec.h"
 #include "Serialization/SeinCollisionCanonicalStateProvider.h"
+#include "Serialization/SeinReflectedStructPlan.h"
 #include "Subsystems/SeinFactionService.h"
 #include "Tags/SeinARTSGameplayTags.h"
 
@@ -542,6 +543,8 @@ bool FSeinARTSCoreEntity::ValidateConfiguredCanonicalStateRecipes(
 
 void FSeinARTSCoreEntity::StartupModule()
 {
+	FSeinReflectedStructPlan::StartInvalidationTracking();
+
 	PoolObjectCodecHandles.Reset();
 	FString PoolCodecError;
 	if (!RegisterBuiltInPoolObjectCodecs(
@@ -728,4 +731,5 @@ void FSeinARTSCoreEntity::ShutdownModule()
 	SimulationContentRegistrationHandle.Reset();
 	ReleaseBuiltInSchemas(BuiltInCommandSchemaHandles);
 	bBuiltInCommandSchemasReady = false;
+	FSeinReflectedStructPlan::StopInvalidationTracking();
 }
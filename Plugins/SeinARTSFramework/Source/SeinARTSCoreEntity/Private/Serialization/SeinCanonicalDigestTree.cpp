@@ -5,15 +5,60 @@
 
 #include "Serialization/SeinCanonicalDigestTree.h"
 
+#include "Core/SeinParallel.h"
+#include "Hash/Blake3.h"
 #include "Serialization/SeinCanonicalInitialStateDigest.h"
 
 namespace
 {
+	/** Parents hashed per SeinParallelFor body. Fixed, so a level's batch
+	 *  boundaries depend only on its dirty set, never on core count. */
+	constexpr int32 ParentBatchSize = 32;
+
+	/** Node index (int32) plus the left and right child GUIDs. */
+	constexpr int32 ParentSuffixBytes = 4 + 16 + 16;
+
 	bool Fail(FString& OutError, const FString& Message)
 	{
 		OutError = Message;
 		return false;
 	}
+
+	void WriteUInt32BigEndian(uint8* Out, uint32 Value)
+	{
+		Out[0] = static_cast<uint8>(Value >> 24);
+		Out[1] = static_cast<uint8>(Value >> 16);
+		Out[2] = static_cast<uint8>(Value >> 8);
+		Out[3] = static_cast<uint8>(Value);
+	}
+
+	uint32 ReadUInt32BigEndian(const uint8* Bytes)
+	{
+		return (static_cast<uint32>(Bytes[0]) << 24)
+			| (static_cast<uint32>(Bytes[1]) << 16)
+			| (static_cast<uint32>(Bytes[2]) << 8)
+			| static_cast<uint32>(Bytes[3]);
+	}
+
+	void WriteGuidBigEndian(uint8* Out, const FGuid& Value)
+	{
+		WriteUInt32BigEndian(Out, Value.A);
+		WriteUInt32BigEndian(Out + 4, Value.B);
+		WriteUInt32BigEndian(Out + 8, Value.C);
+		WriteUInt32BigEndian(Out + 12, Value.D);
+	}
+
+	/** FSeinCanonicalDigestWriter::WriteString framing. */
+	void AppendCanonicalString(TArray<uint8>& Out, const FString& Value)
+	{
+		const FTCHARToUTF8 Utf8(*Value, Value.Len());
+		const uint64 Length = static_cast<uint64>(Utf8.Length());
+		WriteUInt32BigEndian(
+			&Out[Out.AddUninitialized(4)], static_cast<uint32>(Length >> 32));
+		WriteUInt32BigEndian(
+			&Out[Out.AddUninitialized(4)], static_cast<uint32>(Length));
+		Out.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+	}
 }
 
 bool FSeinCanonicalDigestTree::Reset(
@@ -24,6 +69,7 @@ bool FSeinCanonicalDigestTree::Reset(
 	OutError.Reset();
 	RootDigest.Invalidate();
 	bHasPendingUpdates = false;
+	PendingParents.Reset();
 	if (InStableDomain.IsEmpty() || LogicalLeafCount < 0)
 	{
 		return Fail(
@@ -60,28 +106,27 @@ bool FSeinCanonicalDigestTree::Reset(
 		return false;
 	}
 
+	// Everything a "SeinARTS.LiveWorld.Merkle.Parent" v1 writer emits before
+	// the node index: domain string, format version, stable domain. Only the
+	// index and child GUIDs vary per node, so batches patch a copy in place.
+	ParentPrefix.Reset();
+	AppendCanonicalString(ParentPrefix, TEXT("SeinARTS.LiveWorld.Merkle.Parent"));
+	WriteUInt32BigEndian(&ParentPrefix[ParentPrefix.AddUninitialized(4)], 1);
+	AppendCanonicalString(ParentPrefix, StableDomain);
+
 	Nodes.Init(FGuid(), LeafBase * 2);
-	DirtyNodes.Init(false, Nodes.Num());
+	DirtyNodes.Init(false, LeafBase);
 	for (int32 Index = LeafBase; Index < Nodes.Num(); ++Index)
 	{
 		Nodes[Index] = EmptyLeafDigest;
 	}
-	for (int32 NodeIndex = LeafBase - 1; NodeIndex >= 1; --NodeIndex)
+	TArray<int32> Level;
+	Level.Reserve(LeafBase / 2);
+	for (int32 NodeIndex = LeafBase / 2; NodeIndex < LeafBase; ++NodeIndex)
 	{
-		if (!ComputeNodeDigest(NodeIndex, Nodes[NodeIndex], OutError))
-		{
-			RootDigest.Invalidate();
-			return false;
-		}
+		Level.Add(NodeIndex);
 	}
-
-	FSeinCanonicalDigestWriter RootWriter(
-		TEXT("SeinARTS.LiveWorld.Merkle.Root"), 1);
-	if (!RootWriter.WriteString(StableDomain)
-		|| !RootWriter.WriteInt32(LeafCount)
-		|| !RootWriter.WriteInt32(LeafBase)
-		|| !RootWriter.WriteGuid(Nodes[1])
-		|| !RootWriter.Finalize(RootDigest, OutError))
+	if (!HashDirtyLevels(Level, false, OutError) || !SealRoot(OutError))
 	{
 		RootDigest.Invalidate();
 		return false;
@@ -112,20 +157,36 @@ bool FSeinCanonicalDigestTree::SetLeafDigest(
 		return true;
 	}
 	Nodes[NodeIndex] = Candidate;
-	for (int32 Parent = NodeIndex / 2; Parent >= 1; Parent /= 2)
+	// A single-leaf tree has no parents; the root seals over the leaf itself.
+	const int32 Parent = NodeIndex / 2;
+	if (Parent >= 1 && !DirtyNodes[Parent])
 	{
 		DirtyNodes[Parent] = true;
-		if (Parent == 1)
-		{
-			break;
-		}
+		PendingParents.Add(Parent);
 	}
 	bHasPendingUpdates = true;
 	return true;
 }
 
-bool FSeinCanonicalDigestTree::FinalizeUpdates(FString& OutError)
+bool FSeinCanonicalDigestTree::GetNodeDigest(
+	int32 NodeIndex,
+	FGuid& OutDigest) const
+{
+	OutDigest.Invalidate();
+	if (bHasPendingUpdates || !RootDigest.IsValid()
+		|| NodeIndex < 1 || NodeIndex >= Nodes.Num())
+	{
+		return false;
+	}
+	OutDigest = Nodes[NodeIndex];
+	return true;
+}
+
+bool FSeinCanonicalDigestTree::FinalizeUpdates(
+	FString& OutError,
+	bool bForceSerial)
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(Sein_CanonicalDigestTree_Finalize);
 	OutError.Reset();
 	if (!bHasPendingUpdates)
 	{
@@ -134,27 +195,17 @@ bool FSeinCanonicalDigestTree::FinalizeUpdates(FString& OutError)
 			: Fail(OutError, TEXT("Canonical digest tree has no sealed root."));
 	}
 
-	for (int32 NodeIndex = LeafBase - 1; NodeIndex >= 1; --NodeIndex)
+	// Leaf-parents queue in SetLeafDigest order; the level walk wants them
+	// ascending so each parent level can be derived by adjacent dedupe.
+	TArray<int32> Level = MoveTemp(PendingParents);
+	PendingParents.Reset();
+	Level.Sort();
+	for (const int32 NodeIndex : Level)
 	{
-		if (!DirtyNodes[NodeIndex])
-		{
-			continue;
-		}
-		if (!ComputeNodeDigest(NodeIndex, Nodes[NodeIndex], OutError))
-		{
-			RootDigest.Invalidate();
-			return false;
-		}
 		DirtyNodes[NodeIndex] = false;
 	}
-
-	FSeinCanonicalDigestWriter RootWriter(
-		TEXT("SeinARTS.LiveWorld.Merkle.Root"), 1);
-	if (!RootWriter.WriteString(StableDomain)
-		|| !RootWriter.WriteInt32(LeafCount)
-		|| !RootWriter.WriteInt32(LeafBase)
-		|| !RootWriter.WriteGuid(Nodes[1])
-		|| !RootWriter.Finalize(RootDigest, OutError))
+	if (!HashDirtyLevels(Level, bForceSerial, OutError)
+		|| !SealRoot(OutError))
 	{
 		RootDigest.Invalidate();
 		return false;
@@ -163,25 +214,106 @@ bool FSeinCanonicalDigestTree::FinalizeUpdates(FString& OutError)
 	return true;
 }
 
-bool FSeinCanonicalDigestTree::ComputeNodeDigest(
-	int32 NodeIndex,
-	FGuid& OutDigest,
-	FString& OutError) const
+bool FSeinCanonicalDigestTree::HashDirtyLevels(
+	TArray<int32>& Level,
+	bool bForceSerial,
+	FString& OutError)
 {
-	const int32 Left = NodeIndex * 2;
-	const int32 Right = Left + 1;
-	if (NodeIndex <= 0 || Right >= Nodes.Num())
+	TArray<FString> BatchErrors;
+	while (Level.Num() > 0)
 	{
-		return Fail(
-			OutError,
-			TEXT("Canonical digest tree encountered an invalid parent node."));
+		const int32 BatchCount =
+			(Level.Num() + ParentBatchSize - 1) / ParentBatchSize;
+		BatchErrors.Reset();
+		BatchErrors.SetNum(BatchCount);
+		const TConstArrayView<int32> LevelView(Level);
+		SeinParallelFor(BatchCount, [this, LevelView, &BatchErrors](int32 Batch)
+		{
+			const int32 First = Batch * ParentBatchSize;
+			const int32 Count =
+				FMath::Min(ParentBatchSize, LevelView.Num() - First);
+			HashParentBatch(LevelView.Slice(First, Count), BatchErrors[Batch]);
+		}, bForceSerial);
+		for (FString& BatchError : BatchErrors)
+		{
+			if (!BatchError.IsEmpty())
+			{
+				OutError = MoveTemp(BatchError);
+				return false;
+			}
+		}
+		if (Level[0] == 1)
+		{
+			break;
+		}
+
+		// Ascending same-level indices have non-decreasing parents.
+		int32 NextNum = 0;
+		for (int32 Index = 0; Index < Level.Num(); ++Index)
+		{
+			const int32 Parent = Level[Index] / 2;
+			if (NextNum == 0 || Level[NextNum - 1] != Parent)
+			{
+				Level[NextNum++] = Parent;
+			}
+		}
+		Level.SetNum(NextNum, EAllowShrinking::No);
+	}
+	return true;
+}
+
+bool FSeinCanonicalDigestTree::HashParentBatch(
+	TConstArrayView<int32> NodeIndices,
+	FString& OutError)
+{
+	// One scratch stream per batch: the prefix is copied once and only the
+	// 36-byte index/child suffix is rewritten for each node.
+	const int32 PrefixBytes = ParentPrefix.Num();
+	TArray<uint8, TInlineAllocator<192>> Message;
+	Message.SetNumUninitialized(PrefixBytes + ParentSuffixBytes);
+	FMemory::Memcpy(Message.GetData(), ParentPrefix.GetData(), PrefixBytes);
+	uint8* Suffix = Message.GetData() + PrefixBytes;
+
+	for (const int32 NodeIndex : NodeIndices)
+	{
+		const int32 Left = NodeIndex * 2;
+		const int32 Right = Left + 1;
+		if (NodeIndex <= 0 || Right >= Nodes.Num())
+		{
+			return Fail(
+				OutError,
+				TEXT("Canonical digest tree encountered an invalid parent node."));
+		}
+
+		WriteUInt32BigEndian(Suffix, BitCast<uint32>(NodeIndex));
+		WriteGuidBigEndian(Suffix + 4, Nodes[Left]);
+		WriteGuidBigEndian(Suffix + 20, Nodes[Right]);
+		const FBlake3Hash Hash =
+			FBlake3::HashBuffer(Message.GetData(), Message.Num());
+		const uint8* HashBytes = Hash.GetBytes();
+		const FGuid Digest(
+			ReadUInt32BigEndian(HashBytes),
+			ReadUInt32BigEndian(HashBytes + 4),
+			ReadUInt32BigEndian(HashBytes + 8),
+			ReadUInt32BigEndian(HashBytes + 12));
+		if (!Digest.IsValid())
+		{
+			return Fail(
+				OutError,
+				TEXT("Canonical digest unexpectedly produced the invalid GUID sentinel."));
+		}
+		Nodes[NodeIndex] = Digest;
 	}
+	return true;
+}
 
-	FSeinCanonicalDigestWriter Writer(
-		TEXT("SeinARTS.LiveWorld.Merkle.Parent"), 1);
-	return Writer.WriteString(StableDomain)
-		&& Writer.WriteInt32(NodeIndex)
-		&& Writer.WriteGuid(Nodes[Left])
-		&& Writer.WriteGuid(Nodes[Right])
-		&& Writer.Finalize(OutDigest, OutError);
+bool FSeinCanonicalDigestTree::SealRoot(FString& OutError)
+{
+	FSeinCanonicalDigestWriter RootWriter(
+		TEXT("SeinARTS.LiveWorld.Merkle.Root"), 1);
+	return RootWriter.WriteString(StableDomain)
+		&& RootWriter.WriteInt32(LeafCount)
+		&& RootWriter.WriteInt32(LeafBase)
+		&& RootWriter.WriteGuid(Nodes[1])
+		&& RootWriter.Finalize(RootDigest, OutError);
 }
@@ -4,6 +4,7 @@
 #include "GameplayTagContainer.h"
 #include "Serialization/SeinCanonicalInitialStateDigest.h"
 #include "Serialization/SeinCanonicalStatePropertyPolicy.h"
+#include "Serialization/SeinReflectedStructPlan.h"
 #include "StructUtils/InstancedStruct.h"
 #include "UObject/Class.h"
 #include "UObject/SoftObjectPath.h"
@@ -29,20 +30,97 @@ namespace
 		return Result;
 	}
 
-	FString PropertyOwnerPath(const FProperty& Property)
+	/**
+	 * Diagnostic field path, rendered only when a projection fails. Each
+	 * segment lives on the stack of the walk that entered it, so a successful
+	 * projection never builds path text.
+	 */
+	struct FFieldPath
 	{
-		const UStruct* Owner = Property.GetOwnerStruct();
-		return Owner ? Owner->GetPathName() : FString();
-	}
+		enum class ESegment : uint8
+		{
+			Root,
+			Property,
+			Element,
+			UnorderedEntry,
+			Suffix,
+		};
 
-	FString ChildPath(
-		const FString& Parent,
-		const FProperty& Property)
-	{
-		return Parent.IsEmpty()
-			? Property.GetName()
-			: Parent + TEXT(".") + Property.GetName();
-	}
+		static FFieldPath Root(const FString& Text)
+		{
+			FFieldPath Path;
+			Path.Segment = ESegment::Root;
+			Path.RootText = &Text;
+			return Path;
+		}
+
+		static FFieldPath Child(const FFieldPath& Parent, const FProperty& Property)
+		{
+			FFieldPath Path;
+			Path.Parent = &Parent;
+			Path.Segment = ESegment::Property;
+			Path.Property = &Property;
+			return Path;
+		}
+
+		static FFieldPath Element(const FFieldPath& Parent, const int32 Index)
+		{
+			FFieldPath Path;
+			Path.Parent = &Parent;
+			Path.Segment = ESegment::Element;
+			Path.Index = Index;
+			return Path;
+		}
+
+		static FFieldPath UnorderedEntry(const FFieldPath& Parent, const int32 Index)
+		{
+			FFieldPath Path;
+			Path.Parent = &Parent;
+			Path.Segment = ESegment::UnorderedEntry;
+			Path.Index = Index;
+			return Path;
+		}
+
+		static FFieldPath Suffixed(const FFieldPath& Parent, const TCHAR* Suffix)
+		{
+			FFieldPath Path;
+			Path.Parent = &Parent;
+			Path.Segment = ESegment::Suffix;
+			Path.Suffix = Suffix;
+			return Path;
+		}
+
+		FString ToString() const
+		{
+			FString Text = Parent ? Parent->ToString() : FString();
+			switch (Segment)
+			{
+			case ESegment::Root:
+				return RootText ? *RootText : FString();
+			case ESegment::Property:
+				return Text.IsEmpty()
+					? Property->GetName()
+					: Text + TEXT(".") + Property->GetName();
+			case ESegment::Element:
+				Text.Appendf(TEXT("[%d]"), Index);
+				return Text;
+			case ESegment::UnorderedEntry:
+				Text.Appendf(TEXT("{%d}"), Index);
+				return Text;
+			case ESegment::Suffix:
+				Text += Suffix;
+				return Text;
+			}
+			return Text;
+		}
+
+		const FFieldPath* Parent = nullptr;
+		const FString* RootText = nullptr;
+		const FProperty* Property = nullptr;
+		const TCHAR* Suffix = nullptr;
+		int32 Index = 0;
+		ESegment Segment = ESegment::Root;
+	};
 
 	bool GuidLess(const FGuid& A, const FGuid& B)
 	{
@@ -52,14 +130,6 @@ namespace
 		return A.D < B.D;
 	}
 
-	bool IsUnsignedNumeric(const FNumericProperty& Numeric)
-	{
-		return Numeric.IsA<FByteProperty>()
-			|| Numeric.IsA<FUInt16Property>()
-			|| Numeric.IsA<FUInt32Property>()
-			|| Numeric.IsA<FUInt64Property>();
-	}
-
 	FString NumericTypeName(const FNumericProperty& Numeric)
 	{
 		if (Numeric.IsA<FByteProperty>()) return TEXT("UInt8");
@@ -79,34 +149,35 @@ namespace
 			Property);
 	}
 
-	void GatherCanonicalProperties(
-		const UStruct* Type,
-		TArray<const FProperty*>& OutProperties)
+	/** Canonical bits of a compiled Integer or Enum op: sign- or zero-extended
+	 *  exactly as FNumericProperty's Get(Un)SignedIntPropertyValue would. */
+	uint64 ReadIntegerBits(
+		const FSeinReflectedValueOp& Op,
+		const void* ValuePtr)
 	{
-		OutProperties.Reset();
-		if (!Type)
-		{
-			return;
-		}
-		for (TFieldIterator<FProperty> It(
-			Type, EFieldIterationFlags::IncludeSuper); It; ++It)
-		{
-			if (!ShouldSkipProperty(**It))
-			{
-				OutProperties.Add(*It);
-			}
+		switch (Op.IntegerBytes)
+		{
+		case 1:
+			return Op.bSignedInteger
+				? static_cast<uint64>(static_cast<int64>(
+					*static_cast<const int8*>(ValuePtr)))
+				: *static_cast<const uint8*>(ValuePtr);
+		case 2:
+			return Op.bSignedInteger
+				? static_cast<uint64>(static_cast<int64>(
+					*static_cast<const int16*>(ValuePtr)))
+				: *static_cast<const uint16*>(ValuePtr);
+		case 4:
+			return Op.bSignedInteger
+				? static_cast<uint64>(static_cast<int64>(
+					*static_cast<const int32*>(ValuePtr)))
+				: *static_cast<const uint32*>(ValuePtr);
+		case 8:
+			return *static_cast<const uint64*>(ValuePtr);
+		default:
+			checkNoEntry();
+			return 0;
 		}
-		OutProperties.Sort([](const FProperty& A, const FProperty& B)
-		{
-			const int32 OwnerOrder = PropertyOwnerPath(A).Compare(
-				PropertyOwnerPath(B), ESearchCase::CaseSensitive);
-			if (OwnerOrder != 0)
-			{
-				return OwnerOrder < 0;
-			}
-			return A.GetName().Compare(
-				B.GetName(), ESearchCase::CaseSensitive) < 0;
-		});
 	}
 
 	struct FProjectionContext
@@ -133,44 +204,36 @@ namespace
 		TArray<const UObject*> ObjectStack;
 		TMap<const UObject*, uint32> ObjectEncounterIDs;
 		TMap<const UStruct*, FGuid> SchemaDigests;
-		/** A value sequence can visit the same reflected struct hundreds of times.
-		 *  Freeze its already-filtered canonical property order once per projection
-		 *  instead of re-walking and path-sorting the identical metadata for every
-		 *  component instance. Results are copied out because recursive projection
-		 *  may grow this TMap and invalidate references to its value storage. */
-		TMap<const UStruct*, TArray<const FProperty*>> CanonicalProperties;
+		/** Compiled plans pinned for this projection. A value sequence visits the
+		 *  same nested types hundreds of times; resolving each once here keeps
+		 *  the process-wide cache lock off the per-value path. */
+		TMap<const UStruct*, TSharedRef<const FSeinReflectedStructPlan>> Plans;
 		TArray<const UStruct*> SchemaStack;
 
-		void GetCanonicalProperties(
-			const UStruct* Type,
-			TArray<const FProperty*>& OutProperties)
+		const FSeinReflectedStructPlan& GetPlan(const UStruct& Type)
 		{
-			if (const TArray<const FProperty*>* Existing =
-				CanonicalProperties.Find(Type))
+			if (const TSharedRef<const FSeinReflectedStructPlan>* Existing =
+				Plans.Find(&Type))
 			{
-				OutProperties = *Existing;
-				return;
+				return Existing->Get();
 			}
-
-			TArray<const FProperty*> Frozen;
-			GatherCanonicalProperties(Type, Frozen);
-			CanonicalProperties.Add(Type, Frozen);
-			OutProperties = MoveTemp(Frozen);
+			return Plans.Add(&Type, FSeinReflectedStructPlan::Get(Type)).Get();
 		}
 
-		bool Fail(const FString& FieldPath, const FString& Message)
+		bool Fail(const FFieldPath& FieldPath, const FString& Message)
 		{
 			if (Error.IsEmpty())
 			{
-				Error = FieldPath.IsEmpty()
+				const FString Path = FieldPath.ToString();
+				Error = Path.IsEmpty()
 					? Message
 					: FString::Printf(
-						TEXT("%s: %s"), *FieldPath, *Message);
+						TEXT("%s: %s"), *Path, *Message);
 			}
 			return false;
 		}
 
-		bool CheckDepth(const int32 Depth, const FString& FieldPath)
+		bool CheckDepth(const int32 Depth, const FFieldPath& FieldPath)
 		{
 			if (Depth < 0 || Depth > Limits.MaxRecursionDepth)
 			{
@@ -181,7 +244,7 @@ namespace
 			return true;
 		}
 
-		bool AddElements(const int64 Count, const FString& FieldPath)
+		bool AddElements(const int64 Count, const FFieldPath& FieldPath)
 		{
 			if (Count < 0
 				|| Count > Limits.MaxAggregateElements
@@ -199,7 +262,7 @@ namespace
 		bool Write(
 			FSeinCanonicalDigestWriter& Writer,
 			const bool bWrote,
-			const FString& FieldPath)
+			const FFieldPath& FieldPath)
 		{
 			return bWrote
 				|| Fail(
@@ -212,7 +275,7 @@ namespace
 		bool WriteString(
 			FSeinCanonicalDigestWriter& Writer,
 			const FString& Value,
-			const FString& FieldPath)
+			const FFieldPath& FieldPath)
 		{
 			const int64 Characters = Value.Len();
 			if (Characters > Limits.MaxStringCharacters
@@ -231,7 +294,7 @@ namespace
 		bool WriteName(
 			FSeinCanonicalDigestWriter& Writer,
 			const FName Value,
-			const FString& FieldPath)
+			const FFieldPath& FieldPath)
 		{
 			const FString Text = Value.ToString();
 			const int64 Characters = Text.Len();
@@ -247,6 +310,28 @@ namespace
 			TotalStringCharacters += Characters;
 			return Write(Writer, Writer.WriteName(Value), FieldPath);
 		}
+
+		/** WriteName for a field identity the plan already rendered; the
+		 *  budget and the bytes are those WriteName would charge and emit. */
+		bool WriteFieldName(
+			FSeinCanonicalDigestWriter& Writer,
+			const FSeinReflectedFieldOp& Field,
+			const FFieldPath& FieldPath)
+		{
+			const int64 Characters = Field.NameCharacters;
+			if (Characters > Limits.MaxStringCharacters
+				|| TotalStringCharacters
+					> static_cast<int64>(
+						Limits.MaxTotalStringCharacters) - Characters)
+			{
+				return Fail(
+					FieldPath,
+					TEXT("Reflected-state name limit exceeded."));
+			}
+			TotalStringCharacters += Characters;
+			return Write(
+				Writer, Writer.WriteString(Field.CanonicalName), FieldPath);
+		}
 	};
 
 	bool WriteTypeSchema(
@@ -254,12 +339,12 @@ namespace
 		FProjectionContext& Context,
 		FSeinCanonicalDigestWriter& Writer,
 		int32 Depth,
-		const FString& FieldPath);
+		const FFieldPath& FieldPath);
 
 	bool ResolveSchemaDigest(
 		const UStruct* Type,
 		FProjectionContext& Context,
-		const FString& FieldPath,
+		const FFieldPath& FieldPath,
 		FGuid& OutDigest);
 
 	bool WritePropertySchema(
@@ -267,7 +352,7 @@ namespace
 		FProjectionContext& Context,
 		FSeinCanonicalDigestWriter& Writer,
 		const int32 Depth,
-		const FString& FieldPath)
+		const FFieldPath& FieldPath)
 	{
 		if (!Context.CheckDepth(Depth, FieldPath))
 		{
@@ -292,24 +377,24 @@ namespace
 			return Kind(TEXT("Array"))
 				&& WritePropertySchema(
 					*Array->Inner, Context, Writer, Depth + 1,
-					FieldPath + TEXT("[]"));
+					FFieldPath::Suffixed(FieldPath, TEXT("[]")));
 		}
 		if (const FSetProperty* Set = CastField<FSetProperty>(&Property))
 		{
 			return Kind(TEXT("Set"))
 				&& WritePropertySchema(
 					*Set->ElementProp, Context, Writer, Depth + 1,
-					FieldPath + TEXT("{}"));
+					FFieldPath::Suffixed(FieldPath, TEXT("{}")));
 		}
 		if (const FMapProperty* Map = CastField<FMapProperty>(&Property))
 		{
 			return Kind(TEXT("Map"))
 				&& WritePropertySchema(
 					*Map->KeyProp, Context, Writer, Depth + 1,
-					FieldPath + TEXT("{}.Key"))
+					FFieldPath::Suffixed(FieldPath, TEXT("{}.Key")))
 				&& WritePropertySchema(
 					*Map->ValueProp, Context, Writer, Depth + 1,
-					FieldPath + TEXT("{}.Value"));
+					FFieldPath::Suffixed(FieldPath, TEXT("{}.Value")));
 		}
 		if (const FOptionalProperty* Optional =
 			CastField<FOptionalProperty>(&Property))
@@ -320,7 +405,7 @@ namespace
 					Context,
 					Writer,
 					Depth + 1,
-					FieldPath + TEXT("?"));
+					FFieldPath::Suffixed(FieldPath, TEXT("?")));
 		}
 		if (Property.IsA<FBoolProperty>())
 		{
@@ -429,7 +514,7 @@ namespace
 				&& ResolveSchemaDigest(
 					Struct,
 					Context,
-					FieldPath + TEXT(".<schema>"),
+					FFieldPath::Suffixed(FieldPath, TEXT(".<schema>")),
 					NestedSchemaDigest)
 				&& Context.Write(
 					Writer,
@@ -504,43 +589,45 @@ namespace
 		FProjectionContext& Context,
 		FSeinCanonicalDigestWriter& Writer,
 		const int32 Depth,
-		const FString& FieldPath)
+		const FFieldPath& FieldPath)
 	{
 		if (!Type)
 		{
 			return Context.Fail(
 				FieldPath, TEXT("Reflected schema type is null."));
 		}
+		const FSeinReflectedStructPlan& Plan = Context.GetPlan(*Type);
 		if (!Context.CheckDepth(Depth, FieldPath)
 			|| !Context.WriteString(
-				Writer, Type->GetPathName(), FieldPath))
+				Writer, Plan.GetTypePath(), FieldPath))
 		{
 			return false;
 		}
 
-		TArray<const FProperty*> Properties;
-		Context.GetCanonicalProperties(Type, Properties);
+		const TConstArrayView<FSeinReflectedFieldOp> Fields =
+			Plan.GetFields();
 		if (!Context.Write(
 			Writer,
-			Writer.WriteUInt32(static_cast<uint32>(Properties.Num())),
+			Writer.WriteUInt32(static_cast<uint32>(Fields.Num())),
 			FieldPath))
 		{
 			return false;
 		}
-		for (const FProperty* Property : Properties)
+		for (const FSeinReflectedFieldOp& Field : Fields)
 		{
-			const FString PropertyPath =
-				ChildPath(FieldPath, *Property);
+			const FProperty& Property = *Field.Value.Property;
+			const FFieldPath PropertyPath =
+				FFieldPath::Child(FieldPath, Property);
 			if (!Context.WriteString(
-					Writer, PropertyOwnerPath(*Property), PropertyPath)
-				|| !Context.WriteName(
-					Writer, Property->GetFName(), PropertyPath)
+					Writer, Field.OwnerPath, PropertyPath)
+				|| !Context.WriteFieldName(
+					Writer, Field, PropertyPath)
 				|| !Context.Write(
 					Writer,
-					Writer.WriteInt32(Property->ArrayDim),
+					Writer.WriteInt32(Field.ArrayDim),
 					PropertyPath)
 				|| !WritePropertySchema(
-					*Property,
+					Property,
 					Context,
 					Writer,
 					Depth + 1,
@@ -555,7 +642,7 @@ namespace
 	bool ResolveSchemaDigest(
 		const UStruct* Type,
 		FProjectionContext& Context,
-		const FString& FieldPath,
+		const FFieldPath& FieldPath,
 		FGuid& OutDigest)
 	{
 		if (!Type)
@@ -609,12 +696,12 @@ namespace
 		FProjectionContext& Context,
 		FSeinCanonicalDigestWriter& Writer,
 		int32 Depth,
-		const FString& FieldPath);
+		const FFieldPath& FieldPath);
 
 	bool FinalizeChildDigest(
 		FSeinCanonicalDigestWriter& ChildWriter,
 		FProjectionContext& Context,
-		const FString& FieldPath,
+		const FFieldPath& FieldPath,
 		FGuid& OutDigest)
 	{
 		FString ChildError;
@@ -629,13 +716,39 @@ namespace
 		return true;
 	}
 
+	bool WriteUnorderedDigests(
+		TArray<FGuid>& Digests,
+		FProjectionContext& Context,
+		FSeinCanonicalDigestWriter& Writer,
+		const FFieldPath& FieldPath)
+	{
+		Digests.Sort(GuidLess);
+		if (!Context.Write(
+			Writer,
+			Writer.WriteUInt32(static_cast<uint32>(Digests.Num())),
+			FieldPath))
+		{
+			return false;
+		}
+		for (const FGuid& Digest : Digests)
+		{
+			if (!Context.Write(
+				Writer, Writer.WriteGuid(Digest), FieldPath))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
 	bool WritePropertyValue(
-		const FProperty& Property,
+		const FSeinReflectedStructPlan& Plan,
+		const FSeinReflectedValueOp& Op,
 		const void* ValuePtr,
 		FProjectionContext& Context,
 		FSeinCanonicalDigestWriter& Writer,
 		const int32 Depth,
-		const FString& FieldPath)
+		const FFieldPath& FieldPath)
 	{
 		if (!ValuePtr)
 		{
@@ -646,17 +759,20 @@ namespace
 		{
 			return false;
 		}
-		if (ShouldSkipProperty(Property))
+
+		const FProperty& Property = *Op.Property;
+		switch (Op.Kind)
 		{
+		case ESeinReflectedValueKind::Skipped:
 			return Context.Fail(
 				FieldPath,
 				TEXT("A skipped presentation/transient field reached value encoding."));
-		}
 
-		if (const FArrayProperty* Array =
-			CastField<FArrayProperty>(&Property))
+		case ESeinReflectedValueKind::Array:
 		{
-			FScriptArrayHelper Helper(Array, ValuePtr);
+			const FSeinReflectedValueOp& Inner = Plan.GetChild(Op.FirstChild);
+			FScriptArrayHelper Helper(
+				static_cast<const FArrayProperty*>(&Property), ValuePtr);
 			if (!Context.AddElements(Helper.Num(), FieldPath)
 				|| !Context.Write(
 					Writer,
@@ -669,22 +785,25 @@ namespace
 			for (int32 Index = 0; Index < Helper.Num(); ++Index)
 			{
 				if (!WritePropertyValue(
-					*Array->Inner,
+					Plan,
+					Inner,
 					Helper.GetRawPtr(Index),
 					Context,
 					Writer,
 					Depth + 1,
-					FString::Printf(
-						TEXT("%s[%d]"), *FieldPath, Index)))
+					FFieldPath::Element(FieldPath, Index)))
 				{
 					return false;
 				}
 			}
 			return true;
 		}
-		if (const FSetProperty* Set = CastField<FSetProperty>(&Property))
+
+		case ESeinReflectedValueKind::Set:
 		{
-			FScriptSetHelper Helper(Set, ValuePtr);
+			const FSeinReflectedValueOp& Element = Plan.GetChild(Op.FirstChild);
+			FScriptSetHelper Helper(
+				static_cast<const FSetProperty*>(&Property), ValuePtr);
 			if (!Context.AddElements(Helper.Num(), FieldPath))
 			{
 				return false;
@@ -700,16 +819,17 @@ namespace
 				FSeinCanonicalDigestWriter ElementWriter(
 					TEXT("SeinARTS.ReflectedState.SetElement"),
 					ReflectedValueFormatVersion);
-				const FString ElementPath = FString::Printf(
-					TEXT("%s{%d}"), *FieldPath, Index);
+				const FFieldPath ElementPath =
+					FFieldPath::UnorderedEntry(FieldPath, Index);
 				++Context.UnorderedContainerDepth;
 				const bool bEncodedElement = WritePropertyValue(
-						*Set->ElementProp,
-						Helper.GetElementPtr(Index),
-						Context,
-						ElementWriter,
-						Depth + 1,
-						ElementPath);
+					Plan,
+					Element,
+					Helper.GetElementPtr(Index),
+					Context,
+					ElementWriter,
+					Depth + 1,
+					ElementPath);
 				--Context.UnorderedContainerDepth;
 				if (!bEncodedElement)
 				{
@@ -726,28 +846,17 @@ namespace
 					return false;
 				}
 			}
-			ElementDigests.Sort(GuidLess);
-			if (!Context.Write(
-				Writer,
-				Writer.WriteUInt32(
-					static_cast<uint32>(ElementDigests.Num())),
-				FieldPath))
-			{
-				return false;
-			}
-			for (const FGuid& Digest : ElementDigests)
-			{
-				if (!Context.Write(
-					Writer, Writer.WriteGuid(Digest), FieldPath))
-				{
-					return false;
-				}
-			}
-			return true;
+			return WriteUnorderedDigests(
+				ElementDigests, Context, Writer, FieldPath);
 		}
-		if (const FMapProperty* Map = CastField<FMapProperty>(&Property))
+
+		case ESeinReflectedValueKind::Map:
 		{
-			FScriptMapHelper Helper(Map, ValuePtr);
+			const FSeinReflectedValueOp& Key = Plan.GetChild(Op.FirstChild);
+			const FSeinReflectedValueOp& Value =
+				Plan.GetChild(Op.FirstChild + 1);
+			FScriptMapHelper Helper(
+				static_cast<const FMapProperty*>(&Property), ValuePtr);
 			if (!Context.AddElements(Helper.Num(), FieldPath))
 			{
 				return false;
@@ -763,24 +872,26 @@ namespace
 				FSeinCanonicalDigestWriter EntryWriter(
 					TEXT("SeinARTS.ReflectedState.MapEntry"),
 					ReflectedValueFormatVersion);
-				const FString EntryPath = FString::Printf(
-					TEXT("%s{%d}"), *FieldPath, Index);
+				const FFieldPath EntryPath =
+					FFieldPath::UnorderedEntry(FieldPath, Index);
 				++Context.UnorderedContainerDepth;
 				const bool bEncodedEntry =
 					WritePropertyValue(
-						*Map->KeyProp,
+						Plan,
+						Key,
 						Helper.GetKeyPtr(Index),
 						Context,
 						EntryWriter,
 						Depth + 1,
-						EntryPath + TEXT(".Key"))
+						FFieldPath::Suffixed(EntryPath, TEXT(".Key")))
 					&& WritePropertyValue(
-						*Map->ValueProp,
+						Plan,
+						Value,
 						Helper.GetValuePtr(Index),
 						Context,
 						EntryWriter,
 						Depth + 1,
-						EntryPath + TEXT(".Value"));
+						FFieldPath::Suffixed(EntryPath, TEXT(".Value")));
 				--Context.UnorderedContainerDepth;
 				if (!bEncodedEntry)
 				{
@@ -797,30 +908,15 @@ namespace
 					return false;
 				}
 			}
-			EntryDigests.Sort(GuidLess);
-			if (!Context.Write(
-				Writer,
-				Writer.WriteUInt32(
-					static_cast<uint32>(EntryDigests.Num())),
-				FieldPath))
-			{
-				return false;
-			}
-			for (const FGuid& Digest : EntryDigests)
-			{
-				if (!Context.Write(
-					Writer, Writer.WriteGuid(Digest), FieldPath))
-				{
-					return false;
-				}
-			}
-			return true;
+			return WriteUnorderedDigests(
+				EntryDigests, Context, Writer, FieldPath);
 		}
-		if (const FOptionalProperty* Optional =
-			CastField<FOptionalProperty>(&Property))
+
+		case ESeinReflectedValueKind::Optional:
 		{
 			const void* OptionalValue =
-				Optional->GetValuePointerForReadIfSet(ValuePtr);
+				static_cast<const FOptionalProperty&>(Property)
+					.GetValuePointerForReadIfSet(ValuePtr);
 			if (!Context.Write(
 				Writer,
 				Writer.WriteBool(OptionalValue != nullptr),
@@ -831,201 +927,177 @@ namespace
 			return !OptionalValue
 				|| (Context.AddElements(1, FieldPath)
 					&& WritePropertyValue(
-						*Optional->GetValueProperty(),
+						Plan,
+						Plan.GetChild(Op.FirstChild),
 						OptionalValue,
 						Context,
 						Writer,
 						Depth + 1,
-						FieldPath + TEXT("?")));
+						FFieldPath::Suffixed(FieldPath, TEXT("?"))));
 		}
-		if (const FBoolProperty* Bool =
-			CastField<FBoolProperty>(&Property))
-		{
+
+		case ESeinReflectedValueKind::Bool:
 			return Context.Write(
 				Writer,
-				Writer.WriteBool(Bool->GetPropertyValue(ValuePtr)),
+				Writer.WriteBool(
+					static_cast<const FBoolProperty&>(Property)
+						.GetPropertyValue(ValuePtr)),
 				FieldPath);
-		}
-		if (const FEnumProperty* Enum =
-			CastField<FEnumProperty>(&Property))
-		{
-			const FNumericProperty* Underlying =
-				Enum->GetUnderlyingProperty();
-			if (!Underlying)
-			{
-				return Context.Fail(
-					FieldPath,
-					TEXT("Enum has no underlying integer property."));
-			}
-			const uint64 Bits = IsUnsignedNumeric(*Underlying)
-				? Underlying->GetUnsignedIntPropertyValue(ValuePtr)
-				: static_cast<uint64>(
-					Underlying->GetSignedIntPropertyValue(ValuePtr));
-			return Context.Write(
-				Writer, Writer.WriteUInt64(Bits), FieldPath);
-		}
-		if (const FNumericProperty* Numeric =
-			CastField<FNumericProperty>(&Property))
-		{
-			if (Numeric->IsFloatingPoint()
-				|| !Numeric->IsInteger()
-				|| NumericTypeName(*Numeric).IsEmpty())
-			{
-				return Context.Fail(
-					FieldPath,
-					TEXT("Floating-point or unknown numeric fields are not canonical state."));
-			}
-			const uint64 Bits = IsUnsignedNumeric(*Numeric)
-				? Numeric->GetUnsignedIntPropertyValue(ValuePtr)
-				: static_cast<uint64>(
-					Numeric->GetSignedIntPropertyValue(ValuePtr));
+
+		case ESeinReflectedValueKind::EnumWithoutUnderlying:
+			return Context.Fail(
+				FieldPath,
+				TEXT("Enum has no underlying integer property."));
+
+		case ESeinReflectedValueKind::Enum:
+		case ESeinReflectedValueKind::Integer:
 			return Context.Write(
-				Writer, Writer.WriteUInt64(Bits), FieldPath);
-		}
-		if (const FNameProperty* Name =
-			CastField<FNameProperty>(&Property))
-		{
+				Writer,
+				Writer.WriteUInt64(ReadIntegerBits(Op, ValuePtr)),
+				FieldPath);
+
+		case ESeinReflectedValueKind::UnsupportedNumeric:
+			return Context.Fail(
+				FieldPath,
+				TEXT("Floating-point or unknown numeric fields are not canonical state."));
+
+		case ESeinReflectedValueKind::Name:
 			return Context.WriteName(
-				Writer, Name->GetPropertyValue(ValuePtr), FieldPath);
-		}
-		if (const FStrProperty* String =
-			CastField<FStrProperty>(&Property))
-		{
+				Writer,
+				static_cast<const FNameProperty&>(Property)
+					.GetPropertyValue(ValuePtr),
+				FieldPath);
+
+		case ESeinReflectedValueKind::String:
 			return Context.WriteString(
-				Writer, String->GetPropertyValue(ValuePtr), FieldPath);
-		}
-		if (Property.IsA<FTextProperty>())
-		{
+				Writer,
+				static_cast<const FStrProperty&>(Property)
+					.GetPropertyValue(ValuePtr),
+				FieldPath);
+
+		case ESeinReflectedValueKind::Text:
 			return Context.Fail(
 				FieldPath,
 				TEXT("FText is presentation state and is unsupported inside canonical containers."));
-		}
-		if (const FStructProperty* StructProperty =
-			CastField<FStructProperty>(&Property))
+
+		case ESeinReflectedValueKind::NullStruct:
+			return Context.Fail(
+				FieldPath,
+				TEXT("Struct property has no reflected type."));
+
+		case ESeinReflectedValueKind::InstancedStruct:
 		{
-			const UScriptStruct* Struct = StructProperty->Struct;
-			if (!Struct)
+			const FInstancedStruct& Dynamic =
+				*static_cast<const FInstancedStruct*>(ValuePtr);
+			if (!Context.Write(
+				Writer,
+				Writer.WriteBool(Dynamic.IsValid()),
+				FieldPath))
+			{
+				return false;
+			}
+			if (!Dynamic.IsValid())
+			{
+				return true;
+			}
+			if (!Dynamic.GetScriptStruct() || !Dynamic.GetMemory())
 			{
 				return Context.Fail(
 					FieldPath,
-					TEXT("Struct property has no reflected type."));
+					TEXT("FInstancedStruct is valid without a type or value."));
 			}
-			if (Struct == FInstancedStruct::StaticStruct())
-			{
-				const FInstancedStruct& Dynamic =
-					*static_cast<const FInstancedStruct*>(ValuePtr);
-				if (!Context.Write(
+			FGuid DynamicSchemaDigest;
+			return ResolveSchemaDigest(
+					Dynamic.GetScriptStruct(),
+					Context,
+					FFieldPath::Suffixed(FieldPath, TEXT(".<dynamic-schema>")),
+					DynamicSchemaDigest)
+				&& Context.Write(
 					Writer,
-					Writer.WriteBool(Dynamic.IsValid()),
-					FieldPath))
-				{
-					return false;
-				}
-				if (!Dynamic.IsValid())
-				{
-					return true;
-				}
-				if (!Dynamic.GetScriptStruct() || !Dynamic.GetMemory())
-				{
-					return Context.Fail(
-						FieldPath,
-						TEXT("FInstancedStruct is valid without a type or value."));
-				}
-				FGuid DynamicSchemaDigest;
-				return ResolveSchemaDigest(
-						Dynamic.GetScriptStruct(),
-						Context,
-						FieldPath + TEXT(".<dynamic-schema>"),
-						DynamicSchemaDigest)
-					&& Context.Write(
-						Writer,
-						Writer.WriteGuid(DynamicSchemaDigest),
-						FieldPath)
-					&& WriteReflectedValue(
+					Writer.WriteGuid(DynamicSchemaDigest),
+					FieldPath)
+				&& WriteReflectedValue(
 					Dynamic.GetScriptStruct(),
 					Dynamic.GetMemory(),
 					Context,
 					Writer,
 					Depth + 1,
 					FieldPath);
-			}
-			if (Struct == FGameplayTag::StaticStruct())
+		}
+
+		case ESeinReflectedValueKind::GameplayTag:
+			return Context.WriteName(
+				Writer,
+				static_cast<const FGameplayTag*>(ValuePtr)->GetTagName(),
+				FieldPath);
+
+		case ESeinReflectedValueKind::GameplayTagContainer:
+		{
+			const FGameplayTagContainer& Container =
+				*static_cast<const FGameplayTagContainer*>(ValuePtr);
+			const TArray<FGameplayTag>& Tags =
+				Container.GetGameplayTagArray();
+			if (!Context.AddElements(Tags.Num(), FieldPath))
 			{
-				const FGameplayTag& Tag =
-					*static_cast<const FGameplayTag*>(ValuePtr);
-				return Context.WriteName(
-					Writer, Tag.GetTagName(), FieldPath);
+				return false;
 			}
-			if (Struct == FGameplayTagContainer::StaticStruct())
+			TArray<FName> TagNames;
+			TagNames.Reserve(Tags.Num());
+			for (const FGameplayTag& Tag : Tags)
 			{
-				const FGameplayTagContainer& Container =
-					*static_cast<const FGameplayTagContainer*>(ValuePtr);
-				const TArray<FGameplayTag>& Tags =
-					Container.GetGameplayTagArray();
-				if (!Context.AddElements(Tags.Num(), FieldPath))
-				{
-					return false;
-				}
-				TArray<FName> TagNames;
-				TagNames.Reserve(Tags.Num());
-				for (const FGameplayTag& Tag : Tags)
-				{
-					TagNames.Add(Tag.GetTagName());
-				}
-				TagNames.Sort([](const FName A, const FName B)
-				{
-					return CanonicalNameText(A).Compare(
-						CanonicalNameText(B),
-						ESearchCase::CaseSensitive) < 0;
-				});
-				if (!Context.Write(
-					Writer,
-					Writer.WriteUInt32(
-						static_cast<uint32>(TagNames.Num())),
-					FieldPath))
-				{
-					return false;
-				}
-				for (const FName TagName : TagNames)
-				{
-					if (!Context.WriteName(
-						Writer, TagName, FieldPath))
-					{
-						return false;
-					}
-				}
-				return true;
+				TagNames.Add(Tag.GetTagName());
 			}
-			if (Struct == FSoftObjectPath::StaticStruct()
-				|| Struct == FSoftClassPath::StaticStruct())
+			TagNames.Sort([](const FName A, const FName B)
 			{
-				return Context.WriteString(
-					Writer,
-					static_cast<const FSoftObjectPath*>(ValuePtr)
-						->ToString(),
-					FieldPath);
+				return CanonicalNameText(A).Compare(
+					CanonicalNameText(B),
+					ESearchCase::CaseSensitive) < 0;
+			});
+			if (!Context.Write(
+				Writer,
+				Writer.WriteUInt32(
+					static_cast<uint32>(TagNames.Num())),
+				FieldPath))
+			{
+				return false;
 			}
-			if (Struct == FTopLevelAssetPath::StaticStruct())
+			for (const FName TagName : TagNames)
 			{
-				return Context.WriteString(
-					Writer,
-					static_cast<const FTopLevelAssetPath*>(ValuePtr)
-						->ToString(),
-					FieldPath);
+				if (!Context.WriteName(
+					Writer, TagName, FieldPath))
+				{
+					return false;
+				}
 			}
+			return true;
+		}
+
+		case ESeinReflectedValueKind::SoftObjectPath:
+			return Context.WriteString(
+				Writer,
+				static_cast<const FSoftObjectPath*>(ValuePtr)->ToString(),
+				FieldPath);
+
+		case ESeinReflectedValueKind::TopLevelAssetPath:
+			return Context.WriteString(
+				Writer,
+				static_cast<const FTopLevelAssetPath*>(ValuePtr)->ToString(),
+				FieldPath);
+
+		case ESeinReflectedValueKind::Struct:
 			return WriteReflectedValue(
-				Struct,
+				Op.Struct,
 				ValuePtr,
 				Context,
 				Writer,
 				Depth + 1,
 				FieldPath);
-		}
-		if (const FSoftObjectProperty* SoftObject =
-			CastField<FSoftObjectProperty>(&Property))
+
+		case ESeinReflectedValueKind::SoftObject:
 		{
 			const FSoftObjectPtr Soft =
-				SoftObject->GetPropertyValue(ValuePtr);
+				static_cast<const FSoftObjectProperty&>(Property)
+					.GetPropertyValue(ValuePtr);
 			const FSoftObjectPath Path = Soft.ToSoftObjectPath();
 			return Context.Write(
 					Writer, Writer.WriteBool(!Path.IsNull()), FieldPath)
@@ -1033,18 +1105,18 @@ namespace
 					|| Context.WriteString(
 						Writer, Path.ToString(), FieldPath));
 		}
-		if (Property.IsA<FWeakObjectProperty>()
-			|| Property.IsA<FLazyObjectProperty>())
-		{
+
+		case ESeinReflectedValueKind::WeakOrLazyObject:
 			return Context.Fail(
 				FieldPath,
 				TEXT("Weak and lazy runtime object references are not canonical state."));
-		}
-		if (const FObjectPropertyBase* ObjectProperty =
-			CastField<FObjectPropertyBase>(&Property))
+
+		case ESeinReflectedValueKind::InstancedObject:
+		case ESeinReflectedValueKind::ObjectReference:
 		{
 			const UObject* Object =
-				ObjectProperty->GetObjectPropertyValue(ValuePtr);
+				static_cast<const FObjectPropertyBase&>(Property)
+					.GetObjectPropertyValue(ValuePtr);
 			if (!Context.Write(
 				Writer, Writer.WriteBool(Object != nullptr), FieldPath))
 			{
@@ -1055,9 +1127,7 @@ namespace
 				return true;
 			}
 
-			const bool bInstanced = Property.HasAnyPropertyFlags(
-				CPF_InstancedReference | CPF_ContainsInstancedReference);
-			if (bInstanced)
+			if (Op.Kind == ESeinReflectedValueKind::InstancedObject)
 			{
 				if (Context.UnorderedContainerDepth > 0)
 				{
@@ -1097,7 +1167,7 @@ namespace
 				if (!ResolveSchemaDigest(
 						Object->GetClass(),
 						Context,
-						FieldPath + TEXT(".<dynamic-schema>"),
+						FFieldPath::Suffixed(FieldPath, TEXT(".<dynamic-schema>")),
 						DynamicSchemaDigest)
 					|| !Context.Write(
 						Writer, Writer.WriteUInt8(1), FieldPath)
@@ -1139,6 +1209,10 @@ namespace
 				Writer, Object->GetPathName(), FieldPath);
 		}
 
+		case ESeinReflectedValueKind::Unsupported:
+			break;
+		}
+
 		return Context.Fail(
 			FieldPath,
 			FString::Printf(
@@ -1152,7 +1226,7 @@ namespace
 		FProjectionContext& Context,
 		FSeinCanonicalDigestWriter& Writer,
 		const int32 Depth,
-		const FString& FieldPath)
+		const FFieldPath& FieldPath)
 	{
 		if (!Type || !Memory)
 		{
@@ -1160,58 +1234,59 @@ namespace
 				FieldPath,
 				TEXT("Reflected state type or value memory is null."));
 		}
+		const FSeinReflectedStructPlan& Plan = Context.GetPlan(*Type);
 		if (!Context.CheckDepth(Depth, FieldPath)
 			|| (!Context.bOmitSchemaBoundValueIdentity
 				&& !Context.WriteString(
-					Writer, Type->GetPathName(), FieldPath)))
+					Writer, Plan.GetTypePath(), FieldPath)))
 		{
 			return false;
 		}
 
-		TArray<const FProperty*> Properties;
-		Context.GetCanonicalProperties(Type, Properties);
+		const TConstArrayView<FSeinReflectedFieldOp> Fields =
+			Plan.GetFields();
 		if (!Context.bOmitSchemaBoundValueIdentity
 			&& !Context.Write(
 				Writer,
-				Writer.WriteUInt32(static_cast<uint32>(Properties.Num())),
+				Writer.WriteUInt32(static_cast<uint32>(Fields.Num())),
 				FieldPath))
 		{
 			return false;
 		}
-		for (const FProperty* Property : Properties)
+		for (const FSeinReflectedFieldOp& Field : Fields)
 		{
-			const FString PropertyPath =
-				ChildPath(FieldPath, *Property);
+			const FProperty& Property = *Field.Value.Property;
+			const FFieldPath PropertyPath =
+				FFieldPath::Child(FieldPath, Property);
 			if (!Context.bOmitSchemaBoundValueIdentity
 				&& (!Context.WriteString(
-						Writer, PropertyOwnerPath(*Property), PropertyPath)
-					|| !Context.WriteName(
-						Writer, Property->GetFName(), PropertyPath)
+						Writer, Field.OwnerPath, PropertyPath)
+					|| !Context.WriteFieldName(
+						Writer, Field, PropertyPath)
 					|| !Context.Write(
 						Writer,
-						Writer.WriteInt32(Property->ArrayDim),
+						Writer.WriteInt32(Field.ArrayDim),
 						PropertyPath)))
 			{
 				return false;
 			}
 			for (int32 ArrayIndex = 0;
-				ArrayIndex < Property->ArrayDim;
+				ArrayIndex < Field.ArrayDim;
 				++ArrayIndex)
 			{
-				const FString ValuePath = Property->ArrayDim > 1
-					? FString::Printf(
-						TEXT("%s[%d]"), *PropertyPath, ArrayIndex)
-					: PropertyPath;
 				const void* ValuePtr =
-					Property->ContainerPtrToValuePtr<void>(
+					Property.ContainerPtrToValuePtr<void>(
 						Memory, ArrayIndex);
 				if (!WritePropertyValue(
-					*Property,
+					Plan,
+					Field.Value,
 					ValuePtr,
 					Context,
 					Writer,
 					Depth + 1,
-					ValuePath))
+					Field.ArrayDim > 1
+						? FFieldPath::Element(PropertyPath, ArrayIndex)
+						: PropertyPath))
 				{
 					return false;
 				}
@@ -1250,10 +1325,11 @@ bool FSeinCanonicalReflectedStateDigest::ComputeSchemaDigest(
 	OutDigest.Invalidate();
 	OutError.Reset();
 	FProjectionContext Context(Limits);
+	const FString RootText = Type ? Type->GetPathName() : TEXT("<null>");
 	if (!ResolveSchemaDigest(
 		Type,
 		Context,
-		Type ? Type->GetPathName() : TEXT("<null>"),
+		FFieldPath::Root(RootText),
 		OutDigest))
 	{
 		OutError = MoveTemp(Context.Error);
@@ -1281,18 +1357,20 @@ bool FSeinCanonicalReflectedStateDigest::ComputeStructValueDigest(
 
 	FProjectionContext Context(Limits);
 	Context.SchemaDigests.Add(Type, SchemaDigest);
+	const FFieldPath Root =
+		FFieldPath::Root(Context.GetPlan(*Type).GetTypePath());
 	FSeinCanonicalDigestWriter Writer(
 		TEXT("SeinARTS.ReflectedState.StructValue"),
 		ReflectedValueFormatVersion);
 	if (!Context.Write(
-			Writer, Writer.WriteGuid(SchemaDigest), Type->GetPathName())
+			Writer, Writer.WriteGuid(SchemaDigest), Root)
 		|| !WriteReflectedValue(
 			Type,
 			StructMemory,
 			Context,
 			Writer,
 			0,
-			Type->GetPathName()))
+			Root))
 	{
 		OutError = Context.Error.IsEmpty()
 			? Writer.GetError()
@@ -1323,15 +1401,17 @@ bool FSeinCanonicalReflectedStateDigest::ComputeStructSequenceValueDigest(
 		Limits,
 		/*bInOmitSchemaBoundValueIdentity=*/true);
 	Context.SchemaDigests.Add(Type, SchemaDigest);
+	const FFieldPath Root =
+		FFieldPath::Root(Context.GetPlan(*Type).GetTypePath());
 	FSeinCanonicalDigestWriter Writer(
 		TEXT("SeinARTS.ReflectedState.StructSequenceValue"),
 		ReflectedSequenceValueFormatVersion);
 	if (!Context.Write(
-			Writer, Writer.WriteGuid(SchemaDigest), Type->GetPathName())
+			Writer, Writer.WriteGuid(SchemaDigest), Root)
 		|| !Context.Write(
 			Writer,
 			Writer.WriteUInt32(static_cast<uint32>(StructValues.Num())),
-			Type->GetPathName()))
+			Root))
 	{
 		OutError = Context.Error.IsEmpty()
 			? Writer.GetError()
@@ -1347,7 +1427,7 @@ bool FSeinCanonicalReflectedStateDigest::ComputeStructSequenceValueDigest(
 				Context,
 				Writer,
 				0,
-				Type->GetPathName()))
+				Root))
 		{
 			OutError = Context.Error.IsEmpty()
 				? TEXT("Canonical reflected struct sequence contains a null value.")
@@ -1377,20 +1457,22 @@ bool FSeinCanonicalReflectedStateDigest::ComputeObjectValueDigest(
 	FProjectionContext Context(Limits);
 	Context.SchemaDigests.Add(Object->GetClass(), SchemaDigest);
 	Context.ObjectStack.Add(Object);
+	const FFieldPath Root =
+		FFieldPath::Root(Context.GetPlan(*Object->GetClass()).GetTypePath());
 	FSeinCanonicalDigestWriter Writer(
 		TEXT("SeinARTS.ReflectedState.ObjectValue"),
 		ReflectedValueFormatVersion);
 	if (!Context.Write(
 			Writer,
 			Writer.WriteGuid(SchemaDigest),
-			Object->GetClass()->GetPathName())
+			Root)
 		|| !WriteReflectedValue(
 			Object->GetClass(),
 			Object,
 			Context,
 			Writer,
 			0,
-			Object->GetClass()->GetPathName()))
+			Root))
 	{
 		OutError = Context.Error.IsEmpty()
 			? Writer.GetError()
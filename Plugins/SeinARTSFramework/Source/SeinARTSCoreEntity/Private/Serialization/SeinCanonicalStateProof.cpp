@@ -0,0 +1,29 @@
+/**
+ * SeinARTS Framework - Copyright (c) 2026 Phenom Studios, Inc.
+ *
+ * @file         SeinCanonicalStateProof.cpp
+ * @author       RJ Macklem
+ * @created      17 Oct 2026
+ * @latest       17 Oct 2026
+ * @brief        Section lookup on a canonical state proof image.
+ */
+
+#include "Serialization/SeinCanonicalStateProof.h"
+
+#include "Algo/BinarySearch.h"
+
+const FSeinCanonicalStateProofSection*
+FSeinCanonicalStateProofImage::FindSection(FStringView SectionId) const
+{
+	const int32 Index = Algo::LowerBound(
+		Sections,
+		SectionId,
+		[](const FSeinCanonicalStateProofSection& Section, FStringView Key)
+		{
+			return FStringView(Section.SectionId).Compare(Key) < 0;
+		});
+	return Sections.IsValidIndex(Index)
+			&& FStringView(Sections[Index].SectionId).Equals(SectionId)
+		? &Sections[Index]
+		: nullptr;
+}
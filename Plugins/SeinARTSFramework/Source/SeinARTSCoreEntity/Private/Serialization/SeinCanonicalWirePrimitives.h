@@ -99,6 +99,22 @@ namespace UE::Sein::CanonicalWirePrivate
 		bool I32(int32 Value) { return UInt(static_cast<uint32>(Value), 4); }
 		bool I64(int64 Value) { return UInt(static_cast<uint64>(Value), 8); }
 
+		/** Minimal LEB128: seven value bits per byte, high bit continues. */
+		bool VarU32(uint32 Value)
+		{
+			uint8 Encoded[5];
+			int32 Count = 0;
+			do
+			{
+				uint8 Byte = static_cast<uint8>(Value & 0x7fu);
+				Value >>= 7;
+				if (Value != 0) Byte |= 0x80u;
+				Encoded[Count++] = Byte;
+			}
+			while (Value != 0);
+			return Raw(Encoded, Count);
+		}
+
 		bool Utf8(const FString& Value, int32 MaxStringBytes)
 		{
 			if (Value.Len() != FCString::Strlen(*Value))
@@ -213,6 +229,32 @@ namespace UE::Sein::CanonicalWirePrivate
 			return true;
 		}
 
+		/** Rejects overlong and out-of-range encodings so every value has
+		 *  exactly one accepted byte form. */
+		bool VarU32(uint32& Out)
+		{
+			uint64 Value = 0;
+			for (int32 Index = 0; Index < 5; ++Index)
+			{
+				if (Remaining() < 1)
+				{
+					return Fail(TEXT("truncated wire varint"));
+				}
+				const uint8 Byte = Bytes[Offset++];
+				Value |= static_cast<uint64>(Byte & 0x7fu) << (Index * 7);
+				if ((Byte & 0x80u) == 0)
+				{
+					if ((Index > 0 && Byte == 0) || Value > MAX_uint32)
+					{
+						return Fail(TEXT("non-canonical wire varint"));
+					}
+					Out = static_cast<uint32>(Value);
+					return true;
+				}
+			}
+			return Fail(TEXT("non-canonical wire varint"));
+		}
+
 		bool Utf8(
 			FString& Out,
 			int32 MaxStringBytes,
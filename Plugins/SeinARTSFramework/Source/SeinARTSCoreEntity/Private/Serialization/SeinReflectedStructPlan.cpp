@@ -0,0 +1,489 @@
+/**
+ * SeinARTS Framework - Copyright (c) 2026 Phenom Studios, Inc.
+ *
+ * @file         SeinReflectedStructPlan.cpp
+ * @author       RJ Macklem
+ * @created      17 Oct 2026
+ * @latest       17 Oct 2026
+ * @brief        Compiles and caches per-struct value/binary op plans and runs
+ *               them.
+ */
+
+#include "Serialization/SeinReflectedStructPlan.h"
+
+#include "GameplayTagContainer.h"
+#include "Misc/ScopeRWLock.h"
+#include "Serialization/SeinCanonicalInitialStateDigest.h"
+#include "Serialization/SeinCanonicalStatePropertyPolicy.h"
+#include "StructUtils/InstancedStruct.h"
+#include "Types/FixedPoint.h"
+#include "UObject/Class.h"
+#include "UObject/SoftObjectPath.h"
+#include "UObject/TextProperty.h"
+#include "UObject/TopLevelAssetPath.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/UnrealType.h"
+#include "UObject/WeakObjectPtr.h"
+
+namespace
+{
+	bool IsUnsignedInteger(const FNumericProperty& Numeric)
+	{
+		return Numeric.IsA<FByteProperty>()
+			|| Numeric.IsA<FUInt16Property>()
+			|| Numeric.IsA<FUInt32Property>()
+			|| Numeric.IsA<FUInt64Property>();
+	}
+
+	bool IsCanonicalInteger(const FNumericProperty& Numeric)
+	{
+		return Numeric.IsA<FByteProperty>()
+			|| Numeric.IsA<FInt8Property>()
+			|| Numeric.IsA<FInt16Property>()
+			|| Numeric.IsA<FUInt16Property>()
+			|| Numeric.IsA<FIntProperty>()
+			|| Numeric.IsA<FUInt32Property>()
+			|| Numeric.IsA<FInt64Property>()
+			|| Numeric.IsA<FUInt64Property>();
+	}
+
+	/** Bytes one property contributes to UStruct::SerializeBin when they are
+	 *  exactly its in-memory bytes, else zero. Exact classes only: subclasses
+	 *  may convert on load, and enum bytes resolve names on some archives. */
+	int32 RawBinarySize(const FProperty& Property)
+	{
+		constexpr EPropertyFlags ConditionalFlags =
+			CPF_Deprecated
+			| CPF_Transient
+			| CPF_DuplicateTransient
+			| CPF_NonPIEDuplicateTransient
+			| CPF_NonTransactional
+			| CPF_SkipSerialization;
+		if (Property.HasAnyPropertyFlags(ConditionalFlags))
+		{
+			return 0;
+		}
+		const FFieldClass* Class = Property.GetClass();
+		const bool bRawInteger =
+			Class == FInt8Property::StaticClass()
+			|| Class == FInt16Property::StaticClass()
+			|| Class == FIntProperty::StaticClass()
+			|| Class == FInt64Property::StaticClass()
+			|| Class == FUInt16Property::StaticClass()
+			|| Class == FUInt32Property::StaticClass()
+			|| Class == FUInt64Property::StaticClass()
+			|| (Class == FByteProperty::StaticClass()
+				&& !static_cast<const FByteProperty&>(Property).Enum);
+		// FFixedPoint's native serializer writes its int64 and nothing else.
+		const FStructProperty* Struct = CastField<FStructProperty>(&Property);
+		const bool bRawFixedPoint = Struct
+			&& Class == FStructProperty::StaticClass()
+			&& Struct->Struct == FFixedPoint::StaticStruct();
+		return bRawInteger || bRawFixedPoint
+			? Property.GetElementSize() * Property.ArrayDim
+			: 0;
+	}
+
+	FString PropertyOwnerPath(const FProperty& Property)
+	{
+		const UStruct* Owner = Property.GetOwnerStruct();
+		return Owner ? Owner->GetPathName() : FString();
+	}
+}
+
+struct FSeinReflectedStructPlanCache
+{
+	struct FEntry
+	{
+		TWeakObjectPtr<const UStruct> Type;
+		TSharedPtr<const FSeinReflectedStructPlan> Plan;
+	};
+
+	FRWLock Lock;
+	TMap<const UStruct*, FEntry> Entries;
+	FDelegateHandle ReinstancedHandle;
+	FDelegateHandle ReloadHandle;
+	FDelegateHandle PostGarbageCollectHandle;
+
+	static FSeinReflectedStructPlanCache& Get()
+	{
+		static FSeinReflectedStructPlanCache Cache;
+		return Cache;
+	}
+
+	static bool Matches(const FEntry& Entry, const UStruct& Type)
+	{
+		// A struct recompiled in place rebuilds its property chain.
+		return Entry.Type.Get() == &Type
+			&& Entry.Plan->FrozenPropertyLink == Type.PropertyLink
+			&& Entry.Plan->FrozenPropertiesSize == Type.GetPropertiesSize();
+	}
+
+	void PruneCollected()
+	{
+		FWriteScopeLock WriteLock(Lock);
+		for (auto It = Entries.CreateIterator(); It; ++It)
+		{
+			if (!It.Value().Type.IsValid())
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+};
+
+TSharedRef<const FSeinReflectedStructPlan> FSeinReflectedStructPlan::Get(
+	const UStruct& Type)
+{
+	FSeinReflectedStructPlanCache& Cache = FSeinReflectedStructPlanCache::Get();
+	{
+		FReadScopeLock ReadLock(Cache.Lock);
+		if (const FSeinReflectedStructPlanCache::FEntry* Entry =
+			Cache.Entries.Find(&Type))
+		{
+			if (FSeinReflectedStructPlanCache::Matches(*Entry, Type))
+			{
+				return Entry->Plan.ToSharedRef();
+			}
+		}
+	}
+
+	// Compile outside the lock; a racing compile of the same type produces an
+	// identical plan, and the first one published wins.
+	TSharedRef<const FSeinReflectedStructPlan> Compiled =
+		MakeShareable(new FSeinReflectedStructPlan(Type));
+	FWriteScopeLock WriteLock(Cache.Lock);
+	FSeinReflectedStructPlanCache::FEntry& Entry =
+		Cache.Entries.FindOrAdd(&Type);
+	if (Entry.Plan && FSeinReflectedStructPlanCache::Matches(Entry, Type))
+	{
+		return Entry.Plan.ToSharedRef();
+	}
+	Entry.Type = &Type;
+	Entry.Plan = Compiled;
+	return Compiled;
+}
+
+void FSeinReflectedStructPlan::ResetCache()
+{
+	FSeinReflectedStructPlanCache& Cache = FSeinReflectedStructPlanCache::Get();
+	FWriteScopeLock WriteLock(Cache.Lock);
+	Cache.Entries.Reset();
+}
+
+void FSeinReflectedStructPlan::StartInvalidationTracking()
+{
+	StopInvalidationTracking();
+	FSeinReflectedStructPlanCache& Cache = FSeinReflectedStructPlanCache::Get();
+	Cache.ReinstancedHandle = FCoreUObjectDelegates::OnObjectsReinstanced.AddLambda(
+		[](const TMap<UObject*, UObject*>& /*ReplacementMap*/)
+		{
+			ResetCache();
+		});
+	Cache.ReloadHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda(
+		[](EReloadCompleteReason /*Reason*/)
+		{
+			ResetCache();
+		});
+	Cache.PostGarbageCollectHandle =
+		FCoreUObjectDelegates::GetPostGarbageCollect().AddLambda([]()
+		{
+			FSeinReflectedStructPlanCache::Get().PruneCollected();
+		});
+}
+
+void FSeinReflectedStructPlan::StopInvalidationTracking()
+{
+	FSeinReflectedStructPlanCache& Cache = FSeinReflectedStructPlanCache::Get();
+	FCoreUObjectDelegates::OnObjectsReinstanced.Remove(Cache.ReinstancedHandle);
+	FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(Cache.ReloadHandle);
+	FCoreUObjectDelegates::GetPostGarbageCollect().Remove(
+		Cache.PostGarbageCollectHandle);
+	Cache.ReinstancedHandle.Reset();
+	Cache.ReloadHandle.Reset();
+	Cache.PostGarbageCollectHandle.Reset();
+	ResetCache();
+}
+
+FSeinReflectedStructPlan::FSeinReflectedStructPlan(const UStruct& Type)
+	: TypePath(Type.GetPathName())
+	, FrozenPropertyLink(Type.PropertyLink)
+	, FrozenPropertiesSize(Type.GetPropertiesSize())
+{
+	// Canonical field order: owner path, then name, both case-sensitive.
+	TArray<const FProperty*> Properties;
+	for (TFieldIterator<FProperty> It(
+		&Type, EFieldIterationFlags::IncludeSuper); It; ++It)
+	{
+		if (!FSeinCanonicalStatePropertyPolicy::ShouldSkip(**It))
+		{
+			Properties.Add(*It);
+		}
+	}
+	Properties.Sort([](const FProperty& A, const FProperty& B)
+	{
+		const int32 OwnerOrder = PropertyOwnerPath(A).Compare(
+			PropertyOwnerPath(B), ESearchCase::CaseSensitive);
+		if (OwnerOrder != 0)
+		{
+			return OwnerOrder < 0;
+		}
+		return A.GetName().Compare(
+			B.GetName(), ESearchCase::CaseSensitive) < 0;
+	});
+
+	Fields.Reserve(Properties.Num());
+	for (const FProperty* Property : Properties)
+	{
+		FSeinReflectedFieldOp& Field = Fields.AddDefaulted_GetRef();
+		Field.OwnerPath = PropertyOwnerPath(*Property);
+		Field.CanonicalName =
+			FSeinCanonicalInitialStateDigest::CanonicalContributorID(
+				Property->GetFName());
+		Field.NameCharacters = Property->GetFName().ToString().Len();
+		Field.ArrayDim = Property->ArrayDim;
+	}
+	// Container children append to ChildOps, so fill values after the field
+	// array is final.
+	for (int32 Index = 0; Index < Properties.Num(); ++Index)
+	{
+		CompileValueOp(*Properties[Index], Fields[Index].Value);
+	}
+
+	CompileBinaryOps(Type);
+}
+
+int32 FSeinReflectedStructPlan::CompileValueOp(const FProperty& Property)
+{
+	FSeinReflectedValueOp Op;
+	CompileValueOp(Property, Op);
+	return ChildOps.Add(Op);
+}
+
+void FSeinReflectedStructPlan::CompileValueOp(
+	const FProperty& Property,
+	FSeinReflectedValueOp& OutOp)
+{
+	OutOp = FSeinReflectedValueOp();
+	OutOp.Property = &Property;
+	if (FSeinCanonicalStatePropertyPolicy::ShouldSkip(Property))
+	{
+		OutOp.Kind = ESeinReflectedValueKind::Skipped;
+		return;
+	}
+	if (const FArrayProperty* Array = CastField<FArrayProperty>(&Property))
+	{
+		OutOp.Kind = ESeinReflectedValueKind::Array;
+		OutOp.FirstChild = CompileValueOp(*Array->Inner);
+		return;
+	}
+	if (const FSetProperty* Set = CastField<FSetProperty>(&Property))
+	{
+		OutOp.Kind = ESeinReflectedValueKind::Set;
+		OutOp.FirstChild = CompileValueOp(*Set->ElementProp);
+		return;
+	}
+	if (const FMapProperty* Map = CastField<FMapProperty>(&Property))
+	{
+		// Reserve the key/value pair first so they stay adjacent.
+		const int32 First = ChildOps.AddDefaulted(2);
+		FSeinReflectedValueOp Key;
+		FSeinReflectedValueOp Value;
+		CompileValueOp(*Map->KeyProp, Key);
+		CompileValueOp(*Map->ValueProp, Value);
+		ChildOps[First] = Key;
+		ChildOps[First + 1] = Value;
+		OutOp.Kind = ESeinReflectedValueKind::Map;
+		OutOp.FirstChild = First;
+		return;
+	}
+	if (const FOptionalProperty* Optional =
+		CastField<FOptionalProperty>(&Property))
+	{
+		OutOp.Kind = ESeinReflectedValueKind::Optional;
+		OutOp.FirstChild = CompileValueOp(*Optional->GetValueProperty());
+		return;
+	}
+	if (Property.IsA<FBoolProperty>())
+	{
+		OutOp.Kind = ESeinReflectedValueKind::Bool;
+		return;
+	}
+	if (const FEnumProperty* Enum = CastField<FEnumProperty>(&Property))
+	{
+		const FNumericProperty* Underlying = Enum->GetUnderlyingProperty();
+		if (!Underlying)
+		{
+			OutOp.Kind = ESeinReflectedValueKind::EnumWithoutUnderlying;
+			return;
+		}
+		OutOp.Kind = ESeinReflectedValueKind::Enum;
+		OutOp.IntegerBytes = static_cast<uint8>(Underlying->GetElementSize());
+		OutOp.bSignedInteger = !IsUnsignedInteger(*Underlying);
+		return;
+	}
+	if (const FNumericProperty* Numeric = CastField<FNumericProperty>(&Property))
+	{
+		if (Numeric->IsFloatingPoint()
+			|| !Numeric->IsInteger()
+			|| !IsCanonicalInteger(*Numeric))
+		{
+			OutOp.Kind = ESeinReflectedValueKind::UnsupportedNumeric;
+			return;
+		}
+		OutOp.Kind = ESeinReflectedValueKind::Integer;
+		OutOp.IntegerBytes = static_cast<uint8>(Numeric->GetElementSize());
+		OutOp.bSignedInteger = !IsUnsignedInteger(*Numeric);
+		return;
+	}
+	if (Property.IsA<FNameProperty>())
+	{
+		OutOp.Kind = ESeinReflectedValueKind::Name;
+		return;
+	}
+	if (Property.IsA<FStrProperty>())
+	{
+		OutOp.Kind = ESeinReflectedValueKind::String;
+		return;
+	}
+	if (Property.IsA<FTextProperty>())
+	{
+		OutOp.Kind = ESeinReflectedValueKind::Text;
+		return;
+	}
+	if (const FStructProperty* StructProperty =
+		CastField<FStructProperty>(&Property))
+	{
+		const UScriptStruct* Struct = StructProperty->Struct;
+		if (!Struct)
+		{
+			OutOp.Kind = ESeinReflectedValueKind::NullStruct;
+		}
+		else if (Struct == FInstancedStruct::StaticStruct())
+		{
+			OutOp.Kind = ESeinReflectedValueKind::InstancedStruct;
+		}
+		else if (Struct == FGameplayTag::StaticStruct())
+		{
+			OutOp.Kind = ESeinReflectedValueKind::GameplayTag;
+		}
+		else if (Struct == FGameplayTagContainer::StaticStruct())
+		{
+			OutOp.Kind = ESeinReflectedValueKind::GameplayTagContainer;
+		}
+		else if (Struct == FSoftObjectPath::StaticStruct()
+			|| Struct == FSoftClassPath::StaticStruct())
+		{
+			OutOp.Kind = ESeinReflectedValueKind::SoftObjectPath;
+		}
+		else if (Struct == FTopLevelAssetPath::StaticStruct())
+		{
+			OutOp.Kind = ESeinReflectedValueKind::TopLevelAssetPath;
+		}
+		else
+		{
+			OutOp.Kind = ESeinReflectedValueKind::Struct;
+			OutOp.Struct = Struct;
+		}
+		return;
+	}
+	if (Property.IsA<FSoftObjectProperty>())
+	{
+		OutOp.Kind = ESeinReflectedValueKind::SoftObject;
+		return;
+	}
+	if (Property.IsA<FWeakObjectProperty>()
+		|| Property.IsA<FLazyObjectProperty>())
+	{
+		OutOp.Kind = ESeinReflectedValueKind::WeakOrLazyObject;
+		return;
+	}
+	if (Property.IsA<FObjectPropertyBase>())
+	{
+		OutOp.Kind = Property.HasAnyPropertyFlags(
+				CPF_InstancedReference | CPF_ContainsInstancedReference)
+			? ESeinReflectedValueKind::InstancedObject
+			: ESeinReflectedValueKind::ObjectReference;
+		return;
+	}
+	OutOp.Kind = ESeinReflectedValueKind::Unsupported;
+}
+
+void FSeinReflectedStructPlan::CompileBinaryOps(const UStruct& Type)
+{
+	// Only non-native script structs take the property walk in SerializeBin;
+	// everything else keeps the engine path.
+	const UScriptStruct* Struct = Cast<UScriptStruct>(&Type);
+	if (!Struct || (Struct->StructFlags & STRUCT_SerializeNative))
+	{
+		return;
+	}
+	for (const FProperty* Property = Type.PropertyLink;
+		Property;
+		Property = Property->PropertyLinkNext)
+	{
+		const int32 RawSize = RawBinarySize(*Property);
+		if (RawSize <= 0)
+		{
+			FSeinReflectedBinaryOp& Op = BinaryOps.AddDefaulted_GetRef();
+			Op.Property = Property;
+			continue;
+		}
+		RawBinaryProperties.Add(Property);
+		const int32 Offset = Property->GetOffset_ForInternal();
+		if (BinaryOps.Num() > 0
+			&& !BinaryOps.Last().Property
+			&& BinaryOps.Last().Offset + BinaryOps.Last().Size == Offset)
+		{
+			BinaryOps.Last().Size += RawSize;
+			continue;
+		}
+		FSeinReflectedBinaryOp& Op = BinaryOps.AddDefaulted_GetRef();
+		Op.Offset = Offset;
+		Op.Size = RawSize;
+	}
+	if (RawBinaryProperties.IsEmpty())
+	{
+		// Nothing to collapse; the engine walk is already the plan.
+		BinaryOps.Reset();
+	}
+}
+
+bool FSeinReflectedStructPlan::CanSerializeBin(FArchive& Ar) const
+{
+	// A raw run is only the value's bytes when the archive neither swaps,
+	// formats, filters nor collects what it is handed.
+	if (RawBinaryProperties.IsEmpty()
+		|| Ar.IsTextFormat()
+		|| Ar.IsByteSwapping()
+		|| Ar.IsObjectReferenceCollector()
+		|| Ar.ArUseCustomPropertyList
+		|| Ar.IsSaveGame())
+	{
+		return false;
+	}
+	for (const FProperty* Property : RawBinaryProperties)
+	{
+		if (!Property->ShouldSerializeValue(Ar))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void FSeinReflectedStructPlan::SerializeBin(FArchive& Ar, void* Data) const
+{
+	uint8* Bytes = static_cast<uint8*>(Data);
+	for (const FSeinReflectedBinaryOp& Op : BinaryOps)
+	{
+		if (!Op.Property)
+		{
+			Ar.Serialize(Bytes + Op.Offset, Op.Size);
+			continue;
+		}
+		FStructuredArchiveFromArchive Structured(Ar);
+		const_cast<FProperty*>(Op.Property)->SerializeBinProperty(
+			Structured.GetSlot(), Data);
+	}
+}
@@ -1053,3 +1053,56 @@ bool FSeinSnapshotEnvelopeCodec::Decode(
 	OutMetadata = MoveTemp(Metadata);
 	return true;
 }
+
+bool FSeinSnapshotEnvelopeCodec::GetSectionLayout(
+	TConstArrayView<uint8> Bytes,
+	TArray<FSeinSnapshotSectionLayout>& OutLayout,
+	FSeinSnapshotEnvelopeMetadata& OutMetadata,
+	FString& OutError)
+{
+	OutError.Reset();
+	if (Bytes.Num() < PrefixBytes)
+	{
+		return Fail(
+			OutError,
+			TEXT("snapshot envelope is smaller than its fixed prefix"));
+	}
+
+	FSeinSnapshotEnvelopeMetadata Metadata;
+	const TConstArrayView<uint8> Prefix(Bytes.GetData(), PrefixBytes);
+	if (!ParsePrefixInternal(Prefix, Metadata, OutError))
+	{
+		return false;
+	}
+	uint64 ExpectedFileBytes = 0;
+	if (!CheckedAdd(PrefixBytes, Metadata.BodyBytes, ExpectedFileBytes)
+		|| ExpectedFileBytes != static_cast<uint64>(Bytes.Num()))
+	{
+		return Fail(
+			OutError,
+			TEXT("snapshot envelope declared body does not exactly match file length"));
+	}
+	const TConstArrayView<uint8> Body(
+		Bytes.GetData() + PrefixBytes,
+		static_cast<int32>(Metadata.BodyBytes));
+
+	TArray<FSectionFrame> Sections;
+	if (!ParseDirectory(Body, Metadata, Sections, OutError))
+	{
+		return false;
+	}
+	TArray<FSeinSnapshotSectionLayout> Layout;
+	Layout.Reserve(Sections.Num());
+	for (const FSectionFrame& Section : Sections)
+	{
+		FSeinSnapshotSectionLayout& Entry = Layout.AddDefaulted_GetRef();
+		Entry.SectionId = Section.SectionId;
+		Entry.Role = Section.Role;
+		Entry.PayloadOffset = PrefixBytes + Section.PayloadOffset;
+		Entry.PayloadBytes = static_cast<uint64>(Section.Payload.Num());
+	}
+
+	OutLayout = MoveTemp(Layout);
+	OutMetadata = MoveTemp(Metadata);
+	return true;
+}
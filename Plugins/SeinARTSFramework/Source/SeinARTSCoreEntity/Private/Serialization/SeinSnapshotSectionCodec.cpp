@@ -0,0 +1,358 @@
+/**
+ * SeinARTS Framework - Copyright (c) 2026 Phenom Studios, Inc.
+ *
+ * @file         SeinSnapshotSectionCodec.cpp
+ * @author       RJ Macklem
+ * @created      17 Oct 2026
+ * @latest       17 Oct 2026
+ * @brief        Snapshot section encode/decode for the canonical-bytes, LZ4
+ *               and XOR-delta codecs.
+ */
+
+#include "Serialization/SeinSnapshotSectionCodec.h"
+
+#include "Misc/Compression.h"
+
+namespace
+{
+	/** Equal bytes shorter than this stay inside a literal: a new run pair
+	 *  would cost more than the XOR zeros it saves once LZ4 sees them. */
+	constexpr int32 MinEqualRunBytes = 8;
+	constexpr int32 LZ4LengthBytes = 8;
+	constexpr int32 MaxVarintBytes = 10;
+
+	bool Fail(FString& OutError, const TCHAR* Message)
+	{
+		OutError = Message;
+		return false;
+	}
+
+	uint8 BaseByte(TConstArrayView<uint8> Base, int64 Index)
+	{
+		return Index < Base.Num() ? Base[static_cast<int32>(Index)] : 0;
+	}
+
+	void AppendVarint(TArray<uint8>& Out, uint64 Value)
+	{
+		while (Value >= 0x80)
+		{
+			Out.Add(static_cast<uint8>(Value | 0x80));
+			Value >>= 7;
+		}
+		Out.Add(static_cast<uint8>(Value));
+	}
+
+	bool ReadVarint(TConstArrayView<uint8> Bytes, int32& Offset, uint64& OutValue)
+	{
+		uint64 Value = 0;
+		for (int32 Index = 0; Index < MaxVarintBytes; ++Index)
+		{
+			if (Offset >= Bytes.Num())
+			{
+				return false;
+			}
+			const uint8 Byte = Bytes[Offset++];
+			Value |= static_cast<uint64>(Byte & 0x7f) << (7 * Index);
+			if ((Byte & 0x80) == 0)
+			{
+				OutValue = Value;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/** Length of the equal run starting at Index, capped at Limit bytes. */
+	int32 CountEqual(
+		TConstArrayView<uint8> Canonical,
+		TConstArrayView<uint8> Base,
+		int32 Index,
+		int32 Limit)
+	{
+		int32 Count = 0;
+		while (Index + Count < Canonical.Num()
+			&& Count < Limit
+			&& Canonical[Index + Count] == BaseByte(Base, Index + Count))
+		{
+			++Count;
+		}
+		return Count;
+	}
+
+	void EncodeXorDelta(
+		TConstArrayView<uint8> Canonical,
+		TConstArrayView<uint8> Base,
+		TArray<uint8>& OutStored)
+	{
+		const int32 Num = Canonical.Num();
+		int32 Index = 0;
+		while (Index < Num)
+		{
+			const int32 EqualStart = Index;
+			Index += CountEqual(Canonical, Base, Index, Num);
+			const int32 LiteralStart = Index;
+			while (Index < Num)
+			{
+				if (Canonical[Index] != BaseByte(Base, Index))
+				{
+					++Index;
+					continue;
+				}
+				const int32 Equal =
+					CountEqual(Canonical, Base, Index, MinEqualRunBytes);
+				if (Equal >= MinEqualRunBytes || Index + Equal == Num)
+				{
+					break;
+				}
+				Index += Equal;
+			}
+			AppendVarint(OutStored, static_cast<uint64>(LiteralStart - EqualStart));
+			AppendVarint(OutStored, static_cast<uint64>(Index - LiteralStart));
+			for (int32 Literal = LiteralStart; Literal < Index; ++Literal)
+			{
+				OutStored.Add(Canonical[Literal] ^ BaseByte(Base, Literal));
+			}
+		}
+	}
+
+	bool DecodeXorDelta(
+		TConstArrayView<uint8> Stored,
+		TConstArrayView<uint8> Base,
+		uint64 CanonicalBytes,
+		TArray<uint8>& OutCanonical,
+		FString& OutError)
+	{
+		TArray<uint8> Candidate;
+		Candidate.SetNumUninitialized(static_cast<int32>(CanonicalBytes));
+		uint64 Position = 0;
+		int32 Offset = 0;
+		while (Offset < Stored.Num())
+		{
+			uint64 Equal = 0;
+			uint64 Literal = 0;
+			if (!ReadVarint(Stored, Offset, Equal)
+				|| !ReadVarint(Stored, Offset, Literal))
+			{
+				return Fail(OutError, TEXT("snapshot section delta run is truncated"));
+			}
+			if ((Equal == 0 && Literal == 0)
+				|| Equal > CanonicalBytes - Position
+				|| Literal > CanonicalBytes - Position - Equal
+				|| Literal > static_cast<uint64>(Stored.Num() - Offset))
+			{
+				return Fail(OutError, TEXT("snapshot section delta run exceeds its bounds"));
+			}
+			for (uint64 Index = 0; Index < Equal; ++Index, ++Position)
+			{
+				Candidate[static_cast<int32>(Position)] =
+					BaseByte(Base, static_cast<int64>(Position));
+			}
+			for (uint64 Index = 0; Index < Literal; ++Index, ++Position)
+			{
+				Candidate[static_cast<int32>(Position)] = Stored[Offset++]
+					^ BaseByte(Base, static_cast<int64>(Position));
+			}
+		}
+		if (Position != CanonicalBytes)
+		{
+			return Fail(OutError, TEXT("snapshot section delta does not cover its canonical length"));
+		}
+		OutCanonical = MoveTemp(Candidate);
+		return true;
+	}
+
+	bool CompressLZ4(
+		TConstArrayView<uint8> Inner,
+		TArray<uint8>& OutStored,
+		FString& OutError)
+	{
+		TArray<uint8> Candidate;
+		Candidate.SetNumUninitialized(LZ4LengthBytes);
+		const uint64 InnerBytes = static_cast<uint64>(Inner.Num());
+		for (int32 Index = 0; Index < LZ4LengthBytes; ++Index)
+		{
+			Candidate[Index] = static_cast<uint8>(
+				InnerBytes >> ((LZ4LengthBytes - 1 - Index) * 8));
+		}
+		if (Inner.Num() > 0)
+		{
+			const int32 Bound =
+				FCompression::CompressMemoryBound(NAME_LZ4, Inner.Num());
+			if (Bound <= 0)
+			{
+				return Fail(OutError, TEXT("snapshot section LZ4 bound is unavailable"));
+			}
+			Candidate.AddUninitialized(Bound);
+			int32 CompressedBytes = Bound;
+			if (!FCompression::CompressMemory(
+					NAME_LZ4,
+					Candidate.GetData() + LZ4LengthBytes,
+					CompressedBytes,
+					Inner.GetData(),
+					Inner.Num()))
+			{
+				return Fail(OutError, TEXT("snapshot section LZ4 compression failed"));
+			}
+			Candidate.SetNum(LZ4LengthBytes + CompressedBytes, EAllowShrinking::Yes);
+		}
+		OutStored = MoveTemp(Candidate);
+		return true;
+	}
+
+	bool DecompressLZ4(
+		TConstArrayView<uint8> Stored,
+		uint64 MaxInnerBytes,
+		TArray<uint8>& OutInner,
+		FString& OutError)
+	{
+		if (Stored.Num() < LZ4LengthBytes)
+		{
+			return Fail(OutError, TEXT("snapshot section LZ4 header is truncated"));
+		}
+		uint64 InnerBytes = 0;
+		for (int32 Index = 0; Index < LZ4LengthBytes; ++Index)
+		{
+			InnerBytes = (InnerBytes << 8) | Stored[Index];
+		}
+		if (InnerBytes > MaxInnerBytes)
+		{
+			return Fail(OutError, TEXT("snapshot section LZ4 inner length exceeds its bound"));
+		}
+		const int32 CompressedBytes = Stored.Num() - LZ4LengthBytes;
+		if ((InnerBytes == 0) != (CompressedBytes == 0))
+		{
+			return Fail(OutError, TEXT("snapshot section LZ4 stream disagrees with its inner length"));
+		}
+		TArray<uint8> Candidate;
+		Candidate.SetNumUninitialized(static_cast<int32>(InnerBytes));
+		if (InnerBytes > 0
+			&& !FCompression::UncompressMemory(
+				NAME_LZ4,
+				Candidate.GetData(),
+				static_cast<int32>(InnerBytes),
+				Stored.GetData() + LZ4LengthBytes,
+				CompressedBytes))
+		{
+			return Fail(OutError, TEXT("snapshot section LZ4 stream is corrupt"));
+		}
+		OutInner = MoveTemp(Candidate);
+		return true;
+	}
+
+	/** Worst-case delta stream for a canonical payload: every literal pays at
+	 *  most two maximal varints per MinEqualRunBytes of equal bytes skipped. */
+	uint64 MaxDeltaBytes(uint64 CanonicalBytes)
+	{
+		return CanonicalBytes + CanonicalBytes / 2 + 2 * MaxVarintBytes;
+	}
+}
+
+bool FSeinSnapshotSectionCodec::IsKnown(ESeinSnapshotSectionCodec Codec)
+{
+	switch (Codec)
+	{
+	case ESeinSnapshotSectionCodec::CanonicalBytes:
+	case ESeinSnapshotSectionCodec::XorDelta:
+	case ESeinSnapshotSectionCodec::CanonicalBytesLZ4:
+	case ESeinSnapshotSectionCodec::XorDeltaLZ4:
+		return true;
+	default:
+		return false;
+	}
+}
+
+bool FSeinSnapshotSectionCodec::IsDelta(ESeinSnapshotSectionCodec Codec)
+{
+	return Codec == ESeinSnapshotSectionCodec::XorDelta
+		|| Codec == ESeinSnapshotSectionCodec::XorDeltaLZ4;
+}
+
+bool FSeinSnapshotSectionCodec::Encode(
+	ESeinSnapshotSectionCodec Codec,
+	TConstArrayView<uint8> Canonical,
+	TConstArrayView<uint8> Base,
+	TArray<uint8>& OutStored,
+	FString& OutError)
+{
+	OutError.Reset();
+	if (static_cast<uint64>(Canonical.Num())
+			> FSeinSnapshotEnvelopeCodec::MaxSectionPayloadBytes
+		|| static_cast<uint64>(Base.Num())
+			> FSeinSnapshotEnvelopeCodec::MaxSectionPayloadBytes)
+	{
+		return Fail(OutError, TEXT("snapshot section payload exceeds its bound"));
+	}
+
+	switch (Codec)
+	{
+	case ESeinSnapshotSectionCodec::CanonicalBytes:
+		OutStored = TArray<uint8>(Canonical);
+		return true;
+	case ESeinSnapshotSectionCodec::CanonicalBytesLZ4:
+		return CompressLZ4(Canonical, OutStored, OutError);
+	case ESeinSnapshotSectionCodec::XorDelta:
+	case ESeinSnapshotSectionCodec::XorDeltaLZ4:
+	{
+		TArray<uint8> Delta;
+		EncodeXorDelta(Canonical, Base, Delta);
+		if (Codec == ESeinSnapshotSectionCodec::XorDeltaLZ4)
+		{
+			return CompressLZ4(Delta, OutStored, OutError);
+		}
+		OutStored = MoveTemp(Delta);
+		return true;
+	}
+	default:
+		return Fail(OutError, TEXT("snapshot section codec is unknown"));
+	}
+}
+
+bool FSeinSnapshotSectionCodec::Decode(
+	ESeinSnapshotSectionCodec Codec,
+	TConstArrayView<uint8> Stored,
+	TConstArrayView<uint8> Base,
+	uint64 CanonicalBytes,
+	TArray<uint8>& OutCanonical,
+	FString& OutError)
+{
+	OutError.Reset();
+	if (CanonicalBytes > FSeinSnapshotEnvelopeCodec::MaxSectionPayloadBytes)
+	{
+		return Fail(OutError, TEXT("snapshot section payload exceeds its bound"));
+	}
+
+	switch (Codec)
+	{
+	case ESeinSnapshotSectionCodec::CanonicalBytes:
+		if (static_cast<uint64>(Stored.Num()) != CanonicalBytes)
+		{
+			return Fail(OutError, TEXT("snapshot section length disagrees with its canonical length"));
+		}
+		OutCanonical = TArray<uint8>(Stored);
+		return true;
+	case ESeinSnapshotSectionCodec::CanonicalBytesLZ4:
+	{
+		TArray<uint8> Inner;
+		if (!DecompressLZ4(Stored, CanonicalBytes, Inner, OutError))
+		{
+			return false;
+		}
+		if (static_cast<uint64>(Inner.Num()) != CanonicalBytes)
+		{
+			return Fail(OutError, TEXT("snapshot section length disagrees with its canonical length"));
+		}
+		OutCanonical = MoveTemp(Inner);
+		return true;
+	}
+	case ESeinSnapshotSectionCodec::XorDelta:
+		return DecodeXorDelta(Stored, Base, CanonicalBytes, OutCanonical, OutError);
+	case ESeinSnapshotSectionCodec::XorDeltaLZ4:
+	{
+		TArray<uint8> Delta;
+		return DecompressLZ4(Stored, MaxDeltaBytes(CanonicalBytes), Delta, OutError)
+			&& DecodeXorDelta(Delta, Base, CanonicalBytes, OutCanonical, OutError);
+	}
+	default:
+		return Fail(OutError, TEXT("snapshot section codec is unknown"));
+	}
+}
@@ -21,6 +21,7 @@
 #include "Serialization/SeinCanonicalDigestTree.h"
 #include "Serialization/SeinCanonicalReflectedStateDigest.h"
 #include "Serialization/SeinCanonicalStateCodec.h"
+#include "Serialization/SeinCanonicalStateProof.h"
 #include "Serialization/SeinCanonicalStateRoot.h"
 #include "Serialization/SeinLatentActionCodecRegistry.h"
 #include "Serialization/SeinPoolObjectCodecRegistry.h"
@@ -87,6 +88,8 @@ struct FSeinWorldStateRootCache
 	FGuid AuxiliaryDigest;
 	FGuid SealedRoutineRoot;
 	int32 SealedRoutineTick = INDEX_NONE;
+	/** Leaves composed into SealedRoutineRoot, kept for proof images. */
+	TArray<FSeinCanonicalStateRootLeaf> SealedRoutineLeaves;
 	FString SealedRoutineError;
 	TMap<const UScriptStruct*, FGuid> RoutineSchemaDigests;
 	int64 ComponentValueDigestsComputed = 0;
@@ -2127,6 +2130,7 @@ bool USeinWorldSubsystem::SealRoutineCanonicalStateRoot(
 	}
 	Cache.SealedRoutineTick = CompletedTick;
 	Cache.SealedRoutineRoot = CandidateRoot;
+	Cache.SealedRoutineLeaves = MoveTemp(Leaves);
 	Cache.SealedRoutineError.Reset();
 	OutRoot = CandidateRoot;
 	if (CVarSeinStateRootProfile.GetValueOnGameThread() >= 2)
@@ -2167,6 +2171,313 @@ bool USeinWorldSubsystem::GetSealedRoutineCanonicalStateRoot(
 	return true;
 }
 
+bool USeinWorldSubsystem::CaptureCanonicalStateProofImage(
+	int32 CompletedTick,
+	const FSeinCanonicalStateProofImage* Previous,
+	FSeinCanonicalStateProofImage& OutImage,
+	FString& OutError) const
+{
+	OutImage = FSeinCanonicalStateProofImage();
+	FGuid SealedRoot;
+	if (!IsInGameThread()
+		|| !GetSealedRoutineCanonicalStateRoot(
+			CompletedTick, SealedRoot, OutError))
+	{
+		return OutError.IsEmpty()
+			? Fail(
+				OutError,
+				TEXT("Canonical proof image requires the game thread."))
+			: false;
+	}
+	const FSeinWorldStateRootCache& Cache = *CanonicalStateRootCache;
+
+	// Trees are copied only when their section changed since Previous; the
+	// section digest commits to the tree root, so equal digests mean equal
+	// trees and the older image's copy is shared.
+	bool bTreesSealed = true;
+	const auto AddSection = [&OutImage, &bTreesSealed, Previous](
+		FString SectionId,
+		const FGuid& Digest,
+		const FSeinCanonicalDigestTree* Tree)
+	{
+		FSeinCanonicalStateProofSection& Section =
+			OutImage.Sections.AddDefaulted_GetRef();
+		Section.SectionId = MoveTemp(SectionId);
+		Section.Digest = Digest;
+		if (!Tree)
+		{
+			return;
+		}
+		bTreesSealed &= Tree->IsValid() && !Tree->HasPendingUpdates();
+		const FSeinCanonicalStateProofSection* Prior = Previous
+			? Previous->FindSection(Section.SectionId)
+			: nullptr;
+		if (Prior && Prior->Tree.IsValid() && Prior->Digest == Digest)
+		{
+			Section.Tree = Prior->Tree;
+		}
+		else
+		{
+			Section.Tree = MakeShared<FSeinCanonicalDigestTree>(*Tree);
+		}
+	};
+
+	OutImage.Sections.Reserve(
+		Cache.SealedRoutineLeaves.Num() + Cache.Components.Num() + 5);
+	for (const FSeinCanonicalStateRootLeaf& Leaf : Cache.SealedRoutineLeaves)
+	{
+		AddSection(Leaf.SectionId, Leaf.LeafDigest, nullptr);
+	}
+	AddSection(TEXT("core/accelerator"), Cache.CoreAcceleratorDigest, nullptr);
+	AddSection(TEXT("core/auxiliary"), Cache.AuxiliaryDigest, nullptr);
+	AddSection(
+		TEXT("core/entity-pool"),
+		Cache.EntityPool.SectionDigest,
+		&Cache.EntityPool.Tree);
+	for (const auto& Pair : Cache.Components)
+	{
+		AddSection(
+			TEXT("core/component/") + Pair.Key,
+			Pair.Value.SectionDigest,
+			&Pair.Value.Tree);
+	}
+	AddSection(
+		TEXT("core/pool/AbilityPool"),
+		Cache.AbilityPool.SectionDigest,
+		&Cache.AbilityPool.Tree);
+	AddSection(
+		TEXT("core/pool/CommandBrokerResolverPool"),
+		Cache.ResolverPool.SectionDigest,
+		&Cache.ResolverPool.Tree);
+	if (!bTreesSealed)
+	{
+		OutImage = FSeinCanonicalStateProofImage();
+		return Fail(
+			OutError,
+			TEXT("Canonical proof image found an unsealed section tree."));
+	}
+	OutImage.Sections.Sort(
+		[](const FSeinCanonicalStateProofSection& A,
+			const FSeinCanonicalStateProofSection& B)
+		{
+			return A.SectionId < B.SectionId;
+		});
+	OutImage.Tick = CompletedTick;
+	OutImage.Root = SealedRoot;
+	return true;
+}
+
+bool USeinWorldSubsystem::DescribeCanonicalStateProofLeaf(
+	const FSeinCanonicalStateProofImage& Image,
+	FStringView SectionId,
+	int32 LeafIndex,
+	FSeinCanonicalStateProofLeaf& OutLeaf,
+	FString& OutError) const
+{
+	OutLeaf = FSeinCanonicalStateProofLeaf();
+	OutError.Reset();
+	const FSeinCanonicalStateProofSection* Section =
+		Image.FindSection(SectionId);
+	FGuid ImagedLeaf;
+	if (!Section
+		|| !Section->Tree.IsValid()
+		|| LeafIndex < 0
+		|| LeafIndex >= Section->Tree->Num()
+		|| !Section->Tree->GetNodeDigest(
+			Section->Tree->GetLeafBase() + LeafIndex, ImagedLeaf))
+	{
+		return Fail(
+			OutError,
+			FString::Printf(
+				TEXT("Canonical proof image has no indexed leaf %d in section '%.*s'."),
+				LeafIndex,
+				SectionId.Len(),
+				SectionId.GetData()));
+	}
+	if (!IsInGameThread() || !CanonicalStateRootCache.IsValid())
+	{
+		return Fail(
+			OutError,
+			TEXT("Canonical proof leaves require a live root cache on the game thread."));
+	}
+	const FSeinWorldStateRootCache& Cache = *CanonicalStateRootCache;
+
+	// Payloads come from live state: the image keeps digests, not values. A
+	// live digest equal to the imaged leaf proves the value is unchanged.
+	FGuid LiveDigest;
+	bool bLiveSlot = true;
+	FString Payload;
+	const FStringView ComponentPrefix = TEXTVIEW("core/component/");
+	if (SectionId == TEXTVIEW("core/entity-pool")
+		|| SectionId.StartsWith(ComponentPrefix))
+	{
+		FSeinEntityPoolExactState ExactState;
+		if (!EntityPool.CaptureExactState(
+			ExactState,
+			OutError,
+			/*bAllowDeferredDestroyTombstones=*/true))
+		{
+			return false;
+		}
+		bLiveSlot = ExactState.Slots.IsValidIndex(LeafIndex);
+		const FSeinEntityPoolSlotState* Slot = bLiveSlot
+			? &ExactState.Slots[LeafIndex]
+			: nullptr;
+		const FSeinEntityHandle Handle(
+			LeafIndex, Slot ? Slot->Generation : 0);
+		if (!Slot)
+		{
+			Payload = TEXT("<slot no longer exists>");
+		}
+		else if (SectionId == TEXTVIEW("core/entity-pool"))
+		{
+			const TSubclassOf<ASeinActor>* Found = Slot->Entity.IsAlive()
+				? EntityActorClassMap.Find(Handle)
+				: nullptr;
+			const UClass* ActorClass = Found ? Found->Get() : nullptr;
+			if (!ComputeIncrementalEntitySlotDigest(
+				LeafIndex, *Slot, ActorClass, LiveDigest, OutError))
+			{
+				return false;
+			}
+			FSeinEntityPoolSlotState::StaticStruct()->ExportText(
+				Payload, Slot, nullptr, nullptr, PPF_None, nullptr);
+			if (ActorClass)
+			{
+				Payload += TEXT(" ActorClass=") + ActorClass->GetPathName();
+			}
+		}
+		else
+		{
+			const FString TypePath(
+				SectionId.RightChop(ComponentPrefix.Len()));
+			const FSeinWorldStateRootCache::FComponentCache* ComponentCache =
+				Cache.Components.Find(TypePath);
+			const ISeinComponentStorage* Storage =
+				ComponentCache && ComponentCache->Type
+					? ComponentStorages.FindRef(ComponentCache->Type)
+					: nullptr;
+			if (!Storage)
+			{
+				Payload = TEXT("<component type no longer registered>");
+				bLiveSlot = false;
+			}
+			else if (Slot->Entity.IsAlive() && Storage->HasComponent(Handle))
+			{
+				const void* Value = Storage->GetComponentRaw(Handle);
+				if (!ComputeIncrementalComponentSlotDigest(
+					ComponentCache->Type,
+					ComponentCache->SchemaDigest,
+					Handle,
+					Value,
+					LiveDigest,
+					OutError))
+				{
+					return false;
+				}
+				ComponentCache->Type->ExportText(
+					Payload, Value, nullptr, nullptr, PPF_None, nullptr);
+			}
+			else
+			{
+				Payload = TEXT("<no component>");
+			}
+		}
+	}
+	else
+	{
+		const auto DescribePoolSlot = [
+			this,
+			LeafIndex,
+			&LiveDigest,
+			&bLiveSlot,
+			&Payload,
+			&OutError](
+			const auto& Pool,
+			ESeinPoolObjectKind Kind,
+			const TCHAR* PoolName) -> bool
+		{
+			bLiveSlot = Pool.IsValidIndex(LeafIndex);
+			const UObject* Object = bLiveSlot ? Pool[LeafIndex].Get() : nullptr;
+			if (!Object)
+			{
+				Payload = bLiveSlot
+					? TEXT("<free slot>")
+					: TEXT("<slot no longer exists>");
+				return true;
+			}
+			TArray<uint8> StateBytes;
+			FGuid RootClassContractDigest;
+			if (!FSeinPoolObjectCodecRegistry::CaptureObjectForVerifiedRoot(
+					PoolObjectCodecManifest,
+					*Object,
+					Kind,
+					StateBytes,
+					RootClassContractDigest,
+					OutError)
+				|| !ComputeIncrementalObjectPoolSlotDigest(
+					PoolObjectCodecManifest,
+					*Object,
+					Kind,
+					PoolName,
+					LeafIndex,
+					LiveDigest,
+					OutError))
+			{
+				return false;
+			}
+			Payload = Object->GetClass()->GetPathName()
+				+ TEXT(" State=")
+				+ BytesToHex(StateBytes.GetData(), StateBytes.Num());
+			return true;
+		};
+		bool bDescribed = false;
+		if (SectionId == TEXTVIEW("core/pool/AbilityPool"))
+		{
+			bDescribed = DescribePoolSlot(
+				AbilityPool,
+				ESeinPoolObjectKind::Ability,
+				TEXT("AbilityPool"));
+		}
+		else if (SectionId == TEXTVIEW("core/pool/CommandBrokerResolverPool"))
+		{
+			bDescribed = DescribePoolSlot(
+				CommandBrokerResolverPool,
+				ESeinPoolObjectKind::CommandBrokerResolver,
+				TEXT("CommandBrokerResolverPool"));
+		}
+		else
+		{
+			return Fail(
+				OutError,
+				FString::Printf(
+					TEXT("Canonical proof section '%.*s' has no describable leaves."),
+					SectionId.Len(),
+					SectionId.GetData()));
+		}
+		if (!bDescribed)
+		{
+			return false;
+		}
+	}
+
+	if (bLiveSlot)
+	{
+		OutLeaf.Digest = LiveDigest.IsValid()
+			? LiveDigest
+			: Section->Tree->GetEmptyLeafDigest();
+	}
+	OutLeaf.bAtCheckpoint = OutLeaf.Digest == ImagedLeaf;
+	OutLeaf.bTruncated =
+		Payload.Len() > FSeinCanonicalStateProofLeaf::MaxPayloadChars;
+	if (OutLeaf.bTruncated)
+	{
+		Payload.LeftInline(FSeinCanonicalStateProofLeaf::MaxPayloadChars);
+	}
+	OutLeaf.Payload = MoveTemp(Payload);
+	return true;
+}
+
 bool USeinWorldSubsystem::VerifyIncrementalCanonicalStateRoot(
 	FGuid& OutRoot,
 	FString& OutError) const
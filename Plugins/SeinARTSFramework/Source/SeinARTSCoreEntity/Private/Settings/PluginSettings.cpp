@@ -62,6 +62,7 @@ USeinARTSCoreSettings::USeinARTSCoreSettings()
 	// same tick. (A* heuristic weight + iteration cap moved to USeinNavigationAStar's CDO.)
 	, PathRequestsPerTickBudget(32)
 	, NavReachabilityProfileCacheCapacity(8)
+	, NavFlowFieldCacheCapacity(4)
 	// Nav projection tunables — see PluginSettings.h for rationale on each.
 	// 100cm tolerance covers typical curb / step deltas without crossing
 	// platform-height boundaries; 30-cell ring radius is ~30m on a 100cm grid,
@@ -97,15 +98,23 @@ USeinARTSCoreSettings::USeinARTSCoreSettings()
 	, bNetworkingEnabled(true)
 	, TurnRate(10)
 	, InputDelayTurns(3)
+	, bAdaptiveInputDelay(false)
+	, MinAdaptiveInputDelayTurns(1)
+	, MaxAdaptiveInputDelayTurns(6)
+	, AdaptiveInputDelayWindowTurns(50)
 	, MaxPlayers(8)
 	, RelayActorClass(FSoftClassPath(TEXT("/Script/SeinARTSNet.SeinNetRelay")))
 	, bDeterminismChecksEnabled(true)
 	, DeterminismCheckIntervalTurns(10)
+	, bDesyncLocalizationEnabled(true)
+	, DesyncProofRetainedChecks(3)
 	// Replay recording policy. These bound local memory/disk work only and are
 	// deliberately absent from ComputeConfigFingerprint's sim-affecting field list.
 	, ReplayCheckpointIntervalTurns(3000)
 	, ReplayTurnBatchSize(64)
 	, ReplayMaxFileSizeMiB(16384)
+	, ReplayCheckpointKeyframeInterval(1)
+	, bCompressReplayCheckpoints(false)
 	// Drop-in/drop-out: BasicAI policy + 30s grace period default. Ships
 	// `USeinNullAIController` as the framework no-op fallback so the auto-spawn
 	// path is exercised end-to-end even before designers wire their own AI
@@ -275,6 +284,10 @@ void USeinARTSCoreSettings::ApplySimPerformanceCvars() const
 	{
 		CV->Set(ParallelMinBatch, ECVF_SetByProjectSetting);
 	}
+	if (IConsoleVariable* CV = CM.FindConsoleVariable(TEXT("Sein.Sim.DedicatedThread")))
+	{
+		CV->Set(bDedicatedSimulationThread ? 1 : 0, ECVF_SetByProjectSetting);
+	}
 	if (IConsoleVariable* CV = CM.FindConsoleVariable(TEXT("Sein.Sim.AsyncPathfinding")))
 	{
 		CV->Set(bAsyncPathfinding ? 1 : 0, ECVF_SetByProjectSetting);
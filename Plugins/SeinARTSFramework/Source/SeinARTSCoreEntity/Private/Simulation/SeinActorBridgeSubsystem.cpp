@@ -9,9 +9,11 @@
 #include "Simulation/SeinWorldSubsystem.h"
 #include "Actor/SeinActor.h"
 #include "Actor/SeinEntityComponent.h"
+#include "Components/SeinExtentsComponent.h"
 #include "Events/SeinVisualEvent.h"
 #include "Types/FixedPoint.h"
 #include "Engine/World.h"
+#include "ConvexVolume.h"
 #include "EngineUtils.h"
 #include "ProfilingDebugging/CpuProfilerTrace.h"
 
@@ -35,6 +37,42 @@ namespace SeinBridgeLocal
 		}
 		return false;
 	}
+
+	/** Radius around the actor location that encloses every marquee hull
+	 *  source: the sim extents shapes (scaled, for the legacy hull path) or,
+	 *  without extents, the actor's visual bounds box. */
+	static double ComputePresentationRadius(const ASeinActor& Actor,
+		const FSeinExtentsComponent* Extents)
+	{
+		if (Extents && Extents->Shapes.Num() > 0)
+		{
+			const double Scale = FMath::Max(1.0, Actor.GetActorScale3D().GetAbsMax());
+			double Radius = 0.0;
+			for (const FSeinExtentsShape& Shape : Extents->Shapes)
+			{
+				const double HalfX = Shape.HalfExtentX.ToFloat();
+				const double HalfY = Shape.HalfExtentY.ToFloat();
+				const double Reach = Shape.Shape == ESeinExtentsShape::Box
+					? FMath::Sqrt(HalfX * HalfX + HalfY * HalfY)
+					: FMath::Abs(static_cast<double>(Shape.Radius.ToFloat()));
+				const double Height = FMath::Max(0.0, static_cast<double>(Shape.Height.ToFloat()));
+				// Capsule caps reach one radius past the height on each end.
+				const double ShapeRadius =
+					Shape.LocalOffset.ToVector().Size() + Height + 2.0 * Reach;
+				Radius = FMath::Max(Radius, Scale * ShapeRadius);
+			}
+			return Radius;
+		}
+		FVector Origin, BoxExtent;
+		Actor.GetActorBounds(/*bOnlyCollidingComponents=*/false, Origin, BoxExtent);
+		// No bounded components reports an empty box at the world origin, not
+		// at the actor.
+		if (BoxExtent.IsZero())
+		{
+			return 0.0;
+		}
+		return FVector::Dist(Origin, Actor.GetActorLocation()) + BoxExtent.Size();
+	}
 }
 
 void USeinActorBridgeSubsystem::Initialize(FSubsystemCollectionBase& Collection)
@@ -141,6 +179,9 @@ void USeinActorBridgeSubsystem::Deinitialize()
 	SimFrameDelegateHandle.Reset();
 	OnActorRegistered.Clear();
 	EntityActorMap.Empty();
+	PresentationSpheres.Empty();
+	PresentationEntities.Empty();
+	PresentationRowByHandle.Empty();
 
 	Super::Deinitialize();
 
@@ -191,6 +232,9 @@ void USeinActorBridgeSubsystem::HandleSimFrame(
 	int32 /*LatestTick*/, int32 TicksProcessed)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(Sein_Presentation_ActorBridgeSync);
+	PresentationSpheres.Reset();
+	PresentationEntities.Reset();
+	PresentationRowByHandle.Reset();
 	for (auto It = EntityActorMap.CreateIterator(); It; ++It)
 	{
 		if (!It->Value.IsValid())
@@ -206,10 +250,83 @@ void USeinActorBridgeSubsystem::HandleSimFrame(
 		// component IS the bridge surface — render-side ACs that need sim
 		// state subscribe to its OnVisualEvent multicast or query sim
 		// storage directly.
-		if (USeinEntityComponent* Comp = Actor->GetEntityBridge())
+		USeinEntityComponent* Comp = Actor->GetEntityBridge();
+		if (Comp)
 		{
 			Comp->OnSimFrame(TicksProcessed);
 		}
+		AppendPresentationRow(It->Key, *Actor, Comp);
+	}
+}
+
+void USeinActorBridgeSubsystem::AppendPresentationRow(FSeinEntityHandle Handle,
+	ASeinActor& Actor, const USeinEntityComponent* Bridge)
+{
+	const USeinWorldSubsystem* Sim = SimSubsystem.Get();
+	const FSeinEntity* Entity = Sim ? Sim->GetEntity(Handle) : nullptr;
+	if (!Entity)
+	{
+		return;
+	}
+
+	// The actor interpolates between the two latest sim locations until the
+	// next frame, so one sphere around the segment covers every render frame
+	// the row is queried in.
+	FVector From = Actor.GetActorLocation();
+	FVector To = From;
+	if (Bridge)
+	{
+		Bridge->GetInterpolationSegment(From, To);
+	}
+	const double Radius =
+		SeinBridgeLocal::ComputePresentationRadius(
+			Actor, Sim->GetComponent<FSeinExtentsComponent>(Handle))
+		+ 0.5 * FVector::Dist(From, To);
+	PresentationSpheres.Emplace(0.5 * (From + To), Radius);
+
+	FSeinPresentationEntity& Row = PresentationEntities.AddDefaulted_GetRef();
+	Row.Handle = Handle;
+	Row.Owner = Sim->GetEntityOwner(Handle);
+	Row.Actor = &Actor;
+	Row.bSelectable = Entity->IsSelectable();
+	PresentationRowByHandle.Add(Handle, PresentationEntities.Num() - 1);
+}
+
+void USeinActorBridgeSubsystem::RemovePresentationRow(FSeinEntityHandle Handle)
+{
+	int32 Row = INDEX_NONE;
+	if (!PresentationRowByHandle.RemoveAndCopyValue(Handle, Row))
+	{
+		return;
+	}
+	// Swap-remove keeps the sphere array dense; only the moved row needs its
+	// lookup entry repointed.
+	PresentationSpheres.RemoveAtSwap(Row, 1, EAllowShrinking::No);
+	PresentationEntities.RemoveAtSwap(Row, 1, EAllowShrinking::No);
+	if (PresentationEntities.IsValidIndex(Row))
+	{
+		PresentationRowByHandle.Add(PresentationEntities[Row].Handle, Row);
+	}
+}
+
+void USeinActorBridgeSubsystem::QueryPresentationVolume(
+	const FConvexVolume& Volume, bool bSelectableOnly, TArray<int32>& OutRows) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(Sein_Presentation_IndexQuery);
+	OutRows.Reset();
+	// FConvexVolume tests each sphere against four permuted planes per vector
+	// op; the dense sphere array keeps the scan on contiguous memory.
+	for (int32 Row = 0; Row < PresentationSpheres.Num(); ++Row)
+	{
+		const FVector4& Sphere = PresentationSpheres[Row];
+		if (bSelectableOnly && !PresentationEntities[Row].bSelectable)
+		{
+			continue;
+		}
+		if (Volume.IntersectSphere(FVector(Sphere), Sphere.W))
+		{
+			OutRows.Add(Row);
+		}
 	}
 }
 
@@ -316,6 +433,7 @@ void USeinActorBridgeSubsystem::SpawnActorForEntity(FSeinEntityHandle Handle, co
 
 void USeinActorBridgeSubsystem::HandleEntityDestroyed(FSeinEntityHandle Handle, const FSeinVisualEvent& DestroyEvent)
 {
+	RemovePresentationRow(Handle);
 	TWeakObjectPtr<ASeinActor>* ActorPtr = EntityActorMap.Find(Handle);
 	if (!ActorPtr || !ActorPtr->IsValid())
 	{
@@ -377,6 +495,7 @@ void USeinActorBridgeSubsystem::ReconcileBridgeAfterRestore()
 				TEXT("ReconcileBridgeAfterRestore: culling orphan actor %s (entity %s no longer in sim)"),
 				*Actor->GetName(), *Handle.ToString());
 		}
+		RemovePresentationRow(Handle);
 		It.RemoveCurrent();
 	}
 
@@ -453,6 +572,9 @@ void USeinActorBridgeSubsystem::RegisterActor(FSeinEntityHandle Handle, ASeinAct
 	}
 
 	EntityActorMap.Add(Handle, Actor);
+	// Index the actor now so HUD queries see it before the next sim frame.
+	RemovePresentationRow(Handle);
+	AppendPresentationRow(Handle, *Actor, Actor->GetEntityBridge());
 	OnActorRegistered.Broadcast(Handle);
 
 	UE_LOG(LogSeinBridge, Verbose,
@@ -463,4 +585,5 @@ void USeinActorBridgeSubsystem::RegisterActor(FSeinEntityHandle Handle, ASeinAct
 void USeinActorBridgeSubsystem::UnregisterActor(FSeinEntityHandle Handle)
 {
 	EntityActorMap.Remove(Handle);
+	RemovePresentationRow(Handle);
 }
@@ -0,0 +1,192 @@
+/**
+ * SeinARTS Framework - Copyright (c) 2026 Phenom Studios, Inc.
+ *
+ * @file         SeinSimulationThread.cpp
+ * @author       RJ Macklem
+ * @created      17 Oct 2026
+ * @latest       17 Oct 2026
+ * @brief        Dedicated simulation worker: kick/join handshake and
+ *               game-thread hops.
+ */
+
+#include "Simulation/SeinSimulationThread.h"
+#include "HAL/Event.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/RunnableThread.h"
+
+namespace
+{
+	int32 GSeinSimDedicatedThread = 0;
+	FAutoConsoleVariableRef CVarSeinSimDedicatedThread(
+		TEXT("Sein.Sim.DedicatedThread"),
+		GSeinSimDedicatedThread,
+		TEXT("Run each frame's fixed-tick batch on a dedicated simulation thread.\n")
+		TEXT("  0 (default) = ticks run on the game thread inside the core ticker.\n")
+		TEXT("  1           = eligible game worlds kick the batch at end of frame and join it when\n")
+		TEXT("                the next world tick starts. Frames that must stay on the game thread fall back\n")
+		TEXT("                and are counted (see USeinWorldSubsystem::GetSimulationThreadStats).\n")
+		TEXT("Scheduling only: ticks are bit-identical either way."),
+		ECVF_Default);
+
+	thread_local FSeinSimulationThread* GSeinCurrentSimulationThread = nullptr;
+}
+
+const TCHAR* SeinSimulationThreadFallbackName(ESeinSimulationThreadFallback Fallback)
+{
+	switch (Fallback)
+	{
+	case ESeinSimulationThreadFallback::None:              return TEXT("None");
+	case ESeinSimulationThreadFallback::NotGameWorld:      return TEXT("NotGameWorld");
+	case ESeinSimulationThreadFallback::ObserverVeto:      return TEXT("ObserverVeto");
+	case ESeinSimulationThreadFallback::ReplayPlayback:    return TEXT("ReplayPlayback");
+	case ESeinSimulationThreadFallback::CatchUpWindow:     return TEXT("CatchUpWindow");
+	case ESeinSimulationThreadFallback::BlueprintSimLogic: return TEXT("BlueprintSimLogic");
+	case ESeinSimulationThreadFallback::ThreadUnavailable: return TEXT("ThreadUnavailable");
+	}
+	return TEXT("Unknown");
+}
+
+FSeinSimulationThread::FSeinSimulationThread(const TCHAR* ThreadName)
+{
+	BatchReady = FPlatformProcess::GetSynchEventFromPool(false);
+	GameThreadWake = FPlatformProcess::GetSynchEventFromPool(false);
+	Thread = FRunnableThread::Create(this, ThreadName, 0, TPri_AboveNormal);
+}
+
+FSeinSimulationThread::~FSeinSimulationThread()
+{
+	Join();
+	if (Thread)
+	{
+		// Kill(true) calls Stop() and waits for Run() to return.
+		Thread->Kill(true);
+		delete Thread;
+		Thread = nullptr;
+	}
+	FPlatformProcess::ReturnSynchEventToPool(BatchReady);
+	FPlatformProcess::ReturnSynchEventToPool(GameThreadWake);
+	BatchReady = nullptr;
+	GameThreadWake = nullptr;
+}
+
+bool FSeinSimulationThread::IsEnabled()
+{
+	return GSeinSimDedicatedThread != 0;
+}
+
+FSeinSimulationThread* FSeinSimulationThread::GetCurrent()
+{
+	return GSeinCurrentSimulationThread;
+}
+
+void FSeinSimulationThread::Kick(TUniqueFunction<void()>&& Batch)
+{
+	check(IsInGameThread());
+	check(Thread && !IsBatchInFlight());
+	PendingBatch = MoveTemp(Batch);
+	bBatchInFlight.store(true, std::memory_order_release);
+	BatchReady->Trigger();
+}
+
+double FSeinSimulationThread::Join()
+{
+	if (!IsBatchInFlight())
+	{
+		return 0.0;
+	}
+	check(IsInGameThread());
+	const double WaitStart = FPlatformTime::Seconds();
+	// GameThreadWake is auto-reset and fires for both hand-back requests and
+	// batch completion, so a trigger that lands between the checks below and
+	// the Wait is remembered rather than lost.
+	for (;;)
+	{
+		ServiceGameThreadRequests();
+		if (!IsBatchInFlight())
+		{
+			break;
+		}
+		GameThreadWake->Wait();
+	}
+	ServiceGameThreadRequests();
+	return FPlatformTime::Seconds() - WaitStart;
+}
+
+void FSeinSimulationThread::RunOnGameThread(TUniqueFunction<void()>&& Work)
+{
+	if (!IsCurrentThread())
+	{
+		check(IsInGameThread());
+		Work();
+		return;
+	}
+	FGameThreadRequest Request;
+	Request.Work = MoveTemp(Work);
+	Request.Done = FPlatformProcess::GetSynchEventFromPool(false);
+	GameThreadHops.fetch_add(1, std::memory_order_relaxed);
+	// The game thread may be inside a blocking collection on its way to the
+	// join; holding the GC lock across the wait would deadlock the two.
+	const bool bHeldGCGuard = BatchGCGuard.IsSet();
+	BatchGCGuard.Reset();
+	GameThreadRequests.Enqueue(&Request);
+	GameThreadWake->Trigger();
+	Request.Done->Wait();
+	FPlatformProcess::ReturnSynchEventToPool(Request.Done);
+	if (bHeldGCGuard)
+	{
+		BatchGCGuard.Emplace();
+	}
+}
+
+void FSeinSimulationThread::YieldToGarbageCollection()
+{
+	check(IsCurrentThread());
+	if (BatchGCGuard.IsSet())
+	{
+		BatchGCGuard.Reset();
+		BatchGCGuard.Emplace();
+	}
+}
+
+void FSeinSimulationThread::ServiceGameThreadRequests()
+{
+	FGameThreadRequest* Request = nullptr;
+	while (GameThreadRequests.Dequeue(Request))
+	{
+		Request->Work();
+		Request->Done->Trigger();
+	}
+}
+
+uint32 FSeinSimulationThread::Run()
+{
+	GSeinCurrentSimulationThread = this;
+	for (;;)
+	{
+		BatchReady->Wait();
+		if (bStopping.load(std::memory_order_acquire))
+		{
+			break;
+		}
+		if (PendingBatch)
+		{
+			TUniqueFunction<void()> Batch = MoveTemp(PendingBatch);
+			PendingBatch = nullptr;
+			// Garbage collection waits for the batch rather than racing it.
+			BatchGCGuard.Emplace();
+			Batch();
+			BatchGCGuard.Reset();
+		}
+		bBatchInFlight.store(false, std::memory_order_release);
+		GameThreadWake->Trigger();
+	}
+	GSeinCurrentSimulationThread = nullptr;
+	return 0;
+}
+
+void FSeinSimulationThread::Stop()
+{
+	bStopping.store(true, std::memory_order_release);
+	BatchReady->Trigger();
+}
@@ -65,6 +65,7 @@
 #include "Math/MathLib.h"
 #include "Tags/SeinARTSGameplayTags.h"
 #include "Containers/Ticker.h"
+#include "Async/TaskGraphInterfaces.h"
 #include "StructUtils/InstancedStruct.h"
 #include "UObject/StrongObjectPtr.h"
 #include "UObject/StructOnScope.h"
@@ -340,6 +341,74 @@ namespace
 		return true;
 	}
 
+	/** Validates declared scheduling access, canonicalizes its state keys, and
+	 *  folds the system's own contributor keys into its write set. Runs after
+	 *  the descriptor's required keys are canonical. */
+	bool CanonicalizeSystemAccess(
+		FSeinSystemDescriptor& Descriptor,
+		FString& OutError)
+	{
+		OutError.Reset();
+		FSeinSystemAccess& Access = Descriptor.Access;
+		if (!Access.bDeclared)
+		{
+			if (Access.bRequiresGameThread
+				|| !Access.ReadComponents.IsEmpty()
+				|| !Access.WriteComponents.IsEmpty()
+				|| !Access.ReadStateKeys.IsEmpty()
+				|| !Access.WriteStateKeys.IsEmpty()
+				|| Access.ReadShared != ESeinSystemSharedState::None
+				|| Access.WriteShared != ESeinSystemSharedState::None)
+			{
+				OutError =
+					TEXT("Access lists are set but the access is not declared.");
+				return false;
+			}
+			return true;
+		}
+		if (Access.ReadComponents.Contains(nullptr)
+			|| Access.WriteComponents.Contains(nullptr))
+		{
+			OutError = TEXT("A declared component struct is null.");
+			return false;
+		}
+
+		const auto CanonicalizeKeys = [&OutError](TArray<FName>& Keys)
+		{
+			TArray<FString> CanonicalKeys;
+			CanonicalKeys.Reserve(Keys.Num());
+			for (FName RawKey : Keys)
+			{
+				FString CanonicalKey;
+				FString KeyError;
+				if (!CanonicalizeSystemStateContributorKey(
+						RawKey, CanonicalKey, KeyError))
+				{
+					OutError = FString::Printf(
+						TEXT("state key '%s': %s"),
+						*RawKey.ToString(),
+						*KeyError);
+					return false;
+				}
+				CanonicalKeys.AddUnique(MoveTemp(CanonicalKey));
+			}
+			CanonicalKeys.Sort();
+			Keys.Reset(CanonicalKeys.Num());
+			for (const FString& CanonicalKey : CanonicalKeys)
+			{
+				Keys.Add(FName(*CanonicalKey));
+			}
+			return true;
+		};
+		for (FName OwnedKey :
+			Descriptor.RequiredCanonicalStateContributorKeys)
+		{
+			Access.WriteStateKeys.AddUnique(OwnedKey);
+		}
+		return CanonicalizeKeys(Access.ReadStateKeys)
+			&& CanonicalizeKeys(Access.WriteStateKeys);
+	}
+
 	class FSeinStructOnScopeGCGuard final : public FGCObject
 	{
 	public:
@@ -854,6 +923,7 @@ void USeinWorldSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 	NextAbilityActivationID = 1;
 	TimeAccumulator = 0.0f;
 	Systems.Reset();
+	SystemWaves.Reset();
 	AuthoritativeDestinationProviders.Reset();
 	NextAuthoritativeDestinationProviderToken = 1;
 	bAuthoritativeDestinationQueryInProgress = false;
@@ -1050,10 +1120,12 @@ void USeinWorldSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 	// Register built-in systems
 	BuiltInSystems.Add(new FSeinEffectTickSystem());
 	BuiltInSystems.Add(new FSeinCollisionBroadphaseSystem());
-	BuiltInSystems.Add(new FSeinCooldownSystem());
+	FSeinCooldownSystem* CooldownSystem = new FSeinCooldownSystem();
+	BuiltInSystems.Add(CooldownSystem);
 	BuiltInSystems.Add(new FSeinAbilityTickSystem());
 	BuiltInSystems.Add(new FSeinProductionSystem());
-	BuiltInSystems.Add(new FSeinLifespanSystem());
+	FSeinLifespanSystem* LifespanSystem = new FSeinLifespanSystem();
+	BuiltInSystems.Add(LifespanSystem);
 	BuiltInSystems.Add(new FSeinCommandBrokerSystem());
 	BuiltInSystems.Add(new FSeinCollisionResolutionSystem());
 
@@ -1062,6 +1134,15 @@ void USeinWorldSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 		RegisterSystem(Sys);
 	}
 
+	// The cooling-ability list and the lifespan timing wheel are derived from
+	// restored cooldowns/deadlines; drop both so their next tick rebuilds
+	// against the replacement pool and storage.
+	OnAuthoritativeStateRestored.AddLambda([CooldownSystem, LifespanSystem]()
+	{
+		CooldownSystem->InvalidateCoolingAbilities();
+		LifespanSystem->InvalidateSchedule();
+	});
+
 	// Instantiate the pluggable collision resolver. The PostTick
 	// FSeinCollisionResolutionSystem delegates its per-tick work to this object.
 	// Resolve the configured class, falling back to the shipped Gauss-Seidel
@@ -1120,6 +1201,7 @@ void USeinWorldSubsystem::PreDeinitialize()
 	// ordered Deinitialize pass. Extension hosts may now unregister without
 	// looking like a live topology mutation. Module/hot reload does not enter
 	// this window and therefore remains fail-closed.
+	JoinSimulationThreadBatch();
 	bExecutionTopologyTeardown = true;
 	StopSimulation();
 	ReleaseSimulationScheduler();
@@ -1140,6 +1222,7 @@ void USeinWorldSubsystem::Deinitialize()
 	MatchBootstrapAuthorityOwner.Reset();
 	ClearSnapshotRestoreAuthority();
 	bMatchBootstrapClosedBroadcast = false;
+	SystemWaves.Reset();
 	ExecutionTopologyManifest.Reset();
 	ExecutionTopologyFailureReason.Reset();
 	ExecutionTopologyDigest.Invalidate();
@@ -1264,6 +1347,8 @@ void USeinWorldSubsystem::ReleaseAllModuleOwnedState()
 	AbilityPoolStateRevisions.Reset();
 	AbilityPoolMutationRevision = 0;
 	AbilityPoolTopologyRevision = 1;
+	DirtiedAbilityIDs.Reset();
+	DirtiedAbilityDrainRevision = 0;
 	CommandBrokerResolverPool.Reset();
 	CommandBrokerResolverPoolFreeList.Reset();
 	CommandBrokerResolverPoolStateRevisions.Reset();
@@ -1278,6 +1363,8 @@ void USeinWorldSubsystem::ReleaseAllModuleOwnedState()
 	}
 	CollisionResolver = nullptr;
 	PlayerStates.Reset();
+	PlayerStatePresentationRevisions.Reset();
+	PairCapabilityPresentationRevisions.Reset();
 	PairCapabilitySourceRefCounts.Reset();
 	PairCapabilityEffectiveRefCounts.Reset();
 	Factions.Reset();
@@ -1298,6 +1385,7 @@ void USeinWorldSubsystem::ReleaseAllModuleOwnedState()
 #endif
 
 	Systems.Reset();
+	SystemWaves.Reset();
 	for (ISeinSystem* System : BuiltInSystems)
 	{
 		delete System;
@@ -1305,10 +1393,12 @@ void USeinWorldSubsystem::ReleaseAllModuleOwnedState()
 	BuiltInSystems.Reset();
 
 	EntityPool.Reset();
+	EntitySpatialIndex.Reset();
 	CollisionSpatialHash.ClearStatic();
 	CollisionSpatialHash.ClearDynamic();
 	EntityTagStates.Reset();
 	EntityTagIndex.Reset();
+	EntityTagBits.Reset();
 	NamedEntityRegistry.Reset();
 	OwnerTransitionRevisions.Reset();
 	OwnerTransitionDepth = 0;
@@ -1346,6 +1436,7 @@ void USeinWorldSubsystem::ReleaseAllModuleOwnedState()
 	FSeinAttributeResolver::ClearPropertyCache();
 	OnMatchBootstrapClosed.Clear();
 	OnExecutionTopologyInvalidated.Clear();
+	SimulationThreadVetoes.Reset();
 }
 
 void USeinWorldSubsystem::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
@@ -2452,12 +2543,23 @@ bool USeinWorldSubsystem::ReserveSimulationScheduler(FString& OutError)
 		OutError = TEXT("Failed to reserve the fixed-tick scheduler.");
 		return false;
 	}
+	// A dedicated-thread batch kicked from the ticker is joined before any
+	// of this world's game-thread gameplay runs.
+	SimulationThreadJoinHandle = FWorldDelegates::OnWorldTickStart.AddUObject(
+		this, &USeinWorldSubsystem::HandleWorldTickStart);
 	bSimulationSchedulerReserved = true;
 	return true;
 }
 
 void USeinWorldSubsystem::ReleaseSimulationScheduler()
 {
+	JoinSimulationThreadBatch();
+	SimulationThread.Reset();
+	if (SimulationThreadJoinHandle.IsValid())
+	{
+		FWorldDelegates::OnWorldTickStart.Remove(SimulationThreadJoinHandle);
+		SimulationThreadJoinHandle.Reset();
+	}
 	if (TickerHandle.IsValid())
 	{
 		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
@@ -2558,6 +2660,7 @@ bool USeinWorldSubsystem::StartSimulationInternal(FString& OutError)
 
 void USeinWorldSubsystem::StopSimulation()
 {
+	JoinSimulationThreadBatch();
 	if (bSnapshotCaptureInProgress || bSnapshotRestoreInProgress)
 	{
 		UE_LOG(LogSeinSim, Error, TEXT("Simulation stop is unavailable during snapshot %s."),
@@ -2597,6 +2700,10 @@ float USeinWorldSubsystem::GetInterpolationAlpha() const
 bool USeinWorldSubsystem::TickSimulation(float DeltaTime)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(*SimulationTraceScopeName);
+	// A dedicated-thread batch kicked last frame is normally joined when this
+	// world's tick starts; a frame without a world tick joins it here.
+	JoinSimulationThreadBatch();
+
 	// A scheduler reservation is intentionally persistent while the simulation
 	// is stopped. Authorized bootstrap keeps it dormant until launch; stopped
 	// snapshot adoption keeps it dormant while an outer reconnect/catch-up
@@ -2606,8 +2713,6 @@ bool USeinWorldSubsystem::TickSimulation(float DeltaTime)
 	{
 		return bSimulationSchedulerReserved;
 	}
-	TGuardValue<bool> TickDispatchGuard(
-		bSimulationTickDispatchInProgress, true);
 
 	// Frozen sim time has a separate canonical control lane. It may dispatch one
 	// exact frame (initially Resume V1 only), but never advances CurrentTick,
@@ -2615,6 +2720,8 @@ bool USeinWorldSubsystem::TickSimulation(float DeltaTime)
 	// Resetting the accumulator prevents wall-clock catch-up after resume.
 	if (bSimPaused)
 	{
+		TGuardValue<bool> TickDispatchGuard(
+			bSimulationTickDispatchInProgress, true);
 		TimeAccumulator = 0.0f;
 		PumpPauseControlFrame();
 		return true;
@@ -2623,15 +2730,6 @@ bool USeinWorldSubsystem::TickSimulation(float DeltaTime)
 	const USeinARTSCoreSettings* Settings = GetDefault<USeinARTSCoreSettings>();
 	const int32 MaxTicks = Settings->MaxTicksPerFrame;
 
-	// TicksPerTurn: how many sim ticks make up one network turn. Derived from
-	// the two settings; integer division so a misconfiguration doesn't yield
-	// a fractional gate (better to round down and re-check sooner). Only
-	// consulted when the lockstep resolver is bound (USeinNetSubsystem
-	// registers it once the local slot is assigned).
-	const int32 TicksPerTurn = (Settings->TurnRate > 0)
-		? FMath::Max(1, Settings->SimulationTickRate / Settings->TurnRate)
-		: 1;
-
 	TimeAccumulator += DeltaTime;
 
 	// Catch-up burst: a resyncing peer must CLOSE a wall-clock deficit, which
@@ -2649,14 +2747,67 @@ bool USeinWorldSubsystem::TickSimulation(float DeltaTime)
 			FixedDeltaTimeSeconds * static_cast<float>(MaxTicks));
 	}
 
+	// Eligible frames hand the batch to the dedicated thread; the dispatch
+	// guard then stays raised until the join publishes the frame.
+	if (TimeAccumulator >= FixedDeltaTimeSeconds
+		&& ShouldRunBatchOnSimulationThread())
+	{
+		KickSimulationThreadBatch(MaxTicks);
+		return true;
+	}
+
+	TGuardValue<bool> TickDispatchGuard(
+		bSimulationTickDispatchInProgress, true);
+	FSimulationFrameRecord Frame;
+	RunFixedTickBatch(MaxTicks, true, Frame);
+	PublishSimulationFrame(Frame);
+	return bExecutionTopologyValid;
+}
+
+int32 USeinWorldSubsystem::GetTicksPerTurn()
+{
+	// How many sim ticks make up one network turn. Integer division so a
+	// misconfiguration doesn't yield a fractional gate (better to round down
+	// and re-check sooner).
+	const USeinARTSCoreSettings* Settings = GetDefault<USeinARTSCoreSettings>();
+	return (Settings->TurnRate > 0)
+		? FMath::Max(1, Settings->SimulationTickRate / Settings->TurnRate)
+		: 1;
+}
+
+bool USeinWorldSubsystem::PassTurnGate(int32 Turn)
+{
+	if (!TurnReadyResolver.Execute(Turn))
+	{
+		return false;
+	}
+	if (TurnConsumeNotifier.IsBound())
+	{
+		TurnConsumeNotifier.Execute(Turn);
+	}
+	return true;
+}
+
+void USeinWorldSubsystem::RunFixedTickBatch(
+	int32 MaxTicks,
+	bool bValidateBindingsEachTick,
+	FSimulationFrameRecord& OutFrame)
+{
+	const USeinARTSCoreSettings* Settings = GetDefault<USeinARTSCoreSettings>();
+	const int32 TicksPerTurn = GetTicksPerTurn();
+	FSeinSimulationThread* const Worker = FSeinSimulationThread::GetCurrent();
+
 	int32 TicksProcessed = 0;
 	int32 LastCompletedTickThisFrame = INDEX_NONE;
 	while (bIsRunning
 		&& TimeAccumulator >= FixedDeltaTimeSeconds
 		&& TicksProcessed < MaxTicks)
 	{
-		if (!ValidateFrozenConfigFingerprint()
-			|| !ValidateFrozenCanonicalStateWorldBindings())
+		// A dedicated-thread batch validated both at its kick: nothing on
+		// the game thread can rebind them while the batch holds the sim.
+		if (bValidateBindingsEachTick
+			&& (!ValidateFrozenConfigFingerprint()
+				|| !ValidateFrozenCanonicalStateWorldBindings()))
 		{
 			break;
 		}
@@ -2669,8 +2820,14 @@ bool USeinWorldSubsystem::TickSimulation(float DeltaTime)
 		// hasn't latched yet) = no gating, sim runs free.
 		if (TurnReadyResolver.IsBound() && (NextTick % TicksPerTurn == 0))
 		{
-			const int32 NextTurn = NextTick / TicksPerTurn;
-			if (!TurnReadyResolver.Execute(NextTurn))
+			// The gate is game-thread network code. A worker batch runs only
+			// the boundary its kick opened and ends before the next one, so
+			// the join delivers the observers that close each turn while the
+			// world still sits on that turn's last tick.
+			const bool bGateClosed = Worker
+				? TicksProcessed > 0
+				: !PassTurnGate(NextTick / TicksPerTurn);
+			if (bGateClosed)
 			{
 				// Stall — break out of the catch-up loop without consuming
 				// the accumulator. Next frame's pump will retry. The "falling
@@ -2678,10 +2835,6 @@ bool USeinWorldSubsystem::TickSimulation(float DeltaTime)
 				// break since TicksProcessed < MaxTicks may still be true.
 				break;
 			}
-			if (TurnConsumeNotifier.IsBound())
-			{
-				TurnConsumeNotifier.Execute(NextTurn);
-			}
 		}
 
 		// Replay turns are primed between ticks. Commit them only when their
@@ -2707,7 +2860,8 @@ bool USeinWorldSubsystem::TickSimulation(float DeltaTime)
 		FFixedPoint SimDeltaTime = FFixedPoint::One / FFixedPoint::FromInt(Settings->SimulationTickRate);
 
 		TickSystems(SimDeltaTime);
-		if (!bExecutionTopologyValid)
+		if (!bExecutionTopologyValid
+			|| !DeferredExecutionTopologyFailure.IsEmpty())
 		{
 			break;
 		}
@@ -2765,6 +2919,12 @@ bool USeinWorldSubsystem::TickSimulation(float DeltaTime)
 			TRACE_CPUPROFILER_EVENT_SCOPE(Sein_World_ReplayCommandBoundary);
 			ReplayCommandBoundaryNotifier.Broadcast(CurrentTick);
 		}
+		if (Worker)
+		{
+			// Observers are game-thread code; the join delivers these.
+			OutFrame.DeferredCompletedTicks.Add(CurrentTick);
+		}
+		else
 		{
 			TRACE_CPUPROFILER_EVENT_SCOPE(Sein_World_TickCompletedObservers);
 			TGuardValue<bool> ReadOnlyGuard(bReadOnlyCallbackInProgress, true);
@@ -2772,9 +2932,35 @@ bool USeinWorldSubsystem::TickSimulation(float DeltaTime)
 			OnSimTickCompleted.Broadcast(CurrentTick);
 		}
 		LastCompletedTickThisFrame = CurrentTick;
+
+		if (Worker)
+		{
+			// A Blueprint-authored pool object that appeared this tick ends
+			// the dedicated batch; the rest drains on the game thread.
+			FString BlueprintClass;
+			if (FindBlueprintSimLogic(BlueprintClass))
+			{
+				break;
+			}
+			Worker->YieldToGarbageCollection();
+		}
 	}
 
-	if (LastCompletedTickThisFrame != INDEX_NONE)
+	OutFrame.LastCompletedTick = LastCompletedTickThisFrame;
+	OutFrame.TicksProcessed = TicksProcessed;
+	OutFrame.MaxTicks = MaxTicks;
+}
+
+void USeinWorldSubsystem::PublishSimulationFrame(
+	const FSimulationFrameRecord& Frame)
+{
+	const int32 TicksProcessed = Frame.TicksProcessed;
+	const int32 LastCompletedTickThisFrame = Frame.LastCompletedTick;
+	const int32 MaxTicks = Frame.MaxTicks;
+
+	// A headless fast-forward has no frames to present.
+	if (LastCompletedTickThisFrame != INDEX_NONE
+		&& !bUnthrottledAdvanceInProgress)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(Sein_World_FrameCompletedObservers);
 		TGuardValue<bool> ReadOnlyGuard(bReadOnlyCallbackInProgress, true);
@@ -2858,8 +3044,405 @@ bool USeinWorldSubsystem::TickSimulation(float DeltaTime)
 		}
 		TimeAccumulator = FixedDeltaTimeSeconds;
 	}
+}
+
+// ==================== Dedicated Simulation Thread ====================
+
+bool USeinWorldSubsystem::ShouldRunBatchOnSimulationThread()
+{
+	// A headless fast-forward pumps ticks, not frames.
+	if (!FSeinSimulationThread::IsEnabled() || bUnthrottledAdvanceInProgress)
+	{
+		return false;
+	}
 
-	return bExecutionTopologyValid;
+	FString Detail;
+	ESeinSimulationThreadFallback Fallback =
+		EvaluateSimulationThreadFallback(Detail);
+	if (Fallback == ESeinSimulationThreadFallback::None && !SimulationThread)
+	{
+		SimulationThread = MakeUnique<FSeinSimulationThread>(
+			*FString::Printf(TEXT("SeinSimulation_%s"), *GetWorld()->GetName()));
+	}
+	if (Fallback == ESeinSimulationThreadFallback::None
+		&& !SimulationThread->IsRunning())
+	{
+		Fallback = ESeinSimulationThreadFallback::ThreadUnavailable;
+	}
+
+	if (Fallback != LoggedSimulationThreadFallback)
+	{
+		if (Fallback == ESeinSimulationThreadFallback::None)
+		{
+			UE_LOG(LogSeinSim, Log,
+				TEXT("Fixed ticks now run on the dedicated simulation thread."));
+		}
+		else
+		{
+			UE_LOG(LogSeinSim, Log,
+				TEXT("Dedicated simulation thread unavailable (%s%s%s); fixed ticks run on the game thread."),
+				SeinSimulationThreadFallbackName(Fallback),
+				Detail.IsEmpty() ? TEXT("") : TEXT(": "),
+				*Detail);
+		}
+		LoggedSimulationThreadFallback = Fallback;
+	}
+	if (Fallback != ESeinSimulationThreadFallback::None)
+	{
+		++SimulationThreadStats.FallbackFrames;
+		SimulationThreadStats.LastFallback = Fallback;
+		SimulationThreadStats.LastFallbackDetail = MoveTemp(Detail);
+		return false;
+	}
+
+	// Both checks read engine state the worker must not touch; nothing on the
+	// game thread can change them while the batch holds the sim.
+	return ValidateFrozenConfigFingerprint()
+		&& ValidateFrozenCanonicalStateWorldBindings();
+}
+
+ESeinSimulationThreadFallback USeinWorldSubsystem::EvaluateSimulationThreadFallback(
+	FString& OutDetail)
+{
+	OutDetail.Reset();
+	// Networked game worlds qualify: the kick opens the lockstep gate and
+	// the join runs the network layer's tick observers.
+	const UWorld* World = GetWorld();
+	if (!World || World->WorldType != EWorldType::Game)
+	{
+		return ESeinSimulationThreadFallback::NotGameWorld;
+	}
+	if (bResyncCatchUpInProgress)
+	{
+		return ESeinSimulationThreadFallback::CatchUpWindow;
+	}
+	if (bReplayOwnsExternalCommandIngress
+		|| ReplayCommandBoundaryNotifier.IsBound())
+	{
+		return ESeinSimulationThreadFallback::ReplayPlayback;
+	}
+	if (IsSimulationThreadVetoed())
+	{
+		return ESeinSimulationThreadFallback::ObserverVeto;
+	}
+	if (FindBlueprintSimLogic(OutDetail))
+	{
+		return ESeinSimulationThreadFallback::BlueprintSimLogic;
+	}
+	return ESeinSimulationThreadFallback::None;
+}
+
+FDelegateHandle USeinWorldSubsystem::AddSimulationThreadVeto(
+	FSeinSimulationThreadVeto&& Veto)
+{
+	check(IsInGameThread());
+	if (!Veto.IsBound())
+	{
+		return FDelegateHandle();
+	}
+	const FDelegateHandle Handle = Veto.GetHandle();
+	SimulationThreadVetoes.Add(MoveTemp(Veto));
+	return Handle;
+}
+
+void USeinWorldSubsystem::RemoveSimulationThreadVeto(FDelegateHandle Handle)
+{
+	check(IsInGameThread());
+	if (!Handle.IsValid())
+	{
+		return;
+	}
+	SimulationThreadVetoes.RemoveAll(
+		[Handle](const FSeinSimulationThreadVeto& Veto)
+		{
+			return Veto.GetHandle() == Handle;
+		});
+}
+
+bool USeinWorldSubsystem::IsSimulationThreadVetoed() const
+{
+	for (const FSeinSimulationThreadVeto& Veto : SimulationThreadVetoes)
+	{
+		if (Veto.IsBound() && Veto.Execute())
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+namespace
+{
+	/** True when a Blueprint layer of Class carries bytecode. Data-only
+	 *  subclasses only override defaults and never enter the VM. */
+	bool ClassRunsBlueprintScript(const UClass* Class)
+	{
+		for (; Class && !Class->IsNative(); Class = Class->GetSuperClass())
+		{
+			for (TFieldIterator<UFunction> It(Class, EFieldIteratorFlags::ExcludeSuper);
+				It; ++It)
+			{
+				if (It->Script.Num() > 0)
+				{
+					return true;
+				}
+			}
+		}
+		return false;
+	}
+}
+
+bool USeinWorldSubsystem::FindBlueprintSimLogic(FString& OutClassName)
+{
+	// Script events dispatch through the Blueprint VM, which stays on the
+	// game thread. Only pool objects whose Blueprint layers hold script veto;
+	// data-only subclasses tick natively. Rescan only when a pool's
+	// membership changed.
+	if (BlueprintScanAbilityRevision != AbilityPoolTopologyRevision
+		|| BlueprintScanResolverRevision != CommandBrokerResolverPoolTopologyRevision
+		|| BlueprintScanAIControllerCount != AIControllers.Num())
+	{
+		BlueprintScanAbilityRevision = AbilityPoolTopologyRevision;
+		BlueprintScanResolverRevision = CommandBrokerResolverPoolTopologyRevision;
+		BlueprintScanAIControllerCount = AIControllers.Num();
+		BlueprintSimLogicClass.Reset();
+
+		TMap<const UClass*, bool> RunsScriptByClass;
+		auto Scan = [this, &RunsScriptByClass](const UObject* Object)
+		{
+			if (!BlueprintSimLogicClass.IsEmpty() || !Object)
+			{
+				return;
+			}
+			const UClass* Class = Object->GetClass();
+			const bool* Cached = RunsScriptByClass.Find(Class);
+			const bool bRunsScript = Cached
+				? *Cached
+				: RunsScriptByClass.Add(Class, ClassRunsBlueprintScript(Class));
+			if (bRunsScript)
+			{
+				BlueprintSimLogicClass = Class->GetPathName();
+			}
+		};
+		for (const USeinAbility* Ability : AbilityPool)
+		{
+			Scan(Ability);
+		}
+		for (const USeinCommandBrokerResolver* Resolver : CommandBrokerResolverPool)
+		{
+			Scan(Resolver);
+		}
+		for (const USeinAIController* Controller : AIControllers)
+		{
+			Scan(Controller);
+		}
+	}
+	OutClassName = BlueprintSimLogicClass;
+	return !BlueprintSimLogicClass.IsEmpty();
+}
+
+void USeinWorldSubsystem::KickSimulationThreadBatch(int32 MaxTicks)
+{
+	check(IsInGameThread());
+	bSimulationTickDispatchInProgress = true;
+
+	// The worker may not consult the lockstep gate, so the boundary a batch
+	// starts on is opened here, before ingress starts queueing: the drained
+	// turn lands in PendingCommands exactly as it does inline. A closed gate
+	// stalls like the inline pump — no batch, accumulator kept.
+	const int32 NextTick = CurrentTick + 1;
+	if (TurnReadyResolver.IsBound()
+		&& NextTick % GetTicksPerTurn() == 0
+		&& !PassTurnGate(NextTick / GetTicksPerTurn()))
+	{
+		bSimulationTickDispatchInProgress = false;
+		return;
+	}
+
+	SimulationThreadFrame = FSimulationFrameRecord();
+	++SimulationThreadStats.DedicatedFrames;
+	bSimulationBatchAwaitingJoin.store(true, std::memory_order_release);
+	SimulationThread->Kick([this, MaxTicks]()
+	{
+		const double BatchStart = FPlatformTime::Seconds();
+		RunFixedTickBatch(MaxTicks, false, SimulationThreadFrame);
+		SimulationThreadBatchSeconds = FPlatformTime::Seconds() - BatchStart;
+	});
+}
+
+void USeinWorldSubsystem::JoinSimulationThreadBatch()
+{
+	if (!IsSimulationBatchInFlight())
+	{
+		return;
+	}
+	TRACE_CPUPROFILER_EVENT_SCOPE(Sein_World_SimulationThreadJoin);
+	check(IsInGameThread());
+	SimulationThreadStats.JoinWaitSeconds += SimulationThread->Join();
+	SimulationThreadStats.BatchSeconds += SimulationThreadBatchSeconds;
+	SimulationThreadStats.GameThreadHops =
+		SimulationThread->GetGameThreadHopCount();
+	// The worker is done: from here the game thread owns the sim again, so
+	// the observers below (network turn gossip among them) read it freely.
+	bSimulationBatchAwaitingJoin.store(false, std::memory_order_release);
+
+	// The dispatch guard raised at the kick still holds: finish any failure
+	// the worker recorded, then let presentation read the finished frame
+	// before a handed-over command can touch the sim.
+	if (!DeferredExecutionTopologyFailure.IsEmpty())
+	{
+		const FString Reason = MoveTemp(DeferredExecutionTopologyFailure);
+		DeferredExecutionTopologyFailure.Reset();
+		InvalidateFrozenExecutionTopology(Reason);
+	}
+	for (const FSimulationDeferredAIEmit& Emit :
+		SimulationThreadFrame.DeferredAIEmits)
+	{
+		// Emit order, ahead of the observers that close the emitting turn.
+		if (!AIEmitInterceptor.IsBound()
+			|| !AIEmitInterceptor.Execute(Emit.OwnedPlayerID, Emit.Command))
+		{
+			UE_LOG(LogSeinAI, Error,
+				TEXT("EmitCommand: active topology adapter declined AI slot %s command; dropping instead of applying host-only."),
+				*Emit.OwnedPlayerID.ToString());
+		}
+	}
+	if (SimulationThreadFrame.DeferredCompletedTicks.Num() > 0)
+	{
+		// In tick order, but every observer sees the batch's final state.
+		TRACE_CPUPROFILER_EVENT_SCOPE(Sein_World_TickCompletedObservers);
+		TGuardValue<bool> ReadOnlyGuard(bReadOnlyCallbackInProgress, true);
+		TGuardValue<bool> ObserverGuard(bObserverCallbackInProgress, true);
+		for (const int32 CompletedTick :
+			SimulationThreadFrame.DeferredCompletedTicks)
+		{
+			OnSimTickCompleted.Broadcast(CompletedTick);
+		}
+	}
+	PublishSimulationFrame(SimulationThreadFrame);
+	bSimulationTickDispatchInProgress = false;
+	DrainSimulationThreadInbox();
+}
+
+void USeinWorldSubsystem::HandleWorldTickStart(
+	UWorld* TickingWorld, ELevelTick /*TickType*/, float /*DeltaSeconds*/)
+{
+	if (TickingWorld == GetWorld())
+	{
+		JoinSimulationThreadBatch();
+	}
+}
+
+void USeinWorldSubsystem::WaitForSimulationThreadBatch()
+{
+	check(IsInGameThread());
+	JoinSimulationThreadBatch();
+}
+
+bool USeinWorldSubsystem::IsSimulationBatchInFlight() const
+{
+	// Until the join, not until the worker finishes: a batch that completes
+	// early still owes the game thread its frame and the queued commands.
+	return bSimulationBatchAwaitingJoin.load(std::memory_order_acquire);
+}
+
+bool USeinWorldSubsystem::ShouldQueueForSimulationThread() const
+{
+	return IsSimulationBatchInFlight() && !IsOnSimulationOwningThread();
+}
+
+bool USeinWorldSubsystem::IsOnSimulationOwningThread() const
+{
+	if (!IsSimulationBatchInFlight())
+	{
+		return IsInGameThread();
+	}
+	// A handed-back system runs on the game thread while the worker waits.
+	return SimulationThread->IsCurrentThread()
+		|| (bGameThreadSystemTickInProgress && IsInGameThread());
+}
+
+void USeinWorldSubsystem::DrainSimulationThreadInbox()
+{
+	FSimulationThreadIngress Ingress;
+	while (SimulationThreadInbox.Dequeue(Ingress))
+	{
+		if (Ingress.bLocalDraft)
+		{
+			SubmitLocalCommandDraft(
+				Ingress.Command, Ingress.bRequestMatchAdministration);
+		}
+		else
+		{
+			EnqueueAuthenticatedCommand(
+				Ingress.Command,
+				Ingress.AuthenticatedPlayer,
+				Ingress.AuthenticatedIssuerKind);
+		}
+	}
+}
+
+int32 USeinWorldSubsystem::AdvanceSimulationUnthrottled(int32 MaxTicks)
+{
+	check(IsInGameThread());
+	JoinSimulationThreadBatch();
+	if (MaxTicks <= 0 || bSimulationTickDispatchInProgress)
+	{
+		return 0;
+	}
+	TGuardValue<bool> UnthrottledGuard(bUnthrottledAdvanceInProgress, true);
+
+	// One exact tick per pump: priming the accumulator with a single fixed
+	// delta keeps every gate, observer and replay boundary on the ordinary
+	// path while the float accumulator never carries a residue between ticks.
+	const int32 StartTick = CurrentTick;
+	while (bIsRunning && CurrentTick - StartTick < MaxTicks)
+	{
+		const int32 TickBefore = CurrentTick;
+		const bool bPausedBefore = bSimPaused;
+		TimeAccumulator = FixedDeltaTimeSeconds;
+		if (!TickSimulation(0.0f))
+		{
+			break;
+		}
+		// A stalled turn gate, or a pause frame that did not resume, would
+		// spin forever; hand control back to the caller instead.
+		if (CurrentTick == TickBefore && bSimPaused == bPausedBefore)
+		{
+			break;
+		}
+	}
+	TimeAccumulator = 0.0f;
+	return CurrentTick - StartTick;
+}
+
+void USeinWorldSubsystem::SetSystemTickTimingEnabled(bool bEnabled)
+{
+	SEIN_CHECK_NOT_PARALLEL();
+	bSystemTickTimingEnabled = bEnabled;
+	SystemTickSeconds.Reset();
+	SystemTickCounts.Reset();
+	if (bEnabled)
+	{
+		SystemTickSeconds.SetNumZeroed(Systems.Num());
+		SystemTickCounts.SetNumZeroed(Systems.Num());
+	}
+}
+
+void USeinWorldSubsystem::GetSystemTickTimings(
+	TArray<FSeinSystemTickTiming>& OutTimings) const
+{
+	OutTimings.Reset(SystemTickSeconds.Num());
+	for (int32 Index = 0;
+		Index < Systems.Num() && Index < SystemTickSeconds.Num();
+		++Index)
+	{
+		FSeinSystemTickTiming& Timing = OutTimings.AddDefaulted_GetRef();
+		Timing.CanonicalStableID = Systems[Index].CanonicalStableID;
+		Timing.Phase = Systems[Index].Descriptor.Phase;
+		Timing.TotalSeconds = SystemTickSeconds[Index];
+		Timing.TickCount = SystemTickCounts[Index];
+	}
 }
 
 bool USeinWorldSubsystem::ValidateFrozenConfigFingerprint()
@@ -2953,16 +3536,7 @@ void USeinWorldSubsystem::TickSystems(FFixedPoint DeltaTime)
 	{
 		SEIN_SIM_SCOPE(*this)
 		// Phase 1: PreTick — effects, cooldowns, resources
-		for (const FRegisteredSystem& Registered : Systems)
-		{
-			if (Registered.System
-				&& Registered.Descriptor.Phase == ESeinTickPhase::PreTick)
-			{
-				TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(*Registered.CanonicalStableID);
-				Registered.System->Tick(DeltaTime, *this);
-				if (!bExecutionTopologyValid) return;
-			}
-		}
+		if (!TickSystemPhase(ESeinTickPhase::PreTick, DeltaTime)) return;
 
 		// Advance deterministic match state and expire idle votes.
 		{
@@ -2988,17 +3562,7 @@ void USeinWorldSubsystem::TickSystems(FFixedPoint DeltaTime)
 			TRACE_CPUPROFILER_EVENT_SCOPE(Sein_World_ProcessCommands);
 			ProcessCommands();
 		}
-		for (const FRegisteredSystem& Registered : Systems)
-		{
-			if (Registered.System
-				&& Registered.Descriptor.Phase
-				== ESeinTickPhase::CommandProcessing)
-			{
-				TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(*Registered.CanonicalStableID);
-				Registered.System->Tick(DeltaTime, *this);
-				if (!bExecutionTopologyValid) return;
-			}
-		}
+		if (!TickSystemPhase(ESeinTickPhase::CommandProcessing, DeltaTime)) return;
 
 		// Phase 3: AbilityExecution — tick active abilities and latent actions
 		if (LatentActionManager)
@@ -3006,47 +3570,137 @@ void USeinWorldSubsystem::TickSystems(FFixedPoint DeltaTime)
 			TRACE_CPUPROFILER_EVENT_SCOPE(Sein_World_TickLatentActions);
 			LatentActionManager->TickAll(DeltaTime, *this);
 		}
-		for (const FRegisteredSystem& Registered : Systems)
-		{
-			if (Registered.System
-				&& Registered.Descriptor.Phase
-				== ESeinTickPhase::AbilityExecution)
-			{
-				TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(*Registered.CanonicalStableID);
-				Registered.System->Tick(DeltaTime, *this);
-				if (!bExecutionTopologyValid) return;
-			}
-		}
+		if (!TickSystemPhase(ESeinTickPhase::AbilityExecution, DeltaTime)) return;
 
 		// Phase 4: PostTick — cleanup and settled tick state
 		{
 			TRACE_CPUPROFILER_EVENT_SCOPE(Sein_World_ProcessDeferredDestroys);
 			ProcessDeferredDestroys();
 		}
+		if (!TickSystemPhase(ESeinTickPhase::PostTick, DeltaTime)) return;
+
+		// Phase 5: terminal, stateless observation of settled authoritative state.
+		TickSystemPhase(ESeinTickPhase::FinalObservation, DeltaTime);
+	}
+}
+
+void USeinWorldSubsystem::TickRegisteredSystem(
+	const FRegisteredSystem& Registered,
+	FFixedPoint DeltaTime)
+{
+	if (Registered.System)
+	{
+		// Game-thread-affine systems broadcast presentation delegates; on the
+		// dedicated thread the worker hands them back and waits for the join
+		// to run them. Each one is a counted hop.
+		FSeinSimulationThread* Worker = FSeinSimulationThread::GetCurrent();
+		if (Worker && Registered.Descriptor.Access.bRequiresGameThread)
+		{
+			Worker->RunOnGameThread([this, &Registered, DeltaTime]()
+			{
+				TGuardValue<bool> HandBackGuard(
+					bGameThreadSystemTickInProgress, true);
+				SEIN_SIM_SCOPE(*this)
+				TickRegisteredSystem(Registered, DeltaTime);
+			});
+			return;
+		}
+
+		TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(*Registered.CanonicalStableID);
+		const int32 TimingSlot = static_cast<int32>(&Registered - Systems.GetData());
+		if (!bSystemTickTimingEnabled
+			|| !SystemTickSeconds.IsValidIndex(TimingSlot))
+		{
+			Registered.System->Tick(DeltaTime, *this);
+			return;
+		}
+		const double StartedAt = FPlatformTime::Seconds();
+		Registered.System->Tick(DeltaTime, *this);
+		SystemTickSeconds[TimingSlot] += FPlatformTime::Seconds() - StartedAt;
+		++SystemTickCounts[TimingSlot];
+	}
+}
+
+bool USeinWorldSubsystem::TickSystemPhase(
+	ESeinTickPhase Phase,
+	FFixedPoint DeltaTime)
+{
+	// Reference schedule: one system at a time in canonical order.
+	if (!SeinSimParallelSystemsEnabled())
+	{
 		for (const FRegisteredSystem& Registered : Systems)
 		{
-			if (Registered.System
-				&& Registered.Descriptor.Phase == ESeinTickPhase::PostTick)
+			if (Registered.Descriptor.Phase == Phase)
 			{
-				TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(*Registered.CanonicalStableID);
-				Registered.System->Tick(DeltaTime, *this);
-				if (!bExecutionTopologyValid) return;
+				TickRegisteredSystem(Registered, DeltaTime);
+				if (!bExecutionTopologyValid) return false;
 			}
 		}
+		return true;
+	}
+
+	// Wave schedule. Every conflicting pair sits in waves ordered as the
+	// canonical sequence orders it, and systems inside one wave commute, so
+	// the result equals the reference schedule.
+	for (const FSystemWave& Wave : SystemWaves)
+	{
+		if (Wave.Phase != Phase)
+		{
+			continue;
+		}
+		if (Wave.SystemIndices.Num() == 1)
+		{
+			TickRegisteredSystem(Systems[Wave.SystemIndices[0]], DeltaTime);
+			if (!bExecutionTopologyValid) return false;
+			continue;
+		}
 
-		// Phase 5: terminal, stateless observation of settled authoritative state.
-		for (const FRegisteredSystem& Registered : Systems)
+		// At most one game-thread-affine member per wave (conflict rule); it
+		// runs inline while the others go to workers.
+		const int32 InlineSlot = Wave.SystemIndices.IndexOfByPredicate(
+			[this](int32 SystemIndex)
+			{
+				return Systems[SystemIndex].Descriptor.Access.bRequiresGameThread;
+			});
+		TArray<int32, TInlineAllocator<8>> WorkerIndices;
+		for (int32 Slot = 0; Slot < Wave.SystemIndices.Num(); ++Slot)
 		{
-			if (Registered.System
-				&& Registered.Descriptor.Phase
-					== ESeinTickPhase::FinalObservation)
+			if (Slot != InlineSlot)
 			{
-				TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(*Registered.CanonicalStableID);
-				Registered.System->Tick(DeltaTime, *this);
-				if (!bExecutionTopologyValid) return;
+				WorkerIndices.Add(Wave.SystemIndices[Slot]);
 			}
 		}
+
+		TRACE_CPUPROFILER_EVENT_SCOPE(Sein_World_TickSystemWave);
+#if !UE_BUILD_SHIPPING
+		SeinSetInParallelSection(true);
+#endif
+		FGraphEventArray WorkerTasks;
+		WorkerTasks.Reserve(WorkerIndices.Num());
+		for (int32 SystemIndex : WorkerIndices)
+		{
+			WorkerTasks.Add(FFunctionGraphTask::CreateAndDispatchWhenReady(
+				[this, SystemIndex, DeltaTime]()
+				{
+					SEIN_SIM_SCOPE(*this)
+					TickRegisteredSystem(Systems[SystemIndex], DeltaTime);
+				},
+				TStatId(),
+				nullptr,
+				ENamedThreads::AnyHiPriThreadHiPriTask));
+		}
+		if (InlineSlot != INDEX_NONE)
+		{
+			TickRegisteredSystem(
+				Systems[Wave.SystemIndices[InlineSlot]], DeltaTime);
+		}
+		FTaskGraphInterface::Get().WaitUntilTasksComplete(WorkerTasks);
+#if !UE_BUILD_SHIPPING
+		SeinSetInParallelSection(false);
+#endif
+		if (!bExecutionTopologyValid) return false;
 	}
+	return true;
 }
 
 // ==================== Command Processing ====================
@@ -4172,7 +4826,7 @@ USeinWorldSubsystem::ECommandHandleResult USeinWorldSubsystem::TryHandleBrokerOr
 		const FSeinExtentsShape* Shape = nullptr;
 		if (PFSpec && !PFSpec->BuildingClass.IsNull())
 		{
-			UClass* BuildingClass = PFSpec->BuildingClass.LoadSynchronous();
+			UClass* BuildingClass = SeinLoadSimulationClass(PFSpec->BuildingClass);
 			Shape = SeinExtentsHelpers::GetPrimaryExtentsShape(BuildingClass);
 		}
 
@@ -5302,6 +5956,17 @@ void USeinWorldSubsystem::EnqueueAuthenticatedCommand(
 	FSeinPlayerID AuthenticatedPlayer,
 	ESeinCommandIssuerKind AuthenticatedIssuerKind)
 {
+	// Queued ahead of the parallel check: that flag is global, and a running
+	// batch may be inside a parallel pass on its own thread.
+	if (ShouldQueueForSimulationThread())
+	{
+		FSimulationThreadIngress Ingress;
+		Ingress.Command = Command;
+		Ingress.AuthenticatedPlayer = AuthenticatedPlayer;
+		Ingress.AuthenticatedIssuerKind = AuthenticatedIssuerKind;
+		SimulationThreadInbox.Enqueue(MoveTemp(Ingress));
+		return;
+	}
 	SEIN_CHECK_NOT_PARALLEL();
 	if (bObserverCallbackInProgress)
 	{
@@ -5390,6 +6055,19 @@ void USeinWorldSubsystem::SubmitLocalCommandDraft(
 	const FSeinCommand& Draft,
 	bool bRequestMatchAdministration)
 {
+	// A network submitter is game-thread code: drafts raised on the worker
+	// wait for the join like any other handed-over ingress.
+	if (ShouldQueueForSimulationThread()
+		|| (LocalCommandSubmitter.IsBound()
+			&& FSeinSimulationThread::GetCurrent()))
+	{
+		FSimulationThreadIngress Ingress;
+		Ingress.Command = Draft;
+		Ingress.bLocalDraft = true;
+		Ingress.bRequestMatchAdministration = bRequestMatchAdministration;
+		SimulationThreadInbox.Enqueue(MoveTemp(Ingress));
+		return;
+	}
 	SEIN_CHECK_NOT_PARALLEL();
 	if (bObserverCallbackInProgress)
 	{
@@ -6111,6 +6789,7 @@ void USeinWorldSubsystem::ProcessDeferredDestroys()
 FSeinEntity* USeinWorldSubsystem::GetEntityMutable(
 	FSeinEntityHandle Handle)
 {
+	CheckSimulationStateAccess(TEXT("GetEntityMutable"));
 	if (!RequireMutableStateAccess(TEXT("GetEntityMutable")))
 	{
 		return nullptr;
@@ -6120,6 +6799,7 @@ FSeinEntity* USeinWorldSubsystem::GetEntityMutable(
 
 const FSeinEntity* USeinWorldSubsystem::GetEntity(FSeinEntityHandle Handle) const
 {
+	CheckSimulationStateAccess(TEXT("GetEntity"));
 	return EntityPool.Get(Handle);
 }
 
@@ -6167,6 +6847,7 @@ void USeinWorldSubsystem::EndResyncCatchUpWindow()
 
 FSeinEntityPool* USeinWorldSubsystem::GetEntityPoolMutable()
 {
+	CheckSimulationStateAccess(TEXT("GetEntityPoolMutable"));
 	if (!RequireMutableStateAccess(TEXT("GetEntityPoolMutable")))
 	{
 		return nullptr;
@@ -6174,6 +6855,13 @@ FSeinEntityPool* USeinWorldSubsystem::GetEntityPoolMutable()
 	return &EntityPool;
 }
 
+const FSeinEntitySpatialIndex& USeinWorldSubsystem::GetEntitySpatialIndex() const
+{
+	CheckSimulationStateAccess(TEXT("GetEntitySpatialIndex"));
+	EntitySpatialIndex.EnsureSyncedWith(EntityPool);
+	return EntitySpatialIndex;
+}
+
 FSeinCollisionSpatialHash*
 USeinWorldSubsystem::GetCollisionSpatialHashMutable()
 {
@@ -6187,12 +6875,14 @@ USeinWorldSubsystem::GetCollisionSpatialHashMutable()
 
 bool USeinWorldSubsystem::IsEntityAlive(FSeinEntityHandle Handle) const
 {
+	CheckSimulationStateAccess(TEXT("IsEntityAlive"));
 	const FSeinEntity* Entity = EntityPool.Get(Handle);
 	return Entity && Entity->IsAlive();
 }
 
 FSeinPlayerID USeinWorldSubsystem::GetEntityOwner(FSeinEntityHandle Handle) const
 {
+	CheckSimulationStateAccess(TEXT("GetEntityOwner"));
 	return EntityPool.GetOwner(Handle);
 }
 
@@ -6293,6 +6983,7 @@ TSubclassOf<ASeinActor> USeinWorldSubsystem::GetEntityActorClass(FSeinEntityHand
 
 FSeinPlayerState* USeinWorldSubsystem::GetPlayerStateMutable(FSeinPlayerID PlayerID)
 {
+	CheckSimulationStateAccess(TEXT("GetPlayerStateMutable"));
 	if (!RequireMutableStateAccess(TEXT("GetPlayerStateMutable")))
 	{
 		return nullptr;
@@ -6305,6 +6996,15 @@ FSeinPlayerState* USeinWorldSubsystem::GetPlayerStateMutable(FSeinPlayerID Playe
 	return State;
 }
 
+void USeinWorldSubsystem::MarkPlayerStatePresentationDirty(FSeinPlayerID PlayerID)
+{
+	if (PlayerStates.Contains(PlayerID))
+	{
+		PlayerStatePresentationRevisions.Add(
+			PlayerID, NextPresentationMutationRevision());
+	}
+}
+
 void USeinWorldSubsystem::MarkCanonicalAuxiliaryStateDirty()
 {
 	CanonicalAuxiliaryMutationRevision =
@@ -6313,6 +7013,54 @@ void USeinWorldSubsystem::MarkCanonicalAuxiliaryStateDirty()
 			: CanonicalAuxiliaryMutationRevision + 1;
 }
 
+uint64 USeinWorldSubsystem::NextPresentationMutationRevision()
+{
+	PresentationMutationRevision =
+		PresentationMutationRevision == MAX_uint64
+			? 1
+			: PresentationMutationRevision + 1;
+	return PresentationMutationRevision;
+}
+
+void USeinWorldSubsystem::MarkPairCapabilityPresentationDirty(
+	FSeinPlayerID SourcePlayer,
+	FSeinPlayerID TargetPlayer)
+{
+	const uint64 Revision = NextPresentationMutationRevision();
+	PairCapabilityPresentationRevisions.Add(SourcePlayer, Revision);
+	PairCapabilityPresentationRevisions.Add(TargetPlayer, Revision);
+}
+
+void USeinWorldSubsystem::GatherEntityPresentationRevisions(
+	FSeinEntityHandle Handle,
+	TArray<uint64>& OutRevisions) const
+{
+	OutRevisions.Add(PresentationRestoreEpoch);
+	OutRevisions.Add(EntityPool.GetMutationRevision(Handle));
+	for (const TPair<UScriptStruct*, ISeinComponentStorage*>& Pair : ComponentStorages)
+	{
+		OutRevisions.Add(Pair.Value ? Pair.Value->GetMutationRevision(Handle) : 0);
+	}
+	const FSeinEntityTagState* TagState = EntityTagStates.Find(Handle);
+	OutRevisions.Add(TagState ? TagState->MutationRevision : 0);
+	if (const FSeinAbilityComponent* AbilityComp =
+			GetComponent<FSeinAbilityComponent>(Handle))
+	{
+		for (const int32 AbilityID : AbilityComp->AbilityInstanceIDs)
+		{
+			OutRevisions.Add(AbilityPoolStateRevisions.IsValidIndex(AbilityID)
+				? AbilityPoolStateRevisions[AbilityID]
+				: 0);
+		}
+	}
+	// Ability availability reads the owner's resources and tech, so the owner's
+	// player state is part of what an entity presents.
+	const FSeinPlayerID Owner = EntityPool.GetOwner(Handle);
+	OutRevisions.Add(PlayerStatePresentationRevisions.FindRef(Owner));
+	// Relation and friendly presentation read the owner's pair capabilities.
+	OutRevisions.Add(PairCapabilityPresentationRevisions.FindRef(Owner));
+}
+
 // ==================== Player & Faction ====================
 
 void USeinWorldSubsystem::RegisterPlayer(FSeinPlayerID PlayerID, FSeinFactionID FactionID, uint8 TeamID)
@@ -6407,11 +7155,13 @@ void USeinWorldSubsystem::RegisterPlayer(FSeinPlayerID PlayerID, FSeinFactionID
 
 const FSeinPlayerState* USeinWorldSubsystem::GetPlayerState(FSeinPlayerID PlayerID) const
 {
+	CheckSimulationStateAccess(TEXT("GetPlayerState"));
 	return PlayerStates.Find(PlayerID);
 }
 
 bool USeinWorldSubsystem::GetPlayerStateCopy(FSeinPlayerID PlayerID, FSeinPlayerState& OutState) const
 {
+	CheckSimulationStateAccess(TEXT("GetPlayerStateCopy"));
 	const FSeinPlayerState* Found = PlayerStates.Find(PlayerID);
 	if (Found)
 	{
@@ -6532,6 +7282,10 @@ bool USeinWorldSubsystem::GrantPairCapability(
 			*CapabilityTag.ToString());
 		return false;
 	}
+	if (EffectiveCount == 0)
+	{
+		MarkPairCapabilityPresentationDirty(SourcePlayer, TargetPlayer);
+	}
 	++EffectiveCount;
 	MarkCanonicalAuxiliaryStateDirty();
 	return true;
@@ -6598,6 +7352,7 @@ bool USeinWorldSubsystem::RevokePairCapability(
 		if (*EffectiveCount <= 0)
 		{
 			PairCapabilityEffectiveRefCounts.Remove(EffectiveKey);
+			MarkPairCapabilityPresentationDirty(SourcePlayer, TargetPlayer);
 		}
 	}
 	else
@@ -6703,6 +7458,12 @@ void USeinWorldSubsystem::SeedTeamPairCapabilitiesForPlayer(
 
 void USeinWorldSubsystem::RebuildPairCapabilityEffectiveCache()
 {
+	// A repaired cache can change any pair's effective set.
+	for (const TPair<FSeinPlayerID, FSeinPlayerState>& Pair : PlayerStates)
+	{
+		PairCapabilityPresentationRevisions.Add(
+			Pair.Key, NextPresentationMutationRevision());
+	}
 	PairCapabilityEffectiveRefCounts.Reset();
 	for (const TPair<FSeinPairCapabilitySourceKey, int32>& Pair :
 		PairCapabilitySourceRefCounts)
@@ -6894,6 +7655,10 @@ int32 USeinWorldSubsystem::RegisterAbilityInstance(USeinAbility* Ability)
 		// clears the whole allocation and would make unchanged live objects look
 		// untracked every time a new ability occupied an appended slot.
 		AbilityPoolStateRevisions.SetNum(AbilityPool.Num());
+		if (AbilityPoolStateRevisions[ID] <= DirtiedAbilityDrainRevision)
+		{
+			DirtiedAbilityIDs.Add(ID);
+		}
 		++AbilityPoolMutationRevision;
 		if (AbilityPoolMutationRevision == 0)
 		{
@@ -6962,6 +7727,10 @@ void USeinWorldSubsystem::MarkAbilityRuntimeStateDirty(
 	{
 		return;
 	}
+	if (AbilityPoolStateRevisions[ID] <= DirtiedAbilityDrainRevision)
+	{
+		DirtiedAbilityIDs.Add(ID);
+	}
 	++AbilityPoolMutationRevision;
 	if (AbilityPoolMutationRevision == 0)
 	{
@@ -6970,6 +7739,13 @@ void USeinWorldSubsystem::MarkAbilityRuntimeStateDirty(
 	AbilityPoolStateRevisions[ID] = AbilityPoolMutationRevision;
 }
 
+void USeinWorldSubsystem::DrainDirtiedAbilityIDs(TArray<int32>& OutIDs)
+{
+	OutIDs = MoveTemp(DirtiedAbilityIDs);
+	DirtiedAbilityIDs.Reset();
+	DirtiedAbilityDrainRevision = AbilityPoolMutationRevision;
+}
+
 bool USeinWorldSubsystem::TryAllocateAbilityActivationID(
 	int64& OutID)
 {
@@ -10188,6 +10964,7 @@ bool USeinWorldSubsystem::RestoreSnapshot(
 		CollisionSpatialHash.ClearStatic();
 		CollisionSpatialHash.ClearDynamic();
 		CollisionSpatialHash.MarkStaticDirty();
+		EntitySpatialIndex.Reset();
 
 		// Staged class resolution makes bridge reconciliation non-fallible after
 		// the authoritative commit begins.
@@ -10195,6 +10972,7 @@ bool USeinWorldSubsystem::RestoreSnapshot(
 		EntityPool = MoveTemp(StagedEntityPool);
 		EntityTagStates = MoveTemp(StagedEntityTagStates);
 		EntityTagIndex = MoveTemp(StagedEntityTagIndex);
+		RebuildEntityTagBits();
 		NamedEntityRegistry = MoveTemp(StagedNamedEntityRegistry);
 		ActiveVotes = MoveTemp(StagedActiveVotes);
 
@@ -10222,6 +11000,7 @@ bool USeinWorldSubsystem::RestoreSnapshot(
 			}
 		}
 		AbilityPoolFreeList = MoveTemp(StagedAbilityFreeList);
+		DirtiedAbilityIDs.Reset();
 		AbilityPoolStateRevisions.SetNumZeroed(AbilityPool.Num());
 		for (int32 Index = 0; Index < AbilityPool.Num(); ++Index)
 		{
@@ -10297,6 +11076,7 @@ bool USeinWorldSubsystem::RestoreSnapshot(
 	// cull/spawn callbacks can query them. The callback is read-only with
 	// respect to authoritative state; custom extensions never receive Core's
 	// private restore capability and must not depend on restored actors.
+	++PresentationRestoreEpoch;
 	{
 		TGuardValue<bool> ReadOnlyGuard(bReadOnlyCallbackInProgress, true);
 		TGuardValue<bool> ObserverGuard(bObserverCallbackInProgress, true);
@@ -10463,24 +11243,26 @@ bool FSeinEntityTagState::UngrantTagInternal(const FGameplayTag& Tag)
 	return false;
 }
 
+// Queries answer from EntityTagBits — the same hierarchical semantics as
+// CombinedTags.HasTag/HasAny/HasAll without the handle-map lookup or the
+// container walk. Sweeps should hoist CompileTagMask out of their loop.
+
 bool USeinWorldSubsystem::HasTag(FSeinEntityHandle Handle, FGameplayTag Tag) const
 {
-	const FSeinEntityTagState* TagState = EntityTagStates.Find(Handle);
-	return TagState ? TagState->HasTag(Tag) : false;
+	return Tag.IsValid()
+		&& EntityTagBits.MatchesAll(Handle, EntityTagBits.Compile(Tag));
 }
 
 bool USeinWorldSubsystem::HasAnyTag(FSeinEntityHandle Handle, const FGameplayTagContainer& Tags) const
 {
 	if (Tags.IsEmpty()) return false;
-	const FSeinEntityTagState* TagState = EntityTagStates.Find(Handle);
-	return TagState ? TagState->HasAnyTag(Tags) : false;
+	return EntityTagBits.MatchesAny(Handle, EntityTagBits.Compile(Tags));
 }
 
 bool USeinWorldSubsystem::HasAllTags(FSeinEntityHandle Handle, const FGameplayTagContainer& Tags) const
 {
 	if (Tags.IsEmpty()) return true; // vacuously true — no tags required
-	const FSeinEntityTagState* TagState = EntityTagStates.Find(Handle);
-	return TagState ? TagState->HasAllTags(Tags) : false;
+	return EntityTagBits.MatchesAll(Handle, EntityTagBits.Compile(Tags));
 }
 
 const FGameplayTagContainer& USeinWorldSubsystem::GetEntityTags(FSeinEntityHandle Handle) const
@@ -10558,10 +11340,12 @@ bool USeinWorldSubsystem::GrantTag(FSeinEntityHandle Handle, FGameplayTag Tag)
 		return false;
 	}
 	MarkCanonicalAuxiliaryStateDirty();
+	TagState.MutationRevision = NextPresentationMutationRevision();
 
 	if (TagState.GrantTagInternal(Tag))
 	{
 		EntityTagIndex.FindOrAdd(Tag).Add(Handle);
+		EntityTagBits.SetEntityTags(Handle, TagState.CombinedTags);
 	}
 	return true;
 }
@@ -10573,6 +11357,7 @@ void USeinWorldSubsystem::UngrantTag(FSeinEntityHandle Handle, FGameplayTag Tag)
 	FSeinEntityTagState* TagState = EntityTagStates.Find(Handle);
 	if (!TagState) return;
 	MarkCanonicalAuxiliaryStateDirty();
+	TagState->MutationRevision = NextPresentationMutationRevision();
 
 	if (TagState->UngrantTagInternal(Tag))
 	{
@@ -10584,6 +11369,7 @@ void USeinWorldSubsystem::UngrantTag(FSeinEntityHandle Handle, FGameplayTag Tag)
 				EntityTagIndex.Remove(Tag);
 			}
 		}
+		EntityTagBits.SetEntityTags(Handle, TagState->CombinedTags);
 	}
 }
 
@@ -10609,6 +11395,7 @@ void USeinWorldSubsystem::GrantPlayerTag(FSeinPlayerID PlayerID, FGameplayTag Ta
 	if (Old == 0)
 	{
 		State->PlayerTags.AddTag(Tag);
+		MarkPlayerStatePresentationDirty(PlayerID);
 	}
 }
 
@@ -10627,6 +11414,7 @@ void USeinWorldSubsystem::UngrantPlayerTag(FSeinPlayerID PlayerID, FGameplayTag
 	{
 		State->PlayerTagRefCounts.Remove(Tag);
 		State->PlayerTags.RemoveTag(Tag);
+		MarkPlayerStatePresentationDirty(PlayerID);
 	}
 }
 
@@ -10690,6 +11478,7 @@ void USeinWorldSubsystem::ReplaceBaseTags(FSeinEntityHandle Handle, const FGamep
 	}
 
 	TagState.BaseTags = NewBaseTags;
+	TagState.MutationRevision = NextPresentationMutationRevision();
 	for (const FGameplayTag& Tag : ToUngrant) UngrantTag(Handle, Tag);
 	for (const FGameplayTag& Tag : ToGrant)   GrantTag(Handle, Tag);
 }
@@ -11694,6 +12483,13 @@ USeinWorldSubsystem::FEffectApplyResult USeinWorldSubsystem::ApplyEffectTransact
 		return ResolveEffect(EffectLocator) != nullptr;
 	};
 
+	// Every branch below writes the storage; player-scoped stacks feed the
+	// modifiers owned entities present.
+	if (Definition.Scope != ESeinModifierScope::Instance)
+	{
+		MarkPlayerStatePresentationDirty(OwnerID);
+	}
+
 	if (Existing && Definition.StackingRule == ESeinEffectStackingRule::Stack)
 	{
 		const int32 ClampedStacks = FMath::Clamp(
@@ -12016,11 +12812,13 @@ bool USeinWorldSubsystem::RemovePlayerEffect(FSeinPlayerID PlayerID, int64 Effec
 	{
 		return false;
 	}
-	if (RemoveEffectFromStorage(PlayerState->ClassEffects, EffectInstanceID, PlayerID, bByExpiration))
+	if (RemoveEffectFromStorage(PlayerState->ClassEffects, EffectInstanceID, PlayerID, bByExpiration)
+		|| RemoveEffectFromStorage(PlayerState->PlayerEffects, EffectInstanceID, PlayerID, bByExpiration))
 	{
+		MarkPlayerStatePresentationDirty(PlayerID);
 		return true;
 	}
-	return RemoveEffectFromStorage(PlayerState->PlayerEffects, EffectInstanceID, PlayerID, bByExpiration);
+	return false;
 }
 
 bool USeinWorldSubsystem::HasInstanceEffectWithTag(FSeinEntityHandle Target, FGameplayTag Tag) const
@@ -12183,6 +12981,7 @@ ISeinComponentStorage*
 USeinWorldSubsystem::GetComponentStorageMutable(
 	UScriptStruct* StructType)
 {
+	CheckSimulationStateAccess(TEXT("GetComponentStorageMutable"));
 	if (!RequireMutableStateAccess(
 		TEXT("GetComponentStorageMutable")))
 	{
@@ -12194,6 +12993,7 @@ USeinWorldSubsystem::GetComponentStorageMutable(
 
 const ISeinComponentStorage* USeinWorldSubsystem::GetComponentStorageRaw(UScriptStruct* StructType) const
 {
+	CheckSimulationStateAccess(TEXT("GetComponentStorageRaw"));
 	ISeinComponentStorage* const* Found = ComponentStorages.Find(StructType);
 	return Found ? *Found : nullptr;
 }
@@ -12267,6 +13067,18 @@ void USeinWorldSubsystem::InvalidateFrozenExecutionTopology(
 	{
 		return;
 	}
+	if (FSeinSimulationThread::GetCurrent())
+	{
+		// The worker cannot stop the simulation it is running. The batch ends
+		// after this tick and the join completes the invalidation.
+		if (DeferredExecutionTopologyFailure.IsEmpty())
+		{
+			DeferredExecutionTopologyFailure = Reason.IsEmpty()
+				? TEXT("The deterministic execution topology became invalid.")
+				: Reason;
+		}
+		return;
+	}
 	RecordExecutionTopologyFailure(Reason);
 
 	if (MatchBootstrapState != ESeinMatchBootstrapState::Consumed)
@@ -12285,8 +13097,8 @@ void USeinWorldSubsystem::InvalidateFrozenExecutionTopology(
 void USeinWorldSubsystem::InvalidateDeterministicExecutionContract(
 	const FString& Reason)
 {
-	checkf(IsInGameThread(),
-		TEXT("A deterministic execution contract was invalidated away from the game thread."));
+	checkf(IsOnSimulationOwningThread(),
+		TEXT("A deterministic execution contract was invalidated away from the simulation's owning thread."));
 	InvalidateFrozenExecutionTopology(Reason);
 }
 
@@ -12786,8 +13598,8 @@ bool USeinWorldSubsystem::ApplySelectionDestinationPlanProviders(
 	FString* OutError)
 {
 	if (OutError) OutError->Reset();
-	checkf(IsInGameThread(),
-		TEXT("Selection-destination providers may only execute on the game thread."));
+	checkf(IsOnSimulationOwningThread(),
+		TEXT("Selection-destination providers may only execute on the simulation's owning thread."));
 	if (bSelectionDestinationPlanQueryInProgress)
 	{
 		const FString Error =
@@ -13100,8 +13912,8 @@ bool USeinWorldSubsystem::IsBrokerOwnedFrozenDestination(
 
 bool USeinWorldSubsystem::HasAuthoritativeDestinationProviders() const
 {
-	checkf(IsInGameThread(),
-		TEXT("Authoritative-destination availability may only be queried on the game thread."));
+	checkf(IsOnSimulationOwningThread(),
+		TEXT("Authoritative-destination availability may only be queried on the simulation's owning thread."));
 	if (!AuthoritativeDestinationProviders.IsEmpty()
 		|| AuthoritativeDestinationResolver.IsBound())
 	{
@@ -13140,8 +13952,8 @@ bool USeinWorldSubsystem::HasAuthoritativeDestinationProviders() const
 bool USeinWorldSubsystem::IsAuthoritativeDestination(
 	const FSeinAuthoritativeDestinationQuery& Query)
 {
-	checkf(IsInGameThread(),
-		TEXT("Authoritative-destination providers may only execute on the game thread."));
+	checkf(IsOnSimulationOwningThread(),
+		TEXT("Authoritative-destination providers may only execute on the simulation's owning thread."));
 	if (IsBrokerOwnedFrozenDestination(Query))
 	{
 		return true;
@@ -13384,6 +14196,19 @@ bool USeinWorldSubsystem::RegisterSystem(
 			true);
 	}
 
+	{
+		FString AccessError;
+		if (!CanonicalizeSystemAccess(Descriptor, AccessError))
+		{
+			return Reject(
+				FString::Printf(
+					TEXT("Simulation system '%s' declares invalid scheduling access: %s"),
+					*CanonicalStableID,
+					*AccessError),
+				true);
+		}
+	}
+
 	Descriptor.StableSystemID = FName(*CanonicalStableID);
 	for (const FRegisteredSystem& Registered : Systems)
 	{
@@ -13591,6 +14416,28 @@ bool USeinWorldSubsystem::TryBuildExecutionTopologyCandidate(
 			SystemClaimedContributors.Add(ClaimedKey);
 		}
 	}
+	// Declared access may name other owners' contributors, but only ones the
+	// frozen schema actually carries.
+	for (const FRegisteredSystem& Registered : Systems)
+	{
+		const FSeinSystemAccess& Access = Registered.Descriptor.Access;
+		for (const TArray<FName>* Keys :
+			{&Access.ReadStateKeys, &Access.WriteStateKeys})
+		{
+			for (FName Key : *Keys)
+			{
+				const FString AccessKey = Key.ToString().ToLower();
+				if (!AvailableCanonicalStateContributors.Contains(AccessKey))
+				{
+					OutError = FString::Printf(
+						TEXT("Simulation system '%s' declares access to missing canonical-state contributor '%s'."),
+						*Registered.CanonicalStableID,
+						*AccessKey);
+					return false;
+				}
+			}
+		}
+	}
 	// Reverse direction: captured state with no live owner is a bootstrap
 	// error. Conditional providers may use their external exemption only when
 	// their owning subsystem proves that the corresponding world feature is
@@ -13701,15 +14548,88 @@ void USeinWorldSubsystem::AdoptExecutionTopologyCandidate(
 	check(Candidate.IsValid());
 
 	Systems = MoveTemp(Candidate.Systems);
+	CompileExecutionSchedule(Systems, SystemWaves);
 	ExecutionTopologyManifest = MoveTemp(Candidate.Manifest);
 	ExecutionTopologyDigest = Candidate.Digest;
 	bExecutionTopologyFrozen = true;
 	UE_LOG(LogSeinSim, Log,
-		TEXT("Execution topology frozen (%d systems, digest=%s)."),
+		TEXT("Execution topology frozen (%d systems, %d waves, digest=%s)."),
 		Systems.Num(),
+		SystemWaves.Num(),
 		*ExecutionTopologyDigest.ToString(EGuidFormats::Digits));
 }
 
+void USeinWorldSubsystem::CompileExecutionSchedule(
+	TArray<FRegisteredSystem>& InOutSystems,
+	TArray<FSystemWave>& OutWaves)
+{
+	// The dependency DAG has an edge from every system to each later system of
+	// its phase that it conflicts with. A system's wave is its longest-path
+	// depth, so an edge always crosses to a strictly later wave and same-wave
+	// systems never conflict. Systems arrive in canonical order; the schedule
+	// is therefore a pure function of the frozen descriptors.
+	OutWaves.Reset();
+	int32 PhaseStart = 0;
+	while (PhaseStart < InOutSystems.Num())
+	{
+		const ESeinTickPhase Phase = InOutSystems[PhaseStart].Descriptor.Phase;
+		int32 PhaseEnd = PhaseStart;
+		while (PhaseEnd < InOutSystems.Num()
+			&& InOutSystems[PhaseEnd].Descriptor.Phase == Phase)
+		{
+			++PhaseEnd;
+		}
+
+		int32 WaveCount = 0;
+		for (int32 Later = PhaseStart; Later < PhaseEnd; ++Later)
+		{
+			int32 Wave = 0;
+			for (int32 Earlier = PhaseStart; Earlier < Later; ++Earlier)
+			{
+				if (InOutSystems[Earlier].ScheduleWave >= Wave
+					&& InOutSystems[Earlier].Descriptor.Access.ConflictsWith(
+						InOutSystems[Later].Descriptor.Access))
+				{
+					Wave = InOutSystems[Earlier].ScheduleWave + 1;
+				}
+			}
+			InOutSystems[Later].ScheduleWave = Wave;
+			WaveCount = FMath::Max(WaveCount, Wave + 1);
+		}
+
+		const int32 FirstWave = OutWaves.Num();
+		OutWaves.AddDefaulted(WaveCount);
+		for (int32 Wave = 0; Wave < WaveCount; ++Wave)
+		{
+			OutWaves[FirstWave + Wave].Phase = Phase;
+		}
+		for (int32 Index = PhaseStart; Index < PhaseEnd; ++Index)
+		{
+			OutWaves[FirstWave + InOutSystems[Index].ScheduleWave]
+				.SystemIndices.Add(Index);
+		}
+		PhaseStart = PhaseEnd;
+	}
+}
+
+int32 USeinWorldSubsystem::GetExecutionScheduleWave(
+	FName StableSystemID) const
+{
+	if (!bExecutionTopologyFrozen)
+	{
+		return INDEX_NONE;
+	}
+	const FString Key = StableSystemID.ToString().ToLower();
+	for (const FRegisteredSystem& Registered : Systems)
+	{
+		if (Registered.CanonicalStableID == Key)
+		{
+			return Registered.ScheduleWave;
+		}
+	}
+	return INDEX_NONE;
+}
+
 bool USeinWorldSubsystem::FreezeExecutionTopology(FString& OutError)
 {
 	OutError.Reset();
@@ -14421,6 +15341,7 @@ void USeinWorldSubsystem::SeedEntityTagsFromBase(FSeinEntityHandle Handle)
 	// the entity is brand-new and hasn't had any tags touched yet).
 	FSeinEntityTagState& TagState = EntityTagStates.FindOrAdd(Handle);
 	MarkCanonicalAuxiliaryStateDirty();
+	TagState.MutationRevision = NextPresentationMutationRevision();
 
 	// Snapshot first — GrantTag doesn't touch BaseTags, but a stable
 	// iteration source is cheap and makes the intent obvious.
@@ -14452,9 +15373,28 @@ void USeinWorldSubsystem::UnindexEntityTags(FSeinEntityHandle Handle)
 
 	// Free the tag-state entry — entity is being destroyed.
 	EntityTagStates.Remove(Handle);
+	EntityTagBits.ClearEntity(Handle);
 	MarkCanonicalAuxiliaryStateDirty();
 }
 
+void USeinWorldSubsystem::RebuildEntityTagBits()
+{
+	// Handle order keeps bit assignment reproducible within a process; the
+	// bits themselves are never observable outside query answers.
+	EntityTagBits.Reset();
+	TArray<FSeinEntityHandle> Handles;
+	EntityTagStates.GetKeys(Handles);
+	Handles.Sort([](const FSeinEntityHandle& A, const FSeinEntityHandle& B)
+	{
+		return A.Index < B.Index;
+	});
+	for (const FSeinEntityHandle& Handle : Handles)
+	{
+		EntityTagBits.SetEntityTags(
+			Handle, EntityTagStates.FindChecked(Handle).CombinedTags);
+	}
+}
+
 void USeinWorldSubsystem::UnregisterHandleFromNames(FSeinEntityHandle Handle)
 {
 	bool bRemovedAny = false;
@@ -14640,7 +15580,7 @@ FSeinEntityHandle USeinWorldSubsystem::CreateBrokerForMembers(
 	{
 		if (!Settings->DefaultBrokerResolverClass.IsNull())
 		{
-			ResolverClass = Settings->DefaultBrokerResolverClass.LoadSynchronous();
+			ResolverClass = SeinLoadSimulationClass(Settings->DefaultBrokerResolverClass);
 			if (!ResolverClass || ResolverClass->HasAnyClassFlags(CLASS_Abstract))
 			{
 				UE_LOG(LogSeinSim, Error,
@@ -15053,6 +15993,14 @@ bool USeinWorldSubsystem::RouteAICommandFromController(
 	// host's sim would silently desync every peer.
 	if (AIEmitInterceptor.IsBound())
 	{
+		// The adapter is game-thread network code; a worker batch hands the
+		// command to the join, which routes it before the turn closes.
+		if (FSeinSimulationThread::GetCurrent())
+		{
+			SimulationThreadFrame.DeferredAIEmits.Add(
+				{ Controller->OwnedPlayerID, Command });
+			return true;
+		}
 		if (!AIEmitInterceptor.Execute(Controller->OwnedPlayerID, Command))
 		{
 			UE_LOG(LogSeinAI, Error,
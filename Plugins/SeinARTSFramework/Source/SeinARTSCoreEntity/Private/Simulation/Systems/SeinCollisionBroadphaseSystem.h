@@ -34,7 +34,8 @@
  * Runs before the collision resolver (PostTick) so neighbour queries see this
  * tick's positions. Full clear+rebuild of the dynamic tier each tick; the
  * static tier is only rebuilt when dirty, so maps with lots of static geometry
- * (walls/buildings) pay for them once, not every tick.
+ * (walls/buildings) pay for them once, not every tick. Writes only the hash,
+ * so it may share a wave with declared systems that do not read it.
  */
 class FSeinCollisionBroadphaseSystem final : public ISeinSystem
 {
@@ -184,7 +185,12 @@ public:
 			FName(TEXT("seinarts.core.collision_broadphase")),
 			1u,
 			ESeinTickPhase::PreTick,
-			SeinSystemPriority::CollisionBroadphase);
+			SeinSystemPriority::CollisionBroadphase)
+			.WithAccess(FSeinSystemAccess::Declared()
+				.ReadsComponent(FSeinExtentsComponent::StaticStruct())
+				.ReadsComponent(FSeinIdentityComponent::StaticStruct())
+				.ReadsShared(ESeinSystemSharedState::EntityTransforms)
+				.WritesShared(ESeinSystemSharedState::CollisionHash));
 	}
 
 private:
@@ -1,12 +1,13 @@
 /**
  * SeinARTS Framework - Copyright (c) 2026 Phenom Studios, Inc.
  * @file    SeinCooldownSystem.h
- * @brief   Ticks cooldowns on all ability instances each simulation frame.
+ * @brief   Ticks cooldowns on the ability instances that are cooling down.
  */
 
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Algo/BinarySearch.h"
 #include "Core/SeinTickPhase.h"
 #include "Core/SeinSystemPriority.h"
 #include "Simulation/SeinWorldSubsystem.h"
@@ -18,46 +19,115 @@
  * System: Cooldown Tick
  * Phase: PreTick | Priority: 10
  *
- * Iterates all entities with FSeinAbilityComponent and calls
- * TickCooldown(DeltaTime) on every ability instance, decrementing
- * cooldown timers towards zero.
+ * Calls TickCooldown(DeltaTime) on every ability instance with a nonzero
+ * CooldownRemaining whose owner is alive and still lists it, decrementing
+ * cooldown timers towards zero. Touches only ability components and the
+ * ability pool, so it may share a wave with other declared systems.
+ *
+ * Idle abilities are never visited. The system keeps a derived, ascending
+ * list of cooling pool IDs: every cooldown start goes through an ability
+ * dirty mark, so newly cooling instances are enrolled from the world's
+ * dirtied-ability feed, and an entry leaves the list on the tick it reaches
+ * zero. CooldownRemaining itself stays the canonical per-tick countdown —
+ * the list only decides which instances are looked at. A restore replaces
+ * every instance, so the list is rebuilt from the pool on the next tick.
  */
 class FSeinCooldownSystem final : public ISeinSystem
 {
 public:
 	virtual void Tick(FFixedPoint DeltaTime, USeinWorldSubsystem& World) override
 	{
+		RefreshCoolingAbilities(World);
+		if (CoolingAbilityIDs.IsEmpty()) return;
+
 		const ISeinComponentStorage* Storage =
 			World.GetComponentStorageRaw(FSeinAbilityComponent::StaticStruct());
 		if (!Storage) return;
 
-		Storage->ForEachLiveComponent([&](
-			FSeinEntityHandle Handle, const void* RawComponent)
+		const FSeinEntityPool& Pool = World.GetEntityPool();
+		int32 Kept = 0;
+		for (const int32 ID : CoolingAbilityIDs)
 		{
-			if (!World.GetEntityPool().IsValid(Handle)) return;
-			const FSeinAbilityComponent* AbilityComp =
-				static_cast<const FSeinAbilityComponent*>(RawComponent);
-			if (!AbilityComp)
+			USeinAbility* Ability = World.GetAbilityInstance(ID);
+			if (!Ability || !Ability->IsOnCooldown())
 			{
-				return;
+				continue;
 			}
 
-			for (int32 ID : AbilityComp->AbilityInstanceIDs)
+			// Same eligibility the component walk applied: a live owner whose
+			// ability component still lists this instance. Ineligible entries
+			// stay enrolled — they resume if the owner becomes eligible again.
+			const FSeinAbilityComponent* AbilityComp = Pool.IsValid(Ability->OwnerEntity)
+				? static_cast<const FSeinAbilityComponent*>(
+					Storage->GetComponentRaw(Ability->OwnerEntity))
+				: nullptr;
+			if (AbilityComp && AbilityComp->AbilityInstanceIDs.Contains(ID))
 			{
-				if (USeinAbility* Ability = World.GetAbilityInstance(ID))
-				{
-					Ability->TickCooldown(DeltaTime);
-				}
+				Ability->TickCooldown(DeltaTime);
+			}
+			if (Ability->IsOnCooldown())
+			{
+				CoolingAbilityIDs[Kept++] = ID;
 			}
-		});
+		}
+		CoolingAbilityIDs.SetNum(Kept, EAllowShrinking::No);
 	}
 
+	/** Force the next tick to rescan the ability pool. Bound to
+	 *  OnAuthoritativeStateRestored alongside the lifespan wheel. */
+	void InvalidateCoolingAbilities() { bCoolingAbilitiesValid = false; }
+
 	virtual FSeinSystemDescriptor DescribeSystem() const override
 	{
 		return FSeinSystemDescriptor::Stateless(
 			FName(TEXT("seinarts.core.cooldown_tick")),
 			1u,
 			ESeinTickPhase::PreTick,
-			SeinSystemPriority::CooldownTick);
+			SeinSystemPriority::CooldownTick)
+			.WithAccess(FSeinSystemAccess::Declared()
+				.ReadsComponent(FSeinAbilityComponent::StaticStruct())
+				.WritesShared(ESeinSystemSharedState::AbilityPool));
 	}
+
+private:
+	void RefreshCoolingAbilities(USeinWorldSubsystem& World)
+	{
+		// Always drain so the feed's revision cursor keeps pace with the pool.
+		World.DrainDirtiedAbilityIDs(DirtiedScratch);
+
+		if (!bCoolingAbilitiesValid)
+		{
+			CoolingAbilityIDs.Reset();
+			for (int32 ID = 0; ID < World.GetAbilityPoolSlotCount(); ++ID)
+			{
+				const USeinAbility* Ability = World.GetAbilityInstance(ID);
+				if (Ability && Ability->IsOnCooldown())
+				{
+					CoolingAbilityIDs.Add(ID);
+				}
+			}
+			bCoolingAbilitiesValid = true;
+			return;
+		}
+
+		for (const int32 ID : DirtiedScratch)
+		{
+			const USeinAbility* Ability = World.GetAbilityInstance(ID);
+			if (!Ability || !Ability->IsOnCooldown())
+			{
+				continue;
+			}
+			const int32 Insert = Algo::LowerBound(CoolingAbilityIDs, ID);
+			if (!CoolingAbilityIDs.IsValidIndex(Insert)
+				|| CoolingAbilityIDs[Insert] != ID)
+			{
+				CoolingAbilityIDs.Insert(ID, Insert);
+			}
+		}
+	}
+
+	/** Ascending pool IDs that may have a nonzero CooldownRemaining. */
+	TArray<int32> CoolingAbilityIDs;
+	TArray<int32> DirtiedScratch;
+	bool bCoolingAbilitiesValid = false;
 };
@@ -11,6 +11,7 @@
 #include "CoreMinimal.h"
 #include "Core/SeinTickPhase.h"
 #include "Core/SeinSystemPriority.h"
+#include "Core/SeinTimerWheel.h"
 #include "Simulation/SeinWorldSubsystem.h"
 #include "Simulation/ComponentStorage.h"
 #include "Components/SeinLifespanData.h"
@@ -20,36 +21,59 @@ class FSeinLifespanSystem final : public ISeinSystem
 public:
 	virtual void Tick(FFixedPoint /*DeltaTime*/, USeinWorldSubsystem& World) override
 	{
-		// Only entities carrying FSeinLifespanData can expire — iterate that
-		// storage's live slots directly instead of the whole pool + per-entity
-		// GetComponent miss. ForEachLiveComponent yields exact handles in the
-		// same ascending-slot order ForEachEntity did, so destroy order is
-		// unchanged and stale component occupants remain distinguishable.
-		// DestroyEntity only DEFERS (adds to PendingDestroy + flags the entity
-		// dead); it does not remove this storage's slot mid-iteration, so
-		// walking the live bit-array stays safe.
-		const ISeinComponentStorage* Storage =
-			World.GetComponentStorageRaw(FSeinLifespanData::StaticStruct());
+		ISeinComponentStorage* Storage =
+			World.GetComponentStorageMutable(FSeinLifespanData::StaticStruct());
 		if (!Storage) return;
 
 		const int32 CurrentTick = World.GetCurrentTick();
+		RefreshSchedule(*Storage, CurrentTick);
+
+		// Only deadlines crossed this tick are visited. The wheel hands them
+		// back ascending by packed (slot, generation) — the same ascending-slot
+		// order the full storage walk used — so destroy order is unchanged.
+		// DestroyEntity only DEFERS (adds to PendingDestroy + flags the entity
+		// dead); it does not remove this storage's slot mid-iteration.
+		Schedule.Advance(CurrentTick, DueKeys);
 		const FSeinEntityPool& Pool = World.GetEntityPool();
-		Storage->ForEachLiveComponent([&](
-			FSeinEntityHandle Handle,
-			const void* RawComponent)
+		const ISeinComponentStorage& ReadStorage = *Storage;
+		for (int32 Index = 0; Index < DueKeys.Num(); ++Index)
 		{
-			if (!Pool.IsValid(Handle))
+			const uint64 Key = DueKeys[Index];
+			// A superseded deadline and the current one can land on one tick.
+			if (Index > 0 && DueKeys[Index - 1] == Key)
 			{
-				return;
+				continue;
+			}
+			const FSeinEntityHandle Handle(
+				static_cast<int32>(Key >> 32),
+				static_cast<int32>(Key & 0xffffffffull));
+			const FSeinLifespanData* Lifespan = static_cast<const FSeinLifespanData*>(
+				ReadStorage.GetComponentRaw(Handle));
+			if (!Lifespan)
+			{
+				continue;
+			}
+			// Superseded by a later deadline, which has its own entry.
+			if (CurrentTick < Lifespan->ExpiresAtTick)
+			{
+				continue;
 			}
-			const FSeinLifespanData* Lifespan = static_cast<const FSeinLifespanData*>(RawComponent);
-			if (Lifespan && CurrentTick >= Lifespan->ExpiresAtTick)
+			if (Pool.IsValid(Handle))
 			{
 				World.DestroyEntity(Handle);
 			}
-		});
+			// The full walk re-examined an expired entry every tick until its
+			// component went away; keep it due so a deferred or refused destroy
+			// behaves identically.
+			Schedule.Schedule(CurrentTick + 1, Key);
+		}
 	}
 
+	/** Force the next tick to rebuild the wheel from the storage. Bound to
+	 *  OnAuthoritativeStateRestored: a restore replaces the storage and its
+	 *  process-local revisions restart. */
+	void InvalidateSchedule() { bScheduleValid = false; }
+
 	// Runs after ProcessDeferredDestroys (the PostTick pre-step, not a
 	// registered system) and marks entities for the next tick's destroy pass.
 	virtual FSeinSystemDescriptor DescribeSystem() const override
@@ -60,4 +84,77 @@ public:
 			ESeinTickPhase::PostTick,
 			SeinSystemPriority::Lifespan);
 	}
+
+private:
+	/** Deadline last put on the wheel for one storage slot. Generation 0
+	 *  means nothing is scheduled there. */
+	struct FScheduledLifespan
+	{
+		int32 Generation = 0;
+		int32 ExpiresAtTick = 0;
+	};
+
+	/** The wheel is derived from the canonical ExpiresAtTick fields and never
+	 *  serialized. Each tick it catches up from the storage's mutation journal,
+	 *  so only slots added, removed or touched since the last tick are looked
+	 *  at. A superseded deadline stays on the wheel and is dropped when it
+	 *  comes due. The full walk runs only on first use, after a restore, or
+	 *  when the storage was cleared or replaced. */
+	void RefreshSchedule(ISeinComponentStorage& Storage, int32 CurrentTick)
+	{
+		const auto SyncSlot = [this](
+			int32 SlotIndex,
+			FSeinEntityHandle Handle,
+			const void* RawComponent)
+		{
+			if (ScheduledBySlot.Num() <= SlotIndex)
+			{
+				ScheduledBySlot.SetNum(SlotIndex + 1);
+			}
+			FScheduledLifespan& Scheduled = ScheduledBySlot[SlotIndex];
+			const FSeinLifespanData* Lifespan =
+				static_cast<const FSeinLifespanData*>(RawComponent);
+			if (!Lifespan)
+			{
+				Scheduled = FScheduledLifespan();
+				return;
+			}
+			if (Scheduled.Generation == Handle.Generation
+				&& Scheduled.ExpiresAtTick == Lifespan->ExpiresAtTick)
+			{
+				return;
+			}
+			Scheduled.Generation = Handle.Generation;
+			Scheduled.ExpiresAtTick = Lifespan->ExpiresAtTick;
+			Schedule.Schedule(Lifespan->ExpiresAtTick,
+				(static_cast<uint64>(static_cast<uint32>(Handle.Index)) << 32)
+					| static_cast<uint32>(Handle.Generation));
+		};
+
+		// Draining also arms the journal, so the rebuild below starts a fresh
+		// record either way.
+		const bool bJournaled = Storage.DrainMutationJournal(SyncSlot);
+		if (bJournaled && bScheduleValid && ScheduledStorage == &Storage)
+		{
+			return;
+		}
+
+		Schedule.Reset(CurrentTick);
+		ScheduledBySlot.Reset();
+		static_cast<const ISeinComponentStorage&>(Storage).ForEachLiveComponent([&](
+			FSeinEntityHandle Handle,
+			const void* RawComponent)
+		{
+			SyncSlot(Handle.Index, Handle, RawComponent);
+		});
+
+		ScheduledStorage = &Storage;
+		bScheduleValid = true;
+	}
+
+	FSeinTimerWheel Schedule;
+	TArray<uint64> DueKeys;
+	TArray<FScheduledLifespan> ScheduledBySlot;
+	const ISeinComponentStorage* ScheduledStorage = nullptr;
+	bool bScheduleValid = false;
 };
@@ -351,6 +351,11 @@ public:
 	 *  render alpha represents only one fixed-tick interval. */
 	void OnSimFrame(int32 TicksProcessed);
 
+	/** World-space endpoints the interpolated actor location moves between
+	 *  until the next sim frame. False before the first snapshot or when the
+	 *  sim doesn't drive the actor's transform. */
+	bool GetInterpolationSegment(FVector& OutFrom, FVector& OutTo) const;
+
 	/** Handle a visual event dispatched from the simulation. Two outputs:
 	 *    1. Routes the event to the owning ASeinActor's Receive* BlueprintImplementable
 	 *       events (existing behavior — designers can react in BP without an AC).
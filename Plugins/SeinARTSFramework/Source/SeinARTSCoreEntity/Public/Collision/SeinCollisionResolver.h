@@ -27,7 +27,9 @@
  *          (`USeinARTSCoreSettings::CollisionResolverClass`). The framework ships
  *          `USeinCollisionResolverDefault` as the default: the Gauss-Seidel
  *          relaxation pass set + overlap diff. An optional
- *          `USeinCollisionResolverParallel` (default-off) ships alongside.
+ *          `USeinCollisionResolverParallel` and a graph-colored parallel
+ *          Gauss-Seidel `USeinCollisionResolverColored` (both default-off) ship
+ *          alongside.
  *          Game teams can subclass or replace it entirely (impulse-based,
  *          position-based-dynamics, etc.) without touching any other framework
  *          code. Mirrors the pluggable Navigation / Fog-of-War pattern (abstract
@@ -167,7 +169,7 @@ protected:
 
 	// ======================================================================
 	// SHARED RESOLUTION HELPERS — used verbatim by every concrete resolver
-	// (Gauss-Seidel default, parallel Jacobi, …). Lifted up from the Default
+	// (Gauss-Seidel default, parallel Jacobi, graph-colored, …). Lifted up from the Default
 	// resolver so a second strategy reuses them with NO logic change.
 	// ======================================================================
 
@@ -140,6 +140,18 @@ public:
 		return MutationRevisionCounter;
 	}
 	uint64 GetTopologyRevision() const { return TopologyRevision; }
+	/** Raw per-slot revision, live or not; 0 out of range. Lets derived
+	 *  indexes diff slots without reconstructing handles. */
+	FORCEINLINE uint64 GetSlotMutationRevision(int32 SlotIndex) const
+	{
+		return SlotMutationRevisions.IsValidIndex(SlotIndex)
+			? SlotMutationRevisions[SlotIndex]
+			: 0;
+	}
+	/** Process-unique identity of this pool's revision sequence. A pool that
+	 *  is constructed or Reset gets a fresh epoch, so revisions cached against
+	 *  a replaced pool (snapshot restore) are never mistaken for current. */
+	uint64 GetRevisionEpoch() const { return RevisionEpoch; }
 
 	/**
 	 * Current generation counter for a slot index, or 0 (invalid) if the slot
@@ -267,6 +279,7 @@ private:
 	TArray<int32> FreeList;
 	uint64 MutationRevisionCounter = 0;
 	uint64 TopologyRevision = 1;
+	uint64 RevisionEpoch = 0;
 
 	int32 ActiveCount;
 	int32 Capacity;
@@ -0,0 +1,140 @@
+/**
+ * SeinARTS Framework - Copyright (c) 2026 Phenom Studios, Inc.
+ *
+ * @file         SeinEntitySpatialIndex.h
+ * @author       RJ Macklem
+ * @created      17 Oct 2026
+ * @latest       17 Oct 2026
+ * @brief        Incrementally maintained 2D bucket grid over every live entity
+ *               — the candidate source for gameplay range/box queries
+ *               (entity-query BPFL, combat splash). Collision keeps its own
+ *               two-tier broadphase.
+ *
+ *          INCREMENTAL. The index never rebuilds per tick. Sync compares each
+ *          slot's process-local mutation revision (the same evidence the
+ *          incremental canonical-root cache consumes) against the revision it
+ *          last binned, and re-bins only the slots that moved. When nothing
+ *          in the pool changed since the last sync the check is two compares,
+ *          so thousands of queries in one tick share one sync. A pool that was
+ *          wholesale replaced (snapshot restore) carries a new revision epoch
+ *          and triggers a full re-bin.
+ *
+ *          QUERIES return candidates — every live entity whose cell the query
+ *          rectangle touches — sorted by slot index ascending, i.e. the same
+ *          canonical order as an FSeinEntityPool::ForEachEntity sweep. Callers
+ *          run their own exact test on the candidates, so a query that keeps
+ *          the sweep's per-entity predicate returns the sweep's exact result.
+ *
+ *          THREADING. Queries are const and allocate only into the caller's
+ *          output, so read-only SeinParallelFor bodies may call them. Access
+ *          goes through USeinWorldSubsystem::GetEntitySpatialIndex, which syncs
+ *          lazily under a lock (EnsureSyncedWith); touch it once from the
+ *          serial spine before a parallel dispatch so workers never queue.
+ *
+ *          Pure C++; no UObject, never serialized or hashed. Lives as a member
+ *          of USeinWorldSubsystem.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/SeinEntityHandle.h"
+#include "HAL/CriticalSection.h"
+#include "Types/FixedPoint.h"
+#include "Types/Vector.h"
+#include <atomic>
+
+class FSeinEntityPool;
+
+class SEINARTSCOREENTITY_API FSeinEntitySpatialIndex
+{
+public:
+	/** Cell edge in cm. Sized for gameplay query radii (abilities, AI scans,
+	 *  splash), several times the collision broadphase's 200 cm cells. */
+	static constexpr int32 DefaultCellSizeCm = 800;
+
+	FSeinEntitySpatialIndex();
+
+	/** Drop every bin and force a full re-bin on the next Sync. */
+	void Reset();
+
+	/** True when the bins reflect Pool's current slot revisions. */
+	bool IsSyncedWith(const FSeinEntityPool& Pool) const;
+
+	/** Re-bin every slot whose mutation revision changed since the last sync.
+	 *  Not safe concurrently with pool mutation, another Sync, or queries. */
+	void Sync(const FSeinEntityPool& Pool);
+
+	/** Lazy, thread-safe Sync: a stale index is synced once under a lock while
+	 *  other callers wait. Safe from concurrent read-only bodies as long as
+	 *  nothing mutates the pool meanwhile (the SeinParallelFor contract). */
+	void EnsureSyncedWith(const FSeinEntityPool& Pool);
+
+	/** Append every live entity whose cell may lie within Radius of Center on
+	 *  the XY plane, slot-ascending. Negative radii behave as their magnitude
+	 *  (matching a squared-distance test). */
+	void GatherCandidatesInRadius(
+		const FFixedVector& Center,
+		FFixedPoint Radius,
+		TArray<FSeinEntityHandle>& Out) const;
+
+	/** Append every live entity whose cell the XY rectangle [Min, Max] touches,
+	 *  slot-ascending. An inverted rectangle yields nothing. */
+	void GatherCandidatesInBox(
+		const FFixedVector& Min,
+		const FFixedVector& Max,
+		TArray<FSeinEntityHandle>& Out) const;
+
+	FFixedPoint GetCellSize() const { return CellSize; }
+	int32 NumOccupiedCells() const { return Cells.Num(); }
+	int32 NumIndexedEntities() const { return IndexedCount; }
+	/** Slots re-binned by the most recent Sync (diagnostics/tests). */
+	int32 GetLastSyncRebinCount() const { return LastSyncRebinCount; }
+
+private:
+	static FORCEINLINE int64 MakeKey(int64 CellX, int64 CellY)
+	{
+		const uint64 Bits = (static_cast<uint64>(static_cast<uint32>(CellX)) << 32)
+			| static_cast<uint32>(CellY);
+		return BitCast<int64>(Bits);
+	}
+
+	/** Floor division of a raw fixed-point coordinate by the cell size. */
+	int64 ToCell(FFixedPoint Coord) const;
+
+	/** Gather the cell range [MinCell, MaxCell]², walking occupied cells
+	 *  instead when the range is the larger set. */
+	void GatherCells(
+		int64 MinCellX, int64 MinCellY,
+		int64 MaxCellX, int64 MaxCellY,
+		TArray<FSeinEntityHandle>& Out) const;
+
+	void RebinSlot(int32 SlotIndex, const FSeinEntityPool& Pool);
+	void RemoveSlot(int32 SlotIndex);
+
+	/** One binned entity. The generation is captured at bin time; any
+	 *  generation change touches the slot and re-bins it before a query. */
+	struct FCellMember
+	{
+		int32 SlotIndex;
+		int32 Generation;
+	};
+
+	TMap<int64, TArray<FCellMember>> Cells;
+	TArray<uint64> SlotRevisions;
+	TArray<int64> SlotCellKeys;
+	/** Position inside Cells[SlotCellKeys[Slot]], INDEX_NONE when unbinned. */
+	TArray<int32> SlotCellPositions;
+	FFixedPoint CellSize;
+	int32 IndexedCount = 0;
+	int32 LastSyncRebinCount = 0;
+
+	/** Pool identity, latest revision and slot count the bins reflect.
+	 *  Published after a completed Sync so lock-free IsSyncedWith readers never
+	 *  act on a partial one. */
+	std::atomic<uint64> SyncedEpoch{0};
+	std::atomic<uint64> SyncedMutationRevision{0};
+	std::atomic<int32> SyncedSlotCount{0};
+
+	FCriticalSection SyncLock;
+};
@@ -0,0 +1,109 @@
+/**
+ * SeinARTS Framework - Copyright (c) 2026 Phenom Studios, Inc.
+ *
+ * @file         SeinEntityTagBitIndex.h
+ * @author       RJ Macklem
+ * @created      17 Oct 2026
+ * @latest       17 Oct 2026
+ * @brief        Dense per-entity tag bitsets — the query-side projection of the
+ *               refcounted entity tag state.
+ *
+ *          Every tag any entity has carried (plus each of its parents) owns
+ *          one bit. Each entity slot owns one fixed-width row of 64-bit words
+ *          in a single flat array, and the row holds the entity's present
+ *          tags closed over their parents, so a hierarchical HasTag is one
+ *          bit test. A tag set is compiled once into an FSeinTagBitMask and
+ *          then tested against any number of rows with a masked AND per word
+ *          — no map lookups or container walks inside a sweep.
+ *
+ *          DERIVED. Bits are assigned in first-seen order and are process-
+ *          local; they never reach a snapshot, digest or the wire, so peers
+ *          need not agree on them. Only answers must match, and those follow
+ *          from CombinedTags. USeinWorldSubsystem refreshes a row whenever a
+ *          tag crosses a 0/1 refcount edge, clears it on destroy and rebuilds
+ *          the whole index after a restore.
+ *
+ *          THREADING. Compile and the Matches* tests are const and never
+ *          assign bits, so read-only SeinParallelFor bodies may call them.
+ *          SetEntityTags/ClearEntity are serial-spine only.
+ *
+ *          Pure C++; a member of USeinWorldSubsystem.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/SeinEntityHandle.h"
+#include "GameplayTagContainer.h"
+
+/** A tag set compiled against one FSeinEntityTagBitIndex. Short-lived:
+ *  compile per query, test many rows, discard. */
+struct SEINARTSCOREENTITY_API FSeinTagBitMask
+{
+	/** Set bits for every compiled tag the index knows. Trailing words the
+	 *  mask does not cover are implicitly zero. */
+	TArray<uint64, TInlineAllocator<4>> Words;
+
+	/** Number of tags in the source set (known or not). */
+	int32 NumTags = 0;
+
+	/** A source tag no entity has ever carried: an all-of test can never
+	 *  pass, an any-of test simply ignores it. */
+	bool bHasUnknownTag = false;
+
+	bool IsEmpty() const { return NumTags == 0; }
+};
+
+class SEINARTSCOREENTITY_API FSeinEntityTagBitIndex
+{
+public:
+	/** Drop every row and every bit assignment. */
+	void Reset();
+
+	/** Rewrite Handle's row from its present tags (the refcount > 0 set),
+	 *  assigning bits to tags and parents seen for the first time. */
+	void SetEntityTags(
+		FSeinEntityHandle Handle,
+		const FGameplayTagContainer& PresentTags);
+
+	/** Forget Handle's row. No-op for a handle that holds no row. */
+	void ClearEntity(FSeinEntityHandle Handle);
+
+	/** Compile Tags for repeated MatchesAll/MatchesAny tests. */
+	FSeinTagBitMask Compile(const FGameplayTagContainer& Tags) const;
+
+	/** Compile a single tag. */
+	FSeinTagBitMask Compile(const FGameplayTag& Tag) const;
+
+	/** Every tag in Mask is present on Handle (parents match children). An
+	 *  empty mask passes, matching FGameplayTagContainer::HasAll. */
+	bool MatchesAll(FSeinEntityHandle Handle, const FSeinTagBitMask& Mask) const;
+
+	/** Any tag in Mask is present on Handle. An empty mask fails. */
+	bool MatchesAny(FSeinEntityHandle Handle, const FSeinTagBitMask& Mask) const;
+
+	/** Distinct tags (including parents) that own a bit. */
+	int32 NumAssignedBits() const { return TagByBit.Num(); }
+
+	/** Current row width in 64-bit words. */
+	int32 GetWordsPerRow() const { return WordsPerRow; }
+
+private:
+	/** Handle's row, or null when the slot holds no row for this generation. */
+	const uint64* FindRow(FSeinEntityHandle Handle) const;
+
+	int32 AssignBit(const FGameplayTag& Tag);
+	void Widen(int32 NewWordsPerRow);
+
+	TMap<FGameplayTag, int32> BitByTag;
+	TArray<FGameplayTag> TagByBit;
+
+	/** Flat [slot][word] storage, WordsPerRow words per entity slot. */
+	TArray<uint64> Rows;
+
+	/** Generation that owns each slot's row; INDEX_NONE when empty. Guards
+	 *  stale handles the same way the handle-keyed tag-state map does. */
+	TArray<int32> RowGenerations;
+
+	int32 WordsPerRow = 1;
+};
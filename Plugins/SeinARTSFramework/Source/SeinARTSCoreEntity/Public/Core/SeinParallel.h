@@ -46,6 +46,11 @@
  *                                        with it 1 vs 0 over the same scenario.
  *            Sein.Sim.ParallelMinBatch  (default 64) batches smaller than this
  *                                        run serial (dispatch overhead > win).
+ *            Sein.Sim.ParallelSystems   (default 1) lets the tick dispatcher run
+ *                                        non-conflicting declared systems of
+ *                                        one phase concurrently. Requires the
+ *                                        master toggle; 0 keeps the canonical
+ *                                        serial system order.
  */
 
 #pragma once
@@ -61,6 +66,12 @@ SEINARTSCOREENTITY_API bool SeinSimParallelEnabled();
  *  (Sein.Sim.ParallelMinBatch). Smaller batches run serially. */
 SEINARTSCOREENTITY_API int32 SeinSimParallelMinBatch();
 
+/** System-level concurrency toggle (Sein.Sim.ParallelSystems != 0 AND the
+ *  master toggle). When set, USeinWorldSubsystem dispatches each compiled
+ *  system wave as concurrent tasks; when clear, systems tick one at a time in
+ *  canonical order. Both schedules must produce identical state. */
+SEINARTSCOREENTITY_API bool SeinSimParallelSystemsEnabled();
+
 /** Async pathfinding toggle (Sein.Sim.AsyncPathfinding != 0). When set, path requests are
  *  queued and run as deterministic budgeted batches beginning on the next tick instead of
  *  inline-synchronous. Reads
@@ -131,3 +142,62 @@ FORCEINLINE void SeinParallelFor(int32 Count, FunctionType&& Body, bool bForceSe
 	SeinSetInParallelSection(false);
 #endif
 }
+
+/**
+ * SeinParallelFor with a per-worker scratch context. Body(Context, i) may write
+ * freely into Context — it is never shared by two concurrent bodies — but the
+ * assignment of indices to contexts varies with thread count and scheduling, so
+ * a body's RESULT must not depend on what earlier bodies left in its context.
+ * Use it for reusable workspace (query buffers, append-only arenas the caller
+ * re-reads by recorded offset), not for accumulation.
+ *
+ * Contexts are caller-owned and persist: the dispatch grows InOutContexts to
+ * its task count (one element when the loop runs serially) but never shrinks,
+ * destroys or clears them, so workspace capacity carries from one dispatch to
+ * the next. Reset (not Empty) whatever the body appends to before dispatching.
+ *
+ * @param InOutContexts contexts to run with, grown as needed
+ * @param Count         number of iterations
+ * @param Body          callable invoked as Body(ContextType& Context, int32 Index)
+ * @param bForceSerial  per-call override to run serially regardless of the cvar
+ */
+template <typename ContextType, typename FunctionType>
+FORCEINLINE void SeinParallelForWithContext(TArray<ContextType>& InOutContexts, int32 Count, FunctionType&& Body, bool bForceSerial = false)
+{
+	if (Count <= 0)
+	{
+		return;
+	}
+
+	const bool bSerial = bForceSerial || (Count < SeinSimParallelMinBatch()) || !SeinSimParallelEnabled();
+	if (bSerial)
+	{
+		if (InOutContexts.IsEmpty())
+		{
+			InOutContexts.AddDefaulted();
+		}
+		ContextType& Context = InOutContexts[0];
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			Body(Context, Index);
+		}
+		return;
+	}
+
+	const int32 NumContexts = ParallelForImpl::GetNumberOfThreadTasks(Count, 1, EParallelForFlags::None);
+	if (InOutContexts.Num() < NumContexts)
+	{
+		InOutContexts.SetNum(NumContexts);
+	}
+
+#if !UE_BUILD_SHIPPING
+	SeinSetInParallelSection(true);
+#endif
+
+	ParallelForWithExistingTaskContext(MakeArrayView(InOutContexts.GetData(), NumContexts), Count, 1,
+		[&Body](ContextType& Context, int32 Index) { Body(Context, Index); });
+
+#if !UE_BUILD_SHIPPING
+	SeinSetInParallelSection(false);
+#endif
+}
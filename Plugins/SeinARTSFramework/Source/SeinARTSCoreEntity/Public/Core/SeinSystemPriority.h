@@ -28,11 +28,14 @@ namespace SeinSystemPriority
 	inline constexpr int32 NavBlockerStamp     = 7;
 	inline constexpr int32 CooldownTick        = 10;
 	inline constexpr int32 WeaponCycle         = 11;
+	inline constexpr int32 VitalsReap          = 12;
+	inline constexpr int32 TargetIndex         = 13;
 
 	// ── AbilityExecution ──
 	inline constexpr int32 AbilityTick      = 0;
 	inline constexpr int32 MovementDriver   = 10;
 	inline constexpr int32 ProjectileFlight = 20;
+	inline constexpr int32 BallisticFlight  = 21;
 	inline constexpr int32 Production       = 50;
 
 	// PostTick
@@ -40,6 +40,157 @@ enum class ESeinSystemStateCoverage : uint8
 	CanonicalStateContributors
 };
 
+/**
+ * Core-owned shared state a declared system may read or write besides its
+ * component storages and canonical-state contributors.
+ *
+ * Spawn, destroy, component add/remove, command and visual-event enqueue, and
+ * world randomness are deliberately absent: those seams are guarded by
+ * SEIN_CHECK_NOT_PARALLEL, so a system that reaches them stays undeclared and
+ * runs as an exclusive barrier.
+ */
+enum class ESeinSystemSharedState : uint8
+{
+	None             = 0,
+	EntityTransforms = 1 << 0,  // FSeinEntity records read or written through the pool
+	AbilityPool      = 1 << 1,  // World-pooled ability objects and their state revisions
+	CollisionHash    = 1 << 2,  // The collision broadphase spatial hash
+	PlayerStates     = 1 << 3   // Per-player resources, tags, and effect ledgers
+};
+ENUM_CLASS_FLAGS(ESeinSystemSharedState);
+
+/**
+ * Declared data access for one system, used only to schedule it.
+ *
+ * An undeclared system (the default) conflicts with every other system in its
+ * phase and therefore runs alone, exactly as before declarations existed. A
+ * declared system names every component storage, canonical-state contributor,
+ * and shared Core state it touches. Its own RequiredCanonicalStateContributorKeys
+ * count as written. Two systems conflict when either one writes something the
+ * other reads or writes; non-conflicting systems may tick concurrently, which is
+ * result-identical to the canonical serial order only while declarations are
+ * honest and the Tick bodies obey the SeinParallelFor contract.
+ *
+ * bRequiresGameThread marks a system that must run on the game thread (for
+ * example, one that broadcasts a presentation delegate). It still shares a
+ * wave with worker-thread systems; the dispatcher runs at most one such system
+ * inline per wave. When the dedicated simulation thread runs the batch, the
+ * system is handed back to the game thread at the join instead.
+ */
+struct SEINARTSCOREENTITY_API FSeinSystemAccess
+{
+	bool bDeclared = false;
+	bool bRequiresGameThread = false;
+	TArray<const UScriptStruct*> ReadComponents;
+	TArray<const UScriptStruct*> WriteComponents;
+	TArray<FName> ReadStateKeys;
+	TArray<FName> WriteStateKeys;
+	ESeinSystemSharedState ReadShared = ESeinSystemSharedState::None;
+	ESeinSystemSharedState WriteShared = ESeinSystemSharedState::None;
+
+	static FSeinSystemAccess Declared()
+	{
+		FSeinSystemAccess Result;
+		Result.bDeclared = true;
+		return Result;
+	}
+
+	FSeinSystemAccess& ReadsComponent(const UScriptStruct* Struct)
+	{
+		ReadComponents.AddUnique(Struct);
+		return *this;
+	}
+
+	FSeinSystemAccess& WritesComponent(const UScriptStruct* Struct)
+	{
+		WriteComponents.AddUnique(Struct);
+		return *this;
+	}
+
+	FSeinSystemAccess& ReadsState(FName ContributorKey)
+	{
+		ReadStateKeys.AddUnique(ContributorKey);
+		return *this;
+	}
+
+	FSeinSystemAccess& WritesState(FName ContributorKey)
+	{
+		WriteStateKeys.AddUnique(ContributorKey);
+		return *this;
+	}
+
+	FSeinSystemAccess& ReadsShared(ESeinSystemSharedState State)
+	{
+		ReadShared |= State;
+		return *this;
+	}
+
+	FSeinSystemAccess& WritesShared(ESeinSystemSharedState State)
+	{
+		WriteShared |= State;
+		return *this;
+	}
+
+	FSeinSystemAccess& OnGameThread()
+	{
+		bRequiresGameThread = true;
+		return *this;
+	}
+
+	/** True when the two systems may not tick concurrently. Undeclared access
+	 *  conflicts with everything. State keys compare in canonical spelling. */
+	bool ConflictsWith(const FSeinSystemAccess& Other) const
+	{
+		if (!bDeclared || !Other.bDeclared)
+		{
+			return true;
+		}
+		if (bRequiresGameThread && Other.bRequiresGameThread)
+		{
+			return true;
+		}
+		if (EnumHasAnyFlags(WriteShared, Other.ReadShared | Other.WriteShared)
+			|| EnumHasAnyFlags(Other.WriteShared, ReadShared))
+		{
+			return true;
+		}
+		const auto Intersects = [](const auto& Left, const auto& Right)
+		{
+			for (const auto& Item : Left)
+			{
+				if (Right.Contains(Item))
+				{
+					return true;
+				}
+			}
+			return false;
+		};
+		return Intersects(WriteComponents, Other.ReadComponents)
+			|| Intersects(WriteComponents, Other.WriteComponents)
+			|| Intersects(Other.WriteComponents, ReadComponents)
+			|| Intersects(WriteStateKeys, Other.ReadStateKeys)
+			|| Intersects(WriteStateKeys, Other.WriteStateKeys)
+			|| Intersects(Other.WriteStateKeys, ReadStateKeys);
+	}
+
+	bool operator==(const FSeinSystemAccess& Other) const
+	{
+		return bDeclared == Other.bDeclared
+			&& bRequiresGameThread == Other.bRequiresGameThread
+			&& ReadComponents == Other.ReadComponents
+			&& WriteComponents == Other.WriteComponents
+			&& ReadStateKeys == Other.ReadStateKeys
+			&& WriteStateKeys == Other.WriteStateKeys
+			&& ReadShared == Other.ReadShared
+			&& WriteShared == Other.WriteShared;
+	}
+
+	bool operator!=(const FSeinSystemAccess& Other) const
+	{
+		return !(*this == Other);
+	}
+};
+
 /**
  * Immutable participation contract for one deterministic simulation system.
  *
@@ -55,6 +206,10 @@ enum class ESeinSystemStateCoverage : uint8
  * entity-pool, and other state already owned by Core's snapshot is not repeated.
  * FinalObservation is reserved for stateless observers after every authoritative
  * phase. Systems in that phase must not mutate canonical simulation state.
+ *
+ * Access is scheduling metadata only. It never enters the execution-topology
+ * digest because the concurrent and serial schedules must produce identical
+ * state; see FSeinSystemAccess.
  */
 struct SEINARTSCOREENTITY_API FSeinSystemDescriptor
 {
@@ -65,6 +220,7 @@ struct SEINARTSCOREENTITY_API FSeinSystemDescriptor
 	ESeinSystemStateCoverage StateCoverage =
 		ESeinSystemStateCoverage::Unspecified;
 	TArray<FName> RequiredCanonicalStateContributorKeys;
+	FSeinSystemAccess Access;
 
 	static FSeinSystemDescriptor Stateless(
 		FName StableSystemID,
@@ -100,6 +256,14 @@ struct SEINARTSCOREENTITY_API FSeinSystemDescriptor
 		return Result;
 	}
 
+	/** Returns a copy carrying the declared scheduling access. */
+	FSeinSystemDescriptor WithAccess(FSeinSystemAccess InAccess) const
+	{
+		FSeinSystemDescriptor Result = *this;
+		Result.Access = MoveTemp(InAccess);
+		return Result;
+	}
+
 	bool operator==(const FSeinSystemDescriptor& Other) const
 	{
 		return StableSystemID == Other.StableSystemID
@@ -108,7 +272,8 @@ struct SEINARTSCOREENTITY_API FSeinSystemDescriptor
 			&& Priority == Other.Priority
 			&& StateCoverage == Other.StateCoverage
 			&& RequiredCanonicalStateContributorKeys
-				== Other.RequiredCanonicalStateContributorKeys;
+				== Other.RequiredCanonicalStateContributorKeys
+			&& Access == Other.Access;
 	}
 
 	bool operator!=(const FSeinSystemDescriptor& Other) const
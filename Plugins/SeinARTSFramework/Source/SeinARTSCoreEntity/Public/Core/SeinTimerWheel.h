@@ -0,0 +1,110 @@
+/**
+ * SeinARTS Framework - Copyright (c) 2026 Phenom Studios, Inc.
+ *
+ * @file         SeinTimerWheel.h
+ * @author       RJ Macklem
+ * @created      17 Oct 2026
+ * @latest       17 Oct 2026
+ * @brief        Deterministic hashed timing wheel keyed by absolute sim tick.
+ *
+ *          Entries are (DueTick, Key) pairs hashed into a power-of-two ring of
+ *          slots by DueTick. Advancing to tick T visits only the slots for the
+ *          ticks crossed since the previous advance; entries whose DueTick is
+ *          still ahead (more than one revolution out) simply stay put and are
+ *          re-examined when the ring comes round again. Per-tick cost is the
+ *          size of the visited slots, not the number of scheduled timers.
+ *
+ *          Determinism: expired keys are returned sorted ascending, so the
+ *          caller sees a canonical order regardless of scheduling history. The
+ *          wheel holds no float and no pointers; a caller that derives it from
+ *          canonical deadlines (FSeinLifespanSystem) can rebuild it
+ *          bit-identically after a snapshot restore instead of serializing it.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FSeinTimerWheel
+{
+public:
+	explicit FSeinTimerWheel(int32 InSlotCountLog2 = 8)
+	{
+		const int32 SlotCount = 1 << FMath::Clamp(InSlotCountLog2, 1, 16);
+		Slots.SetNum(SlotCount);
+		SlotMask = SlotCount - 1;
+	}
+
+	/** Drop every entry. The next Advance(NextTick) fires anything scheduled
+	 *  at or before NextTick. */
+	void Reset(int32 NextTick)
+	{
+		for (TArray<FEntry>& Slot : Slots)
+		{
+			Slot.Reset();
+		}
+		NumEntries = 0;
+		LastAdvancedTick = NextTick == MIN_int32 ? MIN_int32 : NextTick - 1;
+	}
+
+	/** Schedule Key to fire at DueTick. A DueTick the wheel has already
+	 *  advanced past fires on the next Advance. Duplicate keys are allowed
+	 *  and fire once per Schedule call. */
+	void Schedule(int32 DueTick, uint64 Key)
+	{
+		if (DueTick <= LastAdvancedTick)
+		{
+			DueTick = LastAdvancedTick + 1;
+		}
+		Slots[DueTick & SlotMask].Add(FEntry{ DueTick, Key });
+		++NumEntries;
+	}
+
+	/** Advance to NowTick and return (in OutDueKeys, reset first) every key
+	 *  whose DueTick <= NowTick, ascending. A no-op when NowTick has already
+	 *  been reached. */
+	void Advance(int32 NowTick, TArray<uint64>& OutDueKeys)
+	{
+		OutDueKeys.Reset();
+		if (NowTick <= LastAdvancedTick)
+		{
+			return;
+		}
+
+		// A jump of a full revolution or more visits every slot exactly once.
+		const int64 Crossed = static_cast<int64>(NowTick) - LastAdvancedTick;
+		const int32 SlotsToVisit = Crossed >= Slots.Num()
+			? Slots.Num()
+			: static_cast<int32>(Crossed);
+		for (int32 Step = 1; Step <= SlotsToVisit; ++Step)
+		{
+			TArray<FEntry>& Slot = Slots[(LastAdvancedTick + Step) & SlotMask];
+			for (int32 Index = Slot.Num() - 1; Index >= 0; --Index)
+			{
+				if (Slot[Index].DueTick <= NowTick)
+				{
+					OutDueKeys.Add(Slot[Index].Key);
+					Slot.RemoveAtSwap(Index, EAllowShrinking::No);
+					--NumEntries;
+				}
+			}
+		}
+		LastAdvancedTick = NowTick;
+		OutDueKeys.Sort();
+	}
+
+	int32 Num() const { return NumEntries; }
+	bool IsEmpty() const { return NumEntries == 0; }
+
+private:
+	struct FEntry
+	{
+		int32 DueTick = 0;
+		uint64 Key = 0;
+	};
+
+	TArray<TArray<FEntry>> Slots;
+	int32 SlotMask = 0;
+	int32 LastAdvancedTick = -1;
+	int32 NumEntries = 0;
+};
@@ -17,6 +17,12 @@
  * once. One changed leaf costs O(log N); a dense batch costs O(N), never
  * O(changes * log N). The tree and its revisions are cache only and are never
  * serialized as simulation state.
+ *
+ * Finalize walks one level at a time, deepest first. A level's dirty parents
+ * read only the finished level below and each writes its own node, so a level
+ * is split into fixed-size ascending batches and run through SeinParallelFor.
+ * Batch boundaries never depend on thread count and the parallel root is
+ * bit-identical to the serial one.
  */
 class SEINARTSCOREENTITY_API FSeinCanonicalDigestTree
 {
@@ -33,22 +39,41 @@ public:
 		const FGuid& Digest,
 		FString& OutError);
 
-	/** Hash every dirty ancestor once, bottom-up, and seal the current root. */
-	bool FinalizeUpdates(FString& OutError);
+	/**
+	 * Hash every dirty ancestor once, bottom-up, and seal the current root.
+	 * bForceSerial runs every level on the calling thread (same root).
+	 */
+	bool FinalizeUpdates(FString& OutError, bool bForceSerial = false);
 
 	/** Root of the last completed Reset/FinalizeUpdates operation. */
 	const FGuid& GetRoot() const { return RootDigest; }
 	int32 Num() const { return LeafCount; }
+	/** Heap position of leaf 0; node N's children are 2N and 2N+1. */
+	int32 GetLeafBase() const { return LeafBase; }
+	/** Sealed digest of one heap node (1 = top, leaves from GetLeafBase()).
+	 *  Meaningful only while no updates are pending. */
+	bool GetNodeDigest(int32 NodeIndex, FGuid& OutDigest) const;
+	/** Domain-bound digest stored at empty leaf positions. */
+	const FGuid& GetEmptyLeafDigest() const { return EmptyLeafDigest; }
 	bool IsValid() const { return RootDigest.IsValid(); }
 	bool HasPendingUpdates() const { return bHasPendingUpdates; }
 
 private:
-	bool ComputeNodeDigest(int32 NodeIndex, FGuid& OutDigest, FString& OutError) const;
+	/** Hash the parents in Level (ascending, one tree level) level by level up
+	 *  to the root. Consumes Level. */
+	bool HashDirtyLevels(TArray<int32>& Level, bool bForceSerial, FString& OutError);
+	/** Hash one batch of same-level parents into their own node slots. */
+	bool HashParentBatch(TConstArrayView<int32> NodeIndices, FString& OutError);
+	bool SealRoot(FString& OutError);
 
 	FString StableDomain;
 	int32 LeafCount = 0;
 	int32 LeafBase = 0;
 	TArray<FGuid> Nodes;
+	/** Canonical parent-digest stream up to the node index; see Reset. */
+	TArray<uint8> ParentPrefix;
+	/** Parents of changed leaves, queued once each (DirtyNodes dedupes). */
+	TArray<int32> PendingParents;
 	TBitArray<> DirtyNodes;
 	FGuid EmptyLeafDigest;
 	FGuid RootDigest;
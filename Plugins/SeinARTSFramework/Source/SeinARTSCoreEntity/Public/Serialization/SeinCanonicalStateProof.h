@@ -0,0 +1,65 @@
+/**
+ * SeinARTS Framework - Copyright (c) 2026 Phenom Studios, Inc.
+ *
+ * @file         SeinCanonicalStateProof.h
+ * @author       RJ Macklem
+ * @created      17 Oct 2026
+ * @latest       17 Oct 2026
+ * @brief        Retained digest-tree image of one sealed routine world root.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Serialization/SeinCanonicalDigestTree.h"
+
+/**
+ * One digest-bearing section of a sealed routine root.
+ *
+ * Routine root leaves ("routine/...") and the core accelerator inputs
+ * ("core/...") are both listed, so a mismatching root narrows to a section
+ * even when that section has no tree. Indexed sections (entity slots, one
+ * component type, one object pool) also share their sealed leaf tree; leaf
+ * index N is entity slot N or pool slot N.
+ */
+struct SEINARTSCOREENTITY_API FSeinCanonicalStateProofSection
+{
+	FString SectionId;
+	FGuid Digest;
+	/** Immutable once captured. Consecutive images share a tree whose
+	 *  section digest did not change. */
+	TSharedPtr<const FSeinCanonicalDigestTree> Tree;
+};
+
+/**
+ * Non-authoritative image of the root caches at one sealed tick, kept by a
+ * reporting peer so a later desync localisation compares state at the exact
+ * check turn rather than wherever the sim has since advanced. Never
+ * serialized and never part of simulation state.
+ */
+struct SEINARTSCOREENTITY_API FSeinCanonicalStateProofImage
+{
+	int32 Tick = INDEX_NONE;
+	FGuid Root;
+	/** Sorted by SectionId. */
+	TArray<FSeinCanonicalStateProofSection> Sections;
+
+	bool IsValid() const { return Tick != INDEX_NONE && Root.IsValid(); }
+	const FSeinCanonicalStateProofSection* FindSection(
+		FStringView SectionId) const;
+};
+
+/** Bounded, human-readable projection of one live indexed leaf. */
+struct SEINARTSCOREENTITY_API FSeinCanonicalStateProofLeaf
+{
+	/** Leaf digest recomputed from live state, empty positions normalised to
+	 *  the tree's empty sentinel. */
+	FGuid Digest;
+	FString Payload;
+	/** Digest equals the imaged leaf, so Payload is exactly the value at the
+	 *  imaged tick rather than whatever the sim has since written there. */
+	bool bAtCheckpoint = false;
+	bool bTruncated = false;
+
+	static constexpr int32 MaxPayloadChars = 2048;
+};
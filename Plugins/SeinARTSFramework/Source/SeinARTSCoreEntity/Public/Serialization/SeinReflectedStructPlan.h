@@ -0,0 +1,146 @@
+/**
+ * SeinARTS Framework - Copyright (c) 2026 Phenom Studios, Inc.
+ *
+ * @file         SeinReflectedStructPlan.h
+ * @author       RJ Macklem
+ * @created      17 Oct 2026
+ * @latest       17 Oct 2026
+ * @brief        Compiled per-type walk plans for reflected digest and snapshot
+ *               serialization.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/SharedPointer.h"
+
+class FArchive;
+class FProperty;
+class UScriptStruct;
+class UStruct;
+
+/**
+ * How the canonical reflected digest projects one field value. The order of
+ * the classification mirrors the digest's own dispatch, so a field always
+ * lands in the kind the interpretive walk would have chosen for it.
+ */
+enum class ESeinReflectedValueKind : uint8
+{
+	/** Excluded by FSeinCanonicalStatePropertyPolicy; reaching it fails. */
+	Skipped,
+	Array,
+	Set,
+	Map,
+	Optional,
+	Bool,
+	Enum,
+	EnumWithoutUnderlying,
+	Integer,
+	UnsupportedNumeric,
+	Name,
+	String,
+	Text,
+	NullStruct,
+	InstancedStruct,
+	GameplayTag,
+	GameplayTagContainer,
+	SoftObjectPath,
+	TopLevelAssetPath,
+	Struct,
+	SoftObject,
+	WeakOrLazyObject,
+	InstancedObject,
+	ObjectReference,
+	Unsupported,
+};
+
+/** One compiled value projection. Container kinds reference their element
+ *  ops by index into the owning plan's child ops (a map's value op follows
+ *  its key op). */
+struct FSeinReflectedValueOp
+{
+	const FProperty* Property = nullptr;
+	/** Nested type for Struct kinds. */
+	const UScriptStruct* Struct = nullptr;
+	int32 FirstChild = INDEX_NONE;
+	ESeinReflectedValueKind Kind = ESeinReflectedValueKind::Unsupported;
+	/** Integer and Enum: stored width in bytes and signedness. */
+	uint8 IntegerBytes = 0;
+	bool bSignedInteger = false;
+};
+
+/** One top-level canonical field with its identity frozen as digest text. */
+struct FSeinReflectedFieldOp
+{
+	FSeinReflectedValueOp Value;
+	FString OwnerPath;
+	/** FSeinCanonicalDigestWriter::WriteName text for the field name. */
+	FString CanonicalName;
+	/** Character count the digest's string budget charges for the name. */
+	int32 NameCharacters = 0;
+	int32 ArrayDim = 1;
+};
+
+/** A snapshot step: a run of raw bytes, or one property handed to
+ *  FProperty::SerializeBinProperty. */
+struct FSeinReflectedBinaryOp
+{
+	/** Null for a raw run. */
+	const FProperty* Property = nullptr;
+	int32 Offset = 0;
+	int32 Size = 0;
+};
+
+/**
+ * Compiled once per reflected type and cached process-wide. The digest half
+ * freezes the canonical field order, identities and kind dispatch that
+ * FSeinCanonicalReflectedStateDigest otherwise re-derived per value. The
+ * snapshot half replays UStruct::SerializeBin with adjacent raw-layout fields
+ * (plain integers and FFixedPoint) collapsed into single byte runs.
+ *
+ * Plans are process-local acceleration only: every byte they produce is the
+ * byte the reflection walk would have produced. Entries are dropped when
+ * classes or structs are reinstanced or reloaded, and a lookup whose type no
+ * longer matches its frozen property chain recompiles.
+ */
+class SEINARTSCOREENTITY_API FSeinReflectedStructPlan
+{
+public:
+	/** The compiled plan for Type. Safe to call from parallel digest tasks. */
+	static TSharedRef<const FSeinReflectedStructPlan> Get(const UStruct& Type);
+
+	/** Drop every cached plan. */
+	static void ResetCache();
+
+	/** Module lifetime: drop plans on reinstancing, reload and GC. */
+	static void StartInvalidationTracking();
+	static void StopInvalidationTracking();
+
+	const FString& GetTypePath() const { return TypePath; }
+	TConstArrayView<FSeinReflectedFieldOp> GetFields() const { return Fields; }
+	const FSeinReflectedValueOp& GetChild(int32 Index) const { return ChildOps[Index]; }
+
+	/** Whether SerializeBin reproduces UStruct::SerializeBin for Ar. Evaluate
+	 *  once per archive pass, not per value. */
+	bool CanSerializeBin(FArchive& Ar) const;
+
+	/** Serialize one value; only valid after CanSerializeBin(Ar) held. */
+	void SerializeBin(FArchive& Ar, void* Data) const;
+
+private:
+	explicit FSeinReflectedStructPlan(const UStruct& Type);
+
+	int32 CompileValueOp(const FProperty& Property);
+	void CompileValueOp(const FProperty& Property, FSeinReflectedValueOp& OutOp);
+	void CompileBinaryOps(const UStruct& Type);
+
+	FString TypePath;
+	TArray<FSeinReflectedFieldOp> Fields;
+	TArray<FSeinReflectedValueOp> ChildOps;
+	TArray<FSeinReflectedBinaryOp> BinaryOps;
+	TArray<const FProperty*> RawBinaryProperties;
+	const FProperty* FrozenPropertyLink = nullptr;
+	int32 FrozenPropertiesSize = 0;
+
+	friend struct FSeinReflectedStructPlanCache;
+};
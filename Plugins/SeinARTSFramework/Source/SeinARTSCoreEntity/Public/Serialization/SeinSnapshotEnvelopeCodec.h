@@ -31,10 +31,24 @@ enum class ESeinSnapshotSectionRole : uint8
 	Local = 4,
 };
 
-/** Payload byte contract. Snapshot v16 supports no compression. */
+/**
+ * Payload byte contract. Envelopes, leaves and state roots only ever admit
+ * CanonicalBytes; the other codecs are storage transforms that
+ * FSeinSnapshotSectionCodec applies outside every digest, so a stored section
+ * must be decoded back to its canonical bytes before any envelope check.
+ */
 enum class ESeinSnapshotSectionCodec : uint8
 {
 	CanonicalBytes = 1,
+
+	/** XOR against the same section of a base payload, equal runs skipped. */
+	XorDelta = 2,
+
+	/** CanonicalBytes, LZ4-compressed. */
+	CanonicalBytesLZ4 = 3,
+
+	/** XorDelta, LZ4-compressed. */
+	XorDeltaLZ4 = 4,
 };
 
 /** One caller-owned section before encoding, or one validated decoded section. */
@@ -64,6 +78,17 @@ struct SEINARTSCOREENTITY_API FSeinSnapshotEnvelopeSection
 	TArray<uint8> Payload;
 };
 
+/** Location of one section payload inside a complete encoded envelope. */
+struct SEINARTSCOREENTITY_API FSeinSnapshotSectionLayout
+{
+	FString SectionId;
+	ESeinSnapshotSectionRole Role =
+		ESeinSnapshotSectionRole::Authoritative;
+	/** Absolute byte offset into the envelope, prefix included. */
+	uint64 PayloadOffset = 0;
+	uint64 PayloadBytes = 0;
+};
+
 /** Semantic input/output represented by the snapshot-v16 envelope. */
 struct SEINARTSCOREENTITY_API FSeinSnapshotEnvelope
 {
@@ -148,4 +173,17 @@ public:
 		FSeinSnapshotEnvelope& OutEnvelope,
 		FSeinSnapshotEnvelopeMetadata& OutMetadata,
 		FString& OutError);
+
+	/**
+	 * Validate the prefix, exact length and directory framing of one complete
+	 * envelope and report every payload range in directory order, without
+	 * hashing or copying payloads. Storage transforms use this to split an
+	 * envelope they just encoded; it is not a substitute for Decode.
+	 * OutLayout and OutMetadata are unchanged on failure.
+	 */
+	static bool GetSectionLayout(
+		TConstArrayView<uint8> Bytes,
+		TArray<FSeinSnapshotSectionLayout>& OutLayout,
+		FSeinSnapshotEnvelopeMetadata& OutMetadata,
+		FString& OutError);
 };
@@ -0,0 +1,63 @@
+/**
+ * SeinARTS Framework - Copyright (c) 2026 Phenom Studios, Inc.
+ *
+ * @file         SeinSnapshotSectionCodec.h
+ * @author       RJ Macklem
+ * @created      17 Oct 2026
+ * @latest       17 Oct 2026
+ * @brief        Bounded storage transforms for canonical snapshot section
+ *               payloads.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Serialization/SeinSnapshotEnvelopeCodec.h"
+
+/**
+ * Pure storage codec for one snapshot section payload.
+ *
+ * Digests never see stored bytes: a section is encoded from, and decoded back
+ * to, its exact canonical payload, and only that canonical payload may enter
+ * FSeinSnapshotEnvelopeCodec or a state-root leaf. Decode is bounded by the
+ * caller-declared canonical length (which the envelope directory later binds)
+ * and is transactional: OutCanonical is unchanged on failure.
+ *
+ * XorDelta stores Canonical XOR Base as alternating (equal-run, literal-run)
+ * LEB128 length pairs followed by the literal XOR bytes. Base bytes past the
+ * end of Base read as zero, so a section may grow or shrink between bases.
+ * Simulation state keeps slot layouts stable across checkpoints, so most of a
+ * section lands in equal runs. The LZ4 variants prefix an 8-byte big-endian
+ * inner length to the compressed inner stream.
+ */
+class SEINARTSCOREENTITY_API FSeinSnapshotSectionCodec
+{
+public:
+	static bool IsKnown(ESeinSnapshotSectionCodec Codec);
+
+	/** True when decoding needs the base payload it was encoded against. */
+	static bool IsDelta(ESeinSnapshotSectionCodec Codec);
+
+	/**
+	 * Encode Canonical with Codec. Base is read only by delta codecs.
+	 * OutStored is unchanged on failure.
+	 */
+	static bool Encode(
+		ESeinSnapshotSectionCodec Codec,
+		TConstArrayView<uint8> Canonical,
+		TConstArrayView<uint8> Base,
+		TArray<uint8>& OutStored,
+		FString& OutError);
+
+	/**
+	 * Decode exactly CanonicalBytes bytes from Stored. Every stored byte must
+	 * be consumed. OutCanonical is unchanged on failure.
+	 */
+	static bool Decode(
+		ESeinSnapshotSectionCodec Codec,
+		TConstArrayView<uint8> Stored,
+		TConstArrayView<uint8> Base,
+		uint64 CanonicalBytes,
+		TArray<uint8>& OutCanonical,
+		FString& OutError);
+};
@@ -101,11 +101,12 @@ public:
 	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
 #endif
 
-	/** Push the Parallel Simulation / Parallel Min Batch / Async Pathfinding settings to their
-	 *  backing console variables (`Sein.Sim.Parallel` / `Sein.Sim.ParallelMinBatch` /
-	 *  `Sein.Sim.AsyncPathfinding`). Called from PostInitProperties (after config load) and on
-	 *  editor property change. Sets at `ECVF_SetByProjectSetting` priority so a manual console
-	 *  override (e.g. typing `Sein.Sim.Parallel 0` for live A/B determinism testing) still wins. */
+	/** Push the Parallel Simulation / Parallel Min Batch / Dedicated Simulation Thread / Async
+	 *  Pathfinding settings to their backing console variables (`Sein.Sim.Parallel` /
+	 *  `Sein.Sim.ParallelMinBatch` / `Sein.Sim.DedicatedThread` / `Sein.Sim.AsyncPathfinding`).
+	 *  Called from PostInitProperties (after config load) and on editor property change. Sets at
+	 *  `ECVF_SetByProjectSetting` priority so a manual console override (e.g. typing
+	 *  `Sein.Sim.Parallel 0` for live A/B determinism testing) still wins. */
 	void ApplySimPerformanceCvars() const;
 
 	// Simulation
@@ -172,7 +173,7 @@ public:
 
 	// Simulation — Performance (deterministic multithreading)
 	// ----------------------------------------------------------------------------------------------------
-	// These three drive the `Sein.Sim.*` console variables; the console still wins at runtime for
+	// These drive the `Sein.Sim.*` console variables; the console still wins at runtime for
 	// live A/B testing. Parallel passes are designed BIT-IDENTICAL to serial, so toggling them is
 	// deterministic (verify with canonical-root A/B plus peer/replay agreement). Exception: Async
 	// Pathfinding shifts WHEN a path arrives into a deterministic budgeted queue — see its note;
@@ -203,6 +204,20 @@ public:
 				EditCondition = "bParallelSimulation"))
 	int32 ParallelMinBatch = 64;
 
+	/**
+	 * Run each frame's simulation ticks on a dedicated thread instead of the game thread, so a
+	 * catch-up burst (up to Max Ticks Per Frame) overlaps the frame boundary rather than stalling
+	 * rendering. Applies to standalone and networked game worlds (a batch never crosses a second
+	 * lockstep turn boundary); PIE, replay playback and recording, and any world with Blueprint-
+	 * scripted abilities, broker resolvers or AI controllers keep ticking on the game thread, and
+	 * each such frame is counted and logged as a fallback.
+	 * Scheduling only — ticks are bit-identical either way. Drives the Sein.Sim.DedicatedThread
+	 * console variable. Default off.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Simulation|Performance",
+		meta = (DisplayName = "Dedicated Simulation Thread"))
+	bool bDedicatedSimulationThread = false;
+
 	/**
 	 * Gather path requests and solve them in deterministic budgeted batches beginning the tick after
 	 * they are made, instead of solving each inline the moment it is asked for. This is how large-scale
@@ -551,6 +566,21 @@ public:
 			EditConditionHides))
 	int32 NavReachabilityProfileCacheCapacity;
 
+	/** Maximum number of shared group-order flow fields retained by the shipped
+	 *  A* planner. One entry costs about six bytes per nav cell it has grown
+	 *  over plus its own blocker overlay, and lets every member of a group move
+	 *  order walk one shared field instead of running its own search. Fields
+	 *  still referenced by a moving unit are evicted last; eviction is
+	 *  result-neutral (a field is rebuilt identically on next use). Raise this
+	 *  if many different group destinations are live at once; lower it on
+	 *  memory-constrained targets. Default 4. */
+	UPROPERTY(Config, EditAnywhere, Category = "Navigation|Performance",
+		meta = (ClampMin = "1", ClampMax = "32", UIMin = "1", UIMax = "16",
+			DisplayName = "Flow Field Cache Capacity",
+			EditCondition = "IsUsingShippedAStar",
+			EditConditionHides))
+	int32 NavFlowFieldCacheCapacity;
+
 	/**
 	 * How close in height a candidate cell must be to count as "the same level" when the planner snaps
 	 * a destination onto walkable ground. Clicks (and formation slots) snap to the nearest passable
@@ -975,6 +1005,33 @@ public:
 	UPROPERTY(Config, EditAnywhere, Category = "Network", meta = (ClampMin = "1", ClampMax = "10", UIMin = "2", UIMax = "5"))
 	int32 InputDelayTurns;
 
+	/**
+	 * Let the host retune the input delay during a match from measured submission lateness. The session
+	 * starts at InputDelayTurns; the host then raises the delay when a peer's turns arrive too late to
+	 * beat the execution gate, and lowers it one turn at a time when every peer has spare lead. Each
+	 * change rides inside a committed turn, so every peer switches at the same turn boundary without a
+	 * resync. The sim is unaffected — only when local input is scheduled changes. Off by default.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Network")
+	bool bAdaptiveInputDelay;
+
+	/** Lowest delay the adaptive scheduler may choose. */
+	UPROPERTY(Config, EditAnywhere, Category = "Network", meta = (EditCondition = "bAdaptiveInputDelay", ClampMin = "1", ClampMax = "10"))
+	int32 MinAdaptiveInputDelayTurns;
+
+	/** Highest delay the adaptive scheduler may choose. Past this, a slow peer stalls the match rather
+	 *  than making everyone's input feel worse. */
+	UPROPERTY(Config, EditAnywhere, Category = "Network", meta = (EditCondition = "bAdaptiveInputDelay", ClampMin = "1", ClampMax = "10"))
+	int32 MaxAdaptiveInputDelayTurns;
+
+	/**
+	 * Turns of host time per measurement window. Lowering the delay waits for a full window of
+	 * comfortable samples; raising it reacts as soon as a few late submissions land inside the window.
+	 * 50 turns is five seconds at the default turn rate.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Network", meta = (EditCondition = "bAdaptiveInputDelay", ClampMin = "10", ClampMax = "600", UIMin = "20", UIMax = "200"))
+	int32 AdaptiveInputDelayWindowTurns;
+
 	/**
 	 * The most players one lockstep session supports. It sizes the session's player slots and bounds
 	 * the per-turn command gather. Going above 8 needs a check that the host's bandwidth still fits an
@@ -1029,6 +1086,24 @@ public:
 	UPROPERTY(Config, EditAnywhere, Category = "Network", meta = (ClampMin = "1", ClampMax = "300", UIMin = "1", UIMax = "60", EditCondition = "bDeterminismChecksEnabled"))
 	int32 DeterminismCheckIntervalTurns;
 
+	/**
+	 * When the determinism cross-check finds a mismatch, whether the host then walks the diverging
+	 * peers' canonical digest trees over the relay to name the exact sections, slots, and values that
+	 * differ. Only child digests of mismatching tree nodes travel, plus bounded text for the final
+	 * differing leaves. Diagnostics only; the result is logged, shown on screen, and available via
+	 * Sein.Net.DumpDesyncReport.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Network", meta = (EditCondition = "bDeterminismChecksEnabled"))
+	bool bDesyncLocalizationEnabled;
+
+	/**
+	 * How many recent determinism check images each peer keeps for desync localisation. Images share
+	 * unchanged digest trees, so a few cost little more than one; a mismatch reported after its image
+	 * was dropped is still flagged but cannot be localised. Default 3.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Network", meta = (ClampMin = "1", ClampMax = "16", EditCondition = "bDeterminismChecksEnabled && bDesyncLocalizationEnabled"))
+	int32 DesyncProofRetainedChecks;
+
 	// Network — Replay (recording storage/performance policy; not lockstep state)
 	// ----------------------------------------------------------------------------------------------------
 
@@ -1067,6 +1142,28 @@ public:
 				ClampMin = "64", ClampMax = "65536", UIMin = "1024", UIMax = "65536"))
 	int32 ReplayMaxFileSizeMiB;
 
+	/**
+	 * How many replay checkpoints share one keyframe. Every checkpoint after a keyframe stores only the
+	 * bytes of each snapshot section that changed since the checkpoint before it, so long recordings
+	 * spend far less disk per checkpoint; seeking then decodes at most this many checkpoints. 1 writes
+	 * every checkpoint as a standalone envelope, byte-identical to older recordings. Checkpoint digests
+	 * always cover the reconstructed canonical envelope. Local storage policy only, excluded from the
+	 * deterministic configuration fingerprint. Default 1.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Network|Replay",
+		meta = (DisplayName = "Checkpoint Keyframe Interval",
+				ClampMin = "1", ClampMax = "64", UIMin = "1", UIMax = "32"))
+	int32 ReplayCheckpointKeyframeInterval;
+
+	/**
+	 * Let each replay checkpoint section use LZ4 when that stores it in fewer bytes. Costs some
+	 * background encode time per checkpoint. Local storage policy only, excluded from the deterministic
+	 * configuration fingerprint. Default off.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Network|Replay",
+		meta = (DisplayName = "Compress Checkpoints"))
+	bool bCompressReplayCheckpoints;
+
 	// Drop-in / drop-out policy (Phase 4)
 	// ----------------------------------------------------------------------------------------------------
 
@@ -12,6 +12,7 @@
 #include "CoreMinimal.h"
 #include "Containers/BitArray.h"
 #include "Core/SeinEntityHandle.h"
+#include "Serialization/SeinReflectedStructPlan.h"
 #include "UObject/UnrealType.h"
 #include "UObject/UObjectGlobals.h"
 
@@ -57,6 +58,22 @@ public:
 	 *  wrapping either revision permanently disables reuse for this storage. */
 	virtual bool CanReuseSnapshotSerialization() const = 0;
 
+	/**
+	 * Slots touched since the previous drain, for one incremental consumer
+	 * (a schedule derived from a component field). Visits each slot whose
+	 * mutation revision advanced, once and ascending, with its stored handle
+	 * and payload, or an invalid handle and null payload when the slot is now
+	 * empty; then clears the record. Returns false without visiting on the
+	 * first call (which arms the journal) and after Clear(), when the consumer
+	 * must rebuild from ForEachLiveComponent instead. Process-local like the
+	 * revisions; never serialized.
+	 */
+	virtual bool DrainMutationJournal(
+		TFunctionRef<void(
+			int32 /*SlotIndex*/,
+			FSeinEntityHandle /*Handle*/,
+			const void* /*RawComponent*/)> Visitor) = 0;
+
 	/**
 	 * Sparse live-slot iteration: invoke Visitor for every alive slot exactly
 	 * once, in SLOT-INDEX ASCENDING order, handing it the exact generational
@@ -191,6 +208,10 @@ public:
 		}
 		StoredGenerations.SetNumZeroed(NewTotalSlots);
 		SlotMutationRevisions.SetNumZeroed(NewTotalSlots);
+		if (bJournalEnabled)
+		{
+			JournaledSlotBits.Add(false, NewTotalSlots - JournaledSlotBits.Num());
+		}
 
 		SlotCapacity = NewTotalSlots;
 
@@ -545,9 +566,41 @@ public:
 		HasComponentBits.Init(false, HasComponentBits.Num());
 		StoredGenerations.Init(0, StoredGenerations.Num());
 		ComponentCount = 0;
+		// Emptied slots are not touched; the journal consumer must rebuild.
+		bJournalComplete = false;
 		BumpTopologyRevision();
 	}
 
+	virtual bool DrainMutationJournal(
+		TFunctionRef<void(
+			int32 /*SlotIndex*/,
+			FSeinEntityHandle /*Handle*/,
+			const void* /*RawComponent*/)> Visitor) override
+	{
+		if (!bJournalEnabled || !bJournalComplete)
+		{
+			bJournalEnabled = true;
+			bJournalComplete = true;
+			JournaledSlotBits.Init(false, SlotCapacity);
+			JournaledSlots.Reset();
+			return false;
+		}
+		JournaledSlots.Sort();
+		for (const int32 SlotIndex : JournaledSlots)
+		{
+			JournaledSlotBits[SlotIndex] = false;
+			const bool bLive = HasComponentBits[SlotIndex];
+			Visitor(
+				SlotIndex,
+				bLive
+					? FSeinEntityHandle(SlotIndex, StoredGenerations[SlotIndex])
+					: FSeinEntityHandle::Invalid(),
+				bLive ? GetSlotPtr(SlotIndex) : nullptr);
+		}
+		JournaledSlots.Reset();
+		return true;
+	}
+
 	virtual void ForEachLiveComponent(
 		TFunctionRef<void(FSeinEntityHandle /*Handle*/, void* /*RawComponent*/)> Visitor) override
 	{
@@ -603,6 +656,23 @@ public:
 	{
 		if (!StructType) { int32 Zero = 0; Ar << Zero; return 0; }
 
+		// Same bytes as StructType->SerializeBin, with raw integer and
+		// fixed-point spans copied in runs; eligibility is per archive pass.
+		const TSharedRef<const FSeinReflectedStructPlan> Plan =
+			FSeinReflectedStructPlan::Get(*StructType);
+		const bool bCompiledPlan = Plan->CanSerializeBin(Ar);
+		const auto SerializePayload = [this, &Plan, bCompiledPlan, &Ar](int32 Slot)
+		{
+			if (bCompiledPlan)
+			{
+				Plan->SerializeBin(Ar, GetSlotPtr(Slot));
+			}
+			else
+			{
+				StructType->SerializeBin(Ar, GetSlotPtr(Slot));
+			}
+		};
+
 		if (Ar.IsSaving())
 		{
 			// Count alive slots first; write count, then per-entry write
@@ -620,7 +690,7 @@ public:
 				}
 				Ar << Slot;
 				Ar << Generation;
-				StructType->SerializeBin(Ar, GetSlotPtr(Slot));
+				SerializePayload(Slot);
 			}
 			return EntryCount;
 		}
@@ -654,7 +724,7 @@ public:
 				HasComponentBits[Slot] = true;
 				StoredGenerations[Slot] = Generation;
 				++ComponentCount;
-				StructType->SerializeBin(Ar, GetSlotPtr(Slot));
+				SerializePayload(Slot);
 				if (Ar.IsError())
 				{
 					return i;
@@ -700,6 +770,11 @@ private:
 			++MutationRevisionCounter;
 		}
 		SlotMutationRevisions[SlotIndex] = MutationRevisionCounter;
+		if (bJournalEnabled && !JournaledSlotBits[SlotIndex])
+		{
+			JournaledSlotBits[SlotIndex] = true;
+			JournaledSlots.Add(SlotIndex);
+		}
 	}
 
 	void BumpTopologyRevision()
@@ -750,6 +825,11 @@ private:
 	uint64 TopologyRevision = 1;
 	std::atomic_bool bMutablePointerEscaped{false};
 	bool bRevisionWrapped = false;
+	/** DrainMutationJournal record: touched slots, deduplicated by the bits. */
+	TArray<int32> JournaledSlots;
+	TBitArray<> JournaledSlotBits;
+	bool bJournalEnabled = false;
+	bool bJournalComplete = false;
 	int32 SlotCapacity = 0;
 	int32 ComponentCount;
 
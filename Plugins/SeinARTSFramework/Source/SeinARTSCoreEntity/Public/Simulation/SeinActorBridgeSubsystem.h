@@ -18,7 +18,9 @@
 #include "SeinActorBridgeSubsystem.generated.h"
 
 class ASeinActor;
+class USeinEntityComponent;
 class USeinWorldSubsystem;
+struct FConvexVolume;
 
 /** Broadcast when a tech is researched (for UI refresh). */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnTechResearched, FSeinPlayerID, Player, FGameplayTag, TechTag);
@@ -29,6 +31,21 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnVisualEventDispatched, const FSei
 /** Native presentation notification after an entity's visual actor enters the bridge map. */
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnSeinActorRegistered, FSeinEntityHandle);
 
+/**
+ * One row of the bridge's presentation index. Rows are rebuilt from the actor
+ * map after every sim frame, and registering or unregistering an actor adds
+ * or swap-removes its row in between. Row numbers are only valid until the
+ * next such change; the actor may also have been destroyed, so callers check
+ * it.
+ */
+struct FSeinPresentationEntity
+{
+	FSeinEntityHandle Handle;
+	FSeinPlayerID Owner;
+	TWeakObjectPtr<ASeinActor> Actor;
+	bool bSelectable = false;
+};
+
 /**
  * World subsystem that bridges the deterministic simulation with Unreal actors.
  *
@@ -67,6 +84,23 @@ public:
 	void ForEachRegisteredActor(
 		TFunctionRef<void(FSeinEntityHandle, ASeinActor&)> Visitor) const;
 
+	/**
+	 * Collect the rows whose bounding sphere intersects Volume (a view frustum
+	 * or a screen-rect pyramid). Each sphere encloses the entity's sim extents
+	 * (or actor bounds without extents) across the whole interpolation segment
+	 * to the next sim frame, so the result is a superset of any exact
+	 * screen-space test. An actor registered since the last sim frame is
+	 * indexed at its current location. Presentation-only.
+	 */
+	void QueryPresentationVolume(const FConvexVolume& Volume,
+		bool bSelectableOnly, TArray<int32>& OutRows) const;
+
+	/** Row lookup for QueryPresentationVolume results. */
+	const FSeinPresentationEntity& GetPresentationEntity(int32 Row) const
+	{
+		return PresentationEntities[Row];
+	}
+
 	/** Manually register an actor for an entity (for pre-placed level actors). */
 	UFUNCTION(BlueprintCallable, Category = "SeinARTS|Bridge")
 	void RegisterActor(FSeinEntityHandle Handle, ASeinActor* Actor);
@@ -159,6 +193,19 @@ private:
 	/** Delegate handle for the presentation-frame callback. */
 	FDelegateHandle SimFrameDelegateHandle;
 
+	/** Presentation index as parallel arrays: queries scan the packed
+	 *  bounding spheres (XYZ centre, W radius) and touch a row only on a hit. */
+	TArray<FVector4> PresentationSpheres;
+	TArray<FSeinPresentationEntity> PresentationEntities;
+	TMap<FSeinEntityHandle, int32> PresentationRowByHandle;
+
+	/** Append one index row for an actor whose snapshot was just shifted. */
+	void AppendPresentationRow(FSeinEntityHandle Handle, ASeinActor& Actor,
+		const USeinEntityComponent* Bridge);
+
+	/** Drop an entity's index row, if any, between sim-frame rebuilds. */
+	void RemovePresentationRow(FSeinEntityHandle Handle);
+
 	/** Called after the frame's sim pump — syncs latest transform snapshots. */
 	void HandleSimFrame(int32 LatestTick, int32 TicksProcessed);
 
@@ -0,0 +1,217 @@
+/**
+ * SeinARTS Framework - Copyright (c) 2026 Phenom Studios, Inc.
+ *
+ * @file         SeinSimulationThread.h
+ * @author       RJ Macklem
+ * @created      17 Oct 2026
+ * @latest       17 Oct 2026
+ * @brief        Dedicated worker that runs one frame's fixed-tick batch off the
+ *               game thread (Sein.Sim.DedicatedThread).
+ *
+ *          USeinWorldSubsystem kicks a batch from its end-of-frame ticker and
+ *          joins it when its world's next tick starts, so catch-up ticks
+ *          overlap the frame boundary (frame pacing, the message pump, begin-
+ *          frame work) instead of lengthening the game-thread frame. The two
+ *          threads never hold sim state at once: between kick and join the
+ *          game thread may only hand over commands, which the subsystem queues
+ *          lock-free and drains at the join, right after presentation has
+ *          read the finished frame.
+ *
+ *          The worker must never run game-thread-only engine work — package
+ *          loads chief among them. RunOnGameThread hands such work back and
+ *          blocks the batch until the game thread reaches the join and
+ *          services it. Every hop is counted, so the cost stays measurable.
+ *
+ *          A running batch holds the GC lock so collection cannot sweep
+ *          objects the tick is using. The lock is dropped between fixed ticks
+ *          and for the length of every hop: a game thread that starts a
+ *          blocking collection before reaching the join would otherwise wait
+ *          on a worker that is itself waiting on the join.
+ *
+ *          Which thread ran a tick is scheduling only, like the wall-clock
+ *          accumulator: it never reaches sim state, a digest or the wire.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "HAL/Runnable.h"
+#include "Misc/Optional.h"
+#include "UObject/GarbageCollection.h"
+#include "UObject/SoftObjectPtr.h"
+
+#include <atomic>
+
+class FEvent;
+class FRunnableThread;
+
+/** Why a frame's fixed ticks ran on the game thread although the dedicated
+ *  simulation thread was requested. */
+enum class ESeinSimulationThreadFallback : uint8
+{
+	/** The frame ran on the dedicated thread. */
+	None,
+	/** PIE and editor worlds stay on the game thread; standalone and
+	 *  networked game worlds qualify. */
+	NotGameWorld,
+	/** A bound observer needs per-tick callbacks on the game thread (for
+	 *  example replay recording); see FSeinSimulationThreadVeto. */
+	ObserverVeto,
+	/** Replay playback primes commands at every tick boundary. */
+	ReplayPlayback,
+	/** Resync catch-up and headless fast-forward are explicit game-thread
+	 *  workflows. */
+	CatchUpWindow,
+	/** A Blueprint ability, broker resolver or AI controller with script
+	 *  of its own is live; script events stay on the game thread. */
+	BlueprintSimLogic,
+	/** The platform could not start the worker. */
+	ThreadUnavailable,
+};
+
+SEINARTSCOREENTITY_API const TCHAR* SeinSimulationThreadFallbackName(
+	ESeinSimulationThreadFallback Fallback);
+
+/** Counters for the dedicated-thread mode. BatchSeconds minus
+ *  JoinWaitSeconds is the simulation time hidden from the game thread. */
+struct SEINARTSCOREENTITY_API FSeinSimulationThreadStats
+{
+	/** Frames whose fixed ticks ran on the dedicated thread. */
+	int64 DedicatedFrames = 0;
+
+	/** Frames that fell back to the game thread while the mode was on. */
+	int64 FallbackFrames = 0;
+
+	/** Game-thread work handed back by a running batch. */
+	int64 GameThreadHops = 0;
+
+	/** Cumulative worker time spent inside batches. */
+	double BatchSeconds = 0.0;
+
+	/** Cumulative game-thread time spent waiting at the join. */
+	double JoinWaitSeconds = 0.0;
+
+	ESeinSimulationThreadFallback LastFallback =
+		ESeinSimulationThreadFallback::None;
+
+	/** Offending class for BlueprintSimLogic; empty otherwise. */
+	FString LastFallbackDetail;
+};
+
+class SEINARTSCOREENTITY_API FSeinSimulationThread final : public FRunnable
+{
+public:
+	explicit FSeinSimulationThread(const TCHAR* ThreadName);
+	virtual ~FSeinSimulationThread() override;
+
+	FSeinSimulationThread(const FSeinSimulationThread&) = delete;
+	FSeinSimulationThread& operator=(const FSeinSimulationThread&) = delete;
+
+	/** Sein.Sim.DedicatedThread != 0. */
+	static bool IsEnabled();
+
+	/** The worker the calling thread belongs to, or null on any other thread. */
+	static FSeinSimulationThread* GetCurrent();
+
+	/** False when the platform refused to create the thread. */
+	bool IsRunning() const { return Thread != nullptr; }
+
+	/** Game thread: start Batch on the worker. At most one batch in flight. */
+	void Kick(TUniqueFunction<void()>&& Batch);
+
+	/** Game thread: block until the in-flight batch finishes, servicing any
+	 *  hand-back requests it raises meanwhile. Returns the seconds spent
+	 *  waiting; zero when no batch is in flight. */
+	double Join();
+
+	bool IsBatchInFlight() const { return bBatchInFlight.load(std::memory_order_acquire); }
+	bool IsCurrentThread() const { return GetCurrent() == this; }
+
+	/** From the worker: run Work on the game thread and block until it has
+	 *  run. From the game thread: run Work inline. */
+	void RunOnGameThread(TUniqueFunction<void()>&& Work);
+
+	/** From the worker, at a fixed-tick boundary: let a pending garbage
+	 *  collection run before the next tick retakes the GC lock. */
+	void YieldToGarbageCollection();
+
+	int64 GetGameThreadHopCount() const { return GameThreadHops.load(std::memory_order_relaxed); }
+
+	// FRunnable
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+private:
+	struct FGameThreadRequest
+	{
+		TUniqueFunction<void()> Work;
+		FEvent* Done = nullptr;
+	};
+
+	void ServiceGameThreadRequests();
+
+	TQueue<FGameThreadRequest*, EQueueMode::Mpsc> GameThreadRequests;
+	TUniqueFunction<void()> PendingBatch;
+	FEvent* BatchReady = nullptr;
+	FEvent* GameThreadWake = nullptr;
+	std::atomic<bool> bBatchInFlight{ false };
+	std::atomic<bool> bStopping{ false };
+	std::atomic<int64> GameThreadHops{ 0 };
+	FRunnableThread* Thread = nullptr;
+	/** Worker-only. Held while a batch runs, except across hops and between
+	 *  ticks. */
+	TOptional<FGCScopeGuard> BatchGCGuard;
+};
+
+/** Resolve a soft asset reference from simulation code on whichever thread is
+ *  running the tick. Resident assets resolve in place; a load the worker may
+ *  not perform is handed back to the game thread. */
+template<typename T>
+T* SeinLoadSimulationAsset(const TSoftObjectPtr<T>& Ptr)
+{
+	if (T* Resident = Ptr.Get())
+	{
+		return Resident;
+	}
+	if (Ptr.IsNull())
+	{
+		return nullptr;
+	}
+	FSeinSimulationThread* SimulationThread = FSeinSimulationThread::GetCurrent();
+	if (!SimulationThread)
+	{
+		return Ptr.LoadSynchronous();
+	}
+	T* Loaded = nullptr;
+	SimulationThread->RunOnGameThread([&Ptr, &Loaded]()
+	{
+		Loaded = Ptr.LoadSynchronous();
+	});
+	return Loaded;
+}
+
+/** Class counterpart of SeinLoadSimulationAsset. */
+template<typename T>
+UClass* SeinLoadSimulationClass(const TSoftClassPtr<T>& Ptr)
+{
+	if (UClass* Resident = Ptr.Get())
+	{
+		return Resident;
+	}
+	if (Ptr.IsNull())
+	{
+		return nullptr;
+	}
+	FSeinSimulationThread* SimulationThread = FSeinSimulationThread::GetCurrent();
+	if (!SimulationThread)
+	{
+		return Ptr.LoadSynchronous();
+	}
+	UClass* Loaded = nullptr;
+	SimulationThread->RunOnGameThread([&Ptr, &Loaded]()
+	{
+		Loaded = Ptr.LoadSynchronous();
+	});
+	return Loaded;
+}
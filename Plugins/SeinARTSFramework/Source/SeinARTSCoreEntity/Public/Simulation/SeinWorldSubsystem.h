@@ -8,6 +8,7 @@
 
 #include "CoreMinimal.h"
 #include "Containers/Ticker.h"
+#include "Engine/EngineBaseTypes.h"
 #include "Subsystems/WorldSubsystem.h"
 #include "Types/Entity.h"
 #include "Types/EntityID.h"
@@ -15,6 +16,8 @@
 #include "Types/Random.h"
 #include "Core/SeinEntityHandle.h"
 #include "Core/SeinEntityPool.h"
+#include "Core/SeinEntitySpatialIndex.h"
+#include "Core/SeinEntityTagBitIndex.h"
 #include "Core/SeinPlayerID.h"
 #include "Core/SeinFactionID.h"
 #include "Core/SeinPlayerState.h"
@@ -22,6 +25,7 @@
 #include "Navigation/SeinNavAgentProfile.h"
 #include "Simulation/ComponentStorage.h"
 #include "Simulation/SeinMatchBootstrapBarrier.h"
+#include "Simulation/SeinSimulationThread.h"
 #include "Simulation/SeinSnapshotRestoreAuthority.h"
 #include "Serialization/SeinCanonicalInitialStateDigest.h"
 #include "Serialization/SeinCanonicalStateRegistry.h"
@@ -60,6 +64,8 @@ class FSeinProductionSystem;
 struct FSeinActiveEffect;
 struct FSeinModifier;
 struct FSeinWorldStateRootCache;
+struct FSeinCanonicalStateProofImage;
+struct FSeinCanonicalStateProofLeaf;
 
 /**
  * Scratch record for an effect apply queued during a tick hook. Drained at the
@@ -176,6 +182,10 @@ struct SEINARTSCOREENTITY_API FSeinEntityTagState
 	 *  can remove the entity from the global EntityTagIndex bucket. No-op
 	 *  (returns false) on tags that were never granted or have refcount 0. */
 	bool UngrantTagInternal(const FGameplayTag& Tag);
+
+	/** Process-local presentation evidence, stamped by the subsystem on every
+	 *  grant/ungrant/seed. Never encoded into checkpoints or digests. */
+	uint64 MutationRevision = 0;
 };
 
 /** Broadcast after each sim tick completes (for actor bridge, replay, etc.). */
@@ -515,6 +525,17 @@ DECLARE_DELEGATE_RetVal_OneParam(bool, FSeinTurnReadyResolver, int32 /*Turn*/);
  */
 DECLARE_DELEGATE_OneParam(FSeinTurnConsumeNotifier, int32 /*Turn*/);
 
+/**
+ * Dedicated-thread veto. Returns true while its owner needs this world's
+ * per-tick callbacks (OnSimTickCompleted at every exact tick) on the game
+ * thread — a replay recording, for example. A live lockstep session does not
+ * veto: the kick opens the turn gate and the join delivers the observers that
+ * close each turn. Any number of owners register one through
+ * AddSimulationThreadVeto; a frame runs on the game thread, counted as an
+ * ObserverVeto fallback, when any of them returns true.
+ */
+DECLARE_DELEGATE_RetVal(bool, FSeinSimulationThreadVeto);
+
 /**
  * Lockstep-routing interceptor for `USeinAIController::EmitCommand`.
  * Bound by `USeinNetSubsystem` on the server when networking is active so
@@ -588,6 +609,16 @@ DECLARE_MULTICAST_DELEGATE_OneParam(
 	FOnSeinExecutionTopologyInvalidated,
 	const FString& /*Reason*/);
 
+/** Accumulated wall-clock cost of one registered system while system tick
+ *  timing is enabled. Diagnostic only; never hashed or restored. */
+struct FSeinSystemTickTiming
+{
+	FString CanonicalStableID;
+	ESeinTickPhase Phase = ESeinTickPhase::PreTick;
+	double TotalSeconds = 0.0;
+	int32 TickCount = 0;
+};
+
 /**
  * World subsystem that owns and ticks the deterministic simulation.
  * Manages entity pool, component storage, phase-based tick loop,
@@ -746,6 +777,11 @@ public:
 		return ExecutionTopologyFailureReason;
 	}
 
+	/** Zero-based concurrent wave of a registered system within its phase, or
+	 *  INDEX_NONE before freeze or for an unknown ID. Systems sharing a wave
+	 *  declared non-conflicting access; see FSeinSystemAccess. */
+	int32 GetExecutionScheduleWave(FName StableSystemID) const;
+
 	/**
 	 * Terminally release all module-owned live-world state before a
 	 * deterministic implementation DLL unloads.
@@ -929,10 +965,48 @@ public:
 	UFUNCTION(BlueprintPure, Category = "SeinARTS|Simulation")
 	float GetInterpolationAlpha() const;
 
+	/**
+	 * Headless fast-forward: run up to MaxTicks fixed ticks back to back with
+	 * no wall-clock pacing and no MaxTicksPerFrame clamp. Every tick still goes
+	 * through the ordinary pump (lockstep/replay turn gates, replay command
+	 * lane, tick-completed observers), so results are bit-identical to a paced
+	 * run. OnSimFrameCompleted is NOT broadcast: presentation (actor bridge,
+	 * fog visibility, UI) never sees the skipped frames. Stops early when the
+	 * sim stops or a gate stalls. Returns the number of ticks completed.
+	 */
+	int32 AdvanceSimulationUnthrottled(int32 MaxTicks);
+
+	/** Dedicated simulation-thread counters (Sein.Sim.DedicatedThread). */
+	const FSeinSimulationThreadStats& GetSimulationThreadStats() const { return SimulationThreadStats; }
+
+	/** True from the end-of-frame kick of a dedicated-thread batch until the
+	 *  next world tick joins it. Game-thread code must not read sim state
+	 *  while this holds (non-shipping builds trap the public accessors);
+	 *  command submission stays legal and is queued. */
+	bool IsSimulationBatchInFlight() const;
+
+	/** Game thread: finish the in-flight batch now and publish its frame.
+	 *  For readers that run between the kick and the next world tick — UMG,
+	 *  Slate, core tickers. No-op when no batch is in flight. */
+	void WaitForSimulationThreadBatch();
+
+	/** Start (resetting) or stop per-system wall-clock accounting in the
+	 *  tick pipeline. Off by default; costs two clock reads per system tick. */
+	void SetSystemTickTimingEnabled(bool bEnabled);
+
+	bool IsSystemTickTimingEnabled() const { return bSystemTickTimingEnabled; }
+
+	/** Accumulated per-system timings in canonical dispatch order. */
+	void GetSystemTickTimings(TArray<FSeinSystemTickTiming>& OutTimings) const;
+
 	// ========== Sim Tick Delegate ==========
 
 	/** Broadcast after each sim tick completes. Used by presentation and
-	 *  lifecycle observers; listeners cannot mutate sim state or enqueue work. */
+	 *  lifecycle observers; listeners cannot mutate sim state or enqueue work.
+	 *  Always fires on the game thread. When the dedicated simulation thread
+	 *  runs the frame, the join delivers the batch's ticks in order after the
+	 *  whole batch ran; observers that must see the world at each exact tick
+	 *  register AddSimulationThreadVeto. */
 	FOnSimTickCompleted OnSimTickCompleted;
 
 	/** Latest completed state, once per engine frame that advanced simulation.
@@ -1129,10 +1203,18 @@ public:
 	 *  slot is assigned. Sim's TickSimulation consults the resolver at every
 	 *  turn boundary; on green, fires the notifier to drain that turn's
 	 *  assembled commands into PendingCommands. Unbound = no gating
-	 *  (Standalone or networking disabled). */
+	 *  (Standalone or networking disabled). Both always run on the game
+	 *  thread: a dedicated-thread batch is opened at its kick and never
+	 *  crosses a second boundary. */
 	FSeinTurnReadyResolver     TurnReadyResolver;
 	FSeinTurnConsumeNotifier   TurnConsumeNotifier;
 
+	/** Register a veto consulted once per frame before a batch may leave the
+	 *  game thread. Vetoes combine any-true; keep the handle to remove it. */
+	FDelegateHandle AddSimulationThreadVeto(FSeinSimulationThreadVeto&& Veto);
+	void RemoveSimulationThreadVeto(FDelegateHandle Handle);
+	bool IsSimulationThreadVetoed() const;
+
 	/**
 	 * Install the active topology adapter's AI route. The delegate remains
 	 * opaque after installation: only the world's exact, lexically active AI
@@ -1231,7 +1313,24 @@ public:
 	void SetEntityOwner(FSeinEntityHandle Handle, FSeinPlayerID NewOwner);
 
 	/** Read-only entity-pool view (for direct canonical iteration/query). */
-	const FSeinEntityPool& GetEntityPool() const { return EntityPool; }
+	const FSeinEntityPool& GetEntityPool() const
+	{
+		CheckSimulationStateAccess(TEXT("GetEntityPool"));
+		return EntityPool;
+	}
+
+	/**
+	 * Presentation-only change evidence for one entity. Appends the restore
+	 * epoch, the pool slot revision, every component storage's revision for the
+	 * handle, the tag-state revision, each owned ability instance's runtime
+	 * revision, the owner's player-state revision and the owner's
+	 * pair-capability revision. Equal arrays from two calls mean nothing UI
+	 * reads for the entity changed in between; the order is only stable
+	 * within one process. Never serialized or hashed.
+	 */
+	void GatherEntityPresentationRevisions(
+		FSeinEntityHandle Handle,
+		TArray<uint64>& OutRevisions) const;
 
 	/**
 	 * Explicit mutable entity-pool access for deterministic systems. Returns
@@ -1239,6 +1338,12 @@ public:
 	 */
 	FSeinEntityPool* GetEntityPoolMutable();
 
+	/** Gameplay spatial index over every live entity (range/box candidate
+	 *  source). Brought up to date with the pool on access by re-binning only
+	 *  slots mutated since the last access; safe from read-only parallel
+	 *  bodies. Candidates are slot-ascending; callers apply their exact test. */
+	const FSeinEntitySpatialIndex& GetEntitySpatialIndex() const;
+
 	/** Collision broadphase (two-tier static/dynamic bucket grid). Rebuilt each
 	 *  tick by `FSeinCollisionBroadphaseSystem` (PreTick); queried by
 	 *  `FSeinCollisionResolutionSystem` (PostTick). Collision-only — navigation
@@ -1265,6 +1370,12 @@ public:
 	/** Get mutable player state by ID. Returns null if not found. C++ only. */
 	FSeinPlayerState* GetPlayerStateMutable(FSeinPlayerID PlayerID);
 
+	/** Advance the player's presentation revision after writing something an
+	 *  owned entity presents (resources, caps, player tags, player-scoped
+	 *  effects). GetPlayerStateMutable does not, since most callers only look
+	 *  effects up through it. Process-local; never serialized. */
+	void MarkPlayerStatePresentationDirty(FSeinPlayerID PlayerID);
+
 	// ========== Component Management (slot-indexed) ==========
 	//
 	// Component types are resolved at spawn time by walking the Blueprint CDO's
@@ -1535,6 +1646,19 @@ public:
 	 *  ability's Mark Deterministic State Dirty node explicitly. */
 	void MarkAbilityRuntimeStateDirty(const USeinAbility* Ability);
 
+	/** Move out the pool IDs registered or marked dirty since the previous
+	 *  drain in first-touch order (only a recycled slot can repeat). Single
+	 *  consumer: FSeinCooldownSystem enrolls newly cooling abilities from it
+	 *  instead of visiting the whole pool. A snapshot restore empties the
+	 *  feed; consumers rescan on OnAuthoritativeStateRestored. */
+	void DrainDirtiedAbilityIDs(TArray<int32>& OutIDs);
+
+	/** Upper bound (exclusive) of valid ability pool IDs. */
+	int32 GetAbilityPoolSlotCount() const
+	{
+		return AbilityPool.Num();
+	}
+
 	int64 GetNextAbilityActivationID() const
 	{
 		return NextAbilityActivationID;
@@ -1570,6 +1694,24 @@ public:
 	UFUNCTION(BlueprintPure, Category = "SeinARTS|Tags")
 	bool HasAllTags(FSeinEntityHandle Handle, const FGameplayTagContainer& Tags) const;
 
+	/** Compile a tag set once for a sweep of EntityMatchesAllTags /
+	 *  EntityMatchesAnyTag tests — the fast path for filtering many entities
+	 *  by the same tags. Same answers as HasAllTags/HasAnyTag. */
+	FSeinTagBitMask CompileTagMask(const FGameplayTagContainer& Tags) const
+	{
+		return EntityTagBits.Compile(Tags);
+	}
+
+	bool EntityMatchesAllTags(FSeinEntityHandle Handle, const FSeinTagBitMask& Mask) const
+	{
+		return EntityTagBits.MatchesAll(Handle, Mask);
+	}
+
+	bool EntityMatchesAnyTag(FSeinEntityHandle Handle, const FSeinTagBitMask& Mask) const
+	{
+		return EntityTagBits.MatchesAny(Handle, Mask);
+	}
+
 	/** Return the entity's CombinedTags (the refcount > 0 projection). Returns
 	 *  a const ref to the empty container if the entity has no tag state. */
 	const FGameplayTagContainer& GetEntityTags(FSeinEntityHandle Handle) const;
@@ -1994,6 +2136,13 @@ public:
 		return SimulationContentFailureReason;
 	}
 
+	/** The manifest profile selected for this world; empty until content is
+	 *  ready. Extensions read its records to pre-resolve pinned assets. */
+	const FSeinSimulationContentManifestProfile& GetSimulationContentProfile() const
+	{
+		return SimulationContentProfile;
+	}
+
 	/** Seed most recently used to initialize the world-owned deterministic PRNG. */
 	int64 GetSessionSeed() const { return SimSessionSeed; }
 
@@ -2207,6 +2356,17 @@ private:
 	template<typename T>
 	T* GetDeferredTeardownComponent(FSeinEntityHandle Handle);
 	bool RequireMutableStateAccess(const TCHAR* Operation) const;
+	/** Non-shipping trap for a game-thread accessor call while a dedicated-
+	 *  thread batch owns the sim. The worker and its parallel bodies pass. */
+	void CheckSimulationStateAccess(const TCHAR* Accessor) const
+	{
+#if !UE_BUILD_SHIPPING
+		ensureMsgf(!IsInGameThread() || !IsSimulationBatchInFlight()
+				|| bGameThreadSystemTickInProgress,
+			TEXT("%s read simulation state while a dedicated-thread batch is in flight; call WaitForSimulationThreadBatch first."),
+			Accessor);
+#endif
+	}
 	/** Refresh only mutation-affected Core leaves in the routine root cache.
 	 *  ForceFullRebuild is the independent verifier path. */
 	bool RefreshCanonicalStateRootCacheCore(
@@ -2234,6 +2394,22 @@ private:
 		int32 ExpectedCompletedTick,
 		FGuid& OutRoot,
 		FString& OutError) const;
+	/** Image the digest trees behind the routine root sealed for
+	 *  CompletedTick. Sections whose digest is unchanged since Previous share
+	 *  its tree instead of copying. */
+	bool CaptureCanonicalStateProofImage(
+		int32 CompletedTick,
+		const FSeinCanonicalStateProofImage* Previous,
+		FSeinCanonicalStateProofImage& OutImage,
+		FString& OutError) const;
+	/** Recompute one indexed leaf of an imaged section from live state and
+	 *  render its bounded payload for a desync report. */
+	bool DescribeCanonicalStateProofLeaf(
+		const FSeinCanonicalStateProofImage& Image,
+		FStringView SectionId,
+		int32 LeafIndex,
+		FSeinCanonicalStateProofLeaf& OutLeaf,
+		FString& OutError) const;
 	void MarkCanonicalAuxiliaryStateDirty();
 	/** Last completed tick at which the periodic incremental-root verification
 	 *  diagnostic ran (Sein.Sim.StateRoot.VerifyIncrementalInterval). Plain
@@ -2296,6 +2472,11 @@ private:
 	// query surface. Initialized in Initialize(). Collision-only (not navigation).
 	FSeinCollisionSpatialHash CollisionSpatialHash;
 
+	// Gameplay spatial index — pure C++, synced lazily from the pool's slot
+	// mutation revisions by GetEntitySpatialIndex(). Mutable because a const
+	// query is what brings it up to date; never serialized or hashed.
+	mutable FSeinEntitySpatialIndex EntitySpatialIndex;
+
 	// Active collision resolver — owns the per-tick separation + overlap-event
 	// logic the PostTick FSeinCollisionResolutionSystem delegates to. Instantiated
 	// in Initialize() from USeinARTSCoreSettings::CollisionResolverClass (falls back
@@ -2344,6 +2525,15 @@ private:
 		ISeinSystem* System = nullptr;
 		FSeinSystemDescriptor Descriptor;
 		FString CanonicalStableID;
+		int32 ScheduleWave = INDEX_NONE;
+	};
+
+	/** One set of mutually non-conflicting systems. Indices address Systems in
+	 *  canonical order; waves are ordered by phase, then wave number. */
+	struct FSystemWave
+	{
+		ESeinTickPhase Phase = ESeinTickPhase::PreTick;
+		TArray<int32> SystemIndices;
 	};
 
 	struct FRegisteredAuthoritativeDestinationProvider
@@ -2409,6 +2599,8 @@ private:
 
 	// Registered systems become immutable and canonically ordered before tick zero.
 	TArray<FRegisteredSystem> Systems;
+	// Compiled from declared access when the topology freezes.
+	TArray<FSystemWave> SystemWaves;
 	TArray<ISeinSystem*> BuiltInSystems; // Owned by this subsystem, deleted on deinit
 	FString ExecutionTopologyManifest;
 	FString ExecutionTopologyFailureReason;
@@ -2501,6 +2693,11 @@ private:
 	// buckets before its tag state is freed.
 	TMap<FGameplayTag, TArray<FSeinEntityHandle>> EntityTagIndex;
 
+	// Dense per-entity tag bitsets (CombinedTags closed over parents) that
+	// answer HasTag/HasAnyTag/HasAllTags. Refreshed on 0↔1 refcount edges,
+	// cleared by UnindexEntityTags, rebuilt after restore; never serialized.
+	FSeinEntityTagBitIndex EntityTagBits;
+
 	// Named entity registry (designer-addressable aliases).
 	TMap<FName, FSeinEntityHandle> NamedEntityRegistry;
 
@@ -2530,6 +2727,11 @@ private:
 	TArray<uint64> AbilityPoolStateRevisions;
 	uint64 AbilityPoolMutationRevision = 0;
 	uint64 AbilityPoolTopologyRevision = 1;
+	// Non-canonical dirty feed for DrainDirtiedAbilityIDs. An ID is appended
+	// only while its state revision is at or below the drain revision, so a
+	// live slot is listed at most once per drain.
+	TArray<int32> DirtiedAbilityIDs;
+	uint64 DirtiedAbilityDrainRevision = 0;
 	int64 NextAbilityActivationID = 1;
 
 	UPROPERTY()
@@ -2553,6 +2755,20 @@ private:
 	mutable TSharedPtr<FSeinWorldStateRootCache> CanonicalStateRootCache;
 	uint64 CanonicalAuxiliaryMutationRevision = 1;
 
+	// Presentation change evidence for GatherEntityPresentationRevisions. The
+	// counter stamps tag states and player states; the epoch advances on every
+	// authoritative restore because restored storages and pools restart their
+	// own revision counters. Process-local, never serialized.
+	uint64 PresentationMutationRevision = 0;
+	uint64 PresentationRestoreEpoch = 0;
+	TMap<FSeinPlayerID, uint64> PlayerStatePresentationRevisions;
+	// Stamped on both endpoints when a pair capability appears or disappears.
+	TMap<FSeinPlayerID, uint64> PairCapabilityPresentationRevisions;
+	uint64 NextPresentationMutationRevision();
+	void MarkPairCapabilityPresentationDirty(
+		FSeinPlayerID SourcePlayer,
+		FSeinPlayerID TargetPlayer);
+
 	// Tick the registered AI controllers. Called from TickSystems at
 	// CommandProcessing phase, right before ProcessCommands.
 	void TickAIControllers(FFixedPoint DeltaTime);
@@ -2693,6 +2909,70 @@ private:
 	float TimeAccumulator = 0.0f;
 	float FixedDeltaTimeSeconds = 1.0f / 30.0f;
 
+	// Headless fast-forward in progress: suppresses presentation frame
+	// observers. Scheduling only, like the accumulator above.
+	bool bUnthrottledAdvanceInProgress = false;
+
+	// Dedicated simulation thread (Sein.Sim.DedicatedThread). Scheduling
+	// only, like the accumulator: which thread ran a tick never reaches sim
+	// state. The worker is created on the first eligible frame and released
+	// with the scheduler.
+	/** An AI command bound for the topology adapter, raised on the worker. */
+	struct FSimulationDeferredAIEmit
+	{
+		FSeinPlayerID OwnedPlayerID;
+		FSeinCommand Command;
+	};
+	struct FSimulationFrameRecord
+	{
+		int32 LastCompletedTick = INDEX_NONE;
+		int32 TicksProcessed = 0;
+		int32 MaxTicks = 0;
+		/** Worker batches only: OnSimTickCompleted ticks the join broadcasts. */
+		TArray<int32> DeferredCompletedTicks;
+		/** Worker batches only: AI emits the join routes, in emit order. */
+		TArray<FSimulationDeferredAIEmit> DeferredAIEmits;
+	};
+	/** A command handed over while a batch holds the sim, replayed through
+	 *  its original entry point at the join. */
+	struct FSimulationThreadIngress
+	{
+		FSeinCommand Command;
+		FSeinPlayerID AuthenticatedPlayer;
+		ESeinCommandIssuerKind AuthenticatedIssuerKind = ESeinCommandIssuerKind::Player;
+		bool bLocalDraft = false;
+		bool bRequestMatchAdministration = false;
+	};
+	TUniquePtr<FSeinSimulationThread> SimulationThread;
+	FDelegateHandle SimulationThreadJoinHandle;
+	/** Registration order; each keyed by its delegate's own handle. */
+	TArray<FSeinSimulationThreadVeto> SimulationThreadVetoes;
+	/** Game thread only: a game-thread-affine system handed back by the
+	 *  worker is ticking, so the game thread owns the sim until it returns. */
+	bool bGameThreadSystemTickInProgress = false;
+	/** Kick to join. Read by the worker to route its own ingress inline. */
+	std::atomic<bool> bSimulationBatchAwaitingJoin{ false };
+	/** Written by the in-flight batch, published by the join. */
+	FSimulationFrameRecord SimulationThreadFrame;
+	double SimulationThreadBatchSeconds = 0.0;
+	/** Topology failure raised on the worker; the join completes it. */
+	FString DeferredExecutionTopologyFailure;
+	TQueue<FSimulationThreadIngress, EQueueMode::Mpsc> SimulationThreadInbox;
+	FSeinSimulationThreadStats SimulationThreadStats;
+	ESeinSimulationThreadFallback LoggedSimulationThreadFallback =
+		ESeinSimulationThreadFallback::None;
+	// Blueprint scan cache, keyed by the pools' topology revisions.
+	uint64 BlueprintScanAbilityRevision = 0;
+	uint64 BlueprintScanResolverRevision = 0;
+	int32 BlueprintScanAIControllerCount = INDEX_NONE;
+	FString BlueprintSimLogicClass;
+
+	// Optional per-system timing, index-aligned with Systems. Workers of one
+	// wave write disjoint slots.
+	bool bSystemTickTimingEnabled = false;
+	TArray<double> SystemTickSeconds;
+	TArray<int32> SystemTickCounts;
+
 	// Persistence tracking for the "Simulation falling behind" log: most
 	// clamps are transient single-frame hitches and don't warrant a Warning.
 	// Only escalate to Warning when clamping has been CONTINUOUS for ≥1s.
@@ -2709,9 +2989,32 @@ private:
 	};
 
 	bool TickSimulation(float DeltaTime);
+	static int32 GetTicksPerTurn();
+	/** Resolver must be bound. On green, drains Turn into PendingCommands. */
+	bool PassTurnGate(int32 Turn);
+	void RunFixedTickBatch(
+		int32 MaxTicks,
+		bool bValidateBindingsEachTick,
+		FSimulationFrameRecord& OutFrame);
+	void PublishSimulationFrame(const FSimulationFrameRecord& Frame);
+	bool ShouldRunBatchOnSimulationThread();
+	ESeinSimulationThreadFallback EvaluateSimulationThreadFallback(
+		FString& OutDetail);
+	bool FindBlueprintSimLogic(FString& OutClassName);
+	void KickSimulationThreadBatch(int32 MaxTicks);
+	void JoinSimulationThreadBatch();
+	void HandleWorldTickStart(
+		UWorld* TickingWorld, ELevelTick TickType, float DeltaSeconds);
+	bool ShouldQueueForSimulationThread() const;
+	void DrainSimulationThreadInbox();
+	bool IsOnSimulationOwningThread() const;
 	bool ValidateFrozenConfigFingerprint();
 	bool ValidateFrozenCanonicalStateWorldBindings();
 	void TickSystems(FFixedPoint DeltaTime);
+	bool TickSystemPhase(ESeinTickPhase Phase, FFixedPoint DeltaTime);
+	void TickRegisteredSystem(
+		const FRegisteredSystem& Registered,
+		FFixedPoint DeltaTime);
 	void ProcessCommands();
 	void PumpPauseControlFrame();
 	bool ResolvePauseControlFrame(FSeinPauseControlFrame& OutFrame);
@@ -2753,6 +3056,9 @@ private:
 		FString& OutError) const;
 	void AdoptExecutionTopologyCandidate(
 		FExecutionTopologyCandidate&& Candidate);
+	static void CompileExecutionSchedule(
+		TArray<FRegisteredSystem>& InOutSystems,
+		TArray<FSystemWave>& OutWaves);
 	bool FreezeExecutionTopology(FString& OutError);
 	void RecordExecutionTopologyFailure(const FString& Reason);
 	void InvalidateFrozenExecutionTopology(const FString& Reason);
@@ -2797,6 +3103,9 @@ private:
 	// Strip a handle from every EntityTagIndex bucket it appears in (at destroy).
 	void UnindexEntityTags(FSeinEntityHandle Handle);
 
+	// Rebuild EntityTagBits from EntityTagStates (after a wholesale replace).
+	void RebuildEntityTagBits();
+
 	// Drop any named-registry entries that reference the given handle (at destroy).
 	void UnregisterHandleFromNames(FSeinEntityHandle Handle);
 };
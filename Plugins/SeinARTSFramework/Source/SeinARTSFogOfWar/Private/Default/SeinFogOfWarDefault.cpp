@@ -33,7 +33,9 @@
 #include "Core/SeinEntityPool.h"
 #include "Core/SeinEntityHandle.h"
 #include "Core/SeinParallel.h"
+#include "Core/SeinTickPhase.h"
 #include "Types/Entity.h"
+#include "Math/MathLib.h"
 
 #include "Engine/World.h"
 #include "EngineUtils.h"
@@ -339,6 +341,7 @@ USeinFogOfWarDefault::LoadFromSubstrateImpl(
 	DynamicBlockerSnapshots.Reset();
 	LastDynamicBlockerCells.Reset();
 	ResetRoutineRootCache();
+	ResetPresentationTiles();
 
 	// Dequantize. Runtime stores ABSOLUTE world Z for both (Ground = MinHeight
 	// + Q·steps; Blocker = Ground + Q·steps) so shadowcast's lampshade test is
@@ -426,6 +429,7 @@ void USeinFogOfWarDefault::InitGridFromVolumesImpl(UWorld* World)
 		LastDynamicBlockerCells.Reset();
 		StaticGridDigest.Invalidate();
 		ResetRoutineRootCache();
+		ResetPresentationTiles();
 		OnFogOfWarMutated.Broadcast();
 		return;
 	}
@@ -488,6 +492,7 @@ void USeinFogOfWarDefault::InitGridFromVolumesImpl(UWorld* World)
 	DynamicBlockerSnapshots.Reset();
 	LastDynamicBlockerCells.Reset();
 	ResetRoutineRootCache();
+	ResetPresentationTiles();
 
 	// Per-cell downward trace capped at InitTraceCellCap — no-bake fallback.
 	// Trace endpoints are runtime-only (the trace itself is non-deterministic
@@ -889,6 +894,26 @@ void USeinFogOfWarDefault::TickStamps(UWorld* World)
 	}
 }
 
+bool USeinFogOfWarDefault::DescribeSystemAccess(
+	FSeinSystemAccess& OutAccess) const
+{
+	// Only the exact native TickStamps is known to touch nothing but this
+	// object's own canonical state. Subclasses keep the conservative barrier.
+	// The mutation broadcast reaches presentation listeners, so it stays on the
+	// dispatching thread.
+	if (GetClass() != StaticClass())
+	{
+		return false;
+	}
+	OutAccess = FSeinSystemAccess::Declared()
+		.ReadsComponent(FSeinVisionComponent::StaticStruct())
+		.ReadsComponent(FSeinExtentsComponent::StaticStruct())
+		.ReadsComponent(FSeinFogVisibilityComponent::StaticStruct())
+		.ReadsShared(ESeinSystemSharedState::EntityTransforms)
+		.OnGameThread();
+	return true;
+}
+
 void USeinFogOfWarDefault::RemoveSourceStamp(FSeinEntityHandle Handle)
 {
 	FSeinFogSourceState* State = SourceStates.Find(Handle);
@@ -937,6 +962,27 @@ void USeinFogOfWarDefault::GenerateLayerFootprintCells(
 	// caller's diff handles the refcount/bitfield mutation.
 	OutCells.Add(CellIndex(SX, SY));
 
+	if (StampKernel == ESeinFogStampKernel::ClearanceTable)
+	{
+		// Collect the candidates in visitation order (tracking how far the
+		// coverage reaches from the apex), then filter them in place.
+		const int32 FirstCandidate = OutCells.Num();
+		int32 Reach = 0;
+		SeinStampUtils::ForEachCoveredCell(
+			Shape, EntityWorldPos, EntityRotation,
+			CellSize, Origin, Width, Height,
+			[&](int32 TX, int32 TY)
+			{
+				if (TX == SX && TY == SY) return;
+				OutCells.Add(CellIndex(TX, TY));
+				Reach = FMath::Max(Reach,
+					FMath::Max(FMath::Abs(TX - SX), FMath::Abs(TY - SY)));
+			});
+		FilterCandidatesByClearance(SX, SY, EyeZ, StampBitMask, Reach,
+			FirstCandidate, OutCells);
+		return;
+	}
+
 	// Walk every cell inside the shape's coverage. For each one, run LOS
 	// from the apex cell to the target cell — the apex eye Z plus the
 	// target's terrain Z drive the lampshade interpolation in
@@ -961,6 +1007,125 @@ void USeinFogOfWarDefault::GenerateLayerFootprintCells(
 		});
 }
 
+void USeinFogOfWarDefault::FilterCandidatesByClearance(int32 SX, int32 SY,
+	FFixedPoint EyeZ, uint8 StampBitMask, int32 Reach,
+	int32 FirstCandidate, TArray<int32>& OutCells) const
+{
+	if (Reach <= 0 || FirstCandidate >= OutCells.Num()) return;
+
+	// Raw-magnitude bound under which EyeZ + Slope·Ring never wraps, so the
+	// slope inequality below is exactly the walk's accumulated-Z compare.
+	constexpr int64 NoWrapLimit = int64(1) << 60;
+	const int64 Eye = EyeZ.Value;
+	bool bEarlyAcceptSafe = Eye > -NoWrapLimit && Eye < NoWrapLimit;
+
+	// Occluder-top window centred on the apex. Cells off the grid are never
+	// on a walk between two on-grid cells; they stay at the sentinel.
+	const int32 Span = 2 * Reach + 1;
+	TArray<int64> Tops;
+	Tops.Init(MIN_int64, Span * Span);
+	auto WindowIndex = [SX, SY, Reach, Span](int32 X, int32 Y)
+	{
+		return (Y - SY + Reach) * Span + (X - SX + Reach);
+	};
+
+	// RingSlope[c]: max over every cell at Chebyshev ring 1..c of the minimum
+	// per-step ray slope that clears it, ceil((Top − EyeZ) / ring).
+	TArray<int64> RingSlope;
+	RingSlope.Init(MIN_int64, Reach + 1);
+	const int32 MinX = FMath::Max(0, SX - Reach);
+	const int32 MaxX = FMath::Min(Width - 1, SX + Reach);
+	const int32 MinY = FMath::Max(0, SY - Reach);
+	const int32 MaxY = FMath::Min(Height - 1, SY + Reach);
+	for (int32 Y = MinY; Y <= MaxY; ++Y)
+	{
+		for (int32 X = MinX; X <= MaxX; ++X)
+		{
+			const int64 Top = GetOccluderTopForMask(CellIndex(X, Y), StampBitMask).Value;
+			Tops[WindowIndex(X, Y)] = Top;
+			const int32 Ring = FMath::Max(FMath::Abs(X - SX), FMath::Abs(Y - SY));
+			if (Ring == 0) continue;
+			if (Top <= -NoWrapLimit || Top >= NoWrapLimit)
+			{
+				bEarlyAcceptSafe = false;
+				continue;
+			}
+			const int64 Rise = Top - Eye;
+			// Floor-correct ceil division (Rise may be negative).
+			int64 Slope = Rise / Ring;
+			if ((Rise % Ring) != 0 && Rise > 0) ++Slope;
+			RingSlope[Ring] = FMath::Max(RingSlope[Ring], Slope);
+		}
+	}
+	for (int32 Ring = 1; Ring <= Reach; ++Ring)
+	{
+		RingSlope[Ring] = FMath::Max(RingSlope[Ring], RingSlope[Ring - 1]);
+	}
+	const int64 MaxSafeSlope = NoWrapLimit / Reach;
+
+	// In-place stable compaction: keep exactly the candidates the LineWalk
+	// kernel would keep, in the order they were visited.
+	int32 Write = FirstCandidate;
+	for (int32 Read = FirstCandidate; Read < OutCells.Num(); ++Read)
+	{
+		const int32 TargetIdx = OutCells[Read];
+		const int32 TX = TargetIdx % Width;
+		const int32 TY = TargetIdx / Width;
+		const FFixedPoint TargetZ = GroundHeight.IsValidIndex(TargetIdx)
+			? GroundHeight[TargetIdx] : Origin.Z;
+		const int32 TotalSteps = FMath::Max(FMath::Abs(TX - SX), FMath::Abs(TY - SY));
+
+		// Same StepZ (and same accumulation) as HasLineOfSightToCell.
+		const FFixedPoint StepZ = (TargetZ - EyeZ) / FFixedPoint::FromInt(TotalSteps);
+		bool bVisible = bEarlyAcceptSafe
+			&& StepZ.Value > -MaxSafeSlope && StepZ.Value < MaxSafeSlope
+			&& StepZ.Value >= RingSlope[TotalSteps - 1];
+		if (!bVisible)
+		{
+			const int32 DX =  FMath::Abs(TX - SX);
+			const int32 DY = -FMath::Abs(TY - SY);
+			const int32 SXStep = (SX < TX) ? 1 : -1;
+			const int32 SYStep = (SY < TY) ? 1 : -1;
+			int32 Err = DX + DY;
+			int32 X = SX;
+			int32 Y = SY;
+			FFixedPoint RayZ = EyeZ;
+			while (true)
+			{
+				const int32 E2 = 2 * Err;
+				if (E2 >= DY) { Err += DY; X += SXStep; }
+				if (E2 <= DX) { Err += DX; Y += SYStep; }
+				RayZ += StepZ;
+
+				if (X == TX && Y == TY) { bVisible = true; break; }
+				if (Tops[WindowIndex(X, Y)] > RayZ.Value) break;
+			}
+		}
+		if (bVisible)
+		{
+			OutCells[Write++] = TargetIdx;
+		}
+	}
+	OutCells.SetNum(Write, EAllowShrinking::No);
+}
+
+FFixedPoint USeinFogOfWarDefault::GetOccluderTopForMask(int32 CellIdx, uint8 StampBitMask) const
+{
+	FFixedPoint Top = GroundHeight.IsValidIndex(CellIdx) ? GroundHeight[CellIdx] : FFixedPoint::Zero;
+	const uint8 StaticMask = BlockerLayerMask.IsValidIndex(CellIdx) ? BlockerLayerMask[CellIdx] : 0;
+	if ((StaticMask & StampBitMask) != 0)
+	{
+		Top = SeinMath::Max(Top, BlockerHeight.IsValidIndex(CellIdx)
+			? BlockerHeight[CellIdx] : FFixedPoint::Zero);
+	}
+	const uint8 DynMask = DynamicBlockerLayerMask.IsValidIndex(CellIdx) ? DynamicBlockerLayerMask[CellIdx] : 0;
+	if ((DynMask & StampBitMask) != 0)
+	{
+		Top = SeinMath::Max(Top, GetDynamicBlockerTopForMask(CellIdx, StampBitMask));
+	}
+	return Top;
+}
+
 void USeinFogOfWarDefault::ScaleStampRangeForTerrain(
 	FSeinStampShape& Shape,
 	FFixedPoint Multiplier)
@@ -999,6 +1164,11 @@ void USeinFogOfWarDefault::ApplyFootprintDiff(
 
 	const uint8 BitMask = static_cast<uint8>(1u << StampBit);
 
+	// Only refcount 0↔1 transitions change a cell's byte, so only those feed
+	// the presentation tile journal.
+	TArray<uint32>& TileRevisions = GetOrCreatePresentationTiles(Observer);
+	const uint32 TileRevision = AdvancePresentationRevision();
+
 	// Decrement = "this cell was in OLD but not NEW" — refcount drops by
 	// one, bit clears on 1→0. Explored is sticky (never cleared).
 	auto Decrement = [&](int32 CellIdx)
@@ -1010,6 +1180,7 @@ void USeinFogOfWarDefault::ApplyFootprintDiff(
 		if (Count == 0 && Group.CellBitfield.IsValidIndex(CellIdx))
 		{
 			Group.CellBitfield[CellIdx] &= ~BitMask;
+			MarkPresentationCellDirty(TileRevisions, CellIdx, TileRevision);
 		}
 	};
 
@@ -1023,6 +1194,7 @@ void USeinFogOfWarDefault::ApplyFootprintDiff(
 		if (Count == 0 && Group.CellBitfield.IsValidIndex(CellIdx))
 		{
 			Group.CellBitfield[CellIdx] |= BitMask;
+			MarkPresentationCellDirty(TileRevisions, CellIdx, TileRevision);
 		}
 		++Count;
 		if (Group.CellBitfield.IsValidIndex(CellIdx))
@@ -1059,6 +1231,9 @@ void USeinFogOfWarDefault::ApplyFootprintDiff(
 
 void USeinFogOfWarDefault::DecrementFootprintsForState(FSeinFogSourceState& State, FSeinFogVisionGroup& Group)
 {
+	// Both callers pass the group keyed by State.Owner.
+	TArray<uint32>& TileRevisions = GetOrCreatePresentationTiles(State.Owner);
+	const uint32 TileRevision = AdvancePresentationRevision();
 	for (int32 BitIdx = 1; BitIdx <= 7; ++BitIdx)
 	{
 		TArray<int32>& Footprint = State.Footprints[BitIdx];
@@ -1082,6 +1257,7 @@ void USeinFogOfWarDefault::DecrementFootprintsForState(FSeinFogSourceState& Stat
 				if (Count == 0 && Group.CellBitfield.IsValidIndex(CellIdx))
 				{
 					Group.CellBitfield[CellIdx] &= ~BitMask;
+					MarkPresentationCellDirty(TileRevisions, CellIdx, TileRevision);
 				}
 			}
 		}
@@ -1548,6 +1724,74 @@ bool USeinFogOfWarDefault::GetObserverGrid(FSeinPlayerID Observer, TArray<uint8>
 	return true;
 }
 
+bool USeinFogOfWarDefault::GetObserverDirtyTiles(FSeinPlayerID Observer, uint32 SinceRevision,
+	TBitArray<>& OutDirtyTiles, uint32& OutRevision) const
+{
+	bPresentationRevisionObserved.store(true, std::memory_order_relaxed);
+	OutRevision = PresentationRevision;
+	if (Width <= 0 || Height <= 0) return false;
+	if (SinceRevision < PresentationValidFromRevision) return false;
+
+	const int32 NumTiles =
+		FMath::DivideAndRoundUp(Width, PresentationTileCells)
+		* FMath::DivideAndRoundUp(Height, PresentationTileCells);
+	OutDirtyTiles.Init(false, NumTiles);
+	if (const TArray<uint32>* TileRevisions = PresentationTileRevisions.Find(Observer))
+	{
+		if (TileRevisions->Num() != NumTiles) return false;
+		for (int32 Tile = 0; Tile < NumTiles; ++Tile)
+		{
+			if ((*TileRevisions)[Tile] > SinceRevision)
+			{
+				OutDirtyTiles[Tile] = true;
+			}
+		}
+	}
+	return true;
+}
+
+uint32 USeinFogOfWarDefault::AdvancePresentationRevision()
+{
+	if (bPresentationRevisionObserved.exchange(false, std::memory_order_relaxed))
+	{
+		++PresentationRevision;
+	}
+	return PresentationRevision;
+}
+
+TArray<uint32>& USeinFogOfWarDefault::GetOrCreatePresentationTiles(FSeinPlayerID Observer)
+{
+	TArray<uint32>& TileRevisions = PresentationTileRevisions.FindOrAdd(Observer);
+	const int32 NumTiles =
+		FMath::DivideAndRoundUp(Width, PresentationTileCells)
+		* FMath::DivideAndRoundUp(Height, PresentationTileCells);
+	if (TileRevisions.Num() != NumTiles)
+	{
+		TileRevisions.SetNumZeroed(NumTiles);
+	}
+	return TileRevisions;
+}
+
+void USeinFogOfWarDefault::MarkPresentationCellDirty(
+	TArray<uint32>& TileRevisions, int32 CellIdx, uint32 Revision) const
+{
+	if (Width <= 0 || CellIdx < 0) return;
+	const int32 TilesX = FMath::DivideAndRoundUp(Width, PresentationTileCells);
+	const int32 Tile =
+		(CellIdx / Width / PresentationTileCells) * TilesX
+		+ (CellIdx % Width) / PresentationTileCells;
+	if (TileRevisions.IsValidIndex(Tile))
+	{
+		TileRevisions[Tile] = Revision;
+	}
+}
+
+void USeinFogOfWarDefault::ResetPresentationTiles()
+{
+	PresentationTileRevisions.Reset();
+	PresentationValidFromRevision = AdvancePresentationRevision();
+}
+
 uint8 USeinFogOfWarDefault::GetEntityVisibleBits(FSeinPlayerID Observer,
 	USeinWorldSubsystem& Sim, FSeinEntityHandle Target) const
 {
@@ -1399,6 +1399,7 @@ struct FSeinFogOfWarDefaultStateCodec
 		Live->VisionGroups = MoveTemp(Candidate.VisionGroups);
 		Live->SourceStates = MoveTemp(Candidate.SourceStates);
 		Live->ResetRoutineRootCache();
+		Live->ResetPresentationTiles();
 	}
 };
 
@@ -126,11 +126,12 @@ void ASeinFogOfWarRender::Tick(float DeltaSeconds)
 
 	// Rebuild on observer change, and keep retrying until the first texture is
 	// built (covers the case where the fog grid wasn't ready at BeginPlay and
-	// no mutate has fired yet).
+	// no mutate has fired yet). Plain mutations only refresh the tiles the
+	// fog's change journal reports.
 	const bool bObserverChanged = ResolveObserver();
 	if (bObserverChanged || bTextureDirty || !FogTexture)
 	{
-		bTextureDirty = !RebuildTexture();
+		bTextureDirty = !RebuildTexture(/*bAllowPartial*/ !bObserverChanged);
 	}
 }
 
@@ -260,12 +261,33 @@ void ASeinFogOfWarRender::EnsureTexture(int32 W, int32 H)
 	}
 }
 
-bool ASeinFogOfWarRender::RebuildTexture()
+bool ASeinFogOfWarRender::RebuildTexture(bool bAllowPartial)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(Sein_Fog_Render_RebuildTexture);
 	USeinFogOfWar* Fog = ResolveFog();
 	if (!Fog) return false;
 
+	const USeinWorldSubsystem* Sim = GetWorld()
+		? GetWorld()->GetSubsystem<USeinWorldSubsystem>()
+		: nullptr;
+
+	// Poll the change journal BEFORE reading the grid: a mutation landing
+	// between the two is reported again by the next poll instead of lost. The
+	// revision is only committed once the texture actually reflects the grid.
+	uint32 JournalRevision = 0;
+	TArray<FSeinPlayerID> VisionSources;
+	const bool bJournalComplete =
+		PollFogJournal(*Fog, Sim, JournalRevision, VisionSources);
+	const bool bPartial = bAllowPartial
+		&& bJournalComplete
+		&& FogTexture
+		&& CaptureTintInputs() == BakedTintInputs;
+	if (bPartial && DirtyTiles.Find(true) == INDEX_NONE)
+	{
+		FogJournalRevision = JournalRevision;
+		return true;   // coalesced mutations that left this observer's view untouched
+	}
+
 	TArray<uint8> Cells;
 	FFixedVector Origin = FFixedVector::ZeroVector;
 	FFixedPoint CellSize = FFixedPoint::Zero;
@@ -273,9 +295,6 @@ bool ASeinFogOfWarRender::RebuildTexture()
 	// Shared-vision aware: the local observer's overlay reveals every cell any
 	// ShareVision-granting ally reveals. Identical to the plain grid when no
 	// grants target the observer.
-	const USeinWorldSubsystem* Sim = GetWorld()
-		? GetWorld()->GetSubsystem<USeinWorldSubsystem>()
-		: nullptr;
 	const bool bHaveGrid = Sim
 		? Fog->GetEffectiveObserverGrid(
 			*Sim, CachedObserver, Cells, Origin, CellSize, W, H)
@@ -284,25 +303,34 @@ bool ASeinFogOfWarRender::RebuildTexture()
 	if (!bHaveGrid) return false;
 	if (W <= 0 || H <= 0 || Cells.Num() != W * H) return false;
 
+	if (bPartial && W == TexWidth && H == TexHeight && BakeDirtyTiles(Cells))
+	{
+		FogJournalRevision = JournalRevision;
+		BakedVisionSources = MoveTemp(VisionSources);
+		return true;
+	}
+
 	EnsureTexture(W, H);
 	if (!FogTexture || PixelBuffer.Num() != W * H * 4) return false;
 
-	const uint8 VisibleMask = ComputeVisibleMask();
-	for (int32 i = 0; i < Cells.Num(); ++i)
+	BakedTintInputs = CaptureTintInputs();
+	RebuildTintLUT();
+	if (BakedTintInputs.SmoothingStrength > 0.0f)
+	{
+		TintBuffer.SetNumUninitialized(W * H * 4);
+	}
+	else
 	{
-		const FColor C = TintForCell(Cells[i], VisibleMask).ToFColor(/*bSRGB*/ false);
-		const int32 o = i * 4;
-		PixelBuffer[o + 0] = C.B;
-		PixelBuffer[o + 1] = C.G;
-		PixelBuffer[o + 2] = C.R;
-		PixelBuffer[o + 3] = C.A;
+		TintBuffer.Empty();
 	}
 
-	if (SmoothingStrength > 0.0f)
+	const FIntRect Full(0, 0, W, H);
+	TintRect(Cells, Full);
+	if (BakedTintInputs.SmoothingStrength > 0.0f)
 	{
-		BlurPixelBuffer(SmoothingStrength);
+		BlurRect(Full);
 	}
-	UploadPixels();
+	UploadPixels({ Full });
 
 	if (FogMID)
 	{
@@ -312,37 +340,180 @@ bool ASeinFogOfWarRender::RebuildTexture()
 		FogMID->SetVectorParameterValue(P_WorldMin, FLinearColor(OX, OY, 0.f, 0.f));
 		FogMID->SetVectorParameterValue(P_WorldSize, FLinearColor(W * Csz, H * Csz, 0.f, 0.f));
 	}
+	FogJournalRevision = JournalRevision;
+	BakedVisionSources = MoveTemp(VisionSources);
+	return true;
+}
+
+bool ASeinFogOfWarRender::PollFogJournal(const USeinFogOfWar& Fog,
+	const USeinWorldSubsystem* Sim, uint32& OutRevision,
+	TArray<FSeinPlayerID>& OutVisionSources)
+{
+	if (!Sim)
+	{
+		return Fog.GetObserverDirtyTiles(
+			CachedObserver, FogJournalRevision, DirtyTiles, OutRevision);
+	}
+
+	// The journal only reports cell changes; a ShareVision grant or revoke
+	// swaps whole source grids in or out of the merge, so it needs a full bake.
+	Fog.GetEffectiveVisionSources(*Sim, CachedObserver, OutVisionSources);
+	const bool bComplete = Fog.GetEffectiveObserverDirtyTiles(
+		*Sim, CachedObserver, FogJournalRevision, DirtyTiles, OutRevision);
+	return bComplete && OutVisionSources == BakedVisionSources;
+}
+
+bool ASeinFogOfWarRender::BakeDirtyTiles(const TArray<uint8>& Cells)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(Sein_Fog_Render_BakeDirtyTiles);
+	constexpr int32 TileCells = USeinFogOfWar::PresentationTileCells;
+	const int32 TilesX = FMath::DivideAndRoundUp(TexWidth, TileCells);
+	const int32 TilesY = FMath::DivideAndRoundUp(TexHeight, TileCells);
+	if (DirtyTiles.Num() != TilesX * TilesY) return false;
+	if (PixelBuffer.Num() != TexWidth * TexHeight * 4) return false;
+	const bool bSmooth = BakedTintInputs.SmoothingStrength > 0.0f;
+	if (bSmooth && TintBuffer.Num() != PixelBuffer.Num()) return false;
+
+	// Re-tint each horizontal run of dirty tiles as one rect.
+	TArray<FIntRect> Rects;
+	for (int32 TY = 0; TY < TilesY; ++TY)
+	{
+		int32 TX = 0;
+		while (TX < TilesX)
+		{
+			if (!DirtyTiles[TY * TilesX + TX]) { ++TX; continue; }
+			const int32 RunStart = TX;
+			while (TX < TilesX && DirtyTiles[TY * TilesX + TX]) { ++TX; }
+			const FIntRect Run(
+				RunStart * TileCells,
+				TY * TileCells,
+				FMath::Min(TX * TileCells, TexWidth),
+				FMath::Min((TY + 1) * TileCells, TexHeight));
+			TintRect(Cells, Run);
+			Rects.Add(Run);
+		}
+	}
+
+	// Blur only once every run is re-tinted — a run's blurred margin reads its
+	// neighbours' tint, which may itself have just changed. The margin spreads
+	// each run by the blur reach, so that is what gets re-blurred + uploaded.
+	if (bSmooth)
+	{
+		const int32 Reach = GetBlurReach();
+		for (FIntRect& Rect : Rects)
+		{
+			Rect = FIntRect(
+				FMath::Max(Rect.Min.X - Reach, 0),
+				FMath::Max(Rect.Min.Y - Reach, 0),
+				FMath::Min(Rect.Max.X + Reach, TexWidth),
+				FMath::Min(Rect.Max.Y + Reach, TexHeight));
+			BlurRect(Rect);
+		}
+	}
+	UploadPixels(Rects);
 	return true;
 }
 
-void ASeinFogOfWarRender::UploadPixels()
+ASeinFogOfWarRender::FTintInputs ASeinFogOfWarRender::CaptureTintInputs() const
+{
+	FTintInputs Inputs;
+	Inputs.UnexploredColor = UnexploredColor;
+	Inputs.UnexploredOpacity = UnexploredOpacity;
+	Inputs.ExploredOpacity = ExploredOpacity;
+	Inputs.SmoothingStrength = SmoothingStrength;
+	Inputs.VisibleMask = ComputeVisibleMask();
+	return Inputs;
+}
+
+void ASeinFogOfWarRender::RebuildTintLUT()
+{
+	for (int32 Bits = 0; Bits < 256; ++Bits)
+	{
+		const FColor C = TintForCell(static_cast<uint8>(Bits), BakedTintInputs.VisibleMask)
+			.ToFColor(/*bSRGB*/ false);
+		uint8* Entry = TintLUT + Bits * 4;
+		Entry[0] = C.B;
+		Entry[1] = C.G;
+		Entry[2] = C.R;
+		Entry[3] = C.A;
+	}
+}
+
+void ASeinFogOfWarRender::TintRect(const TArray<uint8>& Cells, const FIntRect& Rect)
+{
+	// With smoothing on, the blur owns PixelBuffer and reads the raw tint back
+	// out of TintBuffer; without it the tint IS the texture.
+	uint8* Dest = (BakedTintInputs.SmoothingStrength > 0.0f)
+		? TintBuffer.GetData()
+		: PixelBuffer.GetData();
+	for (int32 y = Rect.Min.Y; y < Rect.Max.Y; ++y)
+	{
+		const int32 Row = y * TexWidth;
+		for (int32 x = Rect.Min.X; x < Rect.Max.X; ++x)
+		{
+			FMemory::Memcpy(Dest + (Row + x) * 4, TintLUT + Cells[Row + x] * 4, 4);
+		}
+	}
+}
+
+void ASeinFogOfWarRender::UploadPixels(const TArray<FIntRect>& Rects)
 {
-	if (!FogTexture || TexWidth <= 0 || TexHeight <= 0) return;
+	if (!FogTexture || TexWidth <= 0 || TexHeight <= 0 || Rects.IsEmpty()) return;
 	if (PixelBuffer.Num() != TexWidth * TexHeight * 4) return;
 
-	const int32 NumBytes = TexWidth * TexHeight * 4;
+	// Copy only the band of rows the regions span; each region's source row is
+	// rebased onto that band.
+	int32 MinY = TexHeight;
+	int32 MaxY = 0;
+	for (const FIntRect& Rect : Rects)
+	{
+		MinY = FMath::Min(MinY, Rect.Min.Y);
+		MaxY = FMath::Max(MaxY, Rect.Max.Y);
+	}
+	if (MaxY <= MinY) return;
+
+	const int32 Pitch = TexWidth * 4;
+	const int32 NumBytes = (MaxY - MinY) * Pitch;
 	uint8* Src = static_cast<uint8*>(FMemory::Malloc(NumBytes));
-	FMemory::Memcpy(Src, PixelBuffer.GetData(), NumBytes);
+	FMemory::Memcpy(Src, PixelBuffer.GetData() + MinY * Pitch, NumBytes);
 
-	// Region + source buffer are owned by the render command and freed in its
+	// Regions + source buffer are owned by the render command and freed in its
 	// cleanup callback (UpdateTextureRegions runs async on the render thread).
-	FUpdateTextureRegion2D* Region = new FUpdateTextureRegion2D(0, 0, 0, 0, TexWidth, TexHeight);
+	FUpdateTextureRegion2D* Regions = new FUpdateTextureRegion2D[Rects.Num()];
+	for (int32 i = 0; i < Rects.Num(); ++i)
+	{
+		const FIntRect& Rect = Rects[i];
+		Regions[i] = FUpdateTextureRegion2D(
+			Rect.Min.X, Rect.Min.Y,
+			Rect.Min.X, Rect.Min.Y - MinY,
+			Rect.Width(), Rect.Height());
+	}
 	FogTexture->UpdateTextureRegions(
-		0, 1, Region,
-		static_cast<uint32>(TexWidth * 4),
+		0, static_cast<uint32>(Rects.Num()), Regions,
+		static_cast<uint32>(Pitch),
 		static_cast<uint32>(4),
 		Src,
-		[](uint8* InSrc, const FUpdateTextureRegion2D* InRegion)
+		[](uint8* InSrc, const FUpdateTextureRegion2D* InRegions)
 		{
 			FMemory::Free(InSrc);
-			delete InRegion;
+			delete[] InRegions;
 		});
 }
 
-void ASeinFogOfWarRender::BlurPixelBuffer(float Radius)
+int32 ASeinFogOfWarRender::GetBlurReach() const
 {
+	const float Radius = BakedTintInputs.SmoothingStrength;
+	if (Radius <= 0.0f) return 0;
+	const int32 R = FMath::FloorToInt(Radius);
+	return (Radius > static_cast<float>(R)) ? R + 1 : R;
+}
+
+void ASeinFogOfWarRender::BlurRect(const FIntRect& Rect)
+{
+	const float Radius = BakedTintInputs.SmoothingStrength;
 	if (Radius <= 0.0f || TexWidth <= 0 || TexHeight <= 0) return;
 	if (PixelBuffer.Num() != TexWidth * TexHeight * 4) return;
+	if (TintBuffer.Num() != PixelBuffer.Num()) return;
 
 	const int32 W = TexWidth;
 	const int32 H = TexHeight;
@@ -350,47 +521,55 @@ void ASeinFogOfWarRender::BlurPixelBuffer(float Radius)
 	const float Frac = Radius - static_cast<float>(R);          // weight of the outer (R+1) tap
 	const float Norm = 1.0f / ((2 * R + 1) + 2.0f * Frac);
 
-	TArray<uint8> Tmp;
-	Tmp.SetNumUninitialized(W * H * 4);
-
-	// Horizontal pass: PixelBuffer -> Tmp (clamp at edges).
-	for (int32 y = 0; y < H; ++y)
+	// The vertical pass reads up to GetBlurReach() rows past Rect, so the
+	// horizontal pass covers that (edge-clamped) band.
+	const int32 Reach = GetBlurReach();
+	const int32 X0 = Rect.Min.X;
+	const int32 RW = Rect.Width();
+	const int32 Y0 = FMath::Max(Rect.Min.Y - Reach, 0);
+	const int32 Y1 = FMath::Min(Rect.Max.Y + Reach, H);
+	BlurScratch.SetNumUninitialized(RW * (Y1 - Y0) * 4, EAllowShrinking::No);
+	uint8* Tmp = BlurScratch.GetData();
+	const uint8* Tint = TintBuffer.GetData();
+
+	// Horizontal pass: TintBuffer -> Tmp (clamp at edges).
+	for (int32 y = Y0; y < Y1; ++y)
 	{
 		const int32 Row = y * W;
-		for (int32 x = 0; x < W; ++x)
+		for (int32 x = X0; x < Rect.Max.X; ++x)
 		{
 			float Acc[4] = { 0.f, 0.f, 0.f, 0.f };
 			for (int32 k = -R; k <= R; ++k)
 			{
 				const int32 SI = (Row + FMath::Clamp(x + k, 0, W - 1)) * 4;
-				for (int32 c = 0; c < 4; ++c) { Acc[c] += PixelBuffer[SI + c]; }
+				for (int32 c = 0; c < 4; ++c) { Acc[c] += Tint[SI + c]; }
 			}
 			if (Frac > 0.0f)
 			{
 				const int32 LI = (Row + FMath::Clamp(x - (R + 1), 0, W - 1)) * 4;
 				const int32 RI = (Row + FMath::Clamp(x + (R + 1), 0, W - 1)) * 4;
-				for (int32 c = 0; c < 4; ++c) { Acc[c] += Frac * (PixelBuffer[LI + c] + PixelBuffer[RI + c]); }
+				for (int32 c = 0; c < 4; ++c) { Acc[c] += Frac * (Tint[LI + c] + Tint[RI + c]); }
 			}
-			const int32 DI = (Row + x) * 4;
+			const int32 DI = ((y - Y0) * RW + (x - X0)) * 4;
 			for (int32 c = 0; c < 4; ++c) { Tmp[DI + c] = (uint8)FMath::Clamp(FMath::RoundToInt(Acc[c] * Norm), 0, 255); }
 		}
 	}
 
 	// Vertical pass: Tmp -> PixelBuffer.
-	for (int32 y = 0; y < H; ++y)
+	for (int32 y = Rect.Min.Y; y < Rect.Max.Y; ++y)
 	{
-		for (int32 x = 0; x < W; ++x)
+		for (int32 x = X0; x < Rect.Max.X; ++x)
 		{
 			float Acc[4] = { 0.f, 0.f, 0.f, 0.f };
 			for (int32 k = -R; k <= R; ++k)
 			{
-				const int32 SI = (FMath::Clamp(y + k, 0, H - 1) * W + x) * 4;
+				const int32 SI = ((FMath::Clamp(y + k, 0, H - 1) - Y0) * RW + (x - X0)) * 4;
 				for (int32 c = 0; c < 4; ++c) { Acc[c] += Tmp[SI + c]; }
 			}
 			if (Frac > 0.0f)
 			{
-				const int32 TI = (FMath::Clamp(y - (R + 1), 0, H - 1) * W + x) * 4;
-				const int32 BI = (FMath::Clamp(y + (R + 1), 0, H - 1) * W + x) * 4;
+				const int32 TI = ((FMath::Clamp(y - (R + 1), 0, H - 1) - Y0) * RW + (x - X0)) * 4;
+				const int32 BI = ((FMath::Clamp(y + (R + 1), 0, H - 1) - Y0) * RW + (x - X0)) * 4;
 				for (int32 c = 0; c < 4; ++c) { Acc[c] += Frac * (Tmp[TI + c] + Tmp[BI + c]); }
 			}
 			const int32 DI = (y * W + x) * 4;
@@ -415,8 +594,8 @@ FLinearColor ASeinFogOfWarRender::TintForCell(uint8 Bits, uint8 VisibleMask) con
 
 void ASeinFogOfWarRender::HandleFogMutated()
 {
-	// Coalesce simulation mutations. A full grid copy, tint bake, blur, allocation,
-	// and texture upload now occurs at FogRenderTickRate instead of once per stamp.
+	// Coalesce simulation mutations. The grid copy, dirty-tile re-tint + blur, and
+	// region upload occur at FogRenderTickRate instead of once per stamp.
 	bTextureDirty = true;
 }
 
@@ -109,6 +109,44 @@ bool USeinFogOfWar::GetEffectiveObserverGrid(
 	return true;
 }
 
+bool USeinFogOfWar::GetEffectiveObserverDirtyTiles(
+	const USeinWorldSubsystem& Sim,
+	FSeinPlayerID Observer,
+	uint32 SinceRevision,
+	TBitArray<>& OutDirtyTiles,
+	uint32& OutRevision) const
+{
+	if (!Sim.HasAnyPairCapabilityGrants())
+	{
+		return GetObserverDirtyTiles(
+			Observer, SinceRevision, OutDirtyTiles, OutRevision);
+	}
+	TArray<FSeinPlayerID> Sources;
+	GetEffectiveVisionSources(Sim, Observer, Sources);
+	if (!GetObserverDirtyTiles(
+			Sources[0], SinceRevision, OutDirtyTiles, OutRevision))
+	{
+		return false;
+	}
+	// One journal revision spans every observer, so each source reports the
+	// same OutRevision. A source that can't answer fails the whole merge —
+	// unlike the grid merge, skipping it would silently drop its changes.
+	TBitArray<> SourceTiles;
+	for (int32 Index = 1; Index < Sources.Num(); ++Index)
+	{
+		uint32 SourceRevision = 0;
+		if (!GetObserverDirtyTiles(
+				Sources[Index], SinceRevision, SourceTiles, SourceRevision)
+			|| SourceTiles.Num() != OutDirtyTiles.Num())
+		{
+			return false;
+		}
+		OutDirtyTiles.CombineWithBitwiseOR(
+			SourceTiles, EBitwiseOperatorFlags::MaintainSize);
+	}
+	return true;
+}
+
 uint8 USeinFogOfWar::GetEntityVisibleBits(
 	FSeinPlayerID Observer,
 	USeinWorldSubsystem& Sim,
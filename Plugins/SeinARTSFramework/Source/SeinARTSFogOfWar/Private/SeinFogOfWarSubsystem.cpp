@@ -85,13 +85,21 @@ namespace
 
 		virtual FSeinSystemDescriptor DescribeSystem() const override
 		{
-			return FSeinSystemDescriptor::WithCanonicalState(
-				FName(TEXT("seinarts.fog_of_war.stamp")),
-				1u,
-				ESeinTickPhase::PostTick,
-				SeinSystemPriority::FogOfWar,
-				{ FName(TEXT(
-					"seinarts.fog-of-war/canonical-state")) });
+			FSeinSystemDescriptor Descriptor =
+				FSeinSystemDescriptor::WithCanonicalState(
+					FName(TEXT("seinarts.fog_of_war.stamp")),
+					1u,
+					ESeinTickPhase::PostTick,
+					SeinSystemPriority::FogOfWar,
+					{ FName(TEXT(
+						"seinarts.fog-of-war/canonical-state")) });
+			FSeinSystemAccess Access;
+			if (const USeinFogOfWar* Fog = FogOfWar.Get();
+				Fog && Fog->DescribeSystemAccess(Access))
+			{
+				Descriptor.Access = MoveTemp(Access);
+			}
+			return Descriptor;
 		}
 
 	private:
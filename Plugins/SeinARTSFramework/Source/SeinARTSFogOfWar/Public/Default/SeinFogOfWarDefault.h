@@ -47,6 +47,7 @@
 // stamp set the parallel footprint compute rasterizes), so the full definition
 // must be visible here — a forward declaration no longer suffices.
 #include "Components/SeinVisionComponent.h"
+#include <atomic>
 #include "SeinFogOfWarDefault.generated.h"
 
 class UWorld;
@@ -194,6 +195,21 @@ struct FSeinFogDynamicBlockerLayerHeights
 	}
 };
 
+/** Which line-of-sight kernel rasterizes a vision stamp's footprint. Both
+ *  produce the identical cell multiset; the choice is purely a cost trade. */
+UENUM(BlueprintType)
+enum class ESeinFogStampKernel : uint8
+{
+	/** One integer Bresenham opacity walk per covered cell — O(R³) per
+	 *  stamp. The reference kernel; kept for A/B verification. */
+	LineWalk        UMETA(DisplayName = "Line Walk (Reference)"),
+	/** Per-stamp occluder-top table + per-ring clearance maxima. A covered
+	 *  cell whose lampshade ray clears every nearer ring is accepted without
+	 *  a walk; only cells behind a real occluder fall back to the Bresenham
+	 *  walk, which then reads the table instead of the overlay arrays. */
+	ClearanceTable  UMETA(DisplayName = "Clearance Table"),
+};
+
 /**
  * Computes what each player can see: hides the map under fog, reveals cells around units that have
  * vision, and remembers explored ground once you've been there. This is the fog-of-war system
@@ -208,7 +224,8 @@ struct FSeinFogDynamicBlockerLayerHeights
  * Vision is stamped each sim tick from every entity carrying a vision component: for each source
  * an eye position is taken at the unit's sim Z plus its EyeHeight, and line-of-sight to every cell
  * in range is tested with an integer Bresenham walk whose ray Z is interpolated from the eye down
- * to the target cell. That elevation-aware trace is the true-sight behavior — a unit on a roof
+ * to the target cell (the default Clearance Table kernel skips the walk wherever the ray provably
+ * clears every nearer ring, with an identical result). That elevation-aware trace is the true-sight behavior — a unit on a roof
  * looking down still has a wall between them block the far ground. Terrain always occludes; static
  * baked blockers and runtime dynamic blockers (smoke, destructibles) occlude only when their layer
  * mask covers the stamp's bit, so smoke can hide Normal sight while letting Thermal through. A
@@ -260,6 +277,12 @@ public:
 	UPROPERTY(EditAnywhere, Category = "Bake", meta = (ClampMin = "0"))
 	int32 InitTraceCellCap = 4096;
 
+	/** Footprint kernel for vision stamps. Clearance Table is bit-identical to
+	 *  the Line Walk reference and skips the per-cell walk wherever the view
+	 *  is open, which is what large-radius scouts and buildings mostly see. */
+	UPROPERTY(EditAnywhere, Category = "Vision")
+	ESeinFogStampKernel StampKernel = ESeinFogStampKernel::ClearanceTable;
+
 	// ----------------------------------------------------------------------
 	// USeinFogOfWar overrides
 	// ----------------------------------------------------------------------
@@ -282,6 +305,7 @@ public:
 	// USeinFogOfWar participation hooks
 	virtual ISeinLevelLayerProvider* GetLevelDataProvider() override { return this; }
 	virtual void TickStamps(UWorld* World) override;
+	virtual bool DescribeSystemAccess(FSeinSystemAccess& OutAccess) const override;
 
 	virtual uint8 GetCellBitfield(FSeinPlayerID Observer, const FFixedVector& WorldPos) const override;
 	virtual uint8 GetEntityVisibleBits(FSeinPlayerID Observer,
@@ -303,6 +327,13 @@ public:
 		FFixedVector& OutOrigin, FFixedPoint& OutCellSize,
 		int32& OutWidth, int32& OutHeight) const override;
 
+	/** Tiles touched by refcount bit flips (ApplyFootprintDiff / footprint
+	 *  teardown) since `SinceRevision`. False after a grid reload, restore,
+	 *  or before the observer's group existed. See
+	 *  USeinFogOfWar::GetObserverDirtyTiles. */
+	virtual bool GetObserverDirtyTiles(FSeinPlayerID Observer, uint32 SinceRevision,
+		TBitArray<>& OutDirtyTiles, uint32& OutRevision) const override;
+
 protected:
 	virtual FSeinStaticEnvironmentAdoptionResult LoadFromSubstrateImpl(
 		const USeinLevelData& Substrate) override;
@@ -403,6 +434,25 @@ private:
 	 *  adoption. Authoritative fog state never depends on this cache. */
 	mutable TSharedPtr<FSeinFogOfWarDefaultRoutineRootCache> RoutineRootCache;
 
+	/** Presentation-only per-observer tile journal: the revision each
+	 *  PresentationTileCells-square tile of the observer's CellBitfield last
+	 *  changed at. Never serialized, digested, or restored — a restore or grid
+	 *  reload drops it and bumps PresentationValidFromRevision so readers
+	 *  re-read the whole grid. A missing entry means nothing changed since the
+	 *  last reset (a new group starts all-zero, which is what GetObserverGrid
+	 *  already presented for it). */
+	TMap<FSeinPlayerID, TArray<uint32>> PresentationTileRevisions;
+
+	/** Revision new marks are stamped with. Advanced lazily: only the first
+	 *  mark after a reader has observed the current value bumps it, so a
+	 *  quiescent fog never churns revisions and a reader never misses a mark
+	 *  made between two of its queries. */
+	uint32 PresentationRevision = 1;
+	uint32 PresentationValidFromRevision = 1;
+	/** Set by presentation reads on the game thread, consumed by the sim,
+	 *  which may be running on the dedicated simulation thread. */
+	mutable std::atomic<bool> bPresentationRevisionObserved{ false };
+
 	// ----------------------------------------------------------------------
 	// Bake state
 	// ----------------------------------------------------------------------
@@ -489,8 +539,10 @@ private:
 	 *  their LayerMask covers this stamp's bit — smoke that blocks Normal
 	 *  but not Thermal lets a Thermal stamp pass through.
 	 *
-	 *  Per-target LOS is integer Bresenham (O(R³) per stamp; deterministic
-	 *  and trivial to verify). Cells appended to OutCells are unsorted and
+	 *  Per-target LOS is integer Bresenham under the LineWalk kernel (O(R³)
+	 *  per stamp; deterministic and trivial to verify). The ClearanceTable
+	 *  kernel produces the same cells in the same order — see
+	 *  FilterCandidatesByClearance. Cells appended to OutCells are unsorted and
 	 *  may include duplicates across multiple stamps (apex always emitted
 	 *  first per stamp; LOS-walked cells appended after). Sort happens in
 	 *  the caller before diffing.
@@ -507,6 +559,29 @@ private:
 		FFixedPoint EyeHeight, uint8 StampBit,
 		TArray<int32>& OutCells) const;
 
+	/** ClearanceTable kernel body. OutCells[FirstCandidate..] holds the
+	 *  shape's covered cells (apex excluded, visitation order); this keeps
+	 *  exactly those HasLineOfSightToCell would accept, preserving order.
+	 *
+	 *  Per stamp it builds the occluder top of every cell within `Reach`
+	 *  (Chebyshev) of the apex, and for each ring c the max required ray
+	 *  slope ceil((Top − EyeZ) / c). The Bresenham walk advances exactly one
+	 *  ring per step, so a target whose ray slope meets the max over all
+	 *  nearer rings cannot be occluded and is accepted outright; otherwise
+	 *  the same walk runs against the table. The early accept is skipped
+	 *  when raw heights are large enough for the ray accumulation to wrap,
+	 *  keeping the result identical to LineWalk for every input. Const + pure
+	 *  (local scratch only) — safe inside TickStamps' parallel body. */
+	void FilterCandidatesByClearance(int32 SX, int32 SY,
+		FFixedPoint EyeZ, uint8 StampBitMask, int32 Reach,
+		int32 FirstCandidate, TArray<int32>& OutCells) const;
+
+	/** Highest surface at a valid cell that occludes `StampBitMask`: ground
+	 *  always, static / dynamic blocker tops only when their layer mask
+	 *  covers the bit. A ray at Z is blocked by the cell iff this is > Z —
+	 *  the max-form of IsCellOpaqueToEye, used by the clearance table. */
+	FFixedPoint GetOccluderTopForMask(int32 CellIdx, uint8 StampBitMask) const;
+
 	/** Apply the terrain vision multiplier to the active range parameter only.
 	 *  Keeping unused shape fields unchanged avoids false cache invalidation. */
 	static void ScaleStampRangeForTerrain(
@@ -603,4 +678,9 @@ private:
 	void MarkRoutineSourceDirty(FSeinEntityHandle Handle);
 	void MarkRoutineDynamicBlockersDirty();
 	void ResetRoutineRootCache();
+
+	uint32 AdvancePresentationRevision();
+	TArray<uint32>& GetOrCreatePresentationTiles(FSeinPlayerID Observer);
+	void MarkPresentationCellDirty(TArray<uint32>& TileRevisions, int32 CellIdx, uint32 Revision) const;
+	void ResetPresentationTiles();
 };
@@ -13,7 +13,9 @@
  *          before baking the local observer's per-cell EVNNNNNN
  *          bitfield into a tiny tint texture (BGRA: rgb = fog color, a = darken
  *          amount), and feeds that + the grid's world bounds to the base fog
- *          material that does `lerp(scene, tint.rgb, tint.a)`.
+ *          material that does `lerp(scene, tint.rgb, tint.a)`. Between full
+ *          bakes only the tiles the fog's presentation change journal reports
+ *          are re-tinted (256-entry LUT), re-blurred and uploaded.
  *
  *          Base tier mapping (per cell), all tunable below — computed against the
  *          ACTIVE vision layer's bit (see vision layers):
@@ -49,6 +51,7 @@
 #include "SeinFogOfWarRender.generated.h"
 
 class USeinFogOfWar;
+class USeinWorldSubsystem;
 class UPostProcessComponent;
 class UTexture2D;
 class UMaterialInterface;
@@ -220,6 +223,44 @@ private:
 	/** BGRA tint, row-major, TexWidth*TexHeight*4 bytes. */
 	TArray<uint8> PixelBuffer;
 
+	/** Unblurred BGRA tint, same layout as PixelBuffer. Only kept while
+	 *  smoothing is on, so a dirty tile's blurred margin can be recomputed
+	 *  without re-tinting its clean neighbours. */
+	TArray<uint8> TintBuffer;
+
+	/** Horizontal-pass scratch reused across BlurRect calls. */
+	TArray<uint8> BlurScratch;
+
+	/** Every tunable the current texture was baked from. Any mismatch (a BP
+	 *  write, a layer switch) forces a full bake so no two tiles mix tints. */
+	struct FTintInputs
+	{
+		FLinearColor UnexploredColor = FLinearColor::Transparent;
+		float UnexploredOpacity = -1.0f;
+		float ExploredOpacity = -1.0f;
+		float SmoothingStrength = -1.0f;
+		uint8 VisibleMask = 0;
+
+		bool operator==(const FTintInputs& Other) const
+		{
+			return UnexploredColor == Other.UnexploredColor
+				&& UnexploredOpacity == Other.UnexploredOpacity
+				&& ExploredOpacity == Other.ExploredOpacity
+				&& SmoothingStrength == Other.SmoothingStrength
+				&& VisibleMask == Other.VisibleMask;
+		}
+	};
+	FTintInputs BakedTintInputs;
+
+	/** BGRA tint for every EVNNNNNN byte under BakedTintInputs. */
+	uint8 TintLUT[256 * 4] = {};
+
+	/** Fog change-journal revision PixelBuffer reflects (0 = none yet), the
+	 *  effective vision sources it was merged from, and the last poll's tiles. */
+	uint32 FogJournalRevision = 0;
+	TArray<FSeinPlayerID> BakedVisionSources;
+	TBitArray<> DirtyTiles;
+
 	TWeakObjectPtr<USeinFogOfWar> SubscribedFog;
 	FDelegateHandle FogMutatedHandle;
 
@@ -238,16 +279,40 @@ private:
 	void EnsureTexture(int32 W, int32 H);
 
 	/** Pull the observer's grid, bake tints into PixelBuffer, upload, push world
-	 *  bounds to the material. */
-	/** Returns true when a valid observer grid was uploaded. */
-	bool RebuildTexture();
+	 *  bounds to the material. With bAllowPartial, only the tiles the fog's
+	 *  change journal reports are re-tinted, re-blurred and uploaded; anything
+	 *  the journal can't vouch for falls back to the full bake.
+	 *  Returns true when the texture reflects a valid observer grid. */
+	bool RebuildTexture(bool bAllowPartial = false);
+
+	/** Query the (shared-vision aware) change journal since FogJournalRevision
+	 *  into DirtyTiles. True only when DirtyTiles is the complete change set
+	 *  and the effective vision sources still match BakedVisionSources. */
+	bool PollFogJournal(const USeinFogOfWar& Fog, const USeinWorldSubsystem* Sim,
+		uint32& OutRevision, TArray<FSeinPlayerID>& OutVisionSources);
+
+	/** Re-tint, re-blur and upload the DirtyTiles of an unchanged-size grid.
+	 *  False (nothing touched) when the buffers don't match the journal. */
+	bool BakeDirtyTiles(const TArray<uint8>& Cells);
+
+	FTintInputs CaptureTintInputs() const;
+
+	/** Fill TintLUT from TintForCell under BakedTintInputs. */
+	void RebuildTintLUT();
+
+	/** LUT-tint Rect of Cells into TintBuffer (smoothing on) or PixelBuffer. */
+	void TintRect(const TArray<uint8>& Cells, const FIntRect& Rect);
+
+	/** Stream the Rects of PixelBuffer to the GPU texture (render-thread safe). */
+	void UploadPixels(const TArray<FIntRect>& Rects);
 
-	/** Stream PixelBuffer to the GPU texture (render-thread safe). */
-	void UploadPixels();
+	/** Cells past a pixel the blur reads: the radius, plus the fractional tap. */
+	int32 GetBlurReach() const;
 
-	/** Separable box-blur PixelBuffer in place by `Radius` cells (fractional ok),
-	 *  to soften/spread the fog edge beyond the bilinear filter. */
-	void BlurPixelBuffer(float Radius);
+	/** Separable box-blur TintBuffer into PixelBuffer over Rect, by the baked
+	 *  SmoothingStrength in cells (fractional ok), to soften/spread the fog
+	 *  edge beyond the bilinear filter. */
+	void BlurRect(const FIntRect& Rect);
 
 	/** Map one EVNNNNNN byte → tint color + darken alpha for the given visible mask. */
 	FLinearColor TintForCell(uint8 Bits, uint8 VisibleMask) const;
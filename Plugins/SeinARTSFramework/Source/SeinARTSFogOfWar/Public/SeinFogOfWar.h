@@ -49,6 +49,7 @@ class UWorld;
 class USeinWorldSubsystem;
 class ISeinLevelLayerProvider;
 class USeinLevelData;
+struct FSeinSystemAccess;
 
 /** Fired when the fog-of-war's baked or runtime state mutates (bake
  *  finished, substrate adoption, dynamic blocker change). Debug viz + cached
@@ -144,6 +145,11 @@ public:
 
 	virtual void TickStamps(UWorld* World) {}
 
+	/** Fill the data TickStamps touches so the stamp system can share a tick
+	 *  wave with other declared systems. Return false (default) to keep the
+	 *  system an exclusive barrier. Called once, at registration. */
+	virtual bool DescribeSystemAccess(FSeinSystemAccess& /*OutAccess*/) const { return false; }
+
 	// ----------------------------------------------------------------------
 	// Queries — reader BPFL + LOS delegate route through these.
 	// ----------------------------------------------------------------------
@@ -220,6 +226,41 @@ public:
 		int32& OutWidth,
 		int32& OutHeight) const;
 
+	// ----------------------------------------------------------------------
+	// Presentation change journal — render/UI only, never sim state. Lets a
+	// grid consumer refresh just the tiles that changed instead of re-reading
+	// and re-processing the whole field every mutation.
+	// ----------------------------------------------------------------------
+
+	/** Cells per side of one journal tile. Tiles are row-major over
+	 *  ceil(Width/N) x ceil(Height/N). */
+	static constexpr int32 PresentationTileCells = 32;
+
+	/** Fill `OutDirtyTiles` (one bit per journal tile) with every tile of
+	 *  `Observer`'s grid that may have changed after `SinceRevision`, and
+	 *  report the revision to pass next time in `OutRevision` (always set,
+	 *  even on failure). Returns false when the caller must re-read the whole
+	 *  grid instead: the impl keeps no journal, the grid was replaced or
+	 *  restored, or `SinceRevision` predates the observer's journal. Default:
+	 *  false — custom impls keep the full-refresh behavior. */
+	virtual bool GetObserverDirtyTiles(FSeinPlayerID Observer, uint32 SinceRevision,
+		TBitArray<>& OutDirtyTiles, uint32& OutRevision) const
+	{
+		OutRevision = 0;
+		return false;
+	}
+
+	/** `GetObserverDirtyTiles` composed across `GetEffectiveVisionSources`
+	 *  (tile-wise OR), matching `GetEffectiveObserverGrid`. Only covers cell
+	 *  changes: a caller must still treat a change in the effective source set
+	 *  itself (ShareVision granted or revoked) as a full refresh. */
+	bool GetEffectiveObserverDirtyTiles(
+		const USeinWorldSubsystem& Sim,
+		FSeinPlayerID Observer,
+		uint32 SinceRevision,
+		TBitArray<>& OutDirtyTiles,
+		uint32& OutRevision) const;
+
 	/** Whether the entity `Target` is currently visible to `Observer`. Single
 	 *  source of truth for the fog visibility decision — same check the
 	 *  `USeinFogOfWarVisibilitySubsystem` uses to toggle actor visibility,
@@ -9,6 +9,7 @@
 #include "Player/SeinPlayerController.h"
 #include "Debug/SeinCommandLogSubsystem.h"
 #include "Simulation/SeinWorldSubsystem.h"
+#include "Simulation/SeinActorBridgeSubsystem.h"
 #include "Actor/SeinActor.h"
 #include "Components/SeinExtentsComponent.h"
 #include "Settings/PluginSettings.h"
@@ -17,6 +18,7 @@
 #include "Engine/Font.h"
 #include "Blueprint/UserWidget.h"
 #include "CanvasItem.h"
+#include "ConvexVolume.h"
 #include "DrawDebugHelpers.h"
 #include "EngineUtils.h"
 #include "HAL/IConsoleManager.h"
@@ -478,6 +480,90 @@ static bool SeinComputeActorScreenHull(AHUD* Hud, AActor* Actor, USeinWorldSubsy
 	return true;
 }
 
+bool ASeinHUD::BuildScreenRectVolume(const FBox2D& Rect,
+	TFunctionRef<bool(const FVector2D&, FVector&, FVector&)> Deproject,
+	FConvexVolume& OutVolume)
+{
+	const FVector2D Corners[4] = {
+		Rect.Min,
+		FVector2D(Rect.Max.X, Rect.Min.Y),
+		Rect.Max,
+		FVector2D(Rect.Min.X, Rect.Max.Y),
+	};
+	FVector Origins[4];
+	FVector Directions[4];
+	for (int32 i = 0; i < 4; ++i)
+	{
+		if (!Deproject(Corners[i], Origins[i], Directions[i]))
+		{
+			return false;
+		}
+	}
+	FVector CenterOrigin, CenterDirection;
+	if (!Deproject(Rect.GetCenter(), CenterOrigin, CenterDirection))
+	{
+		return false;
+	}
+	const FVector Inside = CenterOrigin + CenterDirection * 100.0;
+
+	OutVolume.Planes.Reset();
+	for (int32 i = 0; i < 4; ++i)
+	{
+		const int32 j = (i + 1) % 4;
+		const FVector Normal = FVector::CrossProduct(
+			Directions[i], Origins[j] + Directions[j] - Origins[i]).GetSafeNormal();
+		if (Normal.IsZero())
+		{
+			return false;
+		}
+		FPlane Plane(Origins[i], Normal);
+		if (Plane.PlaneDot(Inside) > 0.0)
+		{
+			Plane = Plane.Flip();
+		}
+		OutVolume.Planes.Add(Plane);
+	}
+	OutVolume.Init();
+	return true;
+}
+
+// Candidate actors whose presentation sphere can reach Rect, from the actor
+// bridge's index. Falls back to every ASeinActor in the world when the bridge
+// or the view can't answer, so selection never silently drops units.
+static void SeinGatherScreenRectCandidates(const AHUD* Hud, UWorld* World,
+	const FBox2D& Rect, TArray<ASeinActor*>& OutCandidates)
+{
+	OutCandidates.Reset();
+	const USeinActorBridgeSubsystem* Bridge = World->GetSubsystem<USeinActorBridgeSubsystem>();
+	FConvexVolume Volume;
+	const auto Deproject = [Hud](const FVector2D& Point, FVector& OutOrigin, FVector& OutDirection)
+	{
+		if (!Hud->Canvas)
+		{
+			return false;
+		}
+		Hud->Deproject(Point.X, Point.Y, OutOrigin, OutDirection);
+		return true;
+	};
+	if (Bridge && ASeinHUD::BuildScreenRectVolume(Rect.ExpandBy(1.0), Deproject, Volume))
+	{
+		TArray<int32> Rows;
+		Bridge->QueryPresentationVolume(Volume, /*bSelectableOnly=*/false, Rows);
+		for (const int32 Row : Rows)
+		{
+			if (ASeinActor* Actor = Bridge->GetPresentationEntity(Row).Actor.Get())
+			{
+				OutCandidates.Add(Actor);
+			}
+		}
+		return;
+	}
+	for (TActorIterator<ASeinActor> It(World); It; ++It)
+	{
+		OutCandidates.Add(*It);
+	}
+}
+
 void ASeinHUD::CollectActorsInMarquee(const FVector2D& P0, const FVector2D& P1, TArray<ASeinActor*>& OutActors)
 {
 	OutActors.Reset();
@@ -505,9 +591,13 @@ void ASeinHUD::CollectActorsInMarquee(const FVector2D& P0, const FVector2D& P1,
 	TArray<FVector2D> ScreenPts;
 	TArray<FVector2D> Hull;
 
-	for (TActorIterator<ASeinActor> It(World); It; ++It)
+	// Broad phase: only actors whose presentation sphere reaches the rect get
+	// projected and hull-tested below.
+	TArray<ASeinActor*> Candidates;
+	SeinGatherScreenRectCandidates(this, World, Rect, Candidates);
+
+	for (ASeinActor* Actor : Candidates)
 	{
-		ASeinActor* Actor = *It;
 		++NumIterated;
 		if (!Actor || !Actor->HasValidEntity())
 		{
@@ -589,9 +679,13 @@ void ASeinHUD::DrawMarqueeDebugHulls()
 	const float HullThickness = 1.5f;
 	const float PointSize = 3.0f;
 
-	for (TActorIterator<ASeinActor> It(World); It; ++It)
+	// Only actors on screen: the whole canvas is the query rect.
+	TArray<ASeinActor*> Candidates;
+	SeinGatherScreenRectCandidates(
+		this, World, FBox2D(FVector2D::ZeroVector, FVector2D(Canvas->ClipX, Canvas->ClipY)), Candidates);
+
+	for (ASeinActor* Actor : Candidates)
 	{
-		ASeinActor* Actor = *It;
 		if (!Actor || !Actor->HasValidEntity())
 		{
 			continue;
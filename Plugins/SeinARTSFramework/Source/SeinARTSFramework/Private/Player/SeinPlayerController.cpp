@@ -1210,12 +1210,15 @@ void ASeinPlayerController::RecallControlGroup(int32 GroupIndex)
 	}
 
 	USeinWorldSubsystem* Subsystem = GetWorldSubsystem();
-	if (!Subsystem)
+	const USeinActorBridgeSubsystem* Bridge = GetWorld()
+		? GetWorld()->GetSubsystem<USeinActorBridgeSubsystem>()
+		: nullptr;
+	if (!Subsystem || !Bridge)
 	{
 		return;
 	}
 
-	// Resolve entity handles back to actors
+	// Resolve entity handles back to actors through the bridge's handle map.
 	TArray<ASeinActor*> Actors;
 	for (const FSeinEntityHandle& Handle : ControlGroups[GroupIndex])
 	{
@@ -1223,16 +1226,9 @@ void ASeinPlayerController::RecallControlGroup(int32 GroupIndex)
 		{
 			continue;
 		}
-
-		// Find the actor for this handle by iterating world actors
-		// (In production, the world subsystem would maintain a handle→actor map)
-		for (TActorIterator<ASeinActor> It(GetWorld()); It; ++It)
+		if (ASeinActor* Actor = Bridge->GetActorForEntity(Handle))
 		{
-			if (It->GetEntityHandle() == Handle)
-			{
-				Actors.Add(*It);
-				break;
-			}
+			Actors.Add(Actor);
 		}
 	}
 
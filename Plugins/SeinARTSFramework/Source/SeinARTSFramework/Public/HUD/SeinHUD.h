@@ -13,6 +13,7 @@
 
 class ASeinActor;
 class ASeinPlayerController;
+struct FConvexVolume;
 class USeinCommandLogSubsystem;
 class UUserWidget;
 
@@ -75,6 +76,18 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "SeinARTS|HUD|Debug")
 	float LogFontScale = 1.0f;
 
+	/**
+	 * Build the world-space volume behind a canvas-space rect: four planes
+	 * through the deprojected corner rays (a pyramid for perspective, a slab
+	 * for ortho), normals outward per FConvexVolume's convention. Deproject
+	 * maps a canvas point to a world ray and returns false when the view
+	 * can't answer. Returns false if any point fails to deproject or the rect
+	 * degenerates.
+	 */
+	static bool BuildScreenRectVolume(const FBox2D& Rect,
+		TFunctionRef<bool(const FVector2D& CanvasPoint, FVector& OutOrigin, FVector& OutDirection)> Deproject,
+		FConvexVolume& OutVolume);
+
 protected:
 	void DrawMarqueeBox();
 	void ResolveMarqueeSelection();
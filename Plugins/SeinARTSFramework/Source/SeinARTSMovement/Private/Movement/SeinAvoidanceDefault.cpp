@@ -4,7 +4,7 @@
  * @file         SeinAvoidanceDefault.cpp
  * @author       RJ Macklem
  * @created      3 Jul 2026
- * @latest       13 Aug 2026
+ * @latest       17 Oct 2026
  * @brief        Connects the default avoidance policy to its private tick kernel.
  *
  *               The UObject remains the designer-selected policy surface. The
@@ -18,8 +18,40 @@
 #include "Movement/SeinAvoidanceDefault.h"
 
 #include "Movement/SeinAvoidanceDefaultKernel.h"
+#include "Components/SeinBrokerMembershipData.h"
+#include "Components/SeinCommandBrokerData.h"
+#include "Components/SeinExtentsComponent.h"
+#include "Components/SeinMovementComponent.h"
+#include "Components/SeinNavigationComponent.h"
+#include "Core/SeinTickPhase.h"
+
+USeinAvoidanceDefault::~USeinAvoidanceDefault() = default;
 
 void USeinAvoidanceDefault::ComputeAvoidance(USeinWorldSubsystem& World)
 {
-	FSeinAvoidanceDefaultKernel(*this).Execute(World);
+	if (!Kernel)
+	{
+		Kernel = MakeUnique<FSeinAvoidanceDefaultKernel>(*this);
+	}
+	Kernel->Execute(World);
+}
+
+bool USeinAvoidanceDefault::DescribeSystemAccess(
+	FSeinSystemAccess& OutAccess) const
+{
+	// Only the exact native kernel is known to write nothing but each mover's
+	// own AvoidanceOutput. Subclasses keep the conservative barrier.
+	if (!HasImmutableRuntimePolicyState())
+	{
+		return false;
+	}
+	OutAccess = FSeinSystemAccess::Declared()
+		.ReadsComponent(FSeinNavigationComponent::StaticStruct())
+		.ReadsComponent(FSeinExtentsComponent::StaticStruct())
+		.ReadsComponent(FSeinBrokerMembershipData::StaticStruct())
+		.ReadsComponent(FSeinCommandBrokerData::StaticStruct())
+		.WritesComponent(FSeinMovementComponent::StaticStruct())
+		.ReadsShared(ESeinSystemSharedState::EntityTransforms
+			| ESeinSystemSharedState::CollisionHash);
+	return true;
 }
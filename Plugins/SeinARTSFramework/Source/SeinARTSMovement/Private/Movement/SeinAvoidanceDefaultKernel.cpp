@@ -4,7 +4,7 @@
  * @file         SeinAvoidanceDefaultKernel.cpp
  * @author       RJ Macklem
  * @created      13 Aug 2026
- * @latest       13 Aug 2026
+ * @latest       17 Oct 2026
  * @brief        Implements the shipped deterministic local-avoidance kernel.
  *
  *               The kernel reads the immutable start-of-tick broadphase and
@@ -76,6 +76,61 @@ namespace
 		TArray<FDeferredMovementState> PreviousMovementState;
 	};
 
+	enum EAvoidanceBodyFlags : uint8
+	{
+		BodyHasMovement = 1 << 0,
+		BodyHasTarget = 1 << 1,
+	};
+
+	/** Start-of-tick neighbour-facing state of every live entity, index-aligned
+	 *  with LiveHandles. Captured serially once per tick so the per-neighbour
+	 *  loops read flat arrays instead of repeating component-storage lookups. */
+	struct FAvoidanceBodySnapshot
+	{
+		TArray<FFixedVector> Positions;
+		TArray<FFixedVector> Velocities;
+		TArray<FFixedVector> TargetLocations;
+		TArray<FFixedPoint> Radii;
+		TArray<FFixedPoint> AvoidanceStrengths;
+		TArray<int32> AvoidanceWeights;
+		TArray<FSeinEntityHandle> BrokerHandles;
+		TArray<int64> CohesionIds;
+		TArray<const FSeinCommandBrokerData*> BrokerData;
+		TArray<uint8> Flags;
+		/** Handle slot -> live index, INDEX_NONE for slots with no live entity. */
+		TArray<int32> LiveIndexBySlot;
+	};
+
+	/** Every mover's broadphase neighbours that carry movement, as live indices
+	 *  in the handle order QueryRadius returned. Mover i's list is
+	 *  Indices[Offsets[i], Offsets[i + 1]). */
+	struct FAvoidanceNeighborLists
+	{
+		TArray<int32> Offsets;
+		TArray<int32> Indices;
+
+		TConstArrayView<int32> Get(int32 Index) const
+		{
+			return MakeArrayView(
+				Indices.GetData() + Offsets[Index],
+				Offsets[Index + 1] - Offsets[Index]);
+		}
+	};
+
+	/** One worker's gather arena, reused by every mover that worker runs. */
+	struct FAvoidanceGatherScratch
+	{
+		TArray<FSeinEntityHandle> Candidates;
+		TArray<int32> Indices;
+	};
+
+	struct FAvoidanceGatherSpan
+	{
+		const FAvoidanceGatherScratch* Scratch = nullptr;
+		int32 Begin = 0;
+		int32 Num = 0;
+	};
+
 	struct FAvoidanceOutputParameters
 	{
 		const TMap<FSeinEntityHandle, FCohesionAggregate>& GroupAggregates;
@@ -103,12 +158,8 @@ namespace
 
 	struct FAvoidanceNeighborParameters
 	{
-		USeinWorldSubsystem& World;
-		const ISeinComponentStorage* MoveStorage = nullptr;
-		const ISeinComponentStorage* NavStorage = nullptr;
-		const ISeinComponentStorage* ExtentsStorage = nullptr;
-		const ISeinComponentStorage* BrokerStorage = nullptr;
-		const ISeinComponentStorage* BrokerDataStorage = nullptr;
+		const TArray<FSeinEntityHandle>& LiveHandles;
+		const FAvoidanceBodySnapshot& Bodies;
 		bool bDoSiDoEnabled = false;
 		bool bResolveThroughIdlers = false;
 		FFixedPoint MovingSpeedFloor;
@@ -147,6 +198,8 @@ namespace
 		const ISeinComponentStorage* ExtentsStorage = nullptr;
 		const ISeinComponentStorage* BrokerStorage = nullptr;
 		const ISeinComponentStorage* BrokerDataStorage = nullptr;
+		const FAvoidanceBodySnapshot& Bodies;
+		const FAvoidanceNeighborLists& NeighborLists;
 		const FAvoidanceNeighborParameters& NeighborParameters;
 		const FAvoidanceOutputParameters& OutputParameters;
 		const FFixedPoint* GapCos = nullptr;
@@ -160,7 +213,6 @@ namespace
 		FFixedPoint IdleResolveStrength;
 		FFixedPoint IdleDodgeStrength;
 		FFixedPoint BendCapCos;
-		FFixedPoint LookaheadSeconds;
 	};
 
 	/**
@@ -207,13 +259,9 @@ namespace
 	}
 
 	static void ComputeIdleDodge(
-		USeinWorldSubsystem& World,
-		const FSeinCollisionSpatialHash& Hash,
-		const ISeinComponentStorage* MoveStorage,
-		const ISeinComponentStorage* NavStorage,
-		const ISeinComponentStorage* ExtentsStorage,
-		FSeinEntityHandle SelfHandle,
-		const FSeinEntity& SelfEntity,
+		const FAvoidanceNeighborParameters& Parameters,
+		TConstArrayView<int32> Neighbors,
+		int32 SelfIndex,
 		FSeinMovementComponent& Move,
 		bool bIdleDodgeEnabled,
 		FFixedPoint MovingSpeedFloor,
@@ -228,69 +276,39 @@ namespace
 			return;
 		}
 
-		const FSeinNavigationComponent* SelfNavigation = NavStorage
-			? static_cast<const FSeinNavigationComponent*>(
-				NavStorage->GetComponentRaw(SelfHandle))
-			: nullptr;
-		const FSeinExtentsComponent* SelfExtents = ExtentsStorage
-			? static_cast<const FSeinExtentsComponent*>(
-				ExtentsStorage->GetComponentRaw(SelfHandle))
-			: nullptr;
-		const FFixedPoint SelfRadius = USeinMovement::ResolveCollisionRadius(
-			SelfExtents, SelfNavigation);
+		const FAvoidanceBodySnapshot& Bodies = Parameters.Bodies;
+		const FFixedPoint SelfRadius = Bodies.Radii[SelfIndex];
 		if (SelfRadius <= FFixedPoint::Zero)
 		{
 			ClearAvoidanceOutput(Move);
 			return;
 		}
 
-		const FFixedVector SelfPosition = SelfEntity.Transform.GetLocation();
-		const FFixedPoint Perception =
-			SelfRadius * FFixedPoint::FromInt(2);
-		TArray<FSeinEntityHandle> Neighbors;
-		Hash.QueryRadius(SelfPosition, Perception, Neighbors, SelfHandle);
-
+		const FSeinEntityHandle SelfHandle = Parameters.LiveHandles[SelfIndex];
+		const FFixedVector SelfPosition = Bodies.Positions[SelfIndex];
 		FFixedVector DodgeAccum = FFixedVector::ZeroVector;
-		for (const FSeinEntityHandle& OtherHandle : Neighbors)
+		for (const int32 Other : Neighbors)
 		{
-			const FSeinEntity* OtherEntity =
-				World.GetEntityPool().Get(OtherHandle);
-			if (!OtherEntity) continue;
-			const FSeinMovementComponent* OtherMove = MoveStorage
-				? static_cast<const FSeinMovementComponent*>(
-					MoveStorage->GetComponentRaw(OtherHandle))
-				: nullptr;
-			if (!OtherMove || !OtherMove->bHasTarget) continue;
-			const FFixedVector OtherVelocity = OtherMove->Velocity;
+			if (!(Bodies.Flags[Other] & BodyHasTarget)) continue;
+			const FFixedVector OtherVelocity = Bodies.Velocities[Other];
 			if (OtherVelocity.SizeSquared()
 				<= MovingSpeedFloor * MovingSpeedFloor)
 			{
 				continue;
 			}
 			const bool bQualifies = Move.bAvoidSameWeights
-				? OtherMove->AvoidanceWeight >= Move.AvoidanceWeight
-				: OtherMove->AvoidanceWeight > Move.AvoidanceWeight;
+				? Bodies.AvoidanceWeights[Other] >= Move.AvoidanceWeight
+				: Bodies.AvoidanceWeights[Other] > Move.AvoidanceWeight;
 			if (!bQualifies) continue;
 
-			FFixedVector ToSelf =
-				SelfPosition - OtherEntity->Transform.GetLocation();
+			FFixedVector ToSelf = SelfPosition - Bodies.Positions[Other];
 			ToSelf.Z = FFixedPoint::Zero;
 			if (ToSelf.X * OtherVelocity.X + ToSelf.Y * OtherVelocity.Y
 				<= FFixedPoint::Zero)
 			{
 				continue;
 			}
-			const FSeinNavigationComponent* OtherNavigation = NavStorage
-				? static_cast<const FSeinNavigationComponent*>(
-					NavStorage->GetComponentRaw(OtherHandle))
-				: nullptr;
-			const FSeinExtentsComponent* OtherExtents = ExtentsStorage
-				? static_cast<const FSeinExtentsComponent*>(
-					ExtentsStorage->GetComponentRaw(OtherHandle))
-				: nullptr;
-			const FFixedPoint OtherRadius =
-				USeinMovement::ResolveCollisionRadius(
-					OtherExtents, OtherNavigation);
+			const FFixedPoint OtherRadius = Bodies.Radii[Other];
 			if (OtherRadius <= FFixedPoint::Zero) continue;
 			const FFixedPoint DodgeRange =
 				(SelfRadius + OtherRadius) * FalloffRadii;
@@ -314,7 +332,7 @@ namespace
 				? FFixedPoint::One
 				: SideDot < -Band
 					? -FFixedPoint::One
-					: SelfHandle.Index < OtherHandle.Index
+					: SelfHandle.Index < Parameters.LiveHandles[Other].Index
 						? FFixedPoint::One
 						: -FFixedPoint::One;
 			DodgeAccum.X += MoverRight.X * (Falloff * TurnSign);
@@ -866,45 +884,31 @@ namespace
 	static void AccumulateNeighborResponses(
 		const FAvoidanceNeighborParameters& Parameters,
 		const FMoverAvoidanceSnapshot& Self,
-		const TArray<FSeinEntityHandle>& Neighbors,
+		TConstArrayView<int32> Neighbors,
 		FIdleBlockerSet& OutIdleBlockers,
 		FFixedVector& OutAccum)
 	{
-		TSet<FSeinEntityHandle> VisitedBlobBrokers;
-		for (const FSeinEntityHandle& OtherHandle : Neighbors)
+		const FAvoidanceBodySnapshot& Bodies = Parameters.Bodies;
+		TArray<FSeinEntityHandle, TInlineAllocator<8>> VisitedBlobBrokers;
+		for (const int32 Other : Neighbors)
 		{
-			const FSeinEntity* OtherEntity =
-				Parameters.World.GetEntityPool().Get(OtherHandle);
-			if (!OtherEntity) continue;
-			const FSeinMovementComponent* OtherMove = Parameters.MoveStorage
-				? static_cast<const FSeinMovementComponent*>(
-					Parameters.MoveStorage->GetComponentRaw(OtherHandle))
-				: nullptr;
-			if (!OtherMove) continue;
-
-			const FSeinBrokerMembershipData* OtherBroker =
-				Parameters.BrokerStorage
-					? static_cast<const FSeinBrokerMembershipData*>(
-						Parameters.BrokerStorage->GetComponentRaw(OtherHandle))
-					: nullptr;
-			const FSeinEntityHandle OtherBrokerHandle = OtherBroker
-				? OtherBroker->CurrentBrokerHandle
-				: FSeinEntityHandle();
+			const FSeinEntityHandle OtherHandle = Parameters.LiveHandles[Other];
+			const FFixedVector OtherPosition = Bodies.Positions[Other];
+			const FFixedVector OtherVelocity = Bodies.Velocities[Other];
+			const FSeinEntityHandle OtherBrokerHandle =
+				Bodies.BrokerHandles[Other];
 			if (OtherBrokerHandle.IsValid()
 				&& VisitedBlobBrokers.Contains(OtherBrokerHandle))
 			{
 				continue;
 			}
 
-			const bool bOtherHasTarget = OtherMove->bHasTarget;
+			const bool bOtherHasTarget =
+				(Bodies.Flags[Other] & BodyHasTarget) != 0;
 			const FSeinCommandBrokerData* OtherBrokerData =
-				OtherBrokerHandle.IsValid()
-					&& Parameters.BrokerDataStorage
-					&& OtherBrokerHandle != Self.BrokerHandle
-				? static_cast<const FSeinCommandBrokerData*>(
-					Parameters.BrokerDataStorage->GetComponentRaw(
-						OtherBrokerHandle))
-				: nullptr;
+				OtherBrokerHandle != Self.BrokerHandle
+					? Bodies.BrokerData[Other]
+					: nullptr;
 			const bool bOtherIsBlob = OtherBrokerData
 				&& OtherBrokerData->bAvoidAsCohesiveBody
 				&& OtherBrokerData->FormationRadius > FFixedPoint::Zero;
@@ -912,17 +916,16 @@ namespace
 			bool bGenuineCrossing = false;
 			if (Parameters.bDoSiDoEnabled && bOtherHasTarget)
 			{
-				FFixedVector OtherToGoal = OtherMove->TargetLocation
-					- OtherEntity->Transform.GetLocation();
+				FFixedVector OtherToGoal =
+					Bodies.TargetLocations[Other] - OtherPosition;
 				OtherToGoal.Z = FFixedPoint::Zero;
-				FFixedVector ToOtherEarly =
-					OtherEntity->Transform.GetLocation() - Self.Position;
+				FFixedVector ToOtherEarly = OtherPosition - Self.Position;
 				ToOtherEarly.Z = FFixedPoint::Zero;
 				const FFixedPoint BodySeparationSquared =
 					ToOtherEarly.SizeSquared();
 				const FFixedVector RelativeVelocityEarly(
-					Self.Velocity.X - OtherMove->Velocity.X,
-					Self.Velocity.Y - OtherMove->Velocity.Y,
+					Self.Velocity.X - OtherVelocity.X,
+					Self.Velocity.Y - OtherVelocity.Y,
 					FFixedPoint::Zero);
 				const FFixedPoint ClosingEarly =
 					ToOtherEarly.X * RelativeVelocityEarly.X
@@ -930,8 +933,8 @@ namespace
 				const FFixedPoint IntentDot =
 					Self.ToGoal.X * OtherToGoal.X
 					+ Self.ToGoal.Y * OtherToGoal.Y;
-				FFixedVector GoalSeparation =
-					OtherMove->TargetLocation - Self.Movement.TargetLocation;
+				FFixedVector GoalSeparation = Bodies.TargetLocations[Other]
+					- Self.Movement.TargetLocation;
 				GoalSeparation.Z = FFixedPoint::Zero;
 				const FFixedPoint GoalSeparationSquared =
 					GoalSeparation.SizeSquared();
@@ -944,36 +947,23 @@ namespace
 
 			const bool bSameBroker = Self.BrokerHandle.IsValid()
 				&& OtherBrokerHandle == Self.BrokerHandle;
-			const int64 OtherCohesionId = OtherBroker
-				? OtherBroker->CohesionGroupId
-				: 0;
+			const int64 OtherCohesionId = Bodies.CohesionIds[Other];
 			const bool bSameCohesion = Self.CohesionId != 0
 				&& Self.CohesionId == OtherCohesionId;
 			if (bSameBroker || bSameCohesion)
 			{
 				if (!bGenuineCrossing) continue;
-				if (OtherMove->Velocity.SizeSquared()
+				if (OtherVelocity.SizeSquared()
 					<= Parameters.MovingSpeedFloor
 						* Parameters.MovingSpeedFloor)
 				{
 					continue;
 				}
-				FFixedVector ToOther =
-					OtherEntity->Transform.GetLocation() - Self.Position;
+				FFixedVector ToOther = OtherPosition - Self.Position;
 				ToOther.Z = FFixedPoint::Zero;
 				const FFixedPoint DistanceSquared = ToOther.SizeSquared();
 				if (DistanceSquared <= FFixedPoint::Epsilon) continue;
-				const FSeinNavigationComponent* Navigation =
-					Parameters.NavStorage
-						? static_cast<const FSeinNavigationComponent*>(
-							Parameters.NavStorage->GetComponentRaw(OtherHandle))
-						: nullptr;
-				const FSeinExtentsComponent* Extents = Parameters.ExtentsStorage
-					? static_cast<const FSeinExtentsComponent*>(
-						Parameters.ExtentsStorage->GetComponentRaw(OtherHandle))
-					: nullptr;
-				const FFixedPoint Radius =
-					USeinMovement::ResolveCollisionRadius(Extents, Navigation);
+				const FFixedPoint Radius = Bodies.Radii[Other];
 				if (Radius <= FFixedPoint::Zero) continue;
 				const FFixedPoint Distance = SeinMath::Sqrt(DistanceSquared);
 				const FFixedPoint Range =
@@ -982,8 +972,7 @@ namespace
 				const FFixedPoint Falloff =
 					FFixedPoint::One - (Distance / Range);
 				const FFixedVector Steer = ComputeDoSiDoSteer(
-					Self.Handle, OtherHandle, Self.Position,
-					OtherEntity->Transform.GetLocation());
+					Self.Handle, OtherHandle, Self.Position, OtherPosition);
 				const FFixedPoint Magnitude =
 					(FFixedPoint::One + Parameters.HeadOnBase)
 					* Falloff * Parameters.DoSiDoStrength;
@@ -1049,15 +1038,16 @@ namespace
 				continue;
 			}
 
-			const bool bOtherIdle = !OtherMove->bHasTarget;
+			const bool bOtherIdle = !bOtherHasTarget;
 			if (bOtherIdle && !Parameters.bResolveThroughIdlers) continue;
 			const bool bQualifies = Self.Movement.bAvoidSameWeights
-				? OtherMove->AvoidanceWeight >= Self.Movement.AvoidanceWeight
-				: OtherMove->AvoidanceWeight > Self.Movement.AvoidanceWeight;
+				? Bodies.AvoidanceWeights[Other]
+					>= Self.Movement.AvoidanceWeight
+				: Bodies.AvoidanceWeights[Other]
+					> Self.Movement.AvoidanceWeight;
 			if (!bQualifies) continue;
 
-			FFixedVector ToOther =
-				OtherEntity->Transform.GetLocation() - Self.Position;
+			FFixedVector ToOther = OtherPosition - Self.Position;
 			ToOther.Z = FFixedPoint::Zero;
 			const FFixedPoint DistanceSquared = ToOther.SizeSquared();
 			if (DistanceSquared <= FFixedPoint::Epsilon) continue;
@@ -1067,8 +1057,8 @@ namespace
 				continue;
 			}
 			const FFixedVector RelativeVelocity(
-				Self.Velocity.X - OtherMove->Velocity.X,
-				Self.Velocity.Y - OtherMove->Velocity.Y,
+				Self.Velocity.X - OtherVelocity.X,
+				Self.Velocity.Y - OtherVelocity.Y,
 				FFixedPoint::Zero);
 			if (ToOther.X * RelativeVelocity.X
 					+ ToOther.Y * RelativeVelocity.Y
@@ -1082,19 +1072,7 @@ namespace
 				continue;
 			}
 
-			const FSeinNavigationComponent* OtherNavigation =
-				Parameters.NavStorage
-					? static_cast<const FSeinNavigationComponent*>(
-						Parameters.NavStorage->GetComponentRaw(OtherHandle))
-					: nullptr;
-			const FSeinExtentsComponent* OtherExtents =
-				Parameters.ExtentsStorage
-					? static_cast<const FSeinExtentsComponent*>(
-						Parameters.ExtentsStorage->GetComponentRaw(OtherHandle))
-					: nullptr;
-			const FFixedPoint OtherRadius =
-				USeinMovement::ResolveCollisionRadius(
-					OtherExtents, OtherNavigation);
+			const FFixedPoint OtherRadius = Bodies.Radii[Other];
 			if (OtherRadius <= FFixedPoint::Zero) continue;
 			const FFixedPoint Distance = SeinMath::Sqrt(DistanceSquared);
 			const FFixedPoint FalloffRange =
@@ -1104,7 +1082,6 @@ namespace
 				FFixedPoint::One - (Distance / FalloffRange);
 
 			FFixedPoint HeadOn = FFixedPoint::One + Parameters.HeadOnBase;
-			const FFixedVector OtherVelocity = OtherMove->Velocity;
 			const FFixedPoint OtherSpeed = OtherVelocity.Size();
 			if (OtherSpeed > Parameters.MovingSpeedFloor)
 			{
@@ -1118,8 +1095,7 @@ namespace
 			if (bGenuineCrossing)
 			{
 				const FFixedVector Steer = ComputeDoSiDoSteer(
-					Self.Handle, OtherHandle, Self.Position,
-					OtherEntity->Transform.GetLocation());
+					Self.Handle, OtherHandle, Self.Position, OtherPosition);
 				const FFixedPoint Weight =
 					HeadOn * Falloff * Parameters.DoSiDoStrength;
 				OutAccum.X += Steer.X * Weight;
@@ -1338,21 +1314,221 @@ namespace
 			}
 		}
 	}
+
+	static void BuildBodySnapshot(
+		USeinWorldSubsystem& World,
+		const TArray<FSeinEntityHandle>& LiveHandles,
+		const ISeinComponentStorage* MoveStorage,
+		const ISeinComponentStorage* NavStorage,
+		const ISeinComponentStorage* ExtentsStorage,
+		const ISeinComponentStorage* BrokerStorage,
+		const ISeinComponentStorage* BrokerDataStorage,
+		FAvoidanceBodySnapshot& OutBodies)
+	{
+		// Reset first so every element is freshly zeroed/defaulted while the
+		// allocations from earlier ticks are kept.
+		const int32 Count = LiveHandles.Num();
+		OutBodies.Positions.Reset();
+		OutBodies.Positions.SetNumZeroed(Count);
+		OutBodies.Velocities.Reset();
+		OutBodies.Velocities.SetNumZeroed(Count);
+		OutBodies.TargetLocations.Reset();
+		OutBodies.TargetLocations.SetNumZeroed(Count);
+		OutBodies.Radii.Reset();
+		OutBodies.Radii.SetNumZeroed(Count);
+		OutBodies.AvoidanceStrengths.Reset();
+		OutBodies.AvoidanceStrengths.SetNumZeroed(Count);
+		OutBodies.AvoidanceWeights.Reset();
+		OutBodies.AvoidanceWeights.SetNumZeroed(Count);
+		OutBodies.BrokerHandles.Reset();
+		OutBodies.BrokerHandles.SetNum(Count);
+		OutBodies.CohesionIds.Reset();
+		OutBodies.CohesionIds.SetNumZeroed(Count);
+		OutBodies.BrokerData.Reset();
+		OutBodies.BrokerData.SetNumZeroed(Count);
+		OutBodies.Flags.Reset();
+		OutBodies.Flags.SetNumZeroed(Count);
+
+		int32 MaxSlot = INDEX_NONE;
+		for (const FSeinEntityHandle& Handle : LiveHandles)
+		{
+			MaxSlot = FMath::Max(MaxSlot, Handle.Index);
+		}
+		OutBodies.LiveIndexBySlot.SetNumUninitialized(MaxSlot + 1, EAllowShrinking::No);
+		for (int32& LiveIndex : OutBodies.LiveIndexBySlot)
+		{
+			LiveIndex = INDEX_NONE;
+		}
+
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			const FSeinEntityHandle Handle = LiveHandles[Index];
+			OutBodies.LiveIndexBySlot[Handle.Index] = Index;
+			if (const FSeinEntity* Entity = World.GetEntityPool().Get(Handle))
+			{
+				OutBodies.Positions[Index] = Entity->Transform.GetLocation();
+			}
+			const FSeinMovementComponent* Move = MoveStorage
+				? static_cast<const FSeinMovementComponent*>(
+					MoveStorage->GetComponentRaw(Handle))
+				: nullptr;
+			if (!Move) continue;
+
+			OutBodies.Flags[Index] = BodyHasMovement
+				| (Move->bHasTarget ? BodyHasTarget : 0);
+			OutBodies.Velocities[Index] = Move->Velocity;
+			OutBodies.TargetLocations[Index] = Move->TargetLocation;
+			OutBodies.AvoidanceStrengths[Index] = Move->AvoidanceStrength;
+			OutBodies.AvoidanceWeights[Index] = Move->AvoidanceWeight;
+
+			const FSeinNavigationComponent* Navigation = NavStorage
+				? static_cast<const FSeinNavigationComponent*>(
+					NavStorage->GetComponentRaw(Handle))
+				: nullptr;
+			const FSeinExtentsComponent* Extents = ExtentsStorage
+				? static_cast<const FSeinExtentsComponent*>(
+					ExtentsStorage->GetComponentRaw(Handle))
+				: nullptr;
+			OutBodies.Radii[Index] =
+				USeinMovement::ResolveCollisionRadius(Extents, Navigation);
+
+			const FSeinBrokerMembershipData* Broker = BrokerStorage
+				? static_cast<const FSeinBrokerMembershipData*>(
+					BrokerStorage->GetComponentRaw(Handle))
+				: nullptr;
+			if (!Broker) continue;
+			OutBodies.BrokerHandles[Index] = Broker->CurrentBrokerHandle;
+			OutBodies.CohesionIds[Index] = Broker->CohesionGroupId;
+			OutBodies.BrokerData[Index] =
+				Broker->CurrentBrokerHandle.IsValid() && BrokerDataStorage
+					? static_cast<const FSeinCommandBrokerData*>(
+						BrokerDataStorage->GetComponentRaw(
+							Broker->CurrentBrokerHandle))
+					: nullptr;
+		}
+	}
+
+	/** Query radius for one body, or zero when ComputeMoverAvoidance will
+	 *  leave before reading neighbours. Mirrors its early-outs exactly. */
+	static FFixedPoint ComputePerceptionRadius(
+		const FAvoidanceBodySnapshot& Bodies,
+		int32 Index,
+		bool bIdleDodgeEnabled,
+		FFixedPoint MovingSpeedFloor,
+		FFixedPoint ArrivalReleaseRadii,
+		FFixedPoint LookaheadSeconds)
+	{
+		if (!(Bodies.Flags[Index] & BodyHasMovement)
+			|| Bodies.AvoidanceStrengths[Index] <= FFixedPoint::Zero)
+		{
+			return FFixedPoint::Zero;
+		}
+		const FFixedPoint Radius = Bodies.Radii[Index];
+		if (!(Bodies.Flags[Index] & BodyHasTarget))
+		{
+			return bIdleDodgeEnabled && Radius > FFixedPoint::Zero
+				? Radius * FFixedPoint::FromInt(2)
+				: FFixedPoint::Zero;
+		}
+
+		const FFixedPoint Speed = Bodies.Velocities[Index].Size();
+		if (Speed <= MovingSpeedFloor || Radius <= FFixedPoint::Zero)
+		{
+			return FFixedPoint::Zero;
+		}
+		FFixedVector ToGoal =
+			Bodies.TargetLocations[Index] - Bodies.Positions[Index];
+		ToGoal.Z = FFixedPoint::Zero;
+		const FFixedPoint ReleaseRadius = Radius * ArrivalReleaseRadii;
+		if (ToGoal.SizeSquared() <= ReleaseRadius * ReleaseRadius)
+		{
+			return FFixedPoint::Zero;
+		}
+		return Radius * FFixedPoint::FromInt(2) + Speed * LookaheadSeconds;
+	}
+
+	/** One broadphase pass for every body. Each worker appends into its own
+	 *  arena; the serial flatten then lays the spans out in live-index order,
+	 *  so the CSR is independent of which worker ran which body. Spans and
+	 *  Arenas are the caller's reused workspace. */
+	static void GatherNeighborLists(
+		const FSeinCollisionSpatialHash& Hash,
+		const TArray<FSeinEntityHandle>& LiveHandles,
+		const FAvoidanceBodySnapshot& Bodies,
+		bool bIdleDodgeEnabled,
+		FFixedPoint MovingSpeedFloor,
+		FFixedPoint ArrivalReleaseRadii,
+		FFixedPoint LookaheadSeconds,
+		TArray<FAvoidanceGatherSpan>& Spans,
+		TArray<FAvoidanceGatherScratch>& Arenas,
+		FAvoidanceNeighborLists& OutLists)
+	{
+		const int32 Count = LiveHandles.Num();
+		Spans.Reset();
+		Spans.SetNum(Count);
+		for (FAvoidanceGatherScratch& Arena : Arenas)
+		{
+			Arena.Indices.Reset();
+		}
+		SeinParallelForWithContext(Arenas, Count,
+			[&](FAvoidanceGatherScratch& Scratch, int32 Index)
+		{
+			const FFixedPoint Perception = ComputePerceptionRadius(
+				Bodies, Index, bIdleDodgeEnabled, MovingSpeedFloor,
+				ArrivalReleaseRadii, LookaheadSeconds);
+			if (Perception <= FFixedPoint::Zero) return;
+
+			Scratch.Candidates.Reset();
+			Hash.QueryRadius(
+				Bodies.Positions[Index], Perception,
+				Scratch.Candidates, LiveHandles[Index]);
+			FAvoidanceGatherSpan& Span = Spans[Index];
+			Span.Scratch = &Scratch;
+			Span.Begin = Scratch.Indices.Num();
+			for (const FSeinEntityHandle& Candidate : Scratch.Candidates)
+			{
+				const int32 Other =
+					Bodies.LiveIndexBySlot.IsValidIndex(Candidate.Index)
+						? Bodies.LiveIndexBySlot[Candidate.Index]
+						: INDEX_NONE;
+				if (Other == INDEX_NONE
+					|| LiveHandles[Other] != Candidate
+					|| !(Bodies.Flags[Other] & BodyHasMovement))
+				{
+					continue;
+				}
+				Scratch.Indices.Add(Other);
+			}
+			Span.Num = Scratch.Indices.Num() - Span.Begin;
+		});
+
+		OutLists.Offsets.SetNumUninitialized(Count + 1, EAllowShrinking::No);
+		int32 Total = 0;
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			OutLists.Offsets[Index] = Total;
+			Total += Spans[Index].Num;
+		}
+		OutLists.Offsets[Count] = Total;
+		OutLists.Indices.SetNumUninitialized(Total, EAllowShrinking::No);
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			const FAvoidanceGatherSpan& Span = Spans[Index];
+			if (Span.Num == 0) continue;
+			FMemory::Memcpy(
+				OutLists.Indices.GetData() + OutLists.Offsets[Index],
+				Span.Scratch->Indices.GetData() + Span.Begin,
+				Span.Num * sizeof(int32));
+		}
+	}
 	static void ComputeMoverAvoidance(
 		const FAvoidanceWorkerParameters& Parameters,
 		int32 Index)
 	{
 		USeinWorldSubsystem& World = Parameters.World;
-		const FSeinCollisionSpatialHash& Hash = Parameters.Hash;
 		const TArray<FSeinEntityHandle>& LiveHandles = Parameters.LiveHandles;
 		ISeinComponentStorage* MoveStorage = Parameters.MoveStorage;
-		const ISeinComponentStorage* ReadOnlyMoveStorage =
-			Parameters.ReadOnlyMoveStorage;
-		const ISeinComponentStorage* NavStorage = Parameters.NavStorage;
-		const ISeinComponentStorage* ExtentsStorage = Parameters.ExtentsStorage;
-		const ISeinComponentStorage* BrokerStorage = Parameters.BrokerStorage;
-		const ISeinComponentStorage* BrokerDataStorage =
-			Parameters.BrokerDataStorage;
+		const FAvoidanceBodySnapshot& Bodies = Parameters.Bodies;
 		const FAvoidanceNeighborParameters& NeighborParameters =
 			Parameters.NeighborParameters;
 		const FAvoidanceOutputParameters& OutputParameters =
@@ -1369,7 +1545,6 @@ namespace
 		const FFixedPoint IdleResolveStrength = Parameters.IdleResolveStrength;
 		const FFixedPoint IdleDodgeStrength = Parameters.IdleDodgeStrength;
 		const FFixedPoint BendCapCos = Parameters.BendCapCos;
-		const FFixedPoint LookaheadSeconds = Parameters.LookaheadSeconds;
 
 		const FSeinEntityHandle SelfHandle = LiveHandles[Index];
 		const FSeinEntity* SelfEntityPtr =
@@ -1377,10 +1552,6 @@ namespace
 		if (!SelfEntityPtr) return;
 		const FSeinEntity& SelfEntity = *SelfEntityPtr;
 
-		// Per-body neighbour scratch — MUST be a local (one buffer per body invocation)
-		// so concurrent QueryRadius calls never share it.
-		TArray<FSeinEntityHandle> Neighbors;
-
 		FSeinMovementComponent* Move = MoveStorage
 			? static_cast<FSeinMovementComponent*>(
 				MoveStorage->GetComponentRawForDeferredMutation(SelfHandle))
@@ -1395,9 +1566,8 @@ namespace
 		if (!Move->bHasTarget)
 		{
 			ComputeIdleDodge(
-				World, Hash, ReadOnlyMoveStorage, NavStorage,
-				ExtentsStorage, SelfHandle, SelfEntity, *Move,
-				bIdleDodgeEnabled, MovingSpeedFloor, FalloffRadii,
+				NeighborParameters, Parameters.NeighborLists.Get(Index),
+				Index, *Move, bIdleDodgeEnabled, MovingSpeedFloor, FalloffRadii,
 				MaxSteerMagnitude, IdleDodgeStrength, SmoothKeep);
 			return;
 		}
@@ -1410,8 +1580,9 @@ namespace
 		{
 #if !UE_BUILD_SHIPPING
 			ReportPinnedMover(
-				World, Hash, ReadOnlyMoveStorage, NavStorage,
-				ExtentsStorage, BrokerStorage, SelfHandle,
+				World, Parameters.Hash, Parameters.ReadOnlyMoveStorage,
+				Parameters.NavStorage, Parameters.ExtentsStorage,
+				Parameters.BrokerStorage, SelfHandle,
 				SelfEntity, *Move, Vel, MovingSpeedFloor,
 				FalloffRadii);
 #endif
@@ -1422,10 +1593,8 @@ namespace
 		const FFixedVector Right(Heading.Y, -Heading.X, FFixedPoint::Zero); // planar right of heading
 
 		// Body radius from the movement/nav FOOTPRINT cascade — NOT collision extents.
-		// Hoisted-storage pointers feed the no-lookup ResolveCollisionRadius overload.
-		const FSeinNavigationComponent* SelfNav = NavStorage ? static_cast<const FSeinNavigationComponent*>(NavStorage->GetComponentRaw(SelfHandle)) : nullptr;
-		const FSeinExtentsComponent* SelfExt = ExtentsStorage ? static_cast<const FSeinExtentsComponent*>(ExtentsStorage->GetComponentRaw(SelfHandle)) : nullptr;
-		const FFixedPoint SelfRadius = USeinMovement::ResolveCollisionRadius(SelfExt, SelfNav);
+		// Resolved once per tick into the body snapshot.
+		const FFixedPoint SelfRadius = Bodies.Radii[Index];
 		if (SelfRadius <= FFixedPoint::Zero)
 		{
 			ClearAvoidanceOutput(*Move);
@@ -1433,17 +1602,14 @@ namespace
 		}
 
 		// Self's two-layer group identity (see the storage-hoist comment above).
-		const FSeinBrokerMembershipData* SelfBroker = BrokerStorage
-			? static_cast<const FSeinBrokerMembershipData*>(BrokerStorage->GetComponentRaw(SelfHandle)) : nullptr;
-		const FSeinEntityHandle SelfBrokerHandle = SelfBroker ? SelfBroker->CurrentBrokerHandle : FSeinEntityHandle();
-		const int64 SelfCohesionId = SelfBroker ? SelfBroker->CohesionGroupId : 0;
+		const FSeinEntityHandle SelfBrokerHandle = Bodies.BrokerHandles[Index];
+		const int64 SelfCohesionId = Bodies.CohesionIds[Index];
 
 		// Self's own broker BLOB state — for blob-vs-blob: when BOTH self and the foreign obstacle
 		// squad advertise "avoid me as a body", the two squads sidestep coherently keyed on their
 		// broker centroids. When self is loose or non-blob, self routes around a foreign blob as an
 		// individual (the simpler geometric pick in the blob branch below).
-		const FSeinCommandBrokerData* SelfBrokerData = (SelfBrokerHandle.IsValid() && BrokerDataStorage)
-			? static_cast<const FSeinCommandBrokerData*>(BrokerDataStorage->GetComponentRaw(SelfBrokerHandle)) : nullptr;
+		const FSeinCommandBrokerData* SelfBrokerData = Bodies.BrokerData[Index];
 		const bool bSelfIsBlob = SelfBrokerData && SelfBrokerData->bAvoidAsCohesiveBody
 			&& SelfBrokerData->FormationRadius > FFixedPoint::Zero;
 		const FFixedVector SelfBrokerCentroid = SelfBrokerData ? SelfBrokerData->Centroid : FFixedVector::ZeroVector;
@@ -1468,12 +1634,9 @@ namespace
 			return;
 		}
 
-		// Speed-scaled perception radius (footprint-based; "personal space" needs no
-		// separate authored radius).
-		const FFixedPoint Perception = SelfRadius * FFixedPoint::FromInt(2) + Speed * LookaheadSeconds;
-
-		Neighbors.Reset();
-		Hash.QueryRadius(SelfPos, Perception, Neighbors, SelfHandle);
+		// Neighbours within the speed-scaled perception radius (footprint-based;
+		// "personal space" needs no separate authored radius), gathered up front
+		// by GatherNeighborLists.
 		FIdleBlockerSet IdleBlockers;
 		FFixedVector Accum = FFixedVector::ZeroVector;
 		const FMoverAvoidanceSnapshot SelfSnapshot{
@@ -1481,8 +1644,8 @@ namespace
 			SelfBrokerData, bSelfIsBlob, SelfBrokerCentroid, SelfPos,
 			ToGoal, GoalDistSq, Heading, Right, Vel, SelfRadius};
 		AccumulateNeighborResponses(
-			NeighborParameters, SelfSnapshot, Neighbors,
-			IdleBlockers, Accum);
+			NeighborParameters, SelfSnapshot,
+			Parameters.NeighborLists.Get(Index), IdleBlockers, Accum);
 		ResolveIdleGap(
 			IdleBlockers, Heading, Right, ToGoal, GoalDistSq,
 			BendCapCos, GapCos, GapSin, IdleResolveStrength, Accum);
@@ -1494,8 +1657,25 @@ namespace
 	}
 }
 
+struct FSeinAvoidanceDefaultKernel::FScratch
+{
+	FAvoidanceBodySnapshot Bodies;
+	FAvoidanceNeighborLists NeighborLists;
+	TArray<FAvoidanceGatherSpan> Spans;
+	TArray<FAvoidanceGatherScratch> Arenas;
+};
+
+FSeinAvoidanceDefaultKernel::FSeinAvoidanceDefaultKernel(
+	const USeinAvoidanceDefault& InPolicy)
+	: Policy(InPolicy)
+	, Scratch(MakeUnique<FScratch>())
+{
+}
+
+FSeinAvoidanceDefaultKernel::~FSeinAvoidanceDefaultKernel() = default;
+
 void FSeinAvoidanceDefaultKernel::Execute(
-	USeinWorldSubsystem& World) const
+	USeinWorldSubsystem& World)
 {
 	const FSeinCollisionSpatialHash& Hash = World.GetCollisionSpatialHash();
 
@@ -1609,6 +1789,20 @@ void FSeinAvoidanceDefaultKernel::Execute(
 		TickState.OuterAggregates);
 
 	const TArray<FSeinEntityHandle>& LiveHandles = TickState.LiveHandles;
+
+	// Neighbour-facing body state and every mover's neighbour list, built once
+	// before the per-mover pass so its inner loops touch only flat arrays and
+	// allocate nothing. Rebuilt into the kernel's retained scratch, so a
+	// steady crowd reallocates none of it from tick to tick.
+	FAvoidanceBodySnapshot& Bodies = Scratch->Bodies;
+	BuildBodySnapshot(
+		World, LiveHandles, ReadOnlyMoveStorage, NavStorage,
+		ExtentsStorage, BrokerStorage, BrokerDataStorage, Bodies);
+	FAvoidanceNeighborLists& NeighborLists = Scratch->NeighborLists;
+	GatherNeighborLists(
+		Hash, LiveHandles, Bodies, bIdleDodgeEnabled, MovingSpeedFloor,
+		ArrivalReleaseRadii, LookaheadSeconds, Scratch->Spans,
+		Scratch->Arenas, NeighborLists);
 	const TArray<FFixedPoint>& ActualProgress = TickState.ActualProgress;
 	const TMap<FSeinEntityHandle, FCohesionAggregate>& GroupAggregates =
 		TickState.GroupAggregates;
@@ -1629,12 +1823,8 @@ void FSeinAvoidanceDefaultKernel::Execute(
 		CohesionBoost,
 		CohesionRangeRadii};
 	const FAvoidanceNeighborParameters NeighborParameters{
-		World,
-		ReadOnlyMoveStorage,
-		NavStorage,
-		ExtentsStorage,
-		BrokerStorage,
-		BrokerDataStorage,
+		LiveHandles,
+		Bodies,
 		bDoSiDoEnabled,
 		bResolveThroughIdlers,
 		MovingSpeedFloor,
@@ -1652,6 +1842,8 @@ void FSeinAvoidanceDefaultKernel::Execute(
 		ExtentsStorage,
 		BrokerStorage,
 		BrokerDataStorage,
+		Bodies,
+		NeighborLists,
 		NeighborParameters,
 		OutputParameters,
 		GapCos,
@@ -1664,8 +1856,7 @@ void FSeinAvoidanceDefaultKernel::Execute(
 		MaxSteerMagnitude,
 		IdleResolveStrength,
 		IdleDodgeStrength,
-		BendCapCos,
-		LookaheadSeconds};
+		BendCapCos};
 
 	SeinParallelFor(LiveHandles.Num(), [&](int32 Index)
 	{
@@ -4,12 +4,13 @@
  * @file         SeinAvoidanceDefaultKernel.h
  * @author       RJ Macklem
  * @created      13 Aug 2026
- * @latest       13 Aug 2026
+ * @latest       17 Oct 2026
  * @brief        Declares the private deterministic default-avoidance kernel.
  *
  *               The public avoidance UObject remains the selected policy and
  *               authoring surface. This private kernel owns tick execution and
- *               carries no persistent state between calls.
+ *               the per-tick workspace it reuses; no simulation state survives
+ *               between calls.
  *
  * @disclaimer   This code was generated in whole or in part with the assistance
  *               of an AI language model.
@@ -17,6 +18,8 @@
 
 #pragma once
 
+#include "Templates/UniquePtr.h"
+
 class USeinAvoidanceDefault;
 class USeinWorldSubsystem;
 
@@ -25,13 +28,17 @@ class FSeinAvoidanceDefaultKernel final
 {
 public:
 	explicit FSeinAvoidanceDefaultKernel(
-		const USeinAvoidanceDefault& InPolicy)
-		: Policy(InPolicy)
-	{
-	}
+		const USeinAvoidanceDefault& InPolicy);
+	~FSeinAvoidanceDefaultKernel();
 
-	void Execute(USeinWorldSubsystem& World) const;
+	void Execute(USeinWorldSubsystem& World);
 
 private:
 	const USeinAvoidanceDefault& Policy;
+
+	/** Body snapshot, neighbour lists and gather arenas. Reset without
+	 *  shrinking at the start of every Execute and fully rewritten before
+	 *  they are read, so only their capacity carries across ticks. */
+	struct FScratch;
+	TUniquePtr<FScratch> Scratch;
 };
@@ -364,6 +364,8 @@ FFixedVector USeinMoverHandle::QueryNavDirection(FFixedVector Goal, int64 GroupI
 	}
 	Query.AgentFootprintRadius = GetFootprintRadius();
 	Query.GroupId             = GroupId;
+	// Movement runs in the sim, the only place allowed to grow shared fields.
+	Ctx->Nav->PrepareDirectionQuery(Query);
 	return Ctx->Nav->QueryDirection(Query);
 }
 
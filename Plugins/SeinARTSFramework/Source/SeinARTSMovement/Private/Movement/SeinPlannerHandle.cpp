@@ -182,8 +182,9 @@ ESeinPathResult USeinPlannerHandle::RequestNavPath()
 	// body actually occupies — the same radius runtime collision uses.
 	Req.AgentFootprintRadius = USeinMovement::ResolveCollisionRadius(Ctx->World, Ctx->SelfHandle, Ctx->NavData);
 	// Group key for share-planning navs (flow field / hierarchical): the order's cohesion
-	// group id, stamped on every member of a multi-element order. The shipped A* ignores
-	// it; a shared-field nav keys one field/route per (GroupId, End). 0 = lone agent.
+	// group id, stamped on every member of a multi-element order. The shipped A* serves
+	// nonzero ids from one shared flow field per destination + clearance profile, so the
+	// members' repaths walk that field instead of searching. 0 = lone agent.
 	if (Ctx->World)
 	{
 		if (const FSeinBrokerMembershipData* Membership =
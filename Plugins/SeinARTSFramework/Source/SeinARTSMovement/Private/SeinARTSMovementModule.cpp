@@ -805,6 +805,11 @@ namespace
 			UWorld* World = Sub->GetWorld();
 			if (!World) continue;
 			if (!UE::SeinARTSNavigation::IsNavigationShowFlagOnForWorld(World)) continue;
+			// Core tickers can run while a dedicated-thread batch owns the sim.
+			if (USeinWorldSubsystem* Sim = World->GetSubsystem<USeinWorldSubsystem>())
+			{
+				Sim->WaitForSimulationThreadBatch();
+			}
 			DrawActiveMoveDebug(World);
 		}
 
@@ -820,6 +825,10 @@ namespace
 				if (!World || !World->IsGameWorld()) continue;
 				if (!UE::SeinARTSMovement::IsSteeringShowFlagOnForWorld(World)) continue;
 				USeinWorldSubsystem* Sim = World->GetSubsystem<USeinWorldSubsystem>();
+				if (Sim)
+				{
+					Sim->WaitForSimulationThreadBatch();
+				}
 				DrawSteeringVectorsViz(Sim, World);
 			}
 		}
@@ -67,13 +67,20 @@ public:
 
 	virtual FSeinSystemDescriptor DescribeSystem() const override
 	{
-		return FSeinSystemDescriptor::WithCanonicalState(
-			FName(TEXT("seinarts.movement.avoidance")),
-			1u,
-			ESeinTickPhase::PreTick,
-			SeinSystemPriority::Avoidance,
-			{FName(TEXT(
-				"seinarts.movement/persistent-policy-instances"))});
+		FSeinSystemDescriptor Descriptor =
+			FSeinSystemDescriptor::WithCanonicalState(
+				FName(TEXT("seinarts.movement.avoidance")),
+				1u,
+				ESeinTickPhase::PreTick,
+				SeinSystemPriority::Avoidance,
+				{FName(TEXT(
+					"seinarts.movement/persistent-policy-instances"))});
+		FSeinSystemAccess Access;
+		if (Avoidance && Avoidance->DescribeSystemAccess(Access))
+		{
+			Descriptor.Access = MoveTemp(Access);
+		}
+		return Descriptor;
 	}
 
 private:
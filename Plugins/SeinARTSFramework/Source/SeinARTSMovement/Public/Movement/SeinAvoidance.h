@@ -45,6 +45,7 @@
 
 class USeinWorldSubsystem;
 class UWorld;
+struct FSeinSystemAccess;
 
 UCLASS(Abstract, BlueprintType, meta = (DisplayName = "Sein Avoidance"))
 class SEINARTSMOVEMENT_API USeinAvoidance : public UObject
@@ -83,4 +84,9 @@ public:
 	 *  not mutate reflected fields on the policy UObject itself. Unknown native
 	 *  and Blueprint implementations remain conservatively dirty-tracked. */
 	virtual bool HasImmutableRuntimePolicyState() const { return false; }
+
+	/** Fill the data the per-tick compute touches so the avoidance system can
+	 *  share a tick wave with other declared systems. Return false (default) to
+	 *  keep the system an exclusive barrier. Called once, at registration. */
+	virtual bool DescribeSystemAccess(FSeinSystemAccess& /*OutAccess*/) const { return false; }
 };
@@ -41,6 +41,7 @@
 #include "Types/FixedPoint.h"
 #include "SeinAvoidanceDefault.generated.h"
 
+class FSeinAvoidanceDefaultKernel;
 class USeinWorldSubsystem;
 
 /**
@@ -58,6 +59,8 @@ class SEINARTSMOVEMENT_API USeinAvoidanceDefault : public USeinAvoidance
 
 public:
 
+	virtual ~USeinAvoidanceDefault() override;
+
 	/** One PreTick local-avoidance pass over all movers — writes each unit's own
 	 *  AvoidanceOutput (SteerDir + SpeedScale). See the file docstring for the model
 	 *  and USeinAvoidance::ComputeAvoidance for the seam contract. */
@@ -66,6 +69,7 @@ public:
 	{
 		return GetClass() == StaticClass();
 	}
+	virtual bool DescribeSystemAccess(FSeinSystemAccess& OutAccess) const override;
 
 	// ====================================================================================
 	// Model tuning — authored on this class's CDO. To tune, subclass this as a Blueprint, set the
@@ -200,4 +204,10 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "SeinARTS",
 		meta = (DisplayName = "Crossing Goal Divergence", ClampMin = "0.0"))
 	FFixedPoint AvoidanceCrossingGoalDivergence = FFixedPoint::One;
+
+private:
+	/** Created on first compute and kept for this instance's lifetime so its
+	 *  per-tick workspace is reused. Not reflected and never read across ticks,
+	 *  so it is not runtime policy state. */
+	TUniquePtr<FSeinAvoidanceDefaultKernel> Kernel;
 };
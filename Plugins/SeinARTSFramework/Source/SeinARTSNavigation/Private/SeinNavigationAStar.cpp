@@ -4,7 +4,7 @@
  * @file         SeinNavigationAStar.cpp
  * @author       RJ Macklem
  * @created      02 Jun 2026
- * @latest       13 Aug 2026
+ * @latest       17 Oct 2026
  * @brief        Implements the shipped deterministic A* navigation policy.
  *
  *               Non-shipping path reporters live in the adjacent private
@@ -584,6 +584,10 @@ USeinNavigationAStar::LoadFromSubstrateImpl(
 	RebuildConnectivityComponents();
 	ReachabilityProfileCache.Reset();
 
+	// Derived HPA* cluster/portal graph — pure function of the grid above plus
+	// WallDistance (portal placement); recomputed on every grid load.
+	RebuildHierarchicalGraph();
+
 	// Grid adoption can change width/height while retaining the same total cell
 	// count. Drop both overlay bytes and their 2D dirty rectangle so neither is
 	// reinterpreted through the new row stride. Reset retains array capacity.
@@ -592,6 +596,8 @@ USeinNavigationAStar::LoadFromSubstrateImpl(
 		FIntRect(INT32_MAX, INT32_MAX, INT32_MIN, INT32_MIN);
 	MainScratch.bOverlayReuseValid = false;
 	RebuildDynamicBlockerCellIndex();
+	// Shared flow fields regrow against the new grid on next use.
+	++FlowFieldRevision;
 
 	// Broadcast after runtime state is in sync — subscribers (debug scene proxy,
 	// cached plan invalidation, etc.) see a consistent snapshot.
@@ -642,7 +648,7 @@ bool USeinNavigationAStar::ComputeAStarStateCoverageClaim(
 	OutError.Reset();
 	OutClaim.StableImplementationId =
 		TEXT("seinarts.navigation.astar");
-	OutClaim.BehaviorRevision = 2;
+	OutClaim.BehaviorRevision = 7;
 	OutClaim.CoverageRevision = 1;
 	OutClaim.StateCoverage =
 		ESeinNavigationStateCoverage::Stateless;
@@ -656,11 +662,14 @@ bool USeinNavigationAStar::ComputeAStarStaticEnvironmentDigest(
 	OutDigest.Invalidate();
 	OutError.Reset();
 	FSeinCanonicalDigestWriter Writer(
-		TEXT("SeinARTS.Navigation.AStar.StaticEnvironment"), 1);
+		TEXT("SeinARTS.Navigation.AStar.StaticEnvironment"), 3);
 	if (!Writer.WriteString(GetClass()->GetPathName())
 		|| !Writer.WriteBool(HasRuntimeData())
 		|| !Writer.WriteInt32(AStarHeuristicWeightPercent)
-		|| !Writer.WriteInt32(AStarMaxIterations))
+		|| !Writer.WriteInt32(AStarMaxIterations)
+		|| !Writer.WriteBool(bHierarchicalPathfinding)
+		|| !Writer.WriteInt32(HierarchicalClusterSizeCells)
+		|| !Writer.WriteBool(bSharedFlowFields))
 	{
 		OutError = Writer.GetError();
 		return false;
@@ -1635,6 +1644,7 @@ void USeinNavigationAStar::SetDynamicBlockers(const TArray<FSeinDynamicBlocker>&
 	DynamicBlockers = InBlockers;
 	RebuildDynamicBlockerCellIndex();
 	MainScratch.bOverlayReuseValid = false;
+	++FlowFieldRevision;
 	OnNavigationMutated.Broadcast();
 }
 
@@ -1644,6 +1654,7 @@ void USeinNavigationAStar::RebuildDynamicBlockerCellIndex()
 	DynamicBlockerIndicesByCell.Reset();
 	if (Width <= 0 || Height <= 0 || CellSize <= FFixedPoint::Zero)
 	{
+		RefreshHierarchicalBlockerMasks();
 		return;
 	}
 
@@ -1667,6 +1678,9 @@ void USeinNavigationAStar::RebuildDynamicBlockerCellIndex()
 					CellIndex(X, Y), BlockerIndex);
 			});
 	}
+
+	// Only the clusters these stamps touch lose their cached HPA* edges.
+	RefreshHierarchicalBlockerMasks();
 }
 
 void USeinNavigationAStar::BuildDynamicBlockedOverlay(FSeinEntityHandle Exclude, uint8 AgentNavLayerMask, FAStarScratch& Scratch) const
@@ -2277,6 +2291,22 @@ namespace
 		const int32 Mx = FMath::Max(DX, DY);
 		return 14 * Mn + 10 * (Mx - Mn);
 	}
+
+	/** The cell-path request a direction query routes, so the prepare and the
+	 *  query key the same flow field. */
+	FSeinPathRequest MakeDirectionPathRequest(const FSeinDirectionQuery& Query)
+	{
+		FSeinPathRequest Req;
+		Req.Start                = Query.From;
+		Req.End                  = Query.Goal;
+		Req.Requester            = Query.Requester;
+		Req.BlockedTerrainTags   = Query.BlockedTerrainTags;
+		Req.AgentNavLayerMask    = Query.AgentNavLayerMask;
+		Req.AgentFootprintRadius = Query.AgentFootprintRadius;
+		Req.AgentWallPaddingCells = Query.AgentWallPaddingCells;
+		Req.GroupId              = Query.GroupId;
+		return Req;
+	}
 	// FAStarNode moved to a class-private nested type on USeinNavigationAStar
 	// so the Open heap can live inside FAStarScratch (per-worker on the parallel
 	// path; the serial path reuses the persistent MainScratch) and preserve its
@@ -2388,7 +2418,7 @@ namespace
 }
 
 void USeinNavigationAStar::AStarSearch(FIntPoint Start, FIntPoint End, bool& bOutPartial,
-	int32 HeuristicWeightPercent, int32 MaxIterations, int32 RequiredClearance, FAStarScratch& Scratch) const
+	int32 HeuristicWeightPercent, int32& InOutIterationBudget, int32 RequiredClearance, FAStarScratch& Scratch) const
 {
 	bOutPartial = false;
 	// The reconstructed chain is written into Scratch.CellPath (pooled). Reset it
@@ -2467,8 +2497,10 @@ void USeinNavigationAStar::AStarSearch(FIntPoint Start, FIntPoint End, bool& bOu
 
 	// Iteration cap. Bounds worst-case work on huge grids / unreachable
 	// goals — when hit, the existing best-H partial-path return path
-	// activates the same as if the open list had exhausted naturally.
-	const int32 IterCap = FMath::Max(MaxIterations, 1);
+	// activates the same as if the open list had exhausted naturally. The
+	// cap is whatever the caller's budget has left; expansions spent here
+	// are charged back to it on both exits below.
+	const int32 IterCap = FMath::Max(InOutIterationBudget, 1);
 	int32 Iterations = 0;
 
 	// Touch start cell — initialize all gen-validated fields explicitly so
@@ -2518,6 +2550,7 @@ void USeinNavigationAStar::AStarSearch(FIntPoint Start, FIntPoint End, bool& bOu
 		if (Cur.CellIdx == EndIdx)
 		{
 			// Exact goal reached.
+			InOutIterationBudget = FMath::Max(InOutIterationBudget - Iterations, 0);
 			Reconstruct(EndIdx);
 			return;
 		}
@@ -2699,6 +2732,7 @@ void USeinNavigationAStar::AStarSearch(FIntPoint Start, FIntPoint End, bool& bOu
 	ReportAStarPartial(Start, End, StartIdx, EndIdx, BestCellIdx, Iterations, IterCap, RequiredClearance, Scratch);
 #endif
 
+	InOutIterationBudget = FMath::Max(InOutIterationBudget - Iterations, 0);
 	Reconstruct(BestCellIdx);
 }
 
@@ -2706,6 +2740,793 @@ void USeinNavigationAStar::AStarSearch(FIntPoint Start, FIntPoint End, bool& bOu
 #include "SeinNavigationAStarDiagnostics.inl"
 #endif
 
+// ============================================================================
+// Hierarchical pathfinding (HPA*)
+//
+//   The static grid is cut into ClusterSize² clusters. Each maximal run of open
+//   cell pairs along a shared cluster border becomes ONE entrance, represented
+//   by a portal cell on either side, placed at the run's widest point (highest
+//   min static WallDistance) so big footprints get the best chance through it.
+//   Portals of one cluster are joined by intra-cluster edges costed with a
+//   cluster-bounded Dijkstra; the two portals of an entrance by a single-step
+//   inter-cluster edge. A long request searches that graph first, then refines
+//   each consecutive pair of abstract waypoints with the ordinary AStarSearch.
+// ============================================================================
+
+void USeinNavigationAStar::ComputeClusterLocalCosts(
+	int32 ClusterIdx,
+	int32 SourceCell,
+	const FAStarScratch* RequestScratch,
+	TArray<int32>& OutCosts,
+	TArray<FAStarNode>& Open) const
+{
+	const int32 S = Hierarchy.ClusterSize;
+	const int32 X0 = (ClusterIdx % Hierarchy.ClustersX) * S;
+	const int32 Y0 = (ClusterIdx / Hierarchy.ClustersX) * S;
+	const int32 X1 = FMath::Min(X0 + S, Width);
+	const int32 Y1 = FMath::Min(Y0 + S, Height);
+	OutCosts.Init(INT32_MAX, S * S);
+	Open.Reset();
+
+	auto IsOpen = [this, RequestScratch](int32 X, int32 Y)
+	{
+		return RequestScratch
+			? IsCellPassableForPath(X, Y, *RequestScratch)
+			: IsCellPassable(X, Y);
+	};
+
+	const int32 SX = SourceCell % Width;
+	const int32 SY = SourceCell / Width;
+	if (SX < X0 || SX >= X1 || SY < Y0 || SY >= Y1) return;
+
+	int32 Tiebreak = 0;
+	OutCosts[(SY - Y0) * S + (SX - X0)] = 0;
+	Open.HeapPush(FAStarNode{SourceCell, 0, 0, Tiebreak++});
+	while (Open.Num() > 0)
+	{
+		FAStarNode Cur;
+		Open.HeapPop(Cur, EAllowShrinking::No);
+		const int32 CX = Cur.CellIdx % Width;
+		const int32 CY = Cur.CellIdx / Width;
+		if (Cur.GCost > OutCosts[(CY - Y0) * S + (CX - X0)]) continue; // stale heap entry
+
+		const uint8 Conn = CellConnections[Cur.CellIdx];
+		for (int32 n = 0; n < 8; ++n)
+		{
+			if ((Conn & (1 << n)) == 0) continue;
+			const int32 NX = CX + SeinNeighborDX[n];
+			const int32 NY = CY + SeinNeighborDY[n];
+			if (NX < X0 || NX >= X1 || NY < Y0 || NY >= Y1) continue;
+			if (!IsOpen(NX, NY)) continue;
+			if (n >= 4
+				&& ((Conn & (1 << SeinDiagCardinalA[n - 4])) == 0
+					|| (Conn & (1 << SeinDiagCardinalB[n - 4])) == 0))
+			{
+				continue;
+			}
+			const int32 NIdx = CellIndex(NX, NY);
+			const int32 NewG = Cur.GCost + SeinNeighborCost[n] * CellCost[NIdx];
+			int32& Best = OutCosts[(NY - Y0) * S + (NX - X0)];
+			if (NewG >= Best) continue;
+			Best = NewG;
+			Open.HeapPush(FAStarNode{NIdx, NewG, NewG, Tiebreak++});
+		}
+	}
+}
+
+void USeinNavigationAStar::RebuildHierarchicalGraph()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(Sein_Nav_RebuildHierarchicalGraph);
+	Hierarchy.Reset();
+	const int32 S = FMath::Clamp(HierarchicalClusterSizeCells, 8, 64);
+	if (Width <= 0 || Height <= 0 || WallDistance.Num() != Width * Height) return;
+
+	Hierarchy.ClusterSize = S;
+	Hierarchy.ClustersX = (Width + S - 1) / S;
+	Hierarchy.ClustersY = (Height + S - 1) / S;
+	const int32 NumClusters = Hierarchy.ClustersX * Hierarchy.ClustersY;
+
+	// Portal discovery. Border scans run in a fixed order (vertical borders
+	// row-major, then horizontal borders) and a cell shared by two entrances
+	// maps to one node, so node numbering is a pure function of the grid.
+	TMap<int32, int32> NodeByCell;
+	TArray<TArray<FHierarchicalEdge>> NodeEdges;
+	auto AddNode = [this, &NodeByCell, &NodeEdges](int32 Cell) -> int32
+	{
+		if (const int32* Existing = NodeByCell.Find(Cell)) return *Existing;
+		const int32 Node = Hierarchy.NodeCell.Add(Cell);
+		Hierarchy.NodeCluster.Add(HierarchicalClusterOf(Cell));
+		NodeEdges.AddDefaulted();
+		NodeByCell.Add(Cell, Node);
+		return Node;
+	};
+
+	// An entrance pair (A inside the lower-index cluster, B across the border)
+	// is open iff both cells are passable and each carries the connection bit
+	// toward the other. Dir indices: 0:E 1:W 2:N(+Y) 3:S(-Y).
+	auto EmitEntrances = [this, &AddNode, &NodeEdges](
+		FIntPoint AStart, FIntPoint Step, FIntPoint Across, int32 Length,
+		int32 DirAB, int32 DirBA)
+	{
+		auto IsOpenPair = [&](int32 i)
+		{
+			const int32 AX = AStart.X + Step.X * i;
+			const int32 AY = AStart.Y + Step.Y * i;
+			const int32 BX = AX + Across.X;
+			const int32 BY = AY + Across.Y;
+			if (!IsCellPassable(AX, AY) || !IsCellPassable(BX, BY)) return false;
+			return (CellConnections[CellIndex(AX, AY)] & (1 << DirAB)) != 0
+				&& (CellConnections[CellIndex(BX, BY)] & (1 << DirBA)) != 0;
+		};
+
+		int32 RunStart = INDEX_NONE;
+		for (int32 i = 0; i <= Length; ++i)
+		{
+			if (i < Length && IsOpenPair(i))
+			{
+				if (RunStart == INDEX_NONE) RunStart = i;
+				continue;
+			}
+			if (RunStart == INDEX_NONE) continue;
+
+			// Widest point of the run: maximize min(WD[A], WD[B]); tie → closest
+			// to the run's middle; tie → lower index.
+			const int32 RunEnd = i - 1;
+			int32 BestI = RunStart;
+			int32 BestWD = -1;
+			int32 BestMid = INT32_MAX;
+			for (int32 j = RunStart; j <= RunEnd; ++j)
+			{
+				const int32 A = CellIndex(AStart.X + Step.X * j, AStart.Y + Step.Y * j);
+				const int32 B = CellIndex(AStart.X + Step.X * j + Across.X, AStart.Y + Step.Y * j + Across.Y);
+				const int32 WD = FMath::Min(WallDistance[A], WallDistance[B]);
+				const int32 Mid = FMath::Abs(2 * j - (RunStart + RunEnd));
+				if (WD > BestWD || (WD == BestWD && Mid < BestMid))
+				{
+					BestI = j;
+					BestWD = WD;
+					BestMid = Mid;
+				}
+			}
+			const int32 ACell = CellIndex(AStart.X + Step.X * BestI, AStart.Y + Step.Y * BestI);
+			const int32 BCell = CellIndex(
+				AStart.X + Step.X * BestI + Across.X, AStart.Y + Step.Y * BestI + Across.Y);
+			const int32 ANode = AddNode(ACell);
+			const int32 BNode = AddNode(BCell);
+			const int32 CardinalCost = SeinNeighborCost[0];
+			NodeEdges[ANode].Add(FHierarchicalEdge{BNode, CardinalCost * CellCost[BCell], false});
+			NodeEdges[BNode].Add(FHierarchicalEdge{ANode, CardinalCost * CellCost[ACell], false});
+			RunStart = INDEX_NONE;
+		}
+	};
+
+	for (int32 CY = 0; CY < Hierarchy.ClustersY; ++CY)
+	{
+		const int32 Y0 = CY * S;
+		const int32 Len = FMath::Min(S, Height - Y0);
+		for (int32 CX = 1; CX < Hierarchy.ClustersX; ++CX)
+		{
+			EmitEntrances(FIntPoint(CX * S - 1, Y0), FIntPoint(0, 1), FIntPoint(1, 0), Len, 0, 1);
+		}
+	}
+	for (int32 CY = 1; CY < Hierarchy.ClustersY; ++CY)
+	{
+		for (int32 CX = 0; CX < Hierarchy.ClustersX; ++CX)
+		{
+			const int32 X0 = CX * S;
+			const int32 Len = FMath::Min(S, Width - X0);
+			EmitEntrances(FIntPoint(X0, CY * S - 1), FIntPoint(1, 0), FIntPoint(0, 1), Len, 2, 3);
+		}
+	}
+
+	const int32 NumNodes = Hierarchy.NodeCell.Num();
+	if (NumNodes == 0)
+	{
+		Hierarchy.Reset();
+		return;
+	}
+
+	// Cluster → nodes CSR (ascending node index within each cluster).
+	Hierarchy.ClusterNodeOffsets.Init(0, NumClusters + 1);
+	for (int32 Node = 0; Node < NumNodes; ++Node)
+	{
+		++Hierarchy.ClusterNodeOffsets[Hierarchy.NodeCluster[Node] + 1];
+	}
+	for (int32 C = 0; C < NumClusters; ++C)
+	{
+		Hierarchy.ClusterNodeOffsets[C + 1] += Hierarchy.ClusterNodeOffsets[C];
+	}
+	Hierarchy.ClusterNodes.SetNumUninitialized(NumNodes);
+	{
+		TArray<int32> Cursor(Hierarchy.ClusterNodeOffsets.GetData(), NumClusters);
+		for (int32 Node = 0; Node < NumNodes; ++Node)
+		{
+			Hierarchy.ClusterNodes[Cursor[Hierarchy.NodeCluster[Node]]++] = Node;
+		}
+	}
+
+	// Intra-cluster edges: one static Dijkstra per portal, bounded to its cluster.
+	TArray<int32> LocalCosts;
+	TArray<FAStarNode> LocalOpen;
+	for (int32 C = 0; C < NumClusters; ++C)
+	{
+		const int32 Begin = Hierarchy.ClusterNodeOffsets[C];
+		const int32 End = Hierarchy.ClusterNodeOffsets[C + 1];
+		if (End - Begin < 2) continue;
+		const int32 X0 = (C % Hierarchy.ClustersX) * S;
+		const int32 Y0 = (C / Hierarchy.ClustersX) * S;
+		for (int32 i = Begin; i < End; ++i)
+		{
+			const int32 From = Hierarchy.ClusterNodes[i];
+			ComputeClusterLocalCosts(C, Hierarchy.NodeCell[From], nullptr, LocalCosts, LocalOpen);
+			for (int32 j = Begin; j < End; ++j)
+			{
+				if (i == j) continue;
+				const int32 To = Hierarchy.ClusterNodes[j];
+				const int32 ToCell = Hierarchy.NodeCell[To];
+				const int32 Cost = LocalCosts[((ToCell / Width) - Y0) * S + ((ToCell % Width) - X0)];
+				if (Cost == INT32_MAX) continue;
+				NodeEdges[From].Add(FHierarchicalEdge{To, Cost, true});
+			}
+		}
+	}
+
+	// Flatten node → edges into CSR.
+	Hierarchy.EdgeOffsets.SetNumUninitialized(NumNodes + 1);
+	Hierarchy.EdgeOffsets[0] = 0;
+	for (int32 Node = 0; Node < NumNodes; ++Node)
+	{
+		Hierarchy.EdgeOffsets[Node + 1] = Hierarchy.EdgeOffsets[Node] + NodeEdges[Node].Num();
+	}
+	Hierarchy.Edges.Reserve(Hierarchy.EdgeOffsets[NumNodes]);
+	for (const TArray<FHierarchicalEdge>& Edges : NodeEdges)
+	{
+		Hierarchy.Edges.Append(Edges);
+	}
+	Hierarchy.ClusterBlockerMask.Init(0, NumClusters);
+
+	UE_LOG(LogSeinNavigationAStar, Log,
+		TEXT("Nav: HPA* graph built — %dx%d clusters of %d cells, %d portals, %d edges."),
+		Hierarchy.ClustersX, Hierarchy.ClustersY, S, NumNodes, Hierarchy.Edges.Num());
+}
+
+void USeinNavigationAStar::RefreshHierarchicalBlockerMasks()
+{
+	if (!Hierarchy.IsBuilt()) return;
+	for (const int32 Cluster : Hierarchy.StampedClusters)
+	{
+		Hierarchy.ClusterBlockerMask[Cluster] = 0;
+	}
+	Hierarchy.StampedClusters.Reset();
+	for (const TPair<int32, int32>& Entry : DynamicBlockerIndicesByCell)
+	{
+		const uint8 Mask = DynamicBlockers[Entry.Value].BlockedNavLayerMask;
+		if (Mask == 0) continue;
+		const int32 Cluster = HierarchicalClusterOf(Entry.Key);
+		if (Hierarchy.ClusterBlockerMask[Cluster] == 0)
+		{
+			Hierarchy.StampedClusters.Add(Cluster);
+		}
+		Hierarchy.ClusterBlockerMask[Cluster] |= Mask;
+	}
+}
+
+bool USeinNavigationAStar::FindHierarchicalCellPath(FIntPoint Start, FIntPoint End, uint8 AgentNavLayerMask,
+	int32 HeuristicWeightPercent, int32& InOutIterationBudget, int32 RequiredClearance, FAStarScratch& Scratch) const
+{
+	// Eligibility. Anything outside the plain "long, statically connected,
+	// both ends standing in configuration space" case keeps the flat search so
+	// its partial-path / start-escape / goal carve-out behavior is untouched.
+	if (!bHierarchicalPathfinding
+		|| !Hierarchy.IsBuilt()
+		|| Hierarchy.ClusterSize != FMath::Clamp(HierarchicalClusterSizeCells, 8, 64))
+	{
+		return false;
+	}
+	if (FMath::Max(FMath::Abs(End.X - Start.X), FMath::Abs(End.Y - Start.Y)) <= 2 * Hierarchy.ClusterSize)
+	{
+		return false;
+	}
+	if (!IsValidCoord(Start.X, Start.Y) || !IsValidCoord(End.X, End.Y)
+		|| !IsCellPassableForPath(Start.X, Start.Y, Scratch)
+		|| !IsCellPassableForPath(End.X, End.Y, Scratch))
+	{
+		return false;
+	}
+	const int32 StartCell = CellIndex(Start.X, Start.Y);
+	const int32 EndCell = CellIndex(End.X, End.Y);
+	if (CellComponent[StartCell] < 0 || CellComponent[StartCell] != CellComponent[EndCell]) return false;
+	if (RequiredClearance > 0
+		&& (GetEffectiveWD(Start.X, Start.Y, RequiredClearance, Scratch) < RequiredClearance
+			|| GetEffectiveWD(End.X, End.Y, RequiredClearance, Scratch) < RequiredClearance))
+	{
+		return false;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(Sein_Nav_HierarchicalSearch);
+
+	const int32 S = Hierarchy.ClusterSize;
+	const int32 NumNodes = Hierarchy.NodeCell.Num();
+	const int32 StartNode = NumNodes;
+	const int32 GoalNode = NumNodes + 1;
+	const int32 NumAbstract = NumNodes + 2;
+	const int32 StartCluster = HierarchicalClusterOf(StartCell);
+	const int32 GoalCluster = HierarchicalClusterOf(EndCell);
+
+	if (Scratch.AbstractGCosts.Num() != NumAbstract) Scratch.AbstractGCosts.SetNumUninitialized(NumAbstract);
+	if (Scratch.AbstractParents.Num() != NumAbstract) Scratch.AbstractParents.SetNumUninitialized(NumAbstract);
+	if (Scratch.AbstractClosed.Num() != NumAbstract) Scratch.AbstractClosed.SetNumUninitialized(NumAbstract);
+	if (Scratch.AbstractCellGen.Num() != NumAbstract) Scratch.AbstractCellGen.Init(0, NumAbstract);
+	if (++Scratch.CurrentAbstractGen == 0)
+	{
+		FMemory::Memzero(Scratch.AbstractCellGen.GetData(), NumAbstract * sizeof(uint16));
+		Scratch.CurrentAbstractGen = 1;
+	}
+	const uint16 Gen = Scratch.CurrentAbstractGen;
+
+	auto CellOfNode = [this, StartNode, GoalNode, StartCell, EndCell](int32 Node)
+	{
+		return Node == StartNode ? StartCell : (Node == GoalNode ? EndCell : Hierarchy.NodeCell[Node]);
+	};
+	auto LocalIndex = [this, S](int32 Cluster, int32 Cell)
+	{
+		const int32 X0 = (Cluster % Hierarchy.ClustersX) * S;
+		const int32 Y0 = (Cluster / Hierarchy.ClustersX) * S;
+		return ((Cell / Width) - Y0) * S + ((Cell % Width) - X0);
+	};
+
+	// Goal attachment: one overlay-aware Dijkstra from the goal inside its
+	// cluster. Costs are measured goal→portal; the abstract cost is only a
+	// routing estimate (refinement produces the real chain), so the reversed
+	// terrain weighting is fine.
+	ComputeClusterLocalCosts(GoalCluster, EndCell, &Scratch, Scratch.LocalCosts, Scratch.LocalOpen);
+	{
+		const int32 Begin = Hierarchy.ClusterNodeOffsets[GoalCluster];
+		const int32 EndIdx = Hierarchy.ClusterNodeOffsets[GoalCluster + 1];
+		Scratch.GoalNodeCosts.SetNumUninitialized(EndIdx - Begin);
+		for (int32 i = Begin; i < EndIdx; ++i)
+		{
+			Scratch.GoalNodeCosts[i - Begin] =
+				Scratch.LocalCosts[LocalIndex(GoalCluster, Hierarchy.NodeCell[Hierarchy.ClusterNodes[i]])];
+		}
+	}
+
+	// A portal is usable for this request only if it is open in the overlay
+	// and stands in configuration space; refinement legs then start and end
+	// inside C-space, so AStarSearch's escape/carve-out rules never widen a
+	// squeeze the flat search would refuse.
+	auto IsNodeUsable = [this, &Scratch, RequiredClearance](int32 Cell)
+	{
+		const int32 X = Cell % Width;
+		const int32 Y = Cell / Width;
+		if (!IsCellPassableForPath(X, Y, Scratch)) return false;
+		return RequiredClearance <= 0
+			|| GetEffectiveWD(X, Y, RequiredClearance, Scratch) >= RequiredClearance;
+	};
+
+	const int32 Weight = FMath::Max(HeuristicWeightPercent, 100);
+	int32 Tiebreak = 0;
+	Scratch.AbstractOpen.Reset();
+	auto Relax = [&](int32 FromNode, int32 ToNode, int32 EdgeCost, int32 FromG)
+	{
+		if (Scratch.AbstractCellGen[ToNode] == Gen && Scratch.AbstractClosed[ToNode]) return;
+		const int32 NewG = FromG + EdgeCost;
+		const int32 PrevG = (Scratch.AbstractCellGen[ToNode] == Gen) ? Scratch.AbstractGCosts[ToNode] : INT32_MAX;
+		if (NewG >= PrevG) return;
+		if (ToNode != GoalNode && Scratch.AbstractCellGen[ToNode] != Gen && !IsNodeUsable(CellOfNode(ToNode))) return;
+		Scratch.AbstractGCosts[ToNode] = NewG;
+		Scratch.AbstractParents[ToNode] = FromNode;
+		Scratch.AbstractClosed[ToNode] = 0;
+		Scratch.AbstractCellGen[ToNode] = Gen;
+		const int32 ToCell = CellOfNode(ToNode);
+		const int32 H = OctileHeuristic(ToCell % Width, ToCell / Width, End.X, End.Y);
+		Scratch.AbstractOpen.HeapPush(FAStarNode{ToNode, NewG + (H * Weight) / 100, NewG, Tiebreak++});
+	};
+
+	// Outgoing edges into the goal from a node of the goal cluster.
+	auto RelaxToGoal = [&](int32 FromNode, int32 FromG)
+	{
+		const int32 Begin = Hierarchy.ClusterNodeOffsets[GoalCluster];
+		const int32 EndIdx = Hierarchy.ClusterNodeOffsets[GoalCluster + 1];
+		for (int32 i = Begin; i < EndIdx; ++i)
+		{
+			if (Hierarchy.ClusterNodes[i] != FromNode) continue;
+			const int32 Cost = Scratch.GoalNodeCosts[i - Begin];
+			if (Cost != INT32_MAX) Relax(FromNode, GoalNode, Cost, FromG);
+			return;
+		}
+	};
+
+	// Edges from a cell to every other portal of its cluster, costed live
+	// against this request's overlay — used for the start node and for any
+	// cluster a relevant dynamic blocker stamps.
+	auto RelaxLocal = [&](int32 FromNode, int32 Cluster, int32 FromG)
+	{
+		ComputeClusterLocalCosts(Cluster, CellOfNode(FromNode), &Scratch, Scratch.LocalCosts, Scratch.LocalOpen);
+		for (int32 i = Hierarchy.ClusterNodeOffsets[Cluster]; i < Hierarchy.ClusterNodeOffsets[Cluster + 1]; ++i)
+		{
+			const int32 To = Hierarchy.ClusterNodes[i];
+			if (To == FromNode) continue;
+			const int32 Cost = Scratch.LocalCosts[LocalIndex(Cluster, Hierarchy.NodeCell[To])];
+			if (Cost != INT32_MAX) Relax(FromNode, To, Cost, FromG);
+		}
+		if (Cluster == GoalCluster)
+		{
+			const int32 Cost = Scratch.LocalCosts[LocalIndex(Cluster, EndCell)];
+			if (Cost != INT32_MAX) Relax(FromNode, GoalNode, Cost, FromG);
+		}
+	};
+
+	Scratch.AbstractGCosts[StartNode] = 0;
+	Scratch.AbstractParents[StartNode] = INDEX_NONE;
+	Scratch.AbstractClosed[StartNode] = 0;
+	Scratch.AbstractCellGen[StartNode] = Gen;
+	Scratch.AbstractOpen.HeapPush(FAStarNode{StartNode, 0, 0, Tiebreak++});
+
+	// Abstract expansions and every refinement leg draw on the one budget, so
+	// AgentMaxSearchNodes bounds the whole hierarchical attempt. The caller's
+	// flat fallback has a budget of its own.
+	const int32 IterCap = FMath::Max(InOutIterationBudget, 1);
+	int32 Iterations = 0;
+	bool bReachedGoal = false;
+	while (Scratch.AbstractOpen.Num() > 0)
+	{
+		FAStarNode Cur;
+		Scratch.AbstractOpen.HeapPop(Cur, EAllowShrinking::No);
+		if (Scratch.AbstractClosed[Cur.CellIdx]) continue;
+		Scratch.AbstractClosed[Cur.CellIdx] = 1;
+		if (Cur.CellIdx == GoalNode)
+		{
+			bReachedGoal = true;
+			break;
+		}
+		if (++Iterations >= IterCap) break;
+
+		if (Cur.CellIdx == StartNode)
+		{
+			RelaxLocal(StartNode, StartCluster, Cur.GCost);
+			continue;
+		}
+
+		const int32 Cluster = Hierarchy.NodeCluster[Cur.CellIdx];
+		const bool bStamped = (Hierarchy.ClusterBlockerMask[Cluster] & AgentNavLayerMask) != 0;
+		if (bStamped)
+		{
+			RelaxLocal(Cur.CellIdx, Cluster, Cur.GCost);
+		}
+		else if (Cluster == GoalCluster)
+		{
+			RelaxToGoal(Cur.CellIdx, Cur.GCost);
+		}
+		for (int32 e = Hierarchy.EdgeOffsets[Cur.CellIdx]; e < Hierarchy.EdgeOffsets[Cur.CellIdx + 1]; ++e)
+		{
+			const FHierarchicalEdge& Edge = Hierarchy.Edges[e];
+			if (Edge.bIntraCluster && bStamped) continue; // superseded by the live re-cost above
+			Relax(Cur.CellIdx, Edge.ToNode, Edge.Cost, Cur.GCost);
+		}
+	}
+	InOutIterationBudget = FMath::Max(InOutIterationBudget - Iterations, 0);
+	if (!bReachedGoal)
+	{
+		UE_LOG(LogSeinNavigationAStar, Verbose,
+			TEXT("FindCellPath: HPA* found no abstract route (%d,%d)->(%d,%d) in %d expansions; using flat search."),
+			Start.X, Start.Y, End.X, End.Y, Iterations);
+		return false;
+	}
+
+	Scratch.AbstractWaypoints.Reset();
+	for (int32 Node = GoalNode; Node != INDEX_NONE; Node = Scratch.AbstractParents[Node])
+	{
+		const int32 Cell = CellOfNode(Node);
+		Scratch.AbstractWaypoints.Add(FIntPoint(Cell % Width, Cell / Width));
+	}
+	Algo::Reverse(Scratch.AbstractWaypoints);
+
+	// Refinement: each consecutive pair is a short local AStarSearch. A leg that
+	// comes back partial (clearance, barred terrain, overlay the abstract costs
+	// did not see) abandons the hierarchical answer entirely.
+	Scratch.RefinedCellPath.Reset();
+	for (int32 Leg = 0; Leg + 1 < Scratch.AbstractWaypoints.Num(); ++Leg)
+	{
+		bool bLegPartial = false;
+		AStarSearch(Scratch.AbstractWaypoints[Leg], Scratch.AbstractWaypoints[Leg + 1], bLegPartial,
+			HeuristicWeightPercent, InOutIterationBudget, RequiredClearance, Scratch);
+		if (bLegPartial || Scratch.CellPath.Num() == 0)
+		{
+			UE_LOG(LogSeinNavigationAStar, Verbose,
+				TEXT("FindCellPath: HPA* leg %d (%d,%d)->(%d,%d) did not refine; using flat search."),
+				Leg,
+				Scratch.AbstractWaypoints[Leg].X, Scratch.AbstractWaypoints[Leg].Y,
+				Scratch.AbstractWaypoints[Leg + 1].X, Scratch.AbstractWaypoints[Leg + 1].Y);
+			return false;
+		}
+		const int32 SkipJunction = Scratch.RefinedCellPath.Num() > 0 ? 1 : 0;
+		Scratch.RefinedCellPath.Append(
+			Scratch.CellPath.GetData() + SkipJunction, Scratch.CellPath.Num() - SkipJunction);
+	}
+
+	Swap(Scratch.CellPath, Scratch.RefinedCellPath);
+	return Scratch.CellPath.Num() > 0;
+}
+
+// ============================================================================
+// Shared flow fields (group move orders)
+//
+//   A group request (GroupId != 0) is answered from one field per (goal cell,
+//   clearance profile, blocker layers): a reverse Dijkstra from the goal that
+//   records, per settled cell, its exact cost-to-goal (integration field) and
+//   the first step toward the goal (direction field). The field grows only
+//   until the current member's start settles and resumes where it stopped for
+//   the next member. Dijkstra pops cells in the same order whether it runs in
+//   one go or in pieces, so a path read off the field is a pure function of
+//   the request and the current grid + blockers — lockstep-safe regardless of
+//   what the cache happened to hold.
+//
+//   Growth mutates the cache and runs serially (PrepareFlowField); the per-
+//   member walk (DescendFlowField) is read-only and runs inside the batch.
+// ============================================================================
+
+bool USeinNavigationAStar::MakeFlowFieldKey(
+	const FSeinPathRequest& Request, FFlowFieldKey& OutKey, int32& OutStartCell) const
+{
+	// Lone orders and explicitly budget-capped searches keep the per-agent
+	// planner: a field only pays for itself when several members share it, and
+	// a capped caller asked for a bounded search.
+	if (!bSharedFlowFields || Request.GroupId == 0 || Request.AgentMaxSearchNodes > 0) return false;
+	if (!HasRuntimeData()) return false;
+
+	// The field's overlay is stamped once, without self-exclusion. It equals a
+	// requester's own overlay only when that requester owns no blocker (same
+	// argument as the FindCellPathInternal overlay reuse).
+	for (const FSeinDynamicBlocker& B : DynamicBlockers)
+	{
+		if (B.Owner == Request.Requester) return false;
+	}
+
+	int32 SX, SY, EX, EY;
+	if (!WorldToGrid(Request.Start, SX, SY) || !WorldToGrid(Request.End, EX, EY)) return false;
+
+	FSeinNavAgentProfile Agent;
+	Agent.Requester = Request.Requester;
+	Agent.BlockedTerrainTags = Request.BlockedTerrainTags;
+	Agent.AgentNavLayerMask = Request.AgentNavLayerMask;
+	Agent.AgentFootprintRadius = Request.AgentFootprintRadius;
+	Agent.AgentWallPaddingCells = Request.AgentWallPaddingCells;
+
+	OutKey.GoalCell = CellIndex(EX, EY);
+	OutKey.AgentNavLayerMask = Request.AgentNavLayerMask;
+	OutKey.Profile = MakeReachabilityProfileKey(Agent);
+	OutStartCell = CellIndex(SX, SY);
+	return true;
+}
+
+const USeinNavigationAStar::FFlowFieldCacheEntry*
+USeinNavigationAStar::FindPreparedFlowField(const FSeinPathRequest& Request) const
+{
+	FFlowFieldKey Key;
+	int32 StartCell = INDEX_NONE;
+	if (!MakeFlowFieldKey(Request, Key, StartCell)) return nullptr;
+	for (const TUniquePtr<FFlowFieldCacheEntry>& Entry : FlowFieldCache)
+	{
+		if (Entry->Key == Key)
+		{
+			// Settled cells all passed the C-space gates, so no start check here.
+			const bool bReady = Entry->BuiltRevision == FlowFieldRevision
+				&& Entry->Settled.IsValidIndex(StartCell) && Entry->Settled[StartCell];
+			return bReady ? Entry.Get() : nullptr;
+		}
+	}
+	return nullptr;
+}
+
+const USeinNavigationAStar::FFlowFieldCacheEntry*
+USeinNavigationAStar::PrepareFlowField(const FSeinPathRequest& Request) const
+{
+	SEIN_CHECK_NOT_PARALLEL();
+	FFlowFieldKey Key;
+	int32 StartCell = INDEX_NONE;
+	if (!MakeFlowFieldKey(Request, Key, StartCell)) return nullptr;
+	const int32 SX = StartCell % Width;
+	const int32 SY = StartCell / Width;
+	const int32 EX = Key.GoalCell % Width;
+	const int32 EY = Key.GoalCell / Width;
+
+	FFlowFieldCacheEntry* Field = nullptr;
+	for (const TUniquePtr<FFlowFieldCacheEntry>& Entry : FlowFieldCache)
+	{
+		if (Entry->Key == Key)
+		{
+			Field = Entry.Get();
+			break;
+		}
+	}
+	if (!Field)
+	{
+		Field = FlowFieldCache.Add_GetRef(MakeUnique<FFlowFieldCacheEntry>()).Get();
+		Field->Key = Key;
+	}
+
+	if (Field->BuiltRevision != FlowFieldRevision)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(Sein_Nav_SeedFlowField);
+		const int32 N = Width * Height;
+		Field->BuiltRevision = FlowFieldRevision;
+		Field->Integration.Init(INT32_MAX, N);
+		Field->Direction.Init(0, N);
+		Field->Settled.Init(0, N);
+		Field->Open.Reset();
+		Field->Tiebreak = 0;
+		Field->SettledCount = 0;
+
+		// Overlay + terrain gate + dyn-WD cache exactly as FindCellPathInternal
+		// prepares a request scratch. The overlay is restamped from zero (the
+		// grid stride may have changed since this entry last seeded), and the
+		// dyn-WD cache keeps ONE generation for the field's whole life — every
+		// read uses the key's clearance as MaxR, so the cached distances stay valid.
+		FAStarScratch& FieldScratch = Field->Scratch;
+		FieldScratch.DynamicBlocked.Reset();
+		BuildDynamicBlockedOverlay(Request.Requester, Request.AgentNavLayerMask, FieldScratch);
+		FieldScratch.bRequestHasBlockedTypes = false;
+		if (!Request.BlockedTerrainTags.IsEmpty() && CellTerrainType.Num() == N)
+		{
+			FieldScratch.bRequestHasBlockedTypes =
+				BuildBlockedTerrainTypeLookup(Request.BlockedTerrainTags, FieldScratch.RequestBlockedType);
+		}
+		FieldScratch.DynamicWDCache.SetNumUninitialized(N);
+		FieldScratch.DynamicWDCacheGen.Init(0, N);
+		FieldScratch.CurrentDynamicWDGen = 1;
+
+		// Goal carve-out as in AStarSearch: the goal cell itself only has to be
+		// passable; clearance is demanded of every cell on the approach.
+		if (IsCellPassableForPath(EX, EY, FieldScratch))
+		{
+			Field->Integration[Key.GoalCell] = 0;
+			Field->Open.HeapPush(FAStarNode{Key.GoalCell, 0, 0, Field->Tiebreak++});
+		}
+	}
+
+	// The field lives in configuration space only. A start that isn't inside it
+	// (on a dynamic blocker, squeezed below clearance) needs AStarSearch's
+	// escape rule, so that member plans alone.
+	const int32 Required = Key.Profile.RequiredClearance;
+	if (StartCell != Key.GoalCell)
+	{
+		if (!IsCellPassableForPath(SX, SY, Field->Scratch)) return nullptr;
+		if (Required > 0 && GetEffectiveWD(SX, SY, Required, Field->Scratch) < Required) return nullptr;
+	}
+
+	// Reference: a requester holds one field at a time (its current order).
+	if (Request.Requester.IsValid())
+	{
+		for (const TUniquePtr<FFlowFieldCacheEntry>& Entry : FlowFieldCache)
+		{
+			if (Entry.Get() != Field) Entry->Requesters.RemoveSwap(Request.Requester);
+		}
+		Field->Requesters.AddUnique(Request.Requester);
+	}
+
+	// Exhausted or capped before the start settled: plan alone.
+	return ExpandFlowField(*Field, StartCell) ? Field : nullptr;
+}
+
+bool USeinNavigationAStar::ExpandFlowField(FFlowFieldCacheEntry& Field, int32 UntilCell) const
+{
+	if (Field.Settled[UntilCell]) return true;
+	TRACE_CPUPROFILER_EVENT_SCOPE(Sein_Nav_ExpandFlowField);
+
+	FAStarScratch& FieldScratch = Field.Scratch;
+	const int32 Required = Field.Key.Profile.RequiredClearance;
+	const int32 IterCap = FMath::Max(AStarMaxIterations, 1);
+
+	while (Field.Open.Num() > 0 && Field.SettledCount < IterCap)
+	{
+		FAStarNode Cur;
+		Field.Open.HeapPop(Cur, EAllowShrinking::No);
+		if (Field.Settled[Cur.CellIdx]) continue;
+		Field.Settled[Cur.CellIdx] = 1;
+		++Field.SettledCount;
+
+		const int32 CX = Cur.CellIdx % Width;
+		const int32 CY = Cur.CellIdx / Width;
+
+		// Relax every predecessor P that can step ONTO Cur in direction n. The
+		// gates are AStarSearch's forward gates evaluated at P: connection bit,
+		// passable, P inside C-space (Cur already is, or is the goal), and the
+		// diagonal anti-squeeze on P's two flanking cardinals.
+		for (int32 n = 0; n < 8; ++n)
+		{
+			const int32 PX = CX - SeinNeighborDX[n];
+			const int32 PY = CY - SeinNeighborDY[n];
+			if (!IsValidCoord(PX, PY)) continue;
+			const int32 PIdx = CellIndex(PX, PY);
+			if (Field.Settled[PIdx]) continue;
+
+			const uint8 PConn = CellConnections[PIdx];
+			if ((PConn & (1 << n)) == 0) continue;
+			if (!IsCellPassableForPath(PX, PY, FieldScratch)) continue;
+			if (Required > 0 && GetEffectiveWD(PX, PY, Required, FieldScratch) < Required) continue;
+
+			if (n >= 4)
+			{
+				const uint8 AIdx = SeinDiagCardinalA[n - 4];
+				const uint8 BIdx = SeinDiagCardinalB[n - 4];
+				if ((PConn & (1 << AIdx)) == 0 || (PConn & (1 << BIdx)) == 0) continue;
+				if (Required > 0)
+				{
+					const int32 CardAX = PX + SeinNeighborDX[AIdx];
+					const int32 CardAY = PY + SeinNeighborDY[AIdx];
+					const int32 CardBX = PX + SeinNeighborDX[BIdx];
+					const int32 CardBY = PY + SeinNeighborDY[BIdx];
+					if (IsValidCoord(CardAX, CardAY) && IsValidCoord(CardBX, CardBY))
+					{
+						if (GetEffectiveWD(CardAX, CardAY, Required, FieldScratch) < Required
+							|| GetEffectiveWD(CardBX, CardBY, Required, FieldScratch) < Required) continue;
+					}
+				}
+			}
+
+			// Forward step cost P→Cur, identical to AStarSearch's.
+			const int32 NewG = Cur.GCost + SeinNeighborCost[n] * CellCost[Cur.CellIdx];
+			if (NewG >= Field.Integration[PIdx]) continue;
+			Field.Integration[PIdx] = NewG;
+			Field.Direction[PIdx] = static_cast<uint8>(n);
+			Field.Open.HeapPush(FAStarNode{PIdx, NewG, NewG, Field.Tiebreak++});
+		}
+
+		if (Cur.CellIdx == UntilCell) return true;
+	}
+	return false;
+}
+
+bool USeinNavigationAStar::DescendFlowField(const FFlowFieldCacheEntry& Field, FIntPoint Start, FAStarScratch& Scratch) const
+{
+	Scratch.CellPath.Reset();
+	if (!IsValidCoord(Start.X, Start.Y)) return false;
+	int32 CurIdx = CellIndex(Start.X, Start.Y);
+	// Unsettled after PrepareFlowField ⇒ the field is exhausted (Start is not
+	// connected to the goal under this profile) or hit its iteration cap; the
+	// caller plans alone.
+	if (!Field.Settled.IsValidIndex(CurIdx) || !Field.Settled[CurIdx]) return false;
+
+	// Direction pointers form a tree rooted at the goal (each was written from
+	// an already-settled cell), so the walk always terminates there.
+	Scratch.CellPath.Add(Start);
+	while (CurIdx != Field.Key.GoalCell)
+	{
+		const uint8 Dir = Field.Direction[CurIdx];
+		const int32 NX = (CurIdx % Width) + SeinNeighborDX[Dir];
+		const int32 NY = (CurIdx / Width) + SeinNeighborDY[Dir];
+		CurIdx = CellIndex(NX, NY);
+		Scratch.CellPath.Add(FIntPoint(NX, NY));
+	}
+	return true;
+}
+
+void USeinNavigationAStar::TrimFlowFieldCache() const
+{
+	SEIN_CHECK_NOT_PARALLEL();
+	const USeinARTSCoreSettings* Settings = GetDefault<USeinARTSCoreSettings>();
+	const int32 CacheCapacity = FMath::Clamp(
+		Settings ? Settings->NavFlowFieldCacheCapacity : 4, 1, 32);
+	while (FlowFieldCache.Num() > CacheCapacity)
+	{
+		// Oldest unreferenced field first; if every field is still in use, the
+		// oldest overall (result-neutral — it regrows identically on next use).
+		const int32 Unreferenced = FlowFieldCache.IndexOfByPredicate(
+			[](const TUniquePtr<FFlowFieldCacheEntry>& Entry) { return Entry->Requesters.Num() == 0; });
+		FlowFieldCache.RemoveAt(Unreferenced != INDEX_NONE ? Unreferenced : 0, 1, EAllowShrinking::No);
+	}
+}
+
+void USeinNavigationAStar::ReleasePathRequester(FSeinEntityHandle Requester) const
+{
+	SEIN_CHECK_NOT_PARALLEL();
+	for (const TUniquePtr<FFlowFieldCacheEntry>& Entry : FlowFieldCache)
+	{
+		Entry->Requesters.RemoveSwap(Requester);
+	}
+}
+
 // ============================================================================
 // Path smoothing (line-of-sight string-pull)
 // ============================================================================
@@ -2932,29 +3753,27 @@ bool USeinNavigationAStar::FindCellPath(const FSeinPathRequest& Request, FSeinPa
 	// persistent MainScratch, whose buffers survive across calls exactly as the
 	// old mutable members did (byte-identical serial behavior). The Scratch-
 	// taking helper is what a future parallel batch calls with per-worker scratch.
-	return FindCellPathInternal(Request, OutPath, MainScratch);
+	// Group requests grow their shared flow field first (serial, cache-mutating).
+	const FFlowFieldCacheEntry* FlowField = PrepareFlowField(Request);
+	const bool bFound = FindCellPathInternal(Request, OutPath, MainScratch, FlowField);
+	TrimFlowFieldCache();
+	return bFound;
 }
 
 FFixedVector USeinNavigationAStar::QueryDirection(const FSeinDirectionQuery& Query) const
 {
 	// Obstacle-aware "which way": route From→Goal and return the heading to the first
 	// waypoint past the start. The pull-equivalent of FindPath for this route-shaped nav.
-	// (A field-shaped nav would override to sample a precomputed field instead — far
-	// cheaper to poll per tick.) Falls back to the base straight-line on no data / no path.
+	// A group query (GroupId != 0) walks the shared flow field PrepareDirectionQuery grew,
+	// so polling it per member is a field walk, not a search. Only looks the field up:
+	// Blueprint and presentation reach this, and must not move the cache. Falls back to
+	// the base straight-line on no data / no path.
 	if (!HasRuntimeData()) return Super::QueryDirection(Query);
 
-	FSeinPathRequest Req;
-	Req.Start                = Query.From;
-	Req.End                  = Query.Goal;
-	Req.Requester            = Query.Requester;
-	Req.BlockedTerrainTags   = Query.BlockedTerrainTags;
-	Req.AgentNavLayerMask    = Query.AgentNavLayerMask;
-	Req.AgentFootprintRadius = Query.AgentFootprintRadius;
-	Req.AgentWallPaddingCells = Query.AgentWallPaddingCells;
-	Req.GroupId              = Query.GroupId;
-
+	const FSeinPathRequest Req = MakeDirectionPathRequest(Query);
 	FSeinPath Path;
-	if (FindCellPath(Req, Path) && Path.Waypoints.Num() >= 2)
+	if (FindCellPathInternal(Req, Path, MainScratch, FindPreparedFlowField(Req))
+		&& Path.Waypoints.Num() >= 2)
 	{
 		FFixedVector Delta = Path.Waypoints[1] - Query.From;
 		Delta.Z = FFixedPoint::Zero;
@@ -2966,7 +3785,16 @@ FFixedVector USeinNavigationAStar::QueryDirection(const FSeinDirectionQuery& Que
 	return Super::QueryDirection(Query);
 }
 
-bool USeinNavigationAStar::FindCellPathInternal(const FSeinPathRequest& Request, FSeinPath& OutPath, FAStarScratch& Scratch) const
+void USeinNavigationAStar::PrepareDirectionQuery(const FSeinDirectionQuery& Query) const
+{
+	if (!HasRuntimeData()) return;
+	// Trim first, so the field this grows is still cached when the query reads it.
+	TrimFlowFieldCache();
+	PrepareFlowField(MakeDirectionPathRequest(Query));
+}
+
+bool USeinNavigationAStar::FindCellPathInternal(const FSeinPathRequest& Request, FSeinPath& OutPath, FAStarScratch& Scratch,
+	const FFlowFieldCacheEntry* FlowField) const
 {
 	OutPath.Clear();
 	if (!HasRuntimeData()) return false;
@@ -3133,9 +3961,28 @@ bool USeinNavigationAStar::FindCellPathInternal(const FSeinPathRequest& Request,
 	// IsReachable at command-validation time, before FindPath is ever called.
 	// So FindPath itself stays permissive: MoveToAction's contract is to get
 	// somewhere sensible along the way to the click.
+	//
+	// Group requests whose start PrepareFlowField settled walk the shared flow
+	// field instead of searching (a complete, shortest chain by construction).
+	// Otherwise long requests try the hierarchical route first
+	// (FindHierarchicalCellPath): it only answers with a COMPLETE chain, and
+	// anything it can't deliver runs the flat search below unchanged.
+	//
+	// Each stage gets MaxIters of its own. The hierarchical attempt charges its
+	// abstract search and every refinement leg to one budget; the flat
+	// fallback starts from a fresh MaxIters, so a failed hierarchical attempt
+	// never shortens it and its partial-path results match a flat-only search.
 	bool bPartial = false;
-	AStarSearch(FIntPoint(SX, SY), FIntPoint(EX, EY), bPartial,
-		HeuristicWeight, MaxIters, RequiredClearance, Scratch);
+	int32 HierarchicalBudget = MaxIters;
+	int32 FlatBudget = MaxIters;
+	const bool bFromFlowField = FlowField
+		&& DescendFlowField(*FlowField, FIntPoint(SX, SY), Scratch);
+	if (!bFromFlowField && !FindHierarchicalCellPath(FIntPoint(SX, SY), FIntPoint(EX, EY), Request.AgentNavLayerMask,
+		HeuristicWeight, HierarchicalBudget, RequiredClearance, Scratch))
+	{
+		AStarSearch(FIntPoint(SX, SY), FIntPoint(EX, EY), bPartial,
+			HeuristicWeight, FlatBudget, RequiredClearance, Scratch);
+	}
 	// AStarSearch fills the pooled Scratch.CellPath in place (no by-value return).
 	// Alias it for the smoothing + diagnostics below; the buffer's lifetime is the
 	// scratch's, so the const-ref stays valid for the rest of this call.
@@ -3223,10 +4070,14 @@ bool USeinNavigationAStar::FindPath(const FSeinPathRequest& Request, FSeinPath&
 {
 	// Serial entry: the whole pipeline runs through the persistent MainScratch
 	// (its buffers survive across calls exactly as the pre-refactor mutable members).
-	return FindPathInternal(Request, OutPath, MainScratch);
+	const FFlowFieldCacheEntry* FlowField = PrepareFlowField(Request);
+	const bool bFound = FindPathInternal(Request, OutPath, MainScratch, FlowField);
+	TrimFlowFieldCache();
+	return bFound;
 }
 
-bool USeinNavigationAStar::FindPathInternal(const FSeinPathRequest& Request, FSeinPath& OutPath, FAStarScratch& Scratch) const
+bool USeinNavigationAStar::FindPathInternal(const FSeinPathRequest& Request, FSeinPath& OutPath, FAStarScratch& Scratch,
+	const FFlowFieldCacheEntry* FlowField) const
 {
 	FSeinNavAgentProfile RequestAgent;
 	RequestAgent.Requester = Request.Requester;
@@ -3256,7 +4107,7 @@ bool USeinNavigationAStar::FindPathInternal(const FSeinPathRequest& Request, FSe
 	// wall-push + post-validation diagnostics below read that SAME live scratch
 	// state (the overlay must still reflect this request's blockers). Byte-identical
 	// to the pre-refactor flow where all three stages shared the mutable members.
-	if (!FindCellPathInternal(Request, OutPath, Scratch)) return false;
+	if (!FindCellPathInternal(Request, OutPath, Scratch, FlowField)) return false;
 
 	if (Request.AgentFootprintRadius > FFixedPoint::Zero || Request.AgentWallPaddingCells > 0)
 	{
@@ -3294,6 +4145,17 @@ void USeinNavigationAStar::RunPathBatch(const TArray<FSeinPathRequest>& Requests
 	OutResults.SetNum(N);
 	if (N == 0) return;
 
+	// Grow every group member's shared flow field up front, serially and in
+	// request order — the only cache-mutating step. A 60-unit order to one spot
+	// becomes one field growth here plus 60 read-only walks below. Nothing is
+	// evicted until the batch is done, so these pointers stay valid.
+	TArray<const FFlowFieldCacheEntry*> FlowFields;
+	FlowFields.SetNumZeroed(N);
+	for (int32 i = 0; i < N; ++i)
+	{
+		FlowFields[i] = PrepareFlowField(Requests[i]);
+	}
+
 	// Serial when parallelism is off or the batch is a single search (dispatch
 	// overhead beats the win). Serial runs through the persistent MainScratch, so
 	// the result is byte-identical to the inline FindPath path.
@@ -3301,8 +4163,9 @@ void USeinNavigationAStar::RunPathBatch(const TArray<FSeinPathRequest>& Requests
 	{
 		for (int32 i = 0; i < N; ++i)
 		{
-			FindPathInternal(Requests[i], OutResults[i], MainScratch);
+			FindPathInternal(Requests[i], OutResults[i], MainScratch, FlowFields[i]);
 		}
+		TrimFlowFieldCache();
 		return;
 	}
 
@@ -3316,13 +4179,14 @@ void USeinNavigationAStar::RunPathBatch(const TArray<FSeinPathRequest>& Requests
 	SeinSetInParallelSection(true);
 #endif
 	TArray<FAStarScratch> Contexts;
-	ParallelForWithTaskContext(Contexts, N, [this, &Requests, &OutResults](FAStarScratch& Scratch, int32 Index)
+	ParallelForWithTaskContext(Contexts, N, [this, &Requests, &OutResults, &FlowFields](FAStarScratch& Scratch, int32 Index)
 	{
-		FindPathInternal(Requests[Index], OutResults[Index], Scratch);
+		FindPathInternal(Requests[Index], OutResults[Index], Scratch, FlowFields[Index]);
 	});
 #if !UE_BUILD_SHIPPING
 	SeinSetInParallelSection(false);
 #endif
+	TrimFlowFieldCache();
 }
 
 void USeinNavigationAStar::PushWaypointsAwayFromWalls(
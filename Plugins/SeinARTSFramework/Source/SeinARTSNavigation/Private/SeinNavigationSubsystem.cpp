@@ -1204,6 +1204,10 @@ void USeinNavigationSubsystem::CancelPathRequest(
 	{
 		MarkCanonicalStateDirty();
 	}
+	if (Navigation)
+	{
+		Navigation->ReleasePathRequester(Requester);
+	}
 }
 
 bool USeinNavigationSubsystem::PathRequestIdentityMatches(const FSeinPathRequest& A, const FSeinPathRequest& B)
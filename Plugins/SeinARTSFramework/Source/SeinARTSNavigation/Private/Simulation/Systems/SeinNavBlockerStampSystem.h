@@ -50,6 +50,10 @@
  * compares the ordered values and retains its overlay for an identical list.
  * This keeps the producer neutral and prevents pose bucketing or shape-count
  * shortcuts from hiding a real rasterized-cell change.
+ *
+ * The push broadcasts OnNavigationMutated to debug presentation, so the system
+ * declares game-thread affinity and runs inline while its wave's other members
+ * run on workers.
  */
 class FSeinNavBlockerStampSystem final : public ISeinSystem
 {
@@ -171,7 +175,12 @@ public:
 			ESeinTickPhase::PreTick,
 			SeinSystemPriority::NavBlockerStamp,
 			{FName(TEXT(
-				"seinarts.navigation/async-path-continuation"))});
+				"seinarts.navigation/async-path-continuation"))})
+			.WithAccess(FSeinSystemAccess::Declared()
+				.ReadsComponent(FSeinExtentsComponent::StaticStruct())
+				.ReadsComponent(FSeinNavigationComponent::StaticStruct())
+				.ReadsShared(ESeinSystemSharedState::EntityTransforms)
+				.OnGameThread());
 	}
 
 private:
@@ -45,7 +45,8 @@ public:
 	 *  head this tick (zero = stop / arrived / no route). Field-based navigation (flow fields) answers this
 	 *  cheaply every tick; the shipped grid nav answers by routing and returning the first step (so for the
 	 *  grid nav, prefer Find Path for ordinary movement). Group Id lets a shared-field nav reuse one field
-	 *  for an ordered group (0 = lone unit). */
+	 *  for an ordered group (0 = lone unit). Read-only: it samples a group's field only once the
+	 *  simulation has grown it, and never builds one itself. */
 	UFUNCTION(BlueprintCallable, Category = "SeinARTS|Navigation",
 		meta = (WorldContext = "WorldContextObject", DisplayName = "Query Nav Direction", AdvancedDisplay = "GroupId"))
 	static FFixedVector SeinQueryNavDirection(
@@ -251,6 +251,14 @@ public:
 		}
 	}
 
+	/** Requester no longer needs any planning state shared on its behalf (its
+	 *  move ended or was cancelled). Navs that share work across a group — a
+	 *  reference-counted flow field, a cached abstract route — drop its
+	 *  reference here. Purely a cache-lifetime hint: must never change a later
+	 *  path answer. USeinNavigationSubsystem::CancelPathRequest forwards it.
+	 *  Default: no-op. */
+	virtual void ReleasePathRequester(FSeinEntityHandle Requester) const {}
+
 	/** Cell-level path query — pure 2D pathfinding on the clearance grid.
 	 *  Output is a cell-aware polyline: smoothed (LoS-collapsed) and
 	 *  segment-derived as straight segments. Used directly by movement
@@ -283,6 +291,13 @@ public:
 	 *  nav answers SOMETHING; override for obstacle-aware or field-based direction. */
 	virtual FFixedVector QueryDirection(const FSeinDirectionQuery& Query) const;
 
+	/** Sim systems only, before QueryDirection: grow whatever shared planning state a
+	 *  group query reads (a flow field), so the answer does not depend on what the cache
+	 *  happened to hold. QueryDirection itself stays read-only and safe to call from
+	 *  Blueprint and presentation; without a prepare, a group query may plan alone.
+	 *  Default: no-op. */
+	virtual void PrepareDirectionQuery(const FSeinDirectionQuery& Query) const {}
+
 	/** Legacy tag-only reachability seam. The tags describe the agent's
 	 *  capabilities/classification for custom navigation implementations; they
 	 *  are not terrain exclusions. The default forwards to the complete-profile
@@ -49,7 +49,9 @@ namespace UE::SeinARTSTests
  * Sein.Sim.Parallel is on, each worker gets its own scratch so results stay identical to the serial
  * path. Participates in the unified level-data bake as the "Nav" layer provider: it reproduces
  * per-cell cost and connectivity from the shared level substrate and loads its runtime grid from that
- * baked channel.
+ * baked channel. Long orders go through a HIERARCHICAL (HPA*) pass first: the grid is cut into square
+ * clusters joined by border portals, the route is planned across that coarse graph, and each leg is
+ * refined with the cell search above.
  */
 UCLASS(Blueprintable, BlueprintType, meta = (DisplayName = "Sein Nav (A*)"))
 class SEINARTSNAVIGATION_API USeinNavigationAStar : public USeinNavigation, public ISeinLevelLayerProvider
@@ -168,6 +170,27 @@ private:
 		 *  TArray-by-value return; per-worker on the parallel batch path, so
 		 *  concurrent searches never share it. */
 		TArray<FIntPoint> CellPath;
+
+		// Hierarchical (HPA*) search state. The abstract arrays are sized to the
+		// portal graph (+2 for the per-request start/goal nodes) and gen-tagged
+		// exactly like the cell search arrays above. LocalCosts/LocalOpen are the
+		// cluster-bounded Dijkstra workspace used to attach the endpoints and to
+		// re-cost blocker-stamped clusters. Per-scratch for reentrancy.
+		TArray<int32> AbstractGCosts;
+		TArray<int32> AbstractParents;
+		TArray<uint8> AbstractClosed;
+		TArray<uint16> AbstractCellGen;
+		uint16 CurrentAbstractGen = 0;
+		TArray<FAStarNode> AbstractOpen;
+		TArray<int32> LocalCosts;
+		TArray<FAStarNode> LocalOpen;
+		TArray<int32> GoalNodeCosts;
+
+		/** Abstract route (start, portal cells, goal) and the refined cell chain
+		 *  stitched from its legs. Swapped into CellPath on success so both
+		 *  buffers keep their allocation across searches. */
+		TArray<FIntPoint> AbstractWaypoints;
+		TArray<FIntPoint> RefinedCellPath;
 	};
 
 	/** Persistent scratch for the serial (single-threaded) path. The virtual
@@ -176,6 +199,9 @@ private:
 	 *  byte-identical. Mutable because the search methods are `const`. */
 	mutable FAStarScratch MainScratch;
 
+	/** Shared group flow field (defined with the other derived caches below). */
+	struct FFlowFieldCacheEntry;
+
 public:
 
 	// ----------------------------------------------------------------------
@@ -224,6 +250,8 @@ public:
 	/** Hard cap on how much work one path search may do — the planner's patience limit. A* explores
 	 *  cells one at a time; once it has expanded this many it gives up and returns the best partial
 	 *  path it found (the closest-to-goal cell reached), the same as for a genuinely unreachable goal.
+	 *  Applied per stage: the hierarchical attempt (search plus refinement) gets this many, and a flat
+	 *  fallback after it gets this many again.
 	 *  Default 10000 covers any legitimate path on a 1 square-km map at 100 cm cells. Raise it (50000
 	 *  and up) for very large maps or fine grids; lower it for a tighter bound on huge maps with many
 	 *  unreachable clicks. */
@@ -231,6 +259,38 @@ public:
 		meta = (DisplayName = "A* Max Iterations", ClampMin = "256", ClampMax = "1000000", UIMin = "1000", UIMax = "100000"))
 	int32 AStarMaxIterations = 10000;
 
+	/** Plan long orders on a coarse map first. The grid is cut into square clusters joined by portal
+	 *  cells on their shared borders; a long path is first routed portal-to-portal across that small
+	 *  graph, then each leg is filled in by the ordinary cell search. A cross-map order then costs a
+	 *  handful of short local searches instead of one search that can burn the whole A* Max Iterations
+	 *  budget and come back partial. Only used when start and goal are more than two clusters apart;
+	 *  anything the coarse route can't deliver as a complete path (tight squeezes for big footprints,
+	 *  blocked terrain, a dynamic blocker sealing a portal) falls back to the flat search. Routes can
+	 *  differ slightly from the flat search's (portals sit at the widest point of each border opening). */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "SeinARTS",
+		meta = (DisplayName = "Hierarchical Pathfinding (HPA*)"))
+	bool bHierarchicalPathfinding = true;
+
+	/** Side length, in cells, of one hierarchical-pathfinding cluster. Smaller clusters make the coarse
+	 *  map bigger but its legs shorter; larger clusters do the opposite. Default 16 suits 100 cm cells
+	 *  on maps up to 1 square km. Applied when the grid loads. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "SeinARTS",
+		meta = (DisplayName = "HPA* Cluster Size (cells)", ClampMin = "8", ClampMax = "64", UIMin = "8", UIMax = "32",
+			EditCondition = "bHierarchicalPathfinding"))
+	int32 HierarchicalClusterSizeCells = 16;
+
+	/** Plan group move orders once instead of once per unit. When several units are ordered to the same
+	 *  spot, the first request floods one cost-to-goal field outward from the destination cell and every
+	 *  member of the order then just walks downhill on it, so a 60-unit order costs one search plus 60
+	 *  cheap walks rather than 60 full searches. Fields are shared by destination cell and unit clearance
+	 *  profile (footprint, wall padding, forbidden terrain, blocker layers), are rebuilt when dynamic
+	 *  blockers change, and grow only as far as the farthest member needs. Units that can't use a field
+	 *  (lone orders, a capped search budget, a start too tight for the unit's body) path individually.
+	 *  Group routes are true shortest paths, so they can differ slightly from a lone unit's route. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "SeinARTS",
+		meta = (DisplayName = "Shared Flow Fields For Group Orders"))
+	bool bSharedFlowFields = true;
+
 	// ----------------------------------------------------------------------
 	// USeinNavigation overrides
 	// ----------------------------------------------------------------------
@@ -248,17 +308,26 @@ public:
 
 	/** Obstacle-aware "which way from here": routes From→Goal (cell path) and returns the
 	 *  heading to the first waypoint past the start. This is the PULL-equivalent of FindPath
-	 *  for the shipped route-shaped nav — note it runs a search per call, so route-shaped
-	 *  movement should consume the PATH api, not poll this every tick; the seam exists so a
-	 *  FIELD-shaped nav can answer cheaply. Falls back to the base straight-line on no path. */
+	 *  for the shipped route-shaped nav. A lone query runs a search per call, so route-shaped
+	 *  movement should consume the PATH api, not poll this every tick; a group query
+	 *  (GroupId != 0) samples the order's shared flow field instead (see bSharedFlowFields),
+	 *  once PrepareDirectionQuery has grown it. Read-only: never grows, evicts or references
+	 *  a field. Falls back to the base straight-line on no path. */
 	virtual FFixedVector QueryDirection(const FSeinDirectionQuery& Query) const override;
 
+	/** Grow the group query's shared flow field until Query.From settles, as FindPath does
+	 *  for a group request. */
+	virtual void PrepareDirectionQuery(const FSeinDirectionQuery& Query) const override;
+
 	/** Run a batch of path requests, parallelized across worker threads when
 	 *  Sein.Sim.Parallel is on — each worker gets its own FAStarScratch, so the
 	 *  searches run race-free and each result is identical to the serial path.
 	 *  Falls back to a serial MainScratch loop when parallelism is off / N==1. */
 	virtual void RunPathBatch(const TArray<FSeinPathRequest>& Requests, TArray<FSeinPath>& OutResults) const override;
 
+	/** Drop Requester's reference on the shared flow field it was last served from. */
+	virtual void ReleasePathRequester(FSeinEntityHandle Requester) const override;
+
 private:
 	/** Reentrant body of FindCellPath. The virtual override is a thin wrapper
 	 *  that forwards `MainScratch`; this helper takes the per-search scratch
@@ -266,12 +335,14 @@ private:
 	 *  each with its own FAStarScratch. Serial behavior is byte-identical to
 	 *  the pre-refactor member-scratch version (MainScratch's arrays persist
 	 *  across calls exactly as the old mutable members did). */
-	bool FindCellPathInternal(const FSeinPathRequest& Request, FSeinPath& OutPath, FAStarScratch& Scratch) const;
+	bool FindCellPathInternal(const FSeinPathRequest& Request, FSeinPath& OutPath, FAStarScratch& Scratch,
+		const FFlowFieldCacheEntry* FlowField = nullptr) const;
 
 	/** Reentrant body of FindPath (cell A* + wall-push + post-validation) operating
 	 *  on the supplied scratch. The virtual FindPath passes MainScratch; RunPathBatch's
 	 *  parallel path passes a per-worker scratch so concurrent searches don't collide. */
-	bool FindPathInternal(const FSeinPathRequest& Request, FSeinPath& OutPath, FAStarScratch& Scratch) const;
+	bool FindPathInternal(const FSeinPathRequest& Request, FSeinPath& OutPath, FAStarScratch& Scratch,
+		const FFlowFieldCacheEntry* FlowField = nullptr) const;
 
 public:
 	virtual bool IsReachable(const FFixedVector& From, const FFixedVector& To, const FGameplayTagContainer& AgentTags) const override;
@@ -529,6 +600,95 @@ private:
 	};
 	mutable TArray<FReachabilityProfileCacheEntry> ReachabilityProfileCache;
 
+	/** One outgoing abstract edge. Inter-cluster edges are the single step
+	 *  across a border portal; intra-cluster edges are the static, zero-
+	 *  clearance cost between two portals of the same cluster. */
+	struct FHierarchicalEdge
+	{
+		int32 ToNode = INDEX_NONE;
+		int32 Cost = 0;
+		bool bIntraCluster = false;
+	};
+
+	/** HPA* abstraction over the static grid, derived at grid load alongside
+	 *  CellComponent (`RebuildHierarchicalGraph`). Nodes are portal cells —
+	 *  one per maximal open run on each cluster border, placed at the run's
+	 *  widest point — stored with CSR adjacency so a search walks flat arrays.
+	 *
+	 *  ClusterBlockerMask is the only part that tracks dynamic state: the OR of
+	 *  BlockedNavLayerMask over every blocker stamping a cell of that cluster.
+	 *  A search re-costs only the clusters whose mask intersects its agent's
+	 *  layer and reuses the cached static edges everywhere else.
+	 *
+	 *  Runtime-only — a pure function of CellCost / CellConnections /
+	 *  WallDistance and the cluster size, so it is never serialized and adds
+	 *  nothing to the static grid digest. */
+	struct FHierarchicalGraph
+	{
+		int32 ClusterSize = 0;
+		int32 ClustersX = 0;
+		int32 ClustersY = 0;
+		TArray<int32> NodeCell;
+		TArray<int32> NodeCluster;
+		TArray<int32> ClusterNodeOffsets;
+		TArray<int32> ClusterNodes;
+		TArray<int32> EdgeOffsets;
+		TArray<FHierarchicalEdge> Edges;
+		TArray<uint8> ClusterBlockerMask;
+		TArray<int32> StampedClusters;
+
+		bool IsBuilt() const { return ClusterSize > 0 && NodeCell.Num() > 0; }
+		void Reset() { *this = FHierarchicalGraph(); }
+	};
+	FHierarchicalGraph Hierarchy;
+
+	/** Shared flow-field identity: goal cell + static agent topology + the
+	 *  blocker layers its overlay was stamped for. Requester and GroupId are
+	 *  deliberately absent so two orders to the same spot share one field. */
+	struct FFlowFieldKey
+	{
+		int32 GoalCell = INDEX_NONE;
+		uint8 AgentNavLayerMask = 0;
+		FReachabilityProfileKey Profile;
+
+		bool operator==(const FFlowFieldKey& Other) const
+		{
+			return GoalCell == Other.GoalCell
+				&& AgentNavLayerMask == Other.AgentNavLayerMask
+				&& Profile == Other.Profile;
+		}
+	};
+
+	/** One integration + direction field, grown by a resumable reverse
+	 *  Dijkstra from the goal cell. A settled cell's Integration is its exact
+	 *  cost-to-goal and its Direction the step toward the goal, so the field's
+	 *  answers never depend on how far it had grown when it was asked — a
+	 *  cache miss or eviction can only cost a rebuild, never change a path.
+	 *  Scratch holds the field's shared dynamic overlay and terrain gate.
+	 *  Requesters is the reference count: units whose last path came from
+	 *  this field, released through ReleasePathRequester. */
+	struct FFlowFieldCacheEntry
+	{
+		FFlowFieldKey Key;
+		uint64 BuiltRevision = 0;
+		TArray<int32> Integration;
+		TArray<uint8> Direction;
+		TArray<uint8> Settled;
+		TArray<FAStarNode> Open;
+		int32 Tiebreak = 0;
+		/** Cells settled since the field was seeded; growth stops at
+		 *  AStarMaxIterations. */
+		int32 SettledCount = 0;
+		FAStarScratch Scratch;
+		TArray<FSeinEntityHandle> Requesters;
+	};
+	mutable TArray<TUniquePtr<FFlowFieldCacheEntry>> FlowFieldCache;
+
+	/** Bumped whenever the grid or the dynamic blocker set changes; a field
+	 *  built at an older revision (a fresh entry holds 0) is regrown from its
+	 *  goal before use. */
+	uint64 FlowFieldRevision = 1;
+
 	/** Runtime list of dynamic blockers, refreshed each PreTick by the
 	 *  nav-blocker stamping system. FindPath rebuilds the per-call
 	 *  DynamicBlocked overlay from this list (excluding the requester so
@@ -570,6 +730,10 @@ protected:
 		const TSet<FSeinEntityHandle>* IgnoredDynamicBlockerOwners = nullptr) const;
 	void RebuildDynamicBlockerCellIndex();
 
+	/** Re-derive ClusterBlockerMask from DynamicBlockerIndicesByCell. Clears
+	 *  only the clusters stamped last time, then marks the ones stamped now. */
+	void RefreshHierarchicalBlockerMasks();
+
 	bool IsWorldPositionClearForAgentIgnoringDynamicBlockers(
 		const FFixedVector& WorldPos,
 		const FSeinNavAgentProfile& Agent,
@@ -773,14 +937,16 @@ protected:
 	 *
 	 *  HeuristicWeightPercent: f(n) = g(n) + (h(n) * Weight) / 100. Values
 	 *    >100 produce weighted A* (suboptimal but faster). 100 = admissible.
-	 *  MaxIterations: hard cap on node expansions.
+	 *  InOutIterationBudget: hard cap on node expansions; the expansions this
+	 *    call spends are subtracted from it, so stages of one request can share
+	 *    a single budget.
 	 *
 	 *  The reconstructed cell chain is written into `Scratch.CellPath` (filled via
 	 *  Reset, not realloc — pooled across calls); empty there means no path /
 	 *  invalid start. The caller reads `Scratch.CellPath` after the call.
 	 */
 	void AStarSearch(FIntPoint Start, FIntPoint End, bool& bOutPartial,
-		int32 HeuristicWeightPercent, int32 MaxIterations, int32 RequiredClearance, FAStarScratch& Scratch) const;
+		int32 HeuristicWeightPercent, int32& InOutIterationBudget, int32 RequiredClearance, FAStarScratch& Scratch) const;
 
 	/** Constant used to mark cells as "no nearby wall" in WallDistance. Sets
 	 *  the maximum BFS expansion radius: any cell further than this many
@@ -805,6 +971,72 @@ protected:
 	 *  a guaranteed result on sparse maps). */
 	static constexpr int32 RandomReachableMaxAttempts = 32;
 
+	/** Cluster index owning grid cell `CellIdx` in the current Hierarchy. */
+	FORCEINLINE int32 HierarchicalClusterOf(int32 CellIdx) const
+	{
+		return ((CellIdx % Width) / Hierarchy.ClusterSize)
+			+ ((CellIdx / Width) / Hierarchy.ClusterSize) * Hierarchy.ClustersX;
+	}
+
+	/** Cluster-bounded Dijkstra from `SourceCell` over the zero-clearance edge
+	 *  relation A* uses (connection bit + passable neighbour + diagonal
+	 *  anti-squeeze). `RequestScratch` null = static passability (graph build);
+	 *  non-null = that request's dynamic overlay and terrain gate. OutCosts is
+	 *  indexed by cluster-local cell (INT32_MAX = unreached). */
+	void ComputeClusterLocalCosts(
+		int32 ClusterIdx,
+		int32 SourceCell,
+		const FAStarScratch* RequestScratch,
+		TArray<int32>& OutCosts,
+		TArray<FAStarNode>& Open) const;
+
+	/** Rebuild the HPA* cluster/portal graph. Run once at LoadFromSubstrate
+	 *  after RebuildWallDistanceField (portal placement reads clearance). */
+	void RebuildHierarchicalGraph();
+
+	/** HPA* front end for FindCellPathInternal: abstract search across the
+	 *  portal graph, then per-leg AStarSearch refinement. Returns true only
+	 *  with a COMPLETE chain Start→End in `Scratch.CellPath`; false means
+	 *  "not eligible or not deliverable" and the caller runs the flat search,
+	 *  so partial-path semantics are unchanged. Abstract expansions and every
+	 *  leg are charged to InOutIterationBudget; the caller gives the flat
+	 *  fallback a fresh budget of its own. */
+	bool FindHierarchicalCellPath(FIntPoint Start, FIntPoint End, uint8 AgentNavLayerMask,
+		int32 HeuristicWeightPercent, int32& InOutIterationBudget, int32 RequiredClearance, FAStarScratch& Scratch) const;
+
+	/** Serial (game-thread) half of the shared flow-field path: find or create
+	 *  the field for a group request and grow it until the request's start cell
+	 *  is settled or the field is exhausted. Returns null when the request is
+	 *  not eligible (lone order, capped search, requester owns a blocker, start
+	 *  outside the field's configuration space) or its start did not settle, in
+	 *  which case it plans alone.
+	 *  Never evicts, so pointers stay valid for the rest of the batch. */
+	const FFlowFieldCacheEntry* PrepareFlowField(const FSeinPathRequest& Request) const;
+
+	/** Eligibility and key half of PrepareFlowField, shared with the read-only
+	 *  lookup. False when the request plans alone. */
+	bool MakeFlowFieldKey(const FSeinPathRequest& Request, FFlowFieldKey& OutKey, int32& OutStartCell) const;
+
+	/** Read-only: the current-revision field in which the request's start has
+	 *  already settled, or null. Never creates, grows or references a field. */
+	const FFlowFieldCacheEntry* FindPreparedFlowField(const FSeinPathRequest& Request) const;
+
+	/** Pop the field's reverse Dijkstra until `UntilCell` settles, the open
+	 *  list empties, or the field has settled AStarMaxIterations cells. Edge
+	 *  rules mirror AStarSearch inside C-space, including the goal carve-out
+	 *  and the diagonal anti-squeeze. The cap counts from the seed, so whether
+	 *  a start settles depends only on its rank in the pop order, never on how
+	 *  far earlier members grew the field. Returns whether `UntilCell` is
+	 *  settled; a capped start plans alone and gets AStarSearch's partial path. */
+	bool ExpandFlowField(FFlowFieldCacheEntry& Field, int32 UntilCell) const;
+
+	/** Read-only, thread-safe: follow the direction field from Start to the goal
+	 *  into Scratch.CellPath. False when Start is not settled (not connected). */
+	bool DescendFlowField(const FFlowFieldCacheEntry& Field, FIntPoint Start, FAStarScratch& Scratch) const;
+
+	/** Evict down to NavFlowFieldCacheCapacity, unreferenced fields first. */
+	void TrimFlowFieldCache() const;
+
 	/** Recompute WallDistance via multi-source BFS from all blocked cells.
 	 *  Run once at LoadFromSubstrate; not a hot path. */
 	void RebuildWallDistanceField();
@@ -105,7 +105,9 @@ public:
 	/** Cancel all queued and ready async path state owned by Requester.
 	 *  Safe and idempotent when async pathfinding is disabled or no request is
 	 *  pending. Terminal tickable consumers must call this so abandoned
-	 *  continuations do not remain part of canonical simulation state. */
+	 *  continuations do not remain part of canonical simulation state. Also
+	 *  releases the requester's share of any group planning state the nav
+	 *  holds (USeinNavigation::ReleasePathRequester). */
 	void CancelPathRequest(FSeinEntityHandle Requester);
 
 private:
@@ -118,17 +118,21 @@ struct SEINARTSNAVIGATION_API FSeinPathRequest
 	/** Per-request cap on A* node expansions. 0 = use the project default
 	 *  (USeinNavigationAStar::AStarMaxIterations, on the nav class CDO). Set a smaller value to bound an
 	 *  expensive / long-range pathfind — A* returns a best-effort partial path
-	 *  (bIsPartial) if the cap is hit rather than searching the whole grid. */
+	 *  (bIsPartial) if the cap is hit rather than searching the whole grid.
+	 *  Applied per stage: the hierarchical attempt (abstract search plus its
+	 *  refinement legs) is capped at this value, and a flat fallback after a
+	 *  failed attempt gets the full value again. */
 	UPROPERTY(BlueprintReadWrite, Category = "SeinARTS|Navigation|Path", meta = (ClampMin = "0"))
 	int32 AgentMaxSearchNodes = 0;
 
 	/** Group / region key for navs that SHARE planning work across many agents — a
 	 *  flow-field or hierarchical nav keys ONE field / abstract route per (GroupId, End)
 	 *  and reuses it for every member, rather than planning each request independently.
-	 *  0 = none (treat as a lone agent). The shipped per-agent A* nav IGNORES this. This
-	 *  is a CONTRACT seam only: the framework defines + carries the key (movement stamps
-	 *  it from the order's cohesion group); BUILDING the shared-field/route cache keyed by
-	 *  it is the nav impl's job. */
+	 *  0 = none (treat as a lone agent). The shipped A* nav uses it as the opt-in: a
+	 *  nonzero id routes the request through a shared flow field keyed by (goal cell,
+	 *  clearance profile) — the id itself is not part of that key, so two orders to the same
+	 *  spot share one field. The framework defines + carries the key (movement stamps it
+	 *  from the order's cohesion group); BUILDING the shared cache is the nav impl's job. */
 	UPROPERTY(BlueprintReadWrite, Category = "SeinARTS|Navigation|Path")
 	int64 GroupId = 0;
 };
@@ -175,7 +179,7 @@ struct SEINARTSNAVIGATION_API FSeinDirectionQuery
 	int32 AgentWallPaddingCells = 0;
 
 	/** Group / region key for shared-field navs (see FSeinPathRequest::GroupId). 0 = lone.
-	 *  A field nav keys ONE field per (GroupId, Goal) and samples it for every member;
+	 *  A field nav keys ONE field per group goal and samples it for every member;
 	 *  per-agent navs ignore it. */
 	UPROPERTY(BlueprintReadWrite, Category = "SeinARTS|Navigation|Direction")
 	int64 GroupId = 0;
@@ -0,0 +1,191 @@
+/**
+ * SeinARTS Framework - Copyright (c) 2026 Phenom Studios, Inc.
+ *
+ * @file         SeinAdaptiveInputDelay.cpp
+ * @author       RJ Macklem
+ * @created      17 Oct 2026
+ * @latest       17 Oct 2026
+ * @brief        Submission-lead and gate-stall histograms and the adaptive
+ *               input-delay controller.
+ */
+
+#include "SeinAdaptiveInputDelay.h"
+#include "SeinNetProtocolTypes.h"
+
+void FSeinSubmissionLeadHistogram::Add(int32 LeadTurns)
+{
+	++Buckets[FMath::Clamp(LeadTurns, 0, NumBuckets - 1)];
+	++Total;
+}
+
+uint32 FSeinSubmissionLeadHistogram::CountBelow(int32 LeadTurns) const
+{
+	uint32 Count = 0;
+	for (int32 Bucket = 0; Bucket < FMath::Min(LeadTurns, NumBuckets); ++Bucket)
+	{
+		Count += Buckets[Bucket];
+	}
+	return Count;
+}
+
+void FSeinSubmissionLeadHistogram::Reset()
+{
+	*this = FSeinSubmissionLeadHistogram();
+}
+
+const double FSeinGateStallHistogram::BucketUpperSeconds[NumBuckets - 1] =
+	{ 0.05, 0.1, 0.25, 0.5, 1.0 };
+
+void FSeinGateStallHistogram::Add(double Seconds)
+{
+	Seconds = FMath::Max(0.0, Seconds);
+	int32 Bucket = 0;
+	while (Bucket < NumBuckets - 1 && Seconds >= BucketUpperSeconds[Bucket])
+	{
+		++Bucket;
+	}
+	++Buckets[Bucket];
+	++Total;
+	TotalSeconds += Seconds;
+	LongestSeconds = FMath::Max(LongestSeconds, Seconds);
+}
+
+FString FSeinGateStallHistogram::GetBucketLabel(int32 Bucket)
+{
+	if (Bucket < 0 || Bucket >= NumBuckets) return FString();
+	if (Bucket == NumBuckets - 1)
+	{
+		return FString::Printf(
+			TEXT(">=%.0fms"), BucketUpperSeconds[NumBuckets - 2] * 1000.0);
+	}
+	return FString::Printf(TEXT("<%.0fms"), BucketUpperSeconds[Bucket] * 1000.0);
+}
+
+void FSeinGateStallHistogram::Reset()
+{
+	*this = FSeinGateStallHistogram();
+}
+
+void FSeinAdaptiveInputDelay::Configure(const FSeinAdaptiveInputDelayConfig& InConfig)
+{
+	Config = InConfig;
+	Config.MinDelayTurns = FMath::Clamp(
+		Config.MinDelayTurns, 1, SeinNetProtocolLimits::MaxInputDelayTurns);
+	Config.MaxDelayTurns = FMath::Clamp(
+		Config.MaxDelayTurns, Config.MinDelayTurns,
+		SeinNetProtocolLimits::MaxInputDelayTurns);
+	Config.InitialDelayTurns = FMath::Clamp(
+		Config.InitialDelayTurns, Config.MinDelayTurns, Config.MaxDelayTurns);
+	Config.WindowTurns = FMath::Max(1, Config.WindowTurns);
+	Config.TargetLeadTurns = FMath::Max(1, Config.TargetLeadTurns);
+	Config.LateSamplesToRaise = FMath::Max(1, Config.LateSamplesToRaise);
+	Config.LowerTolerance = FMath::Clamp(Config.LowerTolerance, 0.0, 1.0);
+	Reset();
+}
+
+void FSeinAdaptiveInputDelay::Reset()
+{
+	Schedule.Reset();
+	Schedule.Add({ 0, Config.InitialDelayTurns });
+	SessionLeads.Reset();
+	WindowLeads.Reset();
+	WindowStartTurn = INDEX_NONE;
+	SettledFromTurn = 0;
+	HighestStampedTurn = INDEX_NONE;
+	ChangeCount = 0;
+}
+
+void FSeinAdaptiveInputDelay::RecordSubmission(
+	FSeinPlayerID Slot, int32 TurnId, int32 CoordinatorTurn)
+{
+	if (!Config.bEnabled) return;
+	const int32 Lead = TurnId - CoordinatorTurn;
+	SessionLeads.FindOrAdd(Slot).Add(Lead);
+	if (TurnId < SettledFromTurn) return;
+	if (WindowStartTurn == INDEX_NONE)
+	{
+		WindowStartTurn = CoordinatorTurn;
+	}
+	WindowLeads.Add(Lead);
+}
+
+int32 FSeinAdaptiveInputDelay::StampTurn(int32 TurnId, int32 CoordinatorTurn)
+{
+	if (!Config.bEnabled) return 0;
+	if (TurnId > HighestStampedTurn)
+	{
+		Evaluate(TurnId, CoordinatorTurn);
+		HighestStampedTurn = TurnId;
+	}
+	return GetDelayForTurn(TurnId);
+}
+
+int32 FSeinAdaptiveInputDelay::GetDelayForTurn(int32 TurnId) const
+{
+	if (!Config.bEnabled) return 0;
+	for (int32 Index = Schedule.Num() - 1; Index > 0; --Index)
+	{
+		if (TurnId >= Schedule[Index].FromTurn) return Schedule[Index].Delay;
+	}
+	return Schedule[0].Delay;
+}
+
+int32 FSeinAdaptiveInputDelay::GetLatestDelay() const
+{
+	return Config.bEnabled ? Schedule.Last().Delay : 0;
+}
+
+void FSeinAdaptiveInputDelay::Evaluate(int32 FromTurn, int32 CoordinatorTurn)
+{
+	if (WindowStartTurn == INDEX_NONE)
+	{
+		OpenWindow(CoordinatorTurn);
+		return;
+	}
+
+	// Raising reacts inside the window: every late sample is a turn the
+	// coordinator already waited on. Lowering needs a full window in which
+	// almost every author would still have beaten the gate one turn sooner.
+	const int32 Current = Schedule.Last().Delay;
+	int32 Next = Current;
+	if (WindowLeads.CountBelow(Config.TargetLeadTurns)
+		>= static_cast<uint32>(Config.LateSamplesToRaise))
+	{
+		Next = Current + 1;
+	}
+	else if (CoordinatorTurn - WindowStartTurn >= Config.WindowTurns)
+	{
+		const double Allowed = WindowLeads.Total * Config.LowerTolerance;
+		if (WindowLeads.Total > 0
+			&& WindowLeads.CountBelow(Config.TargetLeadTurns + 1) <= Allowed)
+		{
+			Next = Current - 1;
+		}
+	}
+	else
+	{
+		return;
+	}
+
+	Next = FMath::Clamp(Next, Config.MinDelayTurns, Config.MaxDelayTurns);
+	if (Next != Current)
+	{
+		if (Schedule.Num() >= MaxScheduleEntries)
+		{
+			Schedule.RemoveAt(0);
+		}
+		Schedule.Add({ FromTurn, Next });
+		++ChangeCount;
+		// Turns through FromTurn + max(old, new) delay were authored before
+		// peers adopted the change (or are gap heartbeats sent at it), so
+		// their lead says nothing about the new delay.
+		SettledFromTurn = FromTurn + FMath::Max(Current, Next) + 1;
+	}
+	OpenWindow(CoordinatorTurn);
+}
+
+void FSeinAdaptiveInputDelay::OpenWindow(int32 CoordinatorTurn)
+{
+	WindowLeads.Reset();
+	WindowStartTurn = CoordinatorTurn;
+}
@@ -0,0 +1,415 @@
+/**
+ * SeinARTS Framework - Copyright (c) 2026 Phenom Studios, Inc.
+ *
+ * @file         SeinDesyncProof.cpp
+ * @author       RJ Macklem
+ * @created      17 Oct 2026
+ * @latest       17 Oct 2026
+ * @brief        Desync proof walk: section, node and leaf comparison down to
+ *               the divergent entries.
+ */
+
+#include "SeinDesyncProof.h"
+
+#include "Serialization/SeinCanonicalStateProof.h"
+
+namespace
+{
+	const FSeinDesyncProofEntry* FindEntry(
+		const FSeinDesyncProofResponse& Response,
+		int32 Index)
+	{
+		return Response.Entries.FindByPredicate(
+			[Index](const FSeinDesyncProofEntry& Entry)
+			{
+				return Entry.Index == Index;
+			});
+	}
+
+	FString DescribePayload(const FString& Payload, bool bAtCheckpoint)
+	{
+		return bAtCheckpoint
+			? Payload
+			: Payload + TEXT(" (changed since check turn)");
+	}
+}
+
+FString FSeinDesyncLocalization::ToString() const
+{
+	FString Out = FString::Printf(
+		TEXT("turn=%d reference=%s divergent=%s sections=[%s] leaves=%d roundTrips=%d proofBytes=%lld%s"),
+		Turn,
+		*ReferenceParticipantID.ToCanonicalString(),
+		*DivergentParticipantID.ToCanonicalString(),
+		*FString::Join(DivergentSections, TEXT(", ")),
+		Leaves.Num(),
+		RoundTrips,
+		ProofBytes,
+		bTruncated ? TEXT(" (truncated)") : TEXT(""));
+	if (!Error.IsEmpty())
+	{
+		Out += TEXT(" error=") + Error;
+	}
+	for (const FSeinDesyncLeafDiff& Leaf : Leaves)
+	{
+		Out += FString::Printf(
+			TEXT("\n  %s[%d]\n    reference: %s\n    divergent: %s"),
+			*Leaf.SectionId,
+			Leaf.LeafIndex,
+			*DescribePayload(Leaf.ReferencePayload, Leaf.bReferenceAtCheckpoint),
+			*DescribePayload(Leaf.DivergentPayload, Leaf.bDivergentAtCheckpoint));
+	}
+	return Out;
+}
+
+void FSeinDesyncProofWalk::Begin(
+	int32 Turn,
+	FSeinNetworkParticipantID ReferenceParticipantID,
+	FSeinNetworkParticipantID DivergentParticipantID)
+{
+	Reset();
+	Result.Turn = Turn;
+	Result.ReferenceParticipantID = ReferenceParticipantID;
+	Result.DivergentParticipantID = DivergentParticipantID;
+	PendingQuery.Kind = ESeinDesyncProofQueryKind::Sections;
+	bActive = true;
+}
+
+void FSeinDesyncProofWalk::Reset()
+{
+	Result = FSeinDesyncLocalization();
+	PendingQuery = FSeinDesyncProofQuery();
+	SectionQueue.Reset();
+	ActiveSection = FSectionShape();
+	Frontier.Reset();
+	bActive = false;
+}
+
+void FSeinDesyncProofWalk::Advance(
+	const FSeinDesyncProofResponse& Reference,
+	const FSeinDesyncProofResponse& Divergent)
+{
+	if (!bActive)
+	{
+		return;
+	}
+	++Result.RoundTrips;
+	Result.ProofBytes +=
+		EstimateWireBytes(Reference) + EstimateWireBytes(Divergent);
+	if (!Reference.bAvailable || !Divergent.bAvailable)
+	{
+		Abort(FString::Printf(
+			TEXT("%s proof unavailable: %s"),
+			Reference.bAvailable ? TEXT("divergent") : TEXT("reference"),
+			Reference.bAvailable ? *Divergent.Error : *Reference.Error));
+		return;
+	}
+
+	switch (PendingQuery.Kind)
+	{
+	case ESeinDesyncProofQueryKind::Sections:
+		if (CompareSections(Reference, Divergent))
+		{
+			StartNextSection();
+		}
+		break;
+	case ESeinDesyncProofQueryKind::Nodes:
+		if (CompareNodes(Reference, Divergent))
+		{
+			QueryBelowFrontier();
+		}
+		break;
+	case ESeinDesyncProofQueryKind::Leaves:
+		CompareLeaves(Reference, Divergent);
+		StartNextSection();
+		break;
+	}
+}
+
+void FSeinDesyncProofWalk::Abort(const FString& Reason)
+{
+	if (!bActive)
+	{
+		return;
+	}
+	Result.Error = Reason;
+	Finish();
+}
+
+bool FSeinDesyncProofWalk::CompareSections(
+	const FSeinDesyncProofResponse& Reference,
+	const FSeinDesyncProofResponse& Divergent)
+{
+	TMap<FString, const FSeinDesyncProofEntry*> ReferenceSections;
+	TMap<FString, const FSeinDesyncProofEntry*> DivergentSections;
+	TSet<FString> SectionIds;
+	for (const FSeinDesyncProofEntry& Entry : Reference.Entries)
+	{
+		ReferenceSections.Add(Entry.SectionId, &Entry);
+		SectionIds.Add(Entry.SectionId);
+	}
+	for (const FSeinDesyncProofEntry& Entry : Divergent.Entries)
+	{
+		DivergentSections.Add(Entry.SectionId, &Entry);
+		SectionIds.Add(Entry.SectionId);
+	}
+	TArray<FString> SortedIds = SectionIds.Array();
+	SortedIds.Sort();
+
+	for (const FString& SectionId : SortedIds)
+	{
+		const FSeinDesyncProofEntry* Ref = ReferenceSections.FindRef(SectionId);
+		const FSeinDesyncProofEntry* Div = DivergentSections.FindRef(SectionId);
+		if (Ref && Div && Ref->Digest == Div->Digest)
+		{
+			continue;
+		}
+		Result.DivergentSections.Add(SectionId);
+
+		// Differently shaped trees (pool capacity drift) have no common node
+		// numbering; the section name is as far as the walk can narrow.
+		if (!Ref || !Div
+			|| Ref->LeafBase <= 0
+			|| Ref->LeafBase != Div->LeafBase
+			|| Ref->LeafCount != Div->LeafCount)
+		{
+			continue;
+		}
+		if (SectionQueue.Num() >= MaxDescendedSections)
+		{
+			Result.bTruncated = true;
+			continue;
+		}
+		FSectionShape& Shape = SectionQueue.AddDefaulted_GetRef();
+		Shape.SectionId = SectionId;
+		Shape.LeafCount = Ref->LeafCount;
+		Shape.LeafBase = Ref->LeafBase;
+	}
+	return true;
+}
+
+bool FSeinDesyncProofWalk::CompareNodes(
+	const FSeinDesyncProofResponse& Reference,
+	const FSeinDesyncProofResponse& Divergent)
+{
+	TArray<int32> NextFrontier;
+	for (const int32 NodeIndex : PendingQuery.Indices)
+	{
+		const FSeinDesyncProofEntry* Ref = FindEntry(Reference, NodeIndex);
+		const FSeinDesyncProofEntry* Div = FindEntry(Divergent, NodeIndex);
+		if (!Ref || !Div)
+		{
+			Abort(FString::Printf(
+				TEXT("Peer omitted node %d of section '%s'."),
+				NodeIndex,
+				*ActiveSection.SectionId));
+			return false;
+		}
+		if (Ref->Digest == Div->Digest)
+		{
+			continue;
+		}
+		if (NextFrontier.Num() >= MaxFrontierNodes)
+		{
+			Result.bTruncated = true;
+			break;
+		}
+		NextFrontier.Add(NodeIndex);
+	}
+	Frontier = MoveTemp(NextFrontier);
+	return true;
+}
+
+void FSeinDesyncProofWalk::CompareLeaves(
+	const FSeinDesyncProofResponse& Reference,
+	const FSeinDesyncProofResponse& Divergent)
+{
+	for (const int32 LeafIndex : PendingQuery.Indices)
+	{
+		const FSeinDesyncProofEntry* Ref = FindEntry(Reference, LeafIndex);
+		const FSeinDesyncProofEntry* Div = FindEntry(Divergent, LeafIndex);
+		if (!Ref || !Div || Ref->Digest == Div->Digest)
+		{
+			continue;
+		}
+		FSeinDesyncLeafDiff& Diff = Result.Leaves.AddDefaulted_GetRef();
+		Diff.SectionId = ActiveSection.SectionId;
+		Diff.LeafIndex = LeafIndex;
+		Diff.ReferenceDigest = Ref->Digest;
+		Diff.DivergentDigest = Div->Digest;
+		Diff.ReferencePayload = Ref->Payload;
+		Diff.DivergentPayload = Div->Payload;
+		Diff.bReferenceAtCheckpoint = Ref->bPayloadAtCheckpoint;
+		Diff.bDivergentAtCheckpoint = Div->bPayloadAtCheckpoint;
+	}
+}
+
+void FSeinDesyncProofWalk::QueryBelowFrontier()
+{
+	if (Frontier.IsEmpty())
+	{
+		StartNextSection();
+		return;
+	}
+
+	PendingQuery.SectionId = ActiveSection.SectionId;
+	PendingQuery.Indices.Reset();
+	if (Frontier[0] < ActiveSection.LeafBase)
+	{
+		PendingQuery.Kind = ESeinDesyncProofQueryKind::Nodes;
+		for (const int32 NodeIndex : Frontier)
+		{
+			PendingQuery.Indices.Add(NodeIndex * 2);
+			PendingQuery.Indices.Add(NodeIndex * 2 + 1);
+		}
+		return;
+	}
+
+	// The frontier reached leaf level. Padding positions past LeafCount hold
+	// the shared empty sentinel and never differ.
+	const int32 Budget = MaxLeafDiffs - Result.Leaves.Num();
+	PendingQuery.Kind = ESeinDesyncProofQueryKind::Leaves;
+	for (const int32 NodeIndex : Frontier)
+	{
+		const int32 LeafIndex = NodeIndex - ActiveSection.LeafBase;
+		if (LeafIndex >= ActiveSection.LeafCount)
+		{
+			continue;
+		}
+		if (PendingQuery.Indices.Num() >= Budget)
+		{
+			Result.bTruncated = true;
+			break;
+		}
+		PendingQuery.Indices.Add(LeafIndex);
+	}
+	if (PendingQuery.Indices.IsEmpty())
+	{
+		StartNextSection();
+	}
+}
+
+void FSeinDesyncProofWalk::StartNextSection()
+{
+	Frontier.Reset();
+	if (SectionQueue.IsEmpty() || Result.Leaves.Num() >= MaxLeafDiffs)
+	{
+		Result.bTruncated |= !SectionQueue.IsEmpty();
+		Finish();
+		return;
+	}
+	ActiveSection = SectionQueue[0];
+	SectionQueue.RemoveAt(0, 1, EAllowShrinking::No);
+	// Section digests already differ; start under the top node.
+	Frontier.Add(1);
+	QueryBelowFrontier();
+}
+
+void FSeinDesyncProofWalk::Finish()
+{
+	bActive = false;
+	PendingQuery = FSeinDesyncProofQuery();
+	SectionQueue.Reset();
+	Frontier.Reset();
+}
+
+void FSeinDesyncProofWalk::Answer(
+	const FSeinCanonicalStateProofImage& Image,
+	const FSeinDesyncProofQuery& Query,
+	TFunctionRef<bool(FStringView, int32, FSeinCanonicalStateProofLeaf&, FString&)> DescribeLeaf,
+	FSeinDesyncProofResponse& OutResponse)
+{
+	OutResponse = FSeinDesyncProofResponse();
+	if (!Image.IsValid())
+	{
+		OutResponse.Error = TEXT("No proof image is retained for that turn.");
+		return;
+	}
+
+	if (Query.Kind == ESeinDesyncProofQueryKind::Sections)
+	{
+		OutResponse.Entries.Reserve(Image.Sections.Num());
+		for (const FSeinCanonicalStateProofSection& Section : Image.Sections)
+		{
+			FSeinDesyncProofEntry& Entry = OutResponse.Entries.AddDefaulted_GetRef();
+			Entry.SectionId = Section.SectionId;
+			Entry.Digest = Section.Digest;
+			if (Section.Tree.IsValid())
+			{
+				Entry.LeafCount = Section.Tree->Num();
+				Entry.LeafBase = Section.Tree->GetLeafBase();
+			}
+		}
+		OutResponse.bAvailable = true;
+		return;
+	}
+
+	const FSeinCanonicalStateProofSection* Section =
+		Image.FindSection(Query.SectionId);
+	const int32 MaxIndices = Query.Kind == ESeinDesyncProofQueryKind::Nodes
+		? MaxFrontierNodes * 2
+		: MaxLeafDiffs;
+	if (!Section || !Section->Tree.IsValid()
+		|| Query.Indices.Num() > MaxIndices)
+	{
+		OutResponse.Error = FString::Printf(
+			TEXT("Proof query for section '%s' is not answerable."),
+			*Query.SectionId);
+		return;
+	}
+
+	const FSeinCanonicalDigestTree& Tree = *Section->Tree;
+	OutResponse.Entries.Reserve(Query.Indices.Num());
+	for (const int32 Index : Query.Indices)
+	{
+		const bool bLeaf = Query.Kind == ESeinDesyncProofQueryKind::Leaves;
+		FSeinDesyncProofEntry& Entry = OutResponse.Entries.AddDefaulted_GetRef();
+		Entry.Index = Index;
+		if ((bLeaf && (Index < 0 || Index >= Tree.Num()))
+			|| !Tree.GetNodeDigest(
+				bLeaf ? Tree.GetLeafBase() + Index : Index, Entry.Digest))
+		{
+			OutResponse.Entries.Reset();
+			OutResponse.Error = FString::Printf(
+				TEXT("Proof query index %d is outside section '%s'."),
+				Index,
+				*Query.SectionId);
+			return;
+		}
+		if (!bLeaf)
+		{
+			continue;
+		}
+
+		// The imaged digest is what is compared; the payload is rendered
+		// from live state and says whether it still matches that digest.
+		FSeinCanonicalStateProofLeaf Leaf;
+		FString LeafError;
+		if (DescribeLeaf(Query.SectionId, Index, Leaf, LeafError))
+		{
+			Entry.Payload = Leaf.bTruncated
+				? Leaf.Payload + TEXT("...")
+				: MoveTemp(Leaf.Payload);
+			Entry.bPayloadAtCheckpoint = Leaf.bAtCheckpoint;
+		}
+		else
+		{
+			Entry.Payload = TEXT("<unavailable: ") + LeafError + TEXT(">");
+		}
+	}
+	OutResponse.bAvailable = true;
+}
+
+int64 FSeinDesyncProofWalk::EstimateWireBytes(
+	const FSeinDesyncProofResponse& Response)
+{
+	// Digest, three int32 fields and a bool per entry plus its strings.
+	int64 Bytes = 1 + Response.Error.Len();
+	for (const FSeinDesyncProofEntry& Entry : Response.Entries)
+	{
+		Bytes += 16 + 12 + 1
+			+ Entry.SectionId.Len()
+			+ Entry.Payload.Len();
+	}
+	return Bytes;
+}
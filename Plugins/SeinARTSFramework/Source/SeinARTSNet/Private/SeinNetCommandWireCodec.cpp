@@ -11,6 +11,9 @@ namespace
 	constexpr uint16 BatchVersion = 1;
 	constexpr uint8 DraftMode = 1;
 	constexpr uint8 CanonicalMode = 2;
+	/** Canonical commands followed by one FSeinTurnControlRecord trailer. */
+	constexpr uint8 CanonicalControlMode = 3;
+	constexpr int32 ControlTrailerBytes = 1;
 
 	bool ChargeNativeAllocation(
 		uint64 Amount, uint64 Limit, uint64& Used, FString& Error)
@@ -156,17 +159,20 @@ namespace
 		return true;
 	}
 
+	/** A non-null bOutControlMode also admits the control form of ExpectedMode. */
 	bool BeginDecode(
 		const FSeinOpaqueCommandBatch& Batch,
 		int32 MaxCommands,
 		uint8 ExpectedMode,
 		int32& Offset,
 		uint32& Count,
-		FString& Error)
+		FString& Error,
+		bool* bOutControlMode = nullptr)
 	{
 		Error.Reset();
 		Offset = 0;
 		Count = 0;
+		if (bOutControlMode) *bOutControlMode = false;
 		if (Batch.Bytes.Num() > static_cast<int32>(FSeinOpaqueCommandBatch::MaxBytes))
 		{
 			Error = TEXT("opaque command batch exceeds its hard byte cap");
@@ -178,11 +184,20 @@ namespace
 			|| !ReadUInt(Bytes, Offset, 2, Version, Error)
 			|| !ReadUInt(Bytes, Offset, 1, Mode, Error)
 			|| !ReadUInt(Bytes, Offset, 4, EncodedCount, Error)
-			|| Magic != BatchMagic || Version != BatchVersion || Mode != ExpectedMode)
+			|| Magic != BatchMagic || Version != BatchVersion)
 		{
 			if (Error.IsEmpty()) Error = TEXT("invalid opaque command batch prefix");
 			return false;
 		}
+		const bool bControlMode = bOutControlMode
+			&& ExpectedMode == CanonicalMode
+			&& Mode == CanonicalControlMode;
+		if (Mode != ExpectedMode && !bControlMode)
+		{
+			Error = TEXT("invalid opaque command batch prefix");
+			return false;
+		}
+		if (bOutControlMode) *bOutControlMode = bControlMode;
 		if (MaxCommands < 0 || EncodedCount > static_cast<uint64>(MaxCommands)
 			|| EncodedCount > static_cast<uint64>(MAX_int32)
 			|| EncodedCount * 5u > static_cast<uint64>(Bytes.Num() - Offset))
@@ -234,6 +249,154 @@ namespace
 		OutCanonicalSurchargeBytes = OutCost.CanonicalCostBytes - CommandBytes;
 		return true;
 	}
+
+	bool AppendControlTrailer(
+		const FSeinTurnControlRecord& Control,
+		FSeinOpaqueCommandBatch& Out,
+		FString& Error)
+	{
+		if (Control.InputDelayTurns > SeinNetProtocolLimits::MaxInputDelayTurns)
+		{
+			Error = TEXT("turn control record announces an input delay above the protocol bound");
+			return false;
+		}
+		if (Out.Bytes.Num() + ControlTrailerBytes
+			> static_cast<int32>(FSeinOpaqueCommandBatch::MaxBytes))
+		{
+			Error = TEXT("opaque command batch exceeds its hard byte cap");
+			return false;
+		}
+		WriteUInt(Out.Bytes, Control.InputDelayTurns, 1);
+		return true;
+	}
+
+	bool ReadControlTrailer(
+		const FSeinOpaqueCommandBatch& Batch,
+		int32& Offset,
+		FSeinTurnControlRecord& OutControl,
+		FString& Error)
+	{
+		uint64 InputDelay = 0;
+		if (!ReadUInt(Batch.Bytes, Offset, 1, InputDelay, Error)) return false;
+		// An empty record must use the plain canonical mode, so each record
+		// has exactly one encoding.
+		if (InputDelay == 0
+			|| InputDelay > static_cast<uint64>(SeinNetProtocolLimits::MaxInputDelayTurns))
+		{
+			Error = TEXT("turn control record announces an out-of-range input delay");
+			return false;
+		}
+		OutControl.InputDelayTurns = static_cast<uint8>(InputDelay);
+		return true;
+	}
+
+	bool EncodeCanonicalTurn(
+		TConstArrayView<FSeinCommand> Commands,
+		const FSeinTurnControlRecord& Control,
+		int32 MaxCommands,
+		FSeinCommandWireSchemaLookup FindSchema,
+		FSeinOpaqueCommandBatch& OutBatch,
+		FString& OutError,
+		FSeinWireCost& OutCost)
+	{
+		OutCost = {};
+		OutBatch.Bytes.Reset();
+		OutError.Reset();
+		uint64 NativeAllocationBytes = 0;
+		uint64 CanonicalSurchargeBytes = 0;
+		if (!ChargeNativeAllocation(
+			static_cast<uint64>(Commands.Num()) * sizeof(FSeinCommand),
+			FSeinNetCommandWireCodec::MaxNativeAllocationBytes,
+			NativeAllocationBytes, OutError)) return false;
+		const uint8 Mode = Control.IsSet() ? CanonicalControlMode : CanonicalMode;
+		if (!BeginEncode(Commands.Num(), MaxCommands, Mode, OutBatch, OutError)) return false;
+		for (const FSeinCommand& Command : Commands)
+		{
+			if (!AppendCommand(
+				Command, false, FindSchema,
+				FSeinNetCommandWireCodec::MaxNativeAllocationBytes,
+				NativeAllocationBytes, CanonicalSurchargeBytes,
+				OutBatch, OutError))
+			{
+				OutBatch.Bytes.Reset();
+				return false;
+			}
+		}
+		if ((Control.IsSet() && !AppendControlTrailer(Control, OutBatch, OutError))
+			|| !FinalizeBatchCost(
+				OutBatch, Commands.Num(), CanonicalSurchargeBytes,
+				NativeAllocationBytes, OutCost, OutError))
+		{
+			OutBatch.Bytes.Reset();
+			return false;
+		}
+		return true;
+	}
+
+	bool DecodeCanonicalTurn(
+		const FSeinOpaqueCommandBatch& Batch,
+		int32 MaxCommands,
+		FSeinCommandWireSchemaLookup FindSchema,
+		TArray<FSeinCommand>& OutCommands,
+		FSeinTurnControlRecord& OutControl,
+		FString& OutError,
+		FSeinWireCost& OutCost,
+		uint64 NativeAllocationLimit)
+	{
+		OutCost = {};
+		int32 Offset = 0;
+		uint32 Count = 0;
+		bool bControlMode = false;
+		if (!BeginDecode(
+			Batch, MaxCommands, CanonicalMode, Offset, Count, OutError,
+			&bControlMode)) return false;
+		uint64 NativeAllocationBytes = 0;
+		uint64 CanonicalSurchargeBytes = 0;
+		if (!ChargeNativeAllocation(
+			static_cast<uint64>(Count) * sizeof(FSeinCommand),
+			NativeAllocationLimit,
+			NativeAllocationBytes, OutError)) return false;
+		TArray<FSeinCommand> Candidate;
+		Candidate.Reserve(static_cast<int32>(Count));
+		for (uint32 Index = 0; Index < Count; ++Index)
+		{
+			FSeinCommand Command;
+			bool bAdmin = false;
+			FSeinWireCost CommandCost;
+			uint64 CommandCanonicalSurchargeBytes = 0;
+			if (!ReadCommand(
+				Batch, Offset, FindSchema, Command, bAdmin,
+				NativeAllocationLimit - NativeAllocationBytes,
+				CommandCost, CommandCanonicalSurchargeBytes, OutError)
+				|| !ChargeNativeAllocation(
+					CommandCost.NativeAllocationBytes,
+					NativeAllocationLimit,
+					NativeAllocationBytes, OutError)
+				|| !AddCanonicalSurcharge(
+					CommandCanonicalSurchargeBytes,
+					CanonicalSurchargeBytes, OutError)
+				|| bAdmin)
+			{
+				if (OutError.IsEmpty()) OutError = TEXT("canonical command batch carried a draft-only administration flag");
+				return false;
+			}
+			Candidate.Add(MoveTemp(Command));
+		}
+		FSeinTurnControlRecord Control;
+		if (bControlMode
+			&& !ReadControlTrailer(Batch, Offset, Control, OutError)) return false;
+		if (Offset != Batch.Bytes.Num())
+		{
+			OutError = TEXT("trailing bytes after opaque command batch");
+			return false;
+		}
+		if (!FinalizeBatchCost(
+			Batch, static_cast<int32>(Count), CanonicalSurchargeBytes,
+			NativeAllocationBytes, OutCost, OutError)) return false;
+		OutCommands = MoveTemp(Candidate);
+		OutControl = Control;
+		return true;
+	}
 }
 
 bool FSeinNetCommandWireCodec::EncodeDraftsWithCost(
@@ -372,36 +535,9 @@ bool FSeinNetCommandWireCodec::EncodeCommandsWithCost(
 	FString& OutError,
 	FSeinWireCost& OutCost)
 {
-	OutCost = {};
-	OutBatch.Bytes.Reset();
-	OutError.Reset();
-	uint64 NativeAllocationBytes = 0;
-	uint64 CanonicalSurchargeBytes = 0;
-	if (!ChargeNativeAllocation(
-		static_cast<uint64>(Commands.Num()) * sizeof(FSeinCommand),
-		FSeinNetCommandWireCodec::MaxNativeAllocationBytes,
-		NativeAllocationBytes, OutError)) return false;
-	if (!BeginEncode(Commands.Num(), MaxCommands, CanonicalMode, OutBatch, OutError)) return false;
-	for (const FSeinCommand& Command : Commands)
-	{
-		if (!AppendCommand(
-			Command, false, FindSchema,
-			FSeinNetCommandWireCodec::MaxNativeAllocationBytes,
-			NativeAllocationBytes, CanonicalSurchargeBytes,
-			OutBatch, OutError))
-		{
-			OutBatch.Bytes.Reset();
-			return false;
-		}
-	}
-	if (!FinalizeBatchCost(
-		OutBatch, Commands.Num(), CanonicalSurchargeBytes,
-		NativeAllocationBytes, OutCost, OutError))
-	{
-		OutBatch.Bytes.Reset();
-		return false;
-	}
-	return true;
+	return EncodeCanonicalTurn(
+		Commands, FSeinTurnControlRecord(), MaxCommands, FindSchema,
+		OutBatch, OutError, OutCost);
 }
 
 bool FSeinNetCommandWireCodec::EncodeCommands(
@@ -430,52 +566,10 @@ bool FSeinNetCommandWireCodec::DecodeCommandsWithCost(
 	FSeinWireCost& OutCost,
 	uint64 NativeAllocationLimit)
 {
-	OutCost = {};
-	int32 Offset = 0;
-	uint32 Count = 0;
-	if (!BeginDecode(Batch, MaxCommands, CanonicalMode, Offset, Count, OutError)) return false;
-	uint64 NativeAllocationBytes = 0;
-	uint64 CanonicalSurchargeBytes = 0;
-	if (!ChargeNativeAllocation(
-		static_cast<uint64>(Count) * sizeof(FSeinCommand),
-		NativeAllocationLimit,
-		NativeAllocationBytes, OutError)) return false;
-	TArray<FSeinCommand> Candidate;
-	Candidate.Reserve(static_cast<int32>(Count));
-	for (uint32 Index = 0; Index < Count; ++Index)
-	{
-		FSeinCommand Command;
-		bool bAdmin = false;
-		FSeinWireCost CommandCost;
-		uint64 CommandCanonicalSurchargeBytes = 0;
-		if (!ReadCommand(
-			Batch, Offset, FindSchema, Command, bAdmin,
-			NativeAllocationLimit - NativeAllocationBytes,
-			CommandCost, CommandCanonicalSurchargeBytes, OutError)
-			|| !ChargeNativeAllocation(
-				CommandCost.NativeAllocationBytes,
-				NativeAllocationLimit,
-				NativeAllocationBytes, OutError)
-			|| !AddCanonicalSurcharge(
-				CommandCanonicalSurchargeBytes,
-				CanonicalSurchargeBytes, OutError)
-			|| bAdmin)
-		{
-			if (OutError.IsEmpty()) OutError = TEXT("canonical command batch carried a draft-only administration flag");
-			return false;
-		}
-		Candidate.Add(MoveTemp(Command));
-	}
-	if (Offset != Batch.Bytes.Num())
-	{
-		OutError = TEXT("trailing bytes after opaque command batch");
-		return false;
-	}
-	if (!FinalizeBatchCost(
-		Batch, static_cast<int32>(Count), CanonicalSurchargeBytes,
-		NativeAllocationBytes, OutCost, OutError)) return false;
-	OutCommands = MoveTemp(Candidate);
-	return true;
+	FSeinTurnControlRecord IgnoredControl;
+	return DecodeCanonicalTurn(
+		Batch, MaxCommands, FindSchema, OutCommands, IgnoredControl,
+		OutError, OutCost, NativeAllocationLimit);
 }
 
 bool FSeinNetCommandWireCodec::DecodeCommands(
@@ -495,3 +589,30 @@ bool FSeinNetCommandWireCodec::DecodeCommands(
 		*OutDecodedAllocationBytes = Cost.NativeAllocationBytes;
 	return true;
 }
+
+bool FSeinNetCommandWireCodec::EncodeTurn(
+	TConstArrayView<FSeinCommand> Commands,
+	const FSeinTurnControlRecord& Control,
+	int32 MaxCommands,
+	FSeinCommandWireSchemaLookup FindSchema,
+	FSeinOpaqueCommandBatch& OutBatch,
+	FString& OutError)
+{
+	FSeinWireCost Cost;
+	return EncodeCanonicalTurn(
+		Commands, Control, MaxCommands, FindSchema, OutBatch, OutError, Cost);
+}
+
+bool FSeinNetCommandWireCodec::DecodeTurn(
+	const FSeinOpaqueCommandBatch& Batch,
+	int32 MaxCommands,
+	FSeinCommandWireSchemaLookup FindSchema,
+	TArray<FSeinCommand>& OutCommands,
+	FSeinTurnControlRecord& OutControl,
+	FString& OutError)
+{
+	FSeinWireCost Cost;
+	return DecodeCanonicalTurn(
+		Batch, MaxCommands, FindSchema, OutCommands, OutControl,
+		OutError, Cost, MaxNativeAllocationBytes);
+}
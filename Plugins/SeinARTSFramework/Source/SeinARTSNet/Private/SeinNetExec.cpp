@@ -774,6 +774,27 @@ namespace
 		TEXT("Clear the red on-screen desync alarm message. Internal bDesyncDetected flag stays set until PIE restart."),
 		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateStatic(&HandleClearDesync));
 
+	void HandleDumpDesyncReport(const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+	{
+		if (!World) { Ar.Log(TEXT("[SeinNet] DumpDesyncReport: no World.")); return; }
+		UGameInstance* GI = World->GetGameInstance();
+		USeinNetSubsystem* Net = GI ? GI->GetSubsystem<USeinNetSubsystem>() : nullptr;
+		if (!Net) { Ar.Log(TEXT("[SeinNet] DumpDesyncReport: USeinNetSubsystem missing.")); return; }
+
+		const FSeinDesyncLocalization& Report = Net->GetLastDesyncLocalization();
+		if (!Report.IsValid())
+		{
+			Ar.Log(TEXT("[SeinNet] DumpDesyncReport: no desync has been localised this session."));
+			return;
+		}
+		Ar.Logf(TEXT("[SeinNet] DumpDesyncReport: %s"), *Report.ToString());
+	}
+
+	static FAutoConsoleCommandWithWorldArgsAndOutputDevice GCmdDumpDesyncReport(
+		TEXT("Sein.Net.DumpDesyncReport"),
+		TEXT("Print the last desync localisation: differing state sections, slot indices, and both peers' values at the check turn."),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateStatic(&HandleDumpDesyncReport));
+
 	// ============== Replay reader (Phase 4a) ==============
 
 	void HandleLoadReplay(const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
@@ -1141,7 +1162,55 @@ namespace
 
 		const int32 Total = Net->GetTurnsCompletedCount();
 		const TMap<FSeinPlayerID, int32>& Counts = Net->GetStragglerCounts();
+		const FSeinAdaptiveInputDelay& Adaptive = Net->GetAdaptiveInputDelay();
 		Ar.Logf(TEXT("[SeinNet] Latency report (TotalTurnsCompleted=%d):"), Total);
+		Ar.Logf(TEXT("  input delay: active=%d turns  adaptive=%s  scheduled=%d  changes=%d"),
+			Net->GetActiveInputDelayTurns(),
+			Adaptive.IsEnabled() ? TEXT("on") : TEXT("off"),
+			Adaptive.GetLatestDelay(),
+			Adaptive.GetChangeCount());
+
+		// Lead = turns between a submission's arrival and the coordinator
+		// reaching that turn. 0 means the coordinator was already waiting.
+		if (!Adaptive.GetSessionLeads().IsEmpty())
+		{
+			FString Header;
+			for (int32 Bucket = 0; Bucket < FSeinSubmissionLeadHistogram::NumBuckets; ++Bucket)
+			{
+				Header += Bucket == FSeinSubmissionLeadHistogram::NumBuckets - 1
+					? FString::Printf(TEXT(" %5d+"), Bucket)
+					: FString::Printf(TEXT(" %6d"), Bucket);
+			}
+			Ar.Logf(TEXT("  submission lead (turns):%s"), *Header);
+			for (const TPair<FSeinPlayerID, FSeinSubmissionLeadHistogram>& Pair : Adaptive.GetSessionLeads())
+			{
+				FString Row;
+				for (const uint32 Count : Pair.Value.Buckets)
+				{
+					Row += FString::Printf(TEXT(" %6u"), Count);
+				}
+				Ar.Logf(TEXT("    slot=%-3u late=%5.2f%% %s"),
+					Pair.Key.Value,
+					Pair.Value.Total > 0
+						? 100.0 * Pair.Value.CountBelow(1) / Pair.Value.Total
+						: 0.0,
+					*Row);
+			}
+		}
+
+		const FSeinGateStallHistogram& Stalls = Net->GetGateStallHistogram();
+		if (Stalls.Total > 0)
+		{
+			FString Row;
+			for (int32 Bucket = 0; Bucket < FSeinGateStallHistogram::NumBuckets; ++Bucket)
+			{
+				Row += FString::Printf(TEXT("  %s=%u"),
+					*FSeinGateStallHistogram::GetBucketLabel(Bucket), Stalls.Buckets[Bucket]);
+			}
+			Ar.Logf(TEXT("  gate stalls: count=%u  total=%.2fs  longest=%.0fms %s"),
+				Stalls.Total, Stalls.TotalSeconds, Stalls.LongestSeconds * 1000.0, *Row);
+		}
+
 		if (Counts.IsEmpty() || Total == 0)
 		{
 			Ar.Log(TEXT("  No straggle events recorded — every peer is keeping up."));
@@ -1152,13 +1221,15 @@ namespace
 			const float Rate = static_cast<float>(Pair.Value) / static_cast<float>(Total);
 			Ar.Logf(TEXT("  slot=%u  late-submit count=%d  rate=%.2f%%  %s"),
 				Pair.Key.Value, Pair.Value, Rate * 100.0f,
-				Rate > 0.05f ? TEXT("← consider raising InputDelayTurns to absorb this peer's latency") : TEXT(""));
+				Rate > 0.05f && !Adaptive.IsEnabled()
+					? TEXT("← consider raising InputDelayTurns or enabling bAdaptiveInputDelay")
+					: TEXT(""));
 		}
 	}
 
 	static FAutoConsoleCommandWithWorldArgsAndOutputDevice GCmdLatencyReport(
 		TEXT("Sein.Net.LatencyReport"),
-		TEXT("SERVER ONLY. Dump per-peer straggle counts so you can see which connection is the slowest. >5% straggle rate suggests bumping InputDelayTurns."),
+		TEXT("SERVER ONLY. Dump the active and scheduled input delay, per-peer submission-lead histograms, gate-stall durations, and straggle counts so you can see which connection is the slowest."),
 		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateStatic(&HandleLatencyReport));
 
 	static FAutoConsoleCommandWithWorldArgsAndOutputDevice GCmdStatus(
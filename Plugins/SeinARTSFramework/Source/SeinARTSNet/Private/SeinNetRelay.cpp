@@ -571,6 +571,55 @@ void ASeinNetRelay::Client_NotifyDesync_Implementation(
 	}
 }
 
+void ASeinNetRelay::Client_RequestDesyncProof_Implementation(
+	const FSeinProtocolContext& Context,
+	int32 ProbeId,
+	int32 Turn,
+	const FSeinDesyncProofQuery& Query)
+{
+	UE_LOG(LogSeinNet, Verbose,
+		TEXT("[Client] Recv desync proof query  Probe=%d  Turn=%d  Kind=%d  Section=%s  Indices=%d"),
+		ProbeId, Turn, static_cast<int32>(Query.Kind), *Query.SectionId,
+		Query.Indices.Num());
+
+	if (USeinNetSubsystem* Net = GetNetSubsystem())
+	{
+		Net->ClientHandleDesyncProofRequest(
+			this, Context, ProbeId, Turn, Query);
+	}
+}
+
+void ASeinNetRelay::Server_ReportDesyncProof_Implementation(
+	const FSeinProtocolContext& Context,
+	int32 ProbeId,
+	const FSeinDesyncProofResponse& Response)
+{
+	UE_LOG(LogSeinNet, Verbose,
+		TEXT("[Coordinator] Recv desync proof answer  Probe=%d  Entries=%d  FromSlot=%u"),
+		ProbeId, Response.Entries.Num(), AssignedPlayerID.Value);
+
+	if (USeinNetSubsystem* Net = GetNetSubsystem())
+	{
+		Net->ServerHandleDesyncProofResponse(
+			this, Context, ProbeId, Response);
+	}
+}
+
+void ASeinNetRelay::Client_NotifyDesyncLocalized_Implementation(
+	const FSeinProtocolContext& Context,
+	const FSeinDesyncLocalization& Localization)
+{
+	UE_LOG(LogSeinNet, Verbose,
+		TEXT("[Client] Recv desync localisation  Turn=%d  Sections=%d  Leaves=%d"),
+		Localization.Turn, Localization.DivergentSections.Num(),
+		Localization.Leaves.Num());
+
+	if (USeinNetSubsystem* Net = GetNetSubsystem())
+	{
+		Net->ClientHandleDesyncLocalization(Context, Localization);
+	}
+}
+
 void ASeinNetRelay::Client_NotifyDeterminismSessionFailure_Implementation(
 	const FSeinProtocolContext& Context,
 	const FSeinDeterminismSessionFailure& Failure)
@@ -49,6 +49,9 @@ namespace
 	// closed instead of retaining the game-instance subsystem forever.
 	constexpr int32 GSeinMaxBootstrapMaterializerRetryTicks = 120;
 	constexpr double GSeinBootstrapCoordinatorTimeoutSeconds = 30.0;
+	// A localisation walk is a handful of round trips; peers that have not
+	// answered within this many turns are treated as gone.
+	constexpr int32 GSeinDesyncProofTimeoutTurns = 100;
 	const FName GSeinNetworkBootstrapAuthorityID(
 		TEXT("SeinARTS.Net.LockstepBootstrap"));
 
@@ -565,6 +568,7 @@ void USeinNetSubsystem::ResetLockstepEpochState(UWorld* RetiringWorld)
 	{
 		BoundWorldSub->TurnReadyResolver.Unbind();
 		BoundWorldSub->TurnConsumeNotifier.Unbind();
+		BoundWorldSub->RemoveSimulationThreadVeto(SimulationThreadVetoHandle);
 		BoundWorldSub->ClearAIEmitInterceptor();
 		BoundWorldSub->ClearLocalCommandSubmitter();
 		if (TickCompletedHandle.IsValid())
@@ -582,13 +586,20 @@ void USeinNetSubsystem::ResetLockstepEpochState(UWorld* RetiringWorld)
 	{
 		TickCompletedHandle.Reset();
 		ExecutionTopologyInvalidatedHandle.Reset();
+		SimulationThreadVetoHandle.Reset();
 		CachedWorldSub.Reset();
 	}
 	ReleaseWorldOwnedAI(RetiringWorld);
 
 	TurnAggregator.Reset();
 	ConfigureTurnAggregator();
+	ConfigureAdaptiveInputDelay();
 	ReceivedTurns.Reset();
+	ReceivedTurnControls.Reset();
+	ActiveInputDelayTurns = 0;
+	HighestAnnouncedInputDelayTurns = 0;
+	ServerLastPipelineTurn = -1;
+	GateStallHistogram.Reset();
 	RetainedAssembledTurns.Reset();
 	RetainedAssembledTurnFloor = -1;
 	ServerResyncServes.Reset();
@@ -610,6 +621,12 @@ void USeinNetSubsystem::ResetLockstepEpochState(UWorld* RetiringWorld)
 	PendingWorldStateRootReports.Reset();
 	LastWorldStateRootQueuedTurn = -1;
 	LastWorldStateRootReportedTurn = -1;
+	DesyncProofImages.Reset();
+	DesyncProofWalk.Reset();
+	DesyncProofStartedAtTurn = INDEX_NONE;
+	DesyncProofReferenceResponse.Reset();
+	DesyncProofDivergentResponse.Reset();
+	LastDesyncLocalization = FSeinDesyncLocalization();
 	DeterminismSessionFailure = FSeinDeterminismSessionFailure();
 	bDeterminismSessionFailureAuthoritative = false;
 	LocalDeterminismFailureDiagnostic.Reset();
@@ -689,11 +706,41 @@ int32 USeinNetSubsystem::GetTicksPerTurn() const
 }
 
 int32 USeinNetSubsystem::GetInputDelayTurns() const
+{
+	return ActiveInputDelayTurns > 0
+		? ActiveInputDelayTurns
+		: GetConfiguredInputDelayTurns();
+}
+
+int32 USeinNetSubsystem::GetConfiguredInputDelayTurns() const
 {
 	const USeinARTSCoreSettings* Settings = GetDefault<USeinARTSCoreSettings>();
 	return (Settings && Settings->InputDelayTurns > 0) ? Settings->InputDelayTurns : 3;
 }
 
+int32 USeinNetSubsystem::GetInputDelayTurnsBound() const
+{
+	return FMath::Max3(
+		GetInputDelayTurns(),
+		HighestAnnouncedInputDelayTurns,
+		AdaptiveInputDelay.GetLatestDelay());
+}
+
+void USeinNetSubsystem::ConfigureAdaptiveInputDelay()
+{
+	const USeinARTSCoreSettings* Settings = GetDefault<USeinARTSCoreSettings>();
+	FSeinAdaptiveInputDelayConfig Config;
+	Config.bEnabled = Settings && Settings->bAdaptiveInputDelay;
+	Config.InitialDelayTurns = GetConfiguredInputDelayTurns();
+	if (Settings)
+	{
+		Config.MinDelayTurns = Settings->MinAdaptiveInputDelayTurns;
+		Config.MaxDelayTurns = Settings->MaxAdaptiveInputDelayTurns;
+		Config.WindowTurns = Settings->AdaptiveInputDelayWindowTurns;
+	}
+	AdaptiveInputDelay.Configure(Config);
+}
+
 int32 USeinNetSubsystem::GetCurrentTurn() const
 {
 #if WITH_DEV_AUTOMATION_TESTS
@@ -747,7 +794,7 @@ bool USeinNetSubsystem::IsCommandTurnWithinProtocolWindow(int32 TurnId, const TC
 		return false;
 	}
 
-	const int64 MaxAccepted = static_cast<int64>(CurrentTurn) + GetInputDelayTurns() + GSeinMaxProtocolTurnLead;
+	const int64 MaxAccepted = static_cast<int64>(CurrentTurn) + GetInputDelayTurnsBound() + GSeinMaxProtocolTurnLead;
 	if (static_cast<int64>(TurnId) > MaxAccepted)
 	{
 		UE_LOG(LogSeinNet, Warning,
@@ -907,6 +954,10 @@ void USeinNetSubsystem::PruneProtocolState(int32 ReferenceTurn)
 	{
 		if (It.Key() <= TurnAggregator.GetTurnRejectionFloor()) It.RemoveCurrent();
 	}
+	for (auto It = ReceivedTurnControls.CreateIterator(); It; ++It)
+	{
+		if (It.Key() <= TurnAggregator.GetTurnRejectionFloor()) It.RemoveCurrent();
+	}
 	int32 RetainedTailCutoff = Cutoff;
 	if (IsServer())
 	{
@@ -1112,6 +1163,12 @@ bool USeinNetSubsystem::IsConfigParityCheckEnabled() const
 	return Settings && Settings->bConfigParityCheckEnabled;
 }
 
+bool USeinNetSubsystem::IsDesyncLocalizationEnabled() const
+{
+	const USeinARTSCoreSettings* Settings = GetDefault<USeinARTSCoreSettings>();
+	return Settings && Settings->bDesyncLocalizationEnabled;
+}
+
 int32 USeinNetSubsystem::GetDeterminismCheckIntervalTurns() const
 {
 #if WITH_DEV_AUTOMATION_TESTS
@@ -1860,8 +1917,13 @@ bool USeinNetSubsystem::PreflightCanonicalTurnBatch(
 	{
 		return FindFrozenCommandSchema(Type, Version, Out);
 	};
-	if (!FSeinNetCommandWireCodec::EncodeCommands(
+	// Reserve the control trailer the committed turn will carry.
+	FSeinTurnControlRecord Control;
+	Control.InputDelayTurns = static_cast<uint8>(
+		AdaptiveInputDelay.GetLatestDelay());
+	if (!FSeinNetCommandWireCodec::EncodeTurn(
 		Commands,
+		Control,
 		MaxCommands,
 		FindSchema,
 		Encoded,
@@ -2986,6 +3048,7 @@ USeinWorldSubsystem* USeinNetSubsystem::BindLockstepHooksForCurrentWorld()
 		{
 			Previous->TurnReadyResolver.Unbind();
 			Previous->TurnConsumeNotifier.Unbind();
+			Previous->RemoveSimulationThreadVeto(SimulationThreadVetoHandle);
 			Previous->ClearAIEmitInterceptor();
 			Previous->ClearLocalCommandSubmitter();
 			if (TickCompletedHandle.IsValid())
@@ -3000,6 +3063,7 @@ USeinWorldSubsystem* USeinNetSubsystem::BindLockstepHooksForCurrentWorld()
 		}
 		TickCompletedHandle.Reset();
 		ExecutionTopologyInvalidatedHandle.Reset();
+		SimulationThreadVetoHandle.Reset();
 		CachedWorldSub = WorldSub;
 	}
 
@@ -3016,6 +3080,19 @@ USeinWorldSubsystem* USeinNetSubsystem::BindLockstepHooksForCurrentWorld()
 			Self->ConsumeTurn(Turn);
 		}
 	});
+	// The replay writer observes every exact tick on the game thread. Turn
+	// gossip does not need to: a dedicated-thread batch never crosses a
+	// second turn boundary, so the join runs OnSimTickCompleted while the
+	// world still sits on the tick that closed the turn. Rebinding to the
+	// same world replaces only this subsystem's own veto.
+	WorldSub->RemoveSimulationThreadVeto(SimulationThreadVetoHandle);
+	SimulationThreadVetoHandle = WorldSub->AddSimulationThreadVeto(
+		FSeinSimulationThreadVeto::CreateLambda([WeakSelf]()
+		{
+			const USeinNetSubsystem* Self = WeakSelf.Get();
+			return Self && Self->ReplayWriter
+				&& Self->ReplayWriter->IsRecording();
+		}));
 	FSeinAIEmitInterceptor AIInterceptor;
 	AIInterceptor.BindLambda([WeakSelf](FSeinPlayerID Slot, const FSeinCommand& Cmd) -> bool
 	{
@@ -4198,7 +4275,7 @@ void USeinNetSubsystem::TryLaunchLocalBootstrap()
 	// the queue ledger; relay-assignment races retain this exact heartbeat.
 	if (LocalPlayerID.IsValid())
 	{
-		const int32 InputDelay = GetInputDelayTurns();
+		const int32 InputDelay = GetConfiguredInputDelayTurns();
 		if (LastQueuedTurn < InputDelay)
 		{
 			QueueTurnSubmissionsThrough(
@@ -4950,7 +5027,9 @@ bool USeinNetSubsystem::ResolveTurnReady(int32 Turn)
 	// pass them. This matches the heartbeat schedule below — first heartbeat
 	// is for turn `0 + InputDelay`, fired after sim's first turn worth of
 	// ticks complete, so turn `InputDelay` is the first gated turn.
-	if (Turn < GetInputDelayTurns()) return true;
+	// Adaptive changes ride inside committed turns, so the grace window is
+	// always the configured delay.
+	if (Turn < GetConfiguredInputDelayTurns()) return true;
 
 	const bool bReady = ReceivedTurns.Contains(Turn);
 	if (!bReady)
@@ -5019,6 +5098,7 @@ bool USeinNetSubsystem::ResolveTurnReady(int32 Turn)
 		// transient blip starts fresh.
 		if (Turn == LastStalledTurn)
 		{
+			GateStallHistogram.Add(FPlatformTime::Seconds() - FirstStalledAtTime);
 			LastStalledTurn = -1;
 			FirstStalledAtTime = 0.0;
 			bStallLogEscalated = false;
@@ -5029,6 +5109,19 @@ bool USeinNetSubsystem::ResolveTurnReady(int32 Turn)
 
 void USeinNetSubsystem::ConsumeTurn(int32 Turn)
 {
+	// The record governs the boundary that ends this turn: every peer
+	// consumes it before computing that boundary's outgoing turn.
+	FSeinTurnControlRecord Control;
+	if (ReceivedTurnControls.RemoveAndCopyValue(Turn, Control)
+		&& Control.IsSet()
+		&& Control.InputDelayTurns != GetInputDelayTurns())
+	{
+		UE_LOG(LogSeinNet, Log,
+			TEXT("Input delay %d -> %d turns from turn %d (coordinator schedule)."),
+			GetInputDelayTurns(), Control.InputDelayTurns, Turn);
+		ActiveInputDelayTurns = Control.InputDelayTurns;
+	}
+
 	TArray<FSeinCommand> Drained;
 	if (!ReceivedTurns.RemoveAndCopyValue(Turn, Drained))
 	{
@@ -5150,6 +5243,10 @@ void USeinNetSubsystem::OnSimTickCompleted(int32 CompletedTick)
 	{
 		MaybeSubmitWorldStateRootCheck(JustFinishedTurn);
 	}
+	if (DesyncProofWalk.IsActive())
+	{
+		ServerExpireDesyncLocalization(JustFinishedTurn);
+	}
 	if (DeterminismSessionFailure.IsValid()) return;
 
 	PruneProtocolState(JustFinishedTurn);
@@ -5162,9 +5259,21 @@ void USeinNetSubsystem::OnSimTickCompleted(int32 CompletedTick)
 	if (IsServer())
 	{
 		// Heartbeats target the OUTGOING turn (= JustFinishedTurn + InputDelay).
-		// That's the turn the next gate completion will need a slot from.
+		// That's the turn the next gate completion will need a slot from. A
+		// raised delay skips turns the previous boundary never reached; they
+		// get the same treatment first so dropped slots cannot stall them.
+		const int32 FirstPipelineTurn = FMath::Max3(
+			ServerLastPipelineTurn + 1,
+			GetConfiguredInputDelayTurns(),
+			OutgoingTurn - SeinNetProtocolLimits::MaxInputDelayTurns);
+		for (int32 Turn = FirstPipelineTurn; Turn < OutgoingTurn; ++Turn)
+		{
+			InjectDroppedSlotHeartbeats(Turn, /*bAllowAICommands=*/true);
+			ServerCheckTurnComplete(Turn);
+		}
 		InjectDroppedSlotHeartbeats(OutgoingTurn, /*bAllowAICommands=*/true);
 		ServerCheckTurnComplete(OutgoingTurn);
+		ServerLastPipelineTurn = FMath::Max(ServerLastPipelineTurn, OutgoingTurn);
 		EvaluateDroppedSlots();
 		ServerAdvanceResyncTransfers();
 		ServerAdvanceResyncActivation(JustFinishedTurn);
@@ -5173,7 +5282,7 @@ void USeinNetSubsystem::OnSimTickCompleted(int32 CompletedTick)
 
 void USeinNetSubsystem::QueueTurnSubmissionsThrough(int32 FinalTurn, bool bAttachCurrentCommands)
 {
-	const int32 InputDelay = GetInputDelayTurns();
+	const int32 InputDelay = GetConfiguredInputDelayTurns();
 	const int32 FirstTurn = FMath::Max3(LastQueuedTurn + 1, LastSubmittedTurn + 1, InputDelay);
 	if (FirstTurn > FinalTurn) return;
 
@@ -6106,6 +6215,7 @@ void USeinNetSubsystem::ServerHandleSubmission(
 		*ParticipantID.ToCanonicalString(), Slot.Value, TurnId, Drafts.Num(),
 		TurnAggregator.GetSubmittedAuthorCount(TurnId), GetActiveSlotCount());
 
+	AdaptiveInputDelay.RecordSubmission(Slot, TurnId, GetCurrentTurn());
 	ServerCheckTurnComplete(TurnId, Slot);
 }
 
@@ -6262,7 +6372,7 @@ void USeinNetSubsystem::
 
 	TArray<int32> Turns = TurnAggregator.GetPendingTurnIDs();
 	const int32 CurrentTurn = GetCurrentTurn();
-	const int32 PipelineEndTurn = CurrentTurn + GetInputDelayTurns();
+	const int32 PipelineEndTurn = CurrentTurn + GetInputDelayTurnsBound();
 	for (int32 Turn = CurrentTurn; Turn <= PipelineEndTurn; ++Turn)
 	{
 		Turns.AddUnique(Turn);
@@ -7016,7 +7126,7 @@ void USeinNetSubsystem::ServerHandleResyncReady(
 	// The boundary must clear the peer's maximum legal lead plus headroom.
 	Serve->ActivationCheckTurn =
 		GetCurrentTurn() + GSeinMaxProtocolTurnLead
-		+ GetInputDelayTurns() + 2;
+		+ GetInputDelayTurnsBound() + 2;
 	Serve->LocalActivationRoot.Reset();
 	Serve->PeerActivationRoot.Reset();
 	Serve->LastProgressAtSeconds = FPlatformTime::Seconds();
@@ -7083,7 +7193,7 @@ void USeinNetSubsystem::ServerTryCompleteResyncActivation(FSeinPlayerID Slot)
 	// turns already heartbeat-injected while the slot was Reconnecting).
 	const int32 FirstAuthoredTurn =
 		FMath::Max(Serve->ActivationCheckTurn, GetCurrentTurn())
-		+ GetInputDelayTurns() + 2;
+		+ GetInputDelayTurnsBound() + 2;
 	HeartbeatCoverageThroughTurn.Add(Slot, FirstAuthoredTurn - 1);
 	// Waive root-report obligations for boundaries the peer completed while
 	// suppressed — they can never be back-reported (see the expiry loop).
@@ -7301,7 +7411,7 @@ void USeinNetSubsystem::RecoverClientWorldAfterResyncReset(
 			? WorldSub.GetCurrentTick() / TicksPerTurn
 			: 0;
 		const int32 ReconciledCursor =
-			AdoptedTurn + GetInputDelayTurns();
+			AdoptedTurn + GetInputDelayTurnsBound();
 		LastQueuedTurn = FMath::Max(LastQueuedTurn, ReconciledCursor);
 		LastSubmittedTurn =
 			FMath::Max(LastSubmittedTurn, ReconciledCursor);
@@ -7557,6 +7667,10 @@ void USeinNetSubsystem::ClientHandleEndCheckpointTransfer(
 	{
 		if (It.Key() <= ClientResyncCheckpointTurn) It.RemoveCurrent();
 	}
+	for (auto It = ReceivedTurnControls.CreateIterator(); It; ++It)
+	{
+		if (It.Key() <= ClientResyncCheckpointTurn) It.RemoveCurrent();
+	}
 
 	// Catch up on the tail through the normal delivery path: request the
 	// retained turns, start the dormant reservation, and let the standard
@@ -7702,7 +7816,7 @@ void USeinNetSubsystem::MaybeAutoRequestResync(int32 RejectedLiveTurn)
 	// turns are ordinary late deliveries). Require a real gap so a boundary
 	// race cannot trigger a spurious resync.
 	const int32 Lead = RejectedLiveTurn - GetCurrentTurn();
-	if (Lead <= GetInputDelayTurns() + GSeinMaxProtocolTurnLead)
+	if (Lead <= GetInputDelayTurnsBound() + GSeinMaxProtocolTurnLead)
 	{
 		return;
 	}
@@ -7917,10 +8031,18 @@ void USeinNetSubsystem::ServerCheckTurnComplete(
 
 	FinalizeCompletedTurnDiagnostics(TurnId, CompletingSubmitter);
 
+	// Every turn carries the scheduled delay while adaptation is on, not just
+	// the turn that changes it, so a peer resuming from any retained turn
+	// adopts the right value.
+	FSeinTurnControlRecord Control;
+	Control.InputDelayTurns = static_cast<uint8>(
+		AdaptiveInputDelay.StampTurn(TurnId, GetCurrentTurn()));
+
 	FSeinOpaqueCommandBatch OpaqueAssembled;
 	FString WireError;
-	if (!FSeinNetCommandWireCodec::EncodeCommands(
+	if (!FSeinNetCommandWireCodec::EncodeTurn(
 		Assembled,
+		Control,
 		GetMaxCommandsPerCanonicalTurn(),
 		[this](FGameplayTag Type, int32 Version, FSeinCommandSchemaDescriptor& Out)
 		{
@@ -7939,7 +8061,8 @@ void USeinNetSubsystem::ServerCheckTurnComplete(
 	// same canonical representation as every remote peer (including container
 	// normalization performed by the bounded decoder).
 	TArray<FSeinCommand> WireCanonicalAssembled;
-	if (!FSeinNetCommandWireCodec::DecodeCommands(
+	FSeinTurnControlRecord WireControl;
+	if (!FSeinNetCommandWireCodec::DecodeTurn(
 		OpaqueAssembled,
 		GetMaxCommandsPerCanonicalTurn(),
 		[this](FGameplayTag Type, int32 Version, FSeinCommandSchemaDescriptor& Out)
@@ -7947,6 +8070,7 @@ void USeinNetSubsystem::ServerCheckTurnComplete(
 			return FindFrozenCommandSchema(Type, Version, Out);
 		},
 		WireCanonicalAssembled,
+		WireControl,
 		WireError))
 	{
 		UE_LOG(LogSeinNet, Error,
@@ -7998,7 +8122,7 @@ void USeinNetSubsystem::ServerCheckTurnComplete(
 	// committed synchronously from logout/reconnect recovery.
 	const bool bBufferedLocalAuthority =
 		BufferAssembledTurnForLocalAuthority(
-			TurnId, WireCanonicalAssembled);
+			TurnId, WireCanonicalAssembled, WireControl);
 
 	for (const TWeakObjectPtr<ASeinNetRelay>& Wp : Relays)
 	{
@@ -8026,19 +8150,31 @@ void USeinNetSubsystem::ServerCheckTurnComplete(
 }
 
 bool USeinNetSubsystem::BufferAssembledTurnForLocalAuthority(
-	int32 TurnId, const TArray<FSeinCommand>& Commands)
+	int32 TurnId,
+	const TArray<FSeinCommand>& Commands,
+	const FSeinTurnControlRecord& Control)
 {
 	if (IsServer())
 	{
-		BufferReceivedTurn(TurnId, Commands);
+		BufferReceivedTurn(TurnId, Commands, Control);
 		return true;
 	}
 	return false;
 }
 
-void USeinNetSubsystem::BufferReceivedTurn(int32 TurnId, const TArray<FSeinCommand>& Commands)
+void USeinNetSubsystem::BufferReceivedTurn(
+	int32 TurnId,
+	const TArray<FSeinCommand>& Commands,
+	const FSeinTurnControlRecord& Control)
 {
 	ReceivedTurns.Add(TurnId, Commands);
+	if (Control.IsSet())
+	{
+		ReceivedTurnControls.Add(TurnId, Control);
+		HighestAnnouncedInputDelayTurns = FMath::Max(
+			HighestAnnouncedInputDelayTurns,
+			static_cast<int32>(Control.InputDelayTurns));
+	}
 	if (ClientResyncPhase == EClientResyncPhase::CatchingUp
 		|| ClientResyncPhase == EClientResyncPhase::Adopting)
 	{
@@ -8092,8 +8228,9 @@ void USeinNetSubsystem::ClientHandleTurn(
 		}
 	}
 	TArray<FSeinCommand> Commands;
+	FSeinTurnControlRecord Control;
 	FString WireError;
-	if (!FSeinNetCommandWireCodec::DecodeCommands(
+	if (!FSeinNetCommandWireCodec::DecodeTurn(
 		OpaqueCommands,
 		GetMaxCommandsPerCanonicalTurn(),
 		[this](FGameplayTag Type, int32 Version, FSeinCommandSchemaDescriptor& Out)
@@ -8101,6 +8238,7 @@ void USeinNetSubsystem::ClientHandleTurn(
 			return FindFrozenCommandSchema(Type, Version, Out);
 		},
 		Commands,
+		Control,
 		WireError))
 	{
 		UE_LOG(LogSeinNet, Warning,
@@ -8166,7 +8304,7 @@ void USeinNetSubsystem::ClientHandleTurn(
 		ClientResyncTailReceivedBytes = NextTailBytes;
 		ClientResyncTailReceivedTurnIds.Add(TurnId);
 	}
-	BufferReceivedTurn(TurnId, Commands);
+	BufferReceivedTurn(TurnId, Commands, Control);
 }
 
 USeinReplayReader* USeinNetSubsystem::GetOrCreateReplayReader()
@@ -8211,9 +8349,9 @@ void USeinNetSubsystem::RecordStragglerIfApplicable(int32 TurnId, FSeinPlayerID
 
 	// Recommend bumping InputDelayTurns once a peer crosses 5% straggle rate
 	// over a meaningful sample size. Rate-limit to once every 64 turns to
-	// avoid log spam. Designers can manually raise InputDelayTurns in
-	// settings; full automatic dynamic-delay adjustment is deferred (see the
-	// header note next to StragglerCounts).
+	// avoid log spam. With bAdaptiveInputDelay the scheduler already reacts
+	// to the same lateness, so the recommendation is left to the report.
+	if (AdaptiveInputDelay.IsEnabled()) return;
 	const int32 RECOMMEND_INTERVAL_TURNS = 64;
 	const int32 SAMPLE_THRESHOLD = 50;
 	if (TurnsCompletedCount >= SAMPLE_THRESHOLD &&
@@ -8223,7 +8361,7 @@ void USeinNetSubsystem::RecordStragglerIfApplicable(int32 TurnId, FSeinPlayerID
 		if (Rate > 0.05f)
 		{
 			UE_LOG(LogSeinNet, Warning,
-				TEXT("[ADAPTIVE INPUT DELAY] slot=%u completed after the execution gate on %d / %d turns (%.1f%%). Consider raising USeinARTSCoreSettings::InputDelayTurns to absorb this peer's latency. Today this is a manual change; automatic dynamic adjustment is a future polish item."),
+				TEXT("[ADAPTIVE INPUT DELAY] slot=%u completed after the execution gate on %d / %d turns (%.1f%%). Consider raising USeinARTSCoreSettings::InputDelayTurns or enabling bAdaptiveInputDelay to absorb this peer's latency."),
 				LastSubmittingSlot.Value, Count, TurnsCompletedCount, Rate * 100.0f);
 		}
 	}
@@ -8353,6 +8491,7 @@ void USeinNetSubsystem::MaybeSubmitWorldStateRootCheck(int32 JustFinishedTurn)
 		return;
 	}
 
+	RetainDesyncProofImage(JustFinishedTurn);
 	EnqueueWorldStateRootReport(JustFinishedTurn, LocalWorldRoot);
 	FlushPendingWorldStateRootReports();
 }
@@ -9266,6 +9405,7 @@ void USeinNetSubsystem::ServerCompareWorldStateRootsForTurn(int32 Turn)
 					ActiveProtocolContext, Turn, SortedRoots);
 			}
 		}
+		ServerBeginDesyncLocalization(Turn, SortedRoots);
 	}
 
 	ServerWorldStateRootReports.Remove(Turn);
@@ -9326,3 +9466,342 @@ void USeinNetSubsystem::ClientHandleDesyncNotification(
 			/*bNewerOnTop=*/true, FVector2D(1.0f, 1.0f));
 	}
 }
+
+// ============================================================================
+// Desync localisation
+// ============================================================================
+
+void USeinNetSubsystem::RetainDesyncProofImage(int32 Turn)
+{
+	if (!IsDesyncLocalizationEnabled()) return;
+	const UWorld* World = GetWorld();
+	const USeinWorldSubsystem* WorldSub =
+		World ? World->GetSubsystem<USeinWorldSubsystem>() : nullptr;
+	if (!WorldSub) return;
+
+	const FSeinCanonicalStateProofImage* Previous = DesyncProofImages.IsEmpty()
+		? nullptr
+		: &DesyncProofImages.Last().Value;
+	FSeinCanonicalStateProofImage Image;
+	FString ImageError;
+	if (!WorldSub->CaptureCanonicalStateProofImage(
+			WorldSub->GetCurrentTick(), Previous, Image, ImageError))
+	{
+		// Localisation is best-effort; the root report itself still goes out.
+		UE_LOG(LogSeinNet, Verbose,
+			TEXT("[DETERMINISM] no proof image for turn=%d: %s"),
+			Turn, *ImageError);
+		return;
+	}
+
+	const USeinARTSCoreSettings* Settings = GetDefault<USeinARTSCoreSettings>();
+	const int32 Retained = FMath::Clamp(
+		Settings ? Settings->DesyncProofRetainedChecks : 3, 1, 16);
+	DesyncProofImages.Emplace(Turn, MoveTemp(Image));
+	if (DesyncProofImages.Num() > Retained)
+	{
+		DesyncProofImages.RemoveAt(
+			0, DesyncProofImages.Num() - Retained, EAllowShrinking::No);
+	}
+}
+
+void USeinNetSubsystem::AnswerDesyncProofQuery(
+	int32 Turn,
+	const FSeinDesyncProofQuery& Query,
+	FSeinDesyncProofResponse& OutResponse) const
+{
+	const TPair<int32, FSeinCanonicalStateProofImage>* Retained =
+		DesyncProofImages.FindByPredicate(
+			[Turn](const TPair<int32, FSeinCanonicalStateProofImage>& Entry)
+			{
+				return Entry.Key == Turn;
+			});
+	const UWorld* World = GetWorld();
+	const USeinWorldSubsystem* WorldSub =
+		World ? World->GetSubsystem<USeinWorldSubsystem>() : nullptr;
+	if (!Retained || !WorldSub)
+	{
+		OutResponse = FSeinDesyncProofResponse();
+		OutResponse.Error = FString::Printf(
+			TEXT("participant %s retains no proof image for turn %d"),
+			*LocalParticipantID.ToCanonicalString(), Turn);
+		return;
+	}
+	const FSeinCanonicalStateProofImage& Image = Retained->Value;
+	FSeinDesyncProofWalk::Answer(
+		Image,
+		Query,
+		[WorldSub, &Image](
+			FStringView SectionId,
+			int32 LeafIndex,
+			FSeinCanonicalStateProofLeaf& OutLeaf,
+			FString& OutError)
+		{
+			return WorldSub->DescribeCanonicalStateProofLeaf(
+				Image, SectionId, LeafIndex, OutLeaf, OutError);
+		},
+		OutResponse);
+}
+
+ASeinNetRelay* USeinNetSubsystem::FindRelayForParticipant(
+	FSeinNetworkParticipantID ParticipantID) const
+{
+	for (const TPair<TWeakObjectPtr<ASeinNetRelay>, FSeinNetworkParticipantID>& Pair :
+		RelayToParticipant)
+	{
+		if (Pair.Value == ParticipantID)
+		{
+			if (ASeinNetRelay* Relay = Pair.Key.Get())
+			{
+				return Relay;
+			}
+		}
+	}
+	return nullptr;
+}
+
+void USeinNetSubsystem::ServerBeginDesyncLocalization(
+	int32 Turn,
+	const TArray<FSeinParticipantWorldRootEntry>& SortedRoots)
+{
+	if (!IsDesyncLocalizationEnabled() || !IsLocalProtocolCoordinator()) return;
+	if (DesyncProofWalk.IsActive())
+	{
+		UE_LOG(LogSeinNet, Log,
+			TEXT("[DESYNC] localisation of turn=%d still running; turn=%d is not walked."),
+			DesyncProofWalk.GetResult().Turn, Turn);
+		return;
+	}
+
+	// The most common root is taken as expected; ties resolve to the first
+	// root in participant order so every run picks the same pair.
+	TMap<FGuid, int32> RootVotes;
+	for (const FSeinParticipantWorldRootEntry& Entry : SortedRoots)
+	{
+		++RootVotes.FindOrAdd(Entry.WorldRoot);
+	}
+	const FSeinParticipantWorldRootEntry* Reference = nullptr;
+	for (const FSeinParticipantWorldRootEntry& Entry : SortedRoots)
+	{
+		if (!Reference
+			|| RootVotes[Entry.WorldRoot] > RootVotes[Reference->WorldRoot])
+		{
+			Reference = &Entry;
+		}
+	}
+	const FSeinParticipantWorldRootEntry* Divergent = Reference
+		? SortedRoots.FindByPredicate(
+			[Reference](const FSeinParticipantWorldRootEntry& Entry)
+			{
+				return Entry.WorldRoot != Reference->WorldRoot;
+			})
+		: nullptr;
+	if (!Divergent) return;
+
+	UE_LOG(LogSeinNet, Log,
+		TEXT("[DESYNC] localising turn=%d: walking participant %s (reference) against %s."),
+		Turn,
+		*Reference->ParticipantID.ToCanonicalString(),
+		*Divergent->ParticipantID.ToCanonicalString());
+	DesyncProofWalk.Begin(
+		Turn, Reference->ParticipantID, Divergent->ParticipantID);
+	DesyncProofStartedAtTurn = Turn;
+	ServerIssueDesyncProofQuery();
+}
+
+void USeinNetSubsystem::ServerIssueDesyncProofQuery()
+{
+	const int32 ProbeId = ++DesyncProofProbeId;
+	DesyncProofReferenceResponse.Reset();
+	DesyncProofDivergentResponse.Reset();
+	// Copied: a local answer can advance the walk and replace the query.
+	const FSeinDesyncProofQuery Query = DesyncProofWalk.GetPendingQuery();
+	const FSeinDesyncLocalization& Result = DesyncProofWalk.GetResult();
+	const int32 Turn = Result.Turn;
+	const FSeinNetworkParticipantID Participants[] = {
+		Result.ReferenceParticipantID,
+		Result.DivergentParticipantID};
+
+	for (const FSeinNetworkParticipantID ParticipantID : Participants)
+	{
+		if (!DesyncProofWalk.IsActive() || ProbeId != DesyncProofProbeId)
+		{
+			return;
+		}
+		if (ParticipantID == LocalParticipantID)
+		{
+			FSeinDesyncProofResponse Response;
+			AnswerDesyncProofQuery(Turn, Query, Response);
+			ServerAcceptDesyncProofResponse(ParticipantID, ProbeId, Response);
+			continue;
+		}
+		ASeinNetRelay* Target = FindRelayForParticipant(ParticipantID);
+		if (!Target || !IsParticipantConnected(ParticipantID))
+		{
+			DesyncProofWalk.Abort(FString::Printf(
+				TEXT("participant %s is no longer connected"),
+				*ParticipantID.ToCanonicalString()));
+			ServerFinishDesyncLocalization();
+			return;
+		}
+		Target->Client_RequestDesyncProof(
+			ActiveProtocolContext, ProbeId, Turn, Query);
+	}
+}
+
+void USeinNetSubsystem::ClientHandleDesyncProofRequest(
+	ASeinNetRelay* SourceRelay,
+	const FSeinProtocolContext& Context,
+	int32 ProbeId,
+	int32 Turn,
+	const FSeinDesyncProofQuery& Query)
+{
+	if (!SourceRelay) return;
+	if (!IsCurrentProtocolContext(
+		Context, TEXT("ClientHandleDesyncProofRequest")))
+	{
+		return;
+	}
+	FSeinDesyncProofResponse Response;
+	AnswerDesyncProofQuery(Turn, Query, Response);
+	SourceRelay->Server_ReportDesyncProof(Context, ProbeId, Response);
+}
+
+void USeinNetSubsystem::ServerHandleDesyncProofResponse(
+	ASeinNetRelay* SourceRelay,
+	const FSeinProtocolContext& Context,
+	int32 ProbeId,
+	const FSeinDesyncProofResponse& Response)
+{
+	if (!IsServer() || !SourceRelay) return;
+	if (!IsCurrentProtocolContext(
+		Context, TEXT("ServerHandleDesyncProofResponse")))
+	{
+		return;
+	}
+	const FSeinNetworkParticipantID* ParticipantPtr =
+		RelayToParticipant.Find(SourceRelay);
+	if (!ParticipantPtr || !ParticipantPtr->IsValid())
+	{
+		UE_LOG(LogSeinNet, Warning,
+			TEXT("[DESYNC] dropping proof answer from unmapped relay %s (probe %d)."),
+			*GetNameSafe(SourceRelay), ProbeId);
+		return;
+	}
+	ServerAcceptDesyncProofResponse(*ParticipantPtr, ProbeId, Response);
+}
+
+void USeinNetSubsystem::ServerAcceptDesyncProofResponse(
+	FSeinNetworkParticipantID ParticipantID,
+	int32 ProbeId,
+	const FSeinDesyncProofResponse& Response)
+{
+	if (!DesyncProofWalk.IsActive() || ProbeId != DesyncProofProbeId) return;
+
+	const FSeinDesyncLocalization& Result = DesyncProofWalk.GetResult();
+	if (ParticipantID == Result.ReferenceParticipantID)
+	{
+		DesyncProofReferenceResponse = Response;
+	}
+	else if (ParticipantID == Result.DivergentParticipantID)
+	{
+		DesyncProofDivergentResponse = Response;
+	}
+	else
+	{
+		return;
+	}
+	if (!DesyncProofReferenceResponse.IsSet()
+		|| !DesyncProofDivergentResponse.IsSet())
+	{
+		return;
+	}
+
+	DesyncProofWalk.Advance(
+		DesyncProofReferenceResponse.GetValue(),
+		DesyncProofDivergentResponse.GetValue());
+	if (DesyncProofWalk.IsActive())
+	{
+		ServerIssueDesyncProofQuery();
+	}
+	else
+	{
+		ServerFinishDesyncLocalization();
+	}
+}
+
+void USeinNetSubsystem::ServerExpireDesyncLocalization(int32 JustFinishedTurn)
+{
+	if (!IsLocalProtocolCoordinator()
+		|| JustFinishedTurn - DesyncProofStartedAtTurn
+			< GSeinDesyncProofTimeoutTurns)
+	{
+		return;
+	}
+	DesyncProofWalk.Abort(FString::Printf(
+		TEXT("peers did not answer within %d turns"),
+		GSeinDesyncProofTimeoutTurns));
+	ServerFinishDesyncLocalization();
+}
+
+void USeinNetSubsystem::ServerFinishDesyncLocalization()
+{
+	const FSeinDesyncLocalization Result = DesyncProofWalk.GetResult();
+	DesyncProofWalk.Reset();
+	DesyncProofStartedAtTurn = INDEX_NONE;
+	DesyncProofReferenceResponse.Reset();
+	DesyncProofDivergentResponse.Reset();
+	if (!Result.IsValid()) return;
+
+	// Every peer, the host's own included via relay loopback, gets the same
+	// report the root alarm already announced.
+	bool bDeliveredLocally = false;
+	for (const TWeakObjectPtr<ASeinNetRelay>& Wp : Relays)
+	{
+		if (ASeinNetRelay* Target = Wp.Get())
+		{
+			Target->Client_NotifyDesyncLocalized(
+				ActiveProtocolContext, Result);
+			bDeliveredLocally |= Target == LocalRelay.Get();
+		}
+	}
+	if (!bDeliveredLocally)
+	{
+		ClientHandleDesyncLocalization(ActiveProtocolContext, Result);
+	}
+}
+
+void USeinNetSubsystem::ClientHandleDesyncLocalization(
+	const FSeinProtocolContext& Context,
+	const FSeinDesyncLocalization& Localization)
+{
+	if (!IsCurrentProtocolContext(
+		Context, TEXT("ClientHandleDesyncLocalization")))
+	{
+		return;
+	}
+	LastDesyncLocalization = Localization;
+	UE_LOG(LogSeinNet, Error,
+		TEXT("[DESYNC] localised %s"), *Localization.ToString());
+
+	if (GEngine)
+	{
+		const int32 KeyBase = 0x5E7DE57C;
+		const uint64 KeyTurn = (static_cast<uint64>(KeyBase)
+			^ static_cast<uint64>(Localization.Turn)) ^ 0x2ull;
+		const FString Where = Localization.Leaves.IsEmpty()
+			? FString::Join(Localization.DivergentSections, TEXT(", "))
+			: FString::Printf(
+				TEXT("%s[%d] (+%d more)"),
+				*Localization.Leaves[0].SectionId,
+				Localization.Leaves[0].LeafIndex,
+				Localization.Leaves.Num() - 1);
+		GEngine->AddOnScreenDebugMessage(
+			static_cast<int32>(KeyTurn & 0x7FFFFFFFull),
+			30.0f, FColor(255, 100, 100),
+			FString::Printf(
+				TEXT("  Diverged at: %s — Sein.Net.DumpDesyncReport for values"),
+				Where.IsEmpty() ? TEXT("<no section>") : *Where),
+			/*bNewerOnTop=*/true, FVector2D(1.0f, 1.0f));
+	}
+}
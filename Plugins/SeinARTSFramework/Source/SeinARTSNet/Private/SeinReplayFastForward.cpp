@@ -0,0 +1,333 @@
+/**
+ * SeinARTS Framework - Copyright (c) 2026 Phenom Studios, Inc.
+ *
+ * @file         SeinReplayFastForward.cpp
+ * @author       RJ Macklem
+ * @created      17 Oct 2026
+ * @latest       17 Oct 2026
+ * @brief        Unthrottled replay playback, root verification and checkpoint
+ *               segment planning.
+ */
+
+#include "SeinReplayFastForward.h"
+#include "SeinARTSNet.h"
+#include "SeinReplayReader.h"
+#include "Settings/PluginSettings.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+#include "UObject/StrongObjectPtr.h"
+
+namespace
+{
+	/** Ticks between verified roots, or zero when verification is off. */
+	int32 ResolveVerifyIntervalTicks(const FSeinReplayFastForwardOptions& Options)
+	{
+		if (!Options.bVerifyRoots)
+		{
+			return 0;
+		}
+		const USeinARTSCoreSettings* Settings = GetDefault<USeinARTSCoreSettings>();
+		const int32 TicksPerTurn = (Settings->TurnRate > 0)
+			? FMath::Max(1, Settings->SimulationTickRate / Settings->TurnRate)
+			: 1;
+		const int32 IntervalTurns = Options.VerifyIntervalTurns > 0
+			? Options.VerifyIntervalTurns
+			: (Settings->DeterminismCheckIntervalTurns > 0
+				? Settings->DeterminismCheckIntervalTurns
+				: 10);
+		return TicksPerTurn * IntervalTurns;
+	}
+
+	void PumpGameThreadTasks()
+	{
+		// Reader failure handling is posted to the game thread; no engine loop
+		// runs while fast-forwarding, so drain it here between pumps.
+		FTaskGraphInterface::Get().ProcessThreadUntilIdle(
+			ENamedThreads::GameThread);
+	}
+}
+
+bool SeinReplayFastForward::Run(
+	UWorld& World,
+	const FString& Path,
+	const FSeinReplayFastForwardOptions& Options,
+	FSeinReplayFastForwardReport& OutReport)
+{
+	check(IsInGameThread());
+	OutReport = FSeinReplayFastForwardReport();
+
+	USeinWorldSubsystem* WorldSub = World.GetSubsystem<USeinWorldSubsystem>();
+	if (!WorldSub)
+	{
+		OutReport.FailureReason = TEXT("World has no USeinWorldSubsystem.");
+		return false;
+	}
+
+	TStrongObjectPtr<USeinReplayReader> Reader(NewObject<USeinReplayReader>(&World));
+	if (!Reader->LoadFromFile(Path))
+	{
+		OutReport.FailureReason = TEXT("Replay failed to load (see log).");
+		return false;
+	}
+	OutReport.EndTick = Reader->GetHeader().EndTick;
+
+	const bool bStarted = Options.StartTick > 0
+		? Reader->PlayFromTick(Options.StartTick)
+		: Reader->Play();
+	if (!bStarted)
+	{
+		OutReport.FailureReason = TEXT("Playback was rejected (see log).");
+		return false;
+	}
+	OutReport.StartTick = WorldSub->GetCurrentTick();
+	const bool bStopsEarly = Options.StopTick > 0
+		&& Options.StopTick < OutReport.EndTick;
+	const int32 StopTick = bStopsEarly ? Options.StopTick : OutReport.EndTick;
+	if (bStopsEarly && StopTick <= OutReport.StartTick)
+	{
+		OutReport.FailureReason = FString::Printf(
+			TEXT("StopTick %d is not after the restored start tick %d."),
+			StopTick, OutReport.StartTick);
+		Reader->Stop();
+		WorldSub->StopSimulation();
+		return false;
+	}
+	if (OutReport.StartTick > 0 && WorldSub->IsSimulationRunning())
+	{
+		// The restored checkpoint is the seam a previous segment must reach.
+		FString RootError;
+		if (!WorldSub->ComputeCanonicalStateRoot(OutReport.StartRoot, RootError))
+		{
+			OutReport.FailureReason = FString::Printf(
+				TEXT("Restored root at tick %d unavailable: %s"),
+				OutReport.StartTick, *RootError);
+			Reader->Stop();
+			WorldSub->StopSimulation();
+			return false;
+		}
+	}
+
+	const int32 VerifyIntervalTicks = ResolveVerifyIntervalTicks(Options);
+	const int32 MaxTicksPerBatch = FMath::Max(1, Options.MaxTicksPerBatch);
+
+	WorldSub->SetSystemTickTimingEnabled(true);
+	const double StartedAt = FPlatformTime::Seconds();
+	bool bStalledOnce = false;
+	while (Reader->IsPlaying())
+	{
+		const int32 Tick = WorldSub->GetCurrentTick();
+		const int32 Budget = FMath::Min(
+			StopTick - Tick,
+			VerifyIntervalTicks > 0
+				? (Tick / VerifyIntervalTicks + 1) * VerifyIntervalTicks - Tick
+				: MaxTicksPerBatch);
+		const int32 Advanced = WorldSub->AdvanceSimulationUnthrottled(Budget);
+		PumpGameThreadTasks();
+		if (Advanced == 0)
+		{
+			// One retry after the task drain lets a queued reader failure or
+			// completion land; a second empty pump is a genuine stall.
+			if (bStalledOnce && Reader->IsPlaying())
+			{
+				OutReport.FailureReason = FString::Printf(
+					TEXT("Playback stalled at tick %d."),
+					WorldSub->GetCurrentTick());
+				Reader->Stop();
+				break;
+			}
+			bStalledOnce = true;
+			continue;
+		}
+		bStalledOnce = false;
+
+		const int32 ReachedTick = WorldSub->GetCurrentTick();
+		if (VerifyIntervalTicks > 0
+			&& WorldSub->IsSimulationRunning()
+			&& ReachedTick % VerifyIntervalTicks == 0)
+		{
+			FSeinReplayFastForwardRoot& Verified =
+				OutReport.VerifiedRoots.AddDefaulted_GetRef();
+			Verified.Tick = ReachedTick;
+			FString VerifyError;
+			bool bMismatch = false;
+			if (!WorldSub->VerifyIncrementalCanonicalStateRootDetailed(
+					Verified.Root, VerifyError, bMismatch))
+			{
+				OutReport.FailureReason = FString::Printf(
+					TEXT("Canonical root %s at tick %d: %s"),
+					bMismatch ? TEXT("mismatch") : TEXT("unavailable"),
+					ReachedTick,
+					*VerifyError);
+				Reader->Stop();
+				break;
+			}
+		}
+		if (bStopsEarly && ReachedTick >= StopTick)
+		{
+			// Seal while the reader still owns the running sim, then abort:
+			// an explicit Stop leaves the simulation to us.
+			FString RootError;
+			if (!WorldSub->ComputeCanonicalStateRoot(OutReport.FinalRoot, RootError))
+			{
+				OutReport.FailureReason = FString::Printf(
+					TEXT("Sealed root at tick %d unavailable: %s"),
+					ReachedTick, *RootError);
+			}
+			Reader->Stop();
+			WorldSub->StopSimulation();
+			break;
+		}
+	}
+	OutReport.WallSeconds = FPlatformTime::Seconds() - StartedAt;
+	WorldSub->GetSystemTickTimings(OutReport.SystemTimings);
+	WorldSub->SetSystemTickTimingEnabled(false);
+
+	const int32 FinalTick = WorldSub->GetCurrentTick();
+	OutReport.TicksSimulated = FinalTick - OutReport.StartTick;
+	OutReport.TicksPerSecond = OutReport.WallSeconds > 0.0
+		? OutReport.TicksSimulated / OutReport.WallSeconds
+		: 0.0;
+	if (!OutReport.FailureReason.IsEmpty())
+	{
+		return false;
+	}
+	if (FinalTick != StopTick)
+	{
+		OutReport.FailureReason = FString::Printf(
+			TEXT("Playback halted at tick %d before %s %d (see log)."),
+			FinalTick, bStopsEarly ? TEXT("StopTick") : TEXT("EndTick"), StopTick);
+		return false;
+	}
+
+	// Natural completion stops the sim at EndTick; resume it just long enough
+	// to take the final root at that quiescent boundary.
+	if (!bStopsEarly && WorldSub->StartSimulation())
+	{
+		FString RootError;
+		if (!WorldSub->ComputeCanonicalStateRoot(OutReport.FinalRoot, RootError))
+		{
+			UE_LOG(LogSeinNet, Warning,
+				TEXT("ReplayFastForward: final root unavailable: %s"), *RootError);
+		}
+		WorldSub->StopSimulation();
+	}
+
+	OutReport.bSucceeded = true;
+	return true;
+}
+
+void SeinReplayFastForward::PlanSegments(
+	TConstArrayView<int32> CheckpointTicks,
+	int32 EndTick,
+	TArray<FSeinReplaySegment>& OutSegments)
+{
+	OutSegments.Reset();
+	if (EndTick <= 0)
+	{
+		return;
+	}
+	TArray<int32> Starts;
+	Starts.Reserve(CheckpointTicks.Num() + 1);
+	Starts.Add(0);
+	for (const int32 Tick : CheckpointTicks)
+	{
+		if (Tick > 0 && Tick < EndTick)
+		{
+			Starts.AddUnique(Tick);
+		}
+	}
+	Starts.Sort();
+	OutSegments.Reserve(Starts.Num());
+	for (int32 Index = 0; Index < Starts.Num(); ++Index)
+	{
+		FSeinReplaySegment& Segment = OutSegments.AddDefaulted_GetRef();
+		Segment.StartTick = Starts[Index];
+		Segment.StopTick = Starts.IsValidIndex(Index + 1) ? Starts[Index + 1] : EndTick;
+	}
+}
+
+int32 SeinReplayFastForward::FindFirstDivergentSegment(
+	TConstArrayView<FSeinReplaySegmentResult> Results,
+	FString& OutReason)
+{
+	OutReason.Reset();
+	for (int32 Index = 0; Index < Results.Num(); ++Index)
+	{
+		const FSeinReplaySegmentResult& Segment = Results[Index];
+		if (!Segment.bSucceeded)
+		{
+			OutReason = Segment.FailureReason.IsEmpty()
+				? FString(TEXT("segment failed"))
+				: Segment.FailureReason;
+			return Index;
+		}
+		if (!Results.IsValidIndex(Index + 1))
+		{
+			break;
+		}
+		// A next segment that failed before restoring is reported on its own
+		// iteration; only a restored seam can be compared.
+		const FSeinReplaySegmentResult& Next = Results[Index + 1];
+		if (Next.StartTick != Segment.StopTick)
+		{
+			OutReason = FString::Printf(
+				TEXT("segment stops at tick %d but the next starts at %d"),
+				Segment.StopTick, Next.StartTick);
+			return Index;
+		}
+		if (Next.StartRoot.IsValid() && Segment.EndRoot != Next.StartRoot)
+		{
+			OutReason = FString::Printf(
+				TEXT("sealed root %s at tick %d differs from checkpoint root %s"),
+				*Segment.EndRoot.ToString(EGuidFormats::Digits),
+				Segment.StopTick,
+				*Next.StartRoot.ToString(EGuidFormats::Digits));
+			return Index;
+		}
+	}
+	return INDEX_NONE;
+}
+
+void SeinReplayFastForward::LogReport(
+	const FString& Label,
+	const FSeinReplayFastForwardReport& Report)
+{
+	UE_LOG(LogSeinNet, Display,
+		TEXT("ReplayFastForward %s: %s  ticks %d..%d (%d) in %.3f s = %.1f ticks/s  roots verified %d  final root %s%s%s"),
+		*Label,
+		Report.bSucceeded ? TEXT("OK") : TEXT("FAILED"),
+		Report.StartTick,
+		Report.StartTick + Report.TicksSimulated,
+		Report.TicksSimulated,
+		Report.WallSeconds,
+		Report.TicksPerSecond,
+		Report.VerifiedRoots.Num(),
+		*Report.FinalRoot.ToString(EGuidFormats::Digits),
+		Report.FailureReason.IsEmpty() ? TEXT("") : TEXT("  reason: "),
+		*Report.FailureReason);
+
+	for (const FSeinReplayFastForwardRoot& Verified : Report.VerifiedRoots)
+	{
+		UE_LOG(LogSeinNet, Verbose,
+			TEXT("ReplayFastForward %s: root[tick %d] = %s"),
+			*Label, Verified.Tick, *Verified.Root.ToString(EGuidFormats::Digits));
+	}
+
+	TArray<FSeinSystemTickTiming> ByCost = Report.SystemTimings;
+	ByCost.StableSort([](const FSeinSystemTickTiming& A, const FSeinSystemTickTiming& B)
+	{
+		return A.TotalSeconds > B.TotalSeconds;
+	});
+	for (const FSeinSystemTickTiming& Timing : ByCost)
+	{
+		UE_LOG(LogSeinNet, Display,
+			TEXT("ReplayFastForward %s:   %8.3f ms total  %7.2f us/tick  %6.2f%%  phase %d  %s"),
+			*Label,
+			Timing.TotalSeconds * 1000.0,
+			Timing.TickCount > 0 ? Timing.TotalSeconds * 1.0e6 / Timing.TickCount : 0.0,
+			Report.WallSeconds > 0.0 ? 100.0 * Timing.TotalSeconds / Report.WallSeconds : 0.0,
+			static_cast<int32>(Timing.Phase),
+			*Timing.CanonicalStableID);
+	}
+}
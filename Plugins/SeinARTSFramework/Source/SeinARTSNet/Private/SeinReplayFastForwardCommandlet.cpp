@@ -0,0 +1,481 @@
+/**
+ * SeinARTS Framework - Copyright (c) 2026 Phenom Studios, Inc.
+ *
+ * @file         SeinReplayFastForwardCommandlet.cpp
+ * @author       RJ Macklem
+ * @created      17 Oct 2026
+ * @latest       17 Oct 2026
+ * @brief        Commandlet driver: per-replay worlds, segment worker processes
+ *               and the exit-code report.
+ */
+
+#include "SeinReplayFastForwardCommandlet.h"
+#include "SeinARTSNet.h"
+#include "SeinReplayFastForward.h"
+#include "SeinReplayReader.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformMisc.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Guid.h"
+#include "Misc/PackageName.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "UObject/GarbageCollection.h"
+#include "UObject/Package.h"
+#include "UObject/StrongObjectPtr.h"
+
+namespace
+{
+	/** Load MapPackageName as a fresh simulation-only Game world. */
+	UWorld* CreateHeadlessWorld(const FString& MapPackageName)
+	{
+		UPackage* MapPackage = LoadPackage(nullptr, *MapPackageName, LOAD_None);
+		UWorld* World = MapPackage ? UWorld::FindWorldInPackage(MapPackage) : nullptr;
+		if (!World)
+		{
+			UE_LOG(LogSeinNet, Error,
+				TEXT("SeinReplayFastForward: could not load map %s."), *MapPackageName);
+			return nullptr;
+		}
+
+		// Simulation only: the world is never ticked, so beyond skipping these
+		// systems here no actor, render or fog presentation work can run.
+		World->WorldType = EWorldType::Game;
+		World->AddToRoot();
+		FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+		WorldContext.SetCurrentWorld(World);
+		World->InitWorld(UWorld::InitializationValues()
+			.InitializeScenes(false)
+			.AllowAudioPlayback(false)
+			.RequiresHitProxies(false)
+			.CreatePhysicsScene(false)
+			.CreateNavigation(false)
+			.CreateAISystem(false)
+			.ShouldSimulatePhysics(false)
+			.EnableTraceCollision(false)
+			.CreateFXSystem(false));
+		World->UpdateWorldComponents(true, false);
+		World->InitializeActorsForPlay(FURL());
+		World->BeginPlay();
+		return World;
+	}
+
+	/** Each replay demands a pristine tick-zero world; never reuse one. */
+	void DestroyHeadlessWorld(UWorld* World)
+	{
+		World->EndPlay(EEndPlayReason::Quit);
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+		World->RemoveFromRoot();
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	}
+
+	bool SaveSegmentResult(const FString& ResultPath, const FSeinReplaySegmentResult& Result)
+	{
+		FString Text;
+		Text += FString::Printf(TEXT("Succeeded=%d\n"), Result.bSucceeded ? 1 : 0);
+		Text += FString::Printf(TEXT("StartTick=%d\n"), Result.StartTick);
+		Text += FString::Printf(TEXT("StopTick=%d\n"), Result.StopTick);
+		Text += FString::Printf(TEXT("StartRoot=%s\n"), *Result.StartRoot.ToString(EGuidFormats::Digits));
+		Text += FString::Printf(TEXT("EndRoot=%s\n"), *Result.EndRoot.ToString(EGuidFormats::Digits));
+		Text += FString::Printf(TEXT("WallSeconds=%.6f\n"), Result.WallSeconds);
+		// Last, so a reason containing '=' still splits on its first one.
+		Text += FString::Printf(TEXT("Failure=%s\n"),
+			*Result.FailureReason.Replace(TEXT("\n"), TEXT(" ")));
+		return FFileHelper::SaveStringToFile(Text, *ResultPath);
+	}
+
+	bool LoadSegmentResult(const FString& ResultPath, FSeinReplaySegmentResult& OutResult)
+	{
+		TArray<FString> Lines;
+		if (!FFileHelper::LoadFileToStringArray(Lines, *ResultPath))
+		{
+			return false;
+		}
+		bool bSawSucceeded = false;
+		for (const FString& Line : Lines)
+		{
+			FString Key;
+			FString Value;
+			if (!Line.Split(TEXT("="), &Key, &Value))
+			{
+				continue;
+			}
+			if (Key == TEXT("Succeeded"))
+			{
+				OutResult.bSucceeded = Value == TEXT("1");
+				bSawSucceeded = true;
+			}
+			else if (Key == TEXT("StartTick"))
+			{
+				LexFromString(OutResult.StartTick, *Value);
+			}
+			else if (Key == TEXT("StopTick"))
+			{
+				LexFromString(OutResult.StopTick, *Value);
+			}
+			else if (Key == TEXT("StartRoot"))
+			{
+				FGuid::Parse(Value, OutResult.StartRoot);
+			}
+			else if (Key == TEXT("EndRoot"))
+			{
+				FGuid::Parse(Value, OutResult.EndRoot);
+			}
+			else if (Key == TEXT("WallSeconds"))
+			{
+				LexFromString(OutResult.WallSeconds, *Value);
+			}
+			else if (Key == TEXT("Failure"))
+			{
+				OutResult.FailureReason = Value;
+			}
+		}
+		return bSawSucceeded;
+	}
+
+	struct FSegmentWorker
+	{
+		int32 SegmentIndex = INDEX_NONE;
+		FProcHandle Process;
+		FString ResultPath;
+	};
+}
+
+USeinReplayFastForwardCommandlet::USeinReplayFastForwardCommandlet()
+{
+	IsClient = false;
+	IsEditor = false;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 USeinReplayFastForwardCommandlet::Main(const FString& Params)
+{
+	FString MapPackageName;
+	if (!FParse::Value(*Params, TEXT("Map="), MapPackageName)
+		|| !FPackageName::IsValidLongPackageName(MapPackageName))
+	{
+		UE_LOG(LogSeinNet, Error,
+			TEXT("SeinReplayFastForward: -Map=<LongPackageName> is required."));
+		return 1;
+	}
+
+	TArray<FString> ReplayPaths;
+	FString SingleReplay;
+	FString ReplayDir;
+	if (FParse::Value(*Params, TEXT("Replay="), SingleReplay))
+	{
+		ReplayPaths.Add(SingleReplay);
+	}
+	if (FParse::Value(*Params, TEXT("ReplayDir="), ReplayDir))
+	{
+		TArray<FString> Found;
+		IFileManager::Get().FindFiles(
+			Found, *(ReplayDir / TEXT("*.seinreplay")), true, false);
+		Found.Sort();
+		for (const FString& Name : Found)
+		{
+			ReplayPaths.Add(ReplayDir / Name);
+		}
+	}
+	if (ReplayPaths.IsEmpty())
+	{
+		UE_LOG(LogSeinNet, Error,
+			TEXT("SeinReplayFastForward: no replays (pass -Replay=<FileOrPath> or -ReplayDir=<Directory>)."));
+		return 1;
+	}
+
+	FSeinReplayFastForwardOptions Options;
+	FParse::Value(*Params, TEXT("StartTick="), Options.StartTick);
+	FParse::Value(*Params, TEXT("VerifyIntervalTurns="), Options.VerifyIntervalTurns);
+	Options.bVerifyRoots = FParse::Param(*Params, TEXT("VerifyRoots"));
+	if (Options.StartTick < 0)
+	{
+		UE_LOG(LogSeinNet, Error,
+			TEXT("SeinReplayFastForward: StartTick must be a non-negative integer."));
+		return 1;
+	}
+
+	FString SegmentResultPath;
+	if (FParse::Param(*Params, TEXT("SegmentWorker")))
+	{
+		FParse::Value(*Params, TEXT("StopTick="), Options.StopTick);
+		if (ReplayPaths.Num() != 1
+			|| Options.StopTick <= Options.StartTick
+			|| !FParse::Value(*Params, TEXT("SegmentResult="), SegmentResultPath))
+		{
+			UE_LOG(LogSeinNet, Error,
+				TEXT("SeinReplayFastForward: -SegmentWorker needs one -Replay, -StartTick < -StopTick and -SegmentResult=<File>."));
+			return 1;
+		}
+		return RunSegmentWorker(MapPackageName, ReplayPaths[0], Options, SegmentResultPath)
+			? 0 : 1;
+	}
+
+	const bool bSegmented = FParse::Param(*Params, TEXT("Segmented"));
+	int32 MaxJobs = FPlatformMisc::NumberOfCores();
+	FParse::Value(*Params, TEXT("Jobs="), MaxJobs);
+	MaxJobs = FMath::Max(1, MaxJobs);
+
+	int32 Failures = 0;
+	for (const FString& Path : ReplayPaths)
+	{
+		const bool bPassed = bSegmented
+			? RunSegmented(MapPackageName, Path, Options, MaxJobs)
+			: RunOne(MapPackageName, Path, Options);
+		if (!bPassed)
+		{
+			++Failures;
+		}
+	}
+	UE_LOG(LogSeinNet, Display,
+		TEXT("SeinReplayFastForward: %d/%d replay(s) passed."),
+		ReplayPaths.Num() - Failures, ReplayPaths.Num());
+	return Failures;
+}
+
+bool USeinReplayFastForwardCommandlet::RunOne(
+	const FString& MapPackageName,
+	const FString& Path,
+	const FSeinReplayFastForwardOptions& Options)
+{
+	UWorld* World = CreateHeadlessWorld(MapPackageName);
+	if (!World)
+	{
+		return false;
+	}
+
+	FSeinReplayFastForwardReport Report;
+	const bool bPassed = SeinReplayFastForward::Run(*World, Path, Options, Report);
+	SeinReplayFastForward::LogReport(FPaths::GetCleanFilename(Path), Report);
+
+	DestroyHeadlessWorld(World);
+	return bPassed;
+}
+
+bool USeinReplayFastForwardCommandlet::RunSegmented(
+	const FString& MapPackageName,
+	const FString& Path,
+	const FSeinReplayFastForwardOptions& Options,
+	int32 MaxJobs)
+{
+	const FString Label = FPaths::GetCleanFilename(Path);
+
+	// Loading validates the whole journal index; the probe world is only the
+	// reader's compatibility context and never plays.
+	TArray<int32> CheckpointTicks;
+	int32 EndTick = 0;
+	{
+		UWorld* ProbeWorld = CreateHeadlessWorld(MapPackageName);
+		if (!ProbeWorld)
+		{
+			return false;
+		}
+		TStrongObjectPtr<USeinReplayReader> Reader(NewObject<USeinReplayReader>(ProbeWorld));
+		const bool bLoaded = Reader->LoadFromFile(Path);
+		if (bLoaded)
+		{
+			Reader->GetCheckpointTicks(CheckpointTicks);
+			EndTick = Reader->GetHeader().EndTick;
+		}
+		Reader.Reset();
+		DestroyHeadlessWorld(ProbeWorld);
+		if (!bLoaded)
+		{
+			UE_LOG(LogSeinNet, Error,
+				TEXT("SeinReplayFastForward %s: replay failed to load (see log)."), *Label);
+			return false;
+		}
+	}
+
+	TArray<FSeinReplaySegment> Segments;
+	SeinReplayFastForward::PlanSegments(CheckpointTicks, EndTick, Segments);
+	if (Segments.Num() < 2)
+	{
+		// v8 files and journals without periodic checkpoints have one span.
+		UE_LOG(LogSeinNet, Display,
+			TEXT("SeinReplayFastForward %s: no interior checkpoints, verifying sequentially."),
+			*Label);
+		FSeinReplayFastForwardOptions Whole = Options;
+		Whole.StartTick = 0;
+		return RunOne(MapPackageName, Path, Whole);
+	}
+
+	const FString WorkDir = FPaths::ConvertRelativePathToFull(
+		FPaths::ProjectSavedDir() / TEXT("ReplaySegments")
+			/ FGuid::NewGuid().ToString(EGuidFormats::Digits));
+	IFileManager::Get().MakeDirectory(*WorkDir, true);
+	const FString Executable = FPlatformProcess::ExecutablePath();
+	const FString ProjectFile = FPaths::ConvertRelativePathToFull(FPaths::GetProjectFilePath());
+	const FString ReplayFile = FPaths::ConvertRelativePathToFull(Path);
+	FString SharedArgs = FString::Printf(
+		TEXT("\"%s\" -run=SeinReplayFastForward -Map=%s -Replay=\"%s\" -SegmentWorker"),
+		*ProjectFile, *MapPackageName, *ReplayFile);
+	if (Options.bVerifyRoots)
+	{
+		SharedArgs += FString::Printf(
+			TEXT(" -VerifyRoots -VerifyIntervalTurns=%d"), Options.VerifyIntervalTurns);
+	}
+
+	UE_LOG(LogSeinNet, Display,
+		TEXT("SeinReplayFastForward %s: %d segment(s) to EndTick %d across up to %d worker(s)."),
+		*Label, Segments.Num(), EndTick, MaxJobs);
+
+	TArray<FSeinReplaySegmentResult> Results;
+	Results.SetNum(Segments.Num());
+	TArray<FSegmentWorker> Running;
+	int32 NextSegment = 0;
+	const double StartedAt = FPlatformTime::Seconds();
+	while (NextSegment < Segments.Num() || !Running.IsEmpty())
+	{
+		while (NextSegment < Segments.Num() && Running.Num() < MaxJobs)
+		{
+			const FSeinReplaySegment& Segment = Segments[NextSegment];
+			FSeinReplaySegmentResult& Result = Results[NextSegment];
+			Result.StartTick = Segment.StartTick;
+			Result.StopTick = Segment.StopTick;
+
+			FSegmentWorker Worker;
+			Worker.SegmentIndex = NextSegment;
+			Worker.ResultPath = WorkDir / FString::Printf(TEXT("Segment%04d.txt"), NextSegment);
+			const FString Args = FString::Printf(
+				TEXT("%s -StartTick=%d -StopTick=%d -SegmentResult=\"%s\" -abslog=\"%s\" -nullrhi -unattended -nosplash -nopause"),
+				*SharedArgs,
+				Segment.StartTick,
+				Segment.StopTick,
+				*Worker.ResultPath,
+				*(WorkDir / FString::Printf(TEXT("Segment%04d.log"), NextSegment)));
+			Worker.Process = FPlatformProcess::CreateProc(
+				*Executable, *Args, false, true, true, nullptr, 0, nullptr, nullptr);
+			if (!Worker.Process.IsValid())
+			{
+				Result.FailureReason = TEXT("worker process failed to launch");
+			}
+			else
+			{
+				Running.Add(MoveTemp(Worker));
+			}
+			++NextSegment;
+		}
+
+		for (int32 Index = Running.Num() - 1; Index >= 0; --Index)
+		{
+			FSegmentWorker& Worker = Running[Index];
+			if (FPlatformProcess::IsProcRunning(Worker.Process))
+			{
+				continue;
+			}
+			int32 ReturnCode = 0;
+			FPlatformProcess::GetProcReturnCode(Worker.Process, &ReturnCode);
+			FPlatformProcess::CloseProc(Worker.Process);
+
+			FSeinReplaySegmentResult& Result = Results[Worker.SegmentIndex];
+			FSeinReplaySegmentResult Loaded;
+			if (LoadSegmentResult(Worker.ResultPath, Loaded)
+				&& Loaded.StopTick == Result.StopTick)
+			{
+				Result = MoveTemp(Loaded);
+			}
+			else
+			{
+				Result.FailureReason = FString::Printf(
+					TEXT("worker exited with code %d without a result"), ReturnCode);
+			}
+			Running.RemoveAtSwap(Index);
+		}
+		if (!Running.IsEmpty())
+		{
+			FPlatformProcess::Sleep(0.05f);
+		}
+	}
+	const double WallSeconds = FPlatformTime::Seconds() - StartedAt;
+
+	double SegmentSeconds = 0.0;
+	for (int32 Index = 0; Index < Results.Num(); ++Index)
+	{
+		const FSeinReplaySegmentResult& Result = Results[Index];
+		SegmentSeconds += Result.WallSeconds;
+		UE_LOG(LogSeinNet, Display,
+			TEXT("SeinReplayFastForward %s: segment %d ticks %d..%d %s in %.3f s  start %s  end %s%s%s"),
+			*Label,
+			Index,
+			Result.StartTick,
+			Result.StopTick,
+			Result.bSucceeded ? TEXT("OK") : TEXT("FAILED"),
+			Result.WallSeconds,
+			*Result.StartRoot.ToString(EGuidFormats::Digits),
+			*Result.EndRoot.ToString(EGuidFormats::Digits),
+			Result.FailureReason.IsEmpty() ? TEXT("") : TEXT("  reason: "),
+			*Result.FailureReason);
+	}
+
+	FString DivergenceReason;
+	const int32 Divergent =
+		SeinReplayFastForward::FindFirstDivergentSegment(Results, DivergenceReason);
+	if (Divergent != INDEX_NONE)
+	{
+		UE_LOG(LogSeinNet, Error,
+			TEXT("SeinReplayFastForward %s: first divergent segment %d (ticks %d..%d): %s. Worker logs kept in %s."),
+			*Label,
+			Divergent,
+			Results[Divergent].StartTick,
+			Results[Divergent].StopTick,
+			*DivergenceReason,
+			*WorkDir);
+		return false;
+	}
+	UE_LOG(LogSeinNet, Display,
+		TEXT("SeinReplayFastForward %s: %d segment(s) agree at every checkpoint in %.3f s (%.3f s of segment time)."),
+		*Label, Results.Num(), WallSeconds, SegmentSeconds);
+	IFileManager::Get().DeleteDirectory(*WorkDir, false, true);
+	return true;
+}
+
+bool USeinReplayFastForwardCommandlet::RunSegmentWorker(
+	const FString& MapPackageName,
+	const FString& Path,
+	const FSeinReplayFastForwardOptions& Options,
+	const FString& ResultPath)
+{
+	FSeinReplaySegmentResult Result;
+	Result.StartTick = Options.StartTick;
+	Result.StopTick = Options.StopTick;
+	if (UWorld* World = CreateHeadlessWorld(MapPackageName))
+	{
+		FSeinReplayFastForwardReport Report;
+		Result.bSucceeded = SeinReplayFastForward::Run(*World, Path, Options, Report);
+		SeinReplayFastForward::LogReport(FPaths::GetCleanFilename(Path), Report);
+		Result.StartTick = Report.StartTick;
+		Result.FailureReason = Report.FailureReason;
+		Result.StartRoot = Report.StartRoot;
+		Result.EndRoot = Report.FinalRoot;
+		Result.WallSeconds = Report.WallSeconds;
+		DestroyHeadlessWorld(World);
+	}
+	else
+	{
+		Result.FailureReason = FString::Printf(TEXT("could not load map %s"), *MapPackageName);
+	}
+
+	// A seek target between checkpoints would restore an earlier one and
+	// leave this segment's seam unrestored.
+	if (Result.bSucceeded && Result.StartTick != Options.StartTick)
+	{
+		Result.bSucceeded = false;
+		Result.FailureReason = FString::Printf(
+			TEXT("restored tick %d instead of checkpoint %d"),
+			Result.StartTick, Options.StartTick);
+	}
+	if (!SaveSegmentResult(ResultPath, Result))
+	{
+		UE_LOG(LogSeinNet, Error,
+			TEXT("SeinReplayFastForward: could not write segment result %s."), *ResultPath);
+		return false;
+	}
+	return Result.bSucceeded;
+}
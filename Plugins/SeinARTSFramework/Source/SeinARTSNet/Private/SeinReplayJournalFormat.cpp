@@ -1,6 +1,7 @@
 #include "SeinReplayJournalFormat.h"
 
 #include "Hash/Blake3.h"
+#include "Serialization/SeinSnapshotSectionCodec.h"
 
 namespace
 {
@@ -158,7 +159,9 @@ namespace
 			OutError = TEXT("unknown replay journal frame type");
 			return false;
 		}
-		if (Header.Flags != 0)
+		if (Header.Flags != 0
+			&& !(Header.Type == EFrameType::Checkpoint
+				&& Header.Flags == CheckpointFlagSectionCoded))
 		{
 			OutError = TEXT("unsupported replay journal frame flags");
 			return false;
@@ -331,6 +334,113 @@ namespace
 		return true;
 	}
 
+	/** Codec byte, canonical length and stored length ahead of each section. */
+	constexpr int32 CodedSectionHeaderBytes = 9;
+
+	struct FCodedCheckpointSection
+	{
+		ESeinSnapshotSectionCodec Codec =
+			ESeinSnapshotSectionCodec::CanonicalBytes;
+		uint32 CanonicalBytes = 0;
+		TConstArrayView<uint8> Stored;
+	};
+
+	/**
+	 * Structural admission of one section-coded Checkpoint payload: the
+	 * verbatim envelope prefix and directory, the coding header, and one
+	 * bounded record per directory entry whose canonical lengths add up to the
+	 * declared envelope body. Nothing is decoded here.
+	 */
+	bool ParseCodedCheckpoint(
+		TConstArrayView<uint8> Payload,
+		FSeinSnapshotEnvelopeMetadata& OutMetadata,
+		int32& OutHeadBytes,
+		int32& OutChainDepth,
+		TArray<FCodedCheckpointSection>& OutSections,
+		FString& OutError)
+	{
+		constexpr int32 EnvelopePrefixBytes =
+			FSeinSnapshotEnvelopeCodec::PrefixBytes;
+		if (Payload.Num() < EnvelopePrefixBytes)
+		{
+			OutError = TEXT("coded Checkpoint payload is smaller than its envelope prefix");
+			return false;
+		}
+		FSeinSnapshotEnvelopeMetadata Metadata;
+		FString EnvelopeError;
+		if (!FSeinSnapshotEnvelopeCodec::ParsePrefix(
+				Payload.Left(EnvelopePrefixBytes), Metadata, EnvelopeError))
+		{
+			OutError = FString::Printf(
+				TEXT("coded Checkpoint envelope prefix is invalid: %s"),
+				*EnvelopeError);
+			return false;
+		}
+		const uint64 HeadBytes =
+			static_cast<uint64>(EnvelopePrefixBytes) + Metadata.DirectoryBytes;
+		if (HeadBytes + 2 > static_cast<uint64>(Payload.Num()))
+		{
+			OutError = TEXT("coded Checkpoint payload is truncated inside its directory");
+			return false;
+		}
+		int32 Offset = static_cast<int32>(HeadBytes);
+		const uint8 Version = Payload[Offset++];
+		const int32 ChainDepth = Payload[Offset++];
+		if (Version != CheckpointCodingVersion
+			|| ChainDepth >= MaxCheckpointKeyframeInterval)
+		{
+			OutError = TEXT("coded Checkpoint has an unsupported version or chain depth");
+			return false;
+		}
+
+		TArray<FCodedCheckpointSection> Sections;
+		Sections.Reserve(static_cast<int32>(Metadata.SectionCount));
+		uint64 CanonicalTotal = 0;
+		for (uint32 Index = 0; Index < Metadata.SectionCount; ++Index)
+		{
+			if (Payload.Num() - Offset < CodedSectionHeaderBytes)
+			{
+				OutError = TEXT("coded Checkpoint section record is truncated");
+				return false;
+			}
+			FCodedCheckpointSection& Section = Sections.AddDefaulted_GetRef();
+			Section.Codec =
+				static_cast<ESeinSnapshotSectionCodec>(Payload[Offset]);
+			Section.CanonicalBytes = ReadUInt32(Payload.GetData() + Offset + 1);
+			const uint32 StoredBytes =
+				ReadUInt32(Payload.GetData() + Offset + 5);
+			Offset += CodedSectionHeaderBytes;
+			if (!FSeinSnapshotSectionCodec::IsKnown(Section.Codec)
+				|| (ChainDepth == 0
+					&& FSeinSnapshotSectionCodec::IsDelta(Section.Codec)))
+			{
+				OutError = TEXT("coded Checkpoint section codec is not allowed at its chain depth");
+				return false;
+			}
+			if (static_cast<uint64>(StoredBytes)
+				> static_cast<uint64>(Payload.Num() - Offset))
+			{
+				OutError = TEXT("coded Checkpoint section overruns its payload");
+				return false;
+			}
+			Section.Stored = Payload.Slice(Offset, static_cast<int32>(StoredBytes));
+			Offset += static_cast<int32>(StoredBytes);
+			CanonicalTotal += Section.CanonicalBytes;
+		}
+		if (Offset != Payload.Num()
+			|| Metadata.DirectoryBytes + CanonicalTotal != Metadata.BodyBytes)
+		{
+			OutError = TEXT("coded Checkpoint sections do not exactly cover the declared envelope body");
+			return false;
+		}
+
+		OutMetadata = MoveTemp(Metadata);
+		OutHeadBytes = static_cast<int32>(HeadBytes);
+		OutChainDepth = ChainDepth;
+		OutSections = MoveTemp(Sections);
+		return true;
+	}
+
 	bool ValidatePayloadSemantics(
 		const FFrameHeader& Header,
 		TConstArrayView<uint8> Payload,
@@ -358,6 +468,54 @@ namespace
 		}
 		case EFrameType::Checkpoint:
 		{
+			if (Header.Flags == CheckpointFlagSectionCoded)
+			{
+				// A delta can only be rebuilt against its chain, which the
+				// reader walks; the rebuilt envelope then meets the same full
+				// Decode. Keyframes stand alone, so verify them fully here.
+				FSeinSnapshotEnvelopeMetadata Metadata;
+				int32 HeadBytes = 0;
+				int32 ChainDepth = 0;
+				TArray<FCodedCheckpointSection> Sections;
+				if (!ParseCodedCheckpoint(
+						Payload, Metadata, HeadBytes, ChainDepth, Sections, OutError))
+				{
+					return false;
+				}
+				if (Metadata.SnapshotTick != Header.TimelineTick)
+				{
+					OutError = TEXT("Checkpoint frame does not match its snapshot tick");
+					return false;
+				}
+				if (ChainDepth > 0)
+				{
+					return true;
+				}
+				TArray<uint8> EnvelopeBytes;
+				FCheckpointDeltaBase Base;
+				FSeinSnapshotEnvelope Envelope;
+				FString SnapshotError;
+				if (!SeinReplayJournalFormat::DecodeCheckpointPayload(
+						Header.Flags,
+						Payload,
+						FCheckpointDeltaBase(),
+						EnvelopeBytes,
+						Base,
+						OutError))
+				{
+					return false;
+				}
+				if (!FSeinSnapshotEnvelopeCodec::Decode(
+						EnvelopeBytes, Envelope, Metadata, SnapshotError))
+				{
+					OutError = FString::Printf(
+						TEXT("Checkpoint snapshot envelope is invalid: %s"),
+						*SnapshotError);
+					return false;
+				}
+				return true;
+			}
+
 			// Recomputing only the outer frame digest must never admit damaged
 			// checkpoint bytes. Fully validate the canonical snapshot envelope
 			// (body digest, directory, section leaves, and aggregate root) here;
@@ -786,6 +944,187 @@ bool SeinReplayJournalFormat::DecodeTurnBatch(
 	return true;
 }
 
+bool SeinReplayJournalFormat::EncodeCheckpointPayload(
+	TConstArrayView<uint8> Envelope,
+	const FCheckpointCodingPolicy& Policy,
+	const FCheckpointDeltaBase& Previous,
+	TArray<uint8>& OutPayload,
+	uint8& OutFlags,
+	FCheckpointDeltaBase& OutBase,
+	FString& OutError)
+{
+	OutError.Reset();
+	if (Policy.IsPlain())
+	{
+		OutPayload = TArray<uint8>(Envelope);
+		OutFlags = 0;
+		OutBase = FCheckpointDeltaBase();
+		return true;
+	}
+
+	TArray<FSeinSnapshotSectionLayout> Layout;
+	FSeinSnapshotEnvelopeMetadata Metadata;
+	FString EnvelopeError;
+	if (!FSeinSnapshotEnvelopeCodec::GetSectionLayout(
+			Envelope, Layout, Metadata, EnvelopeError))
+	{
+		OutError = FString::Printf(
+			TEXT("checkpoint envelope cannot be section-coded: %s"),
+			*EnvelopeError);
+		return false;
+	}
+	const int32 KeyframeInterval = FMath::Clamp(
+		Policy.KeyframeInterval, 1, MaxCheckpointKeyframeInterval);
+	const int32 ChainDepth = Previous.IsSet()
+		&& Previous.ChainDepth + 1 < KeyframeInterval
+			? Previous.ChainDepth + 1
+			: 0;
+
+	ESeinSnapshotSectionCodec Allowed[4];
+	int32 AllowedCount = 0;
+	if (Policy.bCompress)
+	{
+		Allowed[AllowedCount++] = ESeinSnapshotSectionCodec::CanonicalBytesLZ4;
+	}
+	if (ChainDepth > 0)
+	{
+		Allowed[AllowedCount++] = ESeinSnapshotSectionCodec::XorDelta;
+		if (Policy.bCompress)
+		{
+			Allowed[AllowedCount++] = ESeinSnapshotSectionCodec::XorDeltaLZ4;
+		}
+	}
+
+	const int32 HeadBytes = FSeinSnapshotEnvelopeCodec::PrefixBytes
+		+ static_cast<int32>(Metadata.DirectoryBytes);
+	TArray<uint8> Candidate;
+	Candidate.Reserve(Envelope.Num());
+	Candidate.Append(Envelope.GetData(), HeadBytes);
+	Candidate.Add(CheckpointCodingVersion);
+	Candidate.Add(static_cast<uint8>(ChainDepth));
+	FCheckpointDeltaBase CandidateBase;
+	CandidateBase.ChainDepth = ChainDepth;
+	CandidateBase.SectionPayloads.Reserve(Layout.Num());
+	TArray<uint8> Stored;
+	for (int32 Index = 0; Index < Layout.Num(); ++Index)
+	{
+		const TConstArrayView<uint8> Canonical = Envelope.Slice(
+			static_cast<int32>(Layout[Index].PayloadOffset),
+			static_cast<int32>(Layout[Index].PayloadBytes));
+		const TConstArrayView<uint8> Base =
+			Previous.SectionPayloads.IsValidIndex(Index)
+				? TConstArrayView<uint8>(Previous.SectionPayloads[Index])
+				: TConstArrayView<uint8>();
+		ESeinSnapshotSectionCodec BestCodec =
+			ESeinSnapshotSectionCodec::CanonicalBytes;
+		TArray<uint8> BestStored(Canonical);
+		for (int32 CodecIndex = 0; CodecIndex < AllowedCount; ++CodecIndex)
+		{
+			if (!FSeinSnapshotSectionCodec::Encode(
+					Allowed[CodecIndex], Canonical, Base, Stored, OutError))
+			{
+				return false;
+			}
+			if (Stored.Num() < BestStored.Num())
+			{
+				BestCodec = Allowed[CodecIndex];
+				Swap(BestStored, Stored);
+			}
+		}
+		Candidate.Add(static_cast<uint8>(BestCodec));
+		AppendUInt32(Candidate, static_cast<uint32>(Canonical.Num()));
+		AppendUInt32(Candidate, static_cast<uint32>(BestStored.Num()));
+		Candidate.Append(BestStored);
+		CandidateBase.SectionPayloads.Emplace(Canonical);
+	}
+	if (static_cast<uint64>(Candidate.Num()) > MaxCheckpointPayloadBytes)
+	{
+		OutError = TEXT("coded checkpoint payload exceeds its bound");
+		return false;
+	}
+
+	OutPayload = MoveTemp(Candidate);
+	OutFlags = CheckpointFlagSectionCoded;
+	OutBase = MoveTemp(CandidateBase);
+	return true;
+}
+
+bool SeinReplayJournalFormat::DecodeCheckpointPayload(
+	uint8 Flags,
+	TConstArrayView<uint8> Payload,
+	const FCheckpointDeltaBase& Previous,
+	TArray<uint8>& OutEnvelope,
+	FCheckpointDeltaBase& OutBase,
+	FString& OutError)
+{
+	OutError.Reset();
+	if (Flags == 0)
+	{
+		OutEnvelope = TArray<uint8>(Payload);
+		OutBase = FCheckpointDeltaBase();
+		return true;
+	}
+	if (Flags != CheckpointFlagSectionCoded)
+	{
+		OutError = TEXT("unsupported replay journal frame flags");
+		return false;
+	}
+
+	FSeinSnapshotEnvelopeMetadata Metadata;
+	int32 HeadBytes = 0;
+	int32 ChainDepth = 0;
+	TArray<FCodedCheckpointSection> Sections;
+	if (!ParseCodedCheckpoint(
+			Payload, Metadata, HeadBytes, ChainDepth, Sections, OutError))
+	{
+		return false;
+	}
+	if (ChainDepth > 0
+		&& (!Previous.IsSet() || Previous.ChainDepth != ChainDepth - 1))
+	{
+		OutError = TEXT("coded Checkpoint delta does not follow its base in the chain");
+		return false;
+	}
+
+	TArray<uint8> Candidate;
+	Candidate.Reserve(static_cast<int32>(
+		FSeinSnapshotEnvelopeCodec::PrefixBytes + Metadata.BodyBytes));
+	Candidate.Append(Payload.GetData(), HeadBytes);
+	FCheckpointDeltaBase CandidateBase;
+	CandidateBase.ChainDepth = ChainDepth;
+	CandidateBase.SectionPayloads.SetNum(Sections.Num());
+	for (int32 Index = 0; Index < Sections.Num(); ++Index)
+	{
+		const FCodedCheckpointSection& Section = Sections[Index];
+		const TConstArrayView<uint8> Base =
+			ChainDepth > 0 && Previous.SectionPayloads.IsValidIndex(Index)
+				? TConstArrayView<uint8>(Previous.SectionPayloads[Index])
+				: TConstArrayView<uint8>();
+		FString SectionError;
+		if (!FSeinSnapshotSectionCodec::Decode(
+				Section.Codec,
+				Section.Stored,
+				Base,
+				Section.CanonicalBytes,
+				CandidateBase.SectionPayloads[Index],
+				SectionError))
+		{
+			OutError = FString::Printf(
+				TEXT("coded Checkpoint section %d is invalid: %s"),
+				Index,
+				*SectionError);
+			return false;
+		}
+		Candidate.Append(CandidateBase.SectionPayloads[Index]);
+	}
+	check(static_cast<uint64>(Candidate.Num())
+		== FSeinSnapshotEnvelopeCodec::PrefixBytes + Metadata.BodyBytes);
+
+	OutEnvelope = MoveTemp(Candidate);
+	OutBase = MoveTemp(CandidateBase);
+	return true;
+}
+
 bool SeinReplayJournalFormat::EncodeFrontier(
 	const FFrontier& Frontier,
 	TArray<uint8>& OutBytes,
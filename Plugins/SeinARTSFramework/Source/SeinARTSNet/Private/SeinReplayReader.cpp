@@ -506,6 +506,7 @@ bool USeinReplayReader::LoadV9FromResolvedPath(
 	int32 LastFrameTimelineTick = 0;
 	uint64 ExpectedSequence = 0;
 	FGuid ExpectedPreviousDigest = Prefix.PrefixDigest;
+	FCheckpointDeltaBase CheckpointBase;
 	bool bSawHeader = false;
 	bool bSawInitialCheckpoint = false;
 	bool bSawFinalize = false;
@@ -782,7 +783,24 @@ bool USeinReplayReader::LoadV9FromResolvedPath(
 			{
 				return Reject(TEXT("the second frame must be the mandatory tick-zero Checkpoint"));
 			}
-			if (!ValidateCheckpointSnapshot(Frame, Payload, Error)
+			// Coded checkpoints rebuild against the one before them; the
+			// rebuilt envelope then meets the same full snapshot validation.
+			TArray<uint8> Envelope;
+			FCheckpointDeltaBase NextCheckpointBase;
+			if (!DecodeCheckpointPayload(
+					Frame.Flags,
+					Payload,
+					CheckpointBase,
+					Envelope,
+					NextCheckpointBase,
+					Error))
+			{
+				return Reject(Error);
+			}
+			CheckpointBase = MoveTemp(NextCheckpointBase);
+			Descriptor.CheckpointChainDepth =
+				CheckpointBase.IsSet() ? CheckpointBase.ChainDepth : 0;
+			if (!ValidateCheckpointSnapshot(Frame, Envelope, Error)
 				|| !ValidateCoverage(
 					Frame.TimelineTick,
 					ScannedTurnCount,
@@ -1097,6 +1115,56 @@ bool USeinReplayReader::ReadIndexedFramePayload(
 	return true;
 }
 
+bool USeinReplayReader::ReadCheckpointEnvelope(
+	const FIndexedJournalFrame& Descriptor,
+	TArray<uint8>& OutEnvelope,
+	FString& OutError) const
+{
+	using namespace SeinReplayJournalFormat;
+	if (Descriptor.Flags == 0)
+	{
+		return ReadIndexedFramePayload(Descriptor, OutEnvelope, OutError);
+	}
+	const int32 Index = LoadedJournalCheckpoints.IndexOfByPredicate(
+		[&Descriptor](const FIndexedJournalFrame& Checkpoint)
+		{
+			return Checkpoint.Sequence == Descriptor.Sequence;
+		});
+	const int32 KeyframeIndex = Index - Descriptor.CheckpointChainDepth;
+	if (Index == INDEX_NONE
+		|| Descriptor.CheckpointChainDepth < 0
+		|| Descriptor.CheckpointChainDepth >= MaxCheckpointKeyframeInterval
+		|| KeyframeIndex < 0)
+	{
+		OutError = TEXT("coded checkpoint is not anchored to an indexed keyframe");
+		return false;
+	}
+
+	FCheckpointDeltaBase Base;
+	TArray<uint8> Envelope;
+	for (int32 LinkIndex = KeyframeIndex; LinkIndex <= Index; ++LinkIndex)
+	{
+		const FIndexedJournalFrame& Link = LoadedJournalCheckpoints[LinkIndex];
+		if (Link.Flags != CheckpointFlagSectionCoded
+			|| Link.CheckpointChainDepth != LinkIndex - KeyframeIndex)
+		{
+			OutError = TEXT("checkpoint delta chain no longer matches its index");
+			return false;
+		}
+		TArray<uint8> Payload;
+		FCheckpointDeltaBase NextBase;
+		if (!ReadIndexedFramePayload(Link, Payload, OutError)
+			|| !DecodeCheckpointPayload(
+				Link.Flags, Payload, Base, Envelope, NextBase, OutError))
+		{
+			return false;
+		}
+		Base = MoveTemp(NextBase);
+	}
+	OutEnvelope = MoveTemp(Envelope);
+	return true;
+}
+
 bool USeinReplayReader::ReadAndDecodeCheckpoint(
 	const FIndexedJournalFrame& Descriptor,
 	FSeinWorldSnapshot& OutSnapshot,
@@ -1108,8 +1176,8 @@ bool USeinReplayReader::ReadAndDecodeCheckpoint(
 		OutError = TEXT("indexed frame is not a checkpoint");
 		return false;
 	}
-	TArray<uint8> Payload;
-	if (!ReadIndexedFramePayload(Descriptor, Payload, OutError))
+	TArray<uint8> Envelope;
+	if (!ReadCheckpointEnvelope(Descriptor, Envelope, OutError))
 	{
 		return false;
 	}
@@ -1117,7 +1185,7 @@ bool USeinReplayReader::ReadAndDecodeCheckpoint(
 	FSeinWorldSnapshotReferenceGuard CandidateGuard(Candidate);
 	FSeinSnapshotEnvelopeMetadata Metadata;
 	if (!SeinSnapshotTransfer::DecodeCheckpointEnvelope(
-			Payload, Candidate, Metadata, OutError))
+			Envelope, Candidate, Metadata, OutError))
 	{
 		return false;
 	}
@@ -1431,6 +1499,20 @@ bool USeinReplayReader::Play()
 	return PlayFromTick(0);
 }
 
+void USeinReplayReader::GetCheckpointTicks(TArray<int32>& OutTicks) const
+{
+	OutTicks.Reset();
+	if (!bLoadedV9)
+	{
+		return;
+	}
+	OutTicks.Reserve(LoadedJournalCheckpoints.Num());
+	for (const FIndexedJournalFrame& Checkpoint : LoadedJournalCheckpoints)
+	{
+		OutTicks.Add(Checkpoint.TimelineTick);
+	}
+}
+
 bool USeinReplayReader::PlayFromTick(int32 TargetTick)
 {
 	if (bLoadedV9)
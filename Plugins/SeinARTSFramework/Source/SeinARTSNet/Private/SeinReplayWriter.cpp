@@ -62,6 +62,15 @@ struct FSeinReplayCheckpointEncodeWork
 	FSeinWorldSnapshot Snapshot;
 	FSeinWorldSnapshotReferenceGuard SnapshotGuard;
 	TArray<uint8> Envelope;
+	/** Storage coding runs on the worker too. Base is the writer's published
+	 *  delta base at schedule time; NextBase replaces it once Payload appends. */
+	SeinReplayJournalFormat::FCheckpointCodingPolicy CodingPolicy;
+	TSharedPtr<const SeinReplayJournalFormat::FCheckpointDeltaBase, ESPMode::ThreadSafe>
+		Base;
+	TArray<uint8> Payload;
+	uint8 PayloadFlags = 0;
+	TSharedPtr<const SeinReplayJournalFormat::FCheckpointDeltaBase, ESPMode::ThreadSafe>
+		NextBase;
 
 	explicit FSeinReplayCheckpointEncodeWork(USeinReplayWriter* Writer)
 		: WriterRoot(Writer)
@@ -108,6 +117,23 @@ namespace
 			SeinReplayJournalFormat::MaxTurnRecordsPerBatch);
 	}
 
+	SeinReplayJournalFormat::FCheckpointCodingPolicy
+	GetCheckpointCodingPolicyFromSettings()
+	{
+		const USeinARTSCoreSettings* Settings =
+			GetDefault<USeinARTSCoreSettings>();
+		SeinReplayJournalFormat::FCheckpointCodingPolicy Policy;
+		if (Settings)
+		{
+			Policy.KeyframeInterval = FMath::Clamp(
+				Settings->ReplayCheckpointKeyframeInterval,
+				1,
+				SeinReplayJournalFormat::MaxCheckpointKeyframeInterval);
+			Policy.bCompress = Settings->bCompressReplayCheckpoints;
+		}
+		return Policy;
+	}
+
 	int32 GetProgressIntervalTicks()
 	{
 		const USeinARTSCoreSettings* Settings =
@@ -171,6 +197,8 @@ void USeinReplayWriter::ResetForNewRecording()
 	FinalFilePath.Reset();
 	RecordingWorld.Reset();
 	PreviousFrameDigest.Invalidate();
+	CheckpointCodingPolicy = GetCheckpointCodingPolicyFromSettings();
+	CheckpointDeltaBase.Reset();
 	NextFrameSequence = 0;
 	PersistedBytes = 0;
 	ResidentBytes = 0;
@@ -742,17 +770,32 @@ bool USeinReplayWriter::ResolvePendingCheckpointEncode(
 		return bRecording;
 	}
 
+	if (CompletedEncodeWork->Base != CheckpointDeltaBase)
+	{
+		HandleCheckpointFailure(
+			/*bRequired=*/false,
+			TEXT("checkpoint delta base changed while the checkpoint was encoding"));
+		return bRecording;
+	}
+
 	const int32 EncodedCheckpointBytes =
-		CompletedEncodeWork->Envelope.Num();
+		CompletedEncodeWork->Payload.Num();
 	const bool bAppended = AppendJournalFrame(
 			static_cast<uint8>(
 				SeinReplayJournalFormat::EFrameType::Checkpoint),
 			INDEX_NONE,
 			INDEX_NONE,
 			Result.SnapshotTick,
-			CompletedEncodeWork->Envelope,
-			/*bAsync=*/!bAppendSynchronously);
-	CompletedEncodeWork->Envelope.Empty();
+			CompletedEncodeWork->Payload,
+			/*bAsync=*/!bAppendSynchronously,
+			CompletedEncodeWork->PayloadFlags);
+	if (bAppended)
+	{
+		// A failed background append fails the recording, so the next
+		// checkpoint can already encode against this one.
+		CheckpointDeltaBase = MoveTemp(CompletedEncodeWork->NextBase);
+	}
+	CompletedEncodeWork->Payload.Empty();
 	// Consume proves the worker has returned. The game thread releases the sole
 	// work owner only after its envelope has been copied into the journal frame.
 	CompletedEncodeWork.Reset();
@@ -1336,7 +1379,8 @@ bool USeinReplayWriter::AppendJournalFrame(
 	int32 LastTurn,
 	int32 TimelineTick,
 	TConstArrayView<uint8> Payload,
-	bool bAsync)
+	bool bAsync,
+	uint8 Flags)
 {
 	if (!bRecording || (bAsync && HasPendingAppend()))
 	{
@@ -1360,7 +1404,7 @@ bool USeinReplayWriter::AppendJournalFrame(
 	FString Error;
 	if (!SeinReplayJournalFormat::BuildFrame(
 			TypedFrame,
-			/*Flags=*/0,
+			Flags,
 			NextFrameSequence,
 			FirstTurn,
 			LastTurn,
@@ -1695,6 +1739,8 @@ bool USeinReplayWriter::CaptureCheckpointInternal(
 		PendingCheckpointEncodeWork = MakeShared<
 			FSeinReplayCheckpointEncodeWork, ESPMode::ThreadSafe>(this);
 		PendingCheckpointEncodeWork->Snapshot = MoveTemp(Snapshot);
+		PendingCheckpointEncodeWork->CodingPolicy = CheckpointCodingPolicy;
+		PendingCheckpointEncodeWork->Base = CheckpointDeltaBase;
 		// The writer is the sole owner and never resets it until this future has
 		// completed. The worker borrows the stable address so final destruction
 		// remains a game-thread operation.
@@ -1782,6 +1828,27 @@ bool USeinReplayWriter::CaptureCheckpointInternal(
 							"checkpoint envelope tick disagrees with Core");
 						EncodeWork->Envelope.Empty();
 					}
+					if (Result.bSucceeded)
+					{
+						TRACE_CPUPROFILER_EVENT_SCOPE(
+							Sein_Replay_Checkpoint_EncodeSections);
+						SeinReplayJournalFormat::FCheckpointDeltaBase NextBase;
+						Result.bSucceeded =
+							SeinReplayJournalFormat::EncodeCheckpointPayload(
+								EncodeWork->Envelope,
+								EncodeWork->CodingPolicy,
+								EncodeWork->Base.IsValid()
+									? *EncodeWork->Base
+									: SeinReplayJournalFormat::FCheckpointDeltaBase(),
+								EncodeWork->Payload,
+								EncodeWork->PayloadFlags,
+								NextBase,
+								Result.Error);
+						EncodeWork->NextBase = MakeShared<
+							SeinReplayJournalFormat::FCheckpointDeltaBase,
+							ESPMode::ThreadSafe>(MoveTemp(NextBase));
+						EncodeWork->Envelope.Empty();
+					}
 				}
 				AsyncTask(ENamedThreads::GameThread,
 					[WeakThis, ScheduledGeneration, ScheduledOperationId]()
@@ -1835,17 +1902,41 @@ bool USeinReplayWriter::CaptureCheckpointInternal(
 	{
 		return RefuseCapture(TEXT("checkpoint envelope tick disagrees with Core"));
 	}
+	TArray<uint8> Payload;
+	uint8 PayloadFlags = 0;
+	SeinReplayJournalFormat::FCheckpointDeltaBase NextBase;
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(Sein_Replay_Checkpoint_EncodeSections);
+		if (!SeinReplayJournalFormat::EncodeCheckpointPayload(
+				Envelope,
+				CheckpointCodingPolicy,
+				CheckpointDeltaBase.IsValid()
+					? *CheckpointDeltaBase
+					: SeinReplayJournalFormat::FCheckpointDeltaBase(),
+				Payload,
+				PayloadFlags,
+				NextBase,
+				Error))
+		{
+			return RefuseCapture(FString::Printf(
+				TEXT("checkpoint section coding failed: %s"), *Error));
+		}
+	}
 	if (!AppendJournalFrame(
 			static_cast<uint8>(
 				SeinReplayJournalFormat::EFrameType::Checkpoint),
 			INDEX_NONE,
 			INDEX_NONE,
 			Snapshot.CurrentTick,
-			Envelope,
-			/*bAsync=*/false))
+			Payload,
+			/*bAsync=*/false,
+			PayloadFlags))
 	{
 		return false;
 	}
+	CheckpointDeltaBase = MakeShared<
+		SeinReplayJournalFormat::FCheckpointDeltaBase,
+		ESPMode::ThreadSafe>(MoveTemp(NextBase));
 
 	bHasInitialCheckpoint = true;
 	LastCheckpointPersistedTurnCount = PersistedTurnCount;
@@ -1853,9 +1944,10 @@ bool USeinReplayWriter::CaptureCheckpointInternal(
 	NextCheckpointRetryTick = 0;
 	CheckpointRetryBackoffTicks = 0;
 	UE_LOG(LogSeinNet, Verbose,
-		TEXT("ReplayWriter: appended checkpoint at tick %d (%d bytes)."),
+		TEXT("ReplayWriter: appended checkpoint at tick %d (%d bytes, %d stored)."),
 		Snapshot.CurrentTick,
-		Envelope.Num());
+		Envelope.Num(),
+		Payload.Num());
 	return true;
 }
 
@@ -0,0 +1,131 @@
+/**
+ * SeinARTS Framework - Copyright (c) 2026 Phenom Studios, Inc.
+ *
+ * @file         SeinAdaptiveInputDelay.h
+ * @author       RJ Macklem
+ * @created      17 Oct 2026
+ * @latest       17 Oct 2026
+ * @brief        Pure coordinator-side input-delay scheduler driven by measured
+ *               submission lead.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/SeinPlayerID.h"
+
+struct FSeinAdaptiveInputDelayConfig
+{
+	bool bEnabled = false;
+	/** Delay stamped until the first measured change. */
+	int32 InitialDelayTurns = 3;
+	int32 MinDelayTurns = 1;
+	int32 MaxDelayTurns = 6;
+	/** Coordinator turns per measurement window. */
+	int32 WindowTurns = 50;
+	/** Lead (turns between a submission's arrival and its turn's execution
+	 *  gate) every author should keep. */
+	int32 TargetLeadTurns = 1;
+	/** Samples under target inside one window that raise the delay at once. */
+	int32 LateSamplesToRaise = 3;
+	/** Fraction of a full window allowed under target + 1 before lowering. */
+	double LowerTolerance = 0.01;
+};
+
+/**
+ * Arrival lead in whole turns. Bucket 0 is a submission that arrived while
+ * the coordinator already waited at its turn's gate; the last bucket is
+ * open-ended.
+ */
+struct SEINARTSNET_API FSeinSubmissionLeadHistogram
+{
+	static constexpr int32 NumBuckets = 12;
+
+	uint32 Buckets[NumBuckets] = {};
+	uint32 Total = 0;
+
+	void Add(int32 LeadTurns);
+	/** Samples with lead strictly below LeadTurns. */
+	uint32 CountBelow(int32 LeadTurns) const;
+	void Reset();
+};
+
+/** Wall-clock durations of execution-gate stalls. Local diagnostics only. */
+struct SEINARTSNET_API FSeinGateStallHistogram
+{
+	static constexpr int32 NumBuckets = 6;
+	/** Exclusive upper bounds of every bucket but the open-ended last. */
+	static const double BucketUpperSeconds[NumBuckets - 1];
+
+	uint32 Buckets[NumBuckets] = {};
+	uint32 Total = 0;
+	double TotalSeconds = 0.0;
+	double LongestSeconds = 0.0;
+
+	void Add(double Seconds);
+	static FString GetBucketLabel(int32 Bucket);
+	void Reset();
+};
+
+/**
+ * Decides which input delay each committed turn announces. It owns no
+ * UObject and never reads wall-clock time: submission lead is measured in
+ * coordinator turns, so the decision only depends on the order submissions
+ * reached the coordinator. Peers never run it; they adopt whatever delay
+ * the committed turns carry.
+ *
+ * Changes take effect from the newest turn being stamped, so the schedule is
+ * monotone in turn order and every earlier turn keeps the delay it was
+ * already committed with.
+ */
+class SEINARTSNET_API FSeinAdaptiveInputDelay
+{
+public:
+	void Configure(const FSeinAdaptiveInputDelayConfig& InConfig);
+	void Reset();
+
+	bool IsEnabled() const { return Config.bEnabled; }
+
+	/** An accepted author submission for TurnId arrived while the coordinator
+	 *  executed CoordinatorTurn. Samples from turns still settling after a
+	 *  change only feed the session histogram. */
+	void RecordSubmission(FSeinPlayerID Slot, int32 TurnId, int32 CoordinatorTurn);
+
+	/** The delay committed turn TurnId announces, or 0 when disabled. The
+	 *  newest turn stamped may first move the schedule. */
+	int32 StampTurn(int32 TurnId, int32 CoordinatorTurn);
+
+	/** Scheduled delay for TurnId without evaluating; 0 when disabled. */
+	int32 GetDelayForTurn(int32 TurnId) const;
+	/** Delay the next new turn announces unless the window moves it. */
+	int32 GetLatestDelay() const;
+	int32 GetChangeCount() const { return ChangeCount; }
+
+	const TMap<FSeinPlayerID, FSeinSubmissionLeadHistogram>& GetSessionLeads() const { return SessionLeads; }
+	const FSeinSubmissionLeadHistogram& GetWindowLeads() const { return WindowLeads; }
+
+private:
+	struct FScheduleEntry
+	{
+		int32 FromTurn = 0;
+		int32 Delay = 0;
+	};
+
+	/** Move the schedule from FromTurn when the open window calls for it. */
+	void Evaluate(int32 FromTurn, int32 CoordinatorTurn);
+	void OpenWindow(int32 CoordinatorTurn);
+
+	/** Entries kept for late out-of-order commits; changes are at least a
+	 *  few turns apart, so this spans far more than the protocol window. */
+	static constexpr int32 MaxScheduleEntries = 16;
+
+	FSeinAdaptiveInputDelayConfig Config;
+	TArray<FScheduleEntry> Schedule;
+	TMap<FSeinPlayerID, FSeinSubmissionLeadHistogram> SessionLeads;
+	FSeinSubmissionLeadHistogram WindowLeads;
+	int32 WindowStartTurn = INDEX_NONE;
+	/** First turn whose submissions were all authored under the current delay. */
+	int32 SettledFromTurn = 0;
+	int32 HighestStampedTurn = INDEX_NONE;
+	int32 ChangeCount = 0;
+};
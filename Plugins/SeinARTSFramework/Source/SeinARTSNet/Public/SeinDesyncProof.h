@@ -0,0 +1,257 @@
+/**
+ * SeinARTS Framework - Copyright (c) 2026 Phenom Studios, Inc.
+ *
+ * @file         SeinDesyncProof.h
+ * @author       RJ Macklem
+ * @created      17 Oct 2026
+ * @latest       17 Oct 2026
+ * @brief        Interactive digest-tree walk that localises a world-root
+ *               desync.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SeinNetProtocolTypes.h"
+#include "SeinDesyncProof.generated.h"
+
+struct FSeinCanonicalStateProofImage;
+struct FSeinCanonicalStateProofLeaf;
+
+UENUM()
+enum class ESeinDesyncProofQueryKind : uint8
+{
+	/** Every section digest plus each indexed section's tree shape. */
+	Sections,
+	/** Heap node digests inside one section tree. */
+	Nodes,
+	/** Leaf digests plus bounded live payload text. */
+	Leaves,
+};
+
+/** Coordinator -> peer. One step of a desync localisation walk. */
+USTRUCT()
+struct SEINARTSNET_API FSeinDesyncProofQuery
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	ESeinDesyncProofQueryKind Kind = ESeinDesyncProofQueryKind::Sections;
+
+	/** Section being descended; empty for Sections. */
+	UPROPERTY()
+	FString SectionId;
+
+	/** Heap node indices (Nodes) or leaf indices (Leaves), ascending. */
+	UPROPERTY()
+	TArray<int32> Indices;
+};
+
+USTRUCT()
+struct SEINARTSNET_API FSeinDesyncProofEntry
+{
+	GENERATED_BODY()
+
+	/** Sections only. */
+	UPROPERTY()
+	FString SectionId;
+
+	/** Node or leaf index echoed from the query. */
+	UPROPERTY()
+	int32 Index = INDEX_NONE;
+
+	UPROPERTY()
+	FGuid Digest;
+
+	/** Sections only: indexed tree shape, zero for unindexed sections. */
+	UPROPERTY()
+	int32 LeafCount = 0;
+
+	UPROPERTY()
+	int32 LeafBase = 0;
+
+	/** Leaves only. */
+	UPROPERTY()
+	FString Payload;
+
+	UPROPERTY()
+	bool bPayloadAtCheckpoint = false;
+};
+
+/** Peer -> coordinator. Answer computed against the peer's retained image. */
+USTRUCT()
+struct SEINARTSNET_API FSeinDesyncProofResponse
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	bool bAvailable = false;
+
+	UPROPERTY()
+	FString Error;
+
+	UPROPERTY()
+	TArray<FSeinDesyncProofEntry> Entries;
+};
+
+/** One indexed leaf whose digest differs between the two walked peers. */
+USTRUCT(BlueprintType)
+struct SEINARTSNET_API FSeinDesyncLeafDiff
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "SeinARTS|Network|Determinism")
+	FString SectionId;
+
+	/** Entity slot for entity/component sections, pool slot for pools. */
+	UPROPERTY(BlueprintReadOnly, Category = "SeinARTS|Network|Determinism")
+	int32 LeafIndex = INDEX_NONE;
+
+	UPROPERTY(BlueprintReadOnly, Category = "SeinARTS|Network|Determinism")
+	FGuid ReferenceDigest;
+
+	UPROPERTY(BlueprintReadOnly, Category = "SeinARTS|Network|Determinism")
+	FGuid DivergentDigest;
+
+	UPROPERTY(BlueprintReadOnly, Category = "SeinARTS|Network|Determinism")
+	FString ReferencePayload;
+
+	UPROPERTY(BlueprintReadOnly, Category = "SeinARTS|Network|Determinism")
+	FString DivergentPayload;
+
+	/** False when that peer's slot has changed since the check turn, so its
+	 *  payload shows later state rather than the diverged value. */
+	UPROPERTY(BlueprintReadOnly, Category = "SeinARTS|Network|Determinism")
+	bool bReferenceAtCheckpoint = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "SeinARTS|Network|Determinism")
+	bool bDivergentAtCheckpoint = false;
+};
+
+/**
+ * Outcome of one localisation walk. Non-authoritative diagnostics; fanned to
+ * every peer alongside the root alarm and never fed back into the sim.
+ */
+USTRUCT(BlueprintType)
+struct SEINARTSNET_API FSeinDesyncLocalization
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "SeinARTS|Network|Determinism")
+	int32 Turn = INDEX_NONE;
+
+	/** Majority-root participant whose state is taken as expected. */
+	UPROPERTY(BlueprintReadOnly, Category = "SeinARTS|Network|Determinism")
+	FSeinNetworkParticipantID ReferenceParticipantID;
+
+	UPROPERTY(BlueprintReadOnly, Category = "SeinARTS|Network|Determinism")
+	FSeinNetworkParticipantID DivergentParticipantID;
+
+	/** Every section whose digest differs, sorted. */
+	UPROPERTY(BlueprintReadOnly, Category = "SeinARTS|Network|Determinism")
+	TArray<FString> DivergentSections;
+
+	UPROPERTY(BlueprintReadOnly, Category = "SeinARTS|Network|Determinism")
+	TArray<FSeinDesyncLeafDiff> Leaves;
+
+	/** Some differing sections or nodes were left unwalked by the caps. */
+	UPROPERTY(BlueprintReadOnly, Category = "SeinARTS|Network|Determinism")
+	bool bTruncated = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "SeinARTS|Network|Determinism")
+	int32 RoundTrips = 0;
+
+	/** Approximate answer bytes received from both peers. */
+	UPROPERTY(BlueprintReadOnly, Category = "SeinARTS|Network|Determinism")
+	int64 ProofBytes = 0;
+
+	/** Non-empty when the walk stopped early. */
+	UPROPERTY(BlueprintReadOnly, Category = "SeinARTS|Network|Determinism")
+	FString Error;
+
+	bool IsValid() const { return Turn != INDEX_NONE; }
+	FString ToString() const;
+};
+
+/**
+ * Coordinator-side state of one two-peer walk over FSeinCanonicalStateProof
+ * images. Starts with a section digest exchange, then descends each
+ * differing indexed section one tree level per round trip, asking only for
+ * the children of nodes that still differ, and finally fetches the differing
+ * leaves' payloads. Cost is O(differing leaves * log N) digests rather than
+ * the whole state. Pure: transport, timeouts and peer selection belong to
+ * the owner.
+ */
+class SEINARTSNET_API FSeinDesyncProofWalk
+{
+public:
+	/** Mismatching nodes kept per level; wider levels mark the result truncated. */
+	static constexpr int32 MaxFrontierNodes = 64;
+	/** Indexed sections descended per walk. */
+	static constexpr int32 MaxDescendedSections = 4;
+	/** Leaf payload pairs reported per walk; bounds the fan-out RPC. */
+	static constexpr int32 MaxLeafDiffs = 8;
+
+	void Begin(
+		int32 Turn,
+		FSeinNetworkParticipantID ReferenceParticipantID,
+		FSeinNetworkParticipantID DivergentParticipantID);
+	void Reset();
+
+	bool IsActive() const { return bActive; }
+	const FSeinDesyncProofQuery& GetPendingQuery() const { return PendingQuery; }
+
+	/** Consume both peers' answers to the pending query and either issue the
+	 *  next query or finish. */
+	void Advance(
+		const FSeinDesyncProofResponse& Reference,
+		const FSeinDesyncProofResponse& Divergent);
+
+	/** Stop with whatever has been localised so far. */
+	void Abort(const FString& Reason);
+
+	const FSeinDesyncLocalization& GetResult() const { return Result; }
+
+	/**
+	 * Peer side: answer Query from a retained image. DescribeLeaf renders
+	 * one live leaf (USeinWorldSubsystem::DescribeCanonicalStateProofLeaf).
+	 */
+	static void Answer(
+		const FSeinCanonicalStateProofImage& Image,
+		const FSeinDesyncProofQuery& Query,
+		TFunctionRef<bool(FStringView, int32, FSeinCanonicalStateProofLeaf&, FString&)> DescribeLeaf,
+		FSeinDesyncProofResponse& OutResponse);
+
+	static int64 EstimateWireBytes(const FSeinDesyncProofResponse& Response);
+
+private:
+	struct FSectionShape
+	{
+		FString SectionId;
+		int32 LeafCount = 0;
+		int32 LeafBase = 0;
+	};
+
+	bool CompareSections(
+		const FSeinDesyncProofResponse& Reference,
+		const FSeinDesyncProofResponse& Divergent);
+	bool CompareNodes(
+		const FSeinDesyncProofResponse& Reference,
+		const FSeinDesyncProofResponse& Divergent);
+	void CompareLeaves(
+		const FSeinDesyncProofResponse& Reference,
+		const FSeinDesyncProofResponse& Divergent);
+	/** Query the children of Frontier, or its leaves at the bottom level. */
+	void QueryBelowFrontier();
+	/** Start the next queued section, or finish when none remain. */
+	void StartNextSection();
+	void Finish();
+
+	FSeinDesyncLocalization Result;
+	FSeinDesyncProofQuery PendingQuery;
+	TArray<FSectionShape> SectionQueue;
+	FSectionShape ActiveSection;
+	/** Mismatching heap nodes at the level being descended, ascending. */
+	TArray<int32> Frontier;
+	bool bActive = false;
+};
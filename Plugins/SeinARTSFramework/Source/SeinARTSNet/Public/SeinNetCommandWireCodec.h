@@ -75,6 +75,8 @@ public:
 		FString& OutError,
 		uint64* OutDecodedAllocationBytes = nullptr);
 
+	/** Canonical decoders accept a control-carrying turn and discard its
+	 *  record; use DecodeTurn where the record matters. */
 	static bool DecodeCommandsWithCost(
 		const FSeinOpaqueCommandBatch& Batch,
 		int32 MaxCommands,
@@ -91,4 +93,23 @@ public:
 		TArray<FSeinCommand>& OutCommands,
 		FString& OutError,
 		uint64* OutDecodedAllocationBytes = nullptr);
+
+	/** Canonical turn fan-out. A set control record switches the batch to the
+	 *  control mode, which appends the record after the commands; an unset
+	 *  one produces exactly the EncodeCommands bytes. */
+	static bool EncodeTurn(
+		TConstArrayView<FSeinCommand> Commands,
+		const FSeinTurnControlRecord& Control,
+		int32 MaxCommands,
+		FSeinCommandWireSchemaLookup FindSchema,
+		FSeinOpaqueCommandBatch& OutBatch,
+		FString& OutError);
+
+	static bool DecodeTurn(
+		const FSeinOpaqueCommandBatch& Batch,
+		int32 MaxCommands,
+		FSeinCommandWireSchemaLookup FindSchema,
+		TArray<FSeinCommand>& OutCommands,
+		FSeinTurnControlRecord& OutControl,
+		FString& OutError);
 };
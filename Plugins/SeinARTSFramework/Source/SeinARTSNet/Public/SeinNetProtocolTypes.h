@@ -23,8 +23,26 @@ namespace SeinNetProtocolLimits
 		SeinCommandProtocolLimits::MaxCommandsPerAuthor;
 	constexpr int32 MaxCommandsPerCanonicalTurn =
 		MaxCommandAuthors * MaxCommandsPerAuthor;
+
+	/** Highest input delay a turn control record may announce. Matches the
+	 *  InputDelayTurns settings clamp. */
+	constexpr int32 MaxInputDelayTurns = 10;
 }
 
+/**
+ * Coordinator scheduling carried inside a committed turn. Zero fields are
+ * absent and keep the plain canonical batch encoding. A present input delay
+ * becomes every peer's outgoing-turn offset from the boundary that ends this
+ * turn, so all peers switch at the same turn without a resync. Transport
+ * scheduling only: simulation content and replays ignore it.
+ */
+struct FSeinTurnControlRecord
+{
+	uint8 InputDelayTurns = 0;
+
+	bool IsSet() const { return InputDelayTurns != 0; }
+};
+
 /** What a world transition means to match-scoped network state. */
 UENUM(BlueprintType)
 enum class ESeinMatchTravelIntent : uint8
@@ -31,6 +31,7 @@
 #include "Core/SeinFactionID.h"
 #include "Data/SeinMatchSettings.h" // ESeinSlotState
 #include "GameplayTagContainer.h"
+#include "SeinDesyncProof.h"
 #include "SeinNetProtocolTypes.h"
 #include "Simulation/SeinMatchBootstrapBarrier.h"
 #include "SeinNetRelay.generated.h"
@@ -286,6 +287,31 @@ public:
 		int32 Turn,
 		const TArray<FSeinParticipantWorldRootEntry>& PeerRoots);
 
+	/** Coordinator -> owning peer. One step of desync localisation: answer
+	 *  Query from the proof image retained for check turn `Turn`. ProbeId ties
+	 *  the answer to the coordinator's current walk. */
+	UFUNCTION(Client, Reliable)
+	void Client_RequestDesyncProof(
+		const FSeinProtocolContext& Context,
+		int32 ProbeId,
+		int32 Turn,
+		const FSeinDesyncProofQuery& Query);
+
+	/** Owning peer -> coordinator. Answer to Client_RequestDesyncProof. The
+	 *  answering participant is this relay's authenticated binding. */
+	UFUNCTION(Server, Reliable)
+	void Server_ReportDesyncProof(
+		const FSeinProtocolContext& Context,
+		int32 ProbeId,
+		const FSeinDesyncProofResponse& Response);
+
+	/** Coordinator -> owning peer. Finished localisation for a desync already
+	 *  raised by Client_NotifyDesync: differing sections and leaf payloads. */
+	UFUNCTION(Client, Reliable)
+	void Client_NotifyDesyncLocalized(
+		const FSeinProtocolContext& Context,
+		const FSeinDesyncLocalization& Localization);
+
 	/** Coordinator -> owning peer. Canonical root health can no longer be
 	 *  proven, so this lockstep epoch is terminal rather than fail-open. */
 	UFUNCTION(Client, Reliable)
@@ -35,6 +35,9 @@
 #include "SeinNetProtocolTypes.h"
 #include "SeinBootstrapConsensus.h"
 #include "SeinTurnAggregator.h"
+#include "SeinAdaptiveInputDelay.h"
+#include "SeinDesyncProof.h"
+#include "Serialization/SeinCanonicalStateProof.h"
 #include "SeinNetSubsystem.generated.h"
 
 class ASeinNetRelay;
@@ -641,6 +644,35 @@ public:
 	 *  sim on detection (default: continue ticking, just show alarm). */
 	bool IsLocalDesyncDetected() const { return bDesyncDetected; }
 
+	/** Peer-side: answer one localisation step from the proof image retained
+	 *  for `Turn` and reply on the same relay. */
+	void ClientHandleDesyncProofRequest(
+		ASeinNetRelay* SourceRelay,
+		const FSeinProtocolContext& Context,
+		int32 ProbeId,
+		int32 Turn,
+		const FSeinDesyncProofQuery& Query);
+
+	/** Coordinator-side: a walked peer answered the current probe. */
+	void ServerHandleDesyncProofResponse(
+		ASeinNetRelay* SourceRelay,
+		const FSeinProtocolContext& Context,
+		int32 ProbeId,
+		const FSeinDesyncProofResponse& Response);
+
+	/** Peer-side: the coordinator finished localising a desync. Logs the
+	 *  report and surfaces the first differing leaves on screen. */
+	void ClientHandleDesyncLocalization(
+		const FSeinProtocolContext& Context,
+		const FSeinDesyncLocalization& Localization);
+
+	/** Most recent desync localisation this process received or produced.
+	 *  Invalid (Turn == INDEX_NONE) until one completes. */
+	const FSeinDesyncLocalization& GetLastDesyncLocalization() const
+	{
+		return LastDesyncLocalization;
+	}
+
 	/** Coordinator-side, non-authoritative qualification telemetry. These
 	 *  values advance only after every expected live reporter supplied the
 	 *  same canonical world root. They never participate in simulation state. */
@@ -979,7 +1011,8 @@ private:
 	/** Subscribed to USeinWorldSubsystem::OnSimTickCompleted via
 	 *  TickCompletedHandle. At every turn boundary, flushes pending outgoing
 	 *  commands (or an empty heartbeat) to the server so the gate can
-	 *  complete on every connected peer. */
+	 *  complete on every connected peer. Under the dedicated simulation
+	 *  thread this runs at the join, which always ends on the closing tick. */
 	void OnSimTickCompleted(int32 CompletedTick);
 
 	/** Execute a standalone start/resume request. Network launch never enters. */
@@ -989,8 +1022,13 @@ private:
 	 *  This avoids depending on local Client RPC loopback for listen hosts and
 	 *  supplies dedicated authorities, which have no owning relay. */
 	bool BufferAssembledTurnForLocalAuthority(
-		int32 TurnId, const TArray<FSeinCommand>& Commands);
-	void BufferReceivedTurn(int32 TurnId, const TArray<FSeinCommand>& Commands);
+		int32 TurnId,
+		const TArray<FSeinCommand>& Commands,
+		const FSeinTurnControlRecord& Control = FSeinTurnControlRecord());
+	void BufferReceivedTurn(
+		int32 TurnId,
+		const TArray<FSeinCommand>& Commands,
+		const FSeinTurnControlRecord& Control = FSeinTurnControlRecord());
 
 	/** Freeze every not-yet-queued turn through FinalTurn. Catch-up turns are
 	 *  heartbeats; when bAttachCurrentCommands is true the final turn receives
@@ -1017,7 +1055,13 @@ private:
 
 	/** Read-helper: ticks-per-turn from settings, with sane fallback. */
 	int32 GetTicksPerTurn() const;
+	/** The delay the last consumed control record announced, else settings. */
 	int32 GetInputDelayTurns() const;
+	/** Settings delay: the epoch's grace turns and first heartbeat. */
+	int32 GetConfiguredInputDelayTurns() const;
+	/** Largest delay any peer may currently be authoring with. Bounds the
+	 *  protocol window while a delay change is in flight. */
+	int32 GetInputDelayTurnsBound() const;
 	int32 GetCurrentTurn() const;
 	bool IsCommandTurnWithinProtocolWindow(int32 TurnId, const TCHAR* Context) const;
 	bool IsDeterminismEvidenceTurnWithinProtocolWindow(
@@ -1148,6 +1192,7 @@ private:
 	 *  BindLockstepHooksForCurrentWorld and cleared with the turn epoch. */
 	FDelegateHandle TickCompletedHandle;
 	FDelegateHandle ExecutionTopologyInvalidatedHandle;
+	FDelegateHandle SimulationThreadVetoHandle;
 	bool bModuleOwnedStateReleased = false;
 
 	/** Tracks WHICH WorldSubsystem the world-scoped handles are bound to.
@@ -1165,6 +1210,10 @@ private:
 	 *  drainage at the matching sim-tick turn boundary. Keyed by turn ID. */
 	TMap<int32, TArray<FSeinCommand>> ReceivedTurns;
 
+	/** Control records of buffered turns, applied when the turn is consumed.
+	 *  Pruned alongside ReceivedTurns. */
+	TMap<int32, FSeinTurnControlRecord> ReceivedTurnControls;
+
 	/** Coordinator-side: the EXACT opaque fan-out bytes of every committed
 	 *  turn inside the shared protocol history window, pruned alongside the
 	 *  other per-turn ledgers. This is the resync command-tail source: serving
@@ -1489,6 +1538,29 @@ private:
 	TArray<FSeinPendingWorldStateRootReport> PendingWorldStateRootReports;
 	int32 LastWorldStateRootQueuedTurn = -1;
 
+	// ============== Desync localisation ==============
+	// On a root mismatch the coordinator walks the digest trees of one
+	// majority peer and one divergent peer, one level per round trip, until
+	// it reaches the differing leaves. Diagnostics only; none of this is
+	// simulation state.
+
+	/** Peer-side: proof images for the latest reported check turns, oldest
+	 *  first, bounded by DesyncProofRetainedChecks. Consecutive images share
+	 *  unchanged section trees. */
+	TArray<TPair<int32 /*Turn*/, FSeinCanonicalStateProofImage>>
+		DesyncProofImages;
+
+	/** Coordinator-side: the walk in flight, its probe id, and the answers
+	 *  collected for the current probe. */
+	FSeinDesyncProofWalk DesyncProofWalk;
+	int32 DesyncProofProbeId = 0;
+	int32 DesyncProofStartedAtTurn = INDEX_NONE;
+	TOptional<FSeinDesyncProofResponse> DesyncProofReferenceResponse;
+	TOptional<FSeinDesyncProofResponse> DesyncProofDivergentResponse;
+
+	/** Both sides: last finished localisation, for Sein.Net.DumpDesyncReport. */
+	FSeinDesyncLocalization LastDesyncLocalization;
+
 	/** Local terminal state. A participant-local capture failure is provisional
 	 *  until the coordinator distributes one canonical failure value. */
 	FSeinDeterminismSessionFailure DeterminismSessionFailure;
@@ -1538,18 +1610,63 @@ private:
 	 *  Client_NotifyDesync to every relay. */
 	void ServerCompareWorldStateRootsForTurn(int32 Turn);
 
+	/** Image the just-sealed routine root for `Turn` into the retained ring. */
+	void RetainDesyncProofImage(int32 Turn);
+	/** Answer a localisation query from the image retained for `Turn`. */
+	void AnswerDesyncProofQuery(
+		int32 Turn,
+		const FSeinDesyncProofQuery& Query,
+		FSeinDesyncProofResponse& OutResponse) const;
+	/** Coordinator-only: start walking a majority peer against the first
+	 *  divergent one. A walk already in flight keeps running. */
+	void ServerBeginDesyncLocalization(
+		int32 Turn,
+		const TArray<FSeinParticipantWorldRootEntry>& SortedRoots);
+	void ServerIssueDesyncProofQuery();
+	void ServerAcceptDesyncProofResponse(
+		FSeinNetworkParticipantID ParticipantID,
+		int32 ProbeId,
+		const FSeinDesyncProofResponse& Response);
+	/** Abandon a walk whose peers stopped answering. */
+	void ServerExpireDesyncLocalization(int32 JustFinishedTurn);
+	/** Fan the finished walk to every relay. */
+	void ServerFinishDesyncLocalization();
+	ASeinNetRelay* FindRelayForParticipant(
+		FSeinNetworkParticipantID ParticipantID) const;
+	bool IsDesyncLocalizationEnabled() const;
+
 	/** Read-helpers from settings. */
 	bool IsDeterminismGossipEnabled() const;
 	bool IsConfigParityCheckEnabled() const;
 	int32 GetDeterminismCheckIntervalTurns() const;
 
-	// ============== Adaptive input delay observability (Phase 4 polish) ==============
-	// MVP: observability-only. Tracks per-peer late-submission events and logs
-	// a recommendation when stragglers are detected. Full automatic delay
-	// raising is deferred — it requires a replicated dynamic-delay state and
-	// careful synchronization across the grace period to avoid cross-peer
-	// disagreement on outgoing-turn arithmetic. Today designers can manually
-	// raise InputDelayTurns in settings + restart the session.
+	// ============== Adaptive input delay ==============
+	// With bAdaptiveInputDelay the coordinator measures every accepted
+	// submission's lead over its own execution and stamps the chosen delay
+	// into each committed turn (FSeinTurnControlRecord). Peers adopt it when
+	// they consume that turn, so the outgoing-turn arithmetic switches at the
+	// same boundary everywhere. A raise heartbeat-fills the skipped turns; a
+	// drop leaves already-queued turns in place and resumes once the new
+	// outgoing turn passes them. Without the setting the straggler counts
+	// below remain the only signal.
+
+	/** Coordinator-side scheduler; configured from settings per epoch. */
+	FSeinAdaptiveInputDelay AdaptiveInputDelay;
+
+	/** Delay from the last consumed control record; 0 until one arrives. */
+	int32 ActiveInputDelayTurns = 0;
+
+	/** Largest delay any buffered or consumed record announced this epoch. */
+	int32 HighestAnnouncedInputDelayTurns = 0;
+
+	/** Server-side: newest turn the boundary pipeline injected heartbeats for
+	 *  and checked, so a raised delay also covers the turns it skipped. */
+	int32 ServerLastPipelineTurn = -1;
+
+	/** Durations of this peer's execution-gate stalls this epoch. */
+	FSeinGateStallHistogram GateStallHistogram;
+
+	void ConfigureAdaptiveInputDelay();
 
 	/** Server-side: per-peer count of "this slot completed a turn after its
 	 *  execution gate was reached" events. Surfaces in
@@ -1577,4 +1694,12 @@ public:
 	/** Server-only: total completed turns since session start (denominator
 	 *  for straggle-rate calculation in the report). */
 	int32 GetTurnsCompletedCount() const { return TurnsCompletedCount; }
+
+	/** Adaptive scheduler state for Sein.Net.LatencyReport. */
+	const FSeinAdaptiveInputDelay& GetAdaptiveInputDelay() const { return AdaptiveInputDelay; }
+
+	/** Delay this peer currently authors with. */
+	int32 GetActiveInputDelayTurns() const { return GetInputDelayTurns(); }
+
+	const FSeinGateStallHistogram& GetGateStallHistogram() const { return GateStallHistogram; }
 };
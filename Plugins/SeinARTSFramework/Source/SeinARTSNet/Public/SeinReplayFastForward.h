@@ -0,0 +1,152 @@
+/**
+ * SeinARTS Framework - Copyright (c) 2026 Phenom Studios, Inc.
+ *
+ * @file         SeinReplayFastForward.h
+ * @author       RJ Macklem
+ * @created      17 Oct 2026
+ * @latest       17 Oct 2026
+ * @brief        Headless, unthrottled playback of one .seinreplay for
+ *               regression and profiling runs.
+ *
+ * The ordinary reader is driven by the world tick, so a 40-minute match takes
+ * 40 minutes to verify. The fast-forward runner plays the same journal through
+ * the same reader, but pumps the simulation with
+ * `USeinWorldSubsystem::AdvanceSimulationUnthrottled`: every tick runs the
+ * normal gates and replay command lane, while the engine world itself is
+ * never ticked and no presentation frame is published (no actor bridge
+ * snapshots, fog render or UI refresh).
+ *
+ * Optional root verification mirrors the live match's gossip cadence: at
+ * every `DeterminismCheckIntervalTurns` boundary the incrementally sealed
+ * canonical root is checked against an independent from-scratch rebuild and
+ * recorded, so nightly runs can diff roots across builds.
+ *
+ * Segmented verification splits a v9 journal at its indexed checkpoints.
+ * Every segment restores its own checkpoint in a separate pristine world,
+ * fast-forwards to the next checkpoint tick and seals the root there; the
+ * sealed end root of one segment must equal the restored start root of the
+ * next. Segments share no state, so the commandlet runs them as concurrent
+ * worker processes (engine worlds are bound to their process's game thread).
+ *
+ * Driven by `USeinReplayFastForwardCommandlet`; callable directly from tests
+ * or tools that already own a pristine Standalone world.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Simulation/SeinWorldSubsystem.h"
+
+class UWorld;
+
+struct FSeinReplayFastForwardOptions
+{
+	/** Seek target. Zero plays from the journal's tick-zero bootstrap. */
+	int32 StartTick = 0;
+
+	/** Stop and seal the root at this tick instead of playing to EndTick.
+	 *  Zero (or anything at or past EndTick) plays the whole journal. */
+	int32 StopTick = 0;
+
+	/** Verify and record the canonical root at every check boundary. */
+	bool bVerifyRoots = false;
+
+	/** Turns between verified roots. Zero uses the project's
+	 *  DeterminismCheckIntervalTurns (the live gossip cadence). */
+	int32 VerifyIntervalTurns = 0;
+
+	/** Upper bound on ticks per unthrottled pump when not verifying. */
+	int32 MaxTicksPerBatch = 1024;
+};
+
+struct FSeinReplayFastForwardRoot
+{
+	int32 Tick = 0;
+	FGuid Root;
+};
+
+struct FSeinReplayFastForwardReport
+{
+	/** True when playback reached the journal's EndTick with every verified
+	 *  root matching its rebuild. */
+	bool bSucceeded = false;
+	FString FailureReason;
+
+	int32 StartTick = 0;
+	int32 EndTick = 0;
+	int32 TicksSimulated = 0;
+	double WallSeconds = 0.0;
+	double TicksPerSecond = 0.0;
+
+	/** Per-system wall-clock totals over the run, canonical dispatch order. */
+	TArray<FSeinSystemTickTiming> SystemTimings;
+
+	/** Verified routine roots in tick order (empty unless bVerifyRoots). */
+	TArray<FSeinReplayFastForwardRoot> VerifiedRoots;
+
+	/** Canonical root of a restored checkpoint start. Invalid for tick-zero
+	 *  starts, which have nothing to compare against. */
+	FGuid StartRoot;
+
+	/** Canonical root of the final state. Invalid when it could not be taken. */
+	FGuid FinalRoot;
+};
+
+/** One checkpoint-to-checkpoint span of a segmented verification. */
+struct FSeinReplaySegment
+{
+	int32 StartTick = 0;
+	int32 StopTick = 0;
+};
+
+struct FSeinReplaySegmentResult
+{
+	int32 StartTick = 0;
+	int32 StopTick = 0;
+	bool bSucceeded = false;
+	FString FailureReason;
+	/** Root restored from the segment's starting checkpoint. */
+	FGuid StartRoot;
+	/** Root sealed after simulating to StopTick. */
+	FGuid EndRoot;
+	double WallSeconds = 0.0;
+};
+
+namespace SeinReplayFastForward
+{
+	/**
+	 * Load Path into a fresh reader owned by World, play it unthrottled to
+	 * its EndTick, and fill OutReport. World must be a pristine, non-running,
+	 * Standalone tick-zero world (the reader's ordinary Play preconditions);
+	 * the caller must not tick it concurrently. Returns OutReport.bSucceeded.
+	 */
+	SEINARTSNET_API bool Run(
+		UWorld& World,
+		const FString& Path,
+		const FSeinReplayFastForwardOptions& Options,
+		FSeinReplayFastForwardReport& OutReport);
+
+	/**
+	 * Split [0, EndTick] at CheckpointTicks (any order; ticks outside
+	 * (0, EndTick) are ignored). A terminal checkpoint at EndTick starts no
+	 * segment, so the last span is only covered by its own root checks.
+	 */
+	SEINARTSNET_API void PlanSegments(
+		TConstArrayView<int32> CheckpointTicks,
+		int32 EndTick,
+		TArray<FSeinReplaySegment>& OutSegments);
+
+	/**
+	 * Index of the first segment that failed or whose sealed end root differs
+	 * from the next segment's restored start root, or INDEX_NONE when every
+	 * seam agrees. Results must be in segment order.
+	 */
+	SEINARTSNET_API int32 FindFirstDivergentSegment(
+		TConstArrayView<FSeinReplaySegmentResult> Results,
+		FString& OutReason);
+
+	/** Log one report: throughput, roots, then systems by descending cost. */
+	SEINARTSNET_API void LogReport(
+		const FString& Label,
+		const FSeinReplayFastForwardReport& Report);
+}
@@ -0,0 +1,71 @@
+/**
+ * SeinARTS Framework - Copyright (c) 2026 Phenom Studios, Inc.
+ *
+ * @file         SeinReplayFastForwardCommandlet.h
+ * @author       RJ Macklem
+ * @created      17 Oct 2026
+ * @latest       17 Oct 2026
+ * @brief        Batch entry point for headless replay fast-forward runs.
+ *
+ * Usage (CPU-only agents, no rendering):
+ *   UnrealEditor-Cmd <Project> -run=SeinReplayFastForward -Map=<LongPackageName>
+ *       -Replay=<FileOrPath> | -ReplayDir=<Directory>
+ *       [-StartTick=N] [-VerifyRoots] [-VerifyIntervalTurns=N]
+ *       [-Segmented [-Jobs=N]]
+ *       -nullrhi -unattended
+ *
+ * Each replay gets a fresh Standalone game world of -Map, with no scenes,
+ * physics, navigation, audio or FX, and is played through
+ * SeinReplayFastForward::Run. A replay recorded on another map is rejected by
+ * the reader's ordinary compatibility check, so batch one map per run.
+ * Journals must live under Saved/Replays (the reader's checkpoint containment
+ * rule). Exit code is the number of failed replays, so a nightly job can gate
+ * on it directly.
+ *
+ * -Segmented splits each v9 journal at its checkpoints and verifies every
+ * segment in its own worker process (at most -Jobs at once, default one per
+ * physical core), then reports the first segment whose sealed root misses the
+ * next checkpoint. -StartTick is ignored in this mode. Workers re-enter this
+ * commandlet with the internal -SegmentWorker -StartTick=A -StopTick=B
+ * -SegmentResult=<File> switches and write their result to that file.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "SeinReplayFastForwardCommandlet.generated.h"
+
+struct FSeinReplayFastForwardOptions;
+
+UCLASS()
+class SEINARTSNET_API USeinReplayFastForwardCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	USeinReplayFastForwardCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+private:
+	/** Fast-forward one journal in its own throwaway world. */
+	bool RunOne(
+		const FString& MapPackageName,
+		const FString& Path,
+		const FSeinReplayFastForwardOptions& Options);
+
+	/** Verify one journal's checkpoint segments across worker processes. */
+	bool RunSegmented(
+		const FString& MapPackageName,
+		const FString& Path,
+		const FSeinReplayFastForwardOptions& Options,
+		int32 MaxJobs);
+
+	/** Worker side of RunSegmented: one segment, result written to ResultPath. */
+	bool RunSegmentWorker(
+		const FString& MapPackageName,
+		const FString& Path,
+		const FSeinReplayFastForwardOptions& Options,
+		const FString& ResultPath);
+};
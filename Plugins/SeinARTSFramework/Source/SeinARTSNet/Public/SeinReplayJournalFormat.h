@@ -28,6 +28,11 @@ namespace SeinReplayJournalFormat
 	constexpr uint64 MaxCheckpointPayloadBytes =
 		static_cast<uint64>(FSeinSnapshotEnvelopeCodec::PrefixBytes)
 		+ FSeinSnapshotEnvelopeCodec::MaxBodyBytes;
+	/** Checkpoint-only frame flag: the payload is a section-coded envelope. */
+	constexpr uint8 CheckpointFlagSectionCoded = 0x01;
+	constexpr uint8 CheckpointCodingVersion = 1;
+	/** Longest keyframe-to-keyframe span, so a seek decodes a bounded chain. */
+	constexpr int32 MaxCheckpointKeyframeInterval = 64;
 	constexpr uint8 Magic[8] = {'S', 'E', 'I', 'N', 'R', 'P', 'L', '9'};
 	constexpr uint8 FrameMagic[4] = {'S', 'R', 'F', '9'};
 
@@ -81,6 +86,34 @@ namespace SeinReplayJournalFormat
 		uint32 AppliedTurnCount = 0;
 	};
 
+	/**
+	 * How the writer stores checkpoint envelopes. The default writes plain
+	 * canonical envelopes, byte-identical to journals that predate coding.
+	 */
+	struct SEINARTSNET_API FCheckpointCodingPolicy
+	{
+		/** Checkpoints per keyframe; each later one is a delta against the
+		 *  checkpoint before it. 1 disables deltas. */
+		int32 KeyframeInterval = 1;
+		/** Let sections choose LZ4 when it is smaller. */
+		bool bCompress = false;
+
+		bool IsPlain() const { return KeyframeInterval <= 1 && !bCompress; }
+	};
+
+	/**
+	 * Canonical section payloads of the last coded checkpoint, in directory
+	 * order: the base the next delta is encoded or decoded against.
+	 */
+	struct SEINARTSNET_API FCheckpointDeltaBase
+	{
+		/** 0 for a keyframe; INDEX_NONE when there is no base. */
+		int32 ChainDepth = INDEX_NONE;
+		TArray<TArray<uint8>> SectionPayloads;
+
+		bool IsSet() const { return ChainDepth != INDEX_NONE; }
+	};
+
 	/** Build exactly one digest-bound 152-byte journal prefix. Outputs are transactional. */
 	SEINARTSNET_API bool BuildPrefix(
 		const FGuid& CommandProtocolDigest,
@@ -144,6 +177,38 @@ namespace SeinReplayJournalFormat
 		TArray<FTurnRecord>& OutRecords,
 		FString& OutError);
 
+	/**
+	 * Store one canonical checkpoint envelope under Policy. A plain policy
+	 * returns the envelope unchanged with no flags. Otherwise the payload keeps
+	 * the envelope prefix and directory verbatim and stores every section with
+	 * the smallest codec allowed at its chain depth: keyframes never reference
+	 * a base, deltas reference Previous. The checkpoint digests stay those of
+	 * the canonical envelope. Outputs change only on success.
+	 */
+	SEINARTSNET_API bool EncodeCheckpointPayload(
+		TConstArrayView<uint8> Envelope,
+		const FCheckpointCodingPolicy& Policy,
+		const FCheckpointDeltaBase& Previous,
+		TArray<uint8>& OutPayload,
+		uint8& OutFlags,
+		FCheckpointDeltaBase& OutBase,
+		FString& OutError);
+
+	/**
+	 * Rebuild the canonical envelope of one Checkpoint payload. Deltas need
+	 * the base produced by the checkpoint immediately before them in the same
+	 * chain. The rebuilt envelope must still pass FSeinSnapshotEnvelopeCodec::
+	 * Decode, whose body digest binds every reconstructed byte. Outputs change
+	 * only on success.
+	 */
+	SEINARTSNET_API bool DecodeCheckpointPayload(
+		uint8 Flags,
+		TConstArrayView<uint8> Payload,
+		const FCheckpointDeltaBase& Previous,
+		TArray<uint8>& OutEnvelope,
+		FCheckpointDeltaBase& OutBase,
+		FString& OutError);
+
 	/** Encode/decode the exact 16-byte Progress/Finalize payload. */
 	SEINARTSNET_API bool EncodeFrontier(
 		const FFrontier& Frontier,
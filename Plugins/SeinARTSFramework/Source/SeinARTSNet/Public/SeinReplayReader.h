@@ -94,6 +94,10 @@ public:
 			: 0;
 	}
 
+	/** Timeline ticks of every indexed v9 checkpoint in journal order,
+	 *  starting with the mandatory tick-zero checkpoint. Empty for v8. */
+	void GetCheckpointTicks(TArray<int32>& OutTicks) const;
+
 	/** Number of decoded turn records currently resident during lazy v9
 	 *  playback. Exposed for bounded-memory diagnostics. */
 	int32 GetResidentTurnCount() const
@@ -119,6 +123,8 @@ private:
 		FGuid CurrentDigest;
 		int32 FirstRecordOrdinal = 0;
 		int32 RecordCount = 0;
+		/** Section-coded checkpoints only: deltas back to their keyframe. */
+		int32 CheckpointChainDepth = 0;
 	};
 
 	bool LoadV9FromResolvedPath(
@@ -135,6 +141,12 @@ private:
 		const FIndexedJournalFrame& Descriptor,
 		TArray<uint8>& OutPayload,
 		FString& OutError) const;
+	/** Rebuild one indexed checkpoint's canonical envelope, walking its
+	 *  bounded delta chain back to the keyframe when it is section-coded. */
+	bool ReadCheckpointEnvelope(
+		const FIndexedJournalFrame& Descriptor,
+		TArray<uint8>& OutEnvelope,
+		FString& OutError) const;
 	bool ReadAndDecodeCheckpoint(
 		const FIndexedJournalFrame& Descriptor,
 		struct FSeinWorldSnapshot& OutSnapshot,
@@ -24,6 +24,7 @@
 #include "UObject/Object.h"
 #include "Data/SeinReplayHeader.h"
 #include "SeinNetProtocolTypes.h"
+#include "SeinReplayJournalFormat.h"
 #include "SeinReplayWriter.generated.h"
 
 struct FSeinReplayWriterPendingTurn
@@ -212,7 +213,8 @@ private:
 		int32 LastTurn,
 		int32 TimelineTick,
 		TConstArrayView<uint8> Payload,
-		bool bAsync = false);
+		bool bAsync = false,
+		uint8 Flags = 0);
 	bool CanPublishFrontier(int32 EndTick, FString& OutError) const;
 	bool IsPeriodicCheckpointDue() const;
 	void FailRecording(
@@ -248,6 +250,13 @@ private:
 		PendingCheckpointEncodeFuture;
 	uint64 PendingCheckpointEncodeGeneration = MAX_uint64;
 	uint64 PendingCheckpointEncodeOperationId = MAX_uint64;
+	/** Checkpoint storage policy frozen when the recording starts, and the
+	 *  canonical sections of the last appended checkpoint that the next delta
+	 *  encodes against. The base is immutable once published so a background
+	 *  encode can borrow it; the game thread swaps it only after an append. */
+	SeinReplayJournalFormat::FCheckpointCodingPolicy CheckpointCodingPolicy;
+	TSharedPtr<const SeinReplayJournalFormat::FCheckpointDeltaBase, ESPMode::ThreadSafe>
+		CheckpointDeltaBase;
 	uint64 PendingAppendOperationId = MAX_uint64;
 	uint64 NextAsyncOperationId = 1;
 	ESeinReplayAsyncAppendKind PendingAppendKind =
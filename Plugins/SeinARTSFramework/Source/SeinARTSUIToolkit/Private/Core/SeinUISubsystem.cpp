@@ -178,14 +178,10 @@ void USeinUISubsystem::HandleSimFrame(
 	if (SelectionModel)
 	{
 		SelectionModel->EnsurePlayerControllerBound();
-		// Ability availability can change every sim tick, but a single UI frame
-		// may ask for the same selection aggregate dozens of times through BP
-		// events/bindings. Invalidate once; the first read rebuilds and the rest
-		// share that exact latest-state snapshot.
-		SelectionModel->InvalidateAbilityCache();
 	}
 
-	// Refresh all entity ViewModels
+	// Refresh all entity ViewModels. Each one compares the entity's mutation
+	// revisions against its last observation and stays silent when none moved.
 	for (auto& Pair : EntityViewModels)
 	{
 		if (Pair.Value)
@@ -194,6 +190,14 @@ void USeinUISubsystem::HandleSimFrame(
 		}
 	}
 
+	// The selection aggregate follows the selected view models: it is rebuilt
+	// on the first read after any of them observed a change, and otherwise
+	// shared across frames.
+	if (SelectionModel)
+	{
+		SelectionModel->InvalidateAbilityCacheIfStale();
+	}
+
 	// Refresh all player ViewModels
 	for (auto& Pair : PlayerViewModels)
 	{
@@ -162,11 +162,42 @@ void USeinEntityViewModel::Refresh()
 		return;
 	}
 
+	// Widgets pull through the getters on OnRefreshed, so a frame in which
+	// nothing the entity presents changed needs neither the owner lookup nor
+	// the broadcast.
+	RefreshRevisionScratch.Reset();
+	GatherRefreshRevisions(RefreshRevisionScratch);
+	if (RefreshRevisionScratch == RefreshRevisions)
+	{
+		return;
+	}
+	Swap(RefreshRevisions, RefreshRevisionScratch);
+	++RefreshGeneration;
+
 	OwnerPlayerID = WorldSubsystem->GetEntityOwner(Entity);
 
 	OnRefreshed.Broadcast();
 }
 
+void USeinEntityViewModel::GatherRefreshRevisions(TArray<uint64>& OutRevisions) const
+{
+	const USeinWorldSubsystem& World = *WorldSubsystem;
+	World.GatherEntityPresentationRevisions(Entity, OutRevisions);
+
+	// Squad getters aggregate member abilities, so members' revisions count
+	// too. A roster change moves the squad component's own revision.
+	if (const FSeinSquadComponent* Squad = World.GetComponent<FSeinSquadComponent>(Entity))
+	{
+		for (const FSeinSquadSlot& Slot : Squad->Slots)
+		{
+			if (Slot.CurrentOccupant.IsValid())
+			{
+				World.GatherEntityPresentationRevisions(Slot.CurrentOccupant, OutRevisions);
+			}
+		}
+	}
+}
+
 void USeinEntityViewModel::Invalidate()
 {
 	bIsAlive = false;
@@ -59,6 +59,7 @@ void USeinSelectionModel::Deinitialize()
 	}
 	CachedPlayerController.Reset();
 	SelectedViewModels.Empty();
+	SelectedRefreshGenerations.Empty();
 	CachedSelectionAbilities.Empty();
 	BuiltAbilityCacheGeneration = 0;
 }
@@ -66,6 +67,8 @@ void USeinSelectionModel::Deinitialize()
 void USeinSelectionModel::HandleSelectionChanged()
 {
 	RebuildFromController();
+	// Always invalidate: a different selection can match the old generations.
+	RecordRefreshGenerations();
 	InvalidateAbilityCache();
 	OnSelectionChanged.Broadcast();
 }
@@ -82,6 +85,31 @@ void USeinSelectionModel::InvalidateAbilityCache()
 	}
 }
 
+void USeinSelectionModel::InvalidateAbilityCacheIfStale()
+{
+	if (RecordRefreshGenerations())
+	{
+		InvalidateAbilityCache();
+	}
+}
+
+bool USeinSelectionModel::RecordRefreshGenerations()
+{
+	bool bChanged = SelectedRefreshGenerations.Num() != SelectedViewModels.Num();
+	SelectedRefreshGenerations.SetNumZeroed(SelectedViewModels.Num());
+	for (int32 Index = 0; Index < SelectedViewModels.Num(); ++Index)
+	{
+		const USeinEntityViewModel* VM = SelectedViewModels[Index];
+		const uint64 Generation = VM ? VM->GetRefreshGeneration() : 0;
+		if (SelectedRefreshGenerations[Index] != Generation)
+		{
+			SelectedRefreshGenerations[Index] = Generation;
+			bChanged = true;
+		}
+	}
+	return bChanged;
+}
+
 void USeinSelectionModel::RebuildFromController()
 {
 	SelectedViewModels.Empty();
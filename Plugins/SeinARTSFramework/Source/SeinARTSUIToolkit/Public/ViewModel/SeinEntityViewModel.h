@@ -135,7 +135,8 @@ struct SEINARTSUITOOLKIT_API FSeinAbilityInfo
 /**
  * Generic ViewModel for any sim entity.
  *
- * Created and cached by USeinUISubsystem. Automatically refreshed each sim tick.
+ * Created and cached by USeinUISubsystem. Checked after each sim frame and
+ * refreshed only when something the entity presents has changed.
  * Widgets can:
  *   - Bind to BlueprintReadOnly properties via UMG native binding (auto-updates)
  *   - Bind to BlueprintCallable getters via UMG binding functions
@@ -252,7 +253,7 @@ public:
 
 	// ========== Lifecycle ==========
 
-	/** Fired after Refresh() updates cached data. Widgets bind to this for event-driven updates. */
+	/** Fired after Refresh() observes a change in the entity's sim state. Widgets bind to this for event-driven updates. */
 	UPROPERTY(BlueprintAssignable, Category = "SeinARTS|UI|Entity")
 	FOnEntityViewModelRefreshed OnRefreshed;
 
@@ -269,10 +270,15 @@ public:
 
 	/**
 	 * Refresh cached data from the simulation.
-	 * Called by USeinUISubsystem each sim tick.
+	 * Called by USeinUISubsystem after each sim frame. Skips the update and
+	 * OnRefreshed when none of the entity's presentation revisions advanced.
 	 */
 	void Refresh();
 
+	/** Advances each time Refresh() observes a change. Lets aggregates built
+	 *  from this view model (selection ability cache) tell if they are stale. */
+	uint64 GetRefreshGeneration() const { return RefreshGeneration; }
+
 	/**
 	 * Mark this ViewModel as invalidated (entity destroyed).
 	 * Fires OnInvalidated and clears data.
@@ -284,6 +290,15 @@ private:
 	UPROPERTY()
 	TWeakObjectPtr<USeinWorldSubsystem> WorldSubsystem;
 
+	/** Presentation revisions of the entity (plus squad members) as of the
+	 *  last observed change, and the scratch the next Refresh gathers into. */
+	TArray<uint64> RefreshRevisions;
+	TArray<uint64> RefreshRevisionScratch;
+	uint64 RefreshGeneration = 0;
+
+	/** Gather every revision this view model's getters depend on. */
+	void GatherRefreshRevisions(TArray<uint64>& OutRevisions) const;
+
 	/** Build an FSeinAbilityInfo from a USeinAbility instance.
 	 *
 	 *  `OwnerOverride` lets squad callers point the availability check at the
@@ -129,13 +129,20 @@ public:
 	void EnsurePlayerControllerBound();
 
 	/**
-	 * Mark selection-wide ability state stale for the next UI read. Called once
-	 * after each completed simulation frame. The first action-panel query rebuilds
-	 * the aggregate; every other Blueprint binding/event in that presentation
-	 * frame reuses it instead of rescanning the whole selection.
+	 * Mark selection-wide ability state stale for the next UI read. The first
+	 * action-panel query rebuilds the aggregate; every other Blueprint
+	 * binding/event reuses it instead of rescanning the whole selection.
 	 */
 	void InvalidateAbilityCache();
 
+	/**
+	 * Invalidate the ability aggregate only if a selected view model observed a
+	 * change since the last call. Called once after each completed simulation
+	 * frame, after the entity view models refresh, so a quiet selection keeps
+	 * its aggregate across frames.
+	 */
+	void InvalidateAbilityCacheIfStale();
+
 private:
 	/** Lazily rebuild the per-presentation-frame ability aggregate. */
 	void EnsureAbilityCache() const;
@@ -143,6 +150,10 @@ private:
 	/** Rebuild the ViewModel list from the current selection. */
 	void RebuildFromController();
 
+	/** Record each selected view model's refresh generation. Returns true if
+	 *  any differs from the previous record. */
+	bool RecordRefreshGenerations();
+
 	/** Called when the player controller's selection changes. */
 	UFUNCTION()
 	void HandleSelectionChanged();
@@ -165,8 +176,12 @@ private:
 	 *  refresh. Mutable because the Blueprint getters are logically const. */
 	mutable TArray<FSeinAbilityInfo> CachedSelectionAbilities;
 
-	/** Monotonic invalidation generation. A selection change or completed sim
-	 *  frame advances it; the first reader records the generation it built. */
+	/** Monotonic invalidation generation. A selection change or a refresh of
+	 *  any selected view model advances it; the first reader records the
+	 *  generation it built. */
 	uint64 AbilityCacheGeneration = 1;
 	mutable uint64 BuiltAbilityCacheGeneration = 0;
+
+	/** Refresh generations of SelectedViewModels, parallel to that array. */
+	TArray<uint64> SelectedRefreshGenerations;
 };
@@ -2,9 +2,9 @@
  * SeinARTS Test Suite - Copyright (c) 2026 Phenom Studios, Inc.
  * @file    CombatSubstrateTests.cpp
  * @brief   Combat substrate contracts: vitals seed/damage/death, weapon
- *          cycling + instant delivery, deterministic target queries,
- *          projectile flight/impact/interception, and the starter attack
- *          ability's fire loop.
+ *          cycling + instant delivery, deterministic indexed target
+ *          queries, projectile flight/impact/interception, pooled
+ *          ballistic delivery, and the starter attack ability's fire loop.
  */
 
 #include "CQTest.h"
@@ -13,16 +13,21 @@
 #include "Abilities/SeinAbility_Attack.h"
 #include "Combat/SeinCombatDamage.h"
 #include "Combat/SeinTargetQueryService.h"
+#include "Combat/SeinWeaponArchetype.h"
 #include "Combat/SeinWeaponFire.h"
 #include "Components/SeinProjectileComponent.h"
 #include "Components/SeinVitalsComponent.h"
 #include "Components/SeinWeaponComponent.h"
+#include "Data/SeinWorldSnapshot.h"
 #include "Events/SeinVisualEvent.h"
 #include "Lib/SeinAbilityBPFL.h"
+#include "Lib/SeinCombatBPFL.h"
 #include "Simulation/SeinTestMatchBootstrap.h"
 #include "Simulation/SeinTestSimContext.h"
+#include "Simulation/SeinTestSnapshotRestore.h"
 #include "Simulation/SeinWorldSubsystem.h"
 #include "Tags/SeinARTSGameplayTags.h"
+#include "UObject/StrongObjectPtr.h"
 
 struct FSeinWorldSubsystemTestAccess
 {
@@ -58,14 +63,14 @@ namespace UE::SeinARTSTests
 			return Payload;
 		}
 
-		FSeinWeaponSlot MakeWeapon(
+		FSeinWeaponProfile MakeProfile(
 			int32 Range, int32 Damage, int32 CooldownSeconds = 1)
 		{
-			FSeinWeaponSlot Slot;
-			Slot.Range = FFixedPoint::FromInt(Range);
-			Slot.CooldownSeconds = FFixedPoint::FromInt(CooldownSeconds);
-			Slot.Payload = MakePayload(Damage);
-			return Slot;
+			FSeinWeaponProfile Profile;
+			Profile.Range = FFixedPoint::FromInt(Range);
+			Profile.CooldownSeconds = FFixedPoint::FromInt(CooldownSeconds);
+			Profile.Payload = MakePayload(Damage);
+			return Profile;
 		}
 
 		struct FCombatFixture
@@ -74,6 +79,19 @@ namespace UE::SeinARTSTests
 			USeinWorldSubsystem* World = nullptr;
 			FSeinPlayerID Attacker = FSeinPlayerID(1);
 			FSeinPlayerID Defender = FSeinPlayerID(2);
+			TArray<TStrongObjectPtr<USeinWeaponArchetype>> Archetypes;
+
+			/** A slot referencing a fresh transient archetype for `Profile`. */
+			FSeinWeaponSlot MakeWeapon(const FSeinWeaponProfile& Profile)
+			{
+				USeinWeaponArchetype* Archetype =
+					NewObject<USeinWeaponArchetype>(GetTransientPackage());
+				Archetype->Profile = Profile;
+				Archetypes.Emplace(Archetype);
+				FSeinWeaponSlot Slot;
+				Slot.Archetype = Archetype;
+				return Slot;
+			}
 
 			bool Initialize(
 				TFunctionRef<void()> AuthorEntities, uint32 Seed,
@@ -176,11 +194,11 @@ namespace UE::SeinARTSTests
 				Shooter = Fixture.World->SpawnAbstractEntity(
 					FFixedTransform(At(0)), Fixture.Attacker);
 				FSeinWeaponComponent Weapons;
-				FSeinWeaponSlot Slot = MakeWeapon(2000, 10);
-				Slot.MagazineSize = 2;
-				Slot.ReloadSeconds = FFixedPoint::One;
-				Slot.CooldownSeconds = FFixedPoint::Zero;
-				Weapons.Weapons.Add(Slot);
+				FSeinWeaponProfile Profile = MakeProfile(2000, 10);
+				Profile.MagazineSize = 2;
+				Profile.ReloadSeconds = FFixedPoint::One;
+				Profile.CooldownSeconds = FFixedPoint::Zero;
+				Weapons.Weapons.Add(Fixture.MakeWeapon(Profile));
 				Fixture.World->AddComponent(Shooter, Weapons);
 				Victim = Fixture.World->SpawnAbstractEntity(
 					FFixedTransform(At(500)), Fixture.Defender);
@@ -233,6 +251,114 @@ namespace UE::SeinARTSTests
 		Fixture.World->StopSimulation();
 	}
 
+	TEST(WeaponSlotsShareOneArchetypeProfile,
+		"SeinARTS.Sim.Combat.Weapons")
+	{
+		using namespace CombatSubstrateTestLocal;
+		FCombatFixture Fixture;
+		FSeinEntityHandle First;
+		FSeinEntityHandle Second;
+		FSeinEntityHandle Unarmed;
+		FSeinEntityHandle Victim;
+		ASSERT_THAT(IsTrue(Fixture.Initialize(
+			[&]()
+			{
+				FSeinWeaponProfile Profile = MakeProfile(2000, 10);
+				Profile.MagazineSize = 3;
+				FSeinWeaponComponent Weapons;
+				Weapons.Weapons.Add(Fixture.MakeWeapon(Profile));
+				First = Fixture.World->SpawnAbstractEntity(
+					FFixedTransform(At(0)), Fixture.Attacker);
+				Fixture.World->AddComponent(First, Weapons);
+				Second = Fixture.World->SpawnAbstractEntity(
+					FFixedTransform(At(0, 100)), Fixture.Attacker);
+				Fixture.World->AddComponent(Second, Weapons);
+				// A slot with no archetype is inert, never a default gun.
+				FSeinWeaponComponent Empty;
+				Empty.Weapons.AddDefaulted();
+				Unarmed = Fixture.World->SpawnAbstractEntity(
+					FFixedTransform(At(0, 200)), Fixture.Attacker);
+				Fixture.World->AddComponent(Unarmed, Empty);
+				Victim = Fixture.World->SpawnAbstractEntity(
+					FFixedTransform(At(500)), Fixture.Defender);
+				Fixture.World->AddComponent(Victim, MakeVitals(1000));
+			},
+			0x434D4237, TEXT("SeinARTS.Combat.WeaponArchetypes"))));
+
+		Fixture.Tick();
+		const FSeinWeaponComponent* FirstWeapons =
+			Fixture.World->GetComponent<FSeinWeaponComponent>(First);
+		const FSeinWeaponComponent* SecondWeapons =
+			Fixture.World->GetComponent<FSeinWeaponComponent>(Second);
+		ASSERT_THAT(IsTrue(FirstWeapons && SecondWeapons));
+		const FSeinWeaponProfile* FirstProfile = FSeinWeaponFire::ResolveProfile(
+			*Fixture.World, FirstWeapons->Weapons[0]);
+		ASSERT_THAT(IsTrue(FirstProfile != nullptr));
+		ASSERT_THAT(IsTrue(FirstProfile == FSeinWeaponFire::ResolveProfile(
+			*Fixture.World, SecondWeapons->Weapons[0])));
+		// Seeding reads the shared magazine size into each slot's own count.
+		ASSERT_THAT(AreEqual(3, FirstWeapons->Weapons[0].MagazineRemaining));
+		ASSERT_THAT(AreEqual(3, SecondWeapons->Weapons[0].MagazineRemaining));
+
+		{
+			auto SimScope = FSeinSimContextTestAccess::Enter(*Fixture.World);
+			ASSERT_THAT(IsTrue(
+				FSeinWeaponFire::TryFireWeaponAt(
+					*Fixture.World, First, 0, Victim)
+				== ESeinWeaponFireResult::Fired));
+			ASSERT_THAT(IsTrue(
+				FSeinWeaponFire::TryFireWeaponAt(
+					*Fixture.World, Second, 0, Victim)
+				== ESeinWeaponFireResult::Fired));
+			ASSERT_THAT(IsTrue(
+				FSeinWeaponFire::TryFireWeaponAt(
+					*Fixture.World, Unarmed, 0, Victim)
+				== ESeinWeaponFireResult::ArchetypeNotResident));
+
+			// Archetypes resolve only from the table filled at match start;
+			// one first named mid-match is refused rather than loaded here.
+			FSeinWeaponComponent* UnarmedWeapons =
+				Fixture.World->GetComponentMutable<FSeinWeaponComponent>(
+					Unarmed);
+			ASSERT_THAT(IsNotNull(UnarmedWeapons));
+			UnarmedWeapons->Weapons[0] =
+				Fixture.MakeWeapon(MakeProfile(2000, 10));
+			ASSERT_THAT(IsTrue(
+				FSeinWeaponFire::TryFireWeaponAt(
+					*Fixture.World, Unarmed, 0, Victim)
+				== ESeinWeaponFireResult::ArchetypeNotResident));
+		}
+		ASSERT_THAT(IsTrue(
+			Fixture.Health(Victim) == FFixedPoint::FromInt(980)));
+		// Cycling state stays per entity even though the profile is shared.
+		ASSERT_THAT(AreEqual(2,
+			Fixture.World->GetComponent<FSeinWeaponComponent>(First)
+				->Weapons[0].MagazineRemaining));
+		Fixture.World->StopSimulation();
+	}
+
+#if WITH_EDITORONLY_DATA
+	TEST(LegacyInlineWeaponSlotsAreDetectedOnLoad,
+		"SeinARTS.Unit.Combat.Weapons")
+	{
+		FSeinWeaponSlot Fresh;
+		ASSERT_THAT(IsFalse(Fresh.HasLegacyInlineProfile()));
+
+		// What a pre-archetype save loads into: inline values, no reference.
+		FSeinWeaponSlot Legacy;
+		Legacy.Range_DEPRECATED = FFixedPoint::FromInt(1500);
+		Legacy.Payload_DEPRECATED.BaseDamage = FFixedPoint::FromInt(25);
+		ASSERT_THAT(IsTrue(Legacy.HasLegacyInlineProfile()));
+		ASSERT_THAT(IsTrue(Legacy.Archetype.IsNull()));
+		const FSeinWeaponProfile Profile = Legacy.GetLegacyProfile();
+		ASSERT_THAT(IsTrue(Profile.Range == FFixedPoint::FromInt(1500)));
+		ASSERT_THAT(IsTrue(
+			Profile.Payload.BaseDamage == FFixedPoint::FromInt(25)));
+		ASSERT_THAT(IsTrue(
+			Profile.CooldownSeconds == FSeinWeaponProfile().CooldownSeconds));
+	}
+#endif
+
 	TEST(TargetQueriesFilterDeterministicallyAndScoreNearest,
 		"SeinARTS.Sim.Combat.Acquisition")
 	{
@@ -294,6 +420,9 @@ namespace UE::SeinARTSTests
 				FFixedTransform(At(0, 400)), Fixture.Defender);
 			Fixture.World->AddComponent(Flanker, MakeVitals(100));
 		}
+		// The flanker joins the index at the next PreTick refresh, so the
+		// arc gate (not a stale index) is what drops it.
+		Fixture.Tick();
 		Query.MaxResults = 8;
 		Query.ArcHalfAngleDegrees = FFixedPoint::FromInt(45);
 		FSeinTargetQueryService::FindTargets(
@@ -307,6 +436,97 @@ namespace UE::SeinARTSTests
 		Fixture.World->StopSimulation();
 	}
 
+	TEST(IndexedTargetQueriesRankTopKAndFollowThePreTickRefresh,
+		"SeinARTS.Sim.Combat.Acquisition")
+	{
+		using namespace CombatSubstrateTestLocal;
+		FCombatFixture Fixture;
+		FSeinEntityHandle Instigator;
+		TArray<FSeinEntityHandle> Enemies;
+		ASSERT_THAT(IsTrue(Fixture.Initialize(
+			[&]()
+			{
+				Instigator = Fixture.World->SpawnAbstractEntity(
+					FFixedTransform(At(0)), Fixture.Attacker);
+				Fixture.World->AddComponent(
+					Instigator, MakeVitals(100));
+				// A 12x6 field spanning many index cells, so the bucket
+				// fan-out (not the wide-range fallback) serves the queries.
+				for (int32 Row = 0; Row < 6; ++Row)
+				{
+					for (int32 Column = 0; Column < 12; ++Column)
+					{
+						const FSeinEntityHandle Enemy =
+							Fixture.World->SpawnAbstractEntity(
+								FFixedTransform(At(
+									-6000 + Column * 1000,
+									-3000 + Row * 1000)),
+								Fixture.Defender);
+						Fixture.World->AddComponent(Enemy, MakeVitals(100));
+						Enemies.Add(Enemy);
+					}
+				}
+			},
+			0x434D4234, TEXT("SeinARTS.Combat.AcquisitionIndexed"))));
+
+		TArray<FSeinTargetQuery> Queries;
+		for (int32 Index = 0; Index < 4; ++Index)
+		{
+			FSeinTargetQuery Query;
+			Query.Instigator = Instigator;
+			Query.Origin = At(-4000 + Index * 2500, 500);
+			Query.Range = FFixedPoint::FromInt(1500 + Index * 500);
+			Query.MaxResults = 2 + Index * 3;
+			Queries.Add(Query);
+		}
+
+		TArray<FSeinTargetCandidate> Single;
+		for (int32 Index = 0; Index < Queries.Num(); ++Index)
+		{
+			FSeinTargetQueryService::FindTargets(
+				*Fixture.World, Queries[Index], Single);
+			ASSERT_THAT(IsTrue(Single.Num() > 0));
+			ASSERT_THAT(IsTrue(Single.Num() <= Queries[Index].MaxResults));
+			for (int32 Rank = 0; Rank < Single.Num(); ++Rank)
+			{
+				// Best first; exact ties keep canonical slot order.
+				if (Rank > 0)
+				{
+					ASSERT_THAT(IsTrue(
+						Single[Rank - 1].Score > Single[Rank].Score
+						|| (Single[Rank - 1].Score == Single[Rank].Score
+							&& Single[Rank - 1].Target.Index
+								< Single[Rank].Target.Index)));
+				}
+			}
+		}
+
+		// Queries only read the index: an enemy moved onto a query origin
+		// mid-tick stays where the last PreTick refresh saw it (out of this
+		// query's cells) until the next tick re-indexes it.
+		const FSeinEntityHandle Mover = Enemies.Last();
+		{
+			auto SimScope = FSeinSimContextTestAccess::Enter(*Fixture.World);
+			if (FSeinEntity* Entity = Fixture.World->GetEntityMutable(Mover))
+			{
+				Entity->Transform.SetLocation(Queries[0].Origin);
+			}
+		}
+		FSeinTargetQueryService::FindTargets(
+			*Fixture.World, Queries[0], Single);
+		ASSERT_THAT(IsFalse(Single.ContainsByPredicate(
+			[&](const FSeinTargetCandidate& Candidate)
+			{
+				return Candidate.Target == Mover;
+			})));
+		Fixture.Tick();
+		FSeinTargetQueryService::FindTargets(
+			*Fixture.World, Queries[0], Single);
+		ASSERT_THAT(IsTrue(Single.Num() > 0));
+		ASSERT_THAT(IsTrue(Single[0].Target == Mover));
+		Fixture.World->StopSimulation();
+	}
+
 	TEST(ProjectilesFlyImpactAndCanBeIntercepted,
 		"SeinARTS.Sim.Combat.Projectiles")
 	{
@@ -320,10 +540,10 @@ namespace UE::SeinARTSTests
 				Shooter = Fixture.World->SpawnAbstractEntity(
 					FFixedTransform(At(0)), Fixture.Attacker);
 				FSeinWeaponComponent Weapons;
-				FSeinWeaponSlot Slot = MakeWeapon(5000, 25);
-				Slot.Delivery = ESeinWeaponDelivery::Projectile;
-				Slot.ProjectileSpeed = FFixedPoint::FromInt(1000);
-				Weapons.Weapons.Add(Slot);
+				FSeinWeaponProfile Profile = MakeProfile(5000, 25);
+				Profile.Delivery = ESeinWeaponDelivery::Projectile;
+				Profile.ProjectileSpeed = FFixedPoint::FromInt(1000);
+				Weapons.Weapons.Add(Fixture.MakeWeapon(Profile));
 				Fixture.World->AddComponent(Shooter, Weapons);
 				Victim = Fixture.World->SpawnAbstractEntity(
 					FFixedTransform(At(3000)), Fixture.Defender);
@@ -394,6 +614,167 @@ namespace UE::SeinARTSTests
 		Fixture.World->StopSimulation();
 	}
 
+	TEST(BallisticRoundsImpactWithoutSpawningEntities,
+		"SeinARTS.Sim.Combat.Projectiles")
+	{
+		using namespace CombatSubstrateTestLocal;
+		FCombatFixture Fixture;
+		FSeinEntityHandle Shooter;
+		FSeinEntityHandle Victim;
+		ASSERT_THAT(IsTrue(Fixture.Initialize(
+			[&]()
+			{
+				Shooter = Fixture.World->SpawnAbstractEntity(
+					FFixedTransform(At(0)), Fixture.Attacker);
+				FSeinWeaponComponent Weapons;
+				FSeinWeaponProfile Profile = MakeProfile(5000, 25);
+				Profile.Delivery = ESeinWeaponDelivery::Ballistic;
+				Profile.ProjectileSpeed = FFixedPoint::FromInt(1000);
+				Weapons.Weapons.Add(Fixture.MakeWeapon(Profile));
+				Fixture.World->AddComponent(Shooter, Weapons);
+				Victim = Fixture.World->SpawnAbstractEntity(
+					FFixedTransform(At(3000)), Fixture.Defender);
+				Fixture.World->AddComponent(Victim, MakeVitals(100));
+			},
+			0x434D4235, TEXT("SeinARTS.Combat.Ballistic"))));
+
+		Fixture.Tick();
+		const int32 EntitiesBeforeFire =
+			Fixture.World->GetEntityPool().GetActiveCount();
+		{
+			auto SimScope = FSeinSimContextTestAccess::Enter(*Fixture.World);
+			ASSERT_THAT(IsTrue(
+				FSeinWeaponFire::TryFireWeaponAt(
+					*Fixture.World, Shooter, 0, Victim)
+				== ESeinWeaponFireResult::Fired));
+		}
+		// The round lives in the combat pool, not the entity pool.
+		ASSERT_THAT(AreEqual(EntitiesBeforeFire,
+			Fixture.World->GetEntityPool().GetActiveCount()));
+		ASSERT_THAT(AreEqual(1,
+			USeinCombatBPFL::SeinGetBallisticProjectileCount(Fixture.World)));
+
+		Fixture.Tick(1);
+		ASSERT_THAT(AreEqual(1,
+			USeinCombatBPFL::SeinGetBallisticProjectileCount(Fixture.World)));
+		ASSERT_THAT(IsTrue(
+			Fixture.Health(Victim) == FFixedPoint::FromInt(100)));
+
+		// Same flight model as projectile entities: ≈ 3 s to cover 3000.
+		Fixture.Tick(120);
+		ASSERT_THAT(IsTrue(
+			Fixture.Health(Victim) == FFixedPoint::FromInt(75)));
+		ASSERT_THAT(AreEqual(0,
+			USeinCombatBPFL::SeinGetBallisticProjectileCount(Fixture.World)));
+		Fixture.World->StopSimulation();
+	}
+
+	TEST(BallisticRoundsSurviveASnapshotRoundTripMidFlight,
+		"SeinARTS.Sim.Combat.Projectiles")
+	{
+		using namespace CombatSubstrateTestLocal;
+		FCombatFixture Source;
+		FSeinEntityHandle Shooter;
+		FSeinEntityHandle Victim;
+		ASSERT_THAT(IsTrue(Source.Initialize(
+			[&]()
+			{
+				Shooter = Source.World->SpawnAbstractEntity(
+					FFixedTransform(At(0)), Source.Attacker);
+				FSeinWeaponComponent Weapons;
+				for (const int32 Damage : {25, 10})
+				{
+					FSeinWeaponProfile Profile = MakeProfile(5000, Damage);
+					Profile.Delivery = ESeinWeaponDelivery::Ballistic;
+					Profile.ProjectileSpeed = FFixedPoint::FromInt(1000);
+					Weapons.Weapons.Add(Source.MakeWeapon(Profile));
+				}
+				Source.World->AddComponent(Shooter, Weapons);
+				Victim = Source.World->SpawnAbstractEntity(
+					FFixedTransform(At(3000)), Source.Defender);
+				Source.World->AddComponent(Victim, MakeVitals(100));
+			},
+			0x434D4236, TEXT("SeinARTS.Combat.BallisticSnapshot"))));
+
+		const auto Fire = [Shooter, Victim](
+			USeinWorldSubsystem& World, int32 SlotIndex)
+		{
+			auto SimScope = FSeinSimContextTestAccess::Enter(World);
+			return FSeinWeaponFire::TryFireWeaponAt(
+				World, Shooter, SlotIndex, Victim)
+				== ESeinWeaponFireResult::Fired;
+		};
+
+		// Two rounds with distinct payloads, captured mid-flight.
+		Source.Tick();
+		ASSERT_THAT(IsTrue(Fire(*Source.World, 0)));
+		Source.Tick(20);
+		ASSERT_THAT(IsTrue(Fire(*Source.World, 1)));
+		Source.Tick(10);
+		ASSERT_THAT(AreEqual(2,
+			USeinCombatBPFL::SeinGetBallisticProjectileCount(Source.World)));
+		FString Error;
+		FGuid SourceRoot;
+		ASSERT_THAT(IsTrue(Source.World->ComputeCanonicalStateRoot(
+			SourceRoot, Error)));
+		FSeinWorldSnapshot Snapshot;
+		FSeinWorldSnapshotReferenceGuard SnapshotGuard(Snapshot);
+		Source.World->CaptureSnapshot(Snapshot);
+
+		FCombatFixture Destination;
+		Destination.World = Destination.Spawner.GetWorld()
+			.GetSubsystem<USeinWorldSubsystem>();
+		ASSERT_THAT(IsNotNull(Destination.World));
+		ASSERT_THAT(IsTrue(SeinTestSnapshotRestore::RestoreTrusted(
+			*Destination.World, Snapshot, &Error)));
+		FGuid RestoredRoot;
+		ASSERT_THAT(IsTrue(Destination.World->ComputeCanonicalStateRoot(
+			RestoredRoot, Error)));
+		ASSERT_THAT(IsTrue(SourceRoot == RestoredRoot));
+		ASSERT_THAT(AreEqual(2,
+			USeinCombatBPFL::SeinGetBallisticProjectileCount(
+				Destination.World)));
+
+		// The first round lands and frees its payload slot; a fresh round
+		// must take the same slot in both worlds.
+		for (FCombatFixture* Fixture : {&Source, &Destination})
+		{
+			Fixture->Tick(65);
+			ASSERT_THAT(IsTrue(
+				Fixture->Health(Victim) == FFixedPoint::FromInt(75)));
+			ASSERT_THAT(AreEqual(1,
+				USeinCombatBPFL::SeinGetBallisticProjectileCount(
+					Fixture->World)));
+			ASSERT_THAT(IsTrue(Fire(*Fixture->World, 0)));
+		}
+		FGuid SourceRefired;
+		FGuid DestinationRefired;
+		ASSERT_THAT(IsTrue(Source.World->ComputeCanonicalStateRoot(
+			SourceRefired, Error)));
+		ASSERT_THAT(IsTrue(Destination.World->ComputeCanonicalStateRoot(
+			DestinationRefired, Error)));
+		ASSERT_THAT(IsTrue(SourceRefired == DestinationRefired));
+
+		for (FCombatFixture* Fixture : {&Source, &Destination})
+		{
+			Fixture->Tick(150);
+			ASSERT_THAT(IsTrue(
+				Fixture->Health(Victim) == FFixedPoint::FromInt(40)));
+			ASSERT_THAT(AreEqual(0,
+				USeinCombatBPFL::SeinGetBallisticProjectileCount(
+					Fixture->World)));
+		}
+		FGuid SourceFinal;
+		FGuid DestinationFinal;
+		ASSERT_THAT(IsTrue(Source.World->ComputeCanonicalStateRoot(
+			SourceFinal, Error)));
+		ASSERT_THAT(IsTrue(Destination.World->ComputeCanonicalStateRoot(
+			DestinationFinal, Error)));
+		ASSERT_THAT(IsTrue(SourceFinal == DestinationFinal));
+		Source.World->StopSimulation();
+		Destination.World->StopSimulation();
+	}
+
 	TEST(StarterAttackAbilityFiresUntilTheTargetDies,
 		"SeinARTS.Sim.Combat.Attack")
 	{
@@ -409,10 +790,10 @@ namespace UE::SeinARTSTests
 					FFixedTransform(At(0)), Fixture.Attacker);
 				FSeinWeaponComponent Weapons;
 				// 10 damage every 1/10 s kills a 100 HP target in ~1 s.
-				FSeinWeaponSlot Slot = MakeWeapon(2000, 10);
-				Slot.CooldownSeconds =
+				FSeinWeaponProfile Profile = MakeProfile(2000, 10);
+				Profile.CooldownSeconds =
 					FFixedPoint::One / FFixedPoint::FromInt(10);
-				Weapons.Weapons.Add(Slot);
+				Weapons.Weapons.Add(Fixture.MakeWeapon(Profile));
 				Fixture.World->AddComponent(Shooter, Weapons);
 				Fixture.World->AddComponent(
 					Shooter, FSeinAbilityComponent());
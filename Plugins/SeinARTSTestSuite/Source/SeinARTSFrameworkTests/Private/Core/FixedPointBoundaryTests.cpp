@@ -193,6 +193,81 @@ namespace UE::SeinARTSTests
 			MinimumEndpoint, MaximumEndpoint, FFixedPoint::MaxValue)));
 	}
 
+	TEST(FixedPointSqrtIsExactFloor, "SeinARTS.Unit.Core")
+	{
+		const auto IsFloorRoot = [](int64 Raw, int64 Root)
+		{
+			// Root is exact when Root^2 <= Raw * 2^32 < (Root + 1)^2.
+			const uint64 TargetHigh = static_cast<uint64>(Raw) >> 32;
+			const uint64 TargetLow = static_cast<uint64>(Raw) << 32;
+			uint64 Low;
+			uint64 High = SeinMathInternal::MulHigh64(Root, Root, Low);
+			if (High > TargetHigh || (High == TargetHigh && Low > TargetLow))
+			{
+				return false;
+			}
+			High = SeinMathInternal::MulHigh64(Root + 1, Root + 1, Low);
+			return High > TargetHigh || (High == TargetHigh && Low > TargetLow);
+		};
+
+		ASSERT_THAT(IsTrue(SeinMath::Sqrt(FFixedPoint::Zero) == FFixedPoint::Zero));
+		ASSERT_THAT(IsTrue(SeinMath::Sqrt(FFixedPoint::One) == FFixedPoint::One));
+		ASSERT_THAT(IsTrue(SeinMath::Sqrt(FFixedPoint::FromInt(4)) == FFixedPoint::FromInt(2)));
+		ASSERT_THAT(IsTrue(SeinMath::Sqrt(FFixedPoint::Quarter) == FFixedPoint::Half));
+		ASSERT_THAT(IsTrue(SeinMath::Sqrt(FFixedPoint::FromInt(1800000000))
+			== SeinMath::Sqrt(FFixedVector(
+				FFixedPoint::FromInt(30000), FFixedPoint::FromInt(30000),
+				FFixedPoint::Zero).SizeSquared())));
+
+		// Every power of two and its neighbours (each seed bucket edge and
+		// normalization shift), then a deterministic spread of raw values.
+		TArray<FFixedPoint> Inputs;
+		for (int32 Bit = 0; Bit < 63; ++Bit)
+		{
+			for (int64 Offset = -2; Offset <= 2; ++Offset)
+			{
+				const int64 Raw = (1LL << Bit) + Offset;
+				if (Raw > 0) Inputs.Add(FFixedPoint(Raw));
+			}
+		}
+		Inputs.Add(FFixedPoint::MaxValue);
+		uint64 State = 0x9E3779B97F4A7C15ULL;
+		for (int32 Index = 0; Index < 4096; ++Index)
+		{
+			State = State * 6364136223846793005ULL + 1442695040888963407ULL;
+			Inputs.Add(FFixedPoint(static_cast<int64>(State >> (1 + Index % 63))));
+		}
+
+		for (const FFixedPoint& Input : Inputs)
+		{
+			if (Input <= FFixedPoint::Zero) continue;
+			ASSERT_THAT(IsTrue(IsFloorRoot(Input.Value, SeinMath::Sqrt(Input).Value)));
+		}
+
+		TArray<FFixedPoint> Roots;
+		Roots.SetNumUninitialized(Inputs.Num());
+		SeinMath::SqrtN(Inputs, Roots);
+		for (int32 Index = 0; Index < Inputs.Num(); ++Index)
+		{
+			ASSERT_THAT(IsTrue(Roots[Index] == SeinMath::Sqrt(Inputs[Index])));
+		}
+
+		const TArray<FFixedVector> Vectors = {
+			FFixedVector::ZeroVector,
+			FFixedVector(FFixedPoint::FromInt(3), FFixedPoint::FromInt(4), FFixedPoint::Zero),
+			FFixedVector(FFixedPoint::FromInt(50000), FFixedPoint::FromInt(5000), FFixedPoint::Zero),
+			FFixedVector(FFixedPoint::MaxValue, FFixedPoint::MaxValue, FFixedPoint::MaxValue),
+			FFixedVector(FFixedPoint(7), -FFixedPoint::Half, FFixedPoint::FromInt(-12))};
+		TArray<FFixedPoint> Lengths;
+		Lengths.SetNumUninitialized(Vectors.Num());
+		SeinMath::LengthN(Vectors, Lengths);
+		for (int32 Index = 0; Index < Vectors.Num(); ++Index)
+		{
+			ASSERT_THAT(IsTrue(Lengths[Index] == Vectors[Index].Size()));
+		}
+		ASSERT_THAT(IsTrue(Lengths[1] == FFixedPoint::FromInt(5)));
+	}
+
 	TEST(FixedPointNegativeRounding, "SeinARTS.Unit.Core")
 	{
 		const FFixedPoint MinusOneQuarter = -FFixedPoint::One - FFixedPoint::Quarter;
@@ -0,0 +1,123 @@
+#include "CQTest.h"
+#include "Components/ActorTestSpawner.h"
+
+#include "ConvexVolume.h"
+#include "Simulation/SeinActorBridgeSubsystem.h"
+#include "Simulation/SeinTestMatchBootstrap.h"
+#include "Simulation/SeinWorldSubsystem.h"
+#include "TestTypes/SeinPresentationIndexTestTypes.h"
+
+namespace UE::SeinARTSTests
+{
+	namespace ActorBridgePresentationIndexTestLocal
+	{
+		/** Axis-aligned box as an outward-facing FConvexVolume. */
+		FConvexVolume MakeBoxVolume(const FVector& Min, const FVector& Max)
+		{
+			FConvexVolume Volume;
+			Volume.Planes.Add(FPlane(FVector(1.0, 0.0, 0.0), Max.X));
+			Volume.Planes.Add(FPlane(FVector(-1.0, 0.0, 0.0), -Min.X));
+			Volume.Planes.Add(FPlane(FVector(0.0, 1.0, 0.0), Max.Y));
+			Volume.Planes.Add(FPlane(FVector(0.0, -1.0, 0.0), -Min.Y));
+			Volume.Planes.Add(FPlane(FVector(0.0, 0.0, 1.0), Max.Z));
+			Volume.Planes.Add(FPlane(FVector(0.0, 0.0, -1.0), -Min.Z));
+			Volume.Init();
+			return Volume;
+		}
+
+		FConvexVolume MakeVolumeAround(double X)
+		{
+			return MakeBoxVolume(
+				FVector(X - 100.0, -100.0, -100.0),
+				FVector(X + 100.0, 100.0, 100.0));
+		}
+
+		TArray<FSeinEntityHandle> QueryHandles(
+			const USeinActorBridgeSubsystem& Bridge,
+			const FConvexVolume& Volume)
+		{
+			TArray<int32> Rows;
+			Bridge.QueryPresentationVolume(Volume, false, Rows);
+			TArray<FSeinEntityHandle> Handles;
+			for (const int32 Row : Rows)
+			{
+				Handles.Add(Bridge.GetPresentationEntity(Row).Handle);
+			}
+			return Handles;
+		}
+	}
+
+	TEST(ActorBridgeIndexesActorsAsTheyRegisterAndUnregister,
+		"SeinARTS.Unit.CoreEntity.ActorBridge")
+	{
+		using namespace ActorBridgePresentationIndexTestLocal;
+		FActorTestSpawner Spawner;
+		UWorld& UnrealWorld = Spawner.GetWorld();
+		USeinWorldSubsystem* World =
+			UnrealWorld.GetSubsystem<USeinWorldSubsystem>();
+		USeinActorBridgeSubsystem* Bridge =
+			UnrealWorld.GetSubsystem<USeinActorBridgeSubsystem>();
+		ASSERT_THAT(IsNotNull(World));
+		ASSERT_THAT(IsNotNull(Bridge));
+
+		TArray<FSeinEntityHandle> Handles;
+		ASSERT_THAT(IsTrue(SeinTestMatchBootstrap::Materialize(*World, [&]()
+		{
+			for (int32 Index = 0; Index < 3; ++Index)
+			{
+				Handles.Add(World->SpawnAbstractEntity(
+					FFixedTransform(), FSeinPlayerID::Neutral()));
+			}
+		}, FSeinMatchSettings(), 0, TEXT("SeinARTS.ActorBridge.PresentationIndex"))));
+		ASSERT_THAT(AreEqual(3, Handles.Num()));
+
+		// No sim frame runs in this test, so every row below comes from
+		// registration alone.
+		TArray<ASeinPresentationIndexTestActor*> Actors;
+		for (int32 Index = 0; Index < Handles.Num(); ++Index)
+		{
+			ASeinPresentationIndexTestActor& Actor =
+				Spawner.SpawnActor<ASeinPresentationIndexTestActor>();
+			Actor.SetActorLocation(FVector(1000.0 * Index, 0.0, 0.0));
+			Bridge->RegisterActor(Handles[Index], &Actor);
+			Actors.Add(&Actor);
+		}
+
+		const FConvexVolume Everything = MakeBoxVolume(
+			FVector(-500.0, -500.0, -500.0),
+			FVector(2500.0, 500.0, 500.0));
+		ASSERT_THAT(AreEqual(3, QueryHandles(*Bridge, Everything).Num()));
+		const TArray<FSeinEntityHandle> Middle =
+			QueryHandles(*Bridge, MakeVolumeAround(1000.0));
+		ASSERT_THAT(AreEqual(1, Middle.Num()));
+		ASSERT_THAT(IsTrue(Middle[0] == Handles[1]));
+
+		// Removing the first row swaps the last one into its place.
+		Bridge->UnregisterActor(Handles[0]);
+		const TArray<FSeinEntityHandle> Remaining =
+			QueryHandles(*Bridge, Everything);
+		ASSERT_THAT(AreEqual(2, Remaining.Num()));
+		ASSERT_THAT(IsFalse(Remaining.Contains(Handles[0])));
+		ASSERT_THAT(IsTrue(QueryHandles(*Bridge, MakeVolumeAround(0.0)).IsEmpty()));
+		TArray<int32> Rows;
+		Bridge->QueryPresentationVolume(MakeVolumeAround(2000.0), false, Rows);
+		ASSERT_THAT(AreEqual(1, Rows.Num()));
+		const FSeinPresentationEntity& Last = Bridge->GetPresentationEntity(Rows[0]);
+		ASSERT_THAT(IsTrue(Last.Handle == Handles[2]));
+		ASSERT_THAT(IsTrue(Last.Actor.Get() == Actors[2]));
+
+		// Re-registering moves the row to the new actor instead of adding one.
+		ASeinPresentationIndexTestActor& Moved =
+			Spawner.SpawnActor<ASeinPresentationIndexTestActor>();
+		Moved.SetActorLocation(FVector(-2000.0, 0.0, 0.0));
+		Bridge->RegisterActor(Handles[1], &Moved);
+		ASSERT_THAT(AreEqual(2, QueryHandles(*Bridge, MakeBoxVolume(
+			FVector(-2500.0, -500.0, -500.0),
+			FVector(2500.0, 500.0, 500.0))).Num()));
+		ASSERT_THAT(IsTrue(QueryHandles(*Bridge, MakeVolumeAround(1000.0)).IsEmpty()));
+		const TArray<FSeinEntityHandle> Relocated =
+			QueryHandles(*Bridge, MakeVolumeAround(-2000.0));
+		ASSERT_THAT(AreEqual(1, Relocated.Num()));
+		ASSERT_THAT(IsTrue(Relocated[0] == Handles[1]));
+	}
+}
@@ -0,0 +1,119 @@
+#include "CQTest.h"
+
+#include "Serialization/SeinCanonicalDigestTree.h"
+#include "Serialization/SeinCanonicalInitialStateDigest.h"
+
+namespace UE::SeinARTSTests
+{
+	namespace CanonicalDigestTreeTestLocal
+	{
+		FGuid LeafDigest(uint64& State)
+		{
+			State = State * 6364136223846793005ULL + 1442695040888963407ULL;
+			const uint64 High = State;
+			State = State * 6364136223846793005ULL + 1442695040888963407ULL;
+			return FGuid(
+				static_cast<uint32>(High >> 32) | 1u,
+				static_cast<uint32>(High),
+				static_cast<uint32>(State >> 32),
+				static_cast<uint32>(State));
+		}
+
+		FGuid Parent(const TCHAR* Domain, int32 NodeIndex, const FGuid& Left, const FGuid& Right)
+		{
+			FString Error;
+			FGuid Digest;
+			FSeinCanonicalDigestWriter Writer(
+				TEXT("SeinARTS.LiveWorld.Merkle.Parent"), 1);
+			Writer.WriteString(Domain);
+			Writer.WriteInt32(NodeIndex);
+			Writer.WriteGuid(Left);
+			Writer.WriteGuid(Right);
+			Writer.Finalize(Digest, Error);
+			return Digest;
+		}
+	}
+
+	TEST(CanonicalDigestTreeParentsMatchTheCanonicalWriter,
+		"SeinARTS.Unit.CoreEntity.CanonicalDigestTree")
+	{
+		using namespace CanonicalDigestTreeTestLocal;
+		const TCHAR* Domain = TEXT("SeinARTS.Test.DigestTree");
+		uint64 State = 0x9E3779B97F4A7C15ULL;
+		const FGuid Leaves[3] = {
+			LeafDigest(State), LeafDigest(State), LeafDigest(State)};
+
+		FString Error;
+		FSeinCanonicalDigestTree Tree;
+		ASSERT_THAT(IsTrue(Tree.Reset(Domain, 3, Error)));
+		for (int32 Index = 0; Index < 3; ++Index)
+		{
+			ASSERT_THAT(IsTrue(Tree.SetLeafDigest(Index, Leaves[Index], Error)));
+		}
+		ASSERT_THAT(IsTrue(Tree.FinalizeUpdates(Error)));
+
+		FGuid Empty;
+		FSeinCanonicalDigestWriter EmptyWriter(
+			TEXT("SeinARTS.LiveWorld.Merkle.Empty"), 1);
+		EmptyWriter.WriteString(Domain);
+		ASSERT_THAT(IsTrue(EmptyWriter.Finalize(Empty, Error)));
+
+		// Four leaf slots: nodes 4..7 are leaves, 2 and 3 their parents.
+		const FGuid Node2 = Parent(Domain, 2, Leaves[0], Leaves[1]);
+		const FGuid Node3 = Parent(Domain, 3, Leaves[2], Empty);
+		const FGuid Node1 = Parent(Domain, 1, Node2, Node3);
+		FGuid ExpectedRoot;
+		FSeinCanonicalDigestWriter RootWriter(
+			TEXT("SeinARTS.LiveWorld.Merkle.Root"), 1);
+		RootWriter.WriteString(Domain);
+		RootWriter.WriteInt32(3);
+		RootWriter.WriteInt32(4);
+		RootWriter.WriteGuid(Node1);
+		ASSERT_THAT(IsTrue(RootWriter.Finalize(ExpectedRoot, Error)));
+		ASSERT_THAT(IsTrue(ExpectedRoot == Tree.GetRoot()));
+	}
+
+	TEST(CanonicalDigestTreeParallelFinalizeMatchesSerialAndRebuild,
+		"SeinARTS.Unit.CoreEntity.CanonicalDigestTree")
+	{
+		using namespace CanonicalDigestTreeTestLocal;
+		// Large enough that dense levels span many batches and go parallel.
+		constexpr int32 LeafCount = 20000;
+		const TCHAR* Domain = TEXT("SeinARTS.Test.DigestTree");
+		FString Error;
+		FSeinCanonicalDigestTree Parallel;
+		FSeinCanonicalDigestTree Serial;
+		ASSERT_THAT(IsTrue(Parallel.Reset(Domain, LeafCount, Error)));
+		ASSERT_THAT(IsTrue(Serial.Reset(Domain, LeafCount, Error)));
+		ASSERT_THAT(IsTrue(Parallel.GetRoot() == Serial.GetRoot()));
+
+		TArray<FGuid> Leaves;
+		Leaves.SetNum(LeafCount);
+		uint64 State = 0xD1B54A32D192ED03ULL;
+		// Dense, sparse, then clearing: every pass must agree three ways.
+		const int32 Strides[] = {1, 97, 3};
+		for (int32 Pass = 0; Pass < UE_ARRAY_COUNT(Strides); ++Pass)
+		{
+			for (int32 Index = Pass; Index < LeafCount; Index += Strides[Pass])
+			{
+				Leaves[Index] = Pass == 2 ? FGuid() : LeafDigest(State);
+				ASSERT_THAT(IsTrue(Parallel.SetLeafDigest(Index, Leaves[Index], Error)));
+				ASSERT_THAT(IsTrue(Serial.SetLeafDigest(Index, Leaves[Index], Error)));
+			}
+			ASSERT_THAT(IsTrue(Parallel.FinalizeUpdates(Error)));
+			ASSERT_THAT(IsTrue(Serial.FinalizeUpdates(Error, true)));
+
+			FSeinCanonicalDigestTree Rebuilt;
+			ASSERT_THAT(IsTrue(Rebuilt.Reset(Domain, LeafCount, Error)));
+			for (int32 Index = LeafCount - 1; Index >= 0; --Index)
+			{
+				ASSERT_THAT(IsTrue(Rebuilt.SetLeafDigest(Index, Leaves[Index], Error)));
+			}
+			ASSERT_THAT(IsTrue(Rebuilt.FinalizeUpdates(Error, true)));
+
+			ASSERT_THAT(IsTrue(Parallel.GetRoot() == Serial.GetRoot()));
+			ASSERT_THAT(IsTrue(Parallel.GetRoot() == Rebuilt.GetRoot()));
+			ASSERT_THAT(IsFalse(Parallel.HasPendingUpdates()));
+		}
+	}
+}
@@ -939,6 +939,106 @@ namespace UE::SeinARTSTests
 		ASSERT_THAT(IsTrue(Error.Contains(TEXT("embedded null"))));
 	}
 
+	TEST(OpaqueCommandWireEncodesEntityListsAsCompactDeltas,
+		"SeinARTS.Unit.CoreEntity.CommandSchema.Security")
+	{
+		FSeinCommandSchemaDescriptor Schema = MakeSchema(
+			TEXT("SeinFrameworkTest.CommandWire.EntityList"),
+			SeinARTSTags::Command_Type_Ping, 9907);
+		Schema.MaxEntityListEntries = 128;
+		auto FindSchema = [&Schema](
+			FGameplayTag Type, int32 Version,
+			FSeinCommandSchemaDescriptor& Out)
+		{
+			if (Type != Schema.CommandType || Version != Schema.SchemaVersion)
+				return false;
+			Out = Schema;
+			return true;
+		};
+		FSeinCommand Empty;
+		Empty.CommandType = Schema.CommandType;
+		Empty.SchemaVersion = Schema.SchemaVersion;
+		TArray<uint8> EmptyBytes;
+		FString Error;
+		ASSERT_THAT(IsTrue(FSeinCommandWireCodec::Encode(
+			Empty, Schema, EmptyBytes, Error)));
+
+		// A contiguous box selection costs two bytes per handle.
+		FSeinCommand Ascending = Empty;
+		for (int32 Index = 1; Index <= 100; ++Index)
+		{
+			Ascending.EntityList.Add(FSeinEntityHandle(Index, 1));
+		}
+		TArray<uint8> AscendingBytes;
+		FSeinWireCost AscendingCost;
+		ASSERT_THAT(IsTrue(FSeinCommandWireCodec::EncodeWithCost(
+			Ascending, Schema, AscendingBytes, Error, AscendingCost)));
+		ASSERT_THAT(AreEqual(EmptyBytes.Num() + 200, AscendingBytes.Num()));
+		ASSERT_THAT(AreEqual(
+			static_cast<uint64>(AscendingBytes.Num())
+				+ 100u * FSeinWireCost::CanonicalBytesPerLogicalElement,
+			AscendingCost.CanonicalCostBytes));
+
+		FSeinCommand Decoded;
+		FSeinWireCost DecodedCost;
+		ASSERT_THAT(IsTrue(FSeinCommandWireCodec::DecodeWithCost(
+			AscendingBytes, FindSchema, Decoded, Error,
+			FSeinCommandWireCodec::MaxDecodedCommandAllocationBytes,
+			DecodedCost)));
+		ASSERT_THAT(IsTrue(Decoded.EntityList == Ascending.EntityList));
+		ASSERT_THAT(AreEqual(
+			AscendingCost.CanonicalCostBytes, DecodedCost.CanonicalCostBytes));
+
+		// Positional order survives, including large backward jumps.
+		FSeinCommand Ordered = Empty;
+		Ordered.EntityList = {
+			FSeinEntityHandle(MAX_int32, MAX_int32),
+			FSeinEntityHandle(5, 2),
+			FSeinEntityHandle(5, 3),
+			FSeinEntityHandle(0, 0),
+			FSeinEntityHandle(70000, 1) };
+		Ordered.ActiveFocusIndex = 2;
+		TArray<uint8> OrderedBytes;
+		ASSERT_THAT(IsTrue(FSeinCommandWireCodec::Encode(
+			Ordered, Schema, OrderedBytes, Error)));
+		Decoded = {};
+		ASSERT_THAT(IsTrue(FSeinCommandWireCodec::Decode(
+			OrderedBytes, FindSchema, Decoded, Error)));
+		ASSERT_THAT(IsTrue(Decoded.EntityList == Ordered.EntityList));
+		ASSERT_THAT(AreEqual(2, Decoded.ActiveFocusIndex));
+
+		// The list is count(4), mode(1), then entries; the trailing focus
+		// index(4), payload flag(1) and payload length(4) follow it.
+		FSeinCommand Pair = Empty;
+		Pair.EntityList = { FSeinEntityHandle(3, 1), FSeinEntityHandle(4, 1) };
+		TArray<uint8> PairBytes;
+		ASSERT_THAT(IsTrue(FSeinCommandWireCodec::Encode(
+			Pair, Schema, PairBytes, Error)));
+		const int32 ModeOffset = PairBytes.Num() - 9 - 4 - 1;
+		ASSERT_THAT(AreEqual(static_cast<uint8>(0), PairBytes[ModeOffset]));
+		ASSERT_THAT(AreEqual(static_cast<uint8>(3), PairBytes[ModeOffset + 1]));
+
+		// The ordered form of an ascending list is a second byte form.
+		TArray<uint8> Reordered = PairBytes;
+		Reordered[ModeOffset] = 1;
+		Reordered[ModeOffset + 1] = 6;
+		Reordered[ModeOffset + 3] = 2;
+		Decoded = {};
+		Decoded.Tick = 777;
+		ASSERT_THAT(IsFalse(FSeinCommandWireCodec::Decode(
+			Reordered, FindSchema, Decoded, Error)));
+		ASSERT_THAT(AreEqual(777, Decoded.Tick));
+
+		// Overlong varints are rejected.
+		TArray<uint8> Overlong = PairBytes;
+		Overlong[ModeOffset + 1] = 0x83;
+		Overlong.Insert(0x00, ModeOffset + 2);
+		Decoded = {};
+		ASSERT_THAT(IsFalse(FSeinCommandWireCodec::Decode(
+			Overlong, FindSchema, Decoded, Error)));
+		ASSERT_THAT(IsTrue(Error.Contains(TEXT("non-canonical wire varint"))));
+	}
+
 	TEST(OpaqueCommandWireRejectsVersionTwoTransactionally,
 		"SeinARTS.Unit.CoreEntity.CommandSchema.Security")
 	{
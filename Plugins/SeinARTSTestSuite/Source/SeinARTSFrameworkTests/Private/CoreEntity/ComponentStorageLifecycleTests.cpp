@@ -245,4 +245,51 @@ namespace UE::SeinARTSTests
 			Storage.GetLatestMutationRevision()
 				> ComponentRevisionBefore));
 	}
+
+	TEST(ComponentStorageMutationJournalReportsTouchedSlotsOnce,
+		"SeinARTS.Unit.Entity")
+	{
+		FSeinGenericComponentStorage Storage(
+			FSeinComponentStorageLifecycleProbe::StaticStruct(), 4);
+		TArray<int32> Slots;
+		TArray<bool> Live;
+		const auto Record = [&Slots, &Live](
+			int32 SlotIndex,
+			FSeinEntityHandle Handle,
+			const void* RawComponent)
+		{
+			Slots.Add(SlotIndex);
+			Live.Add(Handle.IsValid() && RawComponent != nullptr);
+		};
+
+		// The first drain only arms the journal.
+		ASSERT_THAT(IsFalse(Storage.DrainMutationJournal(Record)));
+		ASSERT_THAT(AreEqual(0, Slots.Num()));
+
+		Storage.AddComponent(FSeinEntityHandle(3, 1), nullptr);
+		Storage.AddComponent(FSeinEntityHandle(1, 1), nullptr);
+		Storage.GetComponentRaw(FSeinEntityHandle(3, 1));
+		ASSERT_THAT(IsTrue(Storage.DrainMutationJournal(Record)));
+		ASSERT_THAT(IsTrue(Slots == TArray<int32>({1, 3})));
+		ASSERT_THAT(IsTrue(Live == TArray<bool>({true, true})));
+
+		// Const reads are not mutations.
+		Slots.Reset();
+		Live.Reset();
+		static_cast<const FSeinGenericComponentStorage&>(Storage)
+			.GetComponentRaw(FSeinEntityHandle(1, 1));
+		ASSERT_THAT(IsTrue(Storage.DrainMutationJournal(Record)));
+		ASSERT_THAT(AreEqual(0, Slots.Num()));
+
+		Storage.RemoveComponent(FSeinEntityHandle(1, 1));
+		Storage.AddComponent(FSeinEntityHandle(9, 2), nullptr);
+		ASSERT_THAT(IsTrue(Storage.DrainMutationJournal(Record)));
+		ASSERT_THAT(IsTrue(Slots == TArray<int32>({1, 9})));
+		ASSERT_THAT(IsTrue(Live == TArray<bool>({false, true})));
+
+		// Clear touches nothing, so the consumer is told to rebuild.
+		Storage.Clear();
+		ASSERT_THAT(IsFalse(Storage.DrainMutationJournal(Record)));
+		ASSERT_THAT(IsTrue(Storage.DrainMutationJournal(Record)));
+	}
 }
@@ -0,0 +1,120 @@
+#include "CQTest.h"
+#include "Components/ActorTestSpawner.h"
+
+#include "Components/SeinAbilityComponent.h"
+#include "Simulation/SeinTestMatchBootstrap.h"
+#include "Simulation/SeinWorldSubsystem.h"
+#include "Tags/SeinARTSGameplayTags.h"
+
+namespace UE::SeinARTSTests
+{
+	TEST(EntityPresentationRevisionsMoveOnlyForTheMutatedEntity,
+		"SeinARTS.Unit.CoreEntity.PresentationRevisions")
+	{
+		FActorTestSpawner Spawner;
+		USeinWorldSubsystem* World =
+			Spawner.GetWorld().GetSubsystem<USeinWorldSubsystem>();
+		ASSERT_THAT(IsNotNull(World));
+
+		const FSeinPlayerID PlayerA(1);
+		const FSeinPlayerID PlayerB(2);
+		const FGameplayTag Tag = SeinARTSTags::Environment_Default.GetTag();
+		TArray<uint64> A0, B0, AQuiet, AAfterTag, BAfterTag;
+		TArray<uint64> AAfterComponent, BAfterLookup, AAfterPlayer, BAfterPlayer;
+		ASSERT_THAT(IsTrue(SeinTestMatchBootstrap::Materialize(*World, [&]()
+		{
+			World->RegisterPlayer(PlayerA, FSeinFactionID(1));
+			World->RegisterPlayer(PlayerB, FSeinFactionID(1));
+			const FSeinEntityHandle A =
+				World->SpawnAbstractEntity(FFixedTransform(), PlayerA);
+			const FSeinEntityHandle B =
+				World->SpawnAbstractEntity(FFixedTransform(), PlayerB);
+
+			World->GatherEntityPresentationRevisions(A, A0);
+			World->GatherEntityPresentationRevisions(B, B0);
+			World->GatherEntityPresentationRevisions(A, AQuiet);
+
+			World->GrantTag(A, Tag);
+			World->GatherEntityPresentationRevisions(A, AAfterTag);
+			World->GatherEntityPresentationRevisions(B, BAfterTag);
+
+			World->AddComponent(A, FSeinAbilityComponent());
+			World->GatherEntityPresentationRevisions(A, AAfterComponent);
+
+			// A mutable lookup alone is not a write.
+			World->GetPlayerStateMutable(PlayerB);
+			World->GatherEntityPresentationRevisions(B, BAfterLookup);
+
+			World->GrantPlayerTag(PlayerB, Tag);
+			World->GatherEntityPresentationRevisions(A, AAfterPlayer);
+			World->GatherEntityPresentationRevisions(B, BAfterPlayer);
+		}, FSeinMatchSettings(), 0, TEXT("SeinARTS.PresentationRevisions"))));
+
+		ASSERT_THAT(IsTrue(A0 == AQuiet));
+		ASSERT_THAT(IsFalse(A0 == AAfterTag));
+		ASSERT_THAT(IsTrue(B0 == BAfterTag));
+		ASSERT_THAT(IsFalse(AAfterTag == AAfterComponent));
+		ASSERT_THAT(IsTrue(BAfterTag == BAfterLookup));
+		ASSERT_THAT(IsTrue(AAfterComponent == AAfterPlayer));
+		ASSERT_THAT(IsFalse(BAfterTag == BAfterPlayer));
+	}
+
+	TEST(EntityPresentationRevisionsFollowPairCapabilityEdges,
+		"SeinARTS.Unit.CoreEntity.PresentationRevisions")
+	{
+		FActorTestSpawner Spawner;
+		USeinWorldSubsystem* World =
+			Spawner.GetWorld().GetSubsystem<USeinWorldSubsystem>();
+		ASSERT_THAT(IsNotNull(World));
+
+		const FSeinPlayerID PlayerA(1);
+		const FSeinPlayerID PlayerB(2);
+		const FSeinPlayerID PlayerC(3);
+		const FGameplayTag ShareVision =
+			SeinARTSTags::Relationship_Capability_ShareVision;
+		const FGameplayTag SourceKind =
+			SeinARTSTags::Relationship_Source_TeamBootstrap;
+		TArray<uint64> A0, B0, C0, AGranted, BGranted, CGranted;
+		TArray<uint64> ASecondSource, AFirstRevoked, ALastRevoked;
+		ASSERT_THAT(IsTrue(SeinTestMatchBootstrap::Materialize(*World, [&]()
+		{
+			World->RegisterPlayer(PlayerA, FSeinFactionID(1));
+			World->RegisterPlayer(PlayerB, FSeinFactionID(1));
+			World->RegisterPlayer(PlayerC, FSeinFactionID(1));
+			const FSeinEntityHandle A =
+				World->SpawnAbstractEntity(FFixedTransform(), PlayerA);
+			const FSeinEntityHandle B =
+				World->SpawnAbstractEntity(FFixedTransform(), PlayerB);
+			const FSeinEntityHandle C =
+				World->SpawnAbstractEntity(FFixedTransform(), PlayerC);
+
+			World->GatherEntityPresentationRevisions(A, A0);
+			World->GatherEntityPresentationRevisions(B, B0);
+			World->GatherEntityPresentationRevisions(C, C0);
+
+			World->GrantPairCapability(
+				PlayerA, PlayerB, ShareVision, SourceKind, 101);
+			World->GatherEntityPresentationRevisions(A, AGranted);
+			World->GatherEntityPresentationRevisions(B, BGranted);
+			World->GatherEntityPresentationRevisions(C, CGranted);
+
+			// Only the effective edge is presented, not its source count.
+			World->GrantPairCapability(
+				PlayerA, PlayerB, ShareVision, SourceKind, 202);
+			World->GatherEntityPresentationRevisions(A, ASecondSource);
+			World->RevokePairCapability(
+				PlayerA, PlayerB, ShareVision, SourceKind, 101);
+			World->GatherEntityPresentationRevisions(A, AFirstRevoked);
+			World->RevokePairCapability(
+				PlayerA, PlayerB, ShareVision, SourceKind, 202);
+			World->GatherEntityPresentationRevisions(A, ALastRevoked);
+		}, FSeinMatchSettings(), 0, TEXT("SeinARTS.PresentationRevisions.Pairs"))));
+
+		ASSERT_THAT(IsFalse(A0 == AGranted));
+		ASSERT_THAT(IsFalse(B0 == BGranted));
+		ASSERT_THAT(IsTrue(C0 == CGranted));
+		ASSERT_THAT(IsTrue(AGranted == ASecondSource));
+		ASSERT_THAT(IsTrue(ASecondSource == AFirstRevoked));
+		ASSERT_THAT(IsFalse(AFirstRevoked == ALastRevoked));
+	}
+}
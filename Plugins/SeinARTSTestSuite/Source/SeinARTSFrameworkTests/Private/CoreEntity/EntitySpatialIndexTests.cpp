@@ -0,0 +1,169 @@
+#include "CQTest.h"
+
+#include "Core/SeinEntityPool.h"
+#include "Core/SeinEntitySpatialIndex.h"
+
+namespace UE::SeinARTSTests
+{
+	namespace EntitySpatialIndexTestsPrivate
+	{
+		FFixedVector MakeLocation(int32 X, int32 Y)
+		{
+			return FFixedVector(
+				FFixedPoint::FromInt(X),
+				FFixedPoint::FromInt(Y),
+				FFixedPoint::Zero);
+		}
+
+		/** Exact planar sweep in canonical slot order — the reference the
+		 *  index-backed queries must reproduce after filtering. */
+		TArray<FSeinEntityHandle> SweepRadius(
+			const FSeinEntityPool& Pool,
+			const FFixedVector& Center,
+			FFixedPoint Radius)
+		{
+			TArray<FSeinEntityHandle> Out;
+			Pool.ForEachEntity([&](FSeinEntityHandle Handle, const FSeinEntity& Entity)
+			{
+				if (FFixedVector::IsPlanarDistanceWithin(
+						Entity.Transform.GetLocation(), Center, Radius))
+				{
+					Out.Add(Handle);
+				}
+			});
+			return Out;
+		}
+
+		TArray<FSeinEntityHandle> FilterRadius(
+			const FSeinEntityPool& Pool,
+			const TArray<FSeinEntityHandle>& Candidates,
+			const FFixedVector& Center,
+			FFixedPoint Radius)
+		{
+			TArray<FSeinEntityHandle> Out;
+			for (const FSeinEntityHandle Handle : Candidates)
+			{
+				const FSeinEntity* Entity = Pool.Get(Handle);
+				if (Entity && FFixedVector::IsPlanarDistanceWithin(
+						Entity->Transform.GetLocation(), Center, Radius))
+				{
+					Out.Add(Handle);
+				}
+			}
+			return Out;
+		}
+	}
+
+	TEST(EntitySpatialIndexRadiusMatchesSweepAcrossMutations,
+		"SeinARTS.Unit.CoreEntity.SpatialIndex")
+	{
+		using namespace EntitySpatialIndexTestsPrivate;
+
+		FSeinEntityPool Pool;
+		Pool.Initialize(8);
+		TArray<FSeinEntityHandle> Handles;
+		uint32 Seed = 0x5EA1u;
+		auto Next = [&Seed](int32 Span)
+		{
+			Seed = Seed * 1664525u + 1013904223u;
+			return static_cast<int32>((Seed >> 8) % static_cast<uint32>(Span)) - Span / 2;
+		};
+		for (int32 Index = 0; Index < 64; ++Index)
+		{
+			Handles.Add(Pool.Acquire(
+				FFixedTransform(MakeLocation(Next(6000), Next(6000))),
+				FSeinPlayerID::Neutral()));
+		}
+
+		FSeinEntitySpatialIndex SpatialIndex;
+		SpatialIndex.EnsureSyncedWith(Pool);
+		ASSERT_THAT(AreEqual(64, SpatialIndex.NumIndexedEntities()));
+
+		auto ExpectMatches = [&]()
+		{
+			for (int32 Query = 0; Query < 16; ++Query)
+			{
+				const FFixedVector Center = MakeLocation(Next(6000), Next(6000));
+				const FFixedPoint Radius = FFixedPoint::FromInt(100 + (Next(4000) + 2000));
+				TArray<FSeinEntityHandle> Candidates;
+				SpatialIndex.GatherCandidatesInRadius(Center, Radius, Candidates);
+				for (int32 Candidate = 1; Candidate < Candidates.Num(); ++Candidate)
+				{
+					ASSERT_THAT(IsTrue(Candidates[Candidate - 1].Index < Candidates[Candidate].Index));
+				}
+				const TArray<FSeinEntityHandle> Expected = SweepRadius(Pool, Center, Radius);
+				const TArray<FSeinEntityHandle> Actual = FilterRadius(Pool, Candidates, Center, Radius);
+				ASSERT_THAT(AreEqual(Expected.Num(), Actual.Num()));
+				for (int32 Hit = 0; Hit < Expected.Num(); ++Hit)
+				{
+					ASSERT_THAT(IsTrue(Expected[Hit] == Actual[Hit]));
+				}
+			}
+		};
+		ExpectMatches();
+
+		// Move a handful, destroy a few, spawn into a recycled slot.
+		for (int32 Index = 0; Index < 6; ++Index)
+		{
+			Pool.Get(Handles[Index * 7])->Transform.SetLocation(
+				MakeLocation(Next(6000), Next(6000)));
+		}
+		Pool.Release(Handles[3]);
+		Pool.Release(Handles[40]);
+		Pool.Acquire(FFixedTransform(MakeLocation(Next(6000), Next(6000))), FSeinPlayerID::Neutral());
+		ASSERT_THAT(IsFalse(SpatialIndex.IsSyncedWith(Pool)));
+		SpatialIndex.EnsureSyncedWith(Pool);
+		// Six moves plus two releases; the spawn reuses the last released slot.
+		ASSERT_THAT(AreEqual(8, SpatialIndex.GetLastSyncRebinCount()));
+		ASSERT_THAT(AreEqual(Pool.GetActiveCount(), SpatialIndex.NumIndexedEntities()));
+		ExpectMatches();
+
+		// A quiescent pool costs nothing to re-check.
+		ASSERT_THAT(IsTrue(SpatialIndex.IsSyncedWith(Pool)));
+	}
+
+	TEST(EntitySpatialIndexBoxAndNegativeCoordinatesUseFloorCells,
+		"SeinARTS.Unit.CoreEntity.SpatialIndex")
+	{
+		using namespace EntitySpatialIndexTestsPrivate;
+
+		FSeinEntityPool Pool;
+		Pool.Initialize(4);
+		const FSeinEntityHandle West = Pool.Acquire(
+			FFixedTransform(MakeLocation(-1, 0)), FSeinPlayerID::Neutral());
+		const FSeinEntityHandle East = Pool.Acquire(
+			FFixedTransform(MakeLocation(1, 0)), FSeinPlayerID::Neutral());
+		const FSeinEntityHandle Far = Pool.Acquire(
+			FFixedTransform(MakeLocation(-50000, 50000)), FSeinPlayerID::Neutral());
+
+		FSeinEntitySpatialIndex SpatialIndex;
+		SpatialIndex.EnsureSyncedWith(Pool);
+		ASSERT_THAT(AreEqual(3, SpatialIndex.NumOccupiedCells()));
+
+		TArray<FSeinEntityHandle> Candidates;
+		SpatialIndex.GatherCandidatesInBox(
+			MakeLocation(-10, -10), MakeLocation(-1, 10), Candidates);
+		ASSERT_THAT(AreEqual(1, Candidates.Num()));
+		ASSERT_THAT(IsTrue(Candidates[0] == West));
+
+		Candidates.Reset();
+		SpatialIndex.GatherCandidatesInBox(
+			MakeLocation(10, 10), MakeLocation(-10, -10), Candidates);
+		ASSERT_THAT(AreEqual(0, Candidates.Num()));
+
+		Candidates.Reset();
+		SpatialIndex.GatherCandidatesInRadius(
+			FFixedVector::ZeroVector, FFixedPoint::FromInt(-100000), Candidates);
+		ASSERT_THAT(AreEqual(3, Candidates.Num()));
+		ASSERT_THAT(IsTrue(Candidates[0] == West));
+		ASSERT_THAT(IsTrue(Candidates[1] == East));
+		ASSERT_THAT(IsTrue(Candidates[2] == Far));
+
+		// A replaced pool carries a new revision epoch and forces a full re-bin.
+		FSeinEntityPool Replacement;
+		Replacement.Initialize(4);
+		ASSERT_THAT(IsFalse(SpatialIndex.IsSyncedWith(Replacement)));
+		SpatialIndex.EnsureSyncedWith(Replacement);
+		ASSERT_THAT(AreEqual(0, SpatialIndex.NumIndexedEntities()));
+	}
+}
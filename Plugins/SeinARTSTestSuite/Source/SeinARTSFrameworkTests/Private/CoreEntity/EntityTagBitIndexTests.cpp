@@ -0,0 +1,75 @@
+#include "CQTest.h"
+
+#include "Core/SeinEntityTagBitIndex.h"
+#include "Tags/SeinARTSGameplayTags.h"
+
+namespace UE::SeinARTSTests
+{
+	namespace EntityTagBitIndexTestsPrivate
+	{
+		FGameplayTagContainer MakeTags(std::initializer_list<FGameplayTag> Tags)
+		{
+			FGameplayTagContainer Container;
+			for (const FGameplayTag& Tag : Tags)
+			{
+				Container.AddTag(Tag);
+			}
+			return Container;
+		}
+	}
+
+	TEST(EntityTagBitIndexMatchesContainerSemantics,
+		"SeinARTS.Unit.CoreEntity.TagBitIndex")
+	{
+		using namespace EntityTagBitIndexTestsPrivate;
+
+		const FGameplayTag Enemy = SeinARTSTags::Command_Context_Target_Enemy;
+		const FGameplayTag Friendly = SeinARTSTags::Command_Context_Target_Friendly;
+		const FGameplayTag Context = SeinARTSTags::Command_Context;
+		const FGameplayTag Building = SeinARTSTags::State_UnderConstruction;
+		const FGameplayTag State = SeinARTSTags::State;
+
+		const FSeinEntityHandle A(1, 1);
+		const FSeinEntityHandle B(2, 1);
+		const FSeinEntityHandle StaleA(1, 0);
+		const FGameplayTagContainer TagsA = MakeTags({Enemy});
+		const FGameplayTagContainer TagsB = MakeTags({Friendly, Building});
+
+		FSeinEntityTagBitIndex Index;
+		Index.SetEntityTags(A, TagsA);
+		Index.SetEntityTags(B, TagsB);
+
+		// Every probe set must answer exactly as the entity's CombinedTags.
+		const TArray<FGameplayTagContainer> Probes = {
+			MakeTags({Enemy}),
+			MakeTags({Context}),
+			MakeTags({State}),
+			MakeTags({Enemy, Building}),
+			MakeTags({Context, State}),
+			MakeTags({Friendly, Context}),
+		};
+		for (const FGameplayTagContainer& Probe : Probes)
+		{
+			const FSeinTagBitMask Mask = Index.Compile(Probe);
+			ASSERT_THAT(AreEqual(TagsA.HasAll(Probe), Index.MatchesAll(A, Mask)));
+			ASSERT_THAT(AreEqual(TagsA.HasAny(Probe), Index.MatchesAny(A, Mask)));
+			ASSERT_THAT(AreEqual(TagsB.HasAll(Probe), Index.MatchesAll(B, Mask)));
+			ASSERT_THAT(AreEqual(TagsB.HasAny(Probe), Index.MatchesAny(B, Mask)));
+			// A recycled slot's old handle never reads the new occupant's row.
+			ASSERT_THAT(IsFalse(Index.MatchesAny(StaleA, Mask)));
+		}
+
+		// Empty sets: all-of is vacuous, any-of never matches.
+		const FSeinTagBitMask Empty = Index.Compile(FGameplayTagContainer());
+		ASSERT_THAT(IsTrue(Index.MatchesAll(A, Empty)));
+		ASSERT_THAT(IsFalse(Index.MatchesAny(A, Empty)));
+
+		// Losing the last child clears the parent; clearing drops the row.
+		Index.SetEntityTags(B, MakeTags({Friendly}));
+		ASSERT_THAT(IsFalse(Index.MatchesAll(B, Index.Compile(State))));
+		ASSERT_THAT(IsTrue(Index.MatchesAll(B, Index.Compile(Context))));
+		Index.ClearEntity(B);
+		ASSERT_THAT(IsFalse(Index.MatchesAny(B, Index.Compile(Context))));
+		ASSERT_THAT(IsTrue(Index.MatchesAll(A, Index.Compile(Context))));
+	}
+}
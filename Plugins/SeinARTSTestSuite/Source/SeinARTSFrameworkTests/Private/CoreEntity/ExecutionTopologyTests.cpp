@@ -1,6 +1,8 @@
 #include "CQTest.h"
 #include "Components/ActorTestSpawner.h"
 
+#include "Components/SeinAbilityComponent.h"
+#include "Components/SeinLifespanData.h"
 #include "Containers/Ticker.h"
 #include "Core/SeinTickPhase.h"
 #include "Data/SeinWorldSnapshot.h"
@@ -939,4 +941,81 @@ namespace UE::SeinARTSTests
 		ASSERT_THAT(IsFalse(World->IsExecutionTopologyValid()));
 		ASSERT_THAT(IsFalse(World->IsSimulationRunning()));
 	}
+	TEST(DeclaredAccessCompilesConflictOrderedWaves,
+		"SeinARTS.Unit.CoreEntity.ExecutionTopology")
+	{
+		const auto Declared = [](const TCHAR* StableID, int32 Priority)
+		{
+			return FSeinSystemDescriptor::Stateless(
+				FName(StableID), 1u, ESeinTickPhase::PostTick, Priority);
+		};
+		FTopologyTestSystem Writer(
+			Declared(TEXT("seinarts.tests.wave.writer"), 70)
+				.WithAccess(FSeinSystemAccess::Declared()
+					.WritesComponent(FSeinLifespanData::StaticStruct())));
+		FTopologyTestSystem Disjoint(
+			Declared(TEXT("seinarts.tests.wave.disjoint"), 71)
+				.WithAccess(FSeinSystemAccess::Declared()
+					.ReadsComponent(FSeinAbilityComponent::StaticStruct())
+					.WritesShared(ESeinSystemSharedState::AbilityPool)));
+		FTopologyTestSystem Reader(
+			Declared(TEXT("seinarts.tests.wave.reader"), 72)
+				.WithAccess(FSeinSystemAccess::Declared()
+					.ReadsComponent(FSeinLifespanData::StaticStruct())));
+		FTopologyTestSystem Barrier(
+			Declared(TEXT("seinarts.tests.wave.barrier"), 73));
+		FTopologyTestSystem AfterBarrier(
+			Declared(TEXT("seinarts.tests.wave.after_barrier"), 74)
+				.WithAccess(FSeinSystemAccess::Declared()
+					.ReadsComponent(FSeinAbilityComponent::StaticStruct())));
+		FActorTestSpawner Spawner;
+		USeinWorldSubsystem* World =
+			Spawner.GetWorld().GetSubsystem<USeinWorldSubsystem>();
+		ASSERT_THAT(IsNotNull(World));
+		for (FTopologyTestSystem* System :
+			{&AfterBarrier, &Barrier, &Reader, &Disjoint, &Writer})
+		{
+			ASSERT_THAT(IsTrue(World->RegisterSystem(System)));
+		}
+		ASSERT_THAT(AreEqual(INDEX_NONE, World->GetExecutionScheduleWave(
+			TEXT("seinarts.tests.wave.writer"))));
+		ASSERT_THAT(IsTrue(SeinTestMatchBootstrap::Materialize(
+			*World, FSeinMatchSettings(), 0,
+			TEXT("ExecutionTopologyDeclaredWaves"))));
+
+		const int32 WriterWave = World->GetExecutionScheduleWave(
+			TEXT("seinarts.tests.wave.writer"));
+		ASSERT_THAT(IsTrue(WriterWave != INDEX_NONE));
+		ASSERT_THAT(AreEqual(WriterWave, World->GetExecutionScheduleWave(
+			TEXT("seinarts.tests.wave.disjoint"))));
+		ASSERT_THAT(AreEqual(WriterWave + 1, World->GetExecutionScheduleWave(
+			TEXT("seinarts.tests.wave.reader"))));
+		ASSERT_THAT(AreEqual(WriterWave + 2, World->GetExecutionScheduleWave(
+			TEXT("seinarts.tests.wave.barrier"))));
+		ASSERT_THAT(AreEqual(WriterWave + 3, World->GetExecutionScheduleWave(
+			TEXT("seinarts.tests.wave.after_barrier"))));
+	}
+
+	TEST(UndeclaredAccessListsPoisonPendingTopology,
+		"SeinARTS.Unit.CoreEntity.ExecutionTopology")
+	{
+		FSeinSystemDescriptor Descriptor = FSeinSystemDescriptor::Stateless(
+			FName(TEXT("seinarts.tests.undeclared_access")),
+			1u,
+			ESeinTickPhase::PreTick,
+			42);
+		Descriptor.Access.ReadsComponent(
+			FSeinLifespanData::StaticStruct());
+		FTopologyTestSystem Undeclared(MoveTemp(Descriptor));
+		FActorTestSpawner Spawner;
+		USeinWorldSubsystem* World =
+			Spawner.GetWorld().GetSubsystem<USeinWorldSubsystem>();
+		ASSERT_THAT(IsNotNull(World));
+
+		TestRunner->AddExpectedError(
+			TEXT("declares invalid scheduling access"),
+			EAutomationExpectedErrorFlags::Contains, 1, false);
+		ASSERT_THAT(IsFalse(World->RegisterSystem(&Undeclared)));
+		ASSERT_THAT(IsFalse(World->IsExecutionTopologyValid()));
+	}
 }
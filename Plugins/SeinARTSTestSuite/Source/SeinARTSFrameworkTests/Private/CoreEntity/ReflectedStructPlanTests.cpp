@@ -0,0 +1,123 @@
+#include "CQTest.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/SeinCanonicalReflectedStateDigest.h"
+#include "Serialization/SeinReflectedStructPlan.h"
+#include "TestTypes/SeinComponentStorageTestTypes.h"
+#include "UObject/ObjectAndNameAsStringProxyArchive.h"
+
+namespace UE::SeinARTSTests
+{
+	namespace ReflectedStructPlanTestsPrivate
+	{
+		FSeinComponentStoragePlanProbe MakeProbe()
+		{
+			FSeinComponentStoragePlanProbe Probe;
+			Probe.Count = -7;
+			Probe.Flags = 0xA5;
+			Probe.Stamp = -(int64(1) << 40);
+			Probe.Health = FFixedPoint::FromInt(42);
+			Probe.bActive = true;
+			Probe.Values = {3, -1, 9};
+			Probe.TransientScratch = 99;
+			Probe.Velocity = FFixedVector(
+				FFixedPoint::FromInt(1),
+				FFixedPoint::FromInt(-2),
+				FFixedPoint::FromInt(3));
+			Probe.Tail = 0xBEEF;
+			return Probe;
+		}
+
+		TArray<uint8> SaveWithReflection(
+			UScriptStruct* Type, FSeinComponentStoragePlanProbe& Probe)
+		{
+			TArray<uint8> Bytes;
+			FMemoryWriter Writer(Bytes);
+			FObjectAndNameAsStringProxyArchive Ar(Writer, false);
+			Type->SerializeBin(Ar, &Probe);
+			return Bytes;
+		}
+	}
+
+	TEST(ReflectedStructPlanSnapshotMatchesReflectionBytes,
+		"SeinARTS.Unit.Entity")
+	{
+		using namespace ReflectedStructPlanTestsPrivate;
+
+		UScriptStruct* Type = FSeinComponentStoragePlanProbe::StaticStruct();
+		const TSharedRef<const FSeinReflectedStructPlan> Plan =
+			FSeinReflectedStructPlan::Get(*Type);
+		FSeinComponentStoragePlanProbe Source = MakeProbe();
+		const TArray<uint8> Expected = SaveWithReflection(Type, Source);
+
+		TArray<uint8> Actual;
+		{
+			FMemoryWriter Writer(Actual);
+			FObjectAndNameAsStringProxyArchive Ar(Writer, false);
+			ASSERT_THAT(IsTrue(Plan->CanSerializeBin(Ar)));
+			Plan->SerializeBin(Ar, &Source);
+		}
+		ASSERT_THAT(IsTrue(Expected == Actual));
+
+		FSeinComponentStoragePlanProbe Loaded;
+		{
+			FMemoryReader Reader(Actual);
+			FObjectAndNameAsStringProxyArchive Ar(Reader, false);
+			ASSERT_THAT(IsTrue(Plan->CanSerializeBin(Ar)));
+			Plan->SerializeBin(Ar, &Loaded);
+		}
+		ASSERT_THAT(AreEqual(Source.Count, Loaded.Count));
+		ASSERT_THAT(AreEqual(Source.Flags, Loaded.Flags));
+		ASSERT_THAT(AreEqual(Source.Stamp, Loaded.Stamp));
+		ASSERT_THAT(IsTrue(Source.Health == Loaded.Health));
+		ASSERT_THAT(AreEqual(Source.bActive, Loaded.bActive));
+		ASSERT_THAT(IsTrue(Source.Values == Loaded.Values));
+		ASSERT_THAT(IsTrue(Source.Velocity == Loaded.Velocity));
+		ASSERT_THAT(AreEqual(Source.Tail, Loaded.Tail));
+	}
+
+	TEST(ReflectedStructPlanIsCachedAndDigestIsStable,
+		"SeinARTS.Unit.Entity")
+	{
+		using namespace ReflectedStructPlanTestsPrivate;
+
+		UScriptStruct* Type = FSeinComponentStoragePlanProbe::StaticStruct();
+		const TSharedRef<const FSeinReflectedStructPlan> First =
+			FSeinReflectedStructPlan::Get(*Type);
+		ASSERT_THAT(IsTrue(&First.Get() == &FSeinReflectedStructPlan::Get(*Type).Get()));
+		ASSERT_THAT(AreEqual(Type->GetPathName(), First->GetTypePath()));
+		// The transient field is excluded from the canonical field list.
+		ASSERT_THAT(AreEqual(8, First->GetFields().Num()));
+
+		const FSeinCanonicalReflectedStateLimits Limits;
+		FGuid Schema;
+		FString Error;
+		ASSERT_THAT(IsTrue(FSeinCanonicalReflectedStateDigest::ComputeSchemaDigest(
+			Type, Limits, Schema, Error)));
+
+		FSeinComponentStoragePlanProbe Probe = MakeProbe();
+		FGuid Before;
+		ASSERT_THAT(IsTrue(FSeinCanonicalReflectedStateDigest::ComputeStructValueDigest(
+			Type, &Probe, Schema, Limits, Before, Error)));
+
+		// A recompiled plan must project the same bytes as the cached one.
+		FSeinReflectedStructPlan::ResetCache();
+		ASSERT_THAT(IsFalse(&First.Get() == &FSeinReflectedStructPlan::Get(*Type).Get()));
+		FGuid After;
+		ASSERT_THAT(IsTrue(FSeinCanonicalReflectedStateDigest::ComputeStructValueDigest(
+			Type, &Probe, Schema, Limits, After, Error)));
+		ASSERT_THAT(AreEqual(Before, After));
+
+		Probe.TransientScratch = 1234;
+		FGuid TransientOnly;
+		ASSERT_THAT(IsTrue(FSeinCanonicalReflectedStateDigest::ComputeStructValueDigest(
+			Type, &Probe, Schema, Limits, TransientOnly, Error)));
+		ASSERT_THAT(AreEqual(Before, TransientOnly));
+
+		Probe.Tail = 1;
+		FGuid Changed;
+		ASSERT_THAT(IsTrue(FSeinCanonicalReflectedStateDigest::ComputeStructValueDigest(
+			Type, &Probe, Schema, Limits, Changed, Error)));
+		ASSERT_THAT(IsFalse(Before == Changed));
+	}
+}
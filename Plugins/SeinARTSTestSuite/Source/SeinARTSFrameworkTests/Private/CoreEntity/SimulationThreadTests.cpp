@@ -0,0 +1,427 @@
+#include "CQTest.h"
+#include "Components/ActorTestSpawner.h"
+
+#include "Core/SeinTickPhase.h"
+#include "HAL/IConsoleManager.h"
+#include "Input/SeinCommand.h"
+#include "Settings/PluginSettings.h"
+#include "Simulation/SeinTestMatchBootstrap.h"
+#include "Simulation/SeinWorldSubsystem.h"
+
+struct FSeinWorldSubsystemTestAccess
+{
+	static bool TickSimulation(USeinWorldSubsystem& World, float DeltaTime)
+	{
+		return World.TickSimulation(DeltaTime);
+	}
+
+	static bool SealRoutineRoot(
+		USeinWorldSubsystem& World,
+		FGuid& OutRoot,
+		FString& OutError)
+	{
+		return World.SealRoutineCanonicalStateRoot(
+			World.GetCurrentTick(), false, OutRoot, OutError);
+	}
+};
+
+namespace UE::SeinARTSTests
+{
+	namespace SimulationThreadTestLocal
+	{
+		constexpr int32 TicksPerFrame = 2;
+		constexpr int32 Frames = 12;
+
+		/** Moves every entity by a slot-dependent step, so each tick changes
+		 *  the root and a reordered or skipped tick shows up. */
+		class FDriftSystem final : public ISeinSystem
+		{
+		public:
+			virtual void Tick(
+				FFixedPoint,
+				USeinWorldSubsystem& InWorld) override
+			{
+				InWorld.GetEntityPool().ForEachEntity(
+					[&InWorld](
+						FSeinEntityHandle Handle,
+						const FSeinEntity&)
+				{
+					FSeinEntity* Entity = InWorld.GetEntityMutable(Handle);
+					if (!Entity)
+					{
+						return;
+					}
+					FFixedVector Location = Entity->Transform.GetLocation();
+					Location.X += FFixedPoint::FromInt(1 + Handle.Index);
+					Entity->Transform.SetLocation(Location);
+				});
+			}
+
+			virtual FSeinSystemDescriptor DescribeSystem() const override
+			{
+				return FSeinSystemDescriptor::Stateless(
+					FName(TEXT("seinarts.tests.simulation_thread.drift")),
+					1u,
+					ESeinTickPhase::PostTick,
+					0);
+			}
+		};
+
+		/** Declared game-thread-affine; records the thread of every tick. */
+		class FGameThreadProbeSystem final : public ISeinSystem
+		{
+		public:
+			int32 Ticks = 0;
+			int32 OffGameThreadTicks = 0;
+
+			virtual void Tick(FFixedPoint, USeinWorldSubsystem&) override
+			{
+				++Ticks;
+				OffGameThreadTicks += IsInGameThread() ? 0 : 1;
+			}
+
+			virtual FSeinSystemDescriptor DescribeSystem() const override
+			{
+				return FSeinSystemDescriptor::Stateless(
+					FName(TEXT("seinarts.tests.simulation_thread.game_thread_probe")),
+					1u,
+					ESeinTickPhase::PostTick,
+					1)
+					.WithAccess(FSeinSystemAccess::Declared().OnGameThread());
+			}
+		};
+
+		class FScopedDedicatedThread
+		{
+		public:
+			FScopedDedicatedThread()
+			{
+				Variable = IConsoleManager::Get().FindConsoleVariable(
+					TEXT("Sein.Sim.DedicatedThread"));
+				if (Variable)
+				{
+					Saved = Variable->GetInt();
+				}
+			}
+
+			~FScopedDedicatedThread()
+			{
+				if (Variable)
+				{
+					Variable->SetWithCurrentPriority(Saved);
+				}
+			}
+
+			bool Set(bool bEnabled)
+			{
+				if (!Variable)
+				{
+					return false;
+				}
+				Variable->SetWithCurrentPriority(bEnabled ? 1 : 0);
+				return Variable->GetInt() == (bEnabled ? 1 : 0);
+			}
+
+		private:
+			IConsoleVariable* Variable = nullptr;
+			int32 Saved = 0;
+		};
+
+		bool StartDriftWorld(USeinWorldSubsystem& World, FString& OutError)
+		{
+			const auto AuthorState = [&World]()
+			{
+				for (int32 Index = 0; Index < 4; ++Index)
+				{
+					FFixedTransform Transform;
+					Transform.SetLocation(FFixedVector(
+						FFixedPoint::FromInt(100 * Index),
+						FFixedPoint::Zero,
+						FFixedPoint::Zero));
+					World.SpawnAbstractEntity(
+						Transform, FSeinPlayerID::Neutral());
+				}
+			};
+			return SeinTestMatchBootstrap::Materialize(
+				World,
+				AuthorState,
+				FSeinMatchSettings(),
+				0x53494d54,
+				TEXT("SimulationThread.Drift"),
+				&OutError)
+				&& SeinTestMatchBootstrap::Start(World, &OutError);
+		}
+
+		/** One engine frame: kick (or run inline), then the world-tick join. */
+		void PumpFrame(USeinWorldSubsystem& World)
+		{
+			FSeinWorldSubsystemTestAccess::TickSimulation(
+				World, World.GetFixedDeltaTimeSeconds() * TicksPerFrame);
+			World.WaitForSimulationThreadBatch();
+		}
+	}
+
+	TEST(SimulationThreadMatchesInlineRootsTickForTick,
+		"SeinARTS.Unit.CoreEntity.SimulationThread")
+	{
+		using namespace SimulationThreadTestLocal;
+		FScopedDedicatedThread Mode;
+		FDriftSystem InlineDrift;
+		FDriftSystem ThreadedDrift;
+		FActorTestSpawner InlineSpawner;
+		FActorTestSpawner ThreadedSpawner;
+		USeinWorldSubsystem* Inline =
+			InlineSpawner.GetWorld().GetSubsystem<USeinWorldSubsystem>();
+		USeinWorldSubsystem* Threaded =
+			ThreadedSpawner.GetWorld().GetSubsystem<USeinWorldSubsystem>();
+		ASSERT_THAT(IsNotNull(Inline));
+		ASSERT_THAT(IsNotNull(Threaded));
+		ASSERT_THAT(IsTrue(Inline->RegisterSystem(&InlineDrift)));
+		ASSERT_THAT(IsTrue(Threaded->RegisterSystem(&ThreadedDrift)));
+
+		FString Error;
+		ASSERT_THAT(IsTrue(StartDriftWorld(*Inline, Error)));
+		ASSERT_THAT(IsTrue(StartDriftWorld(*Threaded, Error)));
+
+		FGuid PreviousRoot;
+		for (int32 Frame = 0; Frame < Frames; ++Frame)
+		{
+			ASSERT_THAT(IsTrue(Mode.Set(false)));
+			PumpFrame(*Inline);
+			ASSERT_THAT(IsTrue(Mode.Set(true)));
+			PumpFrame(*Threaded);
+
+			ASSERT_THAT(AreEqual(
+				Inline->GetCurrentTick(), Threaded->GetCurrentTick()));
+			FGuid InlineRoot;
+			FGuid ThreadedRoot;
+			ASSERT_THAT(IsTrue(FSeinWorldSubsystemTestAccess::SealRoutineRoot(
+				*Inline, InlineRoot, Error)));
+			ASSERT_THAT(IsTrue(FSeinWorldSubsystemTestAccess::SealRoutineRoot(
+				*Threaded, ThreadedRoot, Error)));
+			ASSERT_THAT(IsTrue(InlineRoot == ThreadedRoot));
+			ASSERT_THAT(IsFalse(ThreadedRoot == PreviousRoot));
+			PreviousRoot = ThreadedRoot;
+		}
+		ASSERT_THAT(AreEqual(Frames * TicksPerFrame, Threaded->GetCurrentTick()));
+
+		const FSeinSimulationThreadStats& Stats =
+			Threaded->GetSimulationThreadStats();
+		ASSERT_THAT(AreEqual(static_cast<int64>(Frames), Stats.DedicatedFrames));
+		ASSERT_THAT(AreEqual(static_cast<int64>(0), Stats.FallbackFrames));
+		ASSERT_THAT(AreEqual(
+			static_cast<int64>(0),
+			Inline->GetSimulationThreadStats().DedicatedFrames));
+
+		Inline->StopSimulation();
+		Threaded->StopSimulation();
+	}
+
+	TEST(SimulationThreadVetoesStackAndFallBackToTheGameThread,
+		"SeinARTS.Unit.CoreEntity.SimulationThread")
+	{
+		using namespace SimulationThreadTestLocal;
+		FScopedDedicatedThread Mode;
+		ASSERT_THAT(IsTrue(Mode.Set(true)));
+		FActorTestSpawner Spawner;
+		USeinWorldSubsystem* World =
+			Spawner.GetWorld().GetSubsystem<USeinWorldSubsystem>();
+		ASSERT_THAT(IsNotNull(World));
+		FString Error;
+		ASSERT_THAT(IsTrue(StartDriftWorld(*World, Error)));
+
+		// A later registration that declines must not displace an earlier
+		// one that vetoes.
+		const FDelegateHandle Recording = World->AddSimulationThreadVeto(
+			FSeinSimulationThreadVeto::CreateLambda([]() { return true; }));
+		const FDelegateHandle Idle = World->AddSimulationThreadVeto(
+			FSeinSimulationThreadVeto::CreateLambda([]() { return false; }));
+		ASSERT_THAT(IsTrue(World->IsSimulationThreadVetoed()));
+
+		PumpFrame(*World);
+		const FSeinSimulationThreadStats& Stats =
+			World->GetSimulationThreadStats();
+		ASSERT_THAT(AreEqual(static_cast<int64>(0), Stats.DedicatedFrames));
+		ASSERT_THAT(AreEqual(static_cast<int64>(1), Stats.FallbackFrames));
+		ASSERT_THAT(IsTrue(
+			Stats.LastFallback == ESeinSimulationThreadFallback::ObserverVeto));
+		ASSERT_THAT(AreEqual(TicksPerFrame, World->GetCurrentTick()));
+
+		World->RemoveSimulationThreadVeto(Idle);
+		PumpFrame(*World);
+		ASSERT_THAT(AreEqual(static_cast<int64>(0), Stats.DedicatedFrames));
+		ASSERT_THAT(AreEqual(static_cast<int64>(2), Stats.FallbackFrames));
+
+		World->RemoveSimulationThreadVeto(Recording);
+		ASSERT_THAT(IsFalse(World->IsSimulationThreadVetoed()));
+		PumpFrame(*World);
+		ASSERT_THAT(AreEqual(static_cast<int64>(1), Stats.DedicatedFrames));
+		ASSERT_THAT(AreEqual(static_cast<int64>(2), Stats.FallbackFrames));
+		ASSERT_THAT(AreEqual(3 * TicksPerFrame, World->GetCurrentTick()));
+
+		World->StopSimulation();
+	}
+
+	TEST(SimulationThreadQueuesCommandsAndDefersTickObserversToTheJoin,
+		"SeinARTS.Unit.CoreEntity.SimulationThread")
+	{
+		using namespace SimulationThreadTestLocal;
+		FScopedDedicatedThread Mode;
+		ASSERT_THAT(IsTrue(Mode.Set(true)));
+		FActorTestSpawner Spawner;
+		USeinWorldSubsystem* World =
+			Spawner.GetWorld().GetSubsystem<USeinWorldSubsystem>();
+		ASSERT_THAT(IsNotNull(World));
+		FString Error;
+		ASSERT_THAT(IsTrue(StartDriftWorld(*World, Error)));
+		ASSERT_THAT(AreEqual(0, World->GetPendingCommands().Num()));
+
+		TArray<int32> ObservedTicks;
+		bool bObservedOffGameThread = false;
+		const FDelegateHandle Observer = World->OnSimTickCompleted.AddLambda(
+			[&ObservedTicks, &bObservedOffGameThread](int32 Tick)
+			{
+				bObservedOffGameThread |= !IsInGameThread();
+				ObservedTicks.Add(Tick);
+			});
+
+		FSeinWorldSubsystemTestAccess::TickSimulation(
+			*World, World->GetFixedDeltaTimeSeconds() * TicksPerFrame);
+		// Stays in flight until the join, however early the worker finishes.
+		ASSERT_THAT(IsTrue(World->IsSimulationBatchInFlight()));
+		ASSERT_THAT(AreEqual(0, ObservedTicks.Num()));
+		World->SubmitLocalCommandDraft(FSeinCommand::MakePingCommand(
+			FSeinPlayerID(1), FFixedVector()));
+
+		World->WaitForSimulationThreadBatch();
+		ASSERT_THAT(IsFalse(World->IsSimulationBatchInFlight()));
+		ASSERT_THAT(AreEqual(1, World->GetPendingCommands().Num()));
+		ASSERT_THAT(IsFalse(bObservedOffGameThread));
+		ASSERT_THAT(AreEqual(TicksPerFrame, ObservedTicks.Num()));
+		for (int32 Index = 0; Index < ObservedTicks.Num(); ++Index)
+		{
+			ASSERT_THAT(AreEqual(Index + 1, ObservedTicks[Index]));
+		}
+
+		// Outside a batch the same entry point applies immediately.
+		World->SubmitLocalCommandDraft(FSeinCommand::MakePingCommand(
+			FSeinPlayerID(1), FFixedVector()));
+		ASSERT_THAT(AreEqual(2, World->GetPendingCommands().Num()));
+		ASSERT_THAT(AreEqual(
+			static_cast<int64>(1),
+			World->GetSimulationThreadStats().DedicatedFrames));
+
+		World->OnSimTickCompleted.Remove(Observer);
+		World->StopSimulation();
+	}
+
+	TEST(SimulationThreadHandsGameThreadSystemsBack,
+		"SeinARTS.Unit.CoreEntity.SimulationThread")
+	{
+		using namespace SimulationThreadTestLocal;
+		FScopedDedicatedThread Mode;
+		ASSERT_THAT(IsTrue(Mode.Set(true)));
+		FDriftSystem Drift;
+		FGameThreadProbeSystem Probe;
+		FActorTestSpawner Spawner;
+		USeinWorldSubsystem* World =
+			Spawner.GetWorld().GetSubsystem<USeinWorldSubsystem>();
+		ASSERT_THAT(IsNotNull(World));
+		ASSERT_THAT(IsTrue(World->RegisterSystem(&Drift)));
+		ASSERT_THAT(IsTrue(World->RegisterSystem(&Probe)));
+		FString Error;
+		ASSERT_THAT(IsTrue(StartDriftWorld(*World, Error)));
+
+		for (int32 Frame = 0; Frame < 3; ++Frame)
+		{
+			PumpFrame(*World);
+		}
+
+		// The batch still ran on the worker; only the probe came back.
+		const FSeinSimulationThreadStats& Stats =
+			World->GetSimulationThreadStats();
+		ASSERT_THAT(AreEqual(static_cast<int64>(3), Stats.DedicatedFrames));
+		ASSERT_THAT(AreEqual(3 * TicksPerFrame, World->GetCurrentTick()));
+		ASSERT_THAT(AreEqual(3 * TicksPerFrame, Probe.Ticks));
+		ASSERT_THAT(AreEqual(0, Probe.OffGameThreadTicks));
+		ASSERT_THAT(IsTrue(Stats.GameThreadHops >= Probe.Ticks));
+
+		World->StopSimulation();
+	}
+
+	TEST(SimulationThreadOpensTheTurnGateAtTheKickAndStopsAtTheNextBoundary,
+		"SeinARTS.Unit.CoreEntity.SimulationThread")
+	{
+		using namespace SimulationThreadTestLocal;
+		FScopedDedicatedThread Mode;
+		ASSERT_THAT(IsTrue(Mode.Set(true)));
+		FActorTestSpawner Spawner;
+		USeinWorldSubsystem* World =
+			Spawner.GetWorld().GetSubsystem<USeinWorldSubsystem>();
+		ASSERT_THAT(IsNotNull(World));
+		FString Error;
+		ASSERT_THAT(IsTrue(StartDriftWorld(*World, Error)));
+
+		const USeinARTSCoreSettings* Settings = GetDefault<USeinARTSCoreSettings>();
+		ASSERT_THAT(IsTrue(Settings->TurnRate > 0));
+		const int32 TicksPerTurn = FMath::Max(
+			1, Settings->SimulationTickRate / Settings->TurnRate);
+		const int32 MaxTicks = Settings->MaxTicksPerFrame;
+		ASSERT_THAT(IsTrue(MaxTicks > TicksPerTurn));
+		constexpr int32 StalledTurn = 4;
+
+		// A lockstep adapter stand-in: gate and drain must stay on the game
+		// thread, and the observer closing each turn must see that exact tick.
+		bool bGateOffGameThread = false;
+		TArray<int32> ConsumedTurns;
+		int32 MisplacedClosingTicks = 0;
+		World->TurnReadyResolver.BindLambda(
+			[&bGateOffGameThread](int32 Turn)
+			{
+				bGateOffGameThread |= !IsInGameThread();
+				return Turn < StalledTurn;
+			});
+		World->TurnConsumeNotifier.BindLambda(
+			[&bGateOffGameThread, &ConsumedTurns](int32 Turn)
+			{
+				bGateOffGameThread |= !IsInGameThread();
+				ConsumedTurns.Add(Turn);
+			});
+		const FDelegateHandle Observer = World->OnSimTickCompleted.AddLambda(
+			[World, TicksPerTurn, &MisplacedClosingTicks](int32 Tick)
+			{
+				if ((Tick + 1) % TicksPerTurn == 0
+					&& World->GetCurrentTick() != Tick)
+				{
+					++MisplacedClosingTicks;
+				}
+			});
+
+		// Every frame offers a full MaxTicks budget; each batch still stops
+		// at the next turn boundary, and the closed gate stalls the pump.
+		for (int32 Frame = 0; Frame < StalledTurn + 2; ++Frame)
+		{
+			FSeinWorldSubsystemTestAccess::TickSimulation(
+				*World, World->GetFixedDeltaTimeSeconds() * MaxTicks);
+			World->WaitForSimulationThreadBatch();
+		}
+
+		ASSERT_THAT(IsFalse(bGateOffGameThread));
+		ASSERT_THAT(AreEqual(0, MisplacedClosingTicks));
+		ASSERT_THAT(AreEqual(StalledTurn * TicksPerTurn - 1, World->GetCurrentTick()));
+		ASSERT_THAT(AreEqual(StalledTurn - 1, ConsumedTurns.Num()));
+		for (int32 Index = 0; Index < ConsumedTurns.Num(); ++Index)
+		{
+			ASSERT_THAT(AreEqual(Index + 1, ConsumedTurns[Index]));
+		}
+		const FSeinSimulationThreadStats& Stats =
+			World->GetSimulationThreadStats();
+		ASSERT_THAT(AreEqual(static_cast<int64>(StalledTurn), Stats.DedicatedFrames));
+		ASSERT_THAT(AreEqual(static_cast<int64>(0), Stats.FallbackFrames));
+
+		World->OnSimTickCompleted.Remove(Observer);
+		World->TurnReadyResolver.Unbind();
+		World->TurnConsumeNotifier.Unbind();
+		World->StopSimulation();
+	}
+}
@@ -3,6 +3,7 @@
 #include "Data/SeinWorldSnapshot.h"
 #include "Hash/Blake3.h"
 #include "Serialization/SeinSnapshotEnvelopeCodec.h"
+#include "Serialization/SeinSnapshotSectionCodec.h"
 
 namespace UE::SeinARTSTests
 {
@@ -588,4 +589,115 @@ namespace UE::SeinARTSTests
 		ASSERT_THAT(IsTrue(DecodeFailsWith(
 			Bad, TEXT("aggregate state root"), Error)));
 	}
+
+	TEST(SnapshotSectionCodecsRoundTripToExactCanonicalBytes,
+		"SeinARTS.Unit.CoreEntity.SnapshotEnvelope")
+	{
+		TArray<uint8> Base;
+		for (int32 Index = 0; Index < 600; ++Index)
+		{
+			Base.Add(static_cast<uint8>(Index * 7));
+		}
+		// Sparse edits, a short equal gap inside a literal, and growth past
+		// the end of the base.
+		TArray<uint8> Canonical = Base;
+		Canonical[3] ^= 0x5a;
+		Canonical[5] ^= 0x01;
+		Canonical[400] ^= 0xff;
+		Canonical.Append({1, 2, 3, 4, 5});
+
+		const ESeinSnapshotSectionCodec Codecs[] = {
+			ESeinSnapshotSectionCodec::CanonicalBytes,
+			ESeinSnapshotSectionCodec::XorDelta,
+			ESeinSnapshotSectionCodec::CanonicalBytesLZ4,
+			ESeinSnapshotSectionCodec::XorDeltaLZ4,
+		};
+		FString Error;
+		for (const ESeinSnapshotSectionCodec Codec : Codecs)
+		{
+			TArray<uint8> Stored;
+			TArray<uint8> Decoded;
+			ASSERT_THAT(IsTrue(FSeinSnapshotSectionCodec::Encode(
+				Codec, Canonical, Base, Stored, Error)));
+			ASSERT_THAT(IsTrue(FSeinSnapshotSectionCodec::Decode(
+				Codec, Stored, Base, Canonical.Num(), Decoded, Error)));
+			ASSERT_THAT(IsTrue(Decoded == Canonical));
+		}
+
+		TArray<uint8> Delta;
+		ASSERT_THAT(IsTrue(FSeinSnapshotSectionCodec::Encode(
+			ESeinSnapshotSectionCodec::XorDelta, Canonical, Base, Delta, Error)));
+		ASSERT_THAT(IsTrue(Delta.Num() < 24));
+
+		// A shrinking section decodes against the longer base too.
+		const TArray<uint8> Shorter(Base.GetData(), 100);
+		TArray<uint8> Decoded;
+		ASSERT_THAT(IsTrue(FSeinSnapshotSectionCodec::Encode(
+			ESeinSnapshotSectionCodec::XorDelta, Shorter, Base, Delta, Error)));
+		ASSERT_THAT(IsTrue(FSeinSnapshotSectionCodec::Decode(
+			ESeinSnapshotSectionCodec::XorDelta,
+			Delta,
+			Base,
+			Shorter.Num(),
+			Decoded,
+			Error)));
+		ASSERT_THAT(IsTrue(Decoded == Shorter));
+	}
+
+	TEST(SnapshotSectionCodecsRejectStreamsThatMissTheirCanonicalLength,
+		"SeinARTS.Unit.CoreEntity.SnapshotEnvelope.Security")
+	{
+		const TArray<uint8> Base{1, 2, 3, 4};
+		const TArray<uint8> Canonical{1, 2, 9, 4};
+		TArray<uint8> Delta;
+		FString Error;
+		ASSERT_THAT(IsTrue(FSeinSnapshotSectionCodec::Encode(
+			ESeinSnapshotSectionCodec::XorDelta, Canonical, Base, Delta, Error)));
+
+		const TArray<uint8> Preserved{42};
+		TArray<uint8> Decoded = Preserved;
+		ASSERT_THAT(IsFalse(FSeinSnapshotSectionCodec::Decode(
+			ESeinSnapshotSectionCodec::XorDelta,
+			Delta,
+			Base,
+			Canonical.Num() + 1,
+			Decoded,
+			Error)));
+		ASSERT_THAT(IsTrue(Error.Contains(TEXT("canonical length"))));
+		ASSERT_THAT(IsFalse(FSeinSnapshotSectionCodec::Decode(
+			ESeinSnapshotSectionCodec::XorDelta,
+			Delta,
+			Base,
+			Canonical.Num() - 1,
+			Decoded,
+			Error)));
+
+		// An empty run pair can never come from the encoder.
+		const TArray<uint8> EmptyRun{0, 0};
+		ASSERT_THAT(IsFalse(FSeinSnapshotSectionCodec::Decode(
+			ESeinSnapshotSectionCodec::XorDelta,
+			EmptyRun,
+			Base,
+			0,
+			Decoded,
+			Error)));
+
+		TArray<uint8> Compressed;
+		ASSERT_THAT(IsTrue(FSeinSnapshotSectionCodec::Encode(
+			ESeinSnapshotSectionCodec::CanonicalBytesLZ4,
+			Canonical,
+			{},
+			Compressed,
+			Error)));
+		Compressed[7] += 1;
+		ASSERT_THAT(IsFalse(FSeinSnapshotSectionCodec::Decode(
+			ESeinSnapshotSectionCodec::CanonicalBytesLZ4,
+			Compressed,
+			{},
+			Canonical.Num(),
+			Decoded,
+			Error)));
+		ASSERT_THAT(IsTrue(Error.Contains(TEXT("bound"))));
+		ASSERT_THAT(IsTrue(Decoded == Preserved));
+	}
 }
@@ -0,0 +1,162 @@
+#include "CQTest.h"
+#include "Components/ActorTestSpawner.h"
+
+#include "Components/SeinLifespanData.h"
+#include "Core/SeinTimerWheel.h"
+#include "Simulation/SeinTestMatchBootstrap.h"
+#include "Simulation/SeinTestSimContext.h"
+#include "Simulation/SeinWorldSubsystem.h"
+
+struct FSeinWorldSubsystemTestAccess
+{
+	static bool TickSimulation(USeinWorldSubsystem& World, float DeltaTime)
+	{
+		return World.TickSimulation(DeltaTime);
+	}
+};
+
+namespace UE::SeinARTSTests
+{
+	TEST(TimerWheelFiresOnlyCrossedDeadlinesInKeyOrder,
+		"SeinARTS.Unit.CoreEntity.TimerWheel")
+	{
+		FSeinTimerWheel Wheel(3);
+		Wheel.Reset(10);
+		Wheel.Schedule(12, 7);
+		Wheel.Schedule(11, 9);
+		Wheel.Schedule(11, 2);
+		// Same slot as tick 12 one revolution later: must roll over, not fire.
+		Wheel.Schedule(20, 1);
+		ASSERT_THAT(AreEqual(4, Wheel.Num()));
+
+		TArray<uint64> Due;
+		Wheel.Advance(10, Due);
+		ASSERT_THAT(AreEqual(0, Due.Num()));
+
+		Wheel.Advance(11, Due);
+		ASSERT_THAT(AreEqual(2, Due.Num()));
+		ASSERT_THAT(AreEqual(uint64(2), Due[0]));
+		ASSERT_THAT(AreEqual(uint64(9), Due[1]));
+
+		Wheel.Advance(12, Due);
+		ASSERT_THAT(AreEqual(1, Due.Num()));
+		ASSERT_THAT(AreEqual(uint64(7), Due[0]));
+		ASSERT_THAT(AreEqual(1, Wheel.Num()));
+
+		// Re-advancing an already reached tick is a no-op.
+		Wheel.Advance(12, Due);
+		ASSERT_THAT(AreEqual(0, Due.Num()));
+
+		Wheel.Advance(19, Due);
+		ASSERT_THAT(AreEqual(0, Due.Num()));
+		Wheel.Advance(20, Due);
+		ASSERT_THAT(AreEqual(1, Due.Num()));
+		ASSERT_THAT(AreEqual(uint64(1), Due[0]));
+		ASSERT_THAT(IsTrue(Wheel.IsEmpty()));
+	}
+
+	TEST(TimerWheelLateSchedulesAndLongJumpsStillFireOnce,
+		"SeinARTS.Unit.CoreEntity.TimerWheel")
+	{
+		FSeinTimerWheel Wheel(2);
+		Wheel.Reset(0);
+		TArray<uint64> Due;
+		Wheel.Advance(5, Due);
+
+		// Already-passed deadlines fire on the next advance.
+		Wheel.Schedule(3, 40);
+		Wheel.Schedule(5, 30);
+		Wheel.Advance(6, Due);
+		ASSERT_THAT(AreEqual(2, Due.Num()));
+		ASSERT_THAT(AreEqual(uint64(30), Due[0]));
+		ASSERT_THAT(AreEqual(uint64(40), Due[1]));
+
+		// A jump spanning several revolutions visits each slot exactly once
+		// and keeps deadlines that are still in the future.
+		Wheel.Schedule(7, 3);
+		Wheel.Schedule(13, 1);
+		Wheel.Schedule(40, 2);
+		Wheel.Advance(30, Due);
+		ASSERT_THAT(AreEqual(2, Due.Num()));
+		ASSERT_THAT(AreEqual(uint64(1), Due[0]));
+		ASSERT_THAT(AreEqual(uint64(3), Due[1]));
+		ASSERT_THAT(AreEqual(1, Wheel.Num()));
+
+		Wheel.Reset(40);
+		ASSERT_THAT(IsTrue(Wheel.IsEmpty()));
+		Wheel.Schedule(39, 5);
+		Wheel.Advance(40, Due);
+		ASSERT_THAT(AreEqual(1, Due.Num()));
+		ASSERT_THAT(AreEqual(uint64(5), Due[0]));
+	}
+
+	TEST(LifespanScheduleFollowsDeadlinesMovedAfterSpawn,
+		"SeinARTS.Unit.CoreEntity.TimerWheel")
+	{
+		FActorTestSpawner Spawner;
+		USeinWorldSubsystem* World =
+			Spawner.GetWorld().GetSubsystem<USeinWorldSubsystem>();
+		ASSERT_THAT(IsNotNull(World));
+
+		FSeinEntityHandle Extended;
+		FSeinEntityHandle Shortened;
+		FSeinEntityHandle Untouched;
+		const auto SpawnExpiring = [World](int32 ExpiresAtTick)
+		{
+			const FSeinEntityHandle Handle = World->SpawnAbstractEntity(
+				FFixedTransform(), FSeinPlayerID::Neutral());
+			FSeinLifespanData Lifespan;
+			Lifespan.ExpiresAtTick = ExpiresAtTick;
+			World->AddComponent(Handle, Lifespan);
+			return Handle;
+		};
+		FString Error;
+		ASSERT_THAT(IsTrue(SeinTestMatchBootstrap::Materialize(
+			*World,
+			[&]()
+			{
+				Extended = SpawnExpiring(3);
+				Shortened = SpawnExpiring(6);
+				Untouched = SpawnExpiring(100);
+			},
+			FSeinMatchSettings(),
+			0x4c494645,
+			TEXT("TimerWheel.Lifespan"),
+			&Error)));
+		ASSERT_THAT(IsTrue(SeinTestMatchBootstrap::Start(*World, &Error)));
+
+		const auto PumpTo = [World](int32 Tick)
+		{
+			while (World->GetCurrentTick() < Tick)
+			{
+				FSeinWorldSubsystemTestAccess::TickSimulation(
+					*World, World->GetFixedDeltaTimeSeconds());
+				World->WaitForSimulationThreadBatch();
+			}
+		};
+		PumpTo(1);
+		{
+			// Both moves reach the wheel through the storage journal, not a
+			// rebuild of the whole schedule.
+			auto SimScope = FSeinSimContextTestAccess::Enter(*World);
+			FSeinLifespanData* Later =
+				World->GetComponentMutable<FSeinLifespanData>(Extended);
+			FSeinLifespanData* Sooner =
+				World->GetComponentMutable<FSeinLifespanData>(Shortened);
+			ASSERT_THAT(IsNotNull(Later));
+			ASSERT_THAT(IsNotNull(Sooner));
+			Later->ExpiresAtTick = 8;
+			Sooner->ExpiresAtTick = 2;
+		}
+
+		PumpTo(5);
+		ASSERT_THAT(IsNull(World->GetEntity(Shortened)));
+		ASSERT_THAT(IsNotNull(World->GetEntity(Extended)));
+
+		PumpTo(11);
+		ASSERT_THAT(IsNull(World->GetEntity(Extended)));
+		ASSERT_THAT(IsNotNull(World->GetEntity(Untouched)));
+
+		World->StopSimulation();
+	}
+}
@@ -1,5 +1,6 @@
 #include "CQTest.h"
 
+#include "Collision/SeinCollisionResolverColored.h"
 #include "Determinism/SeinCollisionDeterminismScenario.h"
 
 namespace
@@ -13,26 +14,23 @@ namespace
 			UE_LOG(LogTemp, Display, TEXT("[SeinDeterminismTrace] %s"), *Frame.ToLogPayload());
 		}
 	}
-}
 
-namespace UE::SeinARTSTests
-{
-	TEST(CollisionCanonicalRootSerialParallelMatches, "SeinARTS.Determinism")
+	/** Empty when the serial and parallel runs of ResolverClass agree on every
+	 *  tick's pose words, pose digest, and canonical root. */
+	FString CompareSerialParallelTraces(TSubclassOf<USeinCollisionResolver> ResolverClass)
 	{
 		const FSeinCollisionDeterminismTrace Serial =
-			SeinRunCollisionDeterminismScenario(false, TraceTicks);
+			SeinRunCollisionDeterminismScenario(false, TraceTicks, ResolverClass);
 		if (const FString Error = Serial.Validate(false, TraceTicks); !Error.IsEmpty())
 		{
-			AddError(FString::Printf(TEXT("Serial trace is invalid: %s"), *Error));
-			return;
+			return FString::Printf(TEXT("Serial trace is invalid: %s"), *Error);
 		}
 
 		const FSeinCollisionDeterminismTrace Parallel =
-			SeinRunCollisionDeterminismScenario(true, TraceTicks);
+			SeinRunCollisionDeterminismScenario(true, TraceTicks, ResolverClass);
 		if (const FString Error = Parallel.Validate(true, TraceTicks); !Error.IsEmpty())
 		{
-			AddError(FString::Printf(TEXT("Parallel trace is invalid: %s"), *Error));
-			return;
+			return FString::Printf(TEXT("Parallel trace is invalid: %s"), *Error);
 		}
 
 		for (int32 Index = 0; Index < TraceTicks; ++Index)
@@ -49,7 +47,7 @@ namespace UE::SeinARTSTests
 					: (!bRootsMatch
 						? TEXT("canonical-root-only mismatch")
 						: TEXT("pose-digest mismatch"));
-				AddError(FString::Printf(
+				return FString::Printf(
 					TEXT("Serial/parallel divergence at tick %d: serial root=%s pose=0x%016llX, ")
 					TEXT("parallel root=%s pose=0x%016llX (%s)."),
 					SerialFrame.Tick,
@@ -57,10 +55,31 @@ namespace UE::SeinARTSTests
 					static_cast<unsigned long long>(SerialFrame.PoseDigest),
 					*ParallelFrame.StateRoot.ToString(EGuidFormats::Digits),
 					static_cast<unsigned long long>(ParallelFrame.PoseDigest),
-					MismatchKind));
-				return;
+					MismatchKind);
 			}
 		}
+		return FString();
+	}
+}
+
+namespace UE::SeinARTSTests
+{
+	TEST(CollisionCanonicalRootSerialParallelMatches, "SeinARTS.Determinism")
+	{
+		if (const FString Error = CompareSerialParallelTraces(nullptr); !Error.IsEmpty())
+		{
+			AddError(Error);
+		}
+	}
+
+	TEST(ColoredCollisionCanonicalRootSerialParallelMatches, "SeinARTS.Determinism")
+	{
+		if (const FString Error = CompareSerialParallelTraces(
+				USeinCollisionResolverColored::StaticClass());
+			!Error.IsEmpty())
+		{
+			AddError(Error);
+		}
 	}
 
 	TEST(SerialCollisionTrace, "SeinARTS.Determinism.Process")
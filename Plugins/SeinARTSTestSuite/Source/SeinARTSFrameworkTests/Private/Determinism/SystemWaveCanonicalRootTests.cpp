@@ -0,0 +1,285 @@
+/**
+ * SeinARTS Test Suite - Copyright (c) 2026 Phenom Studios, Inc.
+ * @file    SystemWaveCanonicalRootTests.cpp
+ * @brief   Wave dispatch must not change simulation results: the same combat
+ *          match (instant, projectile and ballistic fire, periodic and timed
+ *          effects, regen, deaths and lifespans) is run with
+ *          Sein.Sim.ParallelSystems off and on, and every tick's canonical
+ *          state root must agree.
+ */
+
+#include "CQTest.h"
+#include "Components/ActorTestSpawner.h"
+
+#include "Combat/SeinWeaponArchetype.h"
+#include "Combat/SeinWeaponFire.h"
+#include "Components/SeinActiveEffectsComponent.h"
+#include "Components/SeinLifespanData.h"
+#include "Components/SeinVitalsComponent.h"
+#include "Components/SeinWeaponComponent.h"
+#include "Containers/Ticker.h"
+#include "Core/SeinParallel.h"
+#include "HAL/IConsoleManager.h"
+#include "Simulation/SeinTestMatchBootstrap.h"
+#include "Simulation/SeinTestSimContext.h"
+#include "Simulation/SeinWorldSubsystem.h"
+#include "TestTypes/SeinEffectMutationTestTypes.h"
+#include "UObject/StrongObjectPtr.h"
+
+namespace
+{
+	constexpr int32 WaveTraceTicks = 90;
+	constexpr int32 ShootersPerDelivery = 3;
+
+	/** Pins Sein.Sim.Parallel on and Sein.Sim.ParallelSystems to the requested
+	 *  mode for one run, restoring both afterwards. */
+	class FScopedSystemWaveCvars
+	{
+	public:
+		explicit FScopedSystemWaveCvars(bool bWaves)
+		{
+			IConsoleManager& Console = IConsoleManager::Get();
+			Parallel = Console.FindConsoleVariable(TEXT("Sein.Sim.Parallel"));
+			Systems = Console.FindConsoleVariable(TEXT("Sein.Sim.ParallelSystems"));
+			if (!Parallel || !Systems)
+			{
+				return;
+			}
+
+			PreviousParallel = Parallel->GetInt();
+			PreviousSystems = Systems->GetInt();
+			Parallel->SetWithCurrentPriority(1);
+			Systems->SetWithCurrentPriority(bWaves ? 1 : 0);
+			bValid = true;
+		}
+
+		~FScopedSystemWaveCvars()
+		{
+			if (!bValid)
+			{
+				return;
+			}
+			Parallel->SetWithCurrentPriority(PreviousParallel);
+			Systems->SetWithCurrentPriority(PreviousSystems);
+		}
+
+		bool IsValid() const { return bValid; }
+
+	private:
+		IConsoleVariable* Parallel = nullptr;
+		IConsoleVariable* Systems = nullptr;
+		int32 PreviousParallel = 0;
+		int32 PreviousSystems = 0;
+		bool bValid = false;
+	};
+
+	struct FSystemWaveTrace
+	{
+		TArray<FGuid> Roots;
+		int32 ShotsFired = 0;
+		int32 VictimsDestroyed = 0;
+		FString Error;
+	};
+
+	FFixedVector At(int32 X, int32 Y)
+	{
+		return FFixedVector(
+			FFixedPoint::FromInt(X), FFixedPoint::FromInt(Y), FFixedPoint::Zero);
+	}
+
+	FSystemWaveTrace RunSystemWaveScenario(bool bWaves)
+	{
+		FSystemWaveTrace Trace;
+		FScopedSystemWaveCvars Cvars(bWaves);
+		if (!Cvars.IsValid())
+		{
+			Trace.Error = TEXT("Sein.Sim.Parallel / Sein.Sim.ParallelSystems are not registered.");
+			return Trace;
+		}
+		if (SeinSimParallelSystemsEnabled() != bWaves)
+		{
+			Trace.Error = FString::Printf(
+				TEXT("Wave dispatch did not follow the cvar (expected %s)."),
+				bWaves ? TEXT("on") : TEXT("off"));
+			return Trace;
+		}
+
+		FActorTestSpawner Spawner;
+		USeinWorldSubsystem* World =
+			Spawner.GetWorld().GetSubsystem<USeinWorldSubsystem>();
+		if (!World)
+		{
+			Trace.Error = TEXT("No sim world.");
+			return Trace;
+		}
+
+		const FSeinPlayerID Attacker(1);
+		const FSeinPlayerID Defender(2);
+		const ESeinWeaponDelivery Deliveries[] = {
+			ESeinWeaponDelivery::Instant,
+			ESeinWeaponDelivery::Projectile,
+			ESeinWeaponDelivery::Ballistic,
+		};
+		TArray<TStrongObjectPtr<USeinWeaponArchetype>> Archetypes;
+		TArray<FSeinEntityHandle> Shooters;
+		TArray<FSeinEntityHandle> Victims;
+
+		FString Error;
+		const bool bStarted = SeinTestMatchBootstrap::Materialize(
+				*World,
+				[&]()
+				{
+					World->RegisterPlayer(Attacker, FSeinFactionID(1));
+					World->RegisterPlayer(Defender, FSeinFactionID(2));
+
+					int32 Row = 0;
+					for (const ESeinWeaponDelivery Delivery : Deliveries)
+					{
+						for (int32 Index = 0; Index < ShootersPerDelivery; ++Index, ++Row)
+						{
+							USeinWeaponArchetype* Archetype =
+								NewObject<USeinWeaponArchetype>(GetTransientPackage());
+							Archetype->Profile.Range = FFixedPoint::FromInt(2000);
+							Archetype->Profile.CooldownSeconds = FFixedPoint::One;
+							Archetype->Profile.Payload.BaseDamage =
+								FFixedPoint::FromInt(15 + 5 * Index);
+							Archetype->Profile.Delivery = Delivery;
+							Archetype->Profile.ProjectileSpeed = FFixedPoint::FromInt(1000);
+							Archetypes.Emplace(Archetype);
+
+							const FSeinEntityHandle Shooter = World->SpawnAbstractEntity(
+								FFixedTransform(At(0, Row * 200)), Attacker);
+							FSeinWeaponComponent Weapons;
+							FSeinWeaponSlot Slot;
+							Slot.Archetype = Archetype;
+							Weapons.Weapons.Add(Slot);
+							World->AddComponent(Shooter, Weapons);
+							Shooters.Add(Shooter);
+
+							const FSeinEntityHandle Victim = World->SpawnAbstractEntity(
+								FFixedTransform(At(500, Row * 200)), Defender);
+							FSeinVitalsComponent Vitals;
+							Vitals.MaxHealth = FFixedPoint::FromInt(60 + 20 * Index);
+							Vitals.Health = Vitals.MaxHealth;
+							Vitals.RegenPerSecond = FFixedPoint::FromInt(Row % 2 == 0 ? 0 : 3);
+							World->AddComponent(Victim, Vitals);
+							World->AddComponent(Victim, FSeinActiveEffectsComponent());
+							if (Row % 3 == 0)
+							{
+								FSeinLifespanData Lifespan;
+								Lifespan.ExpiresAtTick = 20 + Row * 5;
+								World->AddComponent(Victim, Lifespan);
+							}
+							World->ApplyEffect(Victim,
+								USeinEffectPeriodicATestEffect::StaticClass(), Shooter);
+							if (Index == 0)
+							{
+								World->ApplyEffect(Victim,
+									USeinEffectTimedPlayerTestEffect::StaticClass(), Shooter);
+							}
+							Victims.Add(Victim);
+						}
+					}
+				},
+				FSeinMatchSettings(),
+				0x57415645,
+				TEXT("SeinARTS.Determinism.SystemWaves"),
+				&Error)
+			&& SeinTestMatchBootstrap::Start(*World, &Error);
+		if (!bStarted)
+		{
+			Trace.Error = FString::Printf(TEXT("Match failed to start: %s"), *Error);
+			return Trace;
+		}
+
+		// The run is only meaningful if declared systems actually share a wave.
+		const int32 WeaponCycleWave =
+			World->GetExecutionScheduleWave(TEXT("seinarts.combat.weapon_cycle"));
+		if (WeaponCycleWave == INDEX_NONE
+			|| WeaponCycleWave
+				!= World->GetExecutionScheduleWave(TEXT("seinarts.core.cooldown_tick")))
+		{
+			Trace.Error = TEXT("Weapon cycle and cooldown tick do not share a wave.");
+			World->StopSimulation();
+			return Trace;
+		}
+
+		for (int32 Tick = 0; Tick < WaveTraceTicks; ++Tick)
+		{
+			{
+				auto SimScope = FSeinSimContextTestAccess::Enter(*World);
+				for (int32 Index = 0; Index < Shooters.Num(); ++Index)
+				{
+					if (World->IsEntityAlive(Victims[Index])
+						&& FSeinWeaponFire::TryFireWeaponAt(
+							*World, Shooters[Index], 0, Victims[Index])
+							== ESeinWeaponFireResult::Fired)
+					{
+						++Trace.ShotsFired;
+					}
+				}
+			}
+
+			FTSTicker::GetCoreTicker().Tick(World->GetFixedDeltaTimeSeconds());
+
+			FGuid Root;
+			FString RootError;
+			if (!World->ComputeCanonicalStateRoot(Root, RootError))
+			{
+				Trace.Error = FString::Printf(
+					TEXT("Tick %d root failed: %s"), Tick, *RootError);
+				World->StopSimulation();
+				return Trace;
+			}
+			Trace.Roots.Add(Root);
+		}
+
+		for (const FSeinEntityHandle Victim : Victims)
+		{
+			Trace.VictimsDestroyed += World->IsEntityAlive(Victim) ? 0 : 1;
+		}
+		World->StopSimulation();
+		return Trace;
+	}
+}
+
+namespace UE::SeinARTSTests
+{
+	TEST(SystemWaveCanonicalRootMatchesSerialDispatch, "SeinARTS.Determinism")
+	{
+		const FSystemWaveTrace Serial = RunSystemWaveScenario(false);
+		if (!Serial.Error.IsEmpty())
+		{
+			AddError(FString::Printf(TEXT("Serial run is invalid: %s"), *Serial.Error));
+			return;
+		}
+		const FSystemWaveTrace Waves = RunSystemWaveScenario(true);
+		if (!Waves.Error.IsEmpty())
+		{
+			AddError(FString::Printf(TEXT("Wave run is invalid: %s"), *Waves.Error));
+			return;
+		}
+
+		ASSERT_THAT(AreEqual(WaveTraceTicks, Serial.Roots.Num()));
+		ASSERT_THAT(AreEqual(WaveTraceTicks, Waves.Roots.Num()));
+		// Combat must actually happen: shots land and some victims die
+		// through the weapon-cycle reap or their lifespan.
+		ASSERT_THAT(IsTrue(Serial.ShotsFired > 0));
+		ASSERT_THAT(IsTrue(Serial.VictimsDestroyed > 0));
+		ASSERT_THAT(AreEqual(Serial.ShotsFired, Waves.ShotsFired));
+		ASSERT_THAT(AreEqual(Serial.VictimsDestroyed, Waves.VictimsDestroyed));
+
+		for (int32 Tick = 0; Tick < WaveTraceTicks; ++Tick)
+		{
+			if (Serial.Roots[Tick] != Waves.Roots[Tick])
+			{
+				AddError(FString::Printf(
+					TEXT("Serial/wave divergence at tick %d: serial root=%s, wave root=%s."),
+					Tick,
+					*Serial.Roots[Tick].ToString(EGuidFormats::Digits),
+					*Waves.Roots[Tick].ToString(EGuidFormats::Digits)));
+				return;
+			}
+		}
+	}
+}
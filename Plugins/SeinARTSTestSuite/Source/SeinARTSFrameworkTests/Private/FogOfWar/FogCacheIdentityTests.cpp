@@ -102,6 +102,27 @@ namespace UE::SeinARTSTests
 			Fog.RemoveSourceStamp(Source);
 		}
 
+		static void SeedEmptyGrid(USeinFogOfWarDefault& Fog,
+			int32 InWidth, int32 InHeight)
+		{
+			Fog.Width = InWidth;
+			Fog.Height = InHeight;
+		}
+
+		static void ApplyNormalFootprint(USeinFogOfWarDefault& Fog,
+			FSeinPlayerID Owner,
+			const TArray<int32>& OldSorted,
+			const TArray<int32>& NewSorted)
+		{
+			FSeinFogVisionGroup& Group = Fog.GetOrCreateGroup(Owner);
+			Fog.ApplyFootprintDiff(Owner, Group, 1, OldSorted, NewSorted);
+		}
+
+		static void ResetPresentationTiles(USeinFogOfWarDefault& Fog)
+		{
+			Fog.ResetPresentationTiles();
+		}
+
 		static bool HasSource(const USeinFogOfWarDefault& Fog,
 			FSeinEntityHandle Source)
 		{
@@ -223,6 +244,69 @@ namespace UE::SeinARTSTests
 				0, LayerMask);
 		}
 
+		static void SeedStampKernelGrid(
+			USeinFogOfWarDefault& Fog,
+			int32 GridSize)
+		{
+			const int32 NumCells = GridSize * GridSize;
+			Fog.Width = GridSize;
+			Fog.Height = GridSize;
+			Fog.CellSize = FFixedPoint::FromInt(100);
+			Fog.Origin = FFixedVector::ZeroVector;
+			Fog.GroundHeight.SetNumZeroed(NumCells);
+			Fog.BlockerHeight.SetNumZeroed(NumCells);
+			Fog.BlockerLayerMask.SetNumZeroed(NumCells);
+			Fog.DynamicBlockerHeight.SetNumZeroed(NumCells);
+			Fog.DynamicBlockerLayerMask.SetNumZeroed(NumCells);
+			Fog.DynamicBlockerHeightExceptions.Reset();
+			// Rolling terrain, a Normal-only wall segment, a Thermal-only
+			// blocker, and an all-layer smoke column with a per-layer
+			// exception — every occluder kind the kernels must agree on.
+			for (int32 Y = 0; Y < GridSize; ++Y)
+			{
+				for (int32 X = 0; X < GridSize; ++X)
+				{
+					const int32 Idx = Fog.CellIndex(X, Y);
+					Fog.GroundHeight[Idx] =
+						FFixedPoint::FromInt(((X * 7 + Y * 13) % 11) * 9);
+					if (X == GridSize / 2 + 3 && Y > 4 && Y < GridSize - 6)
+					{
+						Fog.BlockerHeight[Idx] = FFixedPoint::FromInt(260);
+						Fog.BlockerLayerMask[Idx] = SEIN_FOW_BIT_NORMAL;
+					}
+					if (Y == GridSize / 2 - 4 && X > 3 && X < GridSize / 2)
+					{
+						Fog.BlockerHeight[Idx] = FFixedPoint::FromInt(140);
+						Fog.BlockerLayerMask[Idx] = static_cast<uint8>(
+							ESeinFogOfWarLayerBit::N0);
+					}
+				}
+			}
+			const int32 Smoke = Fog.CellIndex(GridSize / 2 - 2, GridSize / 2 + 2);
+			Fog.DynamicBlockerHeight[Smoke] = FFixedPoint::FromInt(400);
+			Fog.DynamicBlockerLayerMask[Smoke] = static_cast<uint8>(
+				SEIN_FOW_BIT_NORMAL | static_cast<uint8>(ESeinFogOfWarLayerBit::N0));
+			FSeinFogDynamicBlockerLayerHeights& Exact =
+				Fog.DynamicBlockerHeightExceptions.Add(Smoke);
+			Exact.LayerTopZ[1] = FFixedPoint::FromInt(400);
+			Exact.LayerTopZ[2] = FFixedPoint::FromInt(50);
+		}
+
+		static void GenerateFootprint(
+			USeinFogOfWarDefault& Fog,
+			ESeinFogStampKernel Kernel,
+			const FSeinStampShape& Shape,
+			const FFixedVector& WorldPos,
+			FFixedPoint EyeHeight,
+			uint8 StampBit,
+			TArray<int32>& OutCells)
+		{
+			Fog.StampKernel = Kernel;
+			OutCells.Reset();
+			Fog.GenerateLayerFootprintCells(Shape, WorldPos,
+				FFixedQuaternion::Identity, EyeHeight, StampBit, OutCells);
+		}
+
 		static void ScaleStampRangeForTerrain(
 			FSeinStampShape& Shape,
 			FFixedPoint Multiplier)
@@ -1003,6 +1087,56 @@ namespace UE::SeinARTSTests
 			Cone.ConeAngleDegrees == FFixedPoint::FromInt(60)));
 	}
 
+	TEST(ClearanceTableStampKernelMatchesLineWalkExactly,
+		"SeinARTS.Unit.FogOfWar")
+	{
+		constexpr int32 GridSize = 40;
+		USeinFogOfWarDefault* Fog = NewObject<USeinFogOfWarDefault>();
+		ASSERT_THAT(IsNotNull(Fog));
+		FFogOfWarDefaultTestAccess::SeedStampKernelGrid(*Fog, GridSize);
+
+		FSeinStampShape Radial;
+		Radial.Shape = ESeinStampShape::Radial;
+		Radial.Radius = FFixedPoint::FromInt(1500);
+		FSeinStampShape Cone;
+		Cone.Shape = ESeinStampShape::Conical;
+		Cone.ConeLength = FFixedPoint::FromInt(1800);
+		Cone.ConeAngleDegrees = FFixedPoint::FromInt(70);
+
+		const uint8 Thermal = 2;
+		TArray<int32> Reference;
+		TArray<int32> Clearance;
+		int32 Compared = 0;
+		for (const FSeinStampShape& Shape : { Radial, Cone })
+		{
+			for (const int32 EyeHeight : { 0, 120, 600 })
+			{
+				for (const uint8 Bit : { uint8(1), Thermal })
+				{
+					for (int32 Probe = 0; Probe < 4; ++Probe)
+					{
+						const FFixedVector Pos(
+							FFixedPoint::FromInt(650 + Probe * 850),
+							FFixedPoint::FromInt(2050 - Probe * 300),
+							FFixedPoint::FromInt(Probe * 40));
+						FFogOfWarDefaultTestAccess::GenerateFootprint(*Fog,
+							ESeinFogStampKernel::LineWalk, Shape, Pos,
+							FFixedPoint::FromInt(EyeHeight), Bit, Reference);
+						FFogOfWarDefaultTestAccess::GenerateFootprint(*Fog,
+							ESeinFogStampKernel::ClearanceTable, Shape, Pos,
+							FFixedPoint::FromInt(EyeHeight), Bit, Clearance);
+						// Same cells in the same (unsorted) order, not merely
+						// the same set.
+						ASSERT_THAT(IsTrue(Reference.Num() > 1));
+						ASSERT_THAT(IsTrue(Reference == Clearance));
+						++Compared;
+					}
+				}
+			}
+		}
+		ASSERT_THAT(AreEqual(48, Compared));
+	}
+
 	TEST(SameDimensionGridReloadClearsDynamicOverlay, "SeinARTS.Unit.FogOfWar")
 	{
 		constexpr int32 Width = 2;
@@ -1092,6 +1226,58 @@ namespace UE::SeinARTSTests
 		ASSERT_THAT(IsTrue((CellBits & SEIN_FOW_BIT_EXPLORED) != 0));
 	}
 
+	TEST(PresentationJournalReportsOnlyFlippedTiles, "SeinARTS.Unit.FogOfWar")
+	{
+		USeinFogOfWarDefault* Fog = NewObject<USeinFogOfWarDefault>();
+		ASSERT_THAT(IsNotNull(Fog));
+
+		// 70x40 cells -> 3x2 journal tiles; cell (65, 33) lives in tile 5.
+		FFogOfWarDefaultTestAccess::SeedEmptyGrid(*Fog, 70, 40);
+		const FSeinPlayerID Owner(1);
+		const FSeinPlayerID Other(2);
+		const TArray<int32> NoCells;
+		const TArray<int32> Footprint = { 33 * 70 + 65 };
+		TBitArray<> Tiles;
+		uint32 Revision = 0;
+
+		// A reader without a revision has to read the whole grid once.
+		ASSERT_THAT(IsFalse(Fog->GetObserverDirtyTiles(Owner, 0, Tiles, Revision)));
+		uint32 Since = Revision;
+
+		FFogOfWarDefaultTestAccess::ApplyNormalFootprint(
+			*Fog, Owner, NoCells, Footprint);
+		ASSERT_THAT(IsTrue(Fog->GetObserverDirtyTiles(Owner, Since, Tiles, Revision)));
+		ASSERT_THAT(AreEqual(6, Tiles.Num()));
+		ASSERT_THAT(AreEqual(1, Tiles.CountSetBits()));
+		ASSERT_THAT(IsTrue(static_cast<bool>(Tiles[5])));
+		ASSERT_THAT(IsTrue(Fog->GetObserverDirtyTiles(Other, Since, Tiles, Revision)));
+		ASSERT_THAT(AreEqual(0, Tiles.CountSetBits()));
+		Since = Revision;
+
+		// A second source over the same cell only moves its refcount.
+		FFogOfWarDefaultTestAccess::ApplyNormalFootprint(
+			*Fog, Owner, NoCells, Footprint);
+		FFogOfWarDefaultTestAccess::ApplyNormalFootprint(
+			*Fog, Owner, Footprint, NoCells);
+		ASSERT_THAT(IsTrue(Fog->GetObserverDirtyTiles(Owner, Since, Tiles, Revision)));
+		ASSERT_THAT(AreEqual(0, Tiles.CountSetBits()));
+		Since = Revision;
+
+		// The last source leaving clears the bit and marks the tile again.
+		FFogOfWarDefaultTestAccess::ApplyNormalFootprint(
+			*Fog, Owner, Footprint, NoCells);
+		ASSERT_THAT(IsTrue(Fog->GetObserverDirtyTiles(Owner, Since, Tiles, Revision)));
+		ASSERT_THAT(AreEqual(1, Tiles.CountSetBits()));
+		ASSERT_THAT(IsTrue(static_cast<bool>(Tiles[5])));
+		Since = Revision;
+
+		// A grid reload or restore invalidates every outstanding revision.
+		FFogOfWarDefaultTestAccess::ResetPresentationTiles(*Fog);
+		ASSERT_THAT(IsFalse(Fog->GetObserverDirtyTiles(Owner, Since, Tiles, Revision)));
+		ASSERT_THAT(IsTrue(Fog->GetObserverDirtyTiles(Owner, Revision, Tiles, Revision)));
+		ASSERT_THAT(AreEqual(0, Tiles.CountSetBits()));
+	}
+
 	TEST(DefaultFogCanonicalStateRoundTripsDerivedCachesAndCadence,
 		"SeinARTS.Determinism.FogOfWar.CanonicalState")
 	{
@@ -0,0 +1,83 @@
+#include "CQTest.h"
+
+#include "ConvexVolume.h"
+#include "HUD/SeinHUD.h"
+
+namespace UE::SeinARTSTests
+{
+	namespace ScreenRectVolumeTestLocal
+	{
+		// An 800x600 canvas looking down +X, with +Y right and +Z up.
+		constexpr double HalfWidth = 400.0;
+		constexpr double HalfHeight = 300.0;
+		constexpr double FocalLength = 400.0;
+
+		bool DeprojectPerspective(const FVector2D& Point,
+			FVector& OutOrigin, FVector& OutDirection)
+		{
+			OutOrigin = FVector::ZeroVector;
+			OutDirection = FVector(FocalLength,
+				Point.X - HalfWidth, HalfHeight - Point.Y).GetSafeNormal();
+			return true;
+		}
+
+		bool DeprojectOrtho(const FVector2D& Point,
+			FVector& OutOrigin, FVector& OutDirection)
+		{
+			OutOrigin = FVector(0.0, Point.X - HalfWidth, HalfHeight - Point.Y);
+			OutDirection = FVector(1.0, 0.0, 0.0);
+			return true;
+		}
+
+		/** The centred 200x200 rect. */
+		const FBox2D CentreRect(FVector2D(300.0, 200.0), FVector2D(500.0, 400.0));
+	}
+
+	TEST(ScreenRectVolumeIsThePyramidBehindThePerspectiveRect,
+		"SeinARTS.Unit.Framework.ScreenRectVolume")
+	{
+		using namespace ScreenRectVolumeTestLocal;
+		FConvexVolume Volume;
+		ASSERT_THAT(IsTrue(ASeinHUD::BuildScreenRectVolume(
+			CentreRect, DeprojectPerspective, Volume)));
+		ASSERT_THAT(AreEqual(4, Volume.Planes.Num()));
+
+		// At depth 1000 the rect spans +-250 in Y and Z.
+		ASSERT_THAT(IsTrue(Volume.IntersectSphere(FVector(1000.0, 0.0, 0.0), 1.0)));
+		ASSERT_THAT(IsTrue(Volume.IntersectSphere(FVector(1000.0, 240.0, -240.0), 1.0)));
+		ASSERT_THAT(IsFalse(Volume.IntersectSphere(FVector(1000.0, 400.0, 0.0), 1.0)));
+		ASSERT_THAT(IsFalse(Volume.IntersectSphere(FVector(1000.0, 0.0, -400.0), 1.0)));
+		// A sphere outside the rect still counts once its radius reaches in.
+		ASSERT_THAT(IsTrue(Volume.IntersectSphere(FVector(1000.0, 400.0, 0.0), 200.0)));
+		// The pyramid is one-sided: nothing behind the camera.
+		ASSERT_THAT(IsFalse(Volume.IntersectSphere(FVector(-1000.0, 0.0, 0.0), 1.0)));
+	}
+
+	TEST(ScreenRectVolumeIsTheSlabBehindTheOrthoRect,
+		"SeinARTS.Unit.Framework.ScreenRectVolume")
+	{
+		using namespace ScreenRectVolumeTestLocal;
+		FConvexVolume Volume;
+		ASSERT_THAT(IsTrue(ASeinHUD::BuildScreenRectVolume(
+			CentreRect, DeprojectOrtho, Volume)));
+
+		ASSERT_THAT(IsTrue(Volume.IntersectSphere(FVector(10.0, 90.0, 90.0), 1.0)));
+		ASSERT_THAT(IsTrue(Volume.IntersectSphere(FVector(50000.0, -90.0, 0.0), 1.0)));
+		ASSERT_THAT(IsFalse(Volume.IntersectSphere(FVector(5000.0, 150.0, 0.0), 1.0)));
+		ASSERT_THAT(IsFalse(Volume.IntersectSphere(FVector(5000.0, 0.0, 150.0), 1.0)));
+	}
+
+	TEST(ScreenRectVolumeRejectsDegenerateRectsAndBlindViews,
+		"SeinARTS.Unit.Framework.ScreenRectVolume")
+	{
+		using namespace ScreenRectVolumeTestLocal;
+		FConvexVolume Volume;
+		const FBox2D Line(FVector2D(300.0, 200.0), FVector2D(300.0, 400.0));
+		ASSERT_THAT(IsFalse(ASeinHUD::BuildScreenRectVolume(
+			Line, DeprojectPerspective, Volume)));
+		ASSERT_THAT(IsFalse(ASeinHUD::BuildScreenRectVolume(
+			CentreRect,
+			[](const FVector2D&, FVector&, FVector&) { return false; },
+			Volume)));
+	}
+}
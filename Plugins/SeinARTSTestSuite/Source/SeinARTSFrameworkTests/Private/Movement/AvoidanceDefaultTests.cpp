@@ -185,6 +185,85 @@ namespace
 				FFixedPoint::FromInt(-1000), FFixedPoint::Zero,
 				FFixedPoint::Zero));
 	}
+
+	/** Two opposed columns crossing head-on plus a pair of idlers, so the
+	 *  gather fills several neighbour lists of different lengths. */
+	void AuthorCrossingCrowd(FAvoidanceFixture& Fixture)
+	{
+		for (int32 Row = 0; Row < 4; ++Row)
+		{
+			const FFixedPoint Y = FFixedPoint::FromInt(90 * Row);
+			for (const int32 Side : {-1, 1})
+			{
+				Fixture.AddMover(
+					FFixedVector(
+						FFixedPoint::FromInt(-80 * Side), Y,
+						FFixedPoint::Zero),
+					FFixedVector(
+						FFixedPoint::FromInt(100 * Side), FFixedPoint::Zero,
+						FFixedPoint::Zero),
+					FFixedVector(
+						FFixedPoint::FromInt(1000 * Side), Y,
+						FFixedPoint::Zero));
+			}
+		}
+		for (const int32 Side : {-1, 1})
+		{
+			Fixture.AddMover(
+				FFixedVector(
+					FFixedPoint::Zero, FFixedPoint::FromInt(135 + 45 * Side),
+					FFixedPoint::Zero),
+				FFixedVector::ZeroVector,
+				FFixedVector::ZeroVector,
+				false);
+		}
+	}
+
+	/** Same change in every fixture: the crowd grows, then half of it opts
+	 *  out, then it spreads, so the per-tick arrays grow and shrink. */
+	void PerturbCrossingCrowd(FAvoidanceFixture& Fixture, int32 Round)
+	{
+		auto SimScope = FSeinSimContextTestAccess::Enter(*Fixture.World);
+		if (Round == 0)
+		{
+			for (int32 Index = 0; Index < 4; ++Index)
+			{
+				Fixture.AddMover(
+					FFixedVector(
+						FFixedPoint::FromInt(40 * Index),
+						FFixedPoint::FromInt(-60),
+						FFixedPoint::Zero),
+					FFixedVector(
+						FFixedPoint::Zero, FFixedPoint::FromInt(100),
+						FFixedPoint::Zero),
+					FFixedVector(
+						FFixedPoint::FromInt(40 * Index),
+						FFixedPoint::FromInt(1000),
+						FFixedPoint::Zero));
+			}
+			return;
+		}
+		for (int32 Index = 0; Index < Fixture.Movers.Num(); ++Index)
+		{
+			FSeinMovementComponent* Movement =
+				Fixture.World->GetComponentMutable<FSeinMovementComponent>(
+					Fixture.Movers[Index]);
+			FSeinEntity* Entity =
+				Fixture.World->GetEntityMutable(Fixture.Movers[Index]);
+			check(Movement && Entity);
+			if (Round == 1 && Index % 2 == 0)
+			{
+				Movement->AvoidanceStrength = FFixedPoint::Zero;
+			}
+			else if (Round == 2)
+			{
+				Movement->AvoidanceStrength = FFixedPoint::One;
+				FFixedVector Location = Entity->Transform.GetLocation();
+				Location.Y = Location.Y * FFixedPoint::FromInt(3);
+				Entity->Transform.SetLocation(Location);
+			}
+		}
+	}
 }
 
 namespace UE::SeinARTSTests
@@ -547,4 +626,58 @@ namespace UE::SeinARTSTests
 				FFixedPoint::FromInt(200), FFixedPoint::FromInt(50),
 				FFixedPoint::Zero)));
 	}
+
+	TEST(RetainedKernelScratchMatchesAFreshKernelEveryTick,
+		"SeinARTS.Unit.Movement.Avoidance")
+	{
+		FScopedIdleReseekSetting IdleReseek(true);
+		FScopedParallelMode ParallelMode;
+		ASSERT_THAT(IsTrue(ParallelMode.Set(true)));
+
+		// Retained keeps one policy, so its kernel reuses last tick's
+		// workspace; Fresh gets a new policy per tick, which is the path
+		// before the workspace was retained.
+		FAvoidanceFixture Retained;
+		FAvoidanceFixture Fresh;
+		ASSERT_THAT(IsTrue(Retained.Initialize(AuthorCrossingCrowd)));
+		ASSERT_THAT(IsTrue(Fresh.Initialize(AuthorCrossingCrowd)));
+		// Running, so the crowd can grow between rounds.
+		ASSERT_THAT(IsTrue(SeinTestMatchBootstrap::Start(*Retained.World)));
+		ASSERT_THAT(IsTrue(SeinTestMatchBootstrap::Start(*Fresh.World)));
+
+		bool bAnySteer = false;
+		for (int32 Round = 0; Round < 4; ++Round)
+		{
+			ASSERT_THAT(IsTrue(Retained.Compute()));
+			Fresh.Avoidance = NewObject<USeinAvoidanceDefault>(Fresh.World);
+			ASSERT_THAT(IsTrue(Fresh.Compute()));
+
+			ASSERT_THAT(AreEqual(Retained.Movers.Num(), Fresh.Movers.Num()));
+			for (int32 Index = 0; Index < Retained.Movers.Num(); ++Index)
+			{
+				const FSeinMovementComponent* RetainedMove =
+					Retained.World->GetComponent<FSeinMovementComponent>(
+						Retained.Movers[Index]);
+				const FSeinMovementComponent* FreshMove =
+					Fresh.World->GetComponent<FSeinMovementComponent>(
+						Fresh.Movers[Index]);
+				ASSERT_THAT(IsNotNull(RetainedMove));
+				ASSERT_THAT(IsNotNull(FreshMove));
+				ASSERT_THAT(IsTrue(
+					RetainedMove->AvoidanceOutput.SteerDir
+						== FreshMove->AvoidanceOutput.SteerDir));
+				ASSERT_THAT(IsTrue(
+					RetainedMove->AvoidanceOutput.SpeedScale
+						== FreshMove->AvoidanceOutput.SpeedScale));
+				bAnySteer |= RetainedMove->AvoidanceOutput.SteerDir
+					!= FFixedVector::ZeroVector;
+			}
+
+			PerturbCrossingCrowd(Retained, Round);
+			PerturbCrossingCrowd(Fresh, Round);
+		}
+		ASSERT_THAT(IsTrue(bAnySteer));
+		Retained.World->StopSimulation();
+		Fresh.World->StopSimulation();
+	}
 }
@@ -52,6 +52,60 @@ namespace UE::SeinARTSTests
 			return Nav.ReachabilityProfileCache.Num();
 		}
 
+		static TArray<int32> StampedHierarchicalClusters(
+			const USeinNavigationAStar& Nav)
+		{
+			TArray<int32> Clusters = Nav.Hierarchy.StampedClusters;
+			Clusters.Sort();
+			return Clusters;
+		}
+
+		static int32 HierarchicalClusterOf(
+			const USeinNavigationAStar& Nav,
+			int32 X,
+			int32 Y)
+		{
+			return Nav.HierarchicalClusterOf(Nav.CellIndex(X, Y));
+		}
+
+		/** Runs the hierarchical stage alone on the serial scratch, as left
+		 *  prepared by the last FindPath for the same request. */
+		static bool HierarchicalAttemptCompletes(
+			const USeinNavigationAStar& Nav,
+			const FSeinPathRequest& Request,
+			FIntPoint Start,
+			FIntPoint End,
+			int32 Budget)
+		{
+			return Nav.FindHierarchicalCellPath(
+				Start,
+				End,
+				Request.AgentNavLayerMask,
+				Nav.AStarHeuristicWeightPercent,
+				Budget,
+				Nav.ComputeRequiredClearance(
+					Request.AgentFootprintRadius,
+					Request.AgentWallPaddingCells),
+				Nav.MainScratch);
+		}
+
+		static int32 FlowFieldCacheSize(const USeinNavigationAStar& Nav)
+		{
+			return Nav.FlowFieldCache.Num();
+		}
+
+		static int32 FlowFieldRequesterCount(
+			const USeinNavigationAStar& Nav,
+			int32 Index)
+		{
+			return Nav.FlowFieldCache[Index]->Requesters.Num();
+		}
+
+		static void ResetFlowFieldCache(USeinNavigationAStar& Nav)
+		{
+			Nav.FlowFieldCache.Reset();
+		}
+
 		static FStaticGridSnapshot CaptureStaticGrid(
 			const USeinNavigationAStar& Nav)
 		{
@@ -174,6 +228,22 @@ namespace UE::SeinARTSTests
 			}
 		}
 
+		/** 96x96 open grid split by a wall at column 48 with a four-cell gap
+		 *  at rows 80..83, so a straight west→east order has to detour far
+		 *  past the flat search's local budget. */
+		void ConfigureWalledNavGrid(USeinLevelDataTestDouble& LevelData)
+		{
+			const FIntPoint Dimensions(96, 96);
+			ConfigureOpenConnectedNavGrid(LevelData, Dimensions);
+			TArray<uint8>& Channel =
+				LevelData.LayerChannels.FindChecked(TEXT("Nav"));
+			for (int32 Y = 0; Y < Dimensions.Y; ++Y)
+			{
+				if (Y >= 80 && Y <= 83) continue;
+				Channel[Y * Dimensions.X + 48] = 0;
+			}
+		}
+
 		FFixedVector CellCenter(int32 X, int32 Y)
 		{
 			return FFixedVector(
@@ -736,4 +806,317 @@ namespace UE::SeinARTSTests
 		ASSERT_THAT(IsTrue(Path.Waypoints.Last()
 			!= Request.End));
 	}
+
+	TEST(HierarchicalSearchCompletesLongPathsWithinLocalBudget,
+		"SeinARTS.Unit.Navigation")
+	{
+		USeinNavigationAStar* Nav =
+			NewObject<USeinNavigationAStar>();
+		USeinLevelDataTestDouble* LevelData =
+			NewObject<USeinLevelDataTestDouble>();
+		ASSERT_THAT(IsNotNull(Nav));
+		ASSERT_THAT(IsNotNull(LevelData));
+		ConfigureWalledNavGrid(*LevelData);
+		ASSERT_THAT(IsTrue(
+			Nav->LoadFromSubstrate(*LevelData).IsAdopted()));
+
+		FSeinPathRequest Request;
+		Request.Start = CellCenter(5, 5);
+		Request.End = CellCenter(90, 5);
+		Request.AgentMaxSearchNodes = 600;
+
+		FSeinPath Hierarchical;
+		ASSERT_THAT(IsTrue(Nav->FindPath(Request, Hierarchical)));
+		ASSERT_THAT(IsFalse(Hierarchical.bIsPartial));
+		ASSERT_THAT(IsTrue(
+			Hierarchical.Waypoints.Last() == Request.End));
+
+		FSeinPath Repeat;
+		ASSERT_THAT(IsTrue(Nav->FindPath(Request, Repeat)));
+		ASSERT_THAT(IsTrue(
+			Repeat.Waypoints == Hierarchical.Waypoints));
+
+		Nav->bHierarchicalPathfinding = false;
+		FSeinPath Flat;
+		ASSERT_THAT(IsTrue(Nav->FindPath(Request, Flat)));
+		ASSERT_THAT(IsTrue(Flat.bIsPartial));
+	}
+
+	TEST(FailedHierarchicalAttemptLeavesFlatFallbackItsFullBudget,
+		"SeinARTS.Unit.Navigation")
+	{
+		USeinNavigationAStar* Nav =
+			NewObject<USeinNavigationAStar>();
+		USeinLevelDataTestDouble* LevelData =
+			NewObject<USeinLevelDataTestDouble>();
+		ASSERT_THAT(IsNotNull(Nav));
+		ASSERT_THAT(IsNotNull(LevelData));
+		ConfigureOpenConnectedNavGrid(*LevelData, FIntPoint(96, 96));
+		ASSERT_THAT(IsTrue(
+			Nav->LoadFromSubstrate(*LevelData).IsAdopted()));
+
+		// Smallest budget the flat search needs for this straight order.
+		FSeinPathRequest Request;
+		Request.Start = CellCenter(5, 5);
+		Request.End = CellCenter(60, 5);
+		Nav->bHierarchicalPathfinding = false;
+		FSeinPath Flat;
+		int32 FlatBudget = 1;
+		for (; FlatBudget <= Nav->AStarMaxIterations; ++FlatBudget)
+		{
+			Request.AgentMaxSearchNodes = FlatBudget;
+			ASSERT_THAT(IsTrue(Nav->FindPath(Request, Flat)));
+			if (!Flat.bIsPartial) break;
+		}
+		ASSERT_THAT(IsFalse(Flat.bIsPartial));
+
+		// The hierarchical attempt cannot finish its refinement on that
+		// budget, so the request has to fall back.
+		Nav->bHierarchicalPathfinding = true;
+		ASSERT_THAT(IsFalse(
+			FNavigationAStarTestAccess::HierarchicalAttemptCompletes(
+				*Nav, Request, FIntPoint(5, 5), FIntPoint(60, 5),
+				FlatBudget)));
+
+		// The fallback still gets the whole budget and completes the path
+		// exactly as the flat-only search does.
+		FSeinPath Fallback;
+		ASSERT_THAT(IsTrue(Nav->FindPath(Request, Fallback)));
+		ASSERT_THAT(IsFalse(Fallback.bIsPartial));
+		ASSERT_THAT(IsTrue(Fallback.Waypoints == Flat.Waypoints));
+	}
+
+	TEST(DynamicBlockersOnlyRestampTheirHierarchicalClusters,
+		"SeinARTS.Unit.Navigation")
+	{
+		USeinNavigationAStar* Nav =
+			NewObject<USeinNavigationAStar>();
+		USeinLevelDataTestDouble* LevelData =
+			NewObject<USeinLevelDataTestDouble>();
+		ASSERT_THAT(IsNotNull(Nav));
+		ASSERT_THAT(IsNotNull(LevelData));
+		ConfigureWalledNavGrid(*LevelData);
+		ASSERT_THAT(IsTrue(
+			Nav->LoadFromSubstrate(*LevelData).IsAdopted()));
+		ASSERT_THAT(IsTrue(
+			FNavigationAStarTestAccess::StampedHierarchicalClusters(
+				*Nav).IsEmpty()));
+
+		FSeinDynamicBlocker GapSeal;
+		GapSeal.Owner = FSeinEntityHandle(21, 1);
+		GapSeal.EntityCenter = CellCenter(48, 81);
+		GapSeal.EntityRotation = FFixedQuaternion::Identity;
+		GapSeal.Shape.Shape = ESeinStampShape::Rect;
+		GapSeal.Shape.HalfExtentX = FFixedPoint::FromInt(150);
+		GapSeal.Shape.HalfExtentY = FFixedPoint::FromInt(300);
+		GapSeal.BlockedNavLayerMask = 0x01;
+		FNavigationAStarTestAccess::InstallDynamicBlockers(
+			*Nav, { GapSeal });
+
+		TArray<int32> ExpectedClusters;
+		SeinStampUtils::ForEachCoveredCell(
+			GapSeal.Shape,
+			GapSeal.EntityCenter,
+			GapSeal.EntityRotation,
+			FFixedPoint::FromInt(100),
+			FFixedVector::ZeroVector,
+			96,
+			96,
+			[&](int32 X, int32 Y)
+			{
+				ExpectedClusters.AddUnique(
+					FNavigationAStarTestAccess::HierarchicalClusterOf(
+						*Nav, X, Y));
+			});
+		ExpectedClusters.Sort();
+		ASSERT_THAT(IsFalse(ExpectedClusters.IsEmpty()));
+		ASSERT_THAT(IsTrue(
+			FNavigationAStarTestAccess::StampedHierarchicalClusters(
+				*Nav) == ExpectedClusters));
+
+		// Sealed for this layer: the abstract route has no open portal, so
+		// the request falls back to the flat search's exact partial answer.
+		FSeinPathRequest Sealed;
+		Sealed.Start = CellCenter(5, 5);
+		Sealed.End = CellCenter(90, 5);
+		Sealed.AgentNavLayerMask = 0x01;
+		FSeinPath SealedHierarchical;
+		ASSERT_THAT(IsTrue(Nav->FindPath(Sealed, SealedHierarchical)));
+		ASSERT_THAT(IsTrue(SealedHierarchical.bIsPartial));
+		Nav->bHierarchicalPathfinding = false;
+		FSeinPath SealedFlat;
+		ASSERT_THAT(IsTrue(Nav->FindPath(Sealed, SealedFlat)));
+		Nav->bHierarchicalPathfinding = true;
+		ASSERT_THAT(IsTrue(
+			SealedFlat.Waypoints == SealedHierarchical.Waypoints));
+
+		// Another layer ignores the stamp and keeps the cached route.
+		FSeinPathRequest OtherLayer = Sealed;
+		OtherLayer.AgentNavLayerMask = 0x02;
+		OtherLayer.AgentMaxSearchNodes = 600;
+		FSeinPath OtherPath;
+		ASSERT_THAT(IsTrue(Nav->FindPath(OtherLayer, OtherPath)));
+		ASSERT_THAT(IsFalse(OtherPath.bIsPartial));
+
+		FNavigationAStarTestAccess::InstallDynamicBlockers(*Nav, {});
+		ASSERT_THAT(IsTrue(
+			FNavigationAStarTestAccess::StampedHierarchicalClusters(
+				*Nav).IsEmpty()));
+	}
+
+	TEST(GroupOrdersShareOneReferenceCountedFlowField,
+		"SeinARTS.Unit.Navigation")
+	{
+		USeinNavigationAStar* Nav =
+			NewObject<USeinNavigationAStar>();
+		USeinLevelDataTestDouble* LevelData =
+			NewObject<USeinLevelDataTestDouble>();
+		ASSERT_THAT(IsNotNull(Nav));
+		ASSERT_THAT(IsNotNull(LevelData));
+		ConfigureWalledNavGrid(*LevelData);
+		ASSERT_THAT(IsTrue(
+			Nav->LoadFromSubstrate(*LevelData).IsAdopted()));
+
+		TArray<FSeinPathRequest> Members;
+		for (int32 Index = 0; Index < 3; ++Index)
+		{
+			FSeinPathRequest Member;
+			Member.Start = CellCenter(5, 5 + 10 * Index);
+			Member.End = CellCenter(90, 5);
+			Member.Requester = FSeinEntityHandle(40 + Index, 1);
+			Member.GroupId = 7;
+			Members.Add(Member);
+		}
+
+		TArray<FSeinPath> Shared;
+		Nav->RunPathBatch(Members, Shared);
+		ASSERT_THAT(AreEqual(1,
+			FNavigationAStarTestAccess::FlowFieldCacheSize(*Nav)));
+		ASSERT_THAT(AreEqual(3,
+			FNavigationAStarTestAccess::FlowFieldRequesterCount(*Nav, 0)));
+		for (int32 Index = 0; Index < Members.Num(); ++Index)
+		{
+			ASSERT_THAT(IsFalse(Shared[Index].bIsPartial));
+			ASSERT_THAT(IsTrue(
+				Shared[Index].Waypoints.Last() == Members[Index].End));
+		}
+
+		// A cold cache grown for one member alone answers identically, so
+		// eviction and snapshot restores can never change a group's routes.
+		FNavigationAStarTestAccess::ResetFlowFieldCache(*Nav);
+		FSeinPath Cold;
+		ASSERT_THAT(IsTrue(Nav->FindPath(Members[2], Cold)));
+		ASSERT_THAT(IsTrue(Cold.Waypoints == Shared[2].Waypoints));
+		ASSERT_THAT(AreEqual(1,
+			FNavigationAStarTestAccess::FlowFieldRequesterCount(*Nav, 0)));
+
+		Nav->ReleasePathRequester(Members[2].Requester);
+		ASSERT_THAT(AreEqual(0,
+			FNavigationAStarTestAccess::FlowFieldRequesterCount(*Nav, 0)));
+
+		// A lone order never touches the shared cache.
+		FSeinPathRequest Lone = Members[0];
+		Lone.GroupId = 0;
+		FNavigationAStarTestAccess::ResetFlowFieldCache(*Nav);
+		FSeinPath LonePath;
+		ASSERT_THAT(IsTrue(Nav->FindPath(Lone, LonePath)));
+		ASSERT_THAT(AreEqual(0,
+			FNavigationAStarTestAccess::FlowFieldCacheSize(*Nav)));
+	}
+
+	TEST(CappedFlowFieldGrowthPlansAloneLikeALoneOrder,
+		"SeinARTS.Unit.Navigation")
+	{
+		USeinNavigationAStar* Nav =
+			NewObject<USeinNavigationAStar>();
+		USeinLevelDataTestDouble* LevelData =
+			NewObject<USeinLevelDataTestDouble>();
+		ASSERT_THAT(IsNotNull(Nav));
+		ASSERT_THAT(IsNotNull(LevelData));
+		ConfigureWalledNavGrid(*LevelData);
+		ASSERT_THAT(IsTrue(
+			Nav->LoadFromSubstrate(*LevelData).IsAdopted()));
+		// Far fewer cells than the detour through the wall gap settles.
+		Nav->AStarMaxIterations = 300;
+
+		FSeinPathRequest Near;
+		Near.Start = CellCenter(88, 5);
+		Near.End = CellCenter(90, 5);
+		Near.Requester = FSeinEntityHandle(50, 1);
+		Near.GroupId = 9;
+		FSeinPathRequest Far = Near;
+		Far.Start = CellCenter(5, 5);
+		Far.Requester = FSeinEntityHandle(51, 1);
+
+		// Near settles inside the cap; Far never does, however the calls
+		// interleave, and gets exactly the lone planner's answer.
+		TArray<FSeinPath> Grouped;
+		Nav->RunPathBatch({Near, Far}, Grouped);
+		ASSERT_THAT(IsFalse(Grouped[0].bIsPartial));
+		ASSERT_THAT(IsTrue(Grouped[0].Waypoints.Last() == Near.End));
+
+		FSeinPathRequest Lone = Far;
+		Lone.GroupId = 0;
+		FSeinPath LonePath;
+		Nav->FindPath(Lone, LonePath);
+		ASSERT_THAT(IsTrue(Grouped[1].bIsPartial == LonePath.bIsPartial));
+		ASSERT_THAT(IsTrue(Grouped[1].Waypoints == LonePath.Waypoints));
+
+		FSeinPath Repeat;
+		Nav->FindPath(Far, Repeat);
+		ASSERT_THAT(IsTrue(Repeat.Waypoints == LonePath.Waypoints));
+	}
+
+	TEST(DirectionQueriesReadTheFlowFieldCacheWithoutGrowingIt,
+		"SeinARTS.Unit.Navigation")
+	{
+		USeinNavigationAStar* Nav =
+			NewObject<USeinNavigationAStar>();
+		USeinLevelDataTestDouble* LevelData =
+			NewObject<USeinLevelDataTestDouble>();
+		ASSERT_THAT(IsNotNull(Nav));
+		ASSERT_THAT(IsNotNull(LevelData));
+		ConfigureWalledNavGrid(*LevelData);
+		ASSERT_THAT(IsTrue(
+			Nav->LoadFromSubstrate(*LevelData).IsAdopted()));
+
+		FSeinDirectionQuery Query;
+		Query.From = CellCenter(5, 5);
+		Query.Goal = CellCenter(90, 5);
+		Query.Requester = FSeinEntityHandle(60, 1);
+		Query.GroupId = 11;
+
+		const FFixedVector Cold = Nav->QueryDirection(Query);
+		ASSERT_THAT(IsFalse(Cold == FFixedVector::ZeroVector));
+		ASSERT_THAT(AreEqual(0,
+			FNavigationAStarTestAccess::FlowFieldCacheSize(*Nav)));
+
+		Nav->PrepareDirectionQuery(Query);
+		ASSERT_THAT(AreEqual(1,
+			FNavigationAStarTestAccess::FlowFieldCacheSize(*Nav)));
+		ASSERT_THAT(AreEqual(1,
+			FNavigationAStarTestAccess::FlowFieldRequesterCount(*Nav, 0)));
+
+		// The prepared answer is the group route's first heading.
+		FSeinPathRequest Route;
+		Route.Start = Query.From;
+		Route.End = Query.Goal;
+		Route.Requester = Query.Requester;
+		Route.GroupId = Query.GroupId;
+		FSeinPath Path;
+		ASSERT_THAT(IsTrue(Nav->FindCellPath(Route, Path)));
+		ASSERT_THAT(IsTrue(Path.Waypoints.Num() >= 2));
+		FFixedVector Heading = Path.Waypoints[1] - Query.From;
+		Heading.Z = FFixedPoint::Zero;
+		ASSERT_THAT(IsTrue(Nav->QueryDirection(Query)
+			== FFixedVector::GetSafeNormal(Heading)));
+
+		// Querying another group's goal still leaves the cache alone.
+		FSeinDirectionQuery Other = Query;
+		Other.Goal = CellCenter(90, 90);
+		Other.GroupId = 12;
+		Nav->QueryDirection(Other);
+		ASSERT_THAT(AreEqual(1,
+			FNavigationAStarTestAccess::FlowFieldCacheSize(*Nav)));
+	}
 }
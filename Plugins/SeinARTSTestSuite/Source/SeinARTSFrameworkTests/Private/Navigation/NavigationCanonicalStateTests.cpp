@@ -1013,6 +1013,28 @@ namespace UE::SeinARTSTests
 			SavedMaxIterations;
 		ASSERT_THAT(IsTrue(
 			MaxIterationsDigest != Baseline));
+
+		Navigation->bHierarchicalPathfinding =
+			!Navigation->bHierarchicalPathfinding;
+		FGuid HierarchicalDigest;
+		ASSERT_THAT(IsTrue(
+			Navigation->ComputeStaticEnvironmentDigest(
+				HierarchicalDigest, Error)));
+		Navigation->bHierarchicalPathfinding =
+			!Navigation->bHierarchicalPathfinding;
+		ASSERT_THAT(IsTrue(
+			HierarchicalDigest != Baseline));
+
+		Navigation->bSharedFlowFields =
+			!Navigation->bSharedFlowFields;
+		FGuid FlowFieldDigest;
+		ASSERT_THAT(IsTrue(
+			Navigation->ComputeStaticEnvironmentDigest(
+				FlowFieldDigest, Error)));
+		Navigation->bSharedFlowFields =
+			!Navigation->bSharedFlowFields;
+		ASSERT_THAT(IsTrue(
+			FlowFieldDigest != Baseline));
 	}
 
 	TEST(CustomNavigationWithoutStaticCoverageFailsClosed,
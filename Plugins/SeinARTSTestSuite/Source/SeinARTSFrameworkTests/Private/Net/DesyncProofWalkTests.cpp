@@ -0,0 +1,215 @@
+#include "CQTest.h"
+#include "Components/ActorTestSpawner.h"
+
+#include "SeinDesyncProof.h"
+#include "Serialization/SeinCanonicalStateProof.h"
+#include "Simulation/SeinTestMatchBootstrap.h"
+#include "Simulation/SeinTestSimContext.h"
+#include "Simulation/SeinWorldSubsystem.h"
+
+struct FSeinWorldSubsystemTestAccess
+{
+	static bool SealRoutineRoot(
+		USeinWorldSubsystem& World,
+		bool bForceFullRebuild,
+		FGuid& OutRoot,
+		FString& OutError)
+	{
+		return World.SealRoutineCanonicalStateRoot(
+			World.GetCurrentTick(),
+			bForceFullRebuild,
+			OutRoot,
+			OutError);
+	}
+
+	static bool CaptureProofImage(
+		const USeinWorldSubsystem& World,
+		FSeinCanonicalStateProofImage& OutImage,
+		FString& OutError)
+	{
+		return World.CaptureCanonicalStateProofImage(
+			World.GetCurrentTick(), nullptr, OutImage, OutError);
+	}
+
+	static bool DescribeProofLeaf(
+		const USeinWorldSubsystem& World,
+		const FSeinCanonicalStateProofImage& Image,
+		FStringView SectionId,
+		int32 LeafIndex,
+		FSeinCanonicalStateProofLeaf& OutLeaf,
+		FString& OutError)
+	{
+		return World.DescribeCanonicalStateProofLeaf(
+			Image, SectionId, LeafIndex, OutLeaf, OutError);
+	}
+};
+
+namespace UE::SeinARTSTests
+{
+	namespace DesyncProofWalkTestLocal
+	{
+		bool StartProofWorld(USeinWorldSubsystem& World, FString& OutError)
+		{
+			return SeinTestMatchBootstrap::Materialize(
+				World,
+				FSeinMatchSettings(),
+				0x44505257,
+				TEXT("DesyncProof.Walk"),
+				&OutError)
+				&& SeinTestMatchBootstrap::Start(World, &OutError);
+		}
+
+		/** Same spawns in every world, so slot numbering lines up. */
+		TArray<FSeinEntityHandle> SpawnRow(USeinWorldSubsystem& World)
+		{
+			auto SimScope = FSeinSimContextTestAccess::Enter(World);
+			TArray<FSeinEntityHandle> Handles;
+			for (int32 Index = 0; Index < 5; ++Index)
+			{
+				FFixedTransform Transform;
+				Transform.SetLocation(FFixedVector(
+					FFixedPoint::FromInt(100 * Index),
+					FFixedPoint::Zero,
+					FFixedPoint::Zero));
+				Handles.Add(World.SpawnAbstractEntity(
+					Transform, FSeinPlayerID::Neutral()));
+			}
+			return Handles;
+		}
+
+		void AnswerFrom(
+			const USeinWorldSubsystem& World,
+			const FSeinCanonicalStateProofImage& Image,
+			const FSeinDesyncProofQuery& Query,
+			FSeinDesyncProofResponse& OutResponse)
+		{
+			FSeinDesyncProofWalk::Answer(
+				Image,
+				Query,
+				[&World, &Image](
+					FStringView SectionId,
+					int32 LeafIndex,
+					FSeinCanonicalStateProofLeaf& OutLeaf,
+					FString& OutError)
+				{
+					return FSeinWorldSubsystemTestAccess::DescribeProofLeaf(
+						World, Image, SectionId, LeafIndex, OutLeaf, OutError);
+				},
+				OutResponse);
+		}
+	}
+
+	TEST(DesyncProofWalkNamesTheOneDivergentEntitySlot,
+		"SeinARTS.Unit.Net.DesyncProof")
+	{
+		using namespace DesyncProofWalkTestLocal;
+		FActorTestSpawner ReferenceSpawner;
+		FActorTestSpawner DivergentSpawner;
+		USeinWorldSubsystem* Reference =
+			ReferenceSpawner.GetWorld().GetSubsystem<USeinWorldSubsystem>();
+		USeinWorldSubsystem* Divergent =
+			DivergentSpawner.GetWorld().GetSubsystem<USeinWorldSubsystem>();
+		ASSERT_THAT(IsNotNull(Reference));
+		ASSERT_THAT(IsNotNull(Divergent));
+
+		FString Error;
+		ASSERT_THAT(IsTrue(StartProofWorld(*Reference, Error)));
+		ASSERT_THAT(IsTrue(StartProofWorld(*Divergent, Error)));
+		SpawnRow(*Reference);
+		const TArray<FSeinEntityHandle> Handles = SpawnRow(*Divergent);
+		const FSeinEntityHandle Moved = Handles[3];
+		{
+			auto SimScope = FSeinSimContextTestAccess::Enter(*Divergent);
+			FSeinEntity* Entity = Divergent->GetEntityMutable(Moved);
+			ASSERT_THAT(IsNotNull(Entity));
+			Entity->Transform.SetLocation(FFixedVector(
+				FFixedPoint::FromInt(301),
+				FFixedPoint::Zero,
+				FFixedPoint::Zero));
+		}
+
+		FGuid ReferenceRoot;
+		FGuid DivergentRoot;
+		ASSERT_THAT(IsTrue(FSeinWorldSubsystemTestAccess::SealRoutineRoot(
+			*Reference, false, ReferenceRoot, Error)));
+		ASSERT_THAT(IsTrue(FSeinWorldSubsystemTestAccess::SealRoutineRoot(
+			*Divergent, false, DivergentRoot, Error)));
+		ASSERT_THAT(IsFalse(ReferenceRoot == DivergentRoot));
+
+		FSeinCanonicalStateProofImage ReferenceImage;
+		FSeinCanonicalStateProofImage DivergentImage;
+		ASSERT_THAT(IsTrue(FSeinWorldSubsystemTestAccess::CaptureProofImage(
+			*Reference, ReferenceImage, Error)));
+		ASSERT_THAT(IsTrue(FSeinWorldSubsystemTestAccess::CaptureProofImage(
+			*Divergent, DivergentImage, Error)));
+		ASSERT_THAT(IsTrue(ReferenceImage.Root == ReferenceRoot));
+
+		FSeinDesyncProofWalk Walk;
+		Walk.Begin(
+			Reference->GetCurrentTick(),
+			FSeinNetworkParticipantID(FGuid(1, 0, 0, 1)),
+			FSeinNetworkParticipantID(FGuid(1, 0, 0, 2)));
+		for (int32 Round = 0; Round < 64 && Walk.IsActive(); ++Round)
+		{
+			FSeinDesyncProofResponse ReferenceResponse;
+			FSeinDesyncProofResponse DivergentResponse;
+			AnswerFrom(*Reference, ReferenceImage,
+				Walk.GetPendingQuery(), ReferenceResponse);
+			AnswerFrom(*Divergent, DivergentImage,
+				Walk.GetPendingQuery(), DivergentResponse);
+			Walk.Advance(ReferenceResponse, DivergentResponse);
+		}
+		ASSERT_THAT(IsFalse(Walk.IsActive()));
+
+		const FSeinDesyncLocalization& Result = Walk.GetResult();
+		ASSERT_THAT(IsTrue(Result.Error.IsEmpty()));
+		ASSERT_THAT(IsFalse(Result.bTruncated));
+		ASSERT_THAT(IsTrue(
+			Result.DivergentSections.Contains(TEXT("core/entity-pool"))));
+		ASSERT_THAT(AreEqual(1, Result.Leaves.Num()));
+		const FSeinDesyncLeafDiff& Leaf = Result.Leaves[0];
+		ASSERT_THAT(AreEqual(FString(TEXT("core/entity-pool")), Leaf.SectionId));
+		ASSERT_THAT(AreEqual(Moved.Index, Leaf.LeafIndex));
+		ASSERT_THAT(IsTrue(Leaf.bReferenceAtCheckpoint));
+		ASSERT_THAT(IsTrue(Leaf.bDivergentAtCheckpoint));
+		ASSERT_THAT(IsFalse(Leaf.ReferencePayload == Leaf.DivergentPayload));
+
+		// Sections, one level per round trip down the slot tree, then leaves.
+		const int32 TreeDepth = FMath::CeilLogTwo(
+			ReferenceImage.FindSection(TEXT("core/entity-pool"))
+				->Tree->GetLeafBase());
+		ASSERT_THAT(IsTrue(Result.RoundTrips <= TreeDepth + 2));
+
+		Reference->StopSimulation();
+		Divergent->StopSimulation();
+	}
+
+	TEST(DesyncProofWalkStopsWhenAPeerHasNoImage,
+		"SeinARTS.Unit.Net.DesyncProof")
+	{
+		FSeinDesyncProofWalk Walk;
+		Walk.Begin(
+			10,
+			FSeinNetworkParticipantID(FGuid(1, 0, 0, 1)),
+			FSeinNetworkParticipantID(FGuid(1, 0, 0, 2)));
+		ASSERT_THAT(IsTrue(Walk.IsActive()));
+
+		FSeinDesyncProofResponse Missing;
+		FSeinDesyncProofWalk::Answer(
+			FSeinCanonicalStateProofImage(),
+			Walk.GetPendingQuery(),
+			[](FStringView, int32, FSeinCanonicalStateProofLeaf&, FString&)
+			{
+				return false;
+			},
+			Missing);
+		ASSERT_THAT(IsFalse(Missing.bAvailable));
+
+		FSeinDesyncProofResponse Present;
+		Present.bAvailable = true;
+		Walk.Advance(Present, Missing);
+		ASSERT_THAT(IsFalse(Walk.IsActive()));
+		ASSERT_THAT(IsFalse(Walk.GetResult().Error.IsEmpty()));
+		ASSERT_THAT(AreEqual(1, Walk.GetResult().RoundTrips));
+	}
+}
@@ -0,0 +1,124 @@
+#include "CQTest.h"
+#include "SeinAdaptiveInputDelay.h"
+
+namespace UE::SeinARTSTests
+{
+	namespace
+	{
+		FSeinAdaptiveInputDelayConfig MakeAdaptiveConfig()
+		{
+			FSeinAdaptiveInputDelayConfig Config;
+			Config.bEnabled = true;
+			Config.InitialDelayTurns = 3;
+			Config.MinDelayTurns = 2;
+			Config.MaxDelayTurns = 4;
+			Config.WindowTurns = 10;
+			Config.TargetLeadTurns = 1;
+			Config.LateSamplesToRaise = 2;
+			Config.LowerTolerance = 0.0;
+			return Config;
+		}
+
+		/** One on-time submission per coordinator turn in [First, Last]. */
+		void RecordComfortableWindow(
+			FSeinAdaptiveInputDelay& Scheduler, int32 First, int32 Last)
+		{
+			for (int32 CoordinatorTurn = First; CoordinatorTurn <= Last; ++CoordinatorTurn)
+			{
+				Scheduler.RecordSubmission(
+					FSeinPlayerID(1), CoordinatorTurn + 5, CoordinatorTurn);
+			}
+		}
+	}
+
+	TEST(AdaptiveInputDelayStaysSilentWhenDisabled,
+		"SeinARTS.Unit.Network.Protocol")
+	{
+		FSeinAdaptiveInputDelay Scheduler;
+		FSeinAdaptiveInputDelayConfig Config = MakeAdaptiveConfig();
+		Config.bEnabled = false;
+		Scheduler.Configure(Config);
+		Scheduler.RecordSubmission(FSeinPlayerID(1), 4, 4);
+		Scheduler.RecordSubmission(FSeinPlayerID(1), 5, 5);
+		ASSERT_THAT(AreEqual(0, Scheduler.StampTurn(6, 5)));
+		ASSERT_THAT(AreEqual(0, Scheduler.GetLatestDelay()));
+		ASSERT_THAT(IsTrue(Scheduler.GetSessionLeads().IsEmpty()));
+	}
+
+	TEST(AdaptiveInputDelayRaisesOnLateLeadAndLowersOnSpareLead,
+		"SeinARTS.Unit.Network.Protocol")
+	{
+		FSeinAdaptiveInputDelay Scheduler;
+		Scheduler.Configure(MakeAdaptiveConfig());
+		ASSERT_THAT(AreEqual(3, Scheduler.StampTurn(3, 0)));
+
+		// Two submissions that reached the coordinator at their own turn's
+		// gate raise the delay from the next new turn only.
+		Scheduler.RecordSubmission(FSeinPlayerID(1), 4, 4);
+		Scheduler.RecordSubmission(FSeinPlayerID(1), 5, 5);
+		ASSERT_THAT(AreEqual(4, Scheduler.StampTurn(6, 5)));
+		ASSERT_THAT(AreEqual(3, Scheduler.StampTurn(5, 5)));
+		ASSERT_THAT(AreEqual(1, Scheduler.GetChangeCount()));
+
+		// Turns authored before peers adopted the change do not count
+		// against it.
+		Scheduler.RecordSubmission(FSeinPlayerID(1), 9, 9);
+		Scheduler.RecordSubmission(FSeinPlayerID(1), 10, 10);
+		ASSERT_THAT(AreEqual(4, Scheduler.StampTurn(7, 6)));
+		const FSeinSubmissionLeadHistogram& Session =
+			Scheduler.GetSessionLeads().FindChecked(FSeinPlayerID(1));
+		ASSERT_THAT(AreEqual(4u, Session.Total));
+		ASSERT_THAT(AreEqual(4u, Session.CountBelow(1)));
+
+		// A full window of spare lead lowers one turn at a time.
+		RecordComfortableWindow(Scheduler, 6, 15);
+		ASSERT_THAT(AreEqual(3, Scheduler.StampTurn(16, 15)));
+		RecordComfortableWindow(Scheduler, 16, 25);
+		ASSERT_THAT(AreEqual(2, Scheduler.StampTurn(26, 25)));
+		RecordComfortableWindow(Scheduler, 26, 35);
+		ASSERT_THAT(AreEqual(2, Scheduler.StampTurn(36, 35)));
+		ASSERT_THAT(AreEqual(3, Scheduler.GetChangeCount()));
+
+		// Raises stop at the configured ceiling.
+		Scheduler.RecordSubmission(FSeinPlayerID(2), 40, 40);
+		Scheduler.RecordSubmission(FSeinPlayerID(2), 40, 40);
+		ASSERT_THAT(AreEqual(3, Scheduler.StampTurn(41, 40)));
+		Scheduler.RecordSubmission(FSeinPlayerID(2), 45, 45);
+		Scheduler.RecordSubmission(FSeinPlayerID(2), 45, 45);
+		ASSERT_THAT(AreEqual(4, Scheduler.StampTurn(46, 45)));
+		Scheduler.RecordSubmission(FSeinPlayerID(2), 51, 51);
+		Scheduler.RecordSubmission(FSeinPlayerID(2), 51, 51);
+		ASSERT_THAT(AreEqual(4, Scheduler.StampTurn(52, 51)));
+		ASSERT_THAT(AreEqual(5, Scheduler.GetChangeCount()));
+
+		// Every committed turn keeps the delay it was first stamped with.
+		ASSERT_THAT(AreEqual(3, Scheduler.GetDelayForTurn(5)));
+		ASSERT_THAT(AreEqual(4, Scheduler.GetDelayForTurn(15)));
+		ASSERT_THAT(AreEqual(2, Scheduler.GetDelayForTurn(40)));
+		ASSERT_THAT(AreEqual(4, Scheduler.GetDelayForTurn(52)));
+	}
+
+	TEST(LatencyHistogramsClampIntoOpenEndedBuckets,
+		"SeinARTS.Unit.Network.Protocol")
+	{
+		FSeinSubmissionLeadHistogram Leads;
+		Leads.Add(-3);
+		Leads.Add(2);
+		Leads.Add(400);
+		ASSERT_THAT(AreEqual(1u, Leads.Buckets[0]));
+		ASSERT_THAT(AreEqual(1u, Leads.Buckets[2]));
+		ASSERT_THAT(AreEqual(1u, Leads.Buckets[FSeinSubmissionLeadHistogram::NumBuckets - 1]));
+		ASSERT_THAT(AreEqual(2u, Leads.CountBelow(3)));
+
+		FSeinGateStallHistogram Stalls;
+		Stalls.Add(0.01);
+		Stalls.Add(0.3);
+		Stalls.Add(5.0);
+		ASSERT_THAT(AreEqual(1u, Stalls.Buckets[0]));
+		ASSERT_THAT(AreEqual(1u, Stalls.Buckets[3]));
+		ASSERT_THAT(AreEqual(1u, Stalls.Buckets[FSeinGateStallHistogram::NumBuckets - 1]));
+		ASSERT_THAT(AreEqual(3u, Stalls.Total));
+		ASSERT_THAT(AreEqual(FString(TEXT(">=1000ms")),
+			FSeinGateStallHistogram::GetBucketLabel(FSeinGateStallHistogram::NumBuckets - 1)));
+	}
+}
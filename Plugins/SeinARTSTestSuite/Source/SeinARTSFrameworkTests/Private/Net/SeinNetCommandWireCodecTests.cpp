@@ -5,6 +5,8 @@
 #include "Tags/SeinARTSGameplayTags.h"
 #include "TestTypes/SeinCommandSchemaTestTypes.h"
 
+#include <initializer_list>
+
 namespace UE::SeinARTSTests
 {
 	namespace
@@ -213,4 +215,76 @@ namespace UE::SeinARTSTests
 			CanonicalNames[0],
 			Decoded[0].Payload.Get<FSeinCommandSchemaIdentityWireTestPayload>().Name));
 	}
+
+	TEST(TurnControlRecordRidesAfterCanonicalCommands,
+		"SeinARTS.Unit.Network.Protocol")
+	{
+		const FSeinCommandSchemaDescriptor Schema = MakePingSchema();
+		auto FindSchema = [&Schema](
+			FGameplayTag Type, int32 Version, FSeinCommandSchemaDescriptor& Out)
+		{
+			if (Type != Schema.CommandType || Version != Schema.SchemaVersion)
+				return false;
+			Out = Schema;
+			return true;
+		};
+		FSeinCommand Command;
+		Command.CommandType = Schema.CommandType;
+		Command.SchemaVersion = Schema.SchemaVersion;
+		const TArray<FSeinCommand> Commands{ Command };
+
+		// An unset record is byte-identical to the plain canonical batch.
+		FString Error;
+		FSeinOpaqueCommandBatch Plain;
+		FSeinOpaqueCommandBatch Unset;
+		ASSERT_THAT(IsTrue(FSeinNetCommandWireCodec::EncodeCommands(
+			Commands, 1, FindSchema, Plain, Error)));
+		ASSERT_THAT(IsTrue(FSeinNetCommandWireCodec::EncodeTurn(
+			Commands, FSeinTurnControlRecord(), 1, FindSchema, Unset, Error)));
+		ASSERT_THAT(IsTrue(Plain.Bytes == Unset.Bytes));
+
+		FSeinTurnControlRecord Control;
+		Control.InputDelayTurns = 5;
+		FSeinOpaqueCommandBatch Controlled;
+		ASSERT_THAT(IsTrue(FSeinNetCommandWireCodec::EncodeTurn(
+			Commands, Control, 1, FindSchema, Controlled, Error)));
+		ASSERT_THAT(AreEqual(Plain.Bytes.Num() + 1, Controlled.Bytes.Num()));
+
+		TArray<FSeinCommand> Decoded;
+		FSeinTurnControlRecord DecodedControl;
+		ASSERT_THAT(IsTrue(FSeinNetCommandWireCodec::DecodeTurn(
+			Controlled, 1, FindSchema, Decoded, DecodedControl, Error)));
+		ASSERT_THAT(AreEqual(1, Decoded.Num()));
+		ASSERT_THAT(AreEqual(5, static_cast<int32>(DecodedControl.InputDelayTurns)));
+
+		// Command-only readers (replay) accept the turn and drop the record.
+		ASSERT_THAT(IsTrue(FSeinNetCommandWireCodec::DecodeCommands(
+			Controlled, 1, FindSchema, Decoded, Error)));
+		ASSERT_THAT(AreEqual(1, Decoded.Num()));
+		ASSERT_THAT(IsTrue(FSeinNetCommandWireCodec::DecodeTurn(
+			Plain, 1, FindSchema, Decoded, DecodedControl, Error)));
+		ASSERT_THAT(IsFalse(DecodedControl.IsSet()));
+
+		// Every out-of-range or missing trailer fails closed.
+		for (const uint8 Bad : { uint8(0), uint8(SeinNetProtocolLimits::MaxInputDelayTurns + 1) })
+		{
+			FSeinOpaqueCommandBatch Corrupt = Controlled;
+			Corrupt.Bytes.Last() = Bad;
+			ASSERT_THAT(IsFalse(FSeinNetCommandWireCodec::DecodeTurn(
+				Corrupt, 1, FindSchema, Decoded, DecodedControl, Error)));
+		}
+		FSeinOpaqueCommandBatch Truncated = Controlled;
+		Truncated.Bytes.Pop();
+		ASSERT_THAT(IsFalse(FSeinNetCommandWireCodec::DecodeTurn(
+			Truncated, 1, FindSchema, Decoded, DecodedControl, Error)));
+		FSeinOpaqueCommandBatch Trailing = Controlled;
+		Trailing.Bytes.Add(1);
+		ASSERT_THAT(IsFalse(FSeinNetCommandWireCodec::DecodeTurn(
+			Trailing, 1, FindSchema, Decoded, DecodedControl, Error)));
+
+		FSeinTurnControlRecord TooLarge;
+		TooLarge.InputDelayTurns = SeinNetProtocolLimits::MaxInputDelayTurns + 1;
+		ASSERT_THAT(IsFalse(FSeinNetCommandWireCodec::EncodeTurn(
+			Commands, TooLarge, 1, FindSchema, Controlled, Error)));
+	}
 }
@@ -13,6 +13,7 @@
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
 #include "SeinNetCommandWireCodec.h"
+#include "SeinReplayFastForward.h"
 #include "SeinReplayFormat.h"
 #include "SeinReplayJournalFormat.h"
 #include "SeinReplayReader.h"
@@ -337,6 +338,31 @@ namespace UE::SeinARTSTests
 			int32 PreviousTurnBatchSize = 0;
 		};
 
+		struct FScopedReplayCheckpointCoding
+		{
+			FScopedReplayCheckpointCoding(int32 KeyframeInterval, bool bCompress)
+			{
+				Settings = GetMutableDefault<USeinARTSCoreSettings>();
+				check(Settings);
+				PreviousKeyframeInterval =
+					Settings->ReplayCheckpointKeyframeInterval;
+				bPreviousCompress = Settings->bCompressReplayCheckpoints;
+				Settings->ReplayCheckpointKeyframeInterval = KeyframeInterval;
+				Settings->bCompressReplayCheckpoints = bCompress;
+			}
+
+			~FScopedReplayCheckpointCoding()
+			{
+				Settings->ReplayCheckpointKeyframeInterval =
+					PreviousKeyframeInterval;
+				Settings->bCompressReplayCheckpoints = bPreviousCompress;
+			}
+
+			USeinARTSCoreSettings* Settings = nullptr;
+			int32 PreviousKeyframeInterval = 1;
+			bool bPreviousCompress = false;
+		};
+
 		struct FScopedReplayWorkerDrain
 		{
 			USeinReplayWriter* Writer = nullptr;
@@ -1581,6 +1607,75 @@ namespace UE::SeinARTSTests
 		FullTarget->StopSimulation();
 	}
 
+	TEST(ReplayV9DeltaCheckpointSeekMatchesTheSourceCanonicalRoot,
+		"SeinARTS.Determinism.Network.Replay")
+	{
+		FScopedReplayCheckpointCoding Coding(
+			/*KeyframeInterval=*/4, /*bCompress=*/true);
+		FActorTestSpawner SourceSpawner;
+		USeinWorldSubsystem* Source =
+			SourceSpawner.GetWorld().GetSubsystem<USeinWorldSubsystem>();
+		ASSERT_THAT(IsNotNull(Source));
+		USeinReplayWriter* Writer = StartV9Recording(
+			*Source, MakeOnePlayerMatchSettings());
+		ASSERT_THAT(IsNotNull(Writer));
+
+		const USeinARTSCoreSettings* Settings =
+			GetDefault<USeinARTSCoreSettings>();
+		const int32 TicksPerTurn = Settings->TurnRate > 0
+			? FMath::Max(1, Settings->SimulationTickRate / Settings->TurnRate)
+			: 1;
+		const int32 FirstTurn = Settings->InputDelayTurns > 0
+			? Settings->InputDelayTurns
+			: 3;
+		const int32 CheckpointTick = FirstTurn * TicksPerTurn;
+		const int32 EndTick = (FirstTurn + 1) * TicksPerTurn;
+		Writer->RecordTurn(FirstTurn, {});
+		Writer->RecordTurn(FirstTurn + 1, {});
+		FString Error;
+		FGuid SourceCheckpointRoot;
+
+		ASSERT_THAT(IsTrue(Source->StartSimulation()));
+		for (int32 ExpectedTick = 1; ExpectedTick <= EndTick; ++ExpectedTick)
+		{
+			FTSTicker::GetCoreTicker().Tick(
+				Source->GetFixedDeltaTimeSeconds());
+			ASSERT_THAT(AreEqual(ExpectedTick, Source->GetCurrentTick()));
+			Writer->ObserveCompletedTick(ExpectedTick);
+			if (ExpectedTick == CheckpointTick)
+			{
+				ASSERT_THAT(IsTrue(
+					Writer->CaptureCheckpoint(/*bRequired=*/false)));
+				ASSERT_THAT(IsTrue(Source->ComputeCanonicalStateRoot(
+					SourceCheckpointRoot, Error)));
+			}
+		}
+		Source->StopSimulation();
+		FScopedReplayFile ReplayFile{Writer->FinishRecording()};
+		ASSERT_THAT(IsFalse(ReplayFile.Path.IsEmpty()));
+
+		// The checkpoint is a delta against the tick-zero keyframe; the
+		// reader rebuilds its canonical envelope before restoring it.
+		FActorTestSpawner ProbeSpawner;
+		USeinWorldSubsystem* Probe =
+			ProbeSpawner.GetWorld().GetSubsystem<USeinWorldSubsystem>();
+		ASSERT_THAT(IsNotNull(Probe));
+		USeinReplayReader* Reader =
+			NewObject<USeinReplayReader>(&ProbeSpawner.GetWorld());
+		ASSERT_THAT(IsTrue(Reader->LoadFromFile(ReplayFile.Path)));
+		TArray<int32> CheckpointTicks;
+		Reader->GetCheckpointTicks(CheckpointTicks);
+		ASSERT_THAT(IsTrue(CheckpointTicks.Contains(CheckpointTick)));
+		ASSERT_THAT(IsTrue(Reader->PlayFromTick(CheckpointTick)));
+		Reader->Stop();
+		FGuid RestoredCheckpointRoot;
+		ASSERT_THAT(IsTrue(Probe->ComputeCanonicalStateRoot(
+			RestoredCheckpointRoot, Error)));
+		ASSERT_THAT(AreEqual(
+			SourceCheckpointRoot.ToString(EGuidFormats::Digits),
+			RestoredCheckpointRoot.ToString(EGuidFormats::Digits)));
+	}
+
 	TEST(ReplayPeriodicCheckpointSessionStaysBoundedAndEveryCheckpointSeeksExact,
 		"SeinARTS.Integration.Network.Replay")
 	{
@@ -2781,6 +2876,114 @@ namespace UE::SeinARTSTests
 		ASSERT_THAT(IsFalse(Reader->IsPlaying()));
 	}
 
+	TEST(ReplayFastForwardReachesEndTickWithoutPresentingFrames,
+		"SeinARTS.Integration.Network.Replay")
+	{
+		FActorTestSpawner Spawner;
+		USeinWorldSubsystem* World =
+			Spawner.GetWorld().GetSubsystem<USeinWorldSubsystem>();
+		ASSERT_THAT(IsNotNull(World));
+		BindReplayTestMaterializer(*World);
+
+		FScopedReplayFile ReplayFile{WriteLegacyV8Replay(
+			*World, MakeExecutableHeader(*World), {}, /*EndTick=*/6)};
+		ASSERT_THAT(IsFalse(ReplayFile.Path.IsEmpty()));
+
+		int32 CompletedTicks = 0;
+		int32 PresentedFrames = 0;
+		const FDelegateHandle TickHandle = World->OnSimTickCompleted.AddLambda(
+			[&CompletedTicks](int32) { ++CompletedTicks; });
+		const FDelegateHandle FrameHandle = World->OnSimFrameCompleted.AddLambda(
+			[&PresentedFrames](int32, int32) { ++PresentedFrames; });
+
+		// No engine tick is pumped: the runner alone must drive playback.
+		FSeinReplayFastForwardReport Report;
+		ASSERT_THAT(IsTrue(SeinReplayFastForward::Run(
+			Spawner.GetWorld(), ReplayFile.Path, {}, Report)));
+		World->OnSimTickCompleted.Remove(TickHandle);
+		World->OnSimFrameCompleted.Remove(FrameHandle);
+
+		ASSERT_THAT(AreEqual(6, World->GetCurrentTick()));
+		ASSERT_THAT(AreEqual(6, Report.TicksSimulated));
+		ASSERT_THAT(AreEqual(6, CompletedTicks));
+		ASSERT_THAT(AreEqual(0, PresentedFrames));
+		ASSERT_THAT(IsTrue(Report.FinalRoot.IsValid()));
+		ASSERT_THAT(IsFalse(World->IsSimulationRunning()));
+		ASSERT_THAT(IsFalse(World->IsSystemTickTimingEnabled()));
+	}
+
+	TEST(ReplayFastForwardStopTickSealsARootMidJournal,
+		"SeinARTS.Integration.Network.Replay")
+	{
+		FActorTestSpawner Spawner;
+		USeinWorldSubsystem* World =
+			Spawner.GetWorld().GetSubsystem<USeinWorldSubsystem>();
+		ASSERT_THAT(IsNotNull(World));
+		BindReplayTestMaterializer(*World);
+
+		FScopedReplayFile ReplayFile{WriteLegacyV8Replay(
+			*World, MakeExecutableHeader(*World), {}, /*EndTick=*/6)};
+		ASSERT_THAT(IsFalse(ReplayFile.Path.IsEmpty()));
+
+		FSeinReplayFastForwardOptions Options;
+		Options.StopTick = 3;
+		FSeinReplayFastForwardReport Report;
+		ASSERT_THAT(IsTrue(SeinReplayFastForward::Run(
+			Spawner.GetWorld(), ReplayFile.Path, Options, Report)));
+		ASSERT_THAT(AreEqual(3, World->GetCurrentTick()));
+		ASSERT_THAT(AreEqual(3, Report.TicksSimulated));
+		ASSERT_THAT(AreEqual(6, Report.EndTick));
+		ASSERT_THAT(IsFalse(Report.StartRoot.IsValid()));
+		ASSERT_THAT(IsTrue(Report.FinalRoot.IsValid()));
+		ASSERT_THAT(IsFalse(World->IsSimulationRunning()));
+	}
+
+	TEST(ReplaySegmentsSplitAtInteriorCheckpointsAndReportTheFirstBrokenSeam,
+		"SeinARTS.Unit.Network.ReplayFormat")
+	{
+		TArray<FSeinReplaySegment> Segments;
+		SeinReplayFastForward::PlanSegments({60, 0, 30, 30, 90, 120}, 90, Segments);
+		ASSERT_THAT(AreEqual(3, Segments.Num()));
+		ASSERT_THAT(AreEqual(0, Segments[0].StartTick));
+		ASSERT_THAT(AreEqual(30, Segments[0].StopTick));
+		ASSERT_THAT(AreEqual(30, Segments[1].StartTick));
+		ASSERT_THAT(AreEqual(60, Segments[1].StopTick));
+		ASSERT_THAT(AreEqual(60, Segments[2].StartTick));
+		ASSERT_THAT(AreEqual(90, Segments[2].StopTick));
+
+		const FGuid RootA(1, 2, 3, 4);
+		const FGuid RootB(5, 6, 7, 8);
+		TArray<FSeinReplaySegmentResult> Results;
+		Results.SetNum(Segments.Num());
+		for (int32 Index = 0; Index < Segments.Num(); ++Index)
+		{
+			Results[Index].StartTick = Segments[Index].StartTick;
+			Results[Index].StopTick = Segments[Index].StopTick;
+			Results[Index].bSucceeded = true;
+		}
+		Results[0].EndRoot = RootA;
+		Results[1].StartRoot = RootA;
+		Results[1].EndRoot = RootB;
+		Results[2].StartRoot = RootB;
+		Results[2].EndRoot = RootA;
+
+		FString Reason;
+		ASSERT_THAT(AreEqual(
+			INDEX_NONE,
+			SeinReplayFastForward::FindFirstDivergentSegment(Results, Reason)));
+
+		// A later failure does not mask an earlier broken seam.
+		Results[2].StartRoot = RootA;
+		Results[2].bSucceeded = false;
+		ASSERT_THAT(AreEqual(
+			1, SeinReplayFastForward::FindFirstDivergentSegment(Results, Reason)));
+		ASSERT_THAT(IsTrue(Reason.Contains(TEXT("tick 60"))));
+
+		Results[2].StartRoot = RootB;
+		ASSERT_THAT(AreEqual(
+			2, SeinReplayFastForward::FindFirstDivergentSegment(Results, Reason)));
+	}
+
 	TEST(ReplayPlaybackOwnsExternalCommandIngress,
 		"SeinARTS.Integration.Network.Replay")
 	{
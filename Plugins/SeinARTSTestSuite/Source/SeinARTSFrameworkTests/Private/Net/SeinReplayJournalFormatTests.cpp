@@ -26,6 +26,37 @@ namespace UE::SeinARTSTests
 			Bytes[Offset + 2] = static_cast<uint8>(Value >> 8);
 			Bytes[Offset + 3] = static_cast<uint8>(Value);
 		}
+
+		/** Canonical two-section envelope whose state drifts a little per tick. */
+		TArray<uint8> MakeCheckpointEnvelope(int32 Tick)
+		{
+			FSeinSnapshotEnvelope Envelope;
+			Envelope.SnapshotTick = Tick;
+			Envelope.CommandProtocolDigest = FGuid(1, 2, 3, 4);
+			Envelope.CompatibilityDigest = FGuid(20, 21, 22, 23);
+			for (int32 SectionIndex = 0; SectionIndex < 2; ++SectionIndex)
+			{
+				FSeinSnapshotEnvelopeSection& Section =
+					Envelope.Sections.AddDefaulted_GetRef();
+				Section.SectionId = SectionIndex == 0
+					? TEXT("core.entities")
+					: TEXT("core.timers");
+				Section.SchemaDigest = FGuid(5, 6, 7, 8 + SectionIndex);
+				Section.DescriptorDigest = FGuid(9, 10, 11, 12 + SectionIndex);
+				for (int32 Index = 0; Index < 512; ++Index)
+				{
+					Section.Payload.Add(static_cast<uint8>(Index / 4 + SectionIndex));
+				}
+				Section.Payload[Tick % 512] = static_cast<uint8>(Tick);
+				Section.Payload.AddZeroed(Tick % 3);
+			}
+			TArray<uint8> Bytes;
+			FSeinSnapshotEnvelopeMetadata Metadata;
+			FString Error;
+			check(FSeinSnapshotEnvelopeCodec::Encode(
+				Envelope, Bytes, Metadata, Error));
+			return Bytes;
+		}
 	}
 
 	TEST(ReplayV9PrefixRoundTripsAndRejectsTampering,
@@ -214,4 +245,208 @@ namespace UE::SeinARTSTests
 		ASSERT_THAT(IsFalse(EncodeFrontier(Frontier, Bytes, Error)));
 		ASSERT_THAT(IsTrue(Error.Contains(TEXT("contiguous range"))));
 	}
+
+	TEST(ReplayV9CodedCheckpointsChainDeltasBackToTheirKeyframe,
+		"SeinARTS.Unit.Network.ReplayFormat.V9")
+	{
+		using namespace SeinReplayJournalFormat;
+		FCheckpointCodingPolicy Policy;
+		Policy.KeyframeInterval = 3;
+		Policy.bCompress = true;
+
+		FCheckpointDeltaBase WriterBase;
+		FCheckpointDeltaBase ReaderBase;
+		TArray<TArray<uint8>> Payloads;
+		FString Error;
+		for (int32 Checkpoint = 0; Checkpoint < 4; ++Checkpoint)
+		{
+			const int32 Tick = Checkpoint * 30;
+			const TArray<uint8> Envelope = MakeCheckpointEnvelope(Tick);
+			TArray<uint8> Payload;
+			uint8 Flags = 0;
+			FCheckpointDeltaBase NextWriterBase;
+			ASSERT_THAT(IsTrue(EncodeCheckpointPayload(
+				Envelope,
+				Policy,
+				WriterBase,
+				Payload,
+				Flags,
+				NextWriterBase,
+				Error)));
+			ASSERT_THAT(AreEqual(CheckpointFlagSectionCoded, Flags));
+			ASSERT_THAT(AreEqual(Checkpoint % 3, NextWriterBase.ChainDepth));
+			ASSERT_THAT(IsTrue(Payload.Num() < Envelope.Num()));
+			WriterBase = MoveTemp(NextWriterBase);
+
+			TArray<uint8> FrameBytes;
+			FFrameHeader Header;
+			ASSERT_THAT(IsTrue(BuildFrame(
+				EFrameType::Checkpoint,
+				Flags,
+				1 + Checkpoint,
+				INDEX_NONE,
+				INDEX_NONE,
+				Tick,
+				FGuid(70, 71, 72, 73),
+				Payload,
+				FrameBytes,
+				Header,
+				Error)));
+
+			TArray<uint8> Rebuilt;
+			FCheckpointDeltaBase NextReaderBase;
+			ASSERT_THAT(IsTrue(DecodeCheckpointPayload(
+				Flags, Payload, ReaderBase, Rebuilt, NextReaderBase, Error)));
+			ASSERT_THAT(IsTrue(Rebuilt == Envelope));
+			ReaderBase = MoveTemp(NextReaderBase);
+			Payloads.Add(MoveTemp(Payload));
+		}
+
+		// A delta cannot be rebuilt without the checkpoint before it.
+		TArray<uint8> Rebuilt;
+		FCheckpointDeltaBase Base;
+		ASSERT_THAT(IsFalse(DecodeCheckpointPayload(
+			CheckpointFlagSectionCoded,
+			Payloads[1],
+			FCheckpointDeltaBase(),
+			Rebuilt,
+			Base,
+			Error)));
+		ASSERT_THAT(IsTrue(Error.Contains(TEXT("base"))));
+
+		// Plain policies keep the canonical envelope bytes untouched.
+		const TArray<uint8> Envelope = MakeCheckpointEnvelope(7);
+		TArray<uint8> Plain;
+		uint8 Flags = 0xff;
+		ASSERT_THAT(IsTrue(EncodeCheckpointPayload(
+			Envelope,
+			FCheckpointCodingPolicy(),
+			WriterBase,
+			Plain,
+			Flags,
+			Base,
+			Error)));
+		ASSERT_THAT(AreEqual(static_cast<uint8>(0), Flags));
+		ASSERT_THAT(IsTrue(Plain == Envelope));
+		ASSERT_THAT(IsFalse(Base.IsSet()));
+
+		// Only Checkpoint frames may carry the coding flag.
+		TArray<uint8> FrameBytes;
+		FFrameHeader Header;
+		ASSERT_THAT(IsFalse(BuildFrame(
+			EFrameType::Progress,
+			CheckpointFlagSectionCoded,
+			5,
+			INDEX_NONE,
+			INDEX_NONE,
+			0,
+			FGuid(70, 71, 72, 73),
+			TArray<uint8>({0, 0, 0, 0, 0xff, 0xff, 0xff, 0xff,
+				0xff, 0xff, 0xff, 0xff, 0, 0, 0, 0}),
+			FrameBytes,
+			Header,
+			Error)));
+		ASSERT_THAT(IsTrue(Error.Contains(TEXT("flags"))));
+	}
+
+	TEST(ReplayV9CodedCheckpointDamageNeverRebuildsAnAdmissibleEnvelope,
+		"SeinARTS.Unit.Network.ReplayFormat.V9.Security")
+	{
+		using namespace SeinReplayJournalFormat;
+		FCheckpointCodingPolicy Policy;
+		Policy.KeyframeInterval = 2;
+		FString Error;
+
+		FCheckpointDeltaBase KeyframeBase;
+		TArray<uint8> Keyframe;
+		uint8 Flags = 0;
+		ASSERT_THAT(IsTrue(EncodeCheckpointPayload(
+			MakeCheckpointEnvelope(30),
+			Policy,
+			FCheckpointDeltaBase(),
+			Keyframe,
+			Flags,
+			KeyframeBase,
+			Error)));
+		TArray<uint8> Delta;
+		FCheckpointDeltaBase DeltaBase;
+		ASSERT_THAT(IsTrue(EncodeCheckpointPayload(
+			MakeCheckpointEnvelope(60),
+			Policy,
+			KeyframeBase,
+			Delta,
+			Flags,
+			DeltaBase,
+			Error)));
+		ASSERT_THAT(AreEqual(1, DeltaBase.ChainDepth));
+
+		// Keyframes are fully verified at frame admission.
+		TArray<uint8> FrameBytes;
+		FFrameHeader Header;
+		TArray<uint8> DamagedKeyframe = Keyframe;
+		DamagedKeyframe.Last() ^= 1u;
+		ASSERT_THAT(IsFalse(BuildFrame(
+			EFrameType::Checkpoint,
+			Flags,
+			1,
+			INDEX_NONE,
+			INDEX_NONE,
+			30,
+			FGuid(70, 71, 72, 73),
+			DamagedKeyframe,
+			FrameBytes,
+			Header,
+			Error)));
+		ASSERT_THAT(IsTrue(Error.Contains(TEXT("Checkpoint"))));
+
+		// A delta whose verbatim directory was damaged still frames, but its
+		// rebuilt envelope fails the body digest that binds every byte.
+		TArray<uint8> DamagedDelta = Delta;
+		DamagedDelta[FSeinSnapshotEnvelopeCodec::PrefixBytes + 8] ^= 1u;
+		ASSERT_THAT(IsTrue(BuildFrame(
+			EFrameType::Checkpoint,
+			Flags,
+			2,
+			INDEX_NONE,
+			INDEX_NONE,
+			60,
+			FGuid(70, 71, 72, 73),
+			DamagedDelta,
+			FrameBytes,
+			Header,
+			Error)));
+		TArray<uint8> Rebuilt;
+		FCheckpointDeltaBase Base;
+		ASSERT_THAT(IsTrue(DecodeCheckpointPayload(
+			Flags, DamagedDelta, KeyframeBase, Rebuilt, Base, Error)));
+		FSeinSnapshotEnvelope Envelope;
+		FSeinSnapshotEnvelopeMetadata Metadata;
+		ASSERT_THAT(IsFalse(FSeinSnapshotEnvelopeCodec::Decode(
+			Rebuilt, Envelope, Metadata, Error)));
+		ASSERT_THAT(IsTrue(Error.Contains(TEXT("digest"))));
+
+		// Damaged delta runs either fail their own bounds or rebuild bytes
+		// the body digest refuses.
+		DamagedDelta = Delta;
+		DamagedDelta.Last() ^= 1u;
+		const bool bRebuilt = DecodeCheckpointPayload(
+			Flags, DamagedDelta, KeyframeBase, Rebuilt, Base, Error);
+		ASSERT_THAT(IsFalse(bRebuilt
+			&& FSeinSnapshotEnvelopeCodec::Decode(
+				Rebuilt, Envelope, Metadata, Error)));
+
+		// Deltas against the wrong tick's frame metadata are refused.
+		ASSERT_THAT(IsFalse(BuildFrame(
+			EFrameType::Checkpoint,
+			Flags,
+			2,
+			INDEX_NONE,
+			INDEX_NONE,
+			61,
+			FGuid(70, 71, 72, 73),
+			Delta,
+			FrameBytes,
+			Header,
+			Error)));
+	}
 }
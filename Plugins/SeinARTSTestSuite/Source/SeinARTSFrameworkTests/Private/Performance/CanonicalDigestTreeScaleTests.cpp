@@ -0,0 +1,102 @@
+#include "CQTest.h"
+
+#include "HAL/PlatformTime.h"
+#include "Serialization/SeinCanonicalDigestTree.h"
+
+namespace UE::SeinARTSTests
+{
+	namespace CanonicalDigestTreeScaleTestLocal
+	{
+		constexpr int32 TimedSamples = 7;
+		constexpr int32 LeafCounts[] = {1024, 16384, 131072};
+		/** Dirty leaves per thousand: sparse tick, busy tick, full rebuild. */
+		constexpr int32 DirtyPerMille[] = {10, 100, 1000};
+
+		FGuid SampleLeaf(int32 Leaf, int32 Sample)
+		{
+			uint64 State = (static_cast<uint64>(Leaf) << 32)
+				^ static_cast<uint64>(Sample + 1) * 0x9E3779B97F4A7C15ULL;
+			State = State * 6364136223846793005ULL + 1442695040888963407ULL;
+			return FGuid(
+				static_cast<uint32>(State >> 32) | 1u,
+				static_cast<uint32>(State),
+				static_cast<uint32>(Leaf),
+				static_cast<uint32>(Sample));
+		}
+
+		/**
+		 * Dirty an evenly spread DirtyPerMille share of the leaves with
+		 * sample-unique digests, then time only FinalizeUpdates.
+		 */
+		bool MeasureFinalize(
+			FSeinCanonicalDigestTree& Tree,
+			int32 DirtyPerMilleValue,
+			bool bForceSerial,
+			double& OutMedianMilliseconds,
+			FString& OutError)
+		{
+			const int32 Stride =
+				FMath::Max(1, 1000 / FMath::Max(1, DirtyPerMilleValue));
+			TArray<double> Samples;
+			Samples.Reserve(TimedSamples);
+			for (int32 Sample = -1; Sample < TimedSamples; ++Sample)
+			{
+				for (int32 Leaf = 0; Leaf < Tree.Num(); Leaf += Stride)
+				{
+					if (!Tree.SetLeafDigest(Leaf, SampleLeaf(Leaf, Sample), OutError))
+					{
+						return false;
+					}
+				}
+				const double StartedAt = FPlatformTime::Seconds();
+				if (!Tree.FinalizeUpdates(OutError, bForceSerial))
+				{
+					return false;
+				}
+				const double ElapsedMilliseconds =
+					(FPlatformTime::Seconds() - StartedAt) * 1000.0;
+				if (Sample >= 0)
+				{
+					Samples.Add(ElapsedMilliseconds);
+				}
+			}
+			Samples.Sort();
+			OutMedianMilliseconds = Samples[Samples.Num() / 2];
+			return true;
+		}
+	}
+
+	TEST(CanonicalDigestTreeParallelFinalizeScalesWithDirtyLevels,
+		"SeinARTS.Perf.CoreEntity.CanonicalDigestTree")
+	{
+		using namespace CanonicalDigestTreeScaleTestLocal;
+		for (const int32 LeafCount : LeafCounts)
+		{
+			for (const int32 PerMille : DirtyPerMille)
+			{
+				FString Error;
+				FSeinCanonicalDigestTree Serial;
+				FSeinCanonicalDigestTree Parallel;
+				ASSERT_THAT(IsTrue(Serial.Reset(
+					TEXT("SeinARTS.Perf.DigestTree"), LeafCount, Error)));
+				ASSERT_THAT(IsTrue(Parallel.Reset(
+					TEXT("SeinARTS.Perf.DigestTree"), LeafCount, Error)));
+
+				double SerialMs = 0.0;
+				double ParallelMs = 0.0;
+				ASSERT_THAT(IsTrue(MeasureFinalize(
+					Serial, PerMille, true, SerialMs, Error)));
+				ASSERT_THAT(IsTrue(MeasureFinalize(
+					Parallel, PerMille, false, ParallelMs, Error)));
+
+				UE_LOG(LogTemp, Display,
+					TEXT("Digest tree finalize, %d leaves, %d/1000 dirty: serial %.3f ms, parallel %.3f ms (%.2fx)"),
+					LeafCount, PerMille, SerialMs, ParallelMs,
+					ParallelMs > 0.0 ? SerialMs / ParallelMs : 0.0);
+
+				// Both trees saw the same updates; the schedules must agree.
+				ASSERT_THAT(IsTrue(Serial.GetRoot() == Parallel.GetRoot()));
+			}
+		}
+	}
+}
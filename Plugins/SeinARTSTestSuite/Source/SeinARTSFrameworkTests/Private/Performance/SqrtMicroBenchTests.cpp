@@ -0,0 +1,133 @@
+#include "CQTest.h"
+
+#include "HAL/PlatformTime.h"
+#include "Math/MathLib.h"
+#include "Types/FixedPoint.h"
+#include "Types/Vector.h"
+
+namespace UE::SeinARTSTests
+{
+	namespace SqrtMicroBenchTestLocal
+	{
+		constexpr int32 TimedSamples = 7;
+		constexpr int32 InputCount = 1 << 16;
+
+		// The pre-exact SeinMath::Sqrt: linear high-bit scan, then four Newton
+		// steps through the 128-by-64 software divide. Kept only as the baseline.
+		FFixedPoint LegacySqrt(FFixedPoint X)
+		{
+			if (X <= 0) return FFixedPoint::Zero;
+			if (X == FFixedPoint::One) return FFixedPoint::One;
+
+			const int64 Val = static_cast<int64>(X);
+			int32 HighBit = 63;
+			while (HighBit >= 0 && ((Val >> HighBit) & 1) == 0)
+			{
+				HighBit--;
+			}
+			FFixedPoint Guess(1LL << ((HighBit + 32) / 2));
+			for (int32 i = 0; i < 4; ++i)
+			{
+				if (static_cast<int64>(Guess) == 0) break;
+				const FFixedPoint Quotient = X / Guess;
+				Guess = FFixedPoint((static_cast<int64>(Guess) + static_cast<int64>(Quotient)) >> 1);
+			}
+			return Guess;
+		}
+
+		/** Squared distances shaped like the sim's: planar offsets up to ~50 m
+		 *  in cm, from a fixed LCG so every run times the same inputs. */
+		void BuildInputs(TArray<FFixedPoint>& OutSquares, TArray<FFixedVector>& OutVectors)
+		{
+			OutSquares.Reset(InputCount);
+			OutVectors.Reset(InputCount);
+			uint64 State = 0x243F6A8885A308D3ULL;
+			const auto Next = [&State]()
+			{
+				State = State * 6364136223846793005ULL + 1442695040888963407ULL;
+				return static_cast<int32>((State >> 33) % 10000) - 5000;
+			};
+			for (int32 Index = 0; Index < InputCount; ++Index)
+			{
+				const FFixedVector Offset(
+					FFixedPoint::FromInt(Next()) + FFixedPoint(static_cast<int64>(State & 0xFFFFFFFF)),
+					FFixedPoint::FromInt(Next()),
+					FFixedPoint::Zero);
+				OutVectors.Add(Offset);
+				OutSquares.Add(Offset.SizeSquared());
+			}
+		}
+
+		template <typename FunctionType>
+		double MedianMilliseconds(FunctionType&& Body)
+		{
+			TArray<double> Samples;
+			Samples.Reserve(TimedSamples);
+			for (int32 Sample = -1; Sample < TimedSamples; ++Sample)
+			{
+				const double StartedAt = FPlatformTime::Seconds();
+				Body();
+				const double ElapsedMilliseconds =
+					(FPlatformTime::Seconds() - StartedAt) * 1000.0;
+				if (Sample >= 0)
+				{
+					Samples.Add(ElapsedMilliseconds);
+				}
+			}
+			Samples.Sort();
+			return Samples[Samples.Num() / 2];
+		}
+	}
+
+	TEST(ExactSqrtOutrunsLegacyNewtonDivide, "SeinARTS.Perf.Math.Sqrt")
+	{
+		using namespace SqrtMicroBenchTestLocal;
+		TArray<FFixedPoint> Squares;
+		TArray<FFixedVector> Vectors;
+		BuildInputs(Squares, Vectors);
+		TArray<FFixedPoint> Roots;
+		Roots.SetNumZeroed(InputCount);
+
+		// Sum the raw results so neither loop can be discarded.
+		int64 LegacyChecksum = 0;
+		const double LegacyMs = MedianMilliseconds([&]()
+		{
+			LegacyChecksum = 0;
+			for (const FFixedPoint& Square : Squares)
+			{
+				LegacyChecksum += LegacySqrt(Square).Value;
+			}
+		});
+
+		int64 ExactChecksum = 0;
+		const double ExactMs = MedianMilliseconds([&]()
+		{
+			ExactChecksum = 0;
+			for (const FFixedPoint& Square : Squares)
+			{
+				ExactChecksum += SeinMath::Sqrt(Square).Value;
+			}
+		});
+
+		const double BatchMs = MedianMilliseconds([&]()
+		{
+			SeinMath::SqrtN(Squares, Roots);
+		});
+
+		const double LengthMs = MedianMilliseconds([&]()
+		{
+			SeinMath::LengthN(Vectors, Roots);
+		});
+
+		UE_LOG(LogTemp, Display,
+			TEXT("Sqrt over %d squared distances: legacy %.3f ms, exact %.3f ms, SqrtN %.3f ms, LengthN %.3f ms (checksums %lld / %lld)"),
+			InputCount, LegacyMs, ExactMs, BatchMs, LengthMs,
+			LegacyChecksum, ExactChecksum);
+
+		for (int32 Index = 0; Index < InputCount; ++Index)
+		{
+			ASSERT_THAT(IsTrue(Roots[Index] == Vectors[Index].Size()));
+		}
+		ASSERT_THAT(IsTrue(ExactMs < LegacyMs));
+	}
+}
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Types/FixedPoint.h"
+#include "Types/Vector.h"
 #include "SeinComponentStorageTestTypes.generated.h"
 
 /** Resource-owning probe used only to verify reflected storage lifecycle balance. */
@@ -31,3 +33,37 @@ struct FSeinComponentStorageLifecycleProbe
 		DestructionCount = 0;
 	}
 };
+
+/** Mixed raw-layout and reflected fields for compiled snapshot-plan parity. */
+USTRUCT(meta = (SeinDeterministic))
+struct FSeinComponentStoragePlanProbe
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int32 Count = 0;
+
+	UPROPERTY()
+	uint8 Flags = 0;
+
+	UPROPERTY()
+	int64 Stamp = 0;
+
+	UPROPERTY()
+	FFixedPoint Health;
+
+	UPROPERTY()
+	bool bActive = false;
+
+	UPROPERTY()
+	TArray<int32> Values;
+
+	UPROPERTY(Transient)
+	int32 TransientScratch = 0;
+
+	UPROPERTY()
+	FFixedVector Velocity;
+
+	UPROPERTY()
+	uint16 Tail = 0;
+};
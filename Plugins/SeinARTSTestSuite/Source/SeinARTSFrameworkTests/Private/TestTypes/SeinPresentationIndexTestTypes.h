@@ -0,0 +1,18 @@
+#pragma once
+
+#include "Actor/SeinActor.h"
+#include "Components/SceneComponent.h"
+#include "SeinPresentationIndexTestTypes.generated.h"
+
+/** Bare ASeinActor has no root, so it can't be placed; this one can. */
+UCLASS()
+class ASeinPresentationIndexTestActor : public ASeinActor
+{
+	GENERATED_BODY()
+
+public:
+	ASeinPresentationIndexTestActor()
+	{
+		RootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
+	}
+};
@@ -22,7 +22,7 @@ namespace
 	constexpr uint64 FnvOffsetBasis = 14695981039346656037ull;
 	constexpr uint64 FnvPrime = 1099511628211ull;
 
-	/** The serial-vs-parallel scenario exercises the Jacobi resolver's own
+	/** The serial-vs-parallel scenario exercises a parallel resolver's own
 	 *  execution switch, independent of whichever resolver a consuming project
 	 *  selects as its normal default. The world must be created after this
 	 *  override; declaration order below also guarantees it is destroyed before
@@ -30,7 +30,7 @@ namespace
 	class FScopedParallelCollisionResolver
 	{
 	public:
-		FScopedParallelCollisionResolver()
+		explicit FScopedParallelCollisionResolver(UClass* ResolverClass)
 			: Settings(GetMutableDefault<USeinARTSCoreSettings>())
 			, PreviousClass(Settings
 				? Settings->CollisionResolverClass
@@ -38,8 +38,7 @@ namespace
 		{
 			if (Settings)
 			{
-				Settings->CollisionResolverClass =
-					FSoftClassPath(USeinCollisionResolverParallel::StaticClass());
+				Settings->CollisionResolverClass = FSoftClassPath(ResolverClass);
 			}
 		}
 
@@ -210,7 +209,7 @@ FString FSeinCollisionDeterminismTrace::Validate(bool bExpectedParallel, int32 E
 	}
 	if (!bParallelResolverSelected)
 	{
-		return TEXT("The transient world did not select USeinCollisionResolverParallel.");
+		return TEXT("The transient world did not select the requested parallel collision resolver.");
 	}
 	if (bAuthoritativeDestinationResolverBound)
 	{
@@ -261,7 +260,10 @@ FString FSeinCollisionDeterminismTrace::Validate(bool bExpectedParallel, int32 E
 	return FString();
 }
 
-FSeinCollisionDeterminismTrace SeinRunCollisionDeterminismScenario(bool bParallel, int32 TickCount)
+FSeinCollisionDeterminismTrace SeinRunCollisionDeterminismScenario(
+	bool bParallel,
+	int32 TickCount,
+	TSubclassOf<USeinCollisionResolver> ResolverClass)
 {
 	FSeinCollisionDeterminismTrace Trace;
 	Trace.bRequestedParallel = bParallel;
@@ -272,7 +274,11 @@ FSeinCollisionDeterminismTrace SeinRunCollisionDeterminismScenario(bool bParalle
 		return Trace;
 	}
 
-	FScopedParallelCollisionResolver ResolverOverride;
+	if (!ResolverClass)
+	{
+		ResolverClass = USeinCollisionResolverParallel::StaticClass();
+	}
+	FScopedParallelCollisionResolver ResolverOverride(ResolverClass);
 	if (!ResolverOverride.IsValid())
 	{
 		Trace.FailureReason = TEXT("The collision resolver project setting was unavailable.");
@@ -297,7 +303,8 @@ FSeinCollisionDeterminismTrace SeinRunCollisionDeterminismScenario(bool bParalle
 	Trace.bParallelModeObserved =
 		SeinSimParallelEnabled() == bParallel && SeinSimParallelMinBatch() == 1;
 	Trace.bParallelResolverSelected =
-		Cast<USeinCollisionResolverParallel>(World->GetCollisionResolver()) != nullptr;
+		World->GetCollisionResolver()
+		&& World->GetCollisionResolver()->GetClass() == ResolverClass.Get();
 	// The optional Cover extension registers a provider for authoritative slot
 	// delivery, which deliberately routes collision through its serial seam.
 	// This isolated kernel workload owns a fresh world and has no cover state,
@@ -1,6 +1,9 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Templates/SubclassOf.h"
+
+class USeinCollisionResolver;
 
 /** One end-of-tick sample from the collision determinism workload. */
 struct SEINARTSTESTSUPPORT_API FSeinCollisionDeterminismFrame
@@ -37,8 +40,13 @@ struct SEINARTSTESTSUPPORT_API FSeinCollisionDeterminismTrace
 
 /**
  * Runs the exact production fixed-tick path in a CQTest transient world.
- * The packed collider workload exercises collision broadphase, parallel Jacobi
+ * The packed collider workload exercises collision broadphase, parallel
  * resolution, and the canonical world-state root across stable tick boundaries.
+ * ResolverClass selects the parallel-capable resolver under test; null means
+ * the Jacobi USeinCollisionResolverParallel.
  */
 SEINARTSTESTSUPPORT_API FSeinCollisionDeterminismTrace
-	SeinRunCollisionDeterminismScenario(bool bParallel, int32 TickCount = 120);
+	SeinRunCollisionDeterminismScenario(
+		bool bParallel,
+		int32 TickCount = 120,
+		TSubclassOf<USeinCollisionResolver> ResolverClass = nullptr);